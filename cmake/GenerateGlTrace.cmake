@@ -0,0 +1,144 @@
+# ~~~
+# SPDX-License-Identifier: BSD-3-Clause
+
+# ~~~
+#        Copyright The Authors 2021.
+#    Distributed under the 3-Clause BSD License.
+#    (See accompanying file LICENSE or copy at
+#   https://opensource.org/licenses/BSD-3-Clause)
+# ~~~
+
+# ------------------------------------------------------------------------------
+# Generate the wrappers of the GL entry points for the GL call tracing.
+#
+# Script mode (cmake -P) helper that reads the glad header and writes, for each
+# entry point it declares, a function counting and timing the calls before
+# forwarding them to the loaded entry point. The output is included by
+# gl_trace.cpp, which provides the counting (see glad/gl_trace.h):
+#
+#   GL_TRACE_FUNCTION_COUNT - the number of entry points,
+#   GL_TRACE_NAMES          - their names, indexed like the statistics,
+#   InstallWrappers()       - replaces the loaded entry points by the wrappers.
+#
+# The entry points uploading data report the size of the upload through an
+# `Uploaded_<name>()` function taking the same arguments, to be defined before
+# including the output.
+#
+# Parameters (all required):
+#   GL_HEADER - the glad header (glad/gl.h).
+#   OUTPUT    - the generated file.
+# ------------------------------------------------------------------------------
+
+# Script mode starts with the old policies, compare strings as strings and
+# support if(IN_LIST)
+cmake_policy(SET CMP0054 NEW)
+cmake_policy(SET CMP0057 NEW)
+
+foreach(param GL_HEADER OUTPUT)
+  if(NOT DEFINED ${param})
+    message(FATAL_ERROR "GenerateGlTrace: missing parameter ${param}")
+  endif()
+endforeach()
+
+# Entry points uploading data
+set(upload_functions glBufferData glBufferSubData glTexImage2D glTexSubImage2D
+                     glTexImage3D glTexSubImage3D)
+
+file(READ "${GL_HEADER}" header)
+
+# The declarations are matched without their trailing `;`, which CMake would
+# take for a list separator
+set(pfn_regex "PFN[A-Z0-9_]+PROC")
+set(declaration_regex "GLAD_API_CALL (${pfn_regex}) glad_(gl[A-Za-z0-9_]+)")
+set(typedef_regex
+    "typedef ([^\n(]+) \\(GLAD_API_PTR \\*(${pfn_regex})\\)\\(([^\n)]*)\\)")
+string(REGEX MATCHALL "${declaration_regex}" declarations "${header}")
+string(REGEX MATCHALL "${typedef_regex}" typedefs "${header}")
+
+foreach(typedef IN LISTS typedefs)
+  string(REGEX MATCH "^${typedef_regex}$" match "${typedef}")
+  set(return_${CMAKE_MATCH_2} "${CMAKE_MATCH_1}")
+  set(params_${CMAKE_MATCH_2} "${CMAKE_MATCH_3}")
+endforeach()
+
+set(names_text)
+set(wrappers_text)
+set(install_text)
+set(index 0)
+foreach(declaration IN LISTS declarations)
+  string(REGEX MATCH "^${declaration_regex}$" match "${declaration}")
+  set(type "${CMAKE_MATCH_1}")
+  set(name "${CMAKE_MATCH_2}")
+  if(NOT DEFINED return_${type})
+    message(FATAL_ERROR "GenerateGlTrace: no typedef for ${type}")
+  endif()
+  set(params "${params_${type}}")
+
+  # The arguments are the last identifier of each parameter
+  set(args)
+  if(NOT params STREQUAL "void")
+    string(REPLACE "," ";" param_list "${params}")
+    foreach(param IN LISTS param_list)
+      string(STRIP "${param}" param)
+      if(NOT param MATCHES "([A-Za-z_][A-Za-z0-9_]*)$")
+        message(FATAL_ERROR "GenerateGlTrace: can't parse ${name}(${params})")
+      endif()
+      list(APPEND args "${CMAKE_MATCH_1}")
+    endforeach()
+  endif()
+  string(REPLACE ";" ", " args "${args}")
+
+  set(upload)
+  if(name IN_LIST upload_functions)
+    set(upload "\n  call.Uploaded(Uploaded_${name}(${args}));")
+  endif()
+
+  string(APPEND names_text "    \"${name}\",\n")
+  string(
+    APPEND
+    wrappers_text
+    "${type} real_${name} = NULL;
+${return_${type}} GLAD_API_PTR trace_${name}(${params}) {
+  Call call(${index});${upload}
+  return real_${name}(${args});
+}
+")
+  string(APPEND install_text "  if (glad_${name} != NULL) {
+    real_${name} = glad_${name};
+    glad_${name} = trace_${name};
+  }
+")
+  math(EXPR index "${index} + 1")
+endforeach()
+
+if(index EQUAL 0)
+  message(FATAL_ERROR "GenerateGlTrace: no entry point in ${GL_HEADER}")
+endif()
+
+set(content
+    "// Generated by cmake/GenerateGlTrace.cmake, do not edit.
+
+// clang-format off
+// NOLINTBEGIN
+
+#define GL_TRACE_FUNCTION_COUNT ${index}
+
+const char *const GL_TRACE_NAMES[GL_TRACE_FUNCTION_COUNT] = {
+${names_text}};
+
+${wrappers_text}
+void InstallWrappers() {
+${install_text}}
+
+// NOLINTEND
+// clang-format on
+")
+
+# Only touch the output when it changes, to avoid needless re-compilations
+if(EXISTS "${OUTPUT}")
+  file(READ "${OUTPUT}" previous)
+  if("${previous}" STREQUAL "${content}")
+    return()
+  endif()
+endif()
+file(WRITE "${OUTPUT}" "${content}")
@@ -0,0 +1,122 @@
+# ~~~
+# SPDX-License-Identifier: BSD-3-Clause
+
+# ~~~
+#        Copyright The Authors 2021.
+#    Distributed under the 3-Clause BSD License.
+#    (See accompanying file LICENSE or copy at
+#   https://opensource.org/licenses/BSD-3-Clause)
+# ~~~
+
+# ------------------------------------------------------------------------------
+# Generate the glyph ranges of the icons used in the sources.
+#
+# Script mode (cmake -P) helper that scans the sources for the ICON_MDI_xxx
+# macros, looks up their code points in the icons header and writes a header
+# defining ASAP_MDI_USED_RANGES, the zero terminated list of code point ranges
+# to be used instead of the full ICON_MIN_MDI..ICON_MAX_MDI range.
+#
+# Parameters (all required):
+#   ICONS_HEADER - the IconFontCppHeaders header defining the ICON_MDI_ macros.
+#   SOURCES_LIST - a file with the paths of the sources to scan, one per line.
+#   OUTPUT       - the generated header.
+# ------------------------------------------------------------------------------
+
+foreach(param ICONS_HEADER SOURCES_LIST OUTPUT)
+  if(NOT DEFINED ${param})
+    message(FATAL_ERROR "GenerateIconRanges: missing parameter ${param}")
+  endif()
+endforeach()
+
+# Code point of each icon from the icons header
+file(STRINGS "${ICONS_HEADER}" icon_defines
+     REGEX "^#define ICON_MDI_[A-Z0-9_]+ u8\"\\\\u[0-9A-Fa-f]+\"")
+foreach(line IN LISTS icon_defines)
+  string(REGEX MATCH "^#define (ICON_MDI_[A-Z0-9_]+) u8\"\\\\u([0-9A-Fa-f]+)\""
+               _ "${line}")
+  set(codepoint_of_${CMAKE_MATCH_1} "${CMAKE_MATCH_2}")
+endforeach()
+
+# Icons used in the sources
+get_filename_component(icons_header "${ICONS_HEADER}" ABSOLUTE)
+file(STRINGS "${SOURCES_LIST}" sources)
+set(used_icons)
+foreach(source IN LISTS sources)
+  get_filename_component(source "${source}" ABSOLUTE)
+  if(source STREQUAL icons_header OR NOT EXISTS "${source}")
+    continue()
+  endif()
+  file(STRINGS "${source}" lines REGEX "ICON_MDI_[A-Z0-9_]+")
+  foreach(line IN LISTS lines)
+    string(REGEX MATCHALL "ICON_MDI_[A-Z0-9_]+" icons "${line}")
+    list(APPEND used_icons ${icons})
+  endforeach()
+endforeach()
+list(REMOVE_DUPLICATES used_icons)
+list(SORT used_icons)
+
+set(codepoints)
+foreach(icon IN LISTS used_icons)
+  if(DEFINED codepoint_of_${icon})
+    math(EXPR codepoint "0x${codepoint_of_${icon}}")
+    list(APPEND codepoints ${codepoint})
+  else()
+    message(WARNING "GenerateIconRanges: ${icon} is not an icon of ${ICONS_HEADER}")
+  endif()
+endforeach()
+list(REMOVE_DUPLICATES codepoints)
+list(SORT codepoints COMPARE NATURAL)
+
+# Merge consecutive code points into ranges
+set(ranges)
+set(range_start)
+set(range_end)
+foreach(codepoint IN LISTS codepoints)
+  if("${range_start}" STREQUAL "")
+    set(range_start ${codepoint})
+  else()
+    math(EXPR next "${range_end} + 1")
+    if(NOT codepoint EQUAL next)
+      math(EXPR first "${range_start}" OUTPUT_FORMAT HEXADECIMAL)
+      math(EXPR last "${range_end}" OUTPUT_FORMAT HEXADECIMAL)
+      list(APPEND ranges "${first}, ${last}")
+      set(range_start ${codepoint})
+    endif()
+  endif()
+  set(range_end ${codepoint})
+endforeach()
+if(NOT "${range_start}" STREQUAL "")
+  math(EXPR first "${range_start}" OUTPUT_FORMAT HEXADECIMAL)
+  math(EXPR last "${range_end}" OUTPUT_FORMAT HEXADECIMAL)
+  list(APPEND ranges "${first}, ${last}")
+endif()
+
+list(LENGTH codepoints icons_count)
+string(REPLACE ";" ", \\\n  " ranges_text "${ranges}")
+if("${ranges_text}" STREQUAL "")
+  # No icon used, ImGui still needs a valid (empty) list of ranges
+  set(ranges_text "0")
+endif()
+string(REPLACE ";" "\n// " icons_text "${used_icons}")
+
+set(content
+    "// Generated by cmake/GenerateIconRanges.cmake, do not edit.
+
+#pragma once
+
+// Glyph ranges of the ${icons_count} icons used in the sources:
+// ${icons_text}
+
+#define ASAP_MDI_USED_ICONS ${icons_count}
+#define ASAP_MDI_USED_RANGES \\
+  ${ranges_text}
+")
+
+# Only touch the output when it changes, to avoid needless re-compilations
+if(EXISTS "${OUTPUT}")
+  file(READ "${OUTPUT}" previous)
+  if("${previous}" STREQUAL "${content}")
+    return()
+  endif()
+endif()
+file(WRITE "${OUTPUT}" "${content}")
@@ -0,0 +1,211 @@
+# ~~~
+# SPDX-License-Identifier: BSD-3-Clause
+
+# ~~~
+#        Copyright The Authors 2021.
+#    Distributed under the 3-Clause BSD License.
+#    (See accompanying file LICENSE or copy at
+#   https://opensource.org/licenses/BSD-3-Clause)
+# ~~~
+
+# ------------------------------------------------------------------------------
+# Compile the theme presets into constexpr style tables.
+#
+# Script mode (cmake -P) helper that reads the theme presets (TOML files in the
+# format of the theme settings, with the name of the preset in `theme.name`)
+# and writes a header defining THEME_PRESETS, the array of the presets as
+# asap::ui::ThemePreset tables (see ui/style/theme_presets.h).
+#
+# Only the subset of TOML written by Theme::SaveStyle() is understood: one
+# `key = value` per line, the value being a number, a boolean, a string or a
+# single line array of numbers, and no comment after the values. The style
+# variables and colors are not checked here; a wrong name fails the
+# compilation of the generated header.
+#
+# Parameters (all required):
+#   PRESETS_LIST - a file with the paths of the presets, one per line.
+#   OUTPUT       - the generated header.
+# ------------------------------------------------------------------------------
+
+# Script mode starts with the old policies, compare strings as strings
+cmake_policy(SET CMP0054 NEW)
+
+foreach(param PRESETS_LIST OUTPUT)
+  if(NOT DEFINED ${param})
+    message(FATAL_ERROR "GenerateThemePresets: missing parameter ${param}")
+  endif()
+endforeach()
+
+set(number_regex "^[-+]?([0-9]+\\.?[0-9]*|\\.[0-9]+)([eE][-+]?[0-9]+)?$")
+
+# Format a TOML number as a C++ float literal
+function(float_literal value out)
+  string(STRIP "${value}" value)
+  if(NOT value MATCHES "${number_regex}")
+    set(${out} "" PARENT_SCOPE)
+    return()
+  endif()
+  if(value MATCHES "[.eE]")
+    set(${out} "${value}F" PARENT_SCOPE)
+  else()
+    set(${out} "${value}.0F" PARENT_SCOPE)
+  endif()
+endfunction()
+
+# Format a single line TOML array of numbers as the C++ initializer of an array
+# of floats, checking that it has `count` elements
+function(float_array value count out)
+  set(${out} "" PARENT_SCOPE)
+  if(NOT value MATCHES "^\\[(.*)\\]$")
+    return()
+  endif()
+  string(REPLACE "," ";" elements "${CMAKE_MATCH_1}")
+  list(LENGTH elements length)
+  if(NOT length EQUAL count)
+    return()
+  endif()
+  set(literals)
+  foreach(element IN LISTS elements)
+    float_literal("${element}" literal)
+    if("${literal}" STREQUAL "")
+      return()
+    endif()
+    list(APPEND literals "${literal}")
+  endforeach()
+  string(REPLACE ";" ", " literals "${literals}")
+  set(${out} "{${literals}}" PARENT_SCOPE)
+endfunction()
+
+file(STRINGS "${PRESETS_LIST}" presets)
+set(sources_text)
+set(tables_text)
+set(presets_text)
+foreach(preset IN LISTS presets)
+  if(NOT EXISTS "${preset}")
+    message(FATAL_ERROR "GenerateThemePresets: can't read ${preset}")
+  endif()
+  get_filename_component(stem "${preset}" NAME_WE)
+  string(MAKE_C_IDENTIFIER "${stem}" id)
+  set(name "${stem}")
+  set(colors)
+  set(floats)
+  set(vec2s)
+  set(bools)
+
+  set(section)
+  set(line_number 0)
+  file(STRINGS "${preset}" lines)
+  foreach(line IN LISTS lines)
+    math(EXPR line_number "${line_number} + 1")
+    string(STRIP "${line}" line)
+    if("${line}" STREQUAL "" OR line MATCHES "^#")
+      continue()
+    endif()
+    if(line MATCHES "^\\[([A-Za-z0-9_.]+)\\]$")
+      set(section "${CMAKE_MATCH_1}")
+      continue()
+    endif()
+    if(NOT line MATCHES "^([A-Za-z0-9_]+)[ \t]*=[ \t]*(.+)$")
+      message(FATAL_ERROR "${preset}:${line_number}: unsupported syntax")
+    endif()
+    set(key "${CMAKE_MATCH_1}")
+    set(value "${CMAKE_MATCH_2}")
+
+    if(section STREQUAL "theme")
+      if(key STREQUAL "name" AND value MATCHES "^\"([^\"]+)\"$")
+        set(name "${CMAKE_MATCH_1}")
+        continue()
+      endif()
+    elseif(section STREQUAL "theme.colors")
+      float_array("${value}" 4 color)
+      if(key MATCHES "^ImGuiCol_" AND NOT "${color}" STREQUAL "")
+        list(APPEND colors "{${key}, ${color}}")
+        continue()
+      endif()
+    elseif(section STREQUAL "theme.style")
+      if(value STREQUAL "true" OR value STREQUAL "false")
+        list(APPEND bools "{&ImGuiStyle::${key}, ${value}}")
+        continue()
+      endif()
+      float_literal("${value}" number)
+      if(NOT "${number}" STREQUAL "")
+        list(APPEND floats "{&ImGuiStyle::${key}, ${number}}")
+        continue()
+      endif()
+      float_array("${value}" 2 vec2)
+      if(NOT "${vec2}" STREQUAL "")
+        list(APPEND vec2s "{&ImGuiStyle::${key}, ${vec2}}")
+        continue()
+      endif()
+    endif()
+    message(FATAL_ERROR "${preset}:${line_number}: unexpected ${key} in "
+                        "[${section}]")
+  endforeach()
+
+  # One table per kind of values, the empty ones are left out as C++ has no
+  # zero-length arrays
+  set(fields)
+  foreach(kind IN ITEMS colors floats vec2s bools)
+    if("${${kind}}" STREQUAL "")
+      list(APPEND fields "{}")
+      continue()
+    endif()
+    if(kind STREQUAL "colors")
+      set(type "Color")
+    elseif(kind STREQUAL "floats")
+      set(type "Float")
+    elseif(kind STREQUAL "vec2s")
+      set(type "Vec2")
+    else()
+      set(type "Bool")
+    endif()
+    string(TOUPPER "${id}_${kind}" table)
+    string(REPLACE ";" ",\n    " entries "${${kind}}")
+    string(APPEND tables_text
+           "constexpr ThemePreset::${type} ${table}[] = {\n    ${entries}};\n")
+    list(APPEND fields "${table}")
+  endforeach()
+  string(REPLACE ";" ", " fields "${fields}")
+  list(APPEND presets_text "{\"${name}\", ${fields}}")
+  get_filename_component(source_name "${preset}" NAME)
+  list(APPEND sources_text "${source_name} (${name})")
+endforeach()
+
+list(LENGTH presets presets_count)
+if(presets_count EQUAL 0)
+  message(FATAL_ERROR "GenerateThemePresets: no theme preset")
+endif()
+string(REPLACE ";" ",\n    " presets_text "${presets_text}")
+string(REPLACE ";" "\n// " sources_text "${sources_text}")
+
+set(content
+    "// Generated by cmake/GenerateThemePresets.cmake, do not edit.
+
+#pragma once
+
+#include \"ui/style/theme_presets.h\"
+
+// Theme presets compiled from:
+// ${sources_text}
+
+namespace asap::ui {
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+${tables_text}
+constexpr ThemePreset THEME_PRESETS[] = {
+    ${presets_text}};
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+} // namespace
+} // namespace asap::ui
+")
+
+# Only touch the output when it changes, to avoid needless re-compilations
+if(EXISTS "${OUTPUT}")
+  file(READ "${OUTPUT}" previous)
+  if("${previous}" STREQUAL "${content}")
+    return()
+  endif()
+endif()
+file(WRITE "${OUTPUT}" "${content}")
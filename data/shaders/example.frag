@@ -0,0 +1,7 @@
+#version 150
+in vec3 color;
+out vec4 colorOut;
+void main()
+{
+    colorOut = vec4(color, 1.0);
+}
@@ -0,0 +1,81 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+// Renderer for the ImGui draw data, streaming the geometry through persistently
+// mapped buffers.
+//
+// The stock OpenGL3 backend re-specifies the vertex and index buffers with
+// glBufferData() for each draw list, which makes the driver copy the data and
+// can implicitly synchronize with the GPU. This renderer allocates its buffers
+// once with glBufferStorage() (GL 4.4 or ARB_buffer_storage) and keeps them
+// mapped. They are split in a ring of 3 segments, one per frame in flight, and
+// a fence prevents a segment from being written while the GPU still reads it.
+// The vertices and indices of all the draw lists are written in one pass,
+// then drawn without any buffer update. Consecutive draw commands using the
+// same texture and a compatible clipping rectangle, in the same or in following
+// draw lists, are merged in a single glMultiDrawElementsBaseVertex() call.
+//
+// The GL state is set through the state cache of glad/gl_state.h and, unlike
+// the stock backend, it is not saved and restored around each frame: code
+// rendering in the main context sets the state it needs through the cache.
+//
+// When the context supports timer queries, the GPU time of each frame is
+// measured too. The ImDrawList callbacks must not use GL_TIME_ELAPSED queries
+// then, as they can't be nested.
+//
+// When buffer storage is not available, the rendering falls back to
+// ImGui_ImplOpenGL3_RenderDrawData(). The stock backend must be initialized in
+// all cases: it creates the fonts texture and renders the secondary viewports.
+//
+// Usage:
+//  - call ImGui_ImplOpenGL3Stream_Init() after ImGui_ImplOpenGL3_Init() and
+//    asap::gl::ProbeCapabilities() (see glad/gl_capabilities.h),
+//  - render with ImGui_ImplOpenGL3Stream_RenderDrawData() instead of
+//    ImGui_ImplOpenGL3_RenderDrawData(),
+//  - call ImGui_ImplOpenGL3Stream_Shutdown() before
+//    ImGui_ImplOpenGL3_Shutdown().
+
+#pragma once
+
+#include <glad/gl.h>
+#include <imgui/imgui.h>
+
+#include <stddef.h>
+
+struct ImGui_ImplOpenGL3Stream_Stats {
+  /// Frames rendered through the mapped buffers.
+  unsigned int Frames;
+  /// Frames that had to wait for the GPU to release their segment.
+  unsigned int FenceWaits;
+  /// Number of times the buffers were re-allocated to fit a frame.
+  unsigned int Reallocations;
+  /// Size of one segment of the ring, vertices and indices.
+  size_t SegmentBytes;
+  /// Bytes of vertices and indices written for the last frame.
+  size_t LastFrameBytes;
+  /// Draw commands of the last frame, and the draw calls issued for them
+  /// once batched.
+  unsigned int DrawCommands;
+  unsigned int DrawCalls;
+  /// GPU time of the last frame measured, 0 without timer queries. The
+  /// result comes a few frames late, once the GPU is done with the frame.
+  double GpuSeconds;
+};
+
+/// Set up the renderer in the current GL context, loading the entry points
+/// that are not in the glad loader with `load`. Return false when the
+/// streaming path was not selected for the context (no buffer storage) and
+/// the stock backend is used instead.
+IMGUI_IMPL_API bool ImGui_ImplOpenGL3Stream_Init(
+    const char *glsl_version, GLADloadfunc load);
+IMGUI_IMPL_API void ImGui_ImplOpenGL3Stream_Shutdown();
+/// Whether the draw data is rendered through the mapped buffers.
+IMGUI_IMPL_API bool ImGui_ImplOpenGL3Stream_IsStreaming();
+IMGUI_IMPL_API void ImGui_ImplOpenGL3Stream_RenderDrawData(
+    ImDrawData *draw_data);
+IMGUI_IMPL_API ImGui_ImplOpenGL3Stream_Stats
+ImGui_ImplOpenGL3Stream_GetStats();
@@ -0,0 +1,65 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+// What the GL context offers beyond the GL 3.2 core profile of the glad
+// loader, and the rendering paths selected from it.
+//
+// The context is probed once, right after it is created and glad is loaded,
+// with ProbeCapabilities(). A feature is reported when the context version
+// includes it or when the driver exposes the matching extension. The code
+// with a faster path for a feature checks the selected paths rather than the
+// raw capabilities, which keeps the selection in one place.
+
+#pragma once
+
+#include <glad/gl.h>
+
+namespace asap {
+namespace gl {
+
+struct Capabilities {
+  int Major;
+  int Minor;
+  /// GL 4.4 or ARB_buffer_storage: persistently mapped buffers.
+  bool BufferStorage;
+  /// GL 4.5 or ARB_direct_state_access: edit objects without binding them.
+  bool DirectStateAccess;
+  /// GL 4.3 or ARB_multi_draw_indirect: draw parameters read from a buffer.
+  bool MultiDrawIndirect;
+  /// KHR_parallel_shader_compile or ARB_parallel_shader_compile.
+  bool ParallelShaderCompile;
+  /// GL 4.1 or ARB_get_program_binary: save and reload linked programs.
+  bool ProgramBinary;
+  /// GL 3.3 or ARB_timer_query: GPU time elapsed and timestamp queries.
+  bool TimerQuery;
+  /// GL 4.3 or KHR_debug: messages from the driver through a callback.
+  bool DebugOutput;
+};
+
+/// The rendering paths selected from the capabilities.
+struct FastPaths {
+  /// Stream the ImGui geometry through persistently mapped buffers, see
+  /// backends/imgui_impl_opengl3_stream.h.
+  bool StreamGeometry;
+  /// Let the driver compile the shaders with as many threads as it likes.
+  bool ParallelShaderCompile;
+  /// Measure the GPU time of the ImGui rendering with timer queries.
+  bool GpuTiming;
+};
+
+/// Probe the current context and select the paths, loading the entry points
+/// that are not in the glad loader with `load`. To be called after
+/// gladLoadGL(), each time a new context is made current.
+void ProbeCapabilities(GLADloadfunc load);
+
+/// The capabilities of the last probed context.
+auto GetCapabilities() -> const Capabilities &;
+/// The paths selected for the last probed context.
+auto GetFastPaths() -> const FastPaths &;
+
+} // namespace gl
+} // namespace asap
@@ -0,0 +1,73 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+// Shadow of the GL state of the main context, to skip redundant state changes.
+//
+// The functions below replace the glad entry points of the same name. They
+// remember the value last set and only call GL when it changes, which lets
+// each piece of code set the state it needs without querying and restoring
+// the previous state (glGet*() calls can stall the pipeline).
+//
+// The shadow is only valid as long as all the state changes in the main
+// context go through it. Code changing the state directly (the stock ImGui
+// backend, third party code, an ImDrawList callback) must be followed by a
+// call to asap::gl::InvalidateState(). The cache is not thread safe, all
+// calls are expected from the thread owning the context.
+//
+// Objects must be deleted with the functions below too: GL un-binds a deleted
+// object and may give its name to a new one, which would be seen as already
+// bound otherwise.
+
+#pragma once
+
+#include <glad/gl.h>
+
+namespace asap {
+namespace gl {
+
+struct StateCounters {
+  /// State changes passed to GL.
+  unsigned int Issued;
+  /// State changes skipped because the state already had the value.
+  unsigned int Elided;
+};
+
+/// Forget the shadowed state, the next changes are all passed to GL.
+void InvalidateState();
+
+/// Start counting the state changes of a new frame.
+void NewFrame();
+/// The state changes of the last complete frame.
+auto LastFrameCounters() -> StateCounters;
+
+void ActiveTexture(GLenum texture);
+/// Only GL_TEXTURE_2D bindings of the first texture units are shadowed.
+void BindTexture(GLenum target, GLuint texture);
+void BindFramebuffer(GLenum target, GLuint framebuffer);
+/// The element array binding is part of the vertex array state and is not
+/// shadowed.
+void BindBuffer(GLenum target, GLuint buffer);
+void BindVertexArray(GLuint array);
+void UseProgram(GLuint program);
+
+void Enable(GLenum capability);
+void Disable(GLenum capability);
+void BlendEquation(GLenum mode);
+void BlendFuncSeparate(
+    GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+void PolygonMode(GLenum face, GLenum mode);
+void Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void Scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+void DeleteTextures(GLsizei count, const GLuint *textures);
+void DeleteFramebuffers(GLsizei count, const GLuint *framebuffers);
+void DeleteBuffers(GLsizei count, const GLuint *buffers);
+void DeleteVertexArrays(GLsizei count, const GLuint *arrays);
+void DeleteProgram(GLuint program);
+
+} // namespace gl
+} // namespace asap
@@ -0,0 +1,75 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+// Per frame statistics of the GL calls, from an instrumented glad loader.
+//
+// With the ASAP_IMGUI_GL_TRACE CMake option, Install() replaces each entry
+// point loaded by glad with a wrapper counting and timing its calls, and the
+// size of the data uploaded by the buffer and texture image functions. The
+// wrappers are generated from glad/gl.h by cmake/GenerateGlTrace.cmake.
+//
+// Without the option, the functions below are empty inline functions and the
+// entry points are left untouched: the tracing costs nothing.
+//
+// The uploads are counted from the arguments of the calls, assuming tightly
+// packed pixels. Texture images specified without data are not counted.
+
+#pragma once
+
+#include <stddef.h>
+
+namespace asap {
+namespace gl {
+namespace trace {
+
+struct FunctionStats {
+  const char *Name;
+  unsigned int Calls;
+  /// Bytes of buffer or texture data uploaded.
+  size_t Bytes;
+  /// Time spent in the function, on the CPU side.
+  double Seconds;
+};
+
+struct FrameStats {
+  unsigned int Calls;
+  size_t Bytes;
+  double Seconds;
+  /// The statistics of all the traced functions, called or not.
+  const FunctionStats *Functions;
+  int FunctionCount;
+};
+
+#if defined(ASAP_IMGUI_GL_TRACE)
+
+const bool ENABLED = true;
+
+/// Wrap the entry points loaded by glad, to be called after gladLoadGL().
+void Install();
+/// Start counting the calls of a new frame.
+void NewFrame();
+/// The statistics of the last complete frame.
+auto LastFrame() -> FrameStats;
+
+#else
+
+const bool ENABLED = false;
+
+inline void Install() {
+}
+inline void NewFrame() {
+}
+inline auto LastFrame() -> FrameStats {
+  const FrameStats none = {0, 0, 0.0, nullptr, 0};
+  return none;
+}
+
+#endif
+
+} // namespace trace
+} // namespace gl
+} // namespace asap
@@ -0,0 +1,657 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include <backends/imgui_impl_opengl3_stream.h>
+
+#include <glad/gl_capabilities.h>
+#include <glad/gl_state.h>
+#include <imgui/backends/imgui_impl_opengl3.h>
+
+#include <stdint.h> // intptr_t
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+// glBufferStorage() is GL 4.4 (or ARB_buffer_storage) and is not in the GL 3.2
+// core glad loader.
+typedef void(GLAD_API_PTR *BufferStorageProc)(
+    GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+const GLbitfield MAP_PERSISTENT_BIT = 0x0040;
+const GLbitfield MAP_COHERENT_BIT = 0x0080;
+// GL 3.3 or ARB_timer_query
+const GLenum TIME_ELAPSED = 0x88BF;
+
+/// Frames in flight: the CPU writes one segment while the GPU may still read
+/// the two previous ones.
+const int SEGMENTS = 3;
+/// Initial capacity of a segment, enough for a busy UI without re-allocation.
+const int INITIAL_VERTICES = 64 * 1024;
+const int INITIAL_INDICES = 128 * 1024;
+/// How long to wait for the GPU in one go before checking again, in ns.
+const GLuint64 FENCE_WAIT_TIMEOUT = 100 * 1000 * 1000;
+
+struct Data {
+  BufferStorageProc BufferStorage;
+  char GlslVersion[32];
+
+  GLuint ShaderHandle;
+  GLint AttribLocationTex;
+  GLint AttribLocationProjMtx;
+  GLuint AttribLocationVtxPos;
+  GLuint AttribLocationVtxUV;
+  GLuint AttribLocationVtxColor;
+
+  GLuint Vao;
+  GLuint VboHandle;
+  GLuint ElementsHandle;
+  /// The mapped buffers, all the segments one after the other.
+  ImDrawVert *Vertices;
+  ImDrawIdx *Indices;
+  /// Capacity of one segment.
+  int VertexCapacity;
+  int IndexCapacity;
+
+  GLsync Fences[SEGMENTS];
+  int Segment;
+  /// GPU time of the frame rendered from each segment, when timer queries
+  /// are available. A query is pending until its result is read.
+  GLuint TimerQueries[SEGMENTS];
+  bool TimerPending[SEGMENTS];
+
+  /// The draws of the current batch, in the glMultiDrawElementsBaseVertex()
+  /// layout.
+  ImVector<GLsizei> Counts;
+  ImVector<void *> Offsets;
+  ImVector<GLint> BaseVertices;
+
+  ImGui_ImplOpenGL3Stream_Stats Stats;
+
+  Data() {
+    memset((void *)this, 0, sizeof(*this));
+  }
+};
+
+Data *g_Data = NULL;
+
+auto CheckShader(GLuint handle, const char *desc) -> bool {
+  GLint status = 0;
+  glGetShaderiv(handle, GL_COMPILE_STATUS, &status);
+  if (status == GL_FALSE) {
+    char log[512];
+    glGetShaderInfoLog(handle, sizeof(log), NULL, log);
+    fprintf(stderr,
+        "ImGui_ImplOpenGL3Stream: failed to compile %s with GLSL %s: %s\n",
+        desc, g_Data->GlslVersion, log);
+    return false;
+  }
+  return true;
+}
+
+auto CheckProgram(GLuint handle) -> bool {
+  GLint status = 0;
+  glGetProgramiv(handle, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE) {
+    char log[512];
+    glGetProgramInfoLog(handle, sizeof(log), NULL, log);
+    fprintf(stderr, "ImGui_ImplOpenGL3Stream: failed to link program: %s\n",
+        log);
+    return false;
+  }
+  return true;
+}
+
+auto CreateProgram() -> bool {
+  Data *bd = g_Data;
+  // Valid for GLSL 130 and above
+  const char *vertex_shader =
+      "uniform mat4 ProjMtx;\n"
+      "in vec2 Position;\n"
+      "in vec2 UV;\n"
+      "in vec4 Color;\n"
+      "out vec2 Frag_UV;\n"
+      "out vec4 Frag_Color;\n"
+      "void main()\n"
+      "{\n"
+      "    Frag_UV = UV;\n"
+      "    Frag_Color = Color;\n"
+      "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+      "}\n";
+  const char *fragment_shader =
+      "uniform sampler2D Texture;\n"
+      "in vec2 Frag_UV;\n"
+      "in vec4 Frag_Color;\n"
+      "out vec4 Out_Color;\n"
+      "void main()\n"
+      "{\n"
+      "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+      "}\n";
+
+  const GLchar *vertex_sources[2] = {bd->GlslVersion, vertex_shader};
+  const GLuint vertex_handle = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex_handle, 2, vertex_sources, NULL);
+  glCompileShader(vertex_handle);
+  const bool vertex_ok = CheckShader(vertex_handle, "vertex shader");
+
+  const GLchar *fragment_sources[2] = {bd->GlslVersion, fragment_shader};
+  const GLuint fragment_handle = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment_handle, 2, fragment_sources, NULL);
+  glCompileShader(fragment_handle);
+  const bool fragment_ok = CheckShader(fragment_handle, "fragment shader");
+
+  bd->ShaderHandle = glCreateProgram();
+  glAttachShader(bd->ShaderHandle, vertex_handle);
+  glAttachShader(bd->ShaderHandle, fragment_handle);
+  glLinkProgram(bd->ShaderHandle);
+  const bool program_ok = vertex_ok && fragment_ok &&
+                          CheckProgram(bd->ShaderHandle);
+  // The program keeps the compiled shaders
+  glDetachShader(bd->ShaderHandle, vertex_handle);
+  glDetachShader(bd->ShaderHandle, fragment_handle);
+  glDeleteShader(vertex_handle);
+  glDeleteShader(fragment_handle);
+  if (!program_ok) {
+    return false;
+  }
+
+  bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
+  bd->AttribLocationProjMtx =
+      glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+  bd->AttribLocationVtxPos = static_cast<GLuint>(
+      glGetAttribLocation(bd->ShaderHandle, "Position"));
+  bd->AttribLocationVtxUV =
+      static_cast<GLuint>(glGetAttribLocation(bd->ShaderHandle, "UV"));
+  bd->AttribLocationVtxColor =
+      static_cast<GLuint>(glGetAttribLocation(bd->ShaderHandle, "Color"));
+  return true;
+}
+
+void DestroyBuffers() {
+  Data *bd = g_Data;
+  for (int segment = 0; segment < SEGMENTS; ++segment) {
+    if (bd->Fences[segment] != NULL) {
+      glDeleteSync(bd->Fences[segment]);
+      bd->Fences[segment] = NULL;
+    }
+  }
+  // Deleting a mapped buffer unmaps it; the driver keeps the storage alive
+  // until the GPU is done with it.
+  if (bd->Vao != 0) {
+    asap::gl::DeleteVertexArrays(1, &bd->Vao);
+    bd->Vao = 0;
+  }
+  if (bd->VboHandle != 0) {
+    asap::gl::DeleteBuffers(1, &bd->VboHandle);
+    bd->VboHandle = 0;
+  }
+  if (bd->ElementsHandle != 0) {
+    asap::gl::DeleteBuffers(1, &bd->ElementsHandle);
+    bd->ElementsHandle = 0;
+  }
+  bd->Vertices = NULL;
+  bd->Indices = NULL;
+}
+
+/// Allocate and map the ring buffers, and the vertex array reading them.
+auto CreateBuffers(int vertex_capacity, int index_capacity) -> bool {
+  Data *bd = g_Data;
+  const GLbitfield flags =
+      GL_MAP_WRITE_BIT | MAP_PERSISTENT_BIT | MAP_COHERENT_BIT;
+  const GLsizeiptr vertex_bytes = static_cast<GLsizeiptr>(vertex_capacity) *
+                                  SEGMENTS * sizeof(ImDrawVert);
+  const GLsizeiptr index_bytes =
+      static_cast<GLsizeiptr>(index_capacity) * SEGMENTS * sizeof(ImDrawIdx);
+
+  glGenVertexArrays(1, &bd->Vao);
+  asap::gl::BindVertexArray(bd->Vao);
+
+  glGenBuffers(1, &bd->VboHandle);
+  asap::gl::BindBuffer(GL_ARRAY_BUFFER, bd->VboHandle);
+  bd->BufferStorage(GL_ARRAY_BUFFER, vertex_bytes, NULL, flags);
+  bd->Vertices = static_cast<ImDrawVert *>(
+      glMapBufferRange(GL_ARRAY_BUFFER, 0, vertex_bytes, flags));
+
+  // The element buffer binding is part of the vertex array state
+  glGenBuffers(1, &bd->ElementsHandle);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle);
+  bd->BufferStorage(GL_ELEMENT_ARRAY_BUFFER, index_bytes, NULL, flags);
+  bd->Indices = static_cast<ImDrawIdx *>(
+      glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, index_bytes, flags));
+
+  // The segments start on a vertex boundary, they are selected with the base
+  // vertex of the draw calls and the attributes are set once
+  glEnableVertexAttribArray(bd->AttribLocationVtxPos);
+  glEnableVertexAttribArray(bd->AttribLocationVtxUV);
+  glEnableVertexAttribArray(bd->AttribLocationVtxColor);
+  glVertexAttribPointer(bd->AttribLocationVtxPos, 2, GL_FLOAT, GL_FALSE,
+      sizeof(ImDrawVert),
+      reinterpret_cast<GLvoid *>(offsetof(ImDrawVert, pos)));
+  glVertexAttribPointer(bd->AttribLocationVtxUV, 2, GL_FLOAT, GL_FALSE,
+      sizeof(ImDrawVert), reinterpret_cast<GLvoid *>(offsetof(ImDrawVert, uv)));
+  glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE,
+      GL_TRUE, sizeof(ImDrawVert),
+      reinterpret_cast<GLvoid *>(offsetof(ImDrawVert, col)));
+
+  if (bd->Vertices == NULL || bd->Indices == NULL) {
+    fprintf(stderr, "ImGui_ImplOpenGL3Stream: failed to map the buffers\n");
+    DestroyBuffers();
+    return false;
+  }
+  bd->VertexCapacity = vertex_capacity;
+  bd->IndexCapacity = index_capacity;
+  bd->Segment = 0;
+  bd->Stats.SegmentBytes =
+      static_cast<size_t>(vertex_capacity) * sizeof(ImDrawVert) +
+      static_cast<size_t>(index_capacity) * sizeof(ImDrawIdx);
+  return true;
+}
+
+/// Wait until the GPU is done reading `segment`.
+void WaitForSegment(int segment) {
+  Data *bd = g_Data;
+  GLsync fence = bd->Fences[segment];
+  if (fence == NULL) {
+    return;
+  }
+  GLenum result = glClientWaitSync(fence, 0, 0);
+  if (result == GL_TIMEOUT_EXPIRED) {
+    ++bd->Stats.FenceWaits;
+    do {
+      result = glClientWaitSync(
+          fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_WAIT_TIMEOUT);
+    } while (result == GL_TIMEOUT_EXPIRED);
+  }
+  glDeleteSync(fence);
+  bd->Fences[segment] = NULL;
+}
+
+/// Collect the GPU time of the frame last rendered from `segment`. Its fence
+/// was waited for, the result is normally available without stalling.
+void ReadTimer(int segment) {
+  Data *bd = g_Data;
+  if (!bd->TimerPending[segment]) {
+    return;
+  }
+  GLuint available = 0;
+  glGetQueryObjectuiv(
+      bd->TimerQueries[segment], GL_QUERY_RESULT_AVAILABLE, &available);
+  if (available != 0) {
+    // 32 bits of nanoseconds are plenty for a frame
+    GLuint elapsed = 0;
+    glGetQueryObjectuiv(bd->TimerQueries[segment], GL_QUERY_RESULT, &elapsed);
+    bd->Stats.GpuSeconds = static_cast<double>(elapsed) * 1e-9;
+  }
+  bd->TimerPending[segment] = false;
+}
+
+void SetupRenderState(ImDrawData *draw_data, int fb_width, int fb_height) {
+  Data *bd = g_Data;
+  asap::gl::Enable(GL_BLEND);
+  asap::gl::BlendEquation(GL_FUNC_ADD);
+  asap::gl::BlendFuncSeparate(
+      GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  asap::gl::Disable(GL_CULL_FACE);
+  asap::gl::Disable(GL_DEPTH_TEST);
+  asap::gl::Disable(GL_STENCIL_TEST);
+  asap::gl::Enable(GL_SCISSOR_TEST);
+  asap::gl::Disable(GL_PRIMITIVE_RESTART);
+  asap::gl::PolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+  asap::gl::Viewport(0, 0, static_cast<GLsizei>(fb_width),
+      static_cast<GLsizei>(fb_height));
+  const float left = draw_data->DisplayPos.x;
+  const float right = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
+  const float top = draw_data->DisplayPos.y;
+  const float bottom = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
+  const float ortho_projection[4][4] = {
+      {2.0F / (right - left), 0.0F, 0.0F, 0.0F},
+      {0.0F, 2.0F / (top - bottom), 0.0F, 0.0F},
+      {0.0F, 0.0F, -1.0F, 0.0F},
+      {(right + left) / (left - right), (top + bottom) / (bottom - top), 0.0F,
+          1.0F},
+  };
+  asap::gl::UseProgram(bd->ShaderHandle);
+  glUniform1i(bd->AttribLocationTex, 0);
+  glUniformMatrix4fv(
+      bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+  asap::gl::ActiveTexture(GL_TEXTURE0);
+  asap::gl::BindVertexArray(bd->Vao);
+}
+
+/// Whether the scissor rectangle `outer` contains `inner`.
+auto Contains(const GLint *outer, const GLint *inner) -> bool {
+  return inner[0] >= outer[0] && inner[1] >= outer[1] &&
+         inner[0] + inner[2] <= outer[0] + outer[2] &&
+         inner[1] + inner[3] <= outer[1] + outer[3];
+}
+
+/// Whether all the vertices drawn by `pcmd` are within its framebuffer
+/// `scissor`, which then clips nothing: any larger scissor gives the same
+/// pixels.
+auto InsideScissor(const ImDrawList *cmd_list, const ImDrawCmd *pcmd,
+    const GLint *scissor, const ImVec2 &clip_off, const ImVec2 &clip_scale,
+    int fb_height) -> bool {
+  // The scissor back in display space, with y going down
+  const float left = static_cast<float>(scissor[0]) / clip_scale.x + clip_off.x;
+  const float right =
+      static_cast<float>(scissor[0] + scissor[2]) / clip_scale.x + clip_off.x;
+  const float top =
+      static_cast<float>(fb_height - scissor[1] - scissor[3]) / clip_scale.y +
+      clip_off.y;
+  const float bottom =
+      static_cast<float>(fb_height - scissor[1]) / clip_scale.y + clip_off.y;
+  const ImDrawVert *vertices = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+  const ImDrawIdx *indices = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+  for (unsigned int i = 0; i < pcmd->ElemCount; i++) {
+    const ImVec2 &pos = vertices[indices[i]].pos;
+    if (pos.x < left || pos.x > right || pos.y < top || pos.y > bottom) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Consecutive draw commands using the same texture and compatible clipping,
+/// across draw lists. They are submitted with a single multi-draw call, each
+/// draw selecting its list in the segment with its base vertex.
+///
+/// Commands with different clip rectangles share the scissor of the batch when
+/// it gives the same pixels: either the command's geometry is within its own
+/// clip rectangle, which the batch scissor contains, or the command relies on
+/// its scissor to clip and all the other draws of the batch fit in it. This
+/// is the common case of the widgets of a window, or of non-overlapping
+/// windows, which ImGui clips with rectangles that differ but rarely cut
+/// anything.
+struct Batch {
+  GLint Scissor[4];
+  GLuint Texture;
+  /// A draw of the batch relies on the scissor to clip its geometry, so the
+  /// scissor can't grow.
+  bool Clipping;
+
+  Batch() {
+    memset((void *)this, 0, sizeof(*this));
+  }
+
+  /// Add `command` to the batch if drawing it with the batch scissor gives
+  /// the same pixels. `inside` tells whether the geometry of the command is
+  /// within its own scissor, it is only called when needed as it reads the
+  /// vertices.
+  template <typename Inside>
+  auto Merge(const Batch &command, Inside &inside) -> bool {
+    if (command.Texture != Texture) {
+      return false;
+    }
+    if (memcmp(command.Scissor, Scissor, sizeof(Scissor)) == 0) {
+      // The scissor can't grow anymore if the command relies on it
+      Clipping = Clipping || !inside();
+      return true;
+    }
+    if (!inside()) {
+      if (Clipping || !Contains(command.Scissor, Scissor)) {
+        return false;
+      }
+      memcpy(Scissor, command.Scissor, sizeof(Scissor));
+      Clipping = true;
+      return true;
+    }
+    if (Contains(Scissor, command.Scissor)) {
+      return true;
+    }
+    if (Clipping) {
+      return false;
+    }
+    // Grow the scissor to the bounding rectangle of both
+    GLint bounds[4];
+    for (int axis = 0; axis < 2; axis++) {
+      const GLint end = Scissor[axis] + Scissor[axis + 2];
+      const GLint command_end =
+          command.Scissor[axis] + command.Scissor[axis + 2];
+      bounds[axis] = command.Scissor[axis] < Scissor[axis]
+                         ? command.Scissor[axis]
+                         : Scissor[axis];
+      bounds[axis + 2] = (command_end > end ? command_end : end) - bounds[axis];
+    }
+    memcpy(Scissor, bounds, sizeof(Scissor));
+    return true;
+  }
+};
+
+/// Draw the commands collected for `batch`, if any.
+void SubmitBatch(const Batch &batch) {
+  Data *bd = g_Data;
+  const GLsizei draws = static_cast<GLsizei>(bd->Counts.Size);
+  if (draws == 0) {
+    return;
+  }
+  const GLenum index_type =
+      sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+  asap::gl::Scissor(batch.Scissor[0], batch.Scissor[1], batch.Scissor[2],
+      batch.Scissor[3]);
+  asap::gl::BindTexture(GL_TEXTURE_2D, batch.Texture);
+  if (draws == 1) {
+    glDrawElementsBaseVertex(GL_TRIANGLES, bd->Counts[0], index_type,
+        bd->Offsets[0], bd->BaseVertices[0]);
+  } else {
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, bd->Counts.Data, index_type,
+        bd->Offsets.Data, draws, bd->BaseVertices.Data);
+  }
+  ++bd->Stats.DrawCalls;
+  bd->Counts.resize(0);
+  bd->Offsets.resize(0);
+  bd->BaseVertices.resize(0);
+}
+
+} // namespace
+
+bool ImGui_ImplOpenGL3Stream_Init(const char *glsl_version, GLADloadfunc load) {
+  IM_ASSERT(g_Data == NULL && "Already initialized a renderer backend!");
+  if (glsl_version == NULL) {
+    glsl_version = "#version 130";
+  }
+
+  const asap::gl::FastPaths &paths = asap::gl::GetFastPaths();
+  BufferStorageProc buffer_storage = NULL;
+  if (paths.StreamGeometry) {
+    buffer_storage = reinterpret_cast<BufferStorageProc>(
+        load("glBufferStorage"));
+  }
+  if (buffer_storage == NULL) {
+    return false;
+  }
+
+  g_Data = IM_NEW(Data)();
+  Data *bd = g_Data;
+  bd->BufferStorage = buffer_storage;
+  IM_ASSERT(strlen(glsl_version) + 2 <= sizeof(bd->GlslVersion));
+  snprintf(bd->GlslVersion, sizeof(bd->GlslVersion), "%s\n", glsl_version);
+
+  if (!CreateProgram() || !CreateBuffers(INITIAL_VERTICES, INITIAL_INDICES)) {
+    ImGui_ImplOpenGL3Stream_Shutdown();
+    return false;
+  }
+  if (paths.GpuTiming) {
+    glGenQueries(SEGMENTS, bd->TimerQueries);
+  }
+  return true;
+}
+
+void ImGui_ImplOpenGL3Stream_Shutdown() {
+  Data *bd = g_Data;
+  if (bd == NULL) {
+    return;
+  }
+  DestroyBuffers();
+  if (bd->TimerQueries[0] != 0) {
+    glDeleteQueries(SEGMENTS, bd->TimerQueries);
+  }
+  if (bd->ShaderHandle != 0) {
+    asap::gl::DeleteProgram(bd->ShaderHandle);
+  }
+  IM_DELETE(bd);
+  g_Data = NULL;
+}
+
+bool ImGui_ImplOpenGL3Stream_IsStreaming() {
+  return g_Data != NULL;
+}
+
+ImGui_ImplOpenGL3Stream_Stats ImGui_ImplOpenGL3Stream_GetStats() {
+  if (g_Data == NULL) {
+    ImGui_ImplOpenGL3Stream_Stats none;
+    memset(&none, 0, sizeof(none));
+    return none;
+  }
+  return g_Data->Stats;
+}
+
+void ImGui_ImplOpenGL3Stream_RenderDrawData(ImDrawData *draw_data) {
+  Data *bd = g_Data;
+  if (bd == NULL) {
+    ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    asap::gl::InvalidateState();
+    return;
+  }
+
+  // Avoid rendering when minimized, scale coordinates for retina displays
+  // (screen coordinates != framebuffer coordinates)
+  const int fb_width = static_cast<int>(
+      draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+  const int fb_height = static_cast<int>(
+      draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+  if (fb_width <= 0 || fb_height <= 0 || draw_data->TotalVtxCount == 0) {
+    return;
+  }
+
+  // Grow the segments to fit the frame, the old buffers are released by the
+  // driver when the GPU is done with them
+  if (draw_data->TotalVtxCount > bd->VertexCapacity ||
+      draw_data->TotalIdxCount > bd->IndexCapacity) {
+    int vertex_capacity = bd->VertexCapacity;
+    int index_capacity = bd->IndexCapacity;
+    while (vertex_capacity < draw_data->TotalVtxCount) {
+      vertex_capacity *= 2;
+    }
+    while (index_capacity < draw_data->TotalIdxCount) {
+      index_capacity *= 2;
+    }
+    DestroyBuffers();
+    if (!CreateBuffers(vertex_capacity, index_capacity)) {
+      // Out of memory, give up on the mapped buffers
+      ImGui_ImplOpenGL3Stream_Shutdown();
+      ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+      asap::gl::InvalidateState();
+      return;
+    }
+    ++bd->Stats.Reallocations;
+  }
+
+  const int segment = bd->Segment;
+  WaitForSegment(segment);
+  const GLuint timer = bd->TimerQueries[segment];
+  if (timer != 0) {
+    ReadTimer(segment);
+    glBeginQuery(TIME_ELAPSED, timer);
+  }
+
+  // Write the geometry of all the draw lists at once
+  const int first_vertex = segment * bd->VertexCapacity;
+  const int first_index = segment * bd->IndexCapacity;
+  ImDrawVert *vtx_dst = bd->Vertices + first_vertex;
+  ImDrawIdx *idx_dst = bd->Indices + first_index;
+  for (int n = 0; n < draw_data->CmdListsCount; n++) {
+    const ImDrawList *cmd_list = draw_data->CmdLists[n];
+    memcpy(vtx_dst, cmd_list->VtxBuffer.Data,
+        static_cast<size_t>(cmd_list->VtxBuffer.Size) * sizeof(ImDrawVert));
+    memcpy(idx_dst, cmd_list->IdxBuffer.Data,
+        static_cast<size_t>(cmd_list->IdxBuffer.Size) * sizeof(ImDrawIdx));
+    vtx_dst += cmd_list->VtxBuffer.Size;
+    idx_dst += cmd_list->IdxBuffer.Size;
+  }
+  bd->Stats.LastFrameBytes =
+      static_cast<size_t>(draw_data->TotalVtxCount) * sizeof(ImDrawVert) +
+      static_cast<size_t>(draw_data->TotalIdxCount) * sizeof(ImDrawIdx);
+
+  SetupRenderState(draw_data, fb_width, fb_height);
+  bd->Stats.DrawCommands = 0;
+  bd->Stats.DrawCalls = 0;
+
+  // Project scissor/clipping rectangles into framebuffer space
+  const ImVec2 clip_off = draw_data->DisplayPos;
+  const ImVec2 clip_scale = draw_data->FramebufferScale;
+
+  Batch batch;
+  int list_first_vertex = first_vertex;
+  int list_first_index = first_index;
+  for (int n = 0; n < draw_data->CmdListsCount; n++) {
+    const ImDrawList *cmd_list = draw_data->CmdLists[n];
+    for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++) {
+      const ImDrawCmd *pcmd = &cmd_list->CmdBuffer[cmd_i];
+      if (pcmd->UserCallback != NULL) {
+        // User callback, registered via ImDrawList::AddCallback(). The
+        // commands before it are drawn first.
+        SubmitBatch(batch);
+        if (pcmd->UserCallback != ImDrawCallback_ResetRenderState) {
+          pcmd->UserCallback(cmd_list, pcmd);
+          // The callback may have changed the state behind the cache
+          asap::gl::InvalidateState();
+        }
+        SetupRenderState(draw_data, fb_width, fb_height);
+        continue;
+      }
+      const ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x,
+          (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+      const ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x,
+          (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+      if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y) {
+        continue;
+      }
+      ++bd->Stats.DrawCommands;
+      // Scissor rectangles are in framebuffer space, with y going up
+      Batch command;
+      command.Scissor[0] = static_cast<GLint>(clip_min.x);
+      command.Scissor[1] =
+          static_cast<GLint>(static_cast<float>(fb_height) - clip_max.y);
+      command.Scissor[2] = static_cast<GLsizei>(clip_max.x - clip_min.x);
+      command.Scissor[3] = static_cast<GLsizei>(clip_max.y - clip_min.y);
+      command.Texture =
+          static_cast<GLuint>(reinterpret_cast<intptr_t>(pcmd->TextureId));
+      int inside = -1;
+      auto is_inside = [&]() -> bool {
+        if (inside < 0) {
+          inside = InsideScissor(cmd_list, pcmd, command.Scissor, clip_off,
+                       clip_scale, fb_height)
+                       ? 1
+                       : 0;
+        }
+        return inside == 1;
+      };
+      if (bd->Counts.Size == 0 || !batch.Merge(command, is_inside)) {
+        SubmitBatch(batch);
+        batch = command;
+        batch.Clipping = !is_inside();
+      }
+      bd->Counts.push_back(static_cast<GLsizei>(pcmd->ElemCount));
+      bd->Offsets.push_back(reinterpret_cast<void *>(static_cast<intptr_t>(
+          (list_first_index + pcmd->IdxOffset) * sizeof(ImDrawIdx))));
+      bd->BaseVertices.push_back(
+          static_cast<GLint>(list_first_vertex + pcmd->VtxOffset));
+    }
+    list_first_vertex += cmd_list->VtxBuffer.Size;
+    list_first_index += cmd_list->IdxBuffer.Size;
+  }
+  SubmitBatch(batch);
+  if (timer != 0) {
+    glEndQuery(TIME_ELAPSED);
+    bd->TimerPending[segment] = true;
+  }
+
+  // The segment can be written again once the GPU executed these draws
+  bd->Fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  bd->Segment = (segment + 1) % SEGMENTS;
+  ++bd->Stats.Frames;
+}
@@ -0,0 +1,99 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include <glad/gl_capabilities.h>
+
+#include <string.h>
+
+namespace asap {
+namespace gl {
+
+namespace {
+
+// glMaxShaderCompilerThreadsKHR() is not in the GL 3.2 core glad loader. The
+// ARB entry point has the same signature and semantics.
+typedef void(GLAD_API_PTR *MaxShaderCompilerThreadsProc)(GLuint count);
+/// Let the implementation pick the number of compiler threads.
+const GLuint ANY_COMPILER_THREADS = 0xFFFFFFFF;
+
+Capabilities g_capabilities = Capabilities();
+FastPaths g_paths = FastPaths();
+
+auto HasVersion(int major, int minor) -> bool {
+  return g_capabilities.Major > major ||
+         (g_capabilities.Major == major && g_capabilities.Minor >= minor);
+}
+
+auto HasExtension(const char *name) -> bool {
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint index = 0; index < count; ++index) {
+    const char *extension = reinterpret_cast<const char *>(
+        glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(index)));
+    if (extension != NULL && strcmp(extension, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+auto LoadMaxShaderCompilerThreads(GLADloadfunc load)
+    -> MaxShaderCompilerThreadsProc {
+  GLADapiproc proc = NULL;
+  if (HasExtension("GL_KHR_parallel_shader_compile")) {
+    proc = load("glMaxShaderCompilerThreadsKHR");
+  } else if (HasExtension("GL_ARB_parallel_shader_compile")) {
+    proc = load("glMaxShaderCompilerThreadsARB");
+  }
+  return reinterpret_cast<MaxShaderCompilerThreadsProc>(proc);
+}
+
+} // namespace
+
+void ProbeCapabilities(GLADloadfunc load) {
+  Capabilities &caps = g_capabilities;
+  caps = Capabilities();
+  glGetIntegerv(GL_MAJOR_VERSION, &caps.Major);
+  glGetIntegerv(GL_MINOR_VERSION, &caps.Minor);
+
+  caps.BufferStorage =
+      HasVersion(4, 4) || HasExtension("GL_ARB_buffer_storage");
+  caps.DirectStateAccess =
+      HasVersion(4, 5) || HasExtension("GL_ARB_direct_state_access");
+  caps.MultiDrawIndirect =
+      HasVersion(4, 3) || HasExtension("GL_ARB_multi_draw_indirect");
+  caps.ProgramBinary =
+      HasVersion(4, 1) || HasExtension("GL_ARB_get_program_binary");
+  caps.TimerQuery = HasVersion(3, 3) || HasExtension("GL_ARB_timer_query");
+  caps.DebugOutput = HasVersion(4, 3) || HasExtension("GL_KHR_debug");
+
+  // Part of the context state, set once here for all the shaders
+  const MaxShaderCompilerThreadsProc max_compiler_threads =
+      LoadMaxShaderCompilerThreads(load);
+  caps.ParallelShaderCompile = max_compiler_threads != NULL;
+
+  FastPaths &paths = g_paths;
+  // The renderer also needs the GL 3.2 base vertex draws
+  paths.StreamGeometry = caps.BufferStorage && GLAD_GL_VERSION_3_2 != 0;
+  paths.ParallelShaderCompile = caps.ParallelShaderCompile;
+  paths.GpuTiming = caps.TimerQuery;
+
+  if (paths.ParallelShaderCompile) {
+    max_compiler_threads(ANY_COMPILER_THREADS);
+  }
+}
+
+auto GetCapabilities() -> const Capabilities & {
+  return g_capabilities;
+}
+
+auto GetFastPaths() -> const FastPaths & {
+  return g_paths;
+}
+
+} // namespace gl
+} // namespace asap
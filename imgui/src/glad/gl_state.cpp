@@ -0,0 +1,351 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include <glad/gl_state.h>
+
+namespace asap {
+namespace gl {
+
+namespace {
+
+/// Value of a binding or enum not known to the shadow.
+const GLuint UNKNOWN = ~0U;
+/// Texture units with shadowed bindings.
+const GLuint TEXTURE_UNITS = 8;
+
+/// Capabilities shadowed by Enable()/Disable(), the others are passed through.
+const GLenum CAPABILITIES[] = {GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST,
+    GL_STENCIL_TEST, GL_SCISSOR_TEST, GL_PRIMITIVE_RESTART};
+const int CAPABILITY_COUNT =
+    static_cast<int>(sizeof(CAPABILITIES) / sizeof(CAPABILITIES[0]));
+
+enum class Capability : signed char { Unknown = -1, Disabled, Enabled };
+
+struct Rect {
+  GLint x;
+  GLint y;
+  GLsizei width;
+  GLsizei height;
+  bool known;
+
+  auto Set(GLint new_x, GLint new_y, GLsizei new_width, GLsizei new_height)
+      -> bool {
+    if (known && x == new_x && y == new_y && width == new_width &&
+        height == new_height) {
+      return false;
+    }
+    x = new_x;
+    y = new_y;
+    width = new_width;
+    height = new_height;
+    known = true;
+    return true;
+  }
+};
+
+struct State {
+  GLuint active_texture;
+  GLuint textures[TEXTURE_UNITS];
+  GLuint draw_framebuffer;
+  GLuint read_framebuffer;
+  GLuint array_buffer;
+  GLuint pixel_pack_buffer;
+  GLuint pixel_unpack_buffer;
+  GLuint vertex_array;
+  GLuint program;
+  Capability capabilities[CAPABILITY_COUNT];
+  GLenum blend_equation;
+  GLenum blend_func[4];
+  GLenum polygon_mode;
+  Rect viewport;
+  Rect scissor;
+
+  StateCounters frame;
+  StateCounters last_frame;
+
+  State() : frame(), last_frame() {
+    Invalidate();
+  }
+
+  void Invalidate() {
+    active_texture = UNKNOWN;
+    for (GLuint unit = 0; unit < TEXTURE_UNITS; ++unit) {
+      textures[unit] = UNKNOWN;
+    }
+    draw_framebuffer = UNKNOWN;
+    read_framebuffer = UNKNOWN;
+    array_buffer = UNKNOWN;
+    pixel_pack_buffer = UNKNOWN;
+    pixel_unpack_buffer = UNKNOWN;
+    vertex_array = UNKNOWN;
+    program = UNKNOWN;
+    for (int index = 0; index < CAPABILITY_COUNT; ++index) {
+      capabilities[index] = Capability::Unknown;
+    }
+    blend_equation = UNKNOWN;
+    for (int index = 0; index < 4; ++index) {
+      blend_func[index] = UNKNOWN;
+    }
+    polygon_mode = UNKNOWN;
+    viewport.known = false;
+    scissor.known = false;
+  }
+
+  /// Record a state change, return whether it must be passed to GL.
+  auto Change(bool changed) -> bool {
+    if (changed) {
+      ++frame.Issued;
+    } else {
+      ++frame.Elided;
+    }
+    return changed;
+  }
+
+  /// Update a shadowed value, return whether it must be passed to GL.
+  auto Change(GLuint &shadow, GLuint value) -> bool {
+    const bool changed = shadow != value;
+    shadow = value;
+    return Change(changed);
+  }
+
+  /// The shadowed binding of `texture` on the active unit, if any.
+  auto TextureBinding(GLenum target) -> GLuint * {
+    if (target != GL_TEXTURE_2D || active_texture == UNKNOWN) {
+      return nullptr;
+    }
+    const GLuint unit = active_texture - GL_TEXTURE0;
+    return unit < TEXTURE_UNITS ? &textures[unit] : nullptr;
+  }
+
+  auto BufferBinding(GLenum target) -> GLuint * {
+    switch (target) {
+    case GL_ARRAY_BUFFER:
+      return &array_buffer;
+    case GL_PIXEL_PACK_BUFFER:
+      return &pixel_pack_buffer;
+    case GL_PIXEL_UNPACK_BUFFER:
+      return &pixel_unpack_buffer;
+    default:
+      return nullptr;
+    }
+  }
+
+  auto CapabilityState(GLenum capability) -> Capability * {
+    for (int index = 0; index < CAPABILITY_COUNT; ++index) {
+      if (CAPABILITIES[index] == capability) {
+        return &capabilities[index];
+      }
+    }
+    return nullptr;
+  }
+
+  void SetCapability(GLenum capability, Capability value) {
+    Capability *shadow = CapabilityState(capability);
+    if (shadow != nullptr) {
+      const bool changed = *shadow != value;
+      *shadow = value;
+      if (!Change(changed)) {
+        return;
+      }
+    } else {
+      ++frame.Issued;
+    }
+    if (value == Capability::Enabled) {
+      glEnable(capability);
+    } else {
+      glDisable(capability);
+    }
+  }
+
+  /// GL reverts the bindings of deleted objects to 0.
+  static void Forget(GLuint &binding, GLsizei count, const GLuint *names) {
+    for (GLsizei index = 0; index < count; ++index) {
+      if (binding == names[index]) {
+        binding = 0;
+      }
+    }
+  }
+};
+
+auto TheState() -> State & {
+  static State state;
+  return state;
+}
+
+} // namespace
+
+void InvalidateState() {
+  TheState().Invalidate();
+}
+
+void NewFrame() {
+  State &state = TheState();
+  state.last_frame = state.frame;
+  state.frame = StateCounters();
+}
+
+auto LastFrameCounters() -> StateCounters {
+  return TheState().last_frame;
+}
+
+void ActiveTexture(GLenum texture) {
+  State &state = TheState();
+  if (state.Change(state.active_texture, texture)) {
+    glActiveTexture(texture);
+  }
+}
+
+void BindTexture(GLenum target, GLuint texture) {
+  State &state = TheState();
+  GLuint *shadow = state.TextureBinding(target);
+  if (shadow == nullptr) {
+    if (target == GL_TEXTURE_2D && state.active_texture == UNKNOWN) {
+      // Bound on a unit we don't know of
+      for (GLuint unit = 0; unit < TEXTURE_UNITS; ++unit) {
+        state.textures[unit] = UNKNOWN;
+      }
+    }
+    ++state.frame.Issued;
+    glBindTexture(target, texture);
+  } else if (state.Change(*shadow, texture)) {
+    glBindTexture(target, texture);
+  }
+}
+
+void BindFramebuffer(GLenum target, GLuint framebuffer) {
+  State &state = TheState();
+  bool changed = false;
+  if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER) {
+    changed = changed || state.draw_framebuffer != framebuffer;
+    state.draw_framebuffer = framebuffer;
+  }
+  if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER) {
+    changed = changed || state.read_framebuffer != framebuffer;
+    state.read_framebuffer = framebuffer;
+  }
+  if (state.Change(changed)) {
+    glBindFramebuffer(target, framebuffer);
+  }
+}
+
+void BindBuffer(GLenum target, GLuint buffer) {
+  State &state = TheState();
+  GLuint *shadow = state.BufferBinding(target);
+  if (shadow == nullptr) {
+    ++state.frame.Issued;
+    glBindBuffer(target, buffer);
+  } else if (state.Change(*shadow, buffer)) {
+    glBindBuffer(target, buffer);
+  }
+}
+
+void BindVertexArray(GLuint array) {
+  State &state = TheState();
+  if (state.Change(state.vertex_array, array)) {
+    glBindVertexArray(array);
+  }
+}
+
+void UseProgram(GLuint program) {
+  State &state = TheState();
+  if (state.Change(state.program, program)) {
+    glUseProgram(program);
+  }
+}
+
+void Enable(GLenum capability) {
+  TheState().SetCapability(capability, Capability::Enabled);
+}
+
+void Disable(GLenum capability) {
+  TheState().SetCapability(capability, Capability::Disabled);
+}
+
+void BlendEquation(GLenum mode) {
+  State &state = TheState();
+  if (state.Change(state.blend_equation, mode)) {
+    glBlendEquation(mode);
+  }
+}
+
+void BlendFuncSeparate(
+    GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha) {
+  State &state = TheState();
+  const GLenum func[4] = {src_rgb, dst_rgb, src_alpha, dst_alpha};
+  bool changed = false;
+  for (int index = 0; index < 4; ++index) {
+    changed = changed || state.blend_func[index] != func[index];
+    state.blend_func[index] = func[index];
+  }
+  if (state.Change(changed)) {
+    glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+  }
+}
+
+void PolygonMode(GLenum face, GLenum mode) {
+  State &state = TheState();
+  // The core profile only has GL_FRONT_AND_BACK
+  if (face != GL_FRONT_AND_BACK) {
+    state.polygon_mode = UNKNOWN;
+    ++state.frame.Issued;
+    glPolygonMode(face, mode);
+  } else if (state.Change(state.polygon_mode, mode)) {
+    glPolygonMode(face, mode);
+  }
+}
+
+void Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  State &state = TheState();
+  if (state.Change(state.viewport.Set(x, y, width, height))) {
+    glViewport(x, y, width, height);
+  }
+}
+
+void Scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+  State &state = TheState();
+  if (state.Change(state.scissor.Set(x, y, width, height))) {
+    glScissor(x, y, width, height);
+  }
+}
+
+void DeleteTextures(GLsizei count, const GLuint *textures) {
+  State &state = TheState();
+  for (GLuint unit = 0; unit < TEXTURE_UNITS; ++unit) {
+    State::Forget(state.textures[unit], count, textures);
+  }
+  glDeleteTextures(count, textures);
+}
+
+void DeleteFramebuffers(GLsizei count, const GLuint *framebuffers) {
+  State &state = TheState();
+  State::Forget(state.draw_framebuffer, count, framebuffers);
+  State::Forget(state.read_framebuffer, count, framebuffers);
+  glDeleteFramebuffers(count, framebuffers);
+}
+
+void DeleteBuffers(GLsizei count, const GLuint *buffers) {
+  State &state = TheState();
+  State::Forget(state.array_buffer, count, buffers);
+  State::Forget(state.pixel_pack_buffer, count, buffers);
+  State::Forget(state.pixel_unpack_buffer, count, buffers);
+  glDeleteBuffers(count, buffers);
+}
+
+void DeleteVertexArrays(GLsizei count, const GLuint *arrays) {
+  State &state = TheState();
+  State::Forget(state.vertex_array, count, arrays);
+  glDeleteVertexArrays(count, arrays);
+}
+
+void DeleteProgram(GLuint program) {
+  // A program in use is only flagged for deletion, its name stays valid
+  // until it is no longer used.
+  glDeleteProgram(program);
+}
+
+} // namespace gl
+} // namespace asap
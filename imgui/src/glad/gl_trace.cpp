@@ -0,0 +1,219 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+// Only built with the ASAP_IMGUI_GL_TRACE CMake option.
+
+#include <glad/gl.h>
+#include <glad/gl_trace.h>
+
+#include <chrono>
+
+namespace asap {
+namespace gl {
+namespace trace {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Bytes of a pixel of `format` and `type`.
+auto PixelSize(GLenum format, GLenum type) -> size_t {
+  switch (type) {
+  case GL_UNSIGNED_BYTE_3_3_2:
+  case GL_UNSIGNED_BYTE_2_3_3_REV:
+    return 1;
+  case GL_UNSIGNED_SHORT_5_6_5:
+  case GL_UNSIGNED_SHORT_5_6_5_REV:
+  case GL_UNSIGNED_SHORT_4_4_4_4:
+  case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+  case GL_UNSIGNED_SHORT_5_5_5_1:
+  case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+    return 2;
+  case GL_UNSIGNED_INT_8_8_8_8:
+  case GL_UNSIGNED_INT_8_8_8_8_REV:
+  case GL_UNSIGNED_INT_10_10_10_2:
+  case GL_UNSIGNED_INT_2_10_10_10_REV:
+  case GL_UNSIGNED_INT_24_8:
+  case GL_UNSIGNED_INT_10F_11F_11F_REV:
+  case GL_UNSIGNED_INT_5_9_9_9_REV:
+    return 4;
+  case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+    return 8;
+  default:
+    break;
+  }
+
+  size_t component_size = 1;
+  switch (type) {
+  case GL_SHORT:
+  case GL_UNSIGNED_SHORT:
+  case GL_HALF_FLOAT:
+    component_size = 2;
+    break;
+  case GL_INT:
+  case GL_UNSIGNED_INT:
+  case GL_FLOAT:
+    component_size = 4;
+    break;
+  default:
+    break;
+  }
+  size_t components = 1;
+  switch (format) {
+  case GL_RG:
+  case GL_RG_INTEGER:
+    components = 2;
+    break;
+  case GL_RGB:
+  case GL_BGR:
+  case GL_RGB_INTEGER:
+  case GL_BGR_INTEGER:
+    components = 3;
+    break;
+  case GL_RGBA:
+  case GL_BGRA:
+  case GL_RGBA_INTEGER:
+  case GL_BGRA_INTEGER:
+    components = 4;
+    break;
+  default:
+    break;
+  }
+  return components * component_size;
+}
+
+auto ImageSize(GLsizei width, GLsizei height, GLsizei depth, GLenum format,
+    GLenum type) -> size_t {
+  if (width <= 0 || height <= 0 || depth <= 0) {
+    return 0;
+  }
+  return static_cast<size_t>(width) * static_cast<size_t>(height) *
+         static_cast<size_t>(depth) * PixelSize(format, type);
+}
+
+auto Uploaded_glBufferData(GLenum /*target*/, GLsizeiptr size,
+    const void *data, GLenum /*usage*/) -> size_t {
+  return data != nullptr ? static_cast<size_t>(size) : 0;
+}
+
+auto Uploaded_glBufferSubData(GLenum /*target*/, GLintptr /*offset*/,
+    GLsizeiptr size, const void * /*data*/) -> size_t {
+  return static_cast<size_t>(size);
+}
+
+auto Uploaded_glTexImage2D(GLenum /*target*/, GLint /*level*/,
+    GLint /*internalformat*/, GLsizei width, GLsizei height, GLint /*border*/,
+    GLenum format, GLenum type, const void *pixels) -> size_t {
+  return pixels != nullptr ? ImageSize(width, height, 1, format, type) : 0;
+}
+
+auto Uploaded_glTexSubImage2D(GLenum /*target*/, GLint /*level*/,
+    GLint /*xoffset*/, GLint /*yoffset*/, GLsizei width, GLsizei height,
+    GLenum format, GLenum type, const void * /*pixels*/) -> size_t {
+  return ImageSize(width, height, 1, format, type);
+}
+
+auto Uploaded_glTexImage3D(GLenum /*target*/, GLint /*level*/,
+    GLint /*internalformat*/, GLsizei width, GLsizei height, GLsizei depth,
+    GLint /*border*/, GLenum format, GLenum type, const void *pixels)
+    -> size_t {
+  return pixels != nullptr ? ImageSize(width, height, depth, format, type) : 0;
+}
+
+auto Uploaded_glTexSubImage3D(GLenum /*target*/, GLint /*level*/,
+    GLint /*xoffset*/, GLint /*yoffset*/, GLint /*zoffset*/, GLsizei width,
+    GLsizei height, GLsizei depth, GLenum format, GLenum type,
+    const void * /*pixels*/) -> size_t {
+  return ImageSize(width, height, depth, format, type);
+}
+
+struct Stats;
+auto TheStats() -> Stats &;
+
+/// Times one call of a traced function, and records it when done.
+class Call {
+public:
+  explicit Call(int function) : function_(function), start_(Clock::now()) {
+  }
+  Call(const Call &) = delete;
+  auto operator=(const Call &) -> Call & = delete;
+  ~Call();
+
+  void Uploaded(size_t bytes) {
+    bytes_ = bytes;
+  }
+
+private:
+  int function_;
+  size_t bytes_{0};
+  Clock::time_point start_;
+};
+
+#include "gl_trace_wrappers.inc"
+
+struct Stats {
+  FunctionStats frame[GL_TRACE_FUNCTION_COUNT];
+  FunctionStats last_frame[GL_TRACE_FUNCTION_COUNT];
+  FrameStats last_totals;
+
+  Stats() : last_totals() {
+    for (int index = 0; index < GL_TRACE_FUNCTION_COUNT; ++index) {
+      const FunctionStats none = {GL_TRACE_NAMES[index], 0, 0, 0.0};
+      frame[index] = none;
+      last_frame[index] = none;
+    }
+    last_totals.Functions = last_frame;
+    last_totals.FunctionCount = GL_TRACE_FUNCTION_COUNT;
+  }
+};
+
+auto TheStats() -> Stats & {
+  static Stats stats;
+  return stats;
+}
+
+Call::~Call() {
+  FunctionStats &stats = TheStats().frame[function_];
+  ++stats.Calls;
+  stats.Bytes += bytes_;
+  stats.Seconds +=
+      std::chrono::duration<double>(Clock::now() - start_).count();
+}
+
+} // namespace
+
+void Install() {
+  // Create the statistics before any call is traced
+  TheStats();
+  InstallWrappers();
+}
+
+void NewFrame() {
+  Stats &stats = TheStats();
+  FrameStats &totals = stats.last_totals;
+  totals.Calls = 0;
+  totals.Bytes = 0;
+  totals.Seconds = 0.0;
+  for (int index = 0; index < GL_TRACE_FUNCTION_COUNT; ++index) {
+    FunctionStats &function = stats.frame[index];
+    totals.Calls += function.Calls;
+    totals.Bytes += function.Bytes;
+    totals.Seconds += function.Seconds;
+    stats.last_frame[index] = function;
+    function.Calls = 0;
+    function.Bytes = 0;
+    function.Seconds = 0.0;
+  }
+}
+
+auto LastFrame() -> FrameStats {
+  return TheStats().last_totals;
+}
+
+} // namespace trace
+} // namespace gl
+} // namespace asap
@@ -0,0 +1,124 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Per-call latency of `ASLOG_TO_LOGGER` vs `ASLOG_DEFERRED_TO_LOGGER`.
+ *
+ * Both paths log the same message to a logger with a null sink, so that only
+ * the cost paid by the calling thread is measured. Each call is timed
+ * individually and the p50/p99 latencies are printed in nanoseconds.
+ *
+ * Usage: `deferred_log_bench [iterations]`
+ */
+
+#include "logging/deferred.h"
+
+#include <logging/logging.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t DEFAULT_ITERATIONS = 100000;
+constexpr std::size_t WARMUP_ITERATIONS = 1000;
+
+/// Let the deferred back-end drain its buffer every so often, so that the
+/// measure is not dominated by the synchronous fallback of a full buffer.
+constexpr std::size_t DRAIN_INTERVAL = 512;
+
+using Clock = std::chrono::steady_clock;
+
+struct Percentiles {
+  std::int64_t p50;
+  std::int64_t p99;
+  std::int64_t max;
+};
+
+auto ComputePercentiles(std::vector<std::int64_t> &samples) -> Percentiles {
+  std::sort(samples.begin(), samples.end());
+  const auto at = [&samples](double percentile) {
+    const auto index = static_cast<std::size_t>(
+        percentile * static_cast<double>(samples.size() - 1));
+    return samples[index];
+  };
+  return {at(0.50), at(0.99), samples.back()};
+}
+
+template <typename Function>
+auto Measure(std::size_t iterations, Function &&log_once)
+    -> std::vector<std::int64_t> {
+  std::vector<std::int64_t> samples;
+  samples.reserve(iterations);
+  const std::string name{"hot_loop"};
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    const auto start = Clock::now();
+    log_once(iteration, name);
+    const auto stop = Clock::now();
+    samples.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count());
+    if (iteration % DRAIN_INTERVAL == DRAIN_INTERVAL - 1) {
+      asap::logging::deferred::Flush();
+    }
+  }
+  return samples;
+}
+
+void Report(const char *name, std::vector<std::int64_t> samples) {
+  const auto result = ComputePercentiles(samples);
+  std::cout << name << ": p50=" << result.p50 << "ns p99=" << result.p99
+            << "ns max=" << result.max << "ns\n";
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  const auto iterations = (argc > 1)
+                              ? static_cast<std::size_t>(std::strtoull(
+                                    argv[1], nullptr, 10)) // NOLINT
+                              : DEFAULT_ITERATIONS;
+
+  spdlog::logger logger(
+      "bench", std::make_shared<spdlog::sinks::null_sink_mt>());
+  logger.set_level(spdlog::level::trace);
+
+  const auto synchronous = [&logger](
+                               std::size_t iteration, const std::string &name) {
+    ASLOG_TO_LOGGER(logger, debug, "{} iteration {} took {:.3f} ms", name,
+        iteration, 0.125);
+  };
+  const auto deferred = [&logger](
+                            std::size_t iteration, const std::string &name) {
+    ASLOG_DEFERRED_TO_LOGGER(logger, debug, "{} iteration {} took {:.3f} ms",
+        name, iteration, 0.125);
+  };
+
+  // Warm up both paths (back-end thread start, thread buffer allocation, ...)
+  Measure(WARMUP_ITERATIONS, synchronous);
+  Measure(WARMUP_ITERATIONS, deferred);
+  asap::logging::deferred::Flush();
+  const auto fallbacks = asap::logging::deferred::SynchronousFallbacks();
+
+  std::cout << "iterations: " << iterations << "\n";
+  Report("ASLOG_TO_LOGGER         ", Measure(iterations, synchronous));
+  Report("ASLOG_DEFERRED_TO_LOGGER", Measure(iterations, deferred));
+  std::cout << "deferred synchronous fallbacks: "
+            << asap::logging::deferred::SynchronousFallbacks() - fallbacks
+            << "\n";
+
+  asap::logging::deferred::Shutdown();
+  return 0;
+}
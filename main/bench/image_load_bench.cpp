@@ -0,0 +1,356 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Latency of the image viewer, from opening a batch of image files to
+ * their display.
+ *
+ * Opens 100 images at once in the image viewer, drawn in a hidden window, and
+ * runs frames until they are all uploaded. For each image, `visible` is the
+ * time from Open() until its preview can be drawn and `complete` until its
+ * full texture can be drawn; the median, 95th percentile and maximum are
+ * reported. The frame times are reported as well: decoding and uploading in
+ * the background should not make any frame much slower than the others.
+ *
+ * The batch runs twice: with the default texture budget of the application,
+ * where most images are evicted once uploaded, and with a budget large enough
+ * for all of them to stay resident.
+ *
+ * The images are PNG screenshots sized test patterns, generated in a temporary
+ * directory, unless a directory of images is given with `--images`. A software
+ * context is enough, for example on a headless machine:
+ * `xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 image_load_bench`.
+ *
+ * Results are written as a JSON document, to the standard output or to the
+ * file given with `--output`, so that they can be compared across commits.
+ *
+ * Usage: `image_load_bench [--images directory] [--output results.json]`
+ */
+
+#include <asap_app_imgui/version.h>
+
+#include "ui/images/image_loader.h"
+#include "ui/images/image_viewer.h"
+#include "ui/textures/texture_manager.h"
+
+#include <glad/gl.h>
+#include <glad/gl_state.h>
+
+#include <GLFW/glfw3.h>
+
+#include <imgui/backends/imgui_impl_glfw.h>
+#include <imgui/backends/imgui_impl_opengl3.h>
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+namespace {
+
+constexpr std::size_t IMAGES = 100;
+constexpr int IMAGE_WIDTH = 1920;
+constexpr int IMAGE_HEIGHT = 1080;
+constexpr int WIDTH = 1280;
+constexpr int HEIGHT = 720;
+/// The 100 images and their mipmaps stay resident.
+constexpr std::size_t RESIDENT_BUDGET = std::size_t{2} << 30U;
+/// Give up when the images are not all displayed by then.
+constexpr auto TIMEOUT = std::chrono::seconds(120);
+
+using Clock = std::chrono::steady_clock;
+
+auto Elapsed(Clock::time_point start) -> double {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct Summary {
+  double median;
+  double p95;
+  double max;
+};
+
+auto Summarize(std::vector<double> samples) -> Summary {
+  if (samples.empty()) {
+    return {0, 0, 0};
+  }
+  std::sort(samples.begin(), samples.end());
+  return {samples[samples.size() / 2], samples[samples.size() * 95 / 100],
+      samples.back()};
+}
+
+/// A gradient with a grid, and a different tint per image: PNG compresses it
+/// about as well as a screenshot.
+void WriteTestImage(const std::filesystem::path &path, std::size_t index) {
+  std::vector<std::uint32_t> pixels(
+      static_cast<std::size_t>(IMAGE_WIDTH) * IMAGE_HEIGHT);
+  const auto tint = static_cast<std::uint32_t>(index * 37U) & 0xFFU;
+  for (int y = 0; y < IMAGE_HEIGHT; ++y) {
+    for (int x = 0; x < IMAGE_WIDTH; ++x) {
+      const auto red = static_cast<std::uint32_t>(x * 255 / IMAGE_WIDTH);
+      const auto green = static_cast<std::uint32_t>(y * 255 / IMAGE_HEIGHT);
+      const auto grid = (x % 64 == 0 || y % 64 == 0) ? 0xFFFFFFU : 0U;
+      pixels[static_cast<std::size_t>(y) * IMAGE_WIDTH + x] =
+          0xFF000000U | ((red | (green << 8U) | (tint << 16U)) ^ grid);
+    }
+  }
+  stbi_write_png(path.string().c_str(), IMAGE_WIDTH, IMAGE_HEIGHT, 4,
+      pixels.data(), IMAGE_WIDTH * 4);
+}
+
+/// Generate the test images on all the cores, it takes a while.
+auto GenerateImages(const std::filesystem::path &directory)
+    -> std::vector<std::filesystem::path> {
+  std::filesystem::create_directories(directory);
+  std::vector<std::filesystem::path> paths;
+  for (std::size_t index = 0; index < IMAGES; ++index) {
+    paths.push_back(directory / ("image_" + std::to_string(index) + ".png"));
+  }
+  std::atomic<std::size_t> next{0};
+  const auto generate = [&paths, &next]() {
+    for (auto index = next++; index < paths.size(); index = next++) {
+      WriteTestImage(paths[index], index);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (unsigned worker = 1; worker < std::thread::hardware_concurrency();
+       ++worker) {
+    workers.emplace_back(generate);
+  }
+  generate();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return paths;
+}
+
+auto ListImages(const std::filesystem::path &directory)
+    -> std::vector<std::filesystem::path> {
+  std::vector<std::filesystem::path> paths;
+  for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.is_regular_file()) {
+      paths.push_back(entry.path());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  if (paths.size() > IMAGES) {
+    paths.resize(IMAGES);
+  }
+  return paths;
+}
+
+/// Draw the image viewer in a frame of its own. Return the duration of the
+/// frame, GPU included.
+auto RunFrame(asap::ui::ImageViewer &viewer) -> double {
+  const auto start = Clock::now();
+  asap::gl::NewFrame();
+  asap::ui::TextureManager::Default().Update();
+  ImGui_ImplOpenGL3_NewFrame();
+  ImGui_ImplGlfw_NewFrame();
+  ImGui::NewFrame();
+  ImGui::SetNextWindowPos({0, 0}, ImGuiCond_Always);
+  ImGui::SetNextWindowSize(
+      {static_cast<float>(WIDTH), static_cast<float>(HEIGHT)},
+      ImGuiCond_Always);
+  ImGui::Begin("Images");
+  viewer.Draw();
+  ImGui::End();
+  ImGui::Render();
+  ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+  // The stock backend does not go through the state cache
+  asap::gl::InvalidateState();
+  glFinish();
+  return Elapsed(start);
+}
+
+/// The outcome of opening the batch of images with a given texture budget.
+struct Run {
+  std::size_t budget{0};
+  std::size_t failed{0};
+  std::size_t frames{0};
+  std::size_t evictions{0};
+  double batch_seconds{0};
+  Summary visible{};
+  Summary complete{};
+  Summary frame{};
+};
+
+auto RunBatch(const std::vector<std::filesystem::path> &paths,
+    unsigned workers, std::size_t budget) -> Run {
+  auto &textures = asap::ui::TextureManager::Default();
+  textures.SetBudget(budget);
+  const auto evictions = textures.GetStats().evictions;
+
+  Run run;
+  run.budget = budget;
+  std::vector<double> visible;
+  std::vector<double> complete;
+  std::vector<double> frame_times;
+  asap::ui::ImageViewer viewer(workers);
+  // Let ImGui settle the layout
+  RunFrame(viewer);
+
+  const auto start = Clock::now();
+  for (const auto &path : paths) {
+    viewer.Open(path);
+  }
+  while (Clock::now() - start < TIMEOUT) {
+    frame_times.push_back(RunFrame(viewer));
+    const auto images = viewer.Images();
+    if (std::all_of(images.begin(), images.end(), [](const auto &image) {
+          return !image.error.empty() || image.complete_seconds >= 0;
+        })) {
+      break;
+    }
+  }
+  run.batch_seconds = Elapsed(start);
+  run.frames = frame_times.size();
+  run.evictions = textures.GetStats().evictions - evictions;
+
+  for (const auto &image : viewer.Images()) {
+    if (!image.error.empty() || image.complete_seconds < 0) {
+      ++run.failed;
+      continue;
+    }
+    visible.push_back(image.visible_seconds);
+    complete.push_back(image.complete_seconds);
+  }
+  run.visible = Summarize(visible);
+  run.complete = Summarize(complete);
+  run.frame = Summarize(frame_times);
+  return run;
+}
+
+void WriteResults(std::ostream &out, std::size_t images, unsigned workers,
+    const std::vector<Run> &runs) {
+  const auto write = [&out](const char *name, const Summary &summary) {
+    out << "        \"" << name
+        << "\": {\"median\": " << summary.median * 1000.0
+        << ", \"p95\": " << summary.p95 * 1000.0
+        << ", \"max\": " << summary.max * 1000.0 << "}";
+  };
+  out << "{\n";
+  out << "  \"version\": \"" << asap_app_imgui::info::cNameVersion << "\",\n";
+  out << "  \"renderer\": \""
+      << reinterpret_cast<const char *>(glGetString(GL_RENDERER)) << "\",\n";
+  out << "  \"images\": " << images << ",\n";
+  out << "  \"decode_workers\": " << workers << ",\n";
+  out << "  \"runs\": [\n";
+  for (std::size_t index = 0; index < runs.size(); ++index) {
+    const auto &run = runs[index];
+    out << "    {\n";
+    out << "      \"texture_budget_mib\": " << (run.budget >> 20U) << ",\n";
+    out << "      \"failed\": " << run.failed << ",\n";
+    out << "      \"frames\": " << run.frames << ",\n";
+    out << "      \"evictions\": " << run.evictions << ",\n";
+    out << "      \"batch_seconds\": " << run.batch_seconds << ",\n";
+    out << "      \"milliseconds\": {\n";
+    write("visible", run.visible);
+    out << ",\n";
+    write("complete", run.complete);
+    out << ",\n";
+    write("frame", run.frame);
+    out << "\n      }\n    }" << (index + 1 < runs.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n}\n";
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::filesystem::path output;
+  std::filesystem::path directory;
+  for (int index = 1; index < argc; ++index) {
+    const std::string arg{argv[index]}; // NOLINT
+    if (arg == "--output" && index + 1 < argc) {
+      output = argv[++index]; // NOLINT
+    } else if (arg == "--images" && index + 1 < argc) {
+      directory = argv[++index]; // NOLINT
+    } else {
+      std::cerr << "usage: " << argv[0] // NOLINT
+                << " [--images directory] [--output results.json]\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::filesystem::path generated;
+  std::vector<std::filesystem::path> paths;
+  if (directory.empty()) {
+    generated =
+        std::filesystem::temp_directory_path() / "asap_image_load_bench";
+    std::cerr << "generating " << IMAGES << " test images in " << generated
+              << "\n";
+    paths = GenerateImages(generated);
+  } else {
+    paths = ListImages(directory);
+  }
+
+  if (glfwInit() == GLFW_FALSE) {
+    std::cerr << "can't initialize GLFW\n";
+    return EXIT_FAILURE;
+  }
+  // The context of the application, hidden and without vsync
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  GLFWwindow *window =
+      glfwCreateWindow(WIDTH, HEIGHT, "image_load_bench", nullptr, nullptr);
+  if (window == nullptr) {
+    std::cerr << "can't create a GL 3.2 core context\n";
+    glfwTerminate();
+    return EXIT_FAILURE;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+  gladLoadGL(static_cast<GLADloadfunc>(glfwGetProcAddress));
+
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui_ImplGlfw_InitForOpenGL(window, false);
+  ImGui_ImplOpenGL3_Init("#version 130");
+
+  const auto workers = asap::ui::ImageLoader::DefaultWorkers();
+  std::vector<Run> runs;
+  runs.push_back(
+      RunBatch(paths, workers, asap::ui::TextureManager::DEFAULT_BUDGET));
+  runs.push_back(RunBatch(paths, workers, RESIDENT_BUDGET));
+  const auto failed = std::any_of(runs.begin(), runs.end(),
+      [](const Run &run) { return run.failed != 0; });
+
+  if (output.empty()) {
+    WriteResults(std::cout, paths.size(), workers, runs);
+  } else {
+    std::ofstream out(output);
+    WriteResults(out, paths.size(), workers, runs);
+  }
+
+  asap::ui::TextureManager::Default().Clear();
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui_ImplGlfw_Shutdown();
+  ImGui::DestroyContext();
+  glfwDestroyWindow(window);
+  glfwTerminate();
+  if (!generated.empty()) {
+    std::filesystem::remove_all(generated);
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,291 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Ingestion and rendering benchmarks for `ImGuiLogSink`.
+ *
+ * Runs headless: an ImGui context is created with the default font and the
+ * frames are rendered without a renderer back-end (the draw data is simply
+ * discarded). The settings files are written to a temporary directory.
+ *
+ * Results are written as a JSON document, to the standard output or to the
+ * file given with `--output`, so that they can be compared across commits.
+ *
+ * Usage: `log_sink_bench [--output results.json] [--max-records N]`
+ */
+
+#include "config/config.h"
+#include "config/config_store.h"
+#include "config/settings_writer.h"
+#include "ui/log/sink.h"
+
+#include <asap_app_imgui/version.h>
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using asap::ui::ImGuiLogSink;
+
+namespace {
+
+constexpr std::size_t DEFAULT_MAX_RECORDS = 1000000;
+constexpr std::size_t INGESTION_RECORDS = 200000;
+constexpr std::size_t INGESTION_THREADS = 16;
+constexpr std::size_t SETTINGS_ITERATIONS = 100;
+constexpr float DISPLAY_WIDTH = 1280.0F;
+constexpr float DISPLAY_HEIGHT = 800.0F;
+constexpr float FRAME_TIME = 1.0F / 60.0F;
+
+/// Matches about one record in ten of the generated ones.
+constexpr const char *DRAW_FILTER = "worker 7";
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  std::string name;
+  /// Number of items (records, frames, calls...) processed per run.
+  std::size_t items;
+  /// Median duration of one run.
+  double seconds;
+};
+
+auto Elapsed(Clock::time_point start) -> double {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+auto Median(std::vector<double> samples) -> double {
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+/// Make a record similar to what ASLOG produces in debug builds.
+auto MakeMessage(std::size_t index, std::string &payload)
+    -> spdlog::details::log_msg {
+  static constexpr std::array<spdlog::level::level_enum, 6> levels{
+      spdlog::level::trace, spdlog::level::debug, spdlog::level::info,
+      spdlog::level::warn, spdlog::level::err, spdlog::level::critical};
+  payload = "[log_sink_bench.cpp:" + std::to_string(index % 1000) +
+            "] worker " + std::to_string(index % 10) + " processed item " +
+            std::to_string(index) +
+            " after a reasonably long message to exercise soft wraps";
+  return {"bench", levels[index % levels.size()], payload};
+}
+
+void Ingest(ImGuiLogSink &sink, std::size_t first, std::size_t count) {
+  std::string payload;
+  for (auto index = first; index < first + count; ++index) {
+    sink.log(MakeMessage(index, payload));
+  }
+}
+
+auto IngestThreaded(ImGuiLogSink &sink, std::size_t threads,
+    std::size_t records) -> double {
+  const auto per_thread = records / threads;
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  const auto start = Clock::now();
+  for (std::size_t thread = 0; thread < threads; ++thread) {
+    workers.emplace_back(
+        [&sink, thread, per_thread]() {
+          Ingest(sink, thread * per_thread, per_thread);
+        });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return Elapsed(start);
+}
+
+void Fill(ImGuiLogSink &sink, std::size_t records) {
+  sink.Clear();
+  IngestThreaded(sink, INGESTION_THREADS, records);
+}
+
+auto DrawFrame(ImGuiLogSink &sink) -> double {
+  auto &io = ImGui::GetIO();
+  io.DisplaySize = ImVec2(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  io.DeltaTime = FRAME_TIME;
+  const auto start = Clock::now();
+  ImGui::NewFrame();
+  bool open = true;
+  ImGui::SetNextWindowPos(ImVec2(0, 0));
+  ImGui::SetNextWindowSize(ImVec2(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+  sink.Draw("Logs", &open);
+  ImGui::Render();
+  return Elapsed(start);
+}
+
+auto FramesFor(std::size_t records) -> std::size_t {
+  constexpr std::size_t frames_budget = 100000;
+  return std::clamp<std::size_t>(frames_budget / records, 3, 30);
+}
+
+void BenchIngestion(ImGuiLogSink &sink, std::vector<Result> &results) {
+  for (const auto threads : {std::size_t{1}, INGESTION_THREADS}) {
+    std::vector<double> samples;
+    for (int run = 0; run < 3; ++run) {
+      sink.Clear();
+      samples.push_back(IngestThreaded(sink, threads, INGESTION_RECORDS));
+    }
+    results.push_back({"sink_it/threads:" + std::to_string(threads),
+        INGESTION_RECORDS, Median(samples)});
+  }
+}
+
+void BenchDraw(ImGuiLogSink &sink, std::size_t max_records,
+    std::vector<Result> &results) {
+  for (const auto records :
+      {std::size_t{10000}, std::size_t{100000}, std::size_t{1000000}}) {
+    if (records > max_records) {
+      break;
+    }
+    Fill(sink, records);
+    for (const auto filter : {false, true}) {
+      for (const auto wrap : {false, true}) {
+        sink.SetDisplayFilter(filter ? DRAW_FILTER : "");
+        if (sink.IsWrapEnabled() != wrap) {
+          sink.ToggleWrap();
+        }
+        // The first frame after a change is not representative
+        DrawFrame(sink);
+        std::vector<double> samples;
+        const auto frames = FramesFor(records);
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+          samples.push_back(DrawFrame(sink));
+        }
+        auto name = "draw/records:" + std::to_string(records);
+        name += filter ? "/filter" : "";
+        name += wrap ? "/wrap" : "";
+        results.push_back({name, 1, Median(samples)});
+      }
+    }
+    sink.SetDisplayFilter("");
+
+    const auto start = Clock::now();
+    sink.Clear();
+    results.push_back(
+        {"clear/records:" + std::to_string(records), records, Elapsed(start)});
+  }
+}
+
+void BenchSettings(ImGuiLogSink &sink, std::vector<Result> &results) {
+  auto &writer = asap::config::SettingsWriter::Default();
+  std::vector<double> queue;
+  std::vector<double> save;
+  std::vector<double> load;
+  for (std::size_t iteration = 0; iteration < SETTINGS_ITERATIONS;
+       ++iteration) {
+    // What the UI thread pays, then the whole save done by the writer
+    auto start = Clock::now();
+    sink.SaveSettings();
+    queue.push_back(Elapsed(start));
+    writer.Flush();
+    save.push_back(Elapsed(start));
+    // Parse the file again, not the table kept by the store
+    asap::config::ConfigStore::Default().Invalidate(
+        asap::config::Location::F_LOG_SETTINGS);
+    start = Clock::now();
+    sink.LoadSettings();
+    load.push_back(Elapsed(start));
+  }
+  results.push_back({"settings/save/queue", 1, Median(queue)});
+  results.push_back({"settings/save", 1, Median(save)});
+  results.push_back({"settings/load", 1, Median(load)});
+}
+
+void WriteResults(std::ostream &out, const std::vector<Result> &results) {
+  out << "{\n";
+  out << "  \"version\": \"" << asap_app_imgui::info::cNameVersion << "\",\n";
+  out << "  \"revision\": \"" << asap_app_imgui::info::cVersionRevision
+      << "\",\n";
+  out << "  \"results\": [\n";
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    const auto &result = results[index];
+    out << "    {\"name\": \"" << result.name
+        << "\", \"items\": " << result.items
+        << ", \"seconds\": " << result.seconds << ", \"items_per_second\": ";
+    // A case too fast for the clock has no rate, and JSON has no infinity
+    if (result.seconds > 0.0) {
+      out << static_cast<double>(result.items) / result.seconds;
+    } else {
+      out << "null";
+    }
+    out << "}" << (index + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n}\n";
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::filesystem::path output;
+  auto max_records = DEFAULT_MAX_RECORDS;
+  for (int index = 1; index < argc; ++index) {
+    const std::string arg{argv[index]}; // NOLINT
+    if (arg == "--output" && index + 1 < argc) {
+      output = argv[++index]; // NOLINT
+    } else if (arg == "--max-records" && index + 1 < argc) {
+      max_records = static_cast<std::size_t>(
+          std::strtoull(argv[++index], nullptr, 10)); // NOLINT
+    } else {
+      std::cerr << "usage: " << argv[0] // NOLINT
+                << " [--output results.json] [--max-records N]\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (!output.empty()) {
+    output = std::filesystem::absolute(output);
+  }
+
+  // Keep the settings files of the benchmark away from the user's ones
+  const auto work_dir =
+      std::filesystem::temp_directory_path() / "asap_log_sink_bench";
+  std::filesystem::create_directories(work_dir);
+  std::filesystem::current_path(work_dir);
+  asap::config::CreateDirectories();
+  // The sink logs when loading its settings, keep the console quiet
+  asap::logging::Registry::GetLogger("main").set_level(spdlog::level::warn);
+
+  ImGui::CreateContext();
+  auto &io = ImGui::GetIO();
+  io.IniFilename = nullptr;
+  io.Fonts->AddFontDefault();
+  unsigned char *pixels = nullptr;
+  int width = 0;
+  int height = 0;
+  io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+  std::vector<Result> results;
+  {
+    ImGuiLogSink sink;
+    BenchIngestion(sink, results);
+    BenchDraw(sink, max_records, results);
+    BenchSettings(sink, results);
+  }
+
+  ImGui::DestroyContext();
+
+  if (output.empty()) {
+    WriteResults(std::cout, results);
+  } else {
+    std::ofstream out(output);
+    WriteResults(out, results);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Cost of rendering the ImGui draw data, with the stock OpenGL3 backend
+ * and through the persistently mapped buffers.
+ *
+ * Renders a dense UI (many windows full of widgets) in a hidden window. Each
+ * renderer is measured twice: `submit` is the time spent in the render call
+ * (the CPU side, buffer uploads included), `frame` also waits with glFinish()
+ * for the GPU to complete the frame. The draw commands of the frame and the
+ * draw calls left once they are batched by the streaming renderer are
+ * reported with the results, as well as the GL state changes it issued and
+ * the redundant ones skipped by the state cache.
+ *
+ * The streaming renderer needs GL 4.4 or ARB_buffer_storage; without it the
+ * `stream` cases measure the stock backend again and the results say so. A
+ * software context is enough, for example on a headless machine:
+ * `xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 render_bench`.
+ *
+ * Results are written as a JSON document, to the standard output or to the
+ * file given with `--output`, so that they can be compared across commits.
+ *
+ * Usage: `render_bench [--output results.json]`
+ */
+
+#include <asap_app_imgui/version.h>
+
+#include <glad/gl.h>
+#include <glad/gl_capabilities.h>
+#include <glad/gl_state.h>
+
+#include <GLFW/glfw3.h>
+
+#include <backends/imgui_impl_opengl3_stream.h>
+#include <imgui/backends/imgui_impl_glfw.h>
+#include <imgui/backends/imgui_impl_opengl3.h>
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t ITERATIONS = 200;
+constexpr int WIDTH = 1920;
+constexpr int HEIGHT = 1080;
+/// The UI: a grid of windows, each with rows of widgets.
+constexpr int WINDOWS_PER_ROW = 6;
+constexpr int WINDOW_ROWS = 4;
+constexpr int WIDGET_ROWS = 40;
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  std::string name;
+  /// Median duration of one run.
+  double seconds;
+};
+
+auto Elapsed(Clock::time_point start) -> double {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+auto Median(std::vector<double> samples) -> double {
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+template <typename Setup, typename Run>
+auto Measure(const std::string &name, Setup setup, Run run) -> Result {
+  std::vector<double> samples;
+  samples.reserve(ITERATIONS);
+  for (std::size_t iteration = 0; iteration < ITERATIONS; ++iteration) {
+    setup();
+    const auto start = Clock::now();
+    run();
+    samples.push_back(Elapsed(start));
+  }
+  return {name, Median(samples)};
+}
+
+/// Build the UI and return its draw data.
+auto BuildFrame() -> ImDrawData * {
+  ImGui_ImplOpenGL3_NewFrame();
+  ImGui_ImplGlfw_NewFrame();
+  ImGui::NewFrame();
+
+  const ImVec2 window_size{static_cast<float>(WIDTH) / WINDOWS_PER_ROW,
+      static_cast<float>(HEIGHT) / WINDOW_ROWS};
+  float value = 0.5F;
+  bool checked = true;
+  for (int window = 0; window < WINDOWS_PER_ROW * WINDOW_ROWS; ++window) {
+    const auto column = static_cast<float>(window % WINDOWS_PER_ROW);
+    const auto row = static_cast<float>(window / WINDOWS_PER_ROW);
+    ImGui::SetNextWindowPos(
+        {column * window_size.x, row * window_size.y}, ImGuiCond_Always);
+    ImGui::SetNextWindowSize(window_size, ImGuiCond_Always);
+    const std::string title = "Window " + std::to_string(window);
+    ImGui::Begin(title.c_str());
+    for (int widget = 0; widget < WIDGET_ROWS; ++widget) {
+      ImGui::PushID(widget);
+      ImGui::Text("Row %d of window %d", widget, window);
+      ImGui::SameLine();
+      ImGui::Checkbox("##check", &checked);
+      ImGui::SameLine();
+      ImGui::SliderFloat("##value", &value, 0.0F, 1.0F);
+      ImGui::PopID();
+    }
+    ImGui::End();
+  }
+
+  ImGui::Render();
+  return ImGui::GetDrawData();
+}
+
+void WriteResults(std::ostream &out, const std::vector<Result> &results,
+    const ImDrawData &draw_data, bool streaming) {
+  out << "{\n";
+  out << "  \"version\": \"" << asap_app_imgui::info::cNameVersion << "\",\n";
+  out << "  \"renderer\": \""
+      << reinterpret_cast<const char *>(glGetString(GL_RENDERER)) << "\",\n";
+  out << "  \"streaming\": " << (streaming ? "true" : "false") << ",\n";
+  out << "  \"draw_lists\": " << draw_data.CmdListsCount << ",\n";
+  out << "  \"vertices\": " << draw_data.TotalVtxCount << ",\n";
+  out << "  \"indices\": " << draw_data.TotalIdxCount << ",\n";
+  if (streaming) {
+    // Draw calls of the stock backend, one per command, and once batched
+    const auto stats = ImGui_ImplOpenGL3Stream_GetStats();
+    out << "  \"draw_commands\": " << stats.DrawCommands << ",\n";
+    out << "  \"draw_calls\": " << stats.DrawCalls << ",\n";
+    // State changes of the last streamed frame
+    const auto counters = asap::gl::LastFrameCounters();
+    out << "  \"state_changes_issued\": " << counters.Issued << ",\n";
+    out << "  \"state_changes_elided\": " << counters.Elided << ",\n";
+    // 0 without timer queries
+    out << "  \"gpu_milliseconds\": " << stats.GpuSeconds * 1000.0 << ",\n";
+  }
+  out << "  \"results\": [\n";
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    const auto &result = results[index];
+    out << "    {\"name\": \"" << result.name
+        << "\", \"seconds\": " << result.seconds
+        << ", \"milliseconds\": " << result.seconds * 1000.0 << "}"
+        << (index + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n}\n";
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::filesystem::path output;
+  for (int index = 1; index < argc; ++index) {
+    const std::string arg{argv[index]}; // NOLINT
+    if (arg == "--output" && index + 1 < argc) {
+      output = argv[++index]; // NOLINT
+    } else {
+      std::cerr << "usage: " << argv[0] // NOLINT
+                << " [--output results.json]\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (glfwInit() == GLFW_FALSE) {
+    std::cerr << "can't initialize GLFW\n";
+    return EXIT_FAILURE;
+  }
+  // The context of the application, hidden and without vsync
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  GLFWwindow *window =
+      glfwCreateWindow(WIDTH, HEIGHT, "render_bench", nullptr, nullptr);
+  if (window == nullptr) {
+    std::cerr << "can't create a GL 3.2 core context\n";
+    glfwTerminate();
+    return EXIT_FAILURE;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+  gladLoadGL(static_cast<GLADloadfunc>(glfwGetProcAddress));
+  asap::gl::ProbeCapabilities(static_cast<GLADloadfunc>(glfwGetProcAddress));
+
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGui_ImplGlfw_InitForOpenGL(window, false);
+  ImGui_ImplOpenGL3_Init("#version 130");
+  const bool streaming = ImGui_ImplOpenGL3Stream_Init(
+      "#version 130", static_cast<GLADloadfunc>(glfwGetProcAddress));
+
+  // Let ImGui settle the layout and both renderers allocate their buffers
+  for (int frame = 0; frame < 3; ++frame) {
+    ImGui_ImplOpenGL3_RenderDrawData(BuildFrame());
+    // The stock backend does not go through the state cache
+    asap::gl::InvalidateState();
+    ImGui_ImplOpenGL3Stream_RenderDrawData(BuildFrame());
+  }
+  glFinish();
+
+  ImDrawData *draw_data = nullptr;
+  const auto build = [&draw_data]() {
+    asap::gl::NewFrame();
+    draw_data = BuildFrame();
+    glFinish();
+  };
+  std::vector<Result> results;
+  results.push_back(Measure("render/stock/submit", build,
+      [&draw_data]() { ImGui_ImplOpenGL3_RenderDrawData(draw_data); }));
+  results.push_back(Measure("render/stock/frame", build, [&draw_data]() {
+    ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    glFinish();
+  }));
+  asap::gl::InvalidateState();
+  results.push_back(Measure("render/stream/submit", build, [&draw_data]() {
+    ImGui_ImplOpenGL3Stream_RenderDrawData(draw_data);
+  }));
+  results.push_back(Measure("render/stream/frame", build, [&draw_data]() {
+    ImGui_ImplOpenGL3Stream_RenderDrawData(draw_data);
+    glFinish();
+  }));
+  asap::gl::NewFrame();
+
+  if (output.empty()) {
+    WriteResults(std::cout, results, *draw_data, streaming);
+  } else {
+    std::ofstream out(output);
+    WriteResults(out, results, *draw_data, streaming);
+  }
+
+  ImGui_ImplOpenGL3Stream_Shutdown();
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui_ImplGlfw_Shutdown();
+  ImGui::DestroyContext();
+  glfwDestroyWindow(window);
+  glfwTerminate();
+  return EXIT_SUCCESS;
+}
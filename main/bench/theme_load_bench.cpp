@@ -0,0 +1,154 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Startup cost of loading the theme, with and without its snapshot.
+ *
+ * Runs headless, with the settings files in a temporary directory. The theme
+ * settings are saved once, then loaded by parsing `theme.toml` (the snapshot
+ * being removed before each run, as after an edit of the file) and from the
+ * snapshot (the normal startup).
+ *
+ * Results are written as a JSON document, to the standard output or to the
+ * file given with `--output`, so that they can be compared across commits.
+ *
+ * Usage: `theme_load_bench [--output results.json]`
+ */
+
+#include "config/config.h"
+#include "config/config_store.h"
+#include "config/settings_writer.h"
+#include "ui/style/theme.h"
+
+#include <asap_app_imgui/version.h>
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using asap::ui::Theme;
+
+namespace {
+
+constexpr std::size_t ITERATIONS = 200;
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  std::string name;
+  /// Median duration of one run.
+  double seconds;
+};
+
+auto Elapsed(Clock::time_point start) -> double {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+auto Median(std::vector<double> samples) -> double {
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+template <typename Setup, typename Run>
+auto Measure(const std::string &name, Setup setup, Run run) -> Result {
+  std::vector<double> samples;
+  samples.reserve(ITERATIONS);
+  for (std::size_t iteration = 0; iteration < ITERATIONS; ++iteration) {
+    setup();
+    const auto start = Clock::now();
+    run();
+    samples.push_back(Elapsed(start));
+  }
+  return {name, Median(samples)};
+}
+
+void WriteResults(std::ostream &out, const std::vector<Result> &results) {
+  out << "{\n";
+  out << "  \"version\": \"" << asap_app_imgui::info::cNameVersion << "\",\n";
+  out << "  \"results\": [\n";
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    const auto &result = results[index];
+    out << "    {\"name\": \"" << result.name
+        << "\", \"seconds\": " << result.seconds
+        << ", \"milliseconds\": " << result.seconds * 1000.0 << "}"
+        << (index + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n}\n";
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  std::filesystem::path output;
+  for (int index = 1; index < argc; ++index) {
+    const std::string arg{argv[index]}; // NOLINT
+    if (arg == "--output" && index + 1 < argc) {
+      output = argv[++index]; // NOLINT
+    } else {
+      std::cerr << "usage: " << argv[0] // NOLINT
+                << " [--output results.json]\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (!output.empty()) {
+    output = std::filesystem::absolute(output);
+  }
+
+  // Keep the settings files of the benchmark away from the user's ones
+  const auto work_dir =
+      std::filesystem::temp_directory_path() / "asap_theme_load_bench";
+  std::filesystem::create_directories(work_dir);
+  std::filesystem::current_path(work_dir);
+  asap::config::CreateDirectories();
+  // The theme logs every load, keep the console quiet
+  asap::logging::Registry::GetLogger("main").set_level(spdlog::level::warn);
+
+  ImGui::CreateContext();
+  ImGui::GetIO().IniFilename = nullptr;
+  Theme::LoadDefaultStyle();
+  auto &writer = asap::config::SettingsWriter::Default();
+  Theme::SaveStyle();
+  writer.Flush();
+
+  const auto snapshot =
+      asap::config::GetPathFor(asap::config::Location::F_THEME_SNAPSHOT);
+  std::vector<Result> results;
+  results.push_back(Measure(
+      "theme/load/toml",
+      [&snapshot]() {
+        std::filesystem::remove(snapshot);
+        asap::config::ConfigStore::Default().Invalidate(
+            asap::config::Location::F_THEME_SETTINGS);
+      },
+      []() { Theme::LoadStyle(); }));
+  results.push_back(Measure(
+      "theme/load/snapshot", []() {}, []() { Theme::LoadStyle(); }));
+  results.push_back(Measure(
+      "theme/save/unchanged", []() {}, [&writer]() {
+        Theme::SaveStyle();
+        writer.Flush();
+      }));
+
+  ImGui::DestroyContext();
+
+  if (output.empty()) {
+    WriteResults(std::cout, results);
+  } else {
+    std::ofstream out(output);
+    WriteResults(out, results);
+  }
+  return EXIT_SUCCESS;
+}
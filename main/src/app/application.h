@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "config/settings_writer.h"
+
 namespace asap::app {
 
 class ImGuiRunner;
@@ -16,6 +18,10 @@ public:
   virtual void Init(ImGuiRunner *runner) = 0;
   virtual auto Draw() -> bool = 0;
   virtual void ShutDown() = 0;
+  /// Save the application settings. Called periodically, and should only
+  /// capture the settings and leave the writing to `config::SettingsWriter`,
+  /// passing it `capture`.
+  virtual void SaveSettings(asap::config::SettingsWriter::Capture capture) = 0;
 
   Application(const Application &) = delete;
   Application(Application &&) = delete;
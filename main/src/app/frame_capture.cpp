@@ -0,0 +1,501 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "app/frame_capture.h"
+
+#include <glad/gl_state.h>
+
+#include <algorithm> // for std::max, std::swap_ranges
+#include <chrono>
+#include <cmath>   // for std::llround
+#include <cstring> // for memcpy
+#include <utility> // for std::move
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+namespace asap::app {
+
+const char *const FrameCapture::LOGGER_NAME = "main";
+
+namespace {
+
+/// Pixel buffers of the ring: a frame is mapped two frames after it is read
+/// back at the latest, or dropped.
+constexpr std::size_t RING_SIZE = 3;
+/// Frames waiting for the encoder, at most. Beyond, frames of a sequence are
+/// dropped; screenshots are always kept.
+constexpr std::size_t MAX_QUEUED_JOBS = 8;
+constexpr std::size_t PIXEL_BYTES = 4;
+
+using Clock = std::chrono::steady_clock;
+
+auto Milliseconds(Clock::time_point start) -> double {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+/// Swap the rows, GL reads the bottom row first.
+void FlipRows(std::vector<std::uint8_t> &pixels, int width, int height) {
+  const auto stride = static_cast<std::size_t>(width) * PIXEL_BYTES;
+  for (int row = 0; row < height / 2; ++row) {
+    auto top = pixels.begin() + static_cast<std::ptrdiff_t>(row * stride);
+    auto bottom = pixels.begin() +
+                  static_cast<std::ptrdiff_t>((height - 1 - row) * stride);
+    std::swap_ranges(top, top + static_cast<std::ptrdiff_t>(stride), bottom);
+  }
+}
+
+/// The frame of a video of `frame_rate` frames per second, starting at
+/// `start`, shown at `time`.
+auto FrameIndex(Clock::time_point start, Clock::time_point time,
+    int frame_rate) -> std::size_t {
+  const auto seconds = std::chrono::duration<double>(time - start).count();
+  // Rounded, so that the jitter of the frames does not skip or repeat any
+  // when the application runs at the frame rate of the video
+  return static_cast<std::size_t>(
+      std::max(std::llround(seconds * frame_rate), 0LL));
+}
+
+} // namespace
+
+FrameCapture::FrameCapture() : encoder_([this]() { Run(); }) {
+}
+
+FrameCapture::~FrameCapture() {
+  if (recording_) {
+    StopRecording();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  encoder_.join();
+}
+
+void FrameCapture::Screenshot(std::filesystem::path path, int skip_frames) {
+  screenshot_ = std::move(path);
+  screenshot_skip_ = std::max(skip_frames, 0);
+}
+
+void FrameCapture::StartRecording(std::filesystem::path path, int frame_rate) {
+  if (recording_) {
+    StopRecording();
+  }
+  recording_ = true;
+  recording_path_ = std::move(path);
+  recording_frame_rate_ = std::max(frame_rate, 1);
+  recording_width_ = 0;
+  recording_height_ = 0;
+  sequence_frames_ = 0;
+  sequence_dropped_ = 0;
+  sequence_overhead_ms_ = 0;
+  sequence_max_overhead_ms_ = 0;
+  ASLOG(info, "recording the frames to {}", recording_path_.string());
+}
+
+void FrameCapture::StopRecording() {
+  if (!recording_) {
+    return;
+  }
+  recording_ = false;
+
+  // The sequence ends after its frames still being read back
+  bool in_ring = false;
+  for (std::size_t index = in_flight_; index > 0; --index) {
+    auto &readback = ring_[(oldest_ + index - 1) % RING_SIZE];
+    if (readback.sequence == recording_path_) {
+      readback.end_of_sequence = true;
+      readback.end_time = Clock::now();
+      in_ring = true;
+      break;
+    }
+  }
+  if (!in_ring) {
+    Job job;
+    job.kind = Kind::END_OF_SEQUENCE;
+    job.path = recording_path_;
+    job.time = Clock::now();
+    Queue(std::move(job));
+  }
+
+  const auto frames = static_cast<double>(std::max<std::size_t>(
+      sequence_frames_, 1));
+  ASLOG(info,
+      "recorded {} frames to {}, {} dropped, capture overhead {:.2f} ms per "
+      "frame on average, {:.2f} ms at most",
+      sequence_frames_, recording_path_.string(), sequence_dropped_,
+      sequence_overhead_ms_ / frames, sequence_max_overhead_ms_);
+}
+
+void FrameCapture::Capture(int width, int height) {
+  const auto start = Clock::now();
+  ++frame_;
+  const auto mapped = mapped_;
+  if (in_flight_ != 0) {
+    CollectReadbacks();
+  }
+
+  auto screenshot = !screenshot_.empty();
+  if (screenshot && screenshot_skip_ > 0) {
+    --screenshot_skip_;
+    screenshot = false;
+  }
+  auto sequence = recording_;
+  if (sequence && recording_width_ == 0) {
+    recording_width_ = width;
+    recording_height_ = height;
+  } else if (sequence &&
+             (width != recording_width_ || height != recording_height_)) {
+    ASLOG(warn, "the window was resized, the recording stops");
+    StopRecording();
+    sequence = false;
+  }
+  if (!screenshot && !sequence) {
+    // The mapping is part of the overhead of the frames captured earlier
+    if (mapped_ != mapped) {
+      last_overhead_ms_ = Milliseconds(start);
+      total_overhead_ms_ += last_overhead_ms_;
+      max_overhead_ms_ = std::max(max_overhead_ms_, last_overhead_ms_);
+    }
+    return;
+  }
+
+  if (in_flight_ == RING_SIZE) {
+    // Never wait for GL, a screenshot is taken at the next frame
+    if (sequence) {
+      ++dropped_;
+      ++sequence_dropped_;
+    }
+    return;
+  }
+  if (ring_.empty()) {
+    ring_.resize(RING_SIZE);
+    for (auto &readback : ring_) {
+      glGenBuffers(1, &readback.buffer);
+    }
+  }
+
+  auto &readback = ring_[next_];
+  const auto bytes = static_cast<std::size_t>(width) *
+                     static_cast<std::size_t>(height) * PIXEL_BYTES;
+  asap::gl::BindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+  if (readback.capacity != bytes) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr,
+        GL_STREAM_READ);
+    readback.capacity = bytes;
+  }
+  // Copied into the pixel buffer by GL, the call returns right away
+  asap::gl::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  asap::gl::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  readback.frame = frame_;
+  // Presented when the buffers are swapped, right after
+  readback.time = start;
+  readback.width = width;
+  readback.height = height;
+  if (screenshot) {
+    readback.screenshot = std::move(screenshot_);
+    screenshot_.clear();
+  }
+  readback.sequence = sequence ? recording_path_ : std::filesystem::path();
+  readback.frame_rate = recording_frame_rate_;
+  readback.end_of_sequence = false;
+  next_ = (next_ + 1) % RING_SIZE;
+  ++in_flight_;
+  ++captured_;
+
+  last_overhead_ms_ = Milliseconds(start);
+  total_overhead_ms_ += last_overhead_ms_;
+  max_overhead_ms_ = std::max(max_overhead_ms_, last_overhead_ms_);
+  if (sequence) {
+    ++sequence_frames_;
+    sequence_overhead_ms_ += last_overhead_ms_;
+    sequence_max_overhead_ms_ =
+        std::max(sequence_max_overhead_ms_, last_overhead_ms_);
+  }
+}
+
+void FrameCapture::CollectReadbacks() {
+  while (in_flight_ != 0) {
+    auto &readback = ring_[oldest_];
+    // Only poll, never wait for GL. The readbacks complete in order.
+    const auto status = glClientWaitSync(readback.fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+      break;
+    }
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+
+    const auto bytes = static_cast<std::size_t>(readback.width) *
+                       static_cast<std::size_t>(readback.height) *
+                       PIXEL_BYTES;
+    Job job;
+    job.width = readback.width;
+    job.height = readback.height;
+    job.frame_rate = readback.frame_rate;
+    job.time = readback.time;
+    job.pixels.resize(bytes);
+    asap::gl::BindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    const auto *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+        static_cast<GLsizeiptr>(bytes), GL_MAP_READ_BIT);
+    if (mapped != nullptr) {
+      std::memcpy(job.pixels.data(), mapped, bytes);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    } else {
+      ASLOG(error, "failed to map a frame capture buffer");
+      job.pixels.clear();
+    }
+    asap::gl::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    latency_frames_ += static_cast<std::size_t>(frame_ - readback.frame);
+    ++mapped_;
+
+    if (!job.pixels.empty()) {
+      if (!readback.screenshot.empty()) {
+        Job screenshot;
+        screenshot.kind = Kind::SCREENSHOT;
+        screenshot.path = std::move(readback.screenshot);
+        screenshot.width = job.width;
+        screenshot.height = job.height;
+        screenshot.pixels =
+            readback.sequence.empty() ? std::move(job.pixels) : job.pixels;
+        Queue(std::move(screenshot));
+      }
+      if (!readback.sequence.empty()) {
+        job.kind = Kind::FRAME;
+        job.path = readback.sequence;
+        Queue(std::move(job));
+      }
+    }
+    if (readback.end_of_sequence) {
+      Job end;
+      end.kind = Kind::END_OF_SEQUENCE;
+      end.path = std::move(readback.sequence);
+      end.time = readback.end_time;
+      Queue(std::move(end));
+    }
+    readback.screenshot.clear();
+    readback.sequence.clear();
+    readback.end_of_sequence = false;
+    oldest_ = (oldest_ + 1) % RING_SIZE;
+    --in_flight_;
+  }
+}
+
+void FrameCapture::Queue(Job job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (job.kind == Kind::FRAME && jobs_.size() >= MAX_QUEUED_JOBS) {
+      ++encoder_dropped_;
+      return;
+    }
+    jobs_.push_back(std::move(job));
+  }
+  wake_.notify_one();
+}
+
+void FrameCapture::Clear() {
+  if (recording_) {
+    StopRecording();
+  }
+  for (auto &readback : ring_) {
+    // The end of a sequence still being read back
+    if (readback.end_of_sequence) {
+      Job end;
+      end.kind = Kind::END_OF_SEQUENCE;
+      end.path = readback.sequence;
+      end.time = readback.end_time;
+      Queue(std::move(end));
+    }
+    if (readback.fence != nullptr) {
+      glDeleteSync(readback.fence);
+    }
+    asap::gl::DeleteBuffers(1, &readback.buffer);
+  }
+  ring_.clear();
+  next_ = 0;
+  oldest_ = 0;
+  in_flight_ = 0;
+}
+
+auto FrameCapture::GetStats() const -> Stats {
+  Stats stats;
+  stats.recording = recording_;
+  stats.captured = captured_;
+  stats.last_overhead_ms = last_overhead_ms_;
+  stats.max_overhead_ms = max_overhead_ms_;
+  if (captured_ != 0) {
+    stats.average_overhead_ms =
+        total_overhead_ms_ / static_cast<double>(captured_);
+  }
+  if (mapped_ != 0) {
+    stats.average_latency_frames =
+        static_cast<double>(latency_frames_) / static_cast<double>(mapped_);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats.written = written_;
+  stats.dropped = dropped_ + encoder_dropped_;
+  stats.queued = jobs_.size();
+  if (written_ != 0) {
+    stats.average_encode_ms = total_encode_ms_ / static_cast<double>(written_);
+  }
+  return stats;
+}
+
+void FrameCapture::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    // The jobs left are written before stopping
+    wake_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+    if (jobs_.empty()) {
+      break;
+    }
+    auto job = std::move(jobs_.front());
+    jobs_.pop_front();
+    lock.unlock();
+
+    const auto start = Clock::now();
+    Encode(job);
+    const auto encode_ms = Milliseconds(start);
+
+    lock.lock();
+    if (job.kind != Kind::END_OF_SEQUENCE) {
+      ++written_;
+      total_encode_ms_ += encode_ms;
+    }
+  }
+  if (sequence_.is_open()) {
+    EndSequence();
+  }
+}
+
+void FrameCapture::Encode(Job &job) {
+  switch (job.kind) {
+  case Kind::SCREENSHOT:
+    WriteScreenshot(job);
+    break;
+  case Kind::FRAME:
+    WriteFrame(job);
+    break;
+  case Kind::END_OF_SEQUENCE:
+    if (sequence_.is_open() && sequence_path_ == job.path) {
+      // The last frame stays until the end
+      RepeatFrame(job.time);
+      EndSequence();
+    }
+    break;
+  }
+}
+
+void FrameCapture::WriteScreenshot(Job &job) {
+  FlipRows(job.pixels, job.width, job.height);
+  // The alpha of the window is whatever the blending left, not coverage
+  for (std::size_t alpha = 3; alpha < job.pixels.size();
+       alpha += PIXEL_BYTES) {
+    job.pixels[alpha] = 0xFF;
+  }
+  const auto stride = job.width * static_cast<int>(PIXEL_BYTES);
+  if (stbi_write_png(job.path.string().c_str(), job.width, job.height,
+          static_cast<int>(PIXEL_BYTES), job.pixels.data(), stride) == 0) {
+    ASLOG(error, "could not write screenshot {}", job.path.string());
+    return;
+  }
+  ASLOG(info, "saved screenshot {} ({}x{})", job.path.string(), job.width,
+      job.height);
+}
+
+void FrameCapture::WriteFrame(const Job &job) {
+  if (sequence_path_ != job.path) {
+    if (sequence_.is_open()) {
+      EndSequence();
+    }
+    sequence_path_ = job.path;
+    sequence_frame_rate_ = job.frame_rate;
+    sequence_start_ = job.time;
+    sequence_written_ = 0;
+    sequence_repeated_ = 0;
+    sequence_skipped_ = 0;
+    sequence_.open(sequence_path_, std::ios::binary | std::ios::trunc);
+    // Full chroma resolution, the UI has a lot of thin colored lines
+    sequence_ << "YUV4MPEG2 W" << job.width << " H" << job.height << " F"
+              << job.frame_rate << ":1 Ip A1:1 C444\n";
+  }
+  if (!sequence_) {
+    ASLOG(error, "could not write frame sequence {}", sequence_path_.string());
+    return;
+  }
+  // Replaced by this one before its turn came
+  if (FrameIndex(sequence_start_, job.time, sequence_frame_rate_) <
+      sequence_written_) {
+    ++sequence_skipped_;
+    return;
+  }
+  RepeatFrame(job.time);
+
+  // BT.601 studio range, the planes one after the other, top row first
+  const auto pixels = static_cast<std::size_t>(job.width) *
+                      static_cast<std::size_t>(job.height);
+  planes_.resize(pixels * 3);
+  auto *luma = planes_.data();
+  auto *blue = luma + pixels;
+  auto *red = blue + pixels;
+  const auto stride = static_cast<std::size_t>(job.width) * PIXEL_BYTES;
+  for (int row = 0; row < job.height; ++row) {
+    const auto *source = job.pixels.data() +
+                         static_cast<std::size_t>(job.height - 1 - row) *
+                             stride;
+    for (int column = 0; column < job.width; ++column, source += PIXEL_BYTES) {
+      const int r = source[0];
+      const int g = source[1];
+      const int b = source[2];
+      // NOLINTBEGIN(readability-magic-numbers)
+      *luma++ =
+          static_cast<std::uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) +
+                                    16);
+      *blue++ = static_cast<std::uint8_t>(
+          ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+      *red++ = static_cast<std::uint8_t>(
+          ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+      // NOLINTEND(readability-magic-numbers)
+    }
+  }
+  sequence_ << "FRAME\n";
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  sequence_.write(reinterpret_cast<const char *>(planes_.data()),
+      static_cast<std::streamsize>(planes_.size()));
+  ++sequence_written_;
+}
+
+void FrameCapture::RepeatFrame(Clock::time_point time) {
+  if (sequence_written_ == 0 || !sequence_) {
+    return;
+  }
+  const auto until = FrameIndex(sequence_start_, time, sequence_frame_rate_);
+  while (sequence_written_ < until) {
+    sequence_ << "FRAME\n";
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    sequence_.write(reinterpret_cast<const char *>(planes_.data()),
+        static_cast<std::streamsize>(planes_.size()));
+    ++sequence_written_;
+    ++sequence_repeated_;
+  }
+}
+
+void FrameCapture::EndSequence() {
+  sequence_.close();
+  ASLOG(debug,
+      "wrote {} frames to {} at {} fps, {} repeated and {} skipped to keep "
+      "the timing",
+      sequence_written_, sequence_path_.string(), sequence_frame_rate_,
+      sequence_repeated_, sequence_skipped_);
+  sequence_path_.clear();
+}
+
+} // namespace asap::app
@@ -0,0 +1,209 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <glad/gl.h>
+#include <logging/logging.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace asap::app {
+
+/*!
+ * \brief Screenshots and frame sequences of the window, without stalling the
+ * rendering.
+ *
+ * Capture() is called after each frame is rendered, before the buffers are
+ * swapped. When a frame is wanted, it is read with glReadPixels into one of a
+ * small ring of pixel buffer objects, which returns without waiting for GL. A
+ * fence marks when the copy is done: the buffer is mapped in a later frame,
+ * usually the next one or the one after, and its pixels handed to a
+ * background thread. That thread writes screenshots as PNG, and sequences as
+ * a raw YUV4MPEG2 (Y4M) stream that video tools read directly.
+ *
+ * The frames of a sequence are timestamped when captured and written on the
+ * fixed clock of the sequence's frame rate: a frame is repeated for as long as
+ * it stayed on the screen, and a frame replaced before its turn is skipped.
+ * The video plays at the speed it was recorded, whatever the actual frame
+ * rate of the application, with or without vsync, idle pacing or drops.
+ *
+ * Frames are dropped rather than waited for, when all the pixel buffers are
+ * still in use or too many frames wait for the encoder. The time spent in
+ * Capture() is measured for each captured frame and reported in the stats and
+ * in the log when a sequence ends.
+ *
+ * Must be used from the UI thread, and cleared while the OpenGL context is
+ * still alive.
+ */
+class FrameCapture : public asap::logging::Loggable<FrameCapture> {
+public:
+  /// Frame rate of the recordings when not given.
+  static constexpr int DEFAULT_FRAME_RATE = 60;
+
+  struct Stats {
+    bool recording{false};
+    /// Frames read back since the start of the application.
+    std::size_t captured{0};
+    std::size_t written{0};
+    /// Frames not captured or not written, to avoid a stall.
+    std::size_t dropped{0};
+    /// Frames waiting for the encoder.
+    std::size_t queued{0};
+    /// Time spent in Capture() in the last captured frame, on the UI thread.
+    double last_overhead_ms{0};
+    /// Average and worst time spent in Capture() per captured frame.
+    double average_overhead_ms{0};
+    double max_overhead_ms{0};
+    /// Frames between the readback of a frame and its mapping.
+    double average_latency_frames{0};
+    /// Average time to encode and write a frame, on the encoder thread.
+    double average_encode_ms{0};
+  };
+
+  FrameCapture();
+
+  FrameCapture(const FrameCapture &) = delete;
+  FrameCapture(FrameCapture &&) = delete;
+  auto operator=(const FrameCapture &) -> FrameCapture & = delete;
+  auto operator=(FrameCapture &&) -> FrameCapture & = delete;
+
+  /// Write the frames already captured and stop the encoder thread.
+  ~FrameCapture();
+
+  /// Save a frame as a PNG image: the next one, or the one after
+  /// `skip_frames` more, to leave out the menu the screenshot was taken from.
+  void Screenshot(std::filesystem::path path, int skip_frames = 0);
+  /// Save all the frames from the next one as a Y4M video, of `frame_rate`
+  /// frames per second, until StopRecording(). The window must keep its size.
+  void StartRecording(
+      std::filesystem::path path, int frame_rate = DEFAULT_FRAME_RATE);
+  void StopRecording();
+  [[nodiscard]] auto IsRecording() const -> bool {
+    return recording_;
+  }
+
+  /// Read back the `width` x `height` default framebuffer if a frame is
+  /// wanted, and hand the frames read back earlier to the encoder.
+  void Capture(int width, int height);
+
+  /// Drop the pending readbacks and release the pixel buffers.
+  void Clear();
+
+  [[nodiscard]] auto GetStats() const -> Stats;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Kind { SCREENSHOT, FRAME, END_OF_SEQUENCE };
+
+  /// A frame for the encoder, or the end of a sequence.
+  struct Job {
+    Kind kind{Kind::SCREENSHOT};
+    std::filesystem::path path;
+    int width{0};
+    int height{0};
+    int frame_rate{0};
+    /// When the frame was presented, or when the sequence ended.
+    Clock::time_point time;
+    /// RGBA, bottom row first as read by GL.
+    std::vector<std::uint8_t> pixels;
+  };
+
+  /// A pixel buffer of the ring, and the frame read into it.
+  struct Readback {
+    GLuint buffer{0};
+    std::size_t capacity{0};
+    /// Set while GL may still write the buffer.
+    GLsync fence{nullptr};
+    int frame{0};
+    Clock::time_point time;
+    int width{0};
+    int height{0};
+    /// Where to save the frame as a screenshot, if it is one.
+    std::filesystem::path screenshot;
+    /// Where to append the frame, if it belongs to a sequence.
+    std::filesystem::path sequence;
+    int frame_rate{0};
+    /// The last frame of its sequence, and when the sequence ended.
+    bool end_of_sequence{false};
+    Clock::time_point end_time;
+  };
+
+  /// Map the readbacks GL is done with, oldest first.
+  void CollectReadbacks();
+  void Queue(Job job);
+  void Run();
+  void Encode(Job &job);
+  void WriteScreenshot(Job &job);
+  void WriteFrame(const Job &job);
+  /// Repeat the last frame written until the frame of the sequence shown at
+  /// `time`, excluded.
+  void RepeatFrame(Clock::time_point time);
+  void EndSequence();
+
+  std::vector<Readback> ring_;
+  /// Next slot of the ring to read back into, and oldest one to map.
+  std::size_t next_{0};
+  std::size_t oldest_{0};
+  std::size_t in_flight_{0};
+  int frame_{0};
+
+  std::filesystem::path screenshot_;
+  int screenshot_skip_{0};
+  bool recording_{false};
+  std::filesystem::path recording_path_;
+  int recording_frame_rate_{0};
+  int recording_width_{0};
+  int recording_height_{0};
+
+  std::size_t captured_{0};
+  std::size_t dropped_{0};
+  double last_overhead_ms_{0};
+  double total_overhead_ms_{0};
+  double max_overhead_ms_{0};
+  std::size_t latency_frames_{0};
+  std::size_t mapped_{0};
+  /// Per sequence, reported when it ends.
+  std::size_t sequence_frames_{0};
+  std::size_t sequence_dropped_{0};
+  double sequence_overhead_ms_{0};
+  double sequence_max_overhead_ms_{0};
+
+  std::thread encoder_;
+  mutable std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_{false};
+  std::deque<Job> jobs_;
+  std::size_t written_{0};
+  std::size_t encoder_dropped_{0};
+  double total_encode_ms_{0};
+  /// Only used by the encoder thread.
+  std::ofstream sequence_;
+  std::filesystem::path sequence_path_;
+  int sequence_frame_rate_{0};
+  Clock::time_point sequence_start_;
+  /// Frames of the video written so far, repeated ones included.
+  std::size_t sequence_written_{0};
+  std::size_t sequence_repeated_{0};
+  std::size_t sequence_skipped_{0};
+  /// The last frame written, as Y4M planes.
+  std::vector<std::uint8_t> planes_;
+};
+
+} // namespace asap::app
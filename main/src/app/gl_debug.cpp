@@ -0,0 +1,309 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "app/gl_debug.h"
+
+#if defined(ASAP_GL_DEBUG)
+
+#include <glad/gl_capabilities.h>
+
+#include <algorithm> // for std::search
+#include <cctype>    // for case insensitive search
+#include <chrono>    // for the report interval
+#include <cstring>   // for std::strlen
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility> // for std::move
+#include <vector>
+
+namespace asap::app {
+
+const char *const GlDebugOutput::LOGGER_NAME = "gl";
+
+namespace {
+
+// KHR_debug is GL 4.3, its entry points and enums are not in the GL 3.2 core
+// glad loader.
+using DebugMessageCallbackProc = void(GLAD_API_PTR *)(
+    GLDEBUGPROC callback, const void *user_param);
+using DebugMessageControlProc = void(GLAD_API_PTR *)(GLenum source,
+    GLenum type, GLenum severity, GLsizei count, const GLuint *ids,
+    GLboolean enabled);
+
+constexpr GLenum DEBUG_OUTPUT = 0x92E0;
+constexpr GLenum DEBUG_OUTPUT_SYNCHRONOUS = 0x8242;
+constexpr GLint CONTEXT_FLAG_DEBUG_BIT = 0x0002;
+
+constexpr GLenum SOURCE_API = 0x8246;
+constexpr GLenum SOURCE_WINDOW_SYSTEM = 0x8247;
+constexpr GLenum SOURCE_SHADER_COMPILER = 0x8248;
+constexpr GLenum SOURCE_THIRD_PARTY = 0x8249;
+constexpr GLenum SOURCE_APPLICATION = 0x824A;
+
+constexpr GLenum TYPE_ERROR = 0x824C;
+constexpr GLenum TYPE_DEPRECATED_BEHAVIOR = 0x824D;
+constexpr GLenum TYPE_UNDEFINED_BEHAVIOR = 0x824E;
+constexpr GLenum TYPE_PORTABILITY = 0x824F;
+constexpr GLenum TYPE_PERFORMANCE = 0x8250;
+constexpr GLenum TYPE_MARKER = 0x8268;
+constexpr GLenum TYPE_PUSH_GROUP = 0x8269;
+constexpr GLenum TYPE_POP_GROUP = 0x826A;
+
+constexpr GLenum SEVERITY_HIGH = 0x9146;
+constexpr GLenum SEVERITY_MEDIUM = 0x9147;
+constexpr GLenum SEVERITY_LOW = 0x9148;
+constexpr GLenum SEVERITY_NOTIFICATION = 0x826B;
+
+/// Repeated messages are reported at most this often.
+constexpr auto REPORT_INTERVAL = std::chrono::seconds(1);
+/// Distinct messages aggregated, the next ones are logged every time.
+constexpr std::size_t MAX_AGGREGATED = 256;
+/// glGetError() returns one error flag per call, there are only a few.
+constexpr int MAX_ERROR_FLAGS = 8;
+
+/// Drivers don't always file their performance warnings in the performance
+/// category, these words give them away.
+constexpr std::string_view PERFORMANCE_WORDS[] = {"stall", "recompil"};
+
+auto SourceName(GLenum source) -> const char * {
+  switch (source) {
+  case SOURCE_API:
+    return "api";
+  case SOURCE_WINDOW_SYSTEM:
+    return "window system";
+  case SOURCE_SHADER_COMPILER:
+    return "shader compiler";
+  case SOURCE_THIRD_PARTY:
+    return "third party";
+  case SOURCE_APPLICATION:
+    return "application";
+  default:
+    return "other";
+  }
+}
+
+auto TypeTag(GLenum type) -> const char * {
+  switch (type) {
+  case TYPE_ERROR:
+    return "error";
+  case TYPE_DEPRECATED_BEHAVIOR:
+    return "deprecated";
+  case TYPE_UNDEFINED_BEHAVIOR:
+    return "undefined";
+  case TYPE_PORTABILITY:
+    return "portability";
+  case TYPE_PERFORMANCE:
+    return "perf";
+  case TYPE_MARKER:
+  case TYPE_PUSH_GROUP:
+  case TYPE_POP_GROUP:
+    return "marker";
+  default:
+    return "other";
+  }
+}
+
+auto IsPerformanceMessage(GLenum type, std::string_view message) -> bool {
+  if (type == TYPE_PERFORMANCE) {
+    return true;
+  }
+  const auto same_letter = [](char lhs, char rhs) {
+    return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+  };
+  return std::any_of(std::begin(PERFORMANCE_WORDS),
+      std::end(PERFORMANCE_WORDS), [&](std::string_view word) {
+        return std::search(message.begin(), message.end(), word.begin(),
+                   word.end(), same_letter) != message.end();
+      });
+}
+
+auto Level(GLenum type, GLenum severity) -> spdlog::level::level_enum {
+  if (type == TYPE_ERROR) {
+    return spdlog::level::err;
+  }
+  switch (severity) {
+  case SEVERITY_HIGH:
+    return spdlog::level::err;
+  case SEVERITY_MEDIUM:
+    return spdlog::level::warn;
+  case SEVERITY_LOW:
+    return spdlog::level::info;
+  default:
+    return spdlog::level::debug;
+  }
+}
+
+struct Aggregate {
+  std::string message;
+  spdlog::level::level_enum level;
+  /// Occurrences since the message was last reported.
+  unsigned int repeats;
+};
+
+/// Some drivers use the same id for different messages (all the invalid enum
+/// errors, ...), the text tells them apart.
+using MessageKey = std::tuple<GLenum, GLenum, GLuint, std::string>;
+
+/// Shared with the driver threads calling back.
+struct State {
+  std::mutex mutex;
+  /// The messages seen, by source, type, id and text.
+  std::map<MessageKey, Aggregate> messages;
+  bool repeated{false};
+  std::chrono::steady_clock::time_point last_report;
+
+  // Only used by the thread owning the context
+  DebugMessageCallbackProc set_callback{nullptr};
+};
+
+auto TheState() -> State & {
+  static State state;
+  return state;
+}
+
+auto Logger() -> spdlog::logger & {
+  static auto &logger =
+      asap::logging::Registry::GetLogger(GlDebugOutput::LOGGER_NAME);
+  return logger;
+}
+
+/// Log the repeated messages, unless they were reported less than
+/// REPORT_INTERVAL ago and `force` is false.
+void ReportRepeats(bool force) {
+  auto &state = TheState();
+  std::vector<Aggregate> reports;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.repeated) {
+      return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && now - state.last_report < REPORT_INTERVAL) {
+      return;
+    }
+    state.last_report = now;
+    state.repeated = false;
+    for (auto &entry : state.messages) {
+      auto &aggregate = entry.second;
+      if (aggregate.repeats != 0) {
+        reports.push_back(aggregate);
+        aggregate.repeats = 0;
+      }
+    }
+  }
+  // Log without holding the lock, the driver may be calling back meanwhile
+  for (const auto &report : reports) {
+    Logger().log(report.level, "{} (repeated {}x)", report.message,
+        report.repeats);
+  }
+}
+
+void GLAD_API_PTR OnMessage(GLenum source, GLenum type, GLuint id,
+    GLenum severity, GLsizei length, const GLchar *text,
+    const void * /*user_param*/) {
+  const std::string_view raw(text, length >= 0
+                                       ? static_cast<std::size_t>(length)
+                                       : std::strlen(text));
+  const auto *tag = IsPerformanceMessage(type, raw) ? "perf" : TypeTag(type);
+  const auto level = Level(type, severity);
+
+  auto &state = TheState();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto key = MessageKey(source, type, id, raw);
+    const auto seen = state.messages.find(key);
+    if (seen != state.messages.end()) {
+      ++seen->second.repeats;
+      state.repeated = true;
+      return;
+    }
+    if (state.messages.size() < MAX_AGGREGATED) {
+      state.messages.emplace(std::move(key),
+          Aggregate{fmt::format("[{}] {} {}: {}", tag, SourceName(source), id,
+                        raw),
+              level, 0});
+    }
+  }
+  Logger().log(level, "[{}] {} {}: {}", tag, SourceName(source), id, raw);
+}
+
+} // namespace
+
+auto GlDebugOutput::Enable(GLADloadfunc load) -> bool {
+  if (!asap::gl::GetCapabilities().DebugOutput) {
+    ASLOG(debug, "  no GL debug output in this context");
+    return false;
+  }
+  // The desktop GL entry points have no KHR suffix
+  auto *set_callback = reinterpret_cast<DebugMessageCallbackProc>(
+      load("glDebugMessageCallback"));
+  auto *control = reinterpret_cast<DebugMessageControlProc>(
+      load("glDebugMessageControl"));
+  if (set_callback == nullptr || control == nullptr) {
+    ASLOG(warn, "  failed to load the GL debug output entry points");
+    return false;
+  }
+
+  GLint flags = 0;
+  glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+  if ((flags & CONTEXT_FLAG_DEBUG_BIT) == 0) {
+    ASLOG(debug, "  not a debug context, the driver may report less");
+  }
+
+  // The notifications are informational (where buffers are allocated, ...)
+  // and some drivers send them for every object.
+  control(GL_DONT_CARE, GL_DONT_CARE, SEVERITY_NOTIFICATION, 0, nullptr,
+      GL_FALSE);
+  set_callback(&OnMessage, nullptr);
+  // Let the driver call back when it likes, from any thread
+  glDisable(DEBUG_OUTPUT_SYNCHRONOUS);
+  glEnable(DEBUG_OUTPUT);
+
+  TheState().set_callback = set_callback;
+  ASLOG(info, "  GL debug output enabled");
+  return true;
+}
+
+void GlDebugOutput::Disable() {
+  auto &state = TheState();
+  if (state.set_callback == nullptr) {
+    return;
+  }
+  glDisable(DEBUG_OUTPUT);
+  state.set_callback(nullptr, nullptr);
+  state.set_callback = nullptr;
+  ReportRepeats(true);
+}
+
+auto GlDebugOutput::IsEnabled() -> bool {
+  return TheState().set_callback != nullptr;
+}
+
+void GlDebugOutput::Flush() {
+  ReportRepeats(false);
+}
+
+void GlDebugOutput::CheckError(const char *file, int line) {
+  // The errors are already reported by the debug output
+  if (IsEnabled()) {
+    return;
+  }
+  for (int flag = 0; flag < MAX_ERROR_FLAGS; ++flag) {
+    const auto code = glGetError();
+    if (code == GL_NO_ERROR) {
+      break;
+    }
+    ASLOG(error, "OpenGL error 0x{:04X} at {}:{}", code, file, line);
+  }
+}
+
+} // namespace asap::app
+
+#endif // ASAP_GL_DEBUG
@@ -0,0 +1,82 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Messages of the GL driver (KHR_debug), routed to the `gl` logger.
+ *
+ * Only compiled in when `ASAP_GL_DEBUG` is defined, which the build does for
+ * the Debug and RelWithDebInfo (profiling) configurations; the functions are
+ * empty otherwise. The driver calls back asynchronously, possibly from its own
+ * threads, and errors no longer need a synchronous glGetError() round-trip
+ * after each call.
+ *
+ * Identical messages are aggregated: the first occurrence is logged right
+ * away, the repetitions are counted and reported by Flush() at most once per
+ * second. Performance messages (buffer stalls, shader recompiles, ...) are
+ * tagged with `[perf]` so they stand out in the log view.
+ *
+ * `ASAP_GL_CHECK()` polls glGetError() in debug builds where the context has
+ * no debug output, and compiles to nothing in release builds.
+ */
+
+#pragma once
+
+#include <glad/gl.h>
+#include <logging/logging.h>
+
+namespace asap::app {
+
+#if defined(ASAP_GL_DEBUG)
+
+class GlDebugOutput : public asap::logging::Loggable<GlDebugOutput> {
+public:
+  static const char *const LOGGER_NAME;
+
+  /// Enable the debug output of the current context, loading the entry points
+  /// that are not in the glad loader with `load`. Return false when the
+  /// context doesn't support it.
+  static auto Enable(GLADloadfunc load) -> bool;
+  /// Stop receiving messages, before the context is destroyed.
+  static void Disable();
+  static auto IsEnabled() -> bool;
+
+  /// Log how many times the aggregated messages were repeated since they were
+  /// last reported. Cheap when there is nothing to report, to be called once
+  /// per frame.
+  static void Flush();
+
+  /// Log the pending GL error, if any, as coming from `file`:`line`.
+  static void CheckError(const char *file, int line);
+};
+
+#define ASAP_GL_CHECK()                                                        \
+  asap::app::GlDebugOutput::CheckError(__FILE__, __LINE__)
+
+#else
+
+/// Release builds: no debug output, and nothing to call per frame.
+class GlDebugOutput {
+public:
+  static auto Enable(GLADloadfunc /*load*/) -> bool {
+    return false;
+  }
+  static void Disable() {
+  }
+  static auto IsEnabled() -> bool {
+    return false;
+  }
+  static void Flush() {
+  }
+};
+
+#define ASAP_GL_CHECK() ((void)0)
+
+#endif
+
+} // namespace asap::app
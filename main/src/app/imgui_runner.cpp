@@ -7,23 +7,32 @@
 
 #include "app/imgui_runner.h"
 #include "app/application.h"
+#include "app/gl_debug.h"
 #include "config/config.h"
+#include "config/config_store.h"
+#include "ui/style/theme.h"
+#include "ui/textures/texture_manager.h"
 
 // clang-format off
 // Include order is important
 #include <glad/gl.h>
+#include <glad/gl_capabilities.h>
+#include <glad/gl_state.h>
+#include <glad/gl_trace.h>
 #include <GLFW/glfw3.h>
 
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_glfw.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
+#include <backends/imgui_impl_opengl3_stream.h>
 // clang-format on
 
-#include <chrono> // for sleep timeout
+#include <algorithm> // for std::max
+#include <chrono>    // for sleep timeout
 #include <contract/contract.h>
 #include <csignal> // for signal handling
-#include <fstream>
 #include <gsl/span>
+#include <sstream> // for serializing the settings
 #include <thread> // for access to this thread
 #include <toml++/toml.hpp>
 #include <utility>
@@ -35,6 +44,46 @@ void glfw_error_callback(int error, const char *description) {
   ASLOG_TO_LOGGER(logger, critical, "Glfw Error {}: {}", error, description);
 }
 
+/// The window moved to a monitor with a different DPI, or its scale setting
+/// changed: rebuild the fonts for the new scale.
+void glfw_content_scale_callback(
+    GLFWwindow * /*window*/, float xscale, float /*yscale*/) {
+  asap::ui::Theme::SetContentScale(xscale);
+}
+
+using asap::config::Key;
+using asap::config::Location;
+
+const Key<std::string> DISPLAY_TITLE{
+    Location::F_DISPLAY_SETTINGS, "display.title", "ASAP Application"};
+const Key<std::string> DISPLAY_MODE{
+    Location::F_DISPLAY_SETTINGS, "display.mode", "Full Screen Windowed"};
+const Key<int> DISPLAY_MONITOR{
+    Location::F_DISPLAY_SETTINGS, "display.monitor", 0};
+const Key<int> DISPLAY_WIDTH{
+    Location::F_DISPLAY_SETTINGS, "display.size.width", 800};
+const Key<int> DISPLAY_HEIGHT{
+    Location::F_DISPLAY_SETTINGS, "display.size.height", 600};
+const Key<int> DISPLAY_REFRESH_RATE{
+    Location::F_DISPLAY_SETTINGS, "display.refresh-rate", 0};
+const Key<int> DISPLAY_MULTI_SAMPLING{
+    Location::F_DISPLAY_SETTINGS, "display.multi-sampling", -1};
+const Key<bool> DISPLAY_VSYNC{
+    Location::F_DISPLAY_SETTINGS, "display.vsync", true};
+const Key<int> DISPLAY_FRAME_RATE{Location::F_DISPLAY_SETTINGS,
+    "display.frame-rate", asap::app::ImGuiRunner::DEFAULT_FRAME_RATE};
+const Key<int> DISPLAY_IDLE_FRAME_RATE{Location::F_DISPLAY_SETTINGS,
+    "display.idle-frame-rate", asap::app::ImGuiRunner::DEFAULT_IDLE_FRAME_RATE};
+const Key<int> DISPLAY_TEXTURE_BUDGET{Location::F_DISPLAY_SETTINGS,
+    "display.texture-budget-mib",
+    static_cast<int>(asap::ui::TextureManager::DEFAULT_BUDGET >> 20U)};
+
+/// The texture budget setting is in MiB.
+void SetTextureBudget(int mib) {
+  asap::ui::TextureManager::Default().SetBudget(
+      static_cast<std::size_t>(std::max(mib, 1)) << 20U);
+}
+
 volatile std::sig_atomic_t gSignalInterrupt_;
 
 void SignalHandler(int signal) {
@@ -82,6 +131,10 @@ void ImGuiRunner::InitGraphics() {
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // 3.2+ only
   glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);           // 3.0+ only
 #endif
+#if defined(ASAP_GL_DEBUG)
+  // Drivers report more through the debug output of a debug context
+  glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+#endif
 
   ASLOG(debug, "  GLFW init done");
 }
@@ -94,6 +147,32 @@ void ImGuiRunner::SetupContext() {
     ASLOG(error, "  failed to initialize OpenGL context!");
     throw std::runtime_error("failed to initialize OpenGL context");
   }
+  // No-op unless built with ASAP_IMGUI_GL_TRACE
+  asap::gl::trace::Install();
+
+  // Select the rendering paths from what the driver actually offers
+  asap::gl::ProbeCapabilities(static_cast<GLADloadfunc>(glfwGetProcAddress));
+  const auto &caps = asap::gl::GetCapabilities();
+  const auto &paths = asap::gl::GetFastPaths();
+  const auto yes_no = [](bool value) { return value ? "yes" : "no"; };
+  ASLOG(info, "  OpenGL {}.{} on {}", caps.Major, caps.Minor,
+      reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+  ASLOG(debug,
+      "  buffer storage: {}, direct state access: {}, multi-draw indirect: {}, "
+      "parallel shader compile: {}, program binary: {}, timer queries: {}, "
+      "debug output: {}",
+      yes_no(caps.BufferStorage), yes_no(caps.DirectStateAccess),
+      yes_no(caps.MultiDrawIndirect), yes_no(caps.ParallelShaderCompile),
+      yes_no(caps.ProgramBinary), yes_no(caps.TimerQuery),
+      yes_no(caps.DebugOutput));
+  ASLOG(info,
+      "  fast paths: streamed geometry: {}, parallel shader compile: {}, "
+      "GPU timing: {}",
+      yes_no(paths.StreamGeometry), yes_no(paths.ParallelShaderCompile),
+      yes_no(paths.GpuTiming));
+
+  // Debug and profiling builds only
+  GlDebugOutput::Enable(static_cast<GLADloadfunc>(glfwGetProcAddress));
 
   ASLOG(debug, "  context setup done");
 }
@@ -126,6 +205,15 @@ void ImGuiRunner::InitImGui() {
 
   ImGui_ImplGlfw_InitForOpenGL(window_, true);
 
+  // Build the fonts for the content scale of the monitor the window is on, and
+  // follow the changes of scale
+  float xscale = 1.0F;
+  float yscale = 1.0F;
+  glfwGetWindowContentScale(window_, &xscale, &yscale);
+  ASLOG(debug, "  window content scale is {:.2f}x{:.2f}", xscale, yscale);
+  asap::ui::Theme::SetContentScale(xscale);
+  glfwSetWindowContentScaleCallback(window_, glfw_content_scale_callback);
+
   // Decide GLSL version
 #if __APPLE__
   // GLSL 150
@@ -135,6 +223,14 @@ void ImGuiRunner::InitImGui() {
   const char *glsl_version = "#version 130";
 #endif
   ImGui_ImplOpenGL3_Init(glsl_version);
+  // Render the main viewport through persistently mapped buffers when the
+  // context supports it
+  if (ImGui_ImplOpenGL3Stream_Init(
+          glsl_version, static_cast<GLADloadfunc>(glfwGetProcAddress))) {
+    ASLOG(debug, "  streaming the draw data through mapped buffers");
+  } else {
+    ASLOG(debug, "  no buffer storage, using the stock OpenGL3 renderer");
+  }
 
   ASLOG(debug, "  ImGui init done");
 }
@@ -271,13 +367,18 @@ void ImGuiRunner::CleanUp() {
   ASLOG(info, "Cleanup graphical subsystem...");
 
   // Cleanup ImGui
+  ASLOG(debug, "  release the textures");
+  asap::ui::TextureManager::Default().Clear();
+  frame_capture_.Clear();
   ASLOG(debug, "  shutdown OpenGL3");
+  ImGui_ImplOpenGL3Stream_Shutdown();
   ImGui_ImplOpenGL3_Shutdown();
   ASLOG(debug, "  shutdown ImGui/GLFW");
   ImGui_ImplGlfw_Shutdown();
   ASLOG(debug, "  destroy ImGui context");
   ImGui::DestroyContext();
 
+  GlDebugOutput::Disable();
   ASLOG(debug, "  destroy window");
   glfwDestroyWindow(window_);
   ASLOG(debug, "  terminate GLFW");
@@ -296,6 +397,15 @@ void ImGuiRunner::Run() {
   std::signal(SIGTERM, SignalHandler);
 
   app_.Init(this);
+  WatchSettings();
+  settings_watcher_.Start();
+  using Capture = asap::config::SettingsWriter::Capture;
+  auto &settings_writer = asap::config::SettingsWriter::Default();
+  // The autosave only writes the settings changed from the ones loaded
+  SaveSetting(Capture::LOADED);
+  app_.SaveSettings(Capture::LOADED);
+  settings_writer.SetAutosaveInterval(
+      asap::config::SettingsWriter::DEFAULT_AUTOSAVE_INTERVAL);
 
   // Main loop
   bool sleep_when_inactive = true;
@@ -303,9 +413,9 @@ void ImGuiRunner::Run() {
     static float wanted_fps;
     if (sleep_when_inactive &&
         (glfwGetWindowAttrib(window_, GLFW_FOCUSED) == 0)) {
-      wanted_fps = 20.0F;
+      wanted_fps = static_cast<float>(idle_frame_rate_);
     } else {
-      wanted_fps = 90.0F;
+      wanted_fps = static_cast<float>(frame_rate_);
     }
     float current_fps = ImGui::GetIO().Framerate;
     float frame_time = 1000 / current_fps;
@@ -332,7 +442,29 @@ void ImGuiRunner::Run() {
       continue;
     }
 
+    // Apply the settings reloaded in the background since the last frame
+    settings_watcher_.ApplyPending();
+
+    // Switch the theme preset selected during the last frame, or continue
+    // fading its colors in
+    asap::ui::Theme::UpdateStyle();
+
+    // Install the fonts rebuilt in the background for a new content scale.
+    // The fonts are rasterized at the pixel size; where the window coordinates
+    // are not in pixels (macOS), scale them back to the window coordinates.
+    if (asap::ui::Theme::SwapFonts()) {
+      ImGui_ImplOpenGL3_DestroyFontsTexture();
+      ImGui_ImplOpenGL3_CreateFontsTexture();
+      asap::gl::InvalidateState();
+    }
+    UpdateFontScale();
+
+    // Evict the textures over budget and continue the pending uploads
+    asap::ui::TextureManager::Default().Update();
+
     // Start the ImGui frame
+    asap::gl::NewFrame();
+    asap::gl::trace::NewFrame();
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
@@ -346,10 +478,13 @@ void ImGuiRunner::Run() {
     int display_h = 0;
     glfwMakeContextCurrent(window_);
     glfwGetFramebufferSize(window_, &display_w, &display_h);
-    glViewport(0, 0, display_w, display_h);
+    asap::gl::BindFramebuffer(GL_FRAMEBUFFER, 0);
+    asap::gl::Viewport(0, 0, display_w, display_h);
+    // The renderer leaves the scissor test on, it would clip the clear
+    asap::gl::Disable(GL_SCISSOR_TEST);
     glClearColor(0, 0, 0, 255);
     glClear(GL_COLOR_BUFFER_BIT);
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    ImGui_ImplOpenGL3Stream_RenderDrawData(ImGui::GetDrawData());
 
     // Update and Render additional Platform Windows
     if ((ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0) {
@@ -358,18 +493,48 @@ void ImGuiRunner::Run() {
     }
 
     glfwMakeContextCurrent(window_);
+    // Read back the frame before it is presented, if it is being captured
+    frame_capture_.Capture(display_w, display_h);
     glfwSwapBuffers(window_);
+    // Report the GL messages repeated during the last second
+    GlDebugOutput::Flush();
+
+    // Capture the settings now and then, they are written in the background
+    if (settings_writer.AutosaveDue()) {
+      SaveSetting(Capture::AUTOSAVE);
+      app_.SaveSettings(Capture::AUTOSAVE);
+    }
   }
 
+  // Don't reload the settings saved on the way out
+  settings_watcher_.Stop();
   SaveSetting();
 
   app_.ShutDown();
+  // All the settings are on the disk before leaving
+  settings_writer.Flush();
   CleanUp();
 }
+void ImGuiRunner::UpdateFontScale() {
+  int window_w = 0;
+  int window_h = 0;
+  int framebuffer_w = 0;
+  int framebuffer_h = 0;
+  glfwGetWindowSize(window_, &window_w, &window_h);
+  glfwGetFramebufferSize(window_, &framebuffer_w, &framebuffer_h);
+  if (window_w > 0 && framebuffer_w > 0) {
+    ImGui::GetIO().FontGlobalScale =
+        static_cast<float>(window_w) / static_cast<float>(framebuffer_w);
+  }
+}
 void ImGuiRunner::EnableVsync(bool state) {
   glfwSwapInterval(state ? 1 : 0);
   vsync_ = state;
 }
+void ImGuiRunner::FramePacing(int frame_rate, int idle_frame_rate) {
+  frame_rate_ = std::max(frame_rate, 1);
+  idle_frame_rate_ = std::max(idle_frame_rate, 1);
+}
 void ImGuiRunner::MultiSample(int samples) {
   if (samples < 0 || samples > 4) {
     samples = GLFW_DONT_CARE;
@@ -429,71 +594,37 @@ auto ImGuiRunner::GetMonitorId() const -> int {
 // -------------------------------------------------------------------------
 
 void ImGuiRunner::LoadSetting() {
-  toml::parse_result config;
-  auto display_settings =
-      asap::config::GetPathFor(asap::config::Location::F_DISPLAY_SETTINGS);
-  auto has_config = false;
-  if (std::filesystem::exists(display_settings)) {
-    try {
-      config = toml::parse_file(display_settings.string());
-      ASLOG(info, "display settings loaded from {}", display_settings.string());
-      has_config = true;
-    } catch (std::exception const &ex) {
-      ASLOG(error, "error {} while loading settings from {}", ex.what(),
-          display_settings.string());
-    }
-  } else {
-    ASLOG(info, "file {} does not exist", display_settings.string());
+  auto &store = asap::config::ConfigStore::Default();
+  if (!store.Contains(Location::F_DISPLAY_SETTINGS)) {
+    Windowed(DISPLAY_WIDTH.default_value, DISPLAY_HEIGHT.default_value,
+        DISPLAY_TITLE.default_value);
+    return;
   }
-
-  constexpr int DEFAULT_WINDOW_WIDTH = 800;
-  constexpr int DEFAULT_WINDOW_HEIGHT = 600;
-
-  int width = DEFAULT_WINDOW_WIDTH;
-  int height = DEFAULT_WINDOW_HEIGHT;
-  if (has_config) {
-    auto display = config["display"];
-    auto multiSampling = display["multi-sampling"];
-    if (multiSampling) {
-      MultiSample(multiSampling.value_or<int>(1));
-    }
-    auto mode = display["mode"].value_or<std::string>("Full Screen Windowed");
-    if (mode == "Full Screen") {
-      auto size = display["size"];
-      if (size) {
-        if (size["width"]) {
-          width = *(size[width].value<int>());
-        }
-        if (size["height"]) {
-          height = *(size[height].value<int>());
-        }
-      }
-      FullScreen(width, height, display["title"].value_or("ASAP Application"),
-          display["monitor"].value_or(0), display["refresh-rate"].value_or(0));
-    } else if (mode == "Full Screen Windowed") {
-      FullScreenWindowed(display["title"].value_or("ASAP Application"),
-          display["monitor"].value_or(0));
-    } else if (mode == "Windowed") {
-      auto size = display["size"];
-      if (size) {
-        if (size["width"]) {
-          width = *(size["width"].value<int>());
-        }
-        if (size["height"]) {
-          height = *(size["height"].value<int>());
-        }
-      }
-      Windowed(width, height, display["title"].value_or("ASAP Application"));
-    } else {
-      Windowed(width, height, "ASAP Application");
-    }
-    EnableVsync(display["vsync"].value_or(0));
+  ASLOG(info, "display settings loaded from {}",
+      asap::config::GetPathFor(Location::F_DISPLAY_SETTINGS).string());
+
+  MultiSample(store.Get(DISPLAY_MULTI_SAMPLING));
+  const auto mode = store.Get(DISPLAY_MODE);
+  const auto title = store.Get(DISPLAY_TITLE);
+  if (mode == "Full Screen") {
+    FullScreen(store.Get(DISPLAY_WIDTH), store.Get(DISPLAY_HEIGHT), title,
+        store.Get(DISPLAY_MONITOR), store.Get(DISPLAY_REFRESH_RATE));
+  } else if (mode == "Full Screen Windowed") {
+    FullScreenWindowed(title, store.Get(DISPLAY_MONITOR));
+  } else if (mode == "Windowed") {
+    Windowed(store.Get(DISPLAY_WIDTH), store.Get(DISPLAY_HEIGHT), title);
   } else {
-    Windowed(width, height, "ASAP Application");
+    Windowed(DISPLAY_WIDTH.default_value, DISPLAY_HEIGHT.default_value,
+        DISPLAY_TITLE.default_value);
   }
+  EnableVsync(store.Get(DISPLAY_VSYNC));
+  FramePacing(
+      store.Get(DISPLAY_FRAME_RATE), store.Get(DISPLAY_IDLE_FRAME_RATE));
+  SetTextureBudget(store.Get(DISPLAY_TEXTURE_BUDGET));
 }
 
-void ImGuiRunner::SaveSetting() const {
+void ImGuiRunner::SaveSetting(
+    asap::config::SettingsWriter::Capture capture) const {
   toml::table display_settings;
   display_settings.insert("title", GetWindowTitle());
   if (IsFullScreen()) {
@@ -526,16 +657,48 @@ void ImGuiRunner::SaveSetting() const {
   }
   display_settings.insert("multi-sampling", MultiSample());
   display_settings.insert("vsync", Vsync());
+  display_settings.insert("frame-rate", FrameRate());
+  display_settings.insert("idle-frame-rate", IdleFrameRate());
+  display_settings.insert("texture-budget-mib",
+      static_cast<int>(asap::ui::TextureManager::Default().GetBudget() >> 20U));
 
   toml::table root;
   root.insert("display", display_settings);
 
-  auto settings_path =
-      asap::config::GetPathFor(asap::config::Location::F_DISPLAY_SETTINGS);
-  auto ofs = std::ofstream();
-  ofs.open(settings_path.string());
-  ofs << root << std::endl;
-  ofs.close();
+  // Serialized and written in the background
+  asap::config::SettingsWriter::Default().Write(
+      asap::config::Location::F_DISPLAY_SETTINGS, [root = std::move(root)]() {
+        std::ostringstream contents;
+        contents << root << std::endl;
+        return contents.str();
+      },
+      capture);
+}
+
+void ImGuiRunner::WatchSettings() {
+  // Only the settings that can change without re-creating the window are
+  // reloaded: vsync, frame pacing and the texture budget.
+  settings_watcher_.Watch(Location::F_DISPLAY_SETTINGS,
+      [this](const std::filesystem::path &file)
+          -> asap::config::SettingsWatcher::Update {
+        const auto settings = asap::config::ConfigStore::Parse(file);
+        return [this, vsync = DISPLAY_VSYNC.In(settings),
+                   rate = DISPLAY_FRAME_RATE.In(settings),
+                   idle_rate = DISPLAY_IDLE_FRAME_RATE.In(settings),
+                   budget = DISPLAY_TEXTURE_BUDGET.In(settings)]() {
+          if (vsync != Vsync()) {
+            EnableVsync(vsync);
+            ASLOG(info, "vsync {}", vsync ? "enabled" : "disabled");
+          }
+          if (rate != FrameRate() || idle_rate != IdleFrameRate()) {
+            FramePacing(rate, idle_rate);
+            ASLOG(info, "frame rate limited to {} fps ({} fps when idle)",
+                FrameRate(), IdleFrameRate());
+          }
+          SetTextureBudget(budget);
+          SaveSetting(asap::config::SettingsWriter::Capture::LOADED);
+        };
+      });
 }
 
 } // namespace asap::app
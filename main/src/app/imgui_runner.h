@@ -8,6 +8,9 @@
 #pragma once
 
 #include "app/application.h"
+#include "app/frame_capture.h"
+#include "config/settings_watcher.h"
+#include "config/settings_writer.h"
 #include <logging/logging.h>
 
 #include <functional> // for std::function
@@ -38,7 +41,9 @@ public:
   auto operator=(const ImGuiRunner &&) -> ImGuiRunner & = delete;
 
   void LoadSetting();
-  void SaveSetting() const;
+  /// Queue the display settings for writing, see `config::SettingsWriter`.
+  void SaveSetting(asap::config::SettingsWriter::Capture capture =
+                       asap::config::SettingsWriter::Capture::SAVE) const;
 
   void Windowed(int width, int height, const std::string &title);
   void FullScreenWindowed(const std::string &title, int monitor);
@@ -46,6 +51,9 @@ public:
       int refresh_rate);
 
   void EnableVsync(bool state = true);
+  /// Limit the frame rate to `frame_rate`, or to `idle_frame_rate` when the
+  /// window is not focused and the application allows it.
+  void FramePacing(int frame_rate, int idle_frame_rate);
   void MultiSample(int samples);
   void SetWindowTitle(const std::string &title);
 
@@ -70,11 +78,33 @@ public:
   [[nodiscard]] auto MultiSample() const -> int {
     return samples_;
   }
+  [[nodiscard]] auto FrameRate() const -> int {
+    return frame_rate_;
+  }
+  [[nodiscard]] auto IdleFrameRate() const -> int {
+    return idle_frame_rate_;
+  }
+
+  /// Reloads the settings files changed while running. Register the settings
+  /// to watch in `Application::Init()`.
+  auto GetSettingsWatcher() -> asap::config::SettingsWatcher & {
+    return settings_watcher_;
+  }
+
+  /// Screenshots and recordings of the window, read back after each frame.
+  auto GetFrameCapture() -> FrameCapture & {
+    return frame_capture_;
+  }
+
+  static constexpr int DEFAULT_FRAME_RATE = 90;
+  static constexpr int DEFAULT_IDLE_FRAME_RATE = 20;
 
 private:
   static void InitGraphics();
   void SetupContext();
   void InitImGui();
+  void UpdateFontScale();
+  void WatchSettings();
   void CleanUp();
 
   GLFWwindow *window_{nullptr};
@@ -85,6 +115,11 @@ private:
 
   bool vsync_{true};
   int samples_{-1};
+  int frame_rate_{DEFAULT_FRAME_RATE};
+  int idle_frame_rate_{DEFAULT_IDLE_FRAME_RATE};
+
+  asap::config::SettingsWatcher settings_watcher_;
+  FrameCapture frame_capture_;
 
   std::pair<int, int> saved_position_{-1, -1};
 
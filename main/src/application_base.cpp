@@ -8,17 +8,30 @@
 #include "application_base.h"
 
 #include "app/imgui_runner.h"
+#include "assets/asset_store.h"
+#include "logging/deferred.h"
+#include "ui/fonts/fonts.h"
 #include "ui/fonts/material_design_icons.h"
 #include "ui/log/sink.h"
 #include "ui/style/theme.h"
+#include "ui/textures/texture_manager.h"
 
 #include <GLFW/glfw3.h>
+#include <backends/imgui_impl_opengl3_stream.h>
+#include <date/date.h>
+#include <glad/gl_capabilities.h>
+#include <glad/gl_state.h>
+#include <glad/gl_trace.h>
 #include <gsl/span>
 #include <imgui/imgui.h>
 #include <imgui/misc/cpp/imgui_stdlib.h>
 
-#include <cmath> // for rounding frame rate
+#include <algorithm> // for std::max
+#include <chrono>    // for naming the captures
+#include <cmath>     // for rounding frame rate
 #include <sstream>
+#include <string>
+#include <vector>
 
 using asap::app::Application;
 using asap::app::ImGuiRunner;
@@ -31,11 +44,29 @@ const char *const ApplicationBase::LOGGER_NAME = "main";
 namespace {
 constexpr float STATUS_BAR_HEIGHT = 16.0F;
 constexpr float STATUS_BAR_FPS_WIDTH = 45.0F;
+constexpr float STATUS_BAR_PROGRESS_WIDTH = 160.0F;
 constexpr float HORIZONTAL_WINDOW_PADDING = 5.0F;
 constexpr float VERTICAL_WINDOW_PADDING = 5.0F;
 constexpr float TOOLBAR_HEIGHT = 30.0F;
 constexpr float ICON_HEIGHT = 18.0F;
 constexpr float ICON_WIDTH = 18.0F;
+constexpr float PRESET_COMBO_WIDTH = 120.0F;
+/// Range of the texture budget setting, in MiB.
+constexpr int MIN_TEXTURE_BUDGET = 16;
+constexpr int MAX_TEXTURE_BUDGET = 4096;
+/// The icon browser rasterizes at most 4 pages of 512x512 (4 MiB) of icons.
+constexpr asap::ui::GlyphCache::Settings ICON_BROWSER_GLYPHS{24.0F, 512, 4};
+
+/// A file name for a screenshot or a recording, in the working directory and
+/// unique to the second.
+auto CaptureFileName(const char *prefix, const char *extension)
+    -> std::string {
+  using std::chrono::seconds;
+  const auto now =
+      std::chrono::floor<seconds>(std::chrono::system_clock::now());
+  return std::string(prefix) + date::format("-%Y%m%d-%H%M%S", now) +
+         extension;
+}
 } // namespace
 
 void ApplicationBase::Init(ImGuiRunner *runner) {
@@ -45,27 +76,96 @@ void ApplicationBase::Init(ImGuiRunner *runner) {
 
   sink_->LoadSettings();
 
+  const auto &async = sink_->AsyncLogging();
+  if (async.enabled) {
+    // Route all the loggers through the asynchronous sink from now on
+    async_sink_ = std::make_shared<asap::logging::AsyncSink>(sink_, async);
+    asap::logging::Registry::PopSink();
+    asap::logging::Registry::PushSink(async_sink_);
+    ASLOG(info,
+        "asynchronous logging enabled (queue size {}, {} workers, overflow "
+        "policy '{}')",
+        async.queue_size, async.workers,
+        asap::logging::ToString(async.overflow_policy));
+  }
+
   ASLOG(debug, "Initializing UI theme");
   Theme::Init();
 
+  WatchSettings();
+
   // Call for custom init operations from derived class
   AfterInit();
 }
 
 void ApplicationBase::ShutDown() {
+  // Hand the pending deferred log records to the sinks while the log sink is
+  // still there.
+  asap::logging::deferred::Flush();
+  // Drain the asynchronous log queue, records logged after this point go
+  // directly to the log sink.
+  if (async_sink_) {
+    async_sink_->Shutdown();
+    if (async_sink_->Dropped() != 0) {
+      ASLOG(warn, "{} log records were dropped by the asynchronous logging",
+          async_sink_->Dropped());
+    }
+  }
   // Restore the original log sink
   asap::logging::Registry::PopSink();
 
+  // Release the textures while the OpenGL context is still there
+  icons_.reset();
+  images_.reset();
+  deep_zoom_.reset();
+
   // Call derived class for any custom shutdown logic before we shutdown the
   // app. We do this before to stay consistent with the initialization order.
   BeforeShutDown();
 
+  SaveSettings(asap::config::SettingsWriter::Capture::SAVE);
+  // Stop rebuilding the fonts before the ImGui context goes away
+  Theme::ShutDown();
+}
+
+void ApplicationBase::SaveSettings(
+    asap::config::SettingsWriter::Capture capture) {
   // Save configuration data:
   //  - Logging settings
   //  - Theme settings
   //  - Docks
-  sink_->SaveSettings();
-  Theme::SaveStyle();
+  sink_->SaveSettings(capture);
+  Theme::SaveStyle(capture);
+}
+
+void ApplicationBase::WatchSettings() {
+  using asap::config::Location;
+  using asap::config::SettingsWatcher;
+  using asap::config::SettingsWriter;
+  using asap::ui::ImGuiLogSink;
+
+  // The settings are parsed on the watcher thread, only the update of the
+  // levels and of the style is done between two frames. The reloaded
+  // settings are what the autosave compares with from then on.
+  auto &watcher = runner_->GetSettingsWatcher();
+  watcher.Watch(Location::F_LOG_SETTINGS,
+      [this](const std::filesystem::path &file) -> SettingsWatcher::Update {
+        return [this, levels = ImGuiLogSink::ReadLogLevels(file)]() {
+          ImGuiLogSink::ApplyLogLevels(levels);
+          sink_->SaveSettings(SettingsWriter::Capture::LOADED);
+        };
+      });
+  watcher.Watch(Location::F_THEME_SETTINGS,
+      [](const std::filesystem::path &file) -> SettingsWatcher::Update {
+        ImGuiStyle style;
+        if (!Theme::ReadStyle(file, style)) {
+          return {};
+        }
+        return [style]() {
+          Theme::ApplyStyle(style);
+          Theme::SaveStyle(SettingsWriter::Capture::LOADED);
+        };
+      });
 }
 
 auto ApplicationBase::DrawCommonElements() -> bool {
@@ -129,9 +229,21 @@ auto ApplicationBase::DrawCommonElements() -> bool {
     if (show_logs_) {
       DrawLogView();
     }
+    if (show_log_file_) {
+      DrawLogFileView();
+    }
     if (show_settings_) {
       DrawSettings();
     }
+    if (show_icons_) {
+      DrawIconBrowser();
+    }
+    if (show_images_) {
+      DrawImageViewer();
+    }
+    if (show_deep_zoom_) {
+      DrawDeepZoom();
+    }
     if (show_docks_debug_) {
       DrawDocksDebug();
     }
@@ -141,6 +253,9 @@ auto ApplicationBase::DrawCommonElements() -> bool {
     if (show_imgui_demos_) {
       DrawImGuiDemos();
     }
+    if (show_gl_stats_) {
+      DrawGlStats();
+    }
   }
 
   ImGui::End();
@@ -187,6 +302,9 @@ auto ApplicationBase::DrawMainMenu() -> float {
       if (ImGui::MenuItem("Show Logs", "CTRL+SHIFT+L", &show_logs_)) {
         DrawLogView();
       }
+      if (ImGui::MenuItem("Show Log File", "CTRL+SHIFT+F", &show_log_file_)) {
+        DrawLogFileView();
+      }
       if (ImGui::MenuItem(
               "Show Docks Debug", "CTRL+SHIFT+D", &show_docks_debug_)) {
         DrawDocksDebug();
@@ -194,6 +312,16 @@ auto ApplicationBase::DrawMainMenu() -> float {
       if (ImGui::MenuItem("Show Settings", "CTRL+SHIFT+S", &show_settings_)) {
         DrawSettings();
       }
+      if (ImGui::MenuItem("Show Icons", "CTRL+SHIFT+I", &show_icons_)) {
+        DrawIconBrowser();
+      }
+      if (ImGui::MenuItem("Show Images", "CTRL+SHIFT+P", &show_images_)) {
+        DrawImageViewer();
+      }
+      if (ImGui::MenuItem(
+              "Show Deep Zoom", "CTRL+SHIFT+Z", &show_deep_zoom_)) {
+        DrawDeepZoom();
+      }
 
       ImGui::Separator();
 
@@ -205,6 +333,24 @@ auto ApplicationBase::DrawMainMenu() -> float {
               "Show ImGui Demos", "CTRL+SHIFT+G", &show_imgui_demos_)) {
         DrawImGuiDemos();
       }
+      if (ImGui::MenuItem("Show GL Stats", "", &show_gl_stats_)) {
+        DrawGlStats();
+      }
+
+      ImGui::Separator();
+
+      auto &capture = runner_->GetFrameCapture();
+      if (ImGui::MenuItem(ICON_MDI_CAMERA " Screenshot")) {
+        // The menu is still drawn in this frame
+        capture.Screenshot(CaptureFileName("screenshot", ".png"), 1);
+      }
+      if (capture.IsRecording()) {
+        if (ImGui::MenuItem(ICON_MDI_STOP " Stop Recording")) {
+          capture.StopRecording();
+        }
+      } else if (ImGui::MenuItem(ICON_MDI_RECORD " Start Recording")) {
+        capture.StartRecording(CaptureFileName("recording", ".y4m"));
+      }
 
       ImGui::EndMenu();
     }
@@ -225,12 +371,32 @@ void ApplicationBase::DrawStatusBar(
       ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoSavedSettings |
           ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoResize);
 
+  auto common_width = STATUS_BAR_FPS_WIDTH;
+  const auto exporting_logs = sink_->IsExporting();
+  if (exporting_logs) {
+    common_width += STATUS_BAR_PROGRESS_WIDTH;
+  }
+
   // Call the derived class to add stuff to the status bar
-  DrawInsideStatusBar(width - STATUS_BAR_FPS_WIDTH, height);
+  DrawInsideStatusBar(width - common_width, height);
 
   // Draw the common stuff
+  if (exporting_logs) {
+    ImGui::SameLine(width - common_width);
+    ImGui::ProgressBar(sink_->ExportProgress(),
+        ImVec2(STATUS_BAR_PROGRESS_WIDTH - HORIZONTAL_WINDOW_PADDING,
+            ImGui::GetTextLineHeight()),
+        "Exporting logs...");
+  }
   ImGui::SameLine(width - STATUS_BAR_FPS_WIDTH);
   ImGui::Text("FPS: %ld", std::lround(ImGui::GetIO().Framerate));
+  if (ImGui::IsItemHovered() && ImGui_ImplOpenGL3Stream_IsStreaming()) {
+    const auto stats = ImGui_ImplOpenGL3Stream_GetStats();
+    const auto state = asap::gl::LastFrameCounters();
+    ImGui::SetTooltip("%u draw commands in %u draw calls\n"
+                      "%u state changes, %u redundant ones skipped",
+        stats.DrawCommands, stats.DrawCalls, state.Issued, state.Elided);
+  }
   ImGui::End();
 }
 
@@ -242,6 +408,109 @@ void ApplicationBase::DrawLogView() {
   ImGui::End();
 }
 
+void ApplicationBase::DrawLogFileView() {
+  if (ImGui::Begin("Log File", &show_log_file_)) {
+    // Draw the log file view docked
+    log_file_view_.Draw();
+  }
+  ImGui::End();
+}
+
+void ApplicationBase::OpenImage(const std::filesystem::path &path) {
+  if (!images_) {
+    images_ = std::make_unique<asap::ui::ImageViewer>();
+  }
+  images_->Open(path);
+  show_images_ = true;
+}
+
+void ApplicationBase::DrawImageViewer() {
+  if (ImGui::Begin("Images", &show_images_)) {
+    if (!images_) {
+      images_ = std::make_unique<asap::ui::ImageViewer>();
+    }
+    // Draw the image viewer docked
+    images_->Draw();
+  }
+  ImGui::End();
+}
+
+void ApplicationBase::OpenDeepZoom(const std::filesystem::path &path) {
+  if (!deep_zoom_) {
+    deep_zoom_ = std::make_unique<asap::ui::DeepZoomView>();
+  }
+  deep_zoom_->Open(path);
+  show_deep_zoom_ = true;
+}
+
+void ApplicationBase::DrawDeepZoom() {
+  if (ImGui::Begin("Deep Zoom", &show_deep_zoom_)) {
+    if (!deep_zoom_) {
+      deep_zoom_ = std::make_unique<asap::ui::DeepZoomView>();
+    }
+    // Draw the deep zoom view docked
+    deep_zoom_->Draw();
+  }
+  ImGui::End();
+}
+
+void ApplicationBase::DrawIconBrowser() {
+  if (ImGui::Begin("Icons", &show_icons_)) {
+    if (!icons_) {
+      const auto font = asap::assets::AssetStore::Default().Get(
+          asap::ui::Fonts::MATERIAL_DESIGN_ICONS);
+      icons_ = std::make_unique<asap::ui::GlyphCache>(font.data(),
+          static_cast<int>(font.size()), ICON_BROWSER_GLYPHS);
+      for (int codepoint = ICON_MIN_MDI; codepoint <= ICON_MAX_MDI;
+           ++codepoint) {
+        if (icons_->HasGlyph(static_cast<ImWchar>(codepoint))) {
+          icon_codepoints_.push_back(static_cast<ImWchar>(codepoint));
+        }
+      }
+    }
+
+    const auto stats = icons_->GetStats();
+    ImGui::Text("%zu icons, %zu rasterized in %zu/%zu pages, %zu evictions",
+        icon_codepoints_.size(), stats.glyphs, stats.pages,
+        ICON_BROWSER_GLYPHS.max_pages, stats.evictions);
+    ImGui::Separator();
+
+    // Only the visible icons are looked up, and therefore rasterized
+    ImGui::BeginChild("icons");
+    const auto &style = ImGui::GetStyle();
+    const auto cell_width =
+        ICON_BROWSER_GLYPHS.size_pixels + style.ItemSpacing.x;
+    const auto columns = std::max<std::size_t>(
+        1, static_cast<std::size_t>(
+               ImGui::GetContentRegionAvail().x / cell_width));
+    const auto rows = (icon_codepoints_.size() + columns - 1) / columns;
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rows),
+        ICON_BROWSER_GLYPHS.size_pixels + style.ItemSpacing.y);
+    while (clipper.Step()) {
+      for (auto row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+        for (std::size_t column = 0; column < columns; ++column) {
+          const auto index = static_cast<std::size_t>(row) * columns + column;
+          if (index >= icon_codepoints_.size()) {
+            break;
+          }
+          if (column > 0) {
+            ImGui::SameLine(static_cast<float>(column) * cell_width);
+          }
+          const auto codepoint = icon_codepoints_[index];
+          icons_->Icon(codepoint);
+          if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("U+%04X", static_cast<unsigned int>(codepoint));
+          }
+        }
+      }
+    }
+    clipper.End();
+    ImGui::EndChild();
+  }
+  ImGui::End();
+}
+
 void ApplicationBase::DrawImGuiMetrics() {
   ImGui::ShowMetricsWindow();
 }
@@ -250,6 +519,93 @@ void ApplicationBase::DrawImGuiDemos() {
   ImGui::ShowDemoWindow(&show_imgui_demos_);
 }
 
+void ApplicationBase::DrawGlStats() {
+  if (ImGui::Begin("GL Stats", &show_gl_stats_)) {
+    if (ImGui_ImplOpenGL3Stream_IsStreaming()) {
+      const auto stats = ImGui_ImplOpenGL3Stream_GetStats();
+      ImGui::Text("%u draw commands in %u draw calls", stats.DrawCommands,
+          stats.DrawCalls);
+      ImGui::Text("%zu bytes of vertices and indices streamed",
+          stats.LastFrameBytes);
+      ImGui::Text("%u fence waits, %u reallocations in %u frames",
+          stats.FenceWaits, stats.Reallocations, stats.Frames);
+      if (asap::gl::GetFastPaths().GpuTiming) {
+        ImGui::Text("%.3f ms of GPU time", stats.GpuSeconds * 1000.0);
+      }
+    }
+    const auto state = asap::gl::LastFrameCounters();
+    ImGui::Text("%u state changes, %u redundant ones skipped", state.Issued,
+        state.Elided);
+    const auto textures = asap::ui::TextureManager::Default().GetStats();
+    ImGui::Text("%zu textures, %zu resident in %zu/%zu MiB, %zu evictions",
+        textures.textures, textures.resident, textures.resident_bytes >> 20U,
+        textures.budget_bytes >> 20U, textures.evictions);
+    ImGui::Text("%zu KiB of pixels pending, %zu KiB uploaded through %zu "
+                "pixel buffers",
+        textures.pending_bytes >> 10U, textures.uploaded_bytes >> 10U,
+        textures.staging_buffers);
+    const auto capture = runner_->GetFrameCapture().GetStats();
+    if (capture.captured != 0) {
+      ImGui::Text("%zu frames captured, %zu written, %zu dropped%s",
+          capture.captured, capture.written, capture.dropped,
+          capture.recording ? ", recording..." : "");
+      ImGui::Text("capture overhead %.2f ms per frame (%.2f ms at most), "
+                  "mapped after %.1f frames, %.1f ms to encode",
+          capture.average_overhead_ms, capture.max_overhead_ms,
+          capture.average_latency_frames, capture.average_encode_ms);
+    }
+    ImGui::Separator();
+
+    if (!asap::gl::trace::ENABLED) {
+      ImGui::TextWrapped("The GL calls are not traced in this build, "
+                         "configure it with ASAP_IMGUI_GL_TRACE=ON.");
+      ImGui::End();
+      return;
+    }
+
+    const auto frame = asap::gl::trace::LastFrame();
+    ImGui::Text("%u GL calls, %zu bytes uploaded, %.3f ms", frame.Calls,
+        frame.Bytes, frame.Seconds * 1000.0);
+
+    // The functions called during the frame, the most expensive first
+    std::vector<const asap::gl::trace::FunctionStats *> called;
+    for (int index = 0; index < frame.FunctionCount; ++index) {
+      if (frame.Functions[index].Calls > 0) {
+        called.push_back(&frame.Functions[index]);
+      }
+    }
+    std::sort(called.begin(), called.end(),
+        [](const asap::gl::trace::FunctionStats *lhs,
+            const asap::gl::trace::FunctionStats *rhs) {
+          return lhs->Seconds > rhs->Seconds;
+        });
+
+    const auto table_flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders |
+                             ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("functions", 4, table_flags)) {
+      ImGui::TableSetupScrollFreeze(0, 1);
+      ImGui::TableSetupColumn("Function");
+      ImGui::TableSetupColumn("Calls");
+      ImGui::TableSetupColumn("Bytes");
+      ImGui::TableSetupColumn("ms");
+      ImGui::TableHeadersRow();
+      for (const auto *function : called) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(function->Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", function->Calls);
+        ImGui::TableNextColumn();
+        ImGui::Text("%zu", function->Bytes);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", function->Seconds * 1000.0);
+      }
+      ImGui::EndTable();
+    }
+  }
+  ImGui::End();
+}
+
 namespace {
 
 auto DrawDisplaySettingsTitle(ImGuiRunner *runner, std::string &title) -> bool {
@@ -500,7 +856,17 @@ void ShowStyleSettings() {
               ImGuiWindowFlags_NoScrollWithMouse);
       {
         if (ImGui::SmallButton("Load Default Style")) {
-          Theme::LoadDefaultStyle();
+          Theme::SelectPreset(Theme::DEFAULT_PRESET, Theme::PRESET_TRANSITION);
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(PRESET_COMBO_WIDTH);
+        if (ImGui::BeginCombo("##Theme Preset", "Theme Preset")) {
+          for (int preset = 0; preset < Theme::PresetCount(); ++preset) {
+            if (ImGui::Selectable(Theme::PresetName(preset))) {
+              Theme::SelectPreset(preset, Theme::PRESET_TRANSITION);
+            }
+          }
+          ImGui::EndCombo();
         }
       }
       {
@@ -530,6 +896,59 @@ void ShowStyleSettings() {
   ImGui::ShowStyleEditor();
 }
 
+/// What the GL context offers, and the paths selected from it. Read only, the
+/// selection is made when the context is created.
+void ShowGraphicsSettings() {
+  const auto &caps = asap::gl::GetCapabilities();
+  const auto &paths = asap::gl::GetFastPaths();
+  const auto row = [](const char *name, bool value) {
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted(name);
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted(value ? "yes" : "no");
+  };
+
+  ImGui::Text("OpenGL %d.%d, %s", caps.Major, caps.Minor,
+      reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+  ImGui::Spacing();
+
+  const auto table_flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders;
+  if (ImGui::BeginTable("capabilities", 2, table_flags)) {
+    ImGui::TableSetupColumn("Capability");
+    ImGui::TableSetupColumn("Available");
+    ImGui::TableHeadersRow();
+    row("Buffer storage", caps.BufferStorage);
+    row("Direct state access", caps.DirectStateAccess);
+    row("Multi-draw indirect", caps.MultiDrawIndirect);
+    row("Parallel shader compile", caps.ParallelShaderCompile);
+    row("Program binary", caps.ProgramBinary);
+    row("Timer queries", caps.TimerQuery);
+    row("Debug output", caps.DebugOutput);
+    ImGui::EndTable();
+  }
+  ImGui::Spacing();
+
+  if (ImGui::BeginTable("paths", 2, table_flags)) {
+    ImGui::TableSetupColumn("Fast path");
+    ImGui::TableSetupColumn("Selected");
+    ImGui::TableHeadersRow();
+    row("Streamed ImGui geometry", paths.StreamGeometry);
+    row("Parallel shader compile", paths.ParallelShaderCompile);
+    row("GPU timing", paths.GpuTiming);
+    ImGui::EndTable();
+  }
+  ImGui::Spacing();
+
+  // Applied right away, saved with the display settings
+  auto &textures = asap::ui::TextureManager::Default();
+  auto budget = static_cast<int>(textures.GetBudget() >> 20U);
+  if (ImGui::SliderInt("Texture budget", &budget, MIN_TEXTURE_BUDGET,
+          MAX_TEXTURE_BUDGET, "%d MiB")) {
+    textures.SetBudget(static_cast<std::size_t>(budget) << 20U);
+  }
+}
+
 } // namespace
 
 void ApplicationBase::DrawSettings() {
@@ -548,6 +967,12 @@ void ApplicationBase::DrawSettings() {
     if (ImGui::CollapsingHeader("Style")) {
       ShowStyleSettings();
     }
+
+    ImGui::Spacing();
+
+    if (ImGui::CollapsingHeader("Graphics")) {
+      ShowGraphicsSettings();
+    }
   }
   ImGui::End();
 }
@@ -8,6 +8,11 @@
 #pragma once
 
 #include "app/application.h"
+#include "logging/async_sink.h"
+#include "ui/fonts/glyph_cache.h"
+#include "ui/images/deep_zoom_view.h"
+#include "ui/images/image_viewer.h"
+#include "ui/log/file_view.h"
 #include "ui/log/sink.h"
 
 #include <logging/logging.h>
@@ -23,6 +28,7 @@ public:
 
   void Init(asap::app::ImGuiRunner *runner) final;
   void ShutDown() final;
+  void SaveSettings(asap::config::SettingsWriter::Capture capture) final;
 
   static const char *const LOGGER_NAME;
 
@@ -41,22 +47,51 @@ protected:
 
   virtual auto DrawCommonElements() -> bool final;
 
+  /// Show the image file at `path` in the image viewer, decoded in the
+  /// background.
+  void OpenImage(const std::filesystem::path &path);
+  /// Show the tile file, or the image converted to a tile file, at `path` in
+  /// the deep zoom view.
+  void OpenDeepZoom(const std::filesystem::path &path);
+
 private:
   auto DrawMainMenu() -> float;
   void DrawStatusBar(float width, float height, float pos_x, float pos_y);
   void DrawLogView();
+  void DrawLogFileView();
   void DrawSettings();
+  void DrawIconBrowser();
+  void DrawImageViewer();
+  void DrawDeepZoom();
   void DrawDocksDebug();
   void DrawImGuiMetrics();
   void DrawImGuiDemos();
+  void DrawGlStats();
+  void WatchSettings();
 
   bool show_docks_debug_{false};
   bool show_logs_{true};
+  bool show_log_file_{false};
   bool show_settings_{true};
+  bool show_icons_{false};
+  bool show_images_{false};
+  bool show_deep_zoom_{false};
   bool show_imgui_metrics_{false};
   bool show_imgui_demos_{false};
+  bool show_gl_stats_{false};
 
   std::shared_ptr<asap::ui::ImGuiLogSink> sink_;
+  /// Wraps `sink_` when asynchronous logging is enabled in the settings.
+  std::shared_ptr<asap::logging::AsyncSink> async_sink_;
+  asap::ui::LogFileView log_file_view_;
+  /// Glyphs of the icon browser, rasterized on demand. Created when the browser
+  /// is first shown.
+  std::unique_ptr<asap::ui::GlyphCache> icons_;
+  std::vector<ImWchar> icon_codepoints_;
+  /// Created when the image viewer is first shown.
+  std::unique_ptr<asap::ui::ImageViewer> images_;
+  /// Created when the deep zoom view is first shown.
+  std::unique_ptr<asap::ui::DeepZoomView> deep_zoom_;
   asap::app::ImGuiRunner *runner_ =
       nullptr; // TODO(Abdessattar): convert to weak_ptr?
 };
@@ -0,0 +1,263 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "assets/asset_store.h"
+#include "assets/compression.h"
+#include "config/config.h"
+
+#include <algorithm> // for lower_bound
+#include <cstring>   // for memcpy
+#include <fstream>   // for reading the pack when it can't be mapped
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ASAP_ASSET_PACK_MMAP
+#endif
+
+#if defined(ASAP_EMBEDDED_ASSETS)
+// Defined by the assembly file generated by the build, which includes the pack
+// with `.incbin`.
+extern "C" const unsigned char asap_assets_pack[];     // NOLINT
+extern "C" const unsigned char asap_assets_pack_end[]; // NOLINT
+#endif
+
+namespace asap::assets {
+
+const char *const AssetStore::LOGGER_NAME = "main";
+
+/// Read-only view of the contents of the pack file, memory mapped where
+/// supported.
+class AssetStore::MappedFile {
+public:
+  explicit MappedFile(const std::filesystem::path &path) {
+#if defined(ASAP_ASSET_PACK_MMAP)
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0) {
+      return;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      auto *mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+          PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) { // NOLINT
+        data_ = static_cast<const unsigned char *>(mapping);
+        size_ = static_cast<std::size_t>(info.st_size);
+      }
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (in) {
+      buffer_.assign(std::istreambuf_iterator<char>(in),
+          std::istreambuf_iterator<char>());
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+    }
+#endif
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  auto operator=(const MappedFile &) -> MappedFile & = delete;
+  auto operator=(MappedFile &&) -> MappedFile & = delete;
+
+  ~MappedFile() {
+#if defined(ASAP_ASSET_PACK_MMAP)
+    if (data_ != nullptr) {
+      ::munmap(const_cast<unsigned char *>(data_), size_); // NOLINT
+    }
+#endif
+  }
+
+  [[nodiscard]] auto Data() const -> const unsigned char * {
+    return data_;
+  }
+
+  [[nodiscard]] auto Size() const -> std::size_t {
+    return size_;
+  }
+
+private:
+  const unsigned char *data_{nullptr};
+  std::size_t size_{0};
+#if !defined(ASAP_ASSET_PACK_MMAP)
+  std::vector<unsigned char> buffer_;
+#endif
+};
+
+AssetStore::AssetStore() = default;
+
+AssetStore::~AssetStore() = default;
+
+auto AssetStore::Open(const std::filesystem::path &path)
+    -> std::unique_ptr<AssetStore> {
+  auto file = std::make_unique<MappedFile>(path);
+  if (file->Data() == nullptr) {
+    ASLOG(error, "could not read the asset pack {}", path.string());
+    return nullptr;
+  }
+  auto store = std::make_unique<AssetStore>();
+  if (!store->Load(file->Data(), file->Size())) {
+    ASLOG(error, "{} is not a valid asset pack", path.string());
+    return nullptr;
+  }
+  store->file_ = std::move(file);
+  ASLOG(debug, "asset pack {} opened ({} assets)", path.string(),
+      store->entries_.size());
+  return store;
+}
+
+auto AssetStore::FromMemory(const void *data, std::size_t size)
+    -> std::unique_ptr<AssetStore> {
+  auto store = std::make_unique<AssetStore>();
+  if (!store->Load(static_cast<const unsigned char *>(data), size)) {
+    ASLOG(error, "the asset pack in memory is not valid");
+    return nullptr;
+  }
+  return store;
+}
+
+auto AssetStore::Default() -> AssetStore & {
+  static const std::unique_ptr<AssetStore> store = []() {
+#if defined(ASAP_EMBEDDED_ASSETS)
+    auto assets = FromMemory(asap_assets_pack,
+        static_cast<std::size_t>(asap_assets_pack_end - asap_assets_pack));
+#else
+    auto assets =
+        Open(asap::config::GetPathFor(asap::config::Location::F_ASSET_PACK));
+#endif
+    if (!assets) {
+      ASLOG(error, "running without the application assets");
+      assets = std::make_unique<AssetStore>();
+    }
+    return assets;
+  }();
+  return *store;
+}
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+auto AssetStore::Load(const unsigned char *data, std::size_t size) -> bool {
+  pack::Header header{};
+  if (size < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != pack::MAGIC) {
+    return false;
+  }
+  // Check the whole index before using it
+  const auto entries_end =
+      sizeof(header) + std::size_t{header.entry_count} * sizeof(pack::Entry);
+  const auto names_end = entries_end + header.names_size;
+  if (names_end > size) {
+    return false;
+  }
+  std::vector<pack::Entry> entries(header.entry_count);
+  std::memcpy(entries.data(), data + sizeof(header),
+      entries.size() * sizeof(pack::Entry));
+  const auto *names = reinterpret_cast<const char *>(data) + entries_end;
+  for (const auto &entry : entries) {
+    const auto valid_name =
+        std::size_t{entry.name_offset} + entry.name_size <= header.names_size;
+    const auto valid_contents = entry.offset >= names_end &&
+                                entry.offset <= size &&
+                                entry.stored_size <= size - entry.offset;
+    const auto valid_compression =
+        (entry.compression == pack::Compression::NONE &&
+            entry.stored_size == entry.size) ||
+        entry.compression == pack::Compression::LZ;
+    if (!valid_name || !valid_contents || !valid_compression) {
+      return false;
+    }
+  }
+
+  data_ = data;
+  size_ = size;
+  names_ = names;
+  entries_ = std::move(entries);
+  decompressed_.resize(entries_.size());
+  // Lookups are binary searches in the entries, sorted by the packer
+  return std::is_sorted(entries_.begin(), entries_.end(),
+      [this](const pack::Entry &lhs, const pack::Entry &rhs) {
+        return NameOf(lhs) < NameOf(rhs);
+      });
+}
+
+auto AssetStore::NameOf(const pack::Entry &entry) const -> std::string_view {
+  return {names_ + entry.name_offset, entry.name_size};
+}
+
+auto AssetStore::Find(std::string_view name) const -> std::size_t {
+  const auto found = std::lower_bound(entries_.begin(), entries_.end(), name,
+      [this](const pack::Entry &entry, std::string_view value) {
+        return NameOf(entry) < value;
+      });
+  if (found == entries_.end() || NameOf(*found) != name) {
+    return entries_.size();
+  }
+  return static_cast<std::size_t>(found - entries_.begin());
+}
+
+auto AssetStore::Contains(std::string_view name) const -> bool {
+  return Find(name) != entries_.size();
+}
+
+auto AssetStore::Get(std::string_view name) -> Bytes {
+  const auto index = Find(name);
+  if (index == entries_.size()) {
+    ASLOG(error, "asset '{}' not found", name);
+    return {};
+  }
+  const auto &entry = entries_[index];
+  const auto *stored = data_ + entry.offset;
+  if (entry.compression == pack::Compression::NONE) {
+    return {stored, static_cast<std::size_t>(entry.size)};
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &contents = decompressed_[index];
+  if (contents.size() != entry.size) {
+    contents.resize(static_cast<std::size_t>(entry.size));
+    if (!Decompress(stored, static_cast<std::size_t>(entry.stored_size),
+            contents.data(), contents.size()) ||
+        pack::Hash(contents.data(), contents.size()) != entry.hash) {
+      ASLOG(error, "asset '{}' is corrupted", name);
+      contents.clear();
+      return {};
+    }
+    ASLOG(debug, "asset '{}' decompressed ({} -> {} bytes)", name,
+        entry.stored_size, entry.size);
+  }
+  return {contents.data(), contents.size()};
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+auto AssetStore::GetText(std::string_view name) -> std::string_view {
+  const auto contents = Get(name);
+  return {reinterpret_cast<const char *>(contents.data()), // NOLINT
+      contents.size()};
+}
+
+auto AssetStore::Hash(std::string_view name) const -> std::uint64_t {
+  const auto index = Find(name);
+  return index == entries_.size() ? 0 : entries_[index].hash;
+}
+
+auto AssetStore::Names() const -> std::vector<std::string_view> {
+  std::vector<std::string_view> names;
+  names.reserve(entries_.size());
+  for (const auto &entry : entries_) {
+    names.push_back(NameOf(entry));
+  }
+  return names;
+}
+
+} // namespace asap::assets
@@ -0,0 +1,106 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "assets/pack_format.h"
+
+#include <gsl/span>
+#include <logging/logging.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace asap::assets {
+
+/*!
+ * \brief Read-only access to the assets (fonts, shaders, data files) bundled
+ * in an asset pack by the `asset-packer` build tool.
+ *
+ * The pack is memory mapped (or embedded in the executable), and the entries
+ * stored uncompressed are accessed in place, without any copy. Compressed
+ * entries are decompressed the first time they are requested, and kept in
+ * memory for the lifetime of the store.
+ *
+ * The contents returned by the store remain valid as long as the store. All
+ * the member functions are thread safe.
+ */
+class AssetStore : public asap::logging::Loggable<AssetStore> {
+public:
+  using Bytes = gsl::span<const unsigned char>;
+
+  /// An empty store, with no assets.
+  AssetStore();
+
+  AssetStore(const AssetStore &) = delete;
+  AssetStore(AssetStore &&) = delete;
+  auto operator=(const AssetStore &) -> AssetStore & = delete;
+  auto operator=(AssetStore &&) -> AssetStore & = delete;
+
+  ~AssetStore();
+
+  /// Open the pack file at `path`. Return nullptr if the file can't be read or
+  /// is not a valid pack.
+  static auto Open(const std::filesystem::path &path)
+      -> std::unique_ptr<AssetStore>;
+
+  /// Use a pack already in memory (e.g. embedded in the executable), which must
+  /// outlive the store. Return nullptr if it is not a valid pack.
+  static auto FromMemory(const void *data, std::size_t size)
+      -> std::unique_ptr<AssetStore>;
+
+  /*!
+   * \brief The application's assets.
+   *
+   * The pack embedded in the executable when built with `ASAP_EMBED_ASSETS`,
+   * or otherwise the pack installed next to the executable. When the pack is
+   * missing, the error is logged and the store is empty.
+   */
+  static auto Default() -> AssetStore &;
+
+  [[nodiscard]] auto Contains(std::string_view name) const -> bool;
+
+  /// Contents of the asset, decompressed if needed. Empty if there is no such
+  /// asset or its contents are corrupted.
+  auto Get(std::string_view name) -> Bytes;
+
+  /// Contents of a text asset.
+  auto GetText(std::string_view name) -> std::string_view;
+
+  /// Hash of the asset contents, without decompressing them, or 0 if there is
+  /// no such asset.
+  [[nodiscard]] auto Hash(std::string_view name) const -> std::uint64_t;
+
+  /// Names of the assets, in alphabetical order.
+  [[nodiscard]] auto Names() const -> std::vector<std::string_view>;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  class MappedFile;
+
+  auto Load(const unsigned char *data, std::size_t size) -> bool;
+  [[nodiscard]] auto Find(std::string_view name) const -> std::size_t;
+  [[nodiscard]] auto NameOf(const pack::Entry &entry) const
+      -> std::string_view;
+
+  std::unique_ptr<MappedFile> file_;
+  const unsigned char *data_{nullptr};
+  std::size_t size_{0};
+  std::vector<pack::Entry> entries_;
+  const char *names_{nullptr};
+
+  mutable std::mutex mutex_;
+  /// Decompressed contents, by entry index.
+  std::vector<std::vector<unsigned char>> decompressed_;
+};
+
+} // namespace asap::assets
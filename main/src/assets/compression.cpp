@@ -0,0 +1,181 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "assets/compression.h"
+
+#include <algorithm> // for min
+#include <cstdint>
+#include <cstring> // for memcpy
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace asap::assets {
+
+namespace {
+
+constexpr std::size_t MIN_MATCH = 4;
+constexpr std::size_t MAX_OFFSET = 0xFFFF;
+/// Lengths up to this value fit in the 4 bits of the token, longer ones are
+/// continued in the following bytes.
+constexpr std::size_t TOKEN_LENGTH_MAX = 15;
+constexpr unsigned int HASH_BITS = 16;
+constexpr std::uint32_t NO_POSITION = 0xFFFFFFFF;
+
+auto Read32(const unsigned char *data) -> std::uint32_t {
+  std::uint32_t value = 0;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+auto HashOf(std::uint32_t sequence) -> std::size_t {
+  // Knuth's multiplicative hash
+  constexpr std::uint32_t MULTIPLIER = 2654435761U;
+  return (sequence * MULTIPLIER) >> (32 - HASH_BITS);
+}
+
+/// Write the part of a length which does not fit in the token.
+void PutLength(std::vector<unsigned char> &out, std::size_t length) {
+  constexpr std::size_t BYTE_MAX = 255;
+  length -= TOKEN_LENGTH_MAX;
+  while (length >= BYTE_MAX) {
+    out.push_back(BYTE_MAX);
+    length -= BYTE_MAX;
+  }
+  out.push_back(static_cast<unsigned char>(length));
+}
+
+/// Emit a sequence, `match_length` is 0 for the last sequence which only has
+/// literals.
+void PutSequence(std::vector<unsigned char> &out, const unsigned char *literals,
+    std::size_t literal_length, std::size_t offset, std::size_t match_length) {
+  const auto literal_token = std::min(literal_length, TOKEN_LENGTH_MAX);
+  const auto match_token = match_length == 0
+                               ? 0
+                               : std::min(match_length - MIN_MATCH,
+                                     TOKEN_LENGTH_MAX);
+  out.push_back(static_cast<unsigned char>((literal_token << 4) | match_token));
+  if (literal_length >= TOKEN_LENGTH_MAX) {
+    PutLength(out, literal_length);
+  }
+  out.insert(out.end(), literals, literals + literal_length);
+  if (match_length != 0) {
+    out.push_back(static_cast<unsigned char>(offset & 0xFF));
+    out.push_back(static_cast<unsigned char>(offset >> 8));
+    if (match_length - MIN_MATCH >= TOKEN_LENGTH_MAX) {
+      PutLength(out, match_length - MIN_MATCH);
+    }
+  }
+}
+
+/// Read the continuation of a length from the input, return false if the
+/// input ends before the length does.
+auto GetLength(const unsigned char *&in, const unsigned char *end,
+    std::size_t &length) -> bool {
+  constexpr unsigned char BYTE_MAX = 255;
+  unsigned char byte = BYTE_MAX;
+  while (byte == BYTE_MAX) {
+    if (in == end) {
+      return false;
+    }
+    byte = *in++;
+    length += byte;
+  }
+  return true;
+}
+
+} // namespace
+
+auto Compress(const void *input, std::size_t size)
+    -> std::vector<unsigned char> {
+  const auto *data = static_cast<const unsigned char *>(input);
+  std::vector<unsigned char> out;
+  out.reserve(size / 2 + 16);
+  std::vector<std::uint32_t> table(std::size_t{1} << HASH_BITS, NO_POSITION);
+
+  std::size_t anchor = 0;
+  std::size_t position = 0;
+  while (position + MIN_MATCH <= size) {
+    const auto sequence = Read32(data + position);
+    auto &slot = table[HashOf(sequence)];
+    const auto candidate = static_cast<std::size_t>(slot);
+    slot = static_cast<std::uint32_t>(position);
+    if (candidate == NO_POSITION || position - candidate > MAX_OFFSET ||
+        Read32(data + candidate) != sequence) {
+      ++position;
+      continue;
+    }
+    auto length = MIN_MATCH;
+    while (position + length < size &&
+           data[candidate + length] == data[position + length]) {
+      ++length;
+    }
+    PutSequence(out, data + anchor, position - anchor, position - candidate,
+        length);
+    position += length;
+    anchor = position;
+  }
+  PutSequence(out, data + anchor, size - anchor, 0, 0);
+  return out;
+}
+
+auto Decompress(const void *input, std::size_t input_size, void *output,
+    std::size_t output_size) -> bool {
+  const auto *in = static_cast<const unsigned char *>(input);
+  const auto *in_end = in + input_size;
+  auto *out = static_cast<unsigned char *>(output);
+  auto *const out_begin = out;
+  auto *const out_end = out + output_size;
+
+  while (in < in_end) {
+    const auto token = *in++;
+    std::size_t literal_length = token >> 4;
+    if (literal_length == TOKEN_LENGTH_MAX &&
+        !GetLength(in, in_end, literal_length)) {
+      return false;
+    }
+    if (literal_length > static_cast<std::size_t>(in_end - in) ||
+        literal_length > static_cast<std::size_t>(out_end - out)) {
+      return false;
+    }
+    if (literal_length != 0) {
+      std::memcpy(out, in, literal_length);
+    }
+    in += literal_length;
+    out += literal_length;
+    if (in == in_end) {
+      // The last sequence only has literals
+      break;
+    }
+
+    if (in_end - in < 2) {
+      return false;
+    }
+    const auto offset = static_cast<std::size_t>(in[0] | (in[1] << 8));
+    in += 2;
+    std::size_t match_length = token & 0x0F;
+    if (match_length == TOKEN_LENGTH_MAX &&
+        !GetLength(in, in_end, match_length)) {
+      return false;
+    }
+    match_length += MIN_MATCH;
+    if (offset == 0 || offset > static_cast<std::size_t>(out - out_begin) ||
+        match_length > static_cast<std::size_t>(out_end - out)) {
+      return false;
+    }
+    // The match may overlap the bytes it produces, copy byte by byte
+    const auto *match = out - offset;
+    for (std::size_t index = 0; index < match_length; ++index) {
+      out[index] = match[index];
+    }
+    out += match_length;
+  }
+  return out == out_end;
+}
+
+} // namespace asap::assets
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,36 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace asap::assets {
+
+/*!
+ * \brief Compress a buffer with a byte oriented LZ77 codec.
+ *
+ * The format is the LZ4 block format: sequences of literals followed by a
+ * match of at least 4 bytes in the previous 64 KiB. It is not the best ratio,
+ * but the decompression runs at memory speed, which is what matters for assets
+ * decompressed when the application starts.
+ */
+auto Compress(const void *input, std::size_t size)
+    -> std::vector<unsigned char>;
+
+/*!
+ * \brief Decompress a buffer compressed with `Compress()`.
+ *
+ * `output_size` must be the exact size of the original data. Return false if
+ * the compressed data is corrupted, in which case the output contents are
+ * undefined. The decoder never reads or writes out of the given buffers.
+ */
+auto Decompress(const void *input, std::size_t input_size, void *output,
+    std::size_t output_size) -> bool;
+
+} // namespace asap::assets
@@ -0,0 +1,82 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * \file pack_format.h
+ *
+ * \brief Layout of the asset pack files, shared by the `asset-packer` tool
+ * and the `AssetStore`.
+ *
+ * A pack is made of:
+ *  - a `Header`,
+ *  - `Header::entry_count` `Entry` records, sorted by name,
+ *  - the names of the entries (not null terminated), `Header::names_size`
+ *    bytes,
+ *  - the (possibly compressed) contents of the entries, each starting at a
+ *    multiple of `ALIGNMENT` from the start of the pack.
+ *
+ * All integers are little endian. Offsets are from the start of the pack.
+ */
+
+namespace asap::assets::pack {
+
+constexpr std::array<char, 8> MAGIC{'A', 'S', 'A', 'P', 'P', 'A', 'K', '1'};
+
+/// Alignment of the entry contents, so that uncompressed entries can be used
+/// in place for any data type.
+constexpr std::size_t ALIGNMENT = 16;
+
+enum class Compression : std::uint32_t {
+  /// Stored as is.
+  NONE = 0,
+  /// Compressed with `asap::assets::Compress()`.
+  LZ = 1,
+};
+
+struct Header {
+  std::array<char, 8> magic;
+  std::uint32_t entry_count;
+  std::uint32_t names_size;
+};
+
+struct Entry {
+  std::uint64_t offset;
+  /// Size in the pack.
+  std::uint64_t stored_size;
+  /// Size once decompressed.
+  std::uint64_t size;
+  /// FNV-1a hash of the decompressed contents.
+  std::uint64_t hash;
+  /// Offset of the name from the start of the names.
+  std::uint32_t name_offset;
+  std::uint32_t name_size;
+  Compression compression;
+  std::uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 16);
+static_assert(sizeof(Entry) == 48);
+
+/// 64-bit FNV-1a hash of the entry contents.
+inline auto Hash(const void *data, std::size_t size) -> std::uint64_t {
+  constexpr std::uint64_t PRIME = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t index = 0; index < size; ++index) {
+    hash ^= bytes[index]; // NOLINT
+    hash *= PRIME;
+  }
+  return hash;
+}
+
+} // namespace asap::assets::pack
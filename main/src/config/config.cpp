@@ -7,42 +7,118 @@
 
 #include "./config.h"
 
+#include <array>
+#include <cstdint>
+#include <string>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
+
 namespace asap::config {
 
-auto GetPathFor(Location id) -> std::filesystem::path {
+namespace {
+
+/// Directory of the running executable, or the current directory if it can't
+/// be found.
+auto ExecutableDirectory() -> std::filesystem::path {
+  std::filesystem::path executable;
+#if defined(_WIN32)
+  std::wstring buffer(MAX_PATH, L'\0');
+  const auto length = ::GetModuleFileNameW(
+      nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+  if (length > 0 && length < buffer.size()) {
+    buffer.resize(length);
+    executable = buffer;
+  }
+#elif defined(__APPLE__)
+  std::uint32_t size = 0;
+  _NSGetExecutablePath(nullptr, &size);
+  std::string buffer(size, '\0');
+  if (_NSGetExecutablePath(buffer.data(), &size) == 0) {
+    executable = std::filesystem::weakly_canonical(buffer.c_str());
+  }
+#else
+  std::error_code error;
+  executable = std::filesystem::read_symlink("/proc/self/exe", error);
+#endif
+  if (executable.empty()) {
+    return std::filesystem::current_path();
+  }
+  return executable.parent_path();
+}
+
+constexpr auto LOCATION_COUNT =
+    static_cast<std::size_t>(Location::F_ASSET_PACK) + 1;
+
+auto ResolvePath(Location id) -> std::filesystem::path {
   switch (id) {
   case Location::D_USER_CONFIG: {
     auto p = std::filesystem::current_path();
     p /= ".asap";
     return p;
   }
+  case Location::D_CACHE: {
+    auto p = ResolvePath(Location::D_USER_CONFIG);
+    p /= "cache";
+    return p;
+  }
   case Location::F_DISPLAY_SETTINGS: {
-    auto p = GetPathFor(Location::D_USER_CONFIG);
+    auto p = ResolvePath(Location::D_USER_CONFIG);
     p /= "display.toml";
     return p;
   }
   case Location::F_LOG_SETTINGS: {
-    auto p = GetPathFor(Location::D_USER_CONFIG);
+    auto p = ResolvePath(Location::D_USER_CONFIG);
     p /= "logging.toml";
     return p;
   }
   case Location::F_IMGUI_SETTINGS: {
-    auto p = GetPathFor(Location::D_USER_CONFIG);
+    auto p = ResolvePath(Location::D_USER_CONFIG);
     p /= "imgui.ini";
     return p;
   }
   case Location::F_THEME_SETTINGS: {
-    auto p = GetPathFor(Location::D_USER_CONFIG);
+    auto p = ResolvePath(Location::D_USER_CONFIG);
     p /= "theme.toml";
     return p;
   }
+  case Location::F_THEME_SNAPSHOT: {
+    auto p = ResolvePath(Location::D_CACHE);
+    p /= "theme.snapshot";
+    return p;
+  }
+  case Location::F_ASSET_PACK: {
+    auto p = ExecutableDirectory();
+    p /= "assets.pak";
+    return p;
+  }
   }
   // Workaround only for MSVC complaining
   return std::filesystem::current_path().append("__unreachable__");
 }
 
+} // namespace
+
+auto GetPathFor(Location id) -> const std::filesystem::path & {
+  // Resolved once, the locations are looked up all the time
+  static const auto paths = []() {
+    std::array<std::filesystem::path, LOCATION_COUNT> resolved;
+    for (std::size_t index = 0; index < LOCATION_COUNT; ++index) {
+      resolved[index] = ResolvePath(static_cast<Location>(index));
+    }
+    return resolved;
+  }();
+  return paths[static_cast<std::size_t>(id)];
+}
+
 void CreateDirectories() {
   std::filesystem::create_directories(GetPathFor(Location::D_USER_CONFIG));
+  std::filesystem::create_directories(GetPathFor(Location::D_CACHE));
 }
 
 } // namespace asap::config
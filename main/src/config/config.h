@@ -13,14 +13,22 @@ namespace asap::config {
 
 enum class Location {
   D_USER_CONFIG,
+  D_CACHE,
 
   F_DISPLAY_SETTINGS,
   F_LOG_SETTINGS,
   F_IMGUI_SETTINGS,
-  F_THEME_SETTINGS
+  F_THEME_SETTINGS,
+  /// Binary snapshot of the style loaded from the theme settings.
+  F_THEME_SNAPSHOT,
+
+  /// The asset pack, next to the executable. Must remain the last location.
+  F_ASSET_PACK
 };
 
-auto GetPathFor(Location id) -> std::filesystem::path;
+/// The path of a location. The paths are resolved on first use, relative to
+/// the current directory at that time, and don't change afterwards.
+auto GetPathFor(Location id) -> const std::filesystem::path &;
 
 void CreateDirectories();
 
@@ -0,0 +1,110 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "config/config_store.h"
+
+#include <chrono> // for timing the parsing
+
+namespace asap::config {
+
+const char *const ConfigStore::LOGGER_NAME = "main";
+
+auto ConfigStore::Default() -> ConfigStore & {
+  static ConfigStore store;
+  return store;
+}
+
+auto ConfigStore::Parse(const std::filesystem::path &path) -> toml::table {
+  return toml::parse_file(path.string());
+}
+
+auto ConfigStore::Load(Location file) -> Settings {
+  const auto &path = GetPathFor(file);
+  Settings settings;
+  if (!std::filesystem::exists(path)) {
+    ASLOG(info, "file {} does not exist", path.string());
+    return settings;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  // Taken before reading the file, a change while it is parsed shows up later
+  std::error_code error;
+  settings.modified = std::filesystem::last_write_time(path, error);
+  try {
+    settings.table = Parse(path);
+    settings.loaded = true;
+    ASLOG(debug, "settings parsed from {} in {:.2f} ms", path.string(),
+        std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+  } catch (std::exception const &ex) {
+    ASLOG(error, "error {} while loading settings from {}", ex.what(),
+        path.string());
+  }
+  return settings;
+}
+
+void ConfigStore::LoadAsync(std::initializer_list<Location> files) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto file : files) {
+    if (files_.count(file) == 0) {
+      files_.emplace(
+          file, std::async(std::launch::async, &ConfigStore::Load, file));
+    }
+  }
+}
+
+auto ConfigStore::Find(Location file) -> const Settings & {
+  std::shared_future<Settings> settings;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = files_.find(file);
+    if (found == files_.end()) {
+      // Parsed by the first get() below, on this thread
+      found = files_
+                  .emplace(file,
+                      std::async(std::launch::deferred, &ConfigStore::Load,
+                          file))
+                  .first;
+    }
+    settings = found->second;
+  }
+  // The shared state, and the settings in it, live as long as the entry in
+  // the map
+  return settings.get();
+}
+
+auto ConfigStore::Table(Location file) -> const toml::table & {
+  return Find(file).table;
+}
+
+auto ConfigStore::Contains(Location file) -> bool {
+  return Find(file).loaded;
+}
+
+auto ConfigStore::ModifiedTime(Location file)
+    -> std::filesystem::file_time_type {
+  return Find(file).modified;
+}
+
+void ConfigStore::Invalidate(Location file) {
+  std::shared_future<Settings> settings;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto found = files_.find(file);
+    if (found == files_.end()) {
+      return;
+    }
+    settings = std::move(found->second);
+    files_.erase(found);
+  }
+  // Don't leave a parse running on its own
+  if (settings.valid()) {
+    settings.wait();
+  }
+}
+
+} // namespace asap::config
@@ -0,0 +1,120 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "config/config.h"
+
+#include <logging/logging.h>
+#include <toml++/toml.hpp>
+
+#include <filesystem>
+#include <future>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+
+namespace asap::config {
+
+/*!
+ * \brief A typed value in a settings file.
+ *
+ * Declared once by the component that owns the value, for example:
+ * \code
+ * const Key<bool> DISPLAY_VSYNC{Location::F_DISPLAY_SETTINGS,
+ *     "display.vsync", true};
+ * \endcode
+ */
+template <typename T> struct Key {
+  /// The settings file the value is in.
+  Location file;
+  /// Dotted path of the value in the file, as in `display.size.width`.
+  const char *path;
+  /// Used when the value is missing or has another type.
+  T default_value;
+
+  /// The value in the parsed contents of the settings file.
+  [[nodiscard]] auto In(const toml::table &settings) const -> T {
+    return settings.at_path(path).value_or(default_value);
+  }
+};
+
+/*!
+ * \brief The parsed contents of the settings files.
+ *
+ * Each settings file is parsed once. `LoadAsync()` parses a set of files on
+ * background threads, one per file, so that the startup can go on (creating
+ * the window and the OpenGL context) while they load; the components then get
+ * their values from the parsed contents, waiting only if the file is still
+ * being parsed.
+ *
+ * A missing or invalid file is logged once, and reads as an empty table so
+ * that all the keys in it take their default value.
+ *
+ * A file changed while the application runs is invalidated by the
+ * SettingsWatcher when it applies the reloaded settings, so that it is parsed
+ * again on its next use. `Invalidate()` must only be called from the thread
+ * using the tables (the UI thread), as the references returned by `Table()`
+ * are released by it.
+ */
+class ConfigStore : public asap::logging::Loggable<ConfigStore> {
+public:
+  /// The store used for all the application settings.
+  static auto Default() -> ConfigStore &;
+
+  ConfigStore() = default;
+
+  ConfigStore(const ConfigStore &) = delete;
+  ConfigStore(ConfigStore &&) = delete;
+  auto operator=(const ConfigStore &) -> ConfigStore & = delete;
+  auto operator=(ConfigStore &&) -> ConfigStore & = delete;
+
+  /// Waits for the files being parsed.
+  ~ConfigStore() = default;
+
+  /// Start parsing `files` in the background, unless already loaded.
+  void LoadAsync(std::initializer_list<Location> files);
+
+  /// The parsed contents of `file`. Loaded now if it was not requested yet;
+  /// waits for it if it is being parsed.
+  auto Table(Location file) -> const toml::table &;
+
+  /// Whether `file` exists and was parsed successfully.
+  auto Contains(Location file) -> bool;
+
+  /// Modification time of `file` when it was parsed, to tell if it changed
+  /// since.
+  auto ModifiedTime(Location file) -> std::filesystem::file_time_type;
+
+  /// The value of `key`, or its default value.
+  template <typename T> auto Get(const Key<T> &key) -> T {
+    return key.In(Table(key.file));
+  }
+
+  /// Forget the contents of `file`, to parse it again on its next use.
+  void Invalidate(Location file);
+
+  /// Parse the settings in `path`; throws if they can't be parsed.
+  static auto Parse(const std::filesystem::path &path) -> toml::table;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  struct Settings {
+    toml::table table;
+    bool loaded{false};
+    std::filesystem::file_time_type modified{};
+  };
+
+  static auto Load(Location file) -> Settings;
+  auto Find(Location file) -> const Settings &;
+
+  std::mutex mutex_;
+  std::map<Location, std::shared_future<Settings>> files_;
+};
+
+} // namespace asap::config
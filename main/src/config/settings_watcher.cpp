@@ -0,0 +1,330 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "config/settings_watcher.h"
+#include "config/config_store.h"
+#include "config/settings_writer.h"
+
+#include <contract/contract.h>
+
+#include <algorithm> // for min_element
+#include <array>     // for the inotify events buffer
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#define ASAP_SETTINGS_INOTIFY
+#else
+#include <condition_variable> // for waking up the polling
+#endif
+
+namespace asap::config {
+
+const char *const SettingsWatcher::LOGGER_NAME = "main";
+
+using Clock = std::chrono::steady_clock;
+
+/// Reports the files that changed in the watched directory.
+class SettingsWatcher::Monitor {
+public:
+  Monitor(const std::filesystem::path &directory,
+      const std::vector<std::filesystem::path> &files);
+
+  Monitor(const Monitor &) = delete;
+  Monitor(Monitor &&) = delete;
+  auto operator=(const Monitor &) -> Monitor & = delete;
+  auto operator=(Monitor &&) -> Monitor & = delete;
+
+  ~Monitor();
+
+  [[nodiscard]] auto IsValid() const -> bool;
+
+  /// Wait for changes, for at most `timeout` (forever if negative), and return
+  /// the names of the files that changed.
+  auto Wait(std::chrono::milliseconds timeout) -> std::vector<std::string>;
+
+  /// Interrupt the current, or next, `Wait()`.
+  void Wake();
+
+private:
+#if defined(ASAP_SETTINGS_INOTIFY)
+  int inotify_fd_{-1};
+  /// Self-pipe to interrupt poll().
+  std::array<int, 2> wake_pipe_{-1, -1};
+#else
+  /// Poll the modification times of the files at this interval.
+  static constexpr std::chrono::milliseconds POLL_INTERVAL{500};
+
+  std::map<std::filesystem::path, std::filesystem::file_time_type> files_;
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  bool woken_{false};
+#endif
+};
+
+#if defined(ASAP_SETTINGS_INOTIFY)
+
+SettingsWatcher::Monitor::Monitor(const std::filesystem::path &directory,
+    const std::vector<std::filesystem::path> & /*files*/)
+    : inotify_fd_(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {
+  if (inotify_fd_ < 0) {
+    return;
+  }
+  // Files written in place are reported when closed, files replaced by a
+  // rename (what most editors do) when moved in the directory.
+  if (::inotify_add_watch(inotify_fd_, directory.c_str(),
+          IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+      ::pipe2(wake_pipe_.data(), O_NONBLOCK | O_CLOEXEC) != 0) {
+    ::close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+}
+
+SettingsWatcher::Monitor::~Monitor() {
+  for (const auto fd : {inotify_fd_, wake_pipe_[0], wake_pipe_[1]}) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+auto SettingsWatcher::Monitor::IsValid() const -> bool {
+  return inotify_fd_ >= 0;
+}
+
+auto SettingsWatcher::Monitor::Wait(std::chrono::milliseconds timeout)
+    -> std::vector<std::string> {
+  std::array<pollfd, 2> fds{{{inotify_fd_, POLLIN, 0}, //
+      {wake_pipe_[0], POLLIN, 0}}};
+  const auto timeout_ms =
+      timeout.count() < 0 ? -1 : static_cast<int>(timeout.count());
+  std::vector<std::string> changed;
+  if (::poll(fds.data(), fds.size(), timeout_ms) <= 0) {
+    return changed;
+  }
+
+  std::array<char, 64> drain{};
+  while (::read(wake_pipe_[0], drain.data(), drain.size()) > 0) {
+    // Only wakes up the thread
+  }
+  alignas(inotify_event) std::array<char, 4096> buffer{};
+  ssize_t length = 0;
+  while ((length = ::read(inotify_fd_, buffer.data(), buffer.size())) > 0) {
+    for (ssize_t offset = 0; offset < length;) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      const auto *event = reinterpret_cast<const inotify_event *>(
+          buffer.data() + offset); // NOLINT
+      if (event->len > 0) {
+        changed.emplace_back(event->name); // NOLINT
+      }
+      offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+    }
+  }
+  return changed;
+}
+
+void SettingsWatcher::Monitor::Wake() {
+  const char byte = 0;
+  [[maybe_unused]] const auto written = ::write(wake_pipe_[1], &byte, 1);
+}
+
+#else
+
+SettingsWatcher::Monitor::Monitor(const std::filesystem::path & /*directory*/,
+    const std::vector<std::filesystem::path> &files) {
+  for (const auto &file : files) {
+    std::error_code error;
+    files_[file] = std::filesystem::last_write_time(file, error);
+  }
+}
+
+SettingsWatcher::Monitor::~Monitor() = default;
+
+auto SettingsWatcher::Monitor::IsValid() const -> bool {
+  return true;
+}
+
+auto SettingsWatcher::Monitor::Wait(std::chrono::milliseconds timeout)
+    -> std::vector<std::string> {
+  {
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    const auto wait = timeout.count() < 0 ? POLL_INTERVAL
+                                          : std::min(timeout, POLL_INTERVAL);
+    wake_.wait_for(lock, wait, [this]() { return woken_; });
+    woken_ = false;
+  }
+  std::vector<std::string> changed;
+  for (auto &[file, mtime] : files_) {
+    std::error_code error;
+    const auto current = std::filesystem::last_write_time(file, error);
+    if (!error && current != mtime) {
+      mtime = current;
+      changed.push_back(file.filename().string());
+    }
+  }
+  return changed;
+}
+
+void SettingsWatcher::Monitor::Wake() {
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    woken_ = true;
+  }
+  wake_.notify_one();
+}
+
+#endif // ASAP_SETTINGS_INOTIFY
+
+SettingsWatcher::SettingsWatcher(std::chrono::milliseconds debounce)
+    : debounce_(debounce) {
+}
+
+SettingsWatcher::~SettingsWatcher() {
+  Stop();
+}
+
+void SettingsWatcher::Watch(Location file, Parser parser) {
+  ASAP_ASSERT(!IsRunning(), "call Watch() before Start()");
+  auto path = GetPathFor(file);
+  auto name = path.filename().string();
+  watched_[name] = {std::move(path), file, std::move(parser)};
+}
+
+void SettingsWatcher::Start() {
+  if (IsRunning() || watched_.empty()) {
+    return;
+  }
+  const auto directory = GetPathFor(Location::D_USER_CONFIG);
+  std::vector<std::filesystem::path> files;
+  files.reserve(watched_.size());
+  for (const auto &watched : watched_) {
+    files.push_back(watched.second.path);
+  }
+  monitor_ = std::make_unique<Monitor>(directory, files);
+  if (!monitor_->IsValid()) {
+    ASLOG(warn, "can't watch {}, settings will not be reloaded",
+        directory.string());
+    monitor_.reset();
+    return;
+  }
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread([this]() { Run(); });
+  ASLOG(debug, "watching {} settings files in {}", watched_.size(),
+      directory.string());
+}
+
+void SettingsWatcher::Stop() {
+  if (!IsRunning()) {
+    return;
+  }
+  running_.store(false, std::memory_order_release);
+  monitor_->Wake();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  monitor_.reset();
+  std::lock_guard<std::mutex> lock(updates_mutex_);
+  updates_.clear();
+}
+
+auto SettingsWatcher::ApplyPending() -> std::size_t {
+  std::vector<std::pair<std::string, Update>> updates;
+  {
+    std::lock_guard<std::mutex> lock(updates_mutex_);
+    updates.swap(updates_);
+  }
+  std::size_t applied = 0;
+  for (auto &[name, update] : updates) {
+    // Whoever reads the file from the store next gets the new contents
+    ConfigStore::Default().Invalidate(watched_.at(name).file);
+    if (update) {
+      update();
+      ++applied;
+    }
+  }
+  return applied;
+}
+
+void SettingsWatcher::Run() {
+  // When each changed file will be considered stable and reloaded
+  std::map<std::string, Clock::time_point> deadlines;
+  while (running_.load(std::memory_order_acquire)) {
+    auto timeout = std::chrono::milliseconds{-1};
+    if (!deadlines.empty()) {
+      const auto next = std::min_element(deadlines.begin(), deadlines.end(),
+          [](const auto &lhs, const auto &rhs) {
+            return lhs.second < rhs.second;
+          });
+      timeout = std::max(std::chrono::milliseconds{0},
+          std::chrono::ceil<std::chrono::milliseconds>(
+              next->second - Clock::now()));
+    }
+
+    for (const auto &name : monitor_->Wait(timeout)) {
+      if (watched_.count(name) != 0) {
+        // Restart the debounce delay on every change
+        deadlines[name] = Clock::now() + debounce_;
+      }
+    }
+
+    const auto now = Clock::now();
+    for (auto deadline = deadlines.begin(); deadline != deadlines.end();) {
+      if (deadline->second <= now &&
+          running_.load(std::memory_order_acquire)) {
+        Reload(deadline->first);
+        deadline = deadlines.erase(deadline);
+      } else {
+        ++deadline;
+      }
+    }
+  }
+}
+
+void SettingsWatcher::Reload(const std::string &name) {
+  const auto &watched = watched_.at(name);
+  const auto &path = watched.path;
+  const auto start = Clock::now();
+  Update update;
+  if (SettingsWriter::Default().IsOwnWrite(path)) {
+    // The application's own saves, the autosave in particular, hold the
+    // settings it already has
+    ASLOG(debug, "{} was saved by the application, not reloaded",
+        path.string());
+  } else {
+    try {
+      update = watched.parser(path);
+      if (update) {
+        ASLOG(info, "settings reloaded from {} in {:.2f} ms", path.string(),
+            std::chrono::duration<double, std::milli>(Clock::now() - start)
+                .count());
+      } else {
+        ASLOG(debug, "{} changed, nothing to reload", path.string());
+      }
+    } catch (std::exception const &ex) {
+      ASLOG(error, "error {} while reloading settings from {}", ex.what(),
+          path.string());
+    }
+  }
+
+  // Queued even without an update: the file changed, so the UI thread drops
+  // its old contents from the ConfigStore. A newer version of the file
+  // replaces the update not applied yet.
+  std::lock_guard<std::mutex> lock(updates_mutex_);
+  const auto pending = std::find_if(updates_.begin(), updates_.end(),
+      [&name](const auto &queued) { return queued.first == name; });
+  if (pending != updates_.end()) {
+    if (update) {
+      pending->second = std::move(update);
+    }
+  } else {
+    updates_.emplace_back(name, std::move(update));
+  }
+}
+
+} // namespace asap::config
@@ -0,0 +1,113 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "config/config.h"
+
+#include <logging/logging.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace asap::config {
+
+/*!
+ * \brief Watches the settings files in the user config directory and reloads
+ * them while the application is running.
+ *
+ * Each watched file has a parser, which runs on the watcher thread once the
+ * file stopped changing for the debounce delay (editors often write a file in
+ * several steps). The parser reads the file and returns the update to apply,
+ * which is queued and run on the UI thread by `ApplyPending()`, between two
+ * frames. The parsing, the expensive part, never blocks a frame. The updates
+ * compare the new settings with the current ones and only change what
+ * differs.
+ *
+ * On Linux, the directory is watched with inotify. Elsewhere, the modification
+ * times of the watched files are polled.
+ *
+ * `Watch()`, `Start()`, `Stop()` and `ApplyPending()` must be called from the
+ * UI thread.
+ */
+class SettingsWatcher : public asap::logging::Loggable<SettingsWatcher> {
+public:
+  /// Work to do on the UI thread to apply reloaded settings.
+  using Update = std::function<void()>;
+  /// Read a settings file, on the watcher thread. Return an empty update when
+  /// there is nothing to apply.
+  using Parser = std::function<Update(const std::filesystem::path &file)>;
+
+  static constexpr std::chrono::milliseconds DEFAULT_DEBOUNCE{200};
+
+  explicit SettingsWatcher(
+      std::chrono::milliseconds debounce = DEFAULT_DEBOUNCE);
+
+  SettingsWatcher(const SettingsWatcher &) = delete;
+  SettingsWatcher(SettingsWatcher &&) = delete;
+  auto operator=(const SettingsWatcher &) -> SettingsWatcher & = delete;
+  auto operator=(SettingsWatcher &&) -> SettingsWatcher & = delete;
+
+  ~SettingsWatcher();
+
+  /// Reload `file` with `parser` when it changes. Must be called before
+  /// `Start()`.
+  void Watch(Location file, Parser parser);
+
+  /// Start watching on a background thread.
+  void Start();
+
+  /// Stop watching and drop the pending updates. Call it before the
+  /// application saves its own settings, so that they are not reloaded.
+  void Stop();
+
+  /// Run the updates parsed since the last call, and drop the contents of the
+  /// changed files kept by the ConfigStore. Return how many updates were run.
+  auto ApplyPending() -> std::size_t;
+
+  [[nodiscard]] auto IsRunning() const -> bool {
+    return running_.load(std::memory_order_acquire);
+  }
+
+  static const char *const LOGGER_NAME;
+
+  class Monitor;
+
+private:
+  struct Watched {
+    std::filesystem::path path;
+    Location file;
+    Parser parser;
+  };
+
+  void Run();
+  void Reload(const std::string &name);
+
+  std::chrono::milliseconds debounce_;
+  /// The watched files, by file name.
+  std::map<std::string, Watched> watched_;
+
+  std::unique_ptr<Monitor> monitor_;
+  std::thread worker_;
+  std::atomic<bool> running_{false};
+
+  std::mutex updates_mutex_;
+  /// Files that changed, with the update to apply if any, waiting for the UI
+  /// thread. At most one per file.
+  std::vector<std::pair<std::string, Update>> updates_;
+};
+
+} // namespace asap::config
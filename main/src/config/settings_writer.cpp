@@ -0,0 +1,292 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "config/settings_writer.h"
+
+#include <algorithm> // for find_if
+#include <cerrno>    // for EINTR
+#include <fstream>   // for reading the previous contents
+#include <iterator>  // for istreambuf_iterator
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace asap::config {
+
+const char *const SettingsWriter::LOGGER_NAME = "main";
+
+namespace {
+
+/// 64-bit FNV-1a, good enough to detect changes in the settings files.
+auto Hash(const std::string &data) -> std::uint64_t {
+  constexpr std::uint64_t PRIME = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto byte : data) {
+    hash ^= static_cast<unsigned char>(byte);
+    hash *= PRIME;
+  }
+  return hash;
+}
+
+/// Identifies the version of a file on the disk without reading it.
+auto FileStamp(const std::filesystem::path &path)
+    -> std::pair<std::filesystem::file_time_type, std::uintmax_t> {
+  std::error_code error;
+  const auto mtime = std::filesystem::last_write_time(path, error);
+  const auto size = std::filesystem::file_size(path, error);
+  return {mtime, error ? 0 : size};
+}
+
+auto ReadFile(const std::filesystem::path &path) -> std::optional<std::string> {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return std::nullopt;
+  }
+  return std::string(
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>{});
+}
+
+} // namespace
+
+auto SettingsWriter::Default() -> SettingsWriter & {
+  static SettingsWriter writer;
+  return writer;
+}
+
+SettingsWriter::SettingsWriter() : worker_([this]() { Run(); }) {
+}
+
+SettingsWriter::~SettingsWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_one();
+  worker_.join();
+}
+
+void SettingsWriter::Write(
+    Location file, Serializer serializer, Capture capture) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto queued = std::find_if(queue_.begin(), queue_.end(),
+        [file](const auto &write) { return write.file == file; });
+    if (queued != queue_.end()) {
+      queued->serializer = std::move(serializer);
+      if (capture != Capture::AUTOSAVE || queued->capture != Capture::SAVE) {
+        queued->capture = capture;
+      }
+    } else {
+      queue_.push_back({file, std::move(serializer), capture});
+    }
+  }
+  wake_.notify_one();
+}
+
+void SettingsWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+}
+
+void SettingsWriter::SetAutosaveInterval(std::chrono::seconds interval) {
+  autosave_interval_ = interval;
+  next_autosave_ = Clock::now() + interval;
+}
+
+auto SettingsWriter::AutosaveDue() -> bool {
+  if (autosave_interval_.count() == 0) {
+    return false;
+  }
+  const auto now = Clock::now();
+  if (now < next_autosave_) {
+    return false;
+  }
+  next_autosave_ = now + autosave_interval_;
+  return true;
+}
+
+void SettingsWriter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+    // Complete the queued writes before stopping
+    if (queue_.empty()) {
+      break;
+    }
+    auto writes = std::move(queue_);
+    queue_.clear();
+    busy_ = true;
+    lock.unlock();
+    for (const auto &write : writes) {
+      Save(GetPathFor(write.file), write.serializer, write.capture);
+    }
+    lock.lock();
+    busy_ = false;
+    if (queue_.empty()) {
+      idle_.notify_all();
+    }
+  }
+}
+
+void SettingsWriter::Save(const std::filesystem::path &path,
+    const Serializer &serializer, Capture capture) {
+  std::string contents;
+  try {
+    contents = serializer();
+  } catch (std::exception const &ex) {
+    ASLOG(error, "error {} while saving settings to {}", ex.what(),
+        path.string());
+    return;
+  }
+  const auto hash = Hash(contents);
+
+  const auto stamp = FileStamp(path);
+  auto known = known_.find(path);
+  if (capture == Capture::AUTOSAVE) {
+    const auto captured = captured_.find(path);
+    if (captured != captured_.end() && captured->second == hash) {
+      ASLOG(trace, "settings for {} did not change", path.string());
+      return;
+    }
+    if (known != known_.end() && known->second.stamp != stamp) {
+      ASLOG(debug, "{} changed on the disk, not overwritten by the autosave",
+          path.string());
+      return;
+    }
+  }
+
+  // Only read the file again when it was modified since it was last seen,
+  // for example by the user editing it
+  if (known == known_.end() || known->second.stamp != stamp) {
+    std::optional<std::uint64_t> previous_hash;
+    if (const auto previous = ReadFile(path)) {
+      previous_hash = Hash(*previous);
+    }
+    known =
+        known_.insert_or_assign(path, KnownContents{stamp, previous_hash})
+            .first;
+  }
+  if (capture == Capture::LOADED || known->second.hash == hash) {
+    captured_.insert_or_assign(path, hash);
+    if (capture != Capture::LOADED) {
+      ASLOG(trace, "settings in {} are unchanged", path.string());
+    }
+    return;
+  }
+
+  // Recorded before the rename, which the settings watcher is notified of
+  {
+    std::lock_guard<std::mutex> lock(written_mutex_);
+    written_.insert_or_assign(path, hash);
+  }
+  if (WriteAtomically(path, contents)) {
+    known_.insert_or_assign(path, KnownContents{FileStamp(path), hash});
+    captured_.insert_or_assign(path, hash);
+    ASLOG(debug, "settings saved to {}", path.string());
+  } else {
+    std::lock_guard<std::mutex> lock(written_mutex_);
+    written_.erase(path);
+  }
+}
+
+auto SettingsWriter::IsOwnWrite(const std::filesystem::path &path) -> bool {
+  std::optional<std::uint64_t> written;
+  {
+    std::lock_guard<std::mutex> lock(written_mutex_);
+    const auto found = written_.find(path);
+    if (found != written_.end()) {
+      written = found->second;
+    }
+  }
+  if (!written) {
+    return false;
+  }
+  const auto contents = ReadFile(path);
+  return contents && Hash(*contents) == *written;
+}
+
+auto SettingsWriter::WriteAtomically(
+    const std::filesystem::path &path, const std::string &contents) -> bool {
+  auto temp_path = path;
+  temp_path += ".tmp";
+  std::error_code error;
+
+#if defined(_WIN32)
+  auto *file = ::CreateFileW(temp_path.c_str(), GENERIC_WRITE, 0, nullptr,
+      CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) { // NOLINT
+    ASLOG(error, "could not write settings to {}", temp_path.string());
+    return false;
+  }
+  DWORD written = 0;
+  const auto complete =
+      ::WriteFile(file, contents.data(), static_cast<DWORD>(contents.size()),
+          &written, nullptr) != 0 &&
+      written == contents.size() && ::FlushFileBuffers(file) != 0;
+  ::CloseHandle(file);
+  if (!complete || ::MoveFileExW(temp_path.c_str(), path.c_str(),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ==
+                       0) {
+    ASLOG(error, "could not write settings to {}", path.string());
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+#else
+  const auto fd = ::open(temp_path.c_str(), // NOLINT
+      O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    ASLOG(error, "could not write settings to {}", temp_path.string());
+    return false;
+  }
+  const auto *data = contents.data();
+  auto remaining = contents.size();
+  auto complete = true;
+  while (remaining > 0) {
+    const auto written = ::write(fd, data, remaining);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      complete = false;
+      break;
+    }
+    data += written; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    remaining -= static_cast<std::size_t>(written);
+  }
+  // The contents must be on the disk before the rename makes them visible
+  complete = complete && ::fsync(fd) == 0;
+  complete = ::close(fd) == 0 && complete;
+  if (!complete) {
+    ASLOG(error, "could not write settings to {}", temp_path.string());
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+  std::filesystem::rename(temp_path, path, error);
+  if (error) {
+    ASLOG(error, "could not write settings to {}: {}", path.string(),
+        error.message());
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+  // Persist the rename itself
+  const auto directory = ::open(path.parent_path().c_str(), // NOLINT
+      O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (directory >= 0) {
+    ::fsync(directory);
+    ::close(directory);
+  }
+#endif
+  return true;
+}
+
+} // namespace asap::config
@@ -0,0 +1,160 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "config/config.h"
+
+#include <logging/logging.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace asap::config {
+
+/*!
+ * \brief Writes the settings files on a background thread.
+ *
+ * The components capture their settings by value on the UI thread, which is
+ * cheap, and queue a serializer that builds the file contents from them. The
+ * serialization and the file I/O happen on the writer thread.
+ *
+ * A file is only written when its contents changed, as found by comparing the
+ * hash of the new contents with the one of the contents last read or written.
+ * Files are written to a temporary file, flushed to the disk and renamed over
+ * the previous version, so that a crash while writing never leaves a truncated
+ * settings file behind.
+ *
+ * The writer also keeps the autosave schedule: `AutosaveDue()`, checked once
+ * per frame, tells when to capture the settings again. An autosave only
+ * writes the settings changed in the application since they were loaded or
+ * written, and leaves alone a file modified on the disk in the meantime, for
+ * the settings watcher to reload; edits made by hand, including to settings
+ * only read at startup, are not overwritten. The settings watcher, in turn,
+ * asks `IsOwnWrite()` to not reload the files written here.
+ */
+class SettingsWriter : public asap::logging::Loggable<SettingsWriter> {
+public:
+  /// Produces the contents of a settings file, on the writer thread. Must only
+  /// use what it captured by value.
+  using Serializer = std::function<std::string()>;
+
+  /// Why settings are captured for a file.
+  enum class Capture {
+    /// Write the file when its contents differ from the settings.
+    SAVE,
+    /// Write the file only when the settings changed since they were loaded
+    /// or written, and the file did not change on the disk since.
+    AUTOSAVE,
+    /// The settings were just loaded from the file, only remember them.
+    LOADED,
+  };
+
+  static constexpr std::chrono::seconds DEFAULT_AUTOSAVE_INTERVAL{60};
+
+  /// The writer used for all the application settings.
+  static auto Default() -> SettingsWriter &;
+
+  SettingsWriter();
+
+  SettingsWriter(const SettingsWriter &) = delete;
+  SettingsWriter(SettingsWriter &&) = delete;
+  auto operator=(const SettingsWriter &) -> SettingsWriter & = delete;
+  auto operator=(SettingsWriter &&) -> SettingsWriter & = delete;
+
+  /// Finish the queued writes and stop the writer thread.
+  ~SettingsWriter();
+
+  /// Queue a write of `file`. A write of the same file that did not start yet
+  /// is replaced, but an autosave does not downgrade a queued save.
+  void Write(
+      Location file, Serializer serializer, Capture capture = Capture::SAVE);
+
+  /// Wait for all the queued writes to complete.
+  void Flush();
+
+  /// Capture the settings every `interval`; zero disables the autosave.
+  void SetAutosaveInterval(std::chrono::seconds interval);
+
+  /// Return true, once per autosave interval, when the settings should be
+  /// captured and written. Cheap enough to be called every frame.
+  auto AutosaveDue() -> bool;
+
+  /// Whether the file at `path` holds the contents last written by the writer,
+  /// which makes a change notified for it the writer's own. Reads the file,
+  /// can be called from any thread.
+  auto IsOwnWrite(const std::filesystem::path &path) -> bool;
+
+  /*!
+   * \brief Replace the contents of `path` with `contents`, atomically.
+   *
+   * The contents are written to a temporary file next to `path`, which is
+   * synced to the disk and renamed to `path`. Return false, leaving `path`
+   * untouched, on failure.
+   */
+  static auto WriteAtomically(
+      const std::filesystem::path &path, const std::string &contents) -> bool;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct QueuedWrite {
+    Location file;
+    Serializer serializer;
+    Capture capture;
+  };
+
+  void Run();
+  void Save(const std::filesystem::path &path, const Serializer &serializer,
+      Capture capture);
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable idle_;
+  std::vector<QueuedWrite> queue_;
+  bool busy_{false};
+  bool stop_{false};
+
+  /// The contents of a file, as last read or written.
+  struct KnownContents {
+    /// Modification time and size of the file.
+    std::pair<std::filesystem::file_time_type, std::uintmax_t> stamp;
+    /// Unset when the file does not exist.
+    std::optional<std::uint64_t> hash;
+  };
+  /// Only used by the writer thread.
+  std::map<std::filesystem::path, KnownContents> known_;
+  /// Hash of the settings of each file as last loaded or written, to tell
+  /// whether they changed in the application since. Only used by the writer
+  /// thread.
+  std::map<std::filesystem::path, std::uint64_t> captured_;
+
+  std::mutex written_mutex_;
+  /// Hash of the contents last written to each file, guarded by
+  /// `written_mutex_`.
+  std::map<std::filesystem::path, std::uint64_t> written_;
+
+  std::chrono::seconds autosave_interval_{0};
+  Clock::time_point next_autosave_;
+
+  /// Started last, once all the members are initialized.
+  std::thread worker_;
+};
+
+} // namespace asap::config
@@ -6,15 +6,18 @@
 //   https://opensource.org/licenses/BSD-3-Clause)
 
 #include "example_application.h"
+#include "app/gl_debug.h"
+#include "assets/asset_store.h"
 #include "logging/logging.h"
 
 #include <GLFW/glfw3.h>
+#include <glad/gl_state.h>
 #include <glm/gtc/matrix_transform.hpp> // glm::translate, glm::rotate, glm::scale, glm::perspective
 #include <glm/mat4x4.hpp> // glm::mat4
 #include <glm/vec3.hpp>   // glm::vec3
 #include <imgui/imgui.h>
 
-#include <cstdint> // for unitptr_t
+#include <algorithm> // for std::max
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
 
@@ -30,40 +33,9 @@ const struct {
     // clang-format on
 };
 
-// clang-format off
-const char *const VERTEX_SHADER_TEXT =
-"#version 150\n"
-"uniform mat4 MVP;\n"
-"in vec3 vCol;\n"
-"in vec2 vPos;\n"
-"out vec3 color;\n"
-"void main()\n"
-"{\n"
-"    gl_Position = MVP * vec4(vPos, 0.0, 1.0);\n"
-"    color = vCol;\n"
-"}\n";
-// clang-format on
-
-// clang-format off
-const char *const FRAGMENT_SHADER_TEXT =
-"#version 150\n"
-"in vec3 color;\n"
-"out vec4 colorOut;\n"
-"void main()\n"
-"{\n"
-"    colorOut = vec4(color, 1.0);\n"
-"}\n";
-// clang-format on
-
-auto OpenGLErrorCheck() -> GLenum {
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-  static auto &logger = asap::logging::Registry::GetLogger("main");
-  auto code = glGetError();
-  if (code != GL_NO_ERROR) {
-    ASLOG_TO_LOGGER(logger, error, "OpenGL error: {}", code);
-  }
-  return code;
-}
+/// The shaders, from the asset pack.
+constexpr const char *VERTEX_SHADER_ASSET = "shaders/example.vert";
+constexpr const char *FRAGMENT_SHADER_ASSET = "shaders/example.frag";
 
 } // namespace
 
@@ -73,14 +45,22 @@ auto ExampleApplication::Draw() -> bool {
   if (ImGui::GetIO().DisplaySize.y > 0) {
     if (ImGui::Begin("OpenGL Render")) {
       auto wsize = ImGui::GetWindowSize();
-
-      glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
+      // The texture is only re-allocated when the window is resized
+      auto &textures = asap::ui::TextureManager::Default();
+      const auto width = std::max(1, static_cast<int>(wsize.x));
+      const auto height = std::max(1, static_cast<int>(wsize.y));
+      const auto target_size = textures.GetSize(texColorBuffer_);
+      const auto resized = static_cast<int>(target_size.x) != width ||
+                           static_cast<int>(target_size.y) != height;
+      textures.Resize(texColorBuffer_, width, height);
+
+      asap::gl::BindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
+      if (resized) {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+            GL_TEXTURE_2D, textures.GlName(texColorBuffer_), 0);
+      }
       // Define the viewport dimensions
-      glBindTexture(GL_TEXTURE_2D, texColorBuffer_);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, static_cast<GLsizei>(wsize.x),
-          static_cast<GLsizei>(wsize.y), 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
-      glBindTexture(GL_TEXTURE_2D, 0);
-      glViewport(
+      asap::gl::Viewport(
           0, 0, static_cast<GLsizei>(wsize.x), static_cast<GLsizei>(wsize.y));
 
       // now that we actually created the framebuffer and added all attachments
@@ -88,7 +68,9 @@ auto ExampleApplication::Draw() -> bool {
       if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
         ASLOG(error, "ERROR::FRAMEBUFFER:: Framebuffer is not complete!");
       }
-      // Render
+      // Render, over the state left by the ImGui renderer
+      asap::gl::Disable(GL_SCISSOR_TEST);
+      asap::gl::Disable(GL_BLEND);
       // Clear the colorbuffer
       glClearColor(0.2F, 0.2F, 0.3F, 1.0F);
       glClear(GL_COLOR_BUFFER_BIT); // we're not using the stencil buffer now
@@ -106,19 +88,16 @@ auto ExampleApplication::Draw() -> bool {
       glm::mat4 Model = glm::scale(glm::mat4(1.0F), glm::vec3(0.5F));
       glm::mat4 mvp = Projection * View * Model;
 
-      glUseProgram(program);
+      asap::gl::UseProgram(program);
       glUniformMatrix4fv(mvp_location, 1, GL_FALSE, &mvp[0][0]);
-      glBindVertexArray(VAO);
+      asap::gl::BindVertexArray(VAO);
       glDrawArrays(GL_TRIANGLES, 0, 3);
+      ASAP_GL_CHECK();
 
-      glBindVertexArray(0);
-      glBindFramebuffer(GL_FRAMEBUFFER, 0); // back to default
+      asap::gl::BindFramebuffer(GL_FRAMEBUFFER, 0); // back to default
 
       ImVec2 pos = ImGui::GetCursorScreenPos();
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,
-      // performance-no-int-to-ptr)
-      ImGui::GetWindowDrawList()->AddImage(
-          reinterpret_cast<ImTextureID>(texColorBuffer_), pos,
+      ImGui::GetWindowDrawList()->AddImage(textures.Use(texColorBuffer_), pos,
           ImVec2(pos.x + wsize.x, pos.y + wsize.y), ImVec2(0, 1), ImVec2(1, 0));
     }
     ImGui::End();
@@ -130,15 +109,23 @@ auto ExampleApplication::Draw() -> bool {
 void ExampleApplication::AfterInit() {
 
   glGenVertexArrays(1, &VAO);
-  glBindVertexArray(VAO);
+  asap::gl::BindVertexArray(VAO);
 
   glGenBuffers(1, &VBO);
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  asap::gl::BindBuffer(GL_ARRAY_BUFFER, VBO);
   glBufferData(GL_ARRAY_BUFFER, sizeof(VERTICES),
       static_cast<const void *>(VERTICES), GL_STATIC_DRAW);
 
+  // The shader sources are used in place from the asset pack, they are not
+  // null terminated
+  auto &assets = asap::assets::AssetStore::Default();
+  const auto vertex_shader_text = assets.GetText(VERTEX_SHADER_ASSET);
+  const auto *vertex_shader_source = vertex_shader_text.data();
+  const auto vertex_shader_length =
+      static_cast<GLint>(vertex_shader_text.size());
   auto vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertex_shader, 1, &VERTEX_SHADER_TEXT, nullptr);
+  glShaderSource(
+      vertex_shader, 1, &vertex_shader_source, &vertex_shader_length);
   glCompileShader(vertex_shader);
   GLint isCompiled = 0;
   glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &isCompiled);
@@ -155,8 +142,13 @@ void ExampleApplication::AfterInit() {
     ASLOG(error, "GL COMPILE ERROR: {}", errorLog.data());
   }
 
+  const auto fragment_shader_text = assets.GetText(FRAGMENT_SHADER_ASSET);
+  const auto *fragment_shader_source = fragment_shader_text.data();
+  const auto fragment_shader_length =
+      static_cast<GLint>(fragment_shader_text.size());
   auto fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragment_shader, 1, &FRAGMENT_SHADER_TEXT, nullptr);
+  glShaderSource(
+      fragment_shader, 1, &fragment_shader_source, &fragment_shader_length);
   glCompileShader(fragment_shader);
   glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &isCompiled);
   if (isCompiled == GL_FALSE) {
@@ -188,7 +180,7 @@ void ExampleApplication::AfterInit() {
     glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
 
     // The program is useless now. So delete it.
-    glDeleteProgram(program);
+    asap::gl::DeleteProgram(program);
 
     // Provide the infolog in whatever manner you deem best.
     // Exit with failure.
@@ -213,35 +205,32 @@ void ExampleApplication::AfterInit() {
   // modify this VAO, but this rarely happens. Modifying other VAOs requires a
   // call to glBindVertexArray anyways so we generally don't unbind VAOs (nor
   // VBOs) when it's not directly necessary.
-  glBindVertexArray(0);
+  asap::gl::BindVertexArray(0);
 
   glGenFramebuffers(1, &frameBuffer_);
-  glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
-
-  // generate texture
-  glGenTextures(1, &texColorBuffer_);
-  glBindTexture(GL_TEXTURE_2D, texColorBuffer_);
-  // We'll set the texture size just before the draw happens based on the window
-  // size.
-  //  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1280, 760, 0, GL_RGB,
-  //  GL_UNSIGNED_BYTE, NULL);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glBindTexture(GL_TEXTURE_2D, 0);
+  asap::gl::BindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
+
+  // generate texture, pinned as it is drawn into every frame. It is resized
+  // to the window just before the draw happens.
+  auto &textures = asap::ui::TextureManager::Default();
+  asap::ui::TextureManager::Options options;
+  options.pinned = true;
+  texColorBuffer_ = textures.Create(1, 1, options);
 
   // attach it to currently bound framebuffer object
-  glFramebufferTexture2D(
-      GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texColorBuffer_, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+      textures.GlName(texColorBuffer_), 0);
 
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  asap::gl::BindFramebuffer(GL_FRAMEBUFFER, 0);
+  ASAP_GL_CHECK();
 }
 
 void ExampleApplication::BeforeShutDown() {
   // Properly de-allocate all resources once they've outlived their purpose
-  glDeleteVertexArrays(1, &VAO);
-  glDeleteBuffers(1, &VBO);
-  glDeleteTextures(1, &texColorBuffer_);
-  glDeleteFramebuffers(1, &frameBuffer_);
+  asap::gl::DeleteVertexArrays(1, &VAO);
+  asap::gl::DeleteBuffers(1, &VBO);
+  asap::ui::TextureManager::Default().Release(texColorBuffer_);
+  asap::gl::DeleteFramebuffers(1, &frameBuffer_);
 }
 
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
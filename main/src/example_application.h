@@ -8,6 +8,7 @@
 #pragma once
 
 #include "application_base.h"
+#include "ui/textures/texture_manager.h"
 
 #include <glad/gl.h>
 
@@ -42,5 +43,6 @@ private:
   GLuint program = 0;
   GLint mvp_location = -1, vpos_location = -1, vcol_location = -1;
   GLuint frameBuffer_ = 0;
-  GLuint texColorBuffer_ = 0;
+  /// The render target, pinned in the texture manager.
+  asap::ui::TextureManager::Handle texColorBuffer_;
 };
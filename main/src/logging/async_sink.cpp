@@ -0,0 +1,177 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "logging/async_sink.h"
+
+#include <contract/contract.h>
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+namespace asap::logging {
+
+namespace {
+
+/// Value of a worker slot in `in_flight_` when the worker is idle.
+constexpr auto NO_RECORD = std::numeric_limits<std::uint64_t>::max();
+
+} // namespace
+
+auto OverflowPolicyFromString(std::string_view name)
+    -> std::optional<OverflowPolicy> {
+  if (name == "block") {
+    return OverflowPolicy::BLOCK;
+  }
+  if (name == "overrun-oldest") {
+    return OverflowPolicy::OVERRUN_OLDEST;
+  }
+  if (name == "discard-new") {
+    return OverflowPolicy::DISCARD_NEW;
+  }
+  return std::nullopt;
+}
+
+auto ToString(OverflowPolicy policy) -> const char * {
+  switch (policy) {
+  case OverflowPolicy::BLOCK:
+    return "block";
+  case OverflowPolicy::OVERRUN_OLDEST:
+    return "overrun-oldest";
+  case OverflowPolicy::DISCARD_NEW:
+    return "discard-new";
+  }
+  return "block";
+}
+
+AsyncSink::AsyncSink(std::shared_ptr<spdlog::sinks::sink> target,
+    const AsyncSettings &settings)
+    : target_(std::move(target)),
+      capacity_(std::max<std::size_t>(settings.queue_size, 1)),
+      overflow_policy_(settings.overflow_policy) {
+  ASAP_ASSERT(target_ != nullptr);
+  const auto workers = std::max<std::size_t>(settings.workers, 1);
+  in_flight_.assign(workers, NO_RECORD);
+  workers_.reserve(workers);
+  for (std::size_t slot = 0; slot < workers; ++slot) {
+    workers_.emplace_back([this, slot]() { Run(slot); });
+  }
+}
+
+AsyncSink::~AsyncSink() {
+  Shutdown();
+}
+
+void AsyncSink::log(const spdlog::details::log_msg &msg) {
+  if (!target_->should_log(msg.level)) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (stopped_) {
+    lock.unlock();
+    target_->log(msg);
+    return;
+  }
+  if (queue_.size() >= capacity_) {
+    switch (overflow_policy_) {
+    case OverflowPolicy::BLOCK:
+      not_full_.wait(
+          lock, [this]() { return queue_.size() < capacity_ || stopped_; });
+      if (stopped_) {
+        lock.unlock();
+        target_->log(msg);
+        return;
+      }
+      break;
+    case OverflowPolicy::OVERRUN_OLDEST:
+      queue_.pop_front();
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      // Somebody may be waiting in flush() for the dropped record
+      progress_.notify_all();
+      break;
+    case OverflowPolicy::DISCARD_NEW:
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  queue_.push_back({next_sequence_++, spdlog::details::log_msg_buffer(msg)});
+  lock.unlock();
+  not_empty_.notify_one();
+}
+
+void AsyncSink::flush() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto last = next_sequence_;
+    progress_.wait(lock, [this, last]() { return OldestPending() >= last; });
+  }
+  target_->flush();
+}
+
+void AsyncSink::set_pattern(const std::string &pattern) {
+  target_->set_pattern(pattern);
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter) {
+  target_->set_formatter(std::move(formatter));
+}
+
+void AsyncSink::Shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return;
+    }
+    stopped_ = true;
+  }
+  // The workers finish the queued records before exiting
+  not_empty_.notify_all();
+  not_full_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  target_->flush();
+}
+
+auto AsyncSink::OldestPending() const -> std::uint64_t {
+  auto oldest = queue_.empty() ? next_sequence_ : queue_.front().sequence;
+  for (const auto sequence : in_flight_) {
+    oldest = std::min(oldest, sequence);
+  }
+  return oldest;
+}
+
+void AsyncSink::Run(std::size_t slot) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    not_empty_.wait(lock, [this]() { return !queue_.empty() || stopped_; });
+    if (queue_.empty()) {
+      // Stopped and nothing left to do
+      break;
+    }
+    auto queued = std::move(queue_.front());
+    queue_.pop_front();
+    in_flight_[slot] = queued.sequence;
+    lock.unlock();
+    not_full_.notify_one();
+
+    try {
+      target_->log(queued.record);
+    } catch (const std::exception & /*ex*/) {
+      // Same as spdlog, a failing sink must not take the application down. We
+      // cannot log from here without risking to loop on the failure.
+    }
+
+    lock.lock();
+    in_flight_[slot] = NO_RECORD;
+    progress_.notify_all();
+  }
+}
+
+} // namespace asap::logging
@@ -0,0 +1,138 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Asynchronous sink for the loggers of the logging `Registry`.
+ *
+ * All the loggers obtained through `asap::logging::Registry::GetLogger` share
+ * the sink pushed with `Registry::PushSink`. Pushing an `AsyncSink` wrapping
+ * the real sink makes all of them asynchronous: `log()` only copies the record
+ * into a bounded queue, and a pool of worker threads hands the records to the
+ * wrapped sink.
+ */
+
+#pragma once
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace asap::logging {
+
+/// What to do with a new record when the queue is full.
+enum class OverflowPolicy {
+  /// Wait for room in the queue, nothing is lost.
+  BLOCK,
+  /// Drop the oldest queued record to make room for the new one.
+  OVERRUN_OLDEST,
+  /// Drop the new record.
+  DISCARD_NEW,
+};
+
+auto OverflowPolicyFromString(std::string_view name)
+    -> std::optional<OverflowPolicy>;
+auto ToString(OverflowPolicy policy) -> const char *;
+
+/// Settings of the asynchronous logging, as stored in `logging.toml`.
+struct AsyncSettings {
+  static constexpr std::size_t DEFAULT_QUEUE_SIZE = 8192;
+  /// Range of the queue size accepted from the settings file. Each queued
+  /// record holds a copy of its message.
+  static constexpr std::size_t MIN_QUEUE_SIZE = 64;
+  static constexpr std::size_t MAX_QUEUE_SIZE = std::size_t{1} << 20U;
+
+  bool enabled{false};
+  std::size_t queue_size{DEFAULT_QUEUE_SIZE};
+  std::size_t workers{1};
+  OverflowPolicy overflow_policy{OverflowPolicy::BLOCK};
+};
+
+/*!
+ * \brief Sink queueing the records for a pool of worker threads that forward
+ * them to the wrapped sink.
+ *
+ * With more than one worker, records may reach the wrapped sink in a slightly
+ * different order than they were logged; each record keeps its original
+ * timestamp and thread id.
+ */
+class AsyncSink final : public spdlog::sinks::sink {
+public:
+  AsyncSink(std::shared_ptr<spdlog::sinks::sink> target,
+      const AsyncSettings &settings);
+
+  AsyncSink(const AsyncSink &) = delete;
+  AsyncSink(AsyncSink &&) = delete;
+  auto operator=(const AsyncSink &) -> AsyncSink & = delete;
+  auto operator=(AsyncSink &&) -> AsyncSink & = delete;
+
+  ~AsyncSink() override;
+
+  void log(const spdlog::details::log_msg &msg) override;
+  /// Wait until all the records queued so far have been handed to the wrapped
+  /// sink, then flush it.
+  void flush() override;
+  void set_pattern(const std::string &pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+  /// Drain the queue and stop the workers. Records logged afterwards are
+  /// forwarded synchronously to the wrapped sink.
+  void Shutdown();
+
+  /// Number of records lost because of the overflow policy.
+  [[nodiscard]] auto Dropped() const -> std::uint64_t {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] auto Target() const
+      -> const std::shared_ptr<spdlog::sinks::sink> & {
+    return target_;
+  }
+
+private:
+  struct QueuedRecord {
+    std::uint64_t sequence;
+    spdlog::details::log_msg_buffer record;
+  };
+
+  void Run(std::size_t slot);
+  /// Sequence number of the oldest record not yet handed to the wrapped sink.
+  [[nodiscard]] auto OldestPending() const -> std::uint64_t;
+
+  std::shared_ptr<spdlog::sinks::sink> target_;
+  std::size_t capacity_;
+  OverflowPolicy overflow_policy_;
+
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::condition_variable progress_;
+  std::deque<QueuedRecord> queue_;
+  /// Sequence numbers of the records being handed to the wrapped sink by the
+  /// workers, one slot per worker.
+  std::vector<std::uint64_t> in_flight_;
+  std::uint64_t next_sequence_{0};
+  bool stopped_{false};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::vector<std::thread> workers_;
+};
+
+} // namespace asap::logging
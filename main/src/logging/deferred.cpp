@@ -0,0 +1,344 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "logging/deferred.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace asap::logging::deferred {
+
+// -----------------------------------------------------------------------------
+// ThreadBuffer
+// -----------------------------------------------------------------------------
+
+ThreadBuffer::ThreadBuffer()
+    : data_(std::make_unique<std::byte[]>(CAPACITY)) { // NOLINT
+}
+
+auto ThreadBuffer::Reserve(std::size_t size) -> std::byte * {
+  const auto head = head_.load(std::memory_order_relaxed);
+  const auto tail = tail_.load(std::memory_order_acquire);
+  const auto offset = head % CAPACITY;
+  // Records are contiguous, skip the end of the storage if it's too small
+  const auto padding = (CAPACITY - offset < size) ? CAPACITY - offset : 0;
+  if (head + padding + size - tail > CAPACITY) {
+    return nullptr;
+  }
+  if (padding != 0) {
+    std::memcpy(&data_[offset], &WRAP_MARKER, sizeof(WRAP_MARKER));
+  }
+  reserved_ = head + padding;
+  return &data_[reserved_ % CAPACITY];
+}
+
+void ThreadBuffer::Commit(std::size_t size) {
+  head_.store(reserved_ + size, std::memory_order_release);
+}
+
+auto ThreadBuffer::Front() -> const std::byte * {
+  auto tail = tail_.load(std::memory_order_relaxed);
+  const auto head = head_.load(std::memory_order_acquire);
+  if (tail == head) {
+    return nullptr;
+  }
+  auto offset = tail % CAPACITY;
+  std::uint32_t size = 0;
+  std::memcpy(&size, &data_[offset], sizeof(size));
+  if (size == WRAP_MARKER) {
+    // The wrap marker is published together with the record following it,
+    // which is at the start of the storage.
+    tail += CAPACITY - offset;
+    tail_.store(tail, std::memory_order_release);
+    offset = 0;
+  }
+  return &data_[offset];
+}
+
+void ThreadBuffer::Pop(std::size_t size) {
+  tail_.store(
+      tail_.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+// Back-end
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/// Maximum number of records consumed from one buffer before moving to the
+/// next one, so that a busy thread does not starve the others.
+constexpr std::size_t MAX_RECORDS_PER_BATCH = 256;
+
+/// How long the consumer sleeps when all buffers are empty.
+constexpr auto IDLE_WAIT = std::chrono::milliseconds(1);
+
+void FormatSourcePrefix(const CallSite &site, fmt::memory_buffer &out) {
+#if !defined(NDEBUG)
+  // Same as what ASLOG produces in debug builds, the log sinks rely on it to
+  // extract the source location.
+  auto file = std::string_view(site.location.filename);
+  const auto separator = file.find_last_of("/\\");
+  if (separator != std::string_view::npos) {
+    file.remove_prefix(separator + 1);
+  }
+  fmt::format_to(
+      std::back_inserter(out), "[{}:{}] ", file, site.location.line);
+#else
+  (void)site;
+  (void)out;
+#endif
+}
+
+void Dispatch(spdlog::logger &logger, const CallSite &site,
+    spdlog::log_clock::time_point time, std::size_t thread_id,
+    const fmt::memory_buffer &payload) {
+  spdlog::details::log_msg msg(time, site.location, logger.name(), site.level,
+      spdlog::string_view_t(payload.data(), payload.size()));
+  // Keep the id of the thread that produced the record, not ours
+  msg.thread_id = thread_id;
+  const auto flush = msg.level >= logger.flush_level();
+  for (auto &sink : logger.sinks()) {
+    if (sink->should_log(msg.level)) {
+      sink->log(msg);
+      if (flush) {
+        sink->flush();
+      }
+    }
+  }
+}
+
+void FormatAndDispatch(spdlog::logger &logger, const CallSite &site,
+    spdlog::log_clock::time_point time, std::size_t thread_id,
+    const std::byte *args) {
+  fmt::memory_buffer payload;
+  FormatSourcePrefix(site, payload);
+  try {
+    site.format_message(site, args, payload);
+  } catch (const std::exception &ex) {
+    fmt::format_to(std::back_inserter(payload),
+        "<bad deferred log format '{}': {}>", site.format, ex.what());
+  }
+  Dispatch(logger, site, time, thread_id, payload);
+}
+
+class Backend {
+public:
+  static auto Instance() -> Backend & {
+    static Backend backend;
+    return backend;
+  }
+
+  Backend(const Backend &) = delete;
+  Backend(Backend &&) = delete;
+  auto operator=(const Backend &) -> Backend & = delete;
+  auto operator=(Backend &&) -> Backend & = delete;
+
+  ~Backend() {
+    Stop();
+  }
+
+  auto Register() -> std::shared_ptr<ThreadBuffer> {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return nullptr;
+    }
+    if (!consumer_.joinable()) {
+      consumer_ = std::thread([this]() { Run(); });
+    }
+    buffers_.push_back(std::make_shared<ThreadBuffer>());
+    return buffers_.back();
+  }
+
+  /// Mark the calling thread as writing a record, unless the back-end is
+  /// stopped.
+  auto BeginRecord() -> bool {
+    // Sequentially consistent with Stop(): either the producer sees the
+    // back-end stopped, or Stop() sees the producer and waits for it.
+    producers_.fetch_add(1);
+    if (stopped_flag_.load()) {
+      producers_.fetch_sub(1);
+      return false;
+    }
+    return true;
+  }
+
+  void EndRecord() {
+    producers_.fetch_sub(1);
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.notify_one();
+    drained_.wait(lock, [this]() { return stopped_ || AllEmpty(); });
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return;
+      }
+      stopped_ = true;
+      stopped_flag_.store(true);
+    }
+    wake_.notify_one();
+    drained_.notify_all();
+    if (consumer_.joinable()) {
+      consumer_.join();
+    }
+    // Producers which saw the back-end running may still be writing their
+    // record; new ones format synchronously.
+    while (producers_.load() != 0) {
+      std::this_thread::yield();
+    }
+    // Anything committed before the consumer exited but not yet consumed
+    while (DrainAll() != 0) {
+    }
+  }
+
+  std::atomic<std::uint64_t> fallbacks{0};
+
+private:
+  Backend() = default;
+
+  void Run() {
+    for (;;) {
+      const auto consumed = DrainAll();
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stopped_) {
+        break;
+      }
+      if (AllEmpty()) {
+        drained_.notify_all();
+      }
+      if (consumed == 0) {
+        wake_.wait_for(lock, IDLE_WAIT);
+      }
+    }
+  }
+
+  auto DrainAll() -> std::size_t {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Forget the buffers of the threads that exited, once consumed
+      buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                         [](const auto &buffer) {
+                           return buffer->IsOrphaned() && buffer->Empty();
+                         }),
+          buffers_.end());
+      buffers = buffers_;
+    }
+    std::size_t consumed = 0;
+    for (auto &buffer : buffers) {
+      consumed += Drain(*buffer);
+    }
+    return consumed;
+  }
+
+  static auto Drain(ThreadBuffer &buffer) -> std::size_t {
+    std::size_t consumed = 0;
+    while (consumed < MAX_RECORDS_PER_BATCH) {
+      const auto *record = buffer.Front();
+      if (record == nullptr) {
+        break;
+      }
+      detail::RecordHeader header{};
+      std::memcpy(&header, record, sizeof(header));
+      FormatAndDispatch(*header.logger, *header.site, header.time,
+          header.thread_id, record + sizeof(header));
+      buffer.Pop(header.size);
+      ++consumed;
+    }
+    return consumed;
+  }
+
+  /// Must be called with `mutex_` locked.
+  auto AllEmpty() -> bool {
+    return std::all_of(buffers_.begin(), buffers_.end(),
+        [](const auto &buffer) { return buffer->Empty(); });
+  }
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  /// Signaled by the consumer when all the buffers are empty.
+  std::condition_variable drained_;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+  std::thread consumer_;
+  bool stopped_{false};
+  std::atomic<bool> stopped_flag_{false};
+  /// Producers between LocalBuffer() and ReleaseLocalBuffer().
+  std::atomic<int> producers_{0};
+};
+
+/// Owns the reference of a thread to its buffer, and tells the back-end when
+/// the thread exits.
+struct LocalBufferHolder {
+  LocalBufferHolder() = default;
+  LocalBufferHolder(const LocalBufferHolder &) = delete;
+  LocalBufferHolder(LocalBufferHolder &&) = delete;
+  auto operator=(const LocalBufferHolder &) -> LocalBufferHolder & = delete;
+  auto operator=(LocalBufferHolder &&) -> LocalBufferHolder & = delete;
+
+  ~LocalBufferHolder() {
+    if (buffer) {
+      buffer->Orphan();
+    }
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+  bool registered{false};
+};
+
+} // namespace
+
+namespace detail {
+
+void FormatSynchronously(spdlog::logger &logger, const CallSite &site,
+    spdlog::log_clock::time_point time, std::size_t thread_id,
+    const std::byte *args) {
+  Backend::Instance().fallbacks.fetch_add(1, std::memory_order_relaxed);
+  FormatAndDispatch(logger, site, time, thread_id, args);
+}
+
+} // namespace detail
+
+auto LocalBuffer() -> ThreadBuffer * {
+  thread_local LocalBufferHolder holder;
+  if (!holder.registered) {
+    holder.registered = true;
+    holder.buffer = Backend::Instance().Register();
+  }
+  if (!holder.buffer || !Backend::Instance().BeginRecord()) {
+    return nullptr;
+  }
+  return holder.buffer.get();
+}
+
+void ReleaseLocalBuffer() {
+  Backend::Instance().EndRecord();
+}
+
+void Flush() {
+  Backend::Instance().Flush();
+}
+
+void Shutdown() {
+  Backend::Instance().Stop();
+}
+
+auto SynchronousFallbacks() -> std::uint64_t {
+  return Backend::Instance().fallbacks.load(std::memory_order_relaxed);
+}
+
+} // namespace asap::logging::deferred
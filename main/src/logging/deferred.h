@@ -0,0 +1,319 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Deferred (binary) logging for hot code paths.
+ *
+ * `ASLOG_DEFERRED` has the same usage as `ASLOG`, but instead of formatting
+ * the message on the calling thread, it only copies a pointer to a static call
+ * site descriptor (level, format string, source location and decoder) and the
+ * raw bytes of the arguments into a lock-free buffer owned by the calling
+ * thread. A background consumer thread decodes and formats the records and
+ * hands them to the logger sinks, with the original timestamp and thread id.
+ *
+ * Supported argument types are the trivially copyable ones (numbers, enums,
+ * `void` pointers, ...) and strings (`std::string`, `std::string_view`,
+ * `const char *`), whose content is copied. When the calling thread's buffer
+ * is full, the record is formatted synchronously so that nothing is lost.
+ */
+
+#pragma once
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace asap::logging::deferred {
+
+struct CallSite;
+
+/// Decodes the argument bytes of a record and formats its message.
+using FormatFunction = void (*)(
+    const CallSite &site, const std::byte *args, fmt::memory_buffer &out);
+
+/// Static, per call site, description of a deferred log record. Its address
+/// is the only thing identifying the call site in the record.
+struct CallSite {
+  spdlog::level::level_enum level;
+  const char *format;
+  spdlog::source_loc location;
+  FormatFunction format_message;
+};
+
+// -----------------------------------------------------------------------------
+// Argument encoding
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename T>
+struct IsString
+    : std::disjunction<std::is_same<T, std::string>,
+          std::is_same<T, std::string_view>, std::is_same<T, const char *>,
+          std::is_same<T, char *>> {};
+
+/// Encoding of an argument of type `T` into the record bytes. Values are
+/// copied as is, strings as a 32-bit length followed by their characters.
+template <typename T, typename Enable = void> struct ArgCodec {
+  static_assert(std::is_trivially_copyable_v<T>,
+      "argument type not supported by ASLOG_DEFERRED, use ASLOG instead");
+
+  using StoredType = T;
+
+  static auto Size(const T & /*value*/) -> std::size_t {
+    return sizeof(T);
+  }
+  static auto Encode(std::byte *out, const T &value) -> std::byte * {
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+  }
+  static auto Decode(const std::byte *in, T &value) -> const std::byte * {
+    std::memcpy(&value, in, sizeof(T));
+    return in + sizeof(T);
+  }
+};
+
+template <typename T>
+struct ArgCodec<T, std::enable_if_t<IsString<T>::value>> {
+  using StoredType = std::string_view;
+
+  static auto View(const T &value) -> std::string_view {
+    if constexpr (std::is_pointer_v<T>) {
+      return value != nullptr ? std::string_view(value) : std::string_view();
+    } else {
+      return std::string_view(value);
+    }
+  }
+  static auto Size(const T &value) -> std::size_t {
+    return sizeof(std::uint32_t) + View(value).size();
+  }
+  static auto Encode(std::byte *out, const T &value) -> std::byte * {
+    const auto view = View(value);
+    const auto length = static_cast<std::uint32_t>(view.size());
+    std::memcpy(out, &length, sizeof(length));
+    std::memcpy(out + sizeof(length), view.data(), view.size());
+    return out + sizeof(length) + view.size();
+  }
+  static auto Decode(const std::byte *in, std::string_view &value)
+      -> const std::byte * {
+    std::uint32_t length = 0;
+    std::memcpy(&length, in, sizeof(length));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    value = std::string_view(
+        reinterpret_cast<const char *>(in + sizeof(length)), length);
+    return in + sizeof(length) + length;
+  }
+};
+
+template <typename T> using DecayedArgCodec = ArgCodec<std::decay_t<const T>>;
+
+template <typename... Args>
+void FormatMessage(
+    const CallSite &site, const std::byte *args, fmt::memory_buffer &out) {
+  std::tuple<typename ArgCodec<Args>::StoredType...> values;
+  std::apply(
+      [&args](auto &...value) {
+        ((args = ArgCodec<Args>::Decode(args, value)), ...);
+      },
+      values);
+  std::apply(
+      [&site, &out](auto &...value) {
+        fmt::vformat_to(std::back_inserter(out), fmt::string_view(site.format),
+            fmt::make_format_args(value...));
+      },
+      values);
+}
+
+/// Format the record with the encoded arguments `args` on the calling thread
+/// and dispatch it.
+void FormatSynchronously(spdlog::logger &logger, const CallSite &site,
+    spdlog::log_clock::time_point time, std::size_t thread_id,
+    const std::byte *args);
+
+/// Records are aligned on 8 bytes in the buffers.
+constexpr auto AlignRecordSize(std::size_t size) -> std::size_t {
+  return (size + 7U) & ~std::size_t{7U};
+}
+
+struct RecordHeader {
+  std::uint32_t size;
+  const CallSite *site;
+  spdlog::logger *logger;
+  spdlog::log_clock::time_point time;
+  std::size_t thread_id;
+};
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+// Per-thread buffer
+// -----------------------------------------------------------------------------
+
+/*!
+ * \brief Single producer, single consumer ring buffer of variable size records.
+ *
+ * The producer is the thread owning the buffer, the consumer is the deferred
+ * logging back-end thread. Records never wrap around the end of the storage; a
+ * wrap marker is written instead and the record starts at the beginning.
+ */
+class ThreadBuffer {
+public:
+  static constexpr std::size_t CAPACITY = 64 * 1024;
+
+  ThreadBuffer();
+
+  /// Return a pointer to `size` contiguous bytes, or nullptr if the buffer is
+  /// full. `size` must be a multiple of 8.
+  auto Reserve(std::size_t size) -> std::byte *;
+  /// Publish the record written to the last reserved bytes.
+  void Commit(std::size_t size);
+
+  /// Return the oldest published record, or nullptr if there is none.
+  auto Front() -> const std::byte *;
+  /// Release the record returned by Front().
+  void Pop(std::size_t size);
+
+  [[nodiscard]] auto Empty() const -> bool {
+    return tail_.load(std::memory_order_acquire) ==
+           head_.load(std::memory_order_acquire);
+  }
+
+  /// Mark the buffer as no longer used by its owner thread.
+  void Orphan() {
+    orphaned_.store(true, std::memory_order_release);
+  }
+  [[nodiscard]] auto IsOrphaned() const -> bool {
+    return orphaned_.load(std::memory_order_acquire);
+  }
+
+private:
+  static constexpr std::uint32_t WRAP_MARKER = 0xFFFFFFFFU;
+  static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+  std::unique_ptr<std::byte[]> data_; // NOLINT(modernize-avoid-c-arrays)
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head_{0};
+  std::size_t reserved_{0};
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail_{0};
+  std::atomic<bool> orphaned_{false};
+};
+
+/// Return the calling thread's buffer, or nullptr if the back-end has been
+/// shut down. The back-end thread is started on first use. When a buffer is
+/// returned, ReleaseLocalBuffer() must be called once the record is committed:
+/// Shutdown() waits for it before draining the buffers for the last time.
+auto LocalBuffer() -> ThreadBuffer *;
+void ReleaseLocalBuffer();
+
+/// Block until all the records logged so far have been handed to the sinks.
+void Flush();
+
+/// Flush and stop the back-end thread. Subsequent deferred log calls are
+/// formatted synchronously.
+void Shutdown();
+
+/// Number of records that could not be deferred because the calling thread's
+/// buffer was full, and were formatted synchronously instead.
+auto SynchronousFallbacks() -> std::uint64_t;
+
+template <typename... Args>
+void Log(spdlog::logger &logger, const CallSite &site, const Args &...args) {
+  using detail::RecordHeader;
+  // String literals are received as arrays, encode them as pointers.
+  using detail::DecayedArgCodec;
+
+  const auto time = spdlog::log_clock::now();
+  const auto thread_id = spdlog::details::os::thread_id();
+  const auto size = detail::AlignRecordSize(
+      sizeof(RecordHeader) + (DecayedArgCodec<Args>::Size(args) + ... + 0));
+
+  auto *buffer = LocalBuffer();
+  std::byte *record = nullptr;
+  if (buffer != nullptr) {
+    if (size <= ThreadBuffer::CAPACITY / 2) {
+      record = buffer->Reserve(size);
+    }
+    if (record == nullptr) {
+      ReleaseLocalBuffer();
+    }
+  }
+  if (record == nullptr) {
+    // Slow path: the buffer is full or unavailable, encode the arguments in a
+    // temporary buffer and format synchronously.
+    auto bytes = std::make_unique<std::byte[]>(size); // NOLINT
+    auto *cursor = bytes.get();
+    ((cursor = DecayedArgCodec<Args>::Encode(cursor, args)), ...);
+    (void)cursor;
+    detail::FormatSynchronously(logger, site, time, thread_id, bytes.get());
+    return;
+  }
+
+  const RecordHeader header{
+      static_cast<std::uint32_t>(size), &site, &logger, time, thread_id};
+  std::memcpy(record, &header, sizeof(header));
+  auto *cursor = record + sizeof(header);
+  ((cursor = DecayedArgCodec<Args>::Encode(cursor, args)), ...);
+  (void)cursor;
+  buffer->Commit(size);
+  ReleaseLocalBuffer();
+}
+
+/// Level names accepted by the deferred logging macros, same as `ASLOG`.
+namespace level {
+constexpr auto trace = spdlog::level::trace;
+constexpr auto debug = spdlog::level::debug;
+constexpr auto info = spdlog::level::info;
+constexpr auto warn = spdlog::level::warn;
+constexpr auto error = spdlog::level::err;
+constexpr auto err = spdlog::level::err;
+constexpr auto critical = spdlog::level::critical;
+} // namespace level
+
+} // namespace asap::logging::deferred
+
+/*!
+ * \brief Log a message to `LOGGER` with deferred formatting.
+ *
+ * The first variadic argument is the format string, which must be a string
+ * literal. The level check happens on the calling thread as with
+ * `ASLOG_TO_LOGGER`.
+ */
+#define ASLOG_DEFERRED_TO_LOGGER(LOGGER, LEVEL, ...)                           \
+  do {                                                                         \
+    auto &asap_deferred_logger = (LOGGER);                                     \
+    constexpr auto asap_deferred_level =                                       \
+        ::asap::logging::deferred::level::LEVEL;                               \
+    if (asap_deferred_logger.should_log(asap_deferred_level)) {                \
+      const char *asap_deferred_function = SPDLOG_FUNCTION;                    \
+      [&](const char *asap_deferred_format,                                    \
+          const auto &...asap_deferred_args) {                                 \
+        static const ::asap::logging::deferred::CallSite call_site{            \
+            asap_deferred_level, asap_deferred_format,                         \
+            spdlog::source_loc{__FILE__, __LINE__, asap_deferred_function},    \
+            &::asap::logging::deferred::detail::FormatMessage<                 \
+                std::decay_t<decltype(asap_deferred_args)>...>};               \
+        ::asap::logging::deferred::Log(                                        \
+            asap_deferred_logger, call_site, asap_deferred_args...);           \
+      }(__VA_ARGS__);                                                          \
+    }                                                                          \
+  } while (false)
+
+/// Deferred version of `ASLOG`, to be used inside a `Loggable` class.
+#define ASLOG_DEFERRED(LEVEL, ...)                                             \
+  ASLOG_DEFERRED_TO_LOGGER(                                                    \
+      internal_log_do_not_use_read_comment(), LEVEL, __VA_ARGS__)
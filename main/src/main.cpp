@@ -7,7 +7,9 @@
 
 #include "app/imgui_runner.h"
 #include "config/config.h"
+#include "config/config_store.h"
 #include "example_application.h"
+#include "logging/deferred.h"
 
 #include <asap_app_imgui/version.h>
 #include <logging/logging.h>
@@ -24,6 +26,13 @@ auto main(int argc, char **argv) -> int {
   auto &logger = asap::logging::Registry::GetLogger("main");
 
   asap::config::CreateDirectories();
+  // Parse the settings files while GLFW, the window and the OpenGL context
+  // are initialized. theme.toml is only used when its snapshot is out of date,
+  // parsing it anyway costs no startup time.
+  asap::config::ConfigStore::Default().LoadAsync(
+      {asap::config::Location::F_DISPLAY_SETTINGS,
+          asap::config::Location::F_LOG_SETTINGS,
+          asap::config::Location::F_THEME_SETTINGS});
 
   try {
     ASLOG_TO_LOGGER(logger, info, "starting ImGui application...");
@@ -33,6 +42,7 @@ auto main(int argc, char **argv) -> int {
     //
     ImGuiRunner runner(app, [&]() {
       // Shutdown
+      asap::logging::deferred::Shutdown();
       ASLOG_TO_LOGGER(logger, info, "shutdown complete");
     });
     runner.Run();
@@ -0,0 +1,126 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/fonts/font_atlas_builder.h"
+
+#include <chrono> // for timing the builds and swaps
+#include <utility>
+
+namespace asap::ui {
+
+const char *const FontAtlasBuilder::LOGGER_NAME = "main";
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+auto ElapsedMs(Clock::time_point start) -> double {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+FontAtlasBuilder::FontAtlasBuilder(SourcesFunction sources)
+    : sources_(std::move(sources)) {
+}
+
+FontAtlasBuilder::~FontAtlasBuilder() {
+  Cancel();
+}
+
+void FontAtlasBuilder::Build(float scale) {
+  Cancel();
+  auto &atlas = *ImGui::GetIO().Fonts;
+  atlas.Clear();
+  const auto start = Clock::now();
+  const auto cached = FontAtlasCache::Populate(atlas, sources_(scale));
+  int glyphs = 0;
+  for (const auto *font : atlas.Fonts) {
+    glyphs += font->Glyphs.Size;
+  }
+  ASLOG(info,
+      "font atlas for scale {:.2f} {} in {:.1f} ms ({}x{} texture, {} glyphs)",
+      scale, cached ? "loaded from cache" : "built", ElapsedMs(start),
+      atlas.TexWidth, atlas.TexHeight, glyphs);
+  current_scale_ = scale;
+  requested_scale_ = scale;
+}
+
+void FontAtlasBuilder::Request(float scale) {
+  requested_scale_ = scale;
+  if (!building_.load(std::memory_order_acquire) && scale != current_scale_) {
+    Start(scale);
+  }
+}
+
+void FontAtlasBuilder::Start(float scale) {
+  Join();
+  building_scale_ = scale;
+  building_.store(true, std::memory_order_release);
+  // The sources are produced here, only the atlas itself is touched by the
+  // worker. The only state shared with the UI thread is the active allocations
+  // counter of the ImGui context, which ImGui::MemAlloc() and MemFree() update
+  // without synchronization: a statistic shown in the metrics window, which a
+  // lost update leaves slightly off. The context is not made per thread for
+  // that, as every ImGui call would then pay for a TLS lookup.
+  worker_ = std::thread([this, scale, sources = sources_(scale)]() {
+    const auto start = Clock::now();
+    auto *atlas = IM_NEW(ImFontAtlas)();
+    const auto cached = FontAtlasCache::Populate(*atlas, sources);
+    // Do the RGBA conversion the renderer asks for here rather than on the UI
+    // thread
+    unsigned char *pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ASLOG(debug, "font atlas for scale {:.2f} {} in background in {:.1f} ms",
+        scale, cached ? "loaded from cache" : "built", ElapsedMs(start));
+    ready_.store(atlas, std::memory_order_release);
+    building_.store(false, std::memory_order_release);
+  });
+}
+
+auto FontAtlasBuilder::SwapIfReady() -> bool {
+  auto *atlas = ready_.exchange(nullptr, std::memory_order_acquire);
+  auto swapped = false;
+  if (atlas != nullptr) {
+    const auto start = Clock::now();
+    auto &io = ImGui::GetIO();
+    auto *previous = io.Fonts;
+    io.Fonts = atlas;
+    io.FontDefault = nullptr;
+    IM_DELETE(previous);
+    current_scale_ = building_scale_;
+    swapped = true;
+    ASLOG(info, "font atlas swapped for scale {:.2f} in {:.1f} ms",
+        current_scale_, ElapsedMs(start));
+  }
+  // The scale may have changed again while building
+  if (!building_.load(std::memory_order_acquire) &&
+      requested_scale_ != current_scale_) {
+    Start(requested_scale_);
+  }
+  return swapped;
+}
+
+void FontAtlasBuilder::Join() {
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+void FontAtlasBuilder::Cancel() {
+  Join();
+  auto *atlas = ready_.exchange(nullptr, std::memory_order_acquire);
+  if (atlas != nullptr) {
+    IM_DELETE(atlas);
+  }
+  requested_scale_ = current_scale_;
+}
+
+} // namespace asap::ui
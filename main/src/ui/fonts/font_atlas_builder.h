@@ -0,0 +1,89 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "ui/fonts/font_atlas_cache.h"
+
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Re-builds the font atlas for a new content scale (DPI) on a worker
+ * thread, and swaps it in between two frames.
+ *
+ * The current atlas keeps being used for rendering while the new one is built
+ * (through the `FontAtlasCache`, so that going back to a scale already seen is
+ * only a cache load). The pixels are converted to RGBA on the worker as well,
+ * so that the only work left on the UI thread when swapping is releasing the
+ * old atlas and uploading the new texture.
+ *
+ * All the member functions must be called from the UI thread.
+ */
+class FontAtlasBuilder : public asap::logging::Loggable<FontAtlasBuilder> {
+public:
+  /// Produces the fonts of the atlas for a content scale.
+  using SourcesFunction = std::function<std::vector<FontSource>(float scale)>;
+
+  explicit FontAtlasBuilder(SourcesFunction sources);
+
+  FontAtlasBuilder(const FontAtlasBuilder &) = delete;
+  FontAtlasBuilder(FontAtlasBuilder &&) = delete;
+  auto operator=(const FontAtlasBuilder &) -> FontAtlasBuilder & = delete;
+  auto operator=(FontAtlasBuilder &&) -> FontAtlasBuilder & = delete;
+
+  ~FontAtlasBuilder();
+
+  /// Build the atlas for `scale` synchronously, in the current ImGui atlas.
+  void Build(float scale);
+
+  /// Request an atlas for a new content scale. The atlas is built in the
+  /// background, only the last requested scale is built when requests come
+  /// faster than the builds.
+  void Request(float scale);
+
+  /*!
+   * \brief Install the atlas built in the background, if one is ready.
+   *
+   * Must be called between two frames (before `ImGui::NewFrame()`). Return
+   * true when the atlas was replaced, in which case the renderer must re-create
+   * its font texture.
+   */
+  auto SwapIfReady() -> bool;
+
+  /// Wait for the atlas being built, if any, and drop it.
+  void Cancel();
+
+  [[nodiscard]] auto Scale() const -> float {
+    return current_scale_;
+  }
+
+  static const char *const LOGGER_NAME;
+
+private:
+  void Start(float scale);
+  void Join();
+
+  SourcesFunction sources_;
+  float current_scale_{0};
+  float requested_scale_{0};
+  float building_scale_{0};
+
+  std::thread worker_;
+  std::atomic<bool> building_{false};
+  /// The atlas built by the worker, waiting to be swapped in.
+  std::atomic<ImFontAtlas *> ready_{nullptr};
+};
+
+} // namespace asap::ui
@@ -0,0 +1,633 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/fonts/font_atlas_cache.h"
+#include "config/config.h"
+
+#include <contract/contract.h>
+
+#include <algorithm>   // for sort
+#include <array>       // for the file magic
+#include <cstdio>      // for snprintf
+#include <cstring>     // for memcpy
+#include <filesystem>  // for the cache files
+#include <fstream>     // for writing the cache file
+#include <string>      // for the serialized atlas
+#include <type_traits> // for is_trivially_copyable
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ASAP_FONT_CACHE_MMAP
+#endif
+
+namespace asap::ui {
+
+const char *const FontAtlasCache::LOGGER_NAME = "main";
+
+namespace {
+
+/// Change when the layout of the cache file changes.
+constexpr std::uint32_t CACHE_FORMAT_VERSION = 1;
+
+constexpr std::array<char, 8> CACHE_MAGIC{
+    'A', 'S', 'A', 'P', 'F', 'N', 'T', '1'};
+
+/// Number of cache files kept (the most recently used ones), so that switching
+/// back and forth between a few configurations does not re-build the atlas.
+constexpr std::size_t MAX_CACHE_FILES = 4;
+
+constexpr const char *CACHE_FILE_PREFIX = "fonts-";
+constexpr const char *CACHE_FILE_EXTENSION = ".cache";
+
+/// 64-bit FNV-1a, good enough to detect changes in the font sources.
+class Hasher {
+public:
+  void Add(const void *data, std::size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t index = 0; index < size; ++index) {
+      hash_ ^= bytes[index]; // NOLINT
+      hash_ *= PRIME;
+    }
+  }
+
+  template <typename T> void Add(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Add(&value, sizeof(T));
+  }
+
+  [[nodiscard]] auto Value() const -> std::uint64_t {
+    return hash_;
+  }
+
+private:
+  static constexpr std::uint64_t PRIME = 0x100000001b3ULL;
+  std::uint64_t hash_{0xcbf29ce484222325ULL};
+};
+
+auto CacheFilePath(std::uint64_t key) -> std::filesystem::path {
+  std::array<char, 17> hex{};
+  std::snprintf(hex.data(), hex.size(), "%016llx",
+      static_cast<unsigned long long>(key)); // NOLINT
+  return asap::config::GetPathFor(asap::config::Location::D_CACHE) /
+         (std::string(CACHE_FILE_PREFIX) + hex.data() + CACHE_FILE_EXTENSION);
+}
+
+/// Serialization of the atlas in a byte buffer.
+class Writer {
+public:
+  template <typename T> void Put(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Put(&value, sizeof(T));
+  }
+
+  void Put(const void *data, std::size_t size) {
+    buffer_.append(static_cast<const char *>(data), size);
+  }
+
+  [[nodiscard]] auto Buffer() const -> const std::string & {
+    return buffer_;
+  }
+
+private:
+  std::string buffer_;
+};
+
+/// Bounds checked de-serialization of the atlas from the cache file contents.
+/// Any read past the end of the data marks the reader as failed.
+class Reader {
+public:
+  Reader(const char *data, std::size_t size) : data_(data), size_(size) {
+  }
+
+  template <typename T> auto Get(T &value) -> bool {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return Get(&value, sizeof(T));
+  }
+
+  auto Get(void *value, std::size_t size) -> bool {
+    const auto *data = Take(size);
+    if (data != nullptr) {
+      std::memcpy(value, data, size);
+    }
+    return data != nullptr;
+  }
+
+  /// Return a pointer to the next `size` bytes and skip them, or nullptr if
+  /// there are not enough bytes left.
+  auto Take(std::size_t size) -> const char * {
+    if (failed_ || size > size_ - offset_) {
+      failed_ = true;
+      return nullptr;
+    }
+    const auto *data = data_ + offset_; // NOLINT
+    offset_ += size;
+    return data;
+  }
+
+  [[nodiscard]] auto Failed() const -> bool {
+    return failed_;
+  }
+
+  [[nodiscard]] auto AtEnd() const -> bool {
+    return offset_ == size_;
+  }
+
+private:
+  const char *data_;
+  std::size_t size_;
+  std::size_t offset_{0};
+  bool failed_{false};
+};
+
+/// Read-only view of the contents of a cache file, memory mapped where
+/// supported.
+class CacheFile {
+public:
+  explicit CacheFile(const std::filesystem::path &path) {
+#if defined(ASAP_FONT_CACHE_MMAP)
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0) {
+      return;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      auto *mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+          PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) { // NOLINT
+        data_ = static_cast<const char *>(mapping);
+        size_ = static_cast<std::size_t>(info.st_size);
+      }
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (in) {
+      buffer_.assign(std::istreambuf_iterator<char>(in),
+          std::istreambuf_iterator<char>());
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+    }
+#endif
+  }
+
+  CacheFile(const CacheFile &) = delete;
+  CacheFile(CacheFile &&) = delete;
+  auto operator=(const CacheFile &) -> CacheFile & = delete;
+  auto operator=(CacheFile &&) -> CacheFile & = delete;
+
+  ~CacheFile() {
+#if defined(ASAP_FONT_CACHE_MMAP)
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char *>(data_), size_); // NOLINT
+    }
+#endif
+  }
+
+  [[nodiscard]] auto Data() const -> const char * {
+    return data_;
+  }
+
+  [[nodiscard]] auto Size() const -> std::size_t {
+    return size_;
+  }
+
+private:
+  const char *data_{nullptr};
+  std::size_t size_{0};
+#if !defined(ASAP_FONT_CACHE_MMAP)
+  std::string buffer_;
+#endif
+};
+
+/// The font config parameters saved in the cache. The font data is not kept.
+struct CachedConfig {
+  float size_pixels;
+  std::int32_t oversample_h;
+  std::int32_t oversample_v;
+  bool pixel_snap_h;
+  bool merge_mode;
+  ImVec2 glyph_extra_spacing;
+  ImVec2 glyph_offset;
+  float glyph_min_advance_x;
+  float glyph_max_advance_x;
+  float rasterizer_multiply;
+  ImWchar ellipsis_char;
+  /// Index of the destination font in the atlas.
+  std::int32_t dst_font;
+  std::array<char, sizeof(ImFontConfig::Name)> name;
+};
+
+struct CachedFont {
+  float font_size;
+  float ascent;
+  float descent;
+  std::int32_t metrics_total_surface;
+  /// First and number of configs (in the atlas) used by the font.
+  std::int32_t config_data;
+  std::int32_t config_data_count;
+  ImWchar fallback_char;
+  ImWchar ellipsis_char;
+  std::uint32_t glyphs;
+};
+
+struct CachedCustomRect {
+  ImFontAtlasCustomRect rect;
+  /// Index of the font of the rect in the atlas, or -1.
+  std::int32_t font;
+};
+
+template <typename T>
+auto IndexOf(const ImVector<T> &vector, const T &value) -> std::int32_t {
+  for (int index = 0; index < vector.Size; ++index) {
+    if (vector[index] == value) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+/// Keep only the most recently used cache files.
+void PruneCacheFiles() {
+  namespace fs = std::filesystem;
+  std::error_code error;
+  std::vector<std::pair<fs::file_time_type, fs::path>> files;
+  for (const auto &entry : fs::directory_iterator(
+           asap::config::GetPathFor(asap::config::Location::D_CACHE), error)) {
+    const auto name = entry.path().filename().string();
+    if (name.rfind(CACHE_FILE_PREFIX, 0) == 0 &&
+        entry.path().extension() == CACHE_FILE_EXTENSION) {
+      files.emplace_back(entry.last_write_time(error), entry.path());
+    }
+  }
+  if (files.size() <= MAX_CACHE_FILES) {
+    return;
+  }
+  std::sort(files.begin(), files.end(),
+      [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+  for (auto file = files.begin() + MAX_CACHE_FILES; file != files.end();
+       ++file) {
+    fs::remove(file->second, error);
+  }
+}
+
+} // namespace
+
+auto FontAtlasCache::Key(const ImFontAtlas &atlas,
+    const std::vector<FontSource> &sources) -> std::uint64_t {
+  Hasher hasher;
+  hasher.Add(CACHE_FORMAT_VERSION);
+  // The layout of the cached structures depends on the ImGui version
+  hasher.Add(static_cast<std::int32_t>(IMGUI_VERSION_NUM));
+  hasher.Add(sizeof(ImFontGlyph));
+  hasher.Add(sizeof(ImFontAtlasCustomRect));
+  hasher.Add(sizeof(ImWchar));
+
+  hasher.Add(atlas.Flags);
+  hasher.Add(atlas.TexDesiredWidth);
+  hasher.Add(atlas.TexGlyphPadding);
+
+  for (const auto &source : sources) {
+    hasher.Add(source.kind);
+    hasher.Add(source.data_size);
+    if (source.data != nullptr) {
+      hasher.Add(source.data, static_cast<std::size_t>(source.data_size));
+    }
+    const auto &config = source.config;
+    hasher.Add(config.SizePixels);
+    hasher.Add(config.OversampleH);
+    hasher.Add(config.OversampleV);
+    hasher.Add(config.PixelSnapH);
+    hasher.Add(config.MergeMode);
+    hasher.Add(config.GlyphExtraSpacing);
+    hasher.Add(config.GlyphOffset);
+    hasher.Add(config.GlyphMinAdvanceX);
+    hasher.Add(config.GlyphMaxAdvanceX);
+    hasher.Add(config.RasterizerMultiply);
+    hasher.Add(config.EllipsisChar);
+    // The ranges are zero terminated pairs, the terminator is hashed as well to
+    // separate the ranges of consecutive sources
+    const auto *ranges = source.ranges;
+    if (ranges == nullptr) {
+      ranges = const_cast<ImFontAtlas &>(atlas).GetGlyphRangesDefault();
+    }
+    for (; *ranges != 0; ++ranges) { // NOLINT
+      hasher.Add(*ranges);
+    }
+    hasher.Add(ImWchar{0});
+  }
+  return hasher.Value();
+}
+
+auto FontAtlasCache::Load(ImFontAtlas &atlas, std::uint64_t key) -> bool {
+  ASAP_ASSERT(!atlas.Locked);
+
+  const auto path = CacheFilePath(key);
+  std::error_code error;
+  if (!std::filesystem::exists(path, error)) {
+    return false;
+  }
+  CacheFile file(path);
+  if (file.Data() == nullptr) {
+    ASLOG(warn, "could not read font atlas cache file {}", path.string());
+    return false;
+  }
+
+  Reader reader(file.Data(), file.Size());
+  std::array<char, CACHE_MAGIC.size()> magic{};
+  std::uint64_t file_key = 0;
+  reader.Get(magic.data(), magic.size());
+  reader.Get(file_key);
+  if (reader.Failed() || magic != CACHE_MAGIC || file_key != key) {
+    ASLOG(warn, "font atlas cache file {} is invalid", path.string());
+    return false;
+  }
+
+  std::int32_t width = 0;
+  std::int32_t height = 0;
+  ImVec2 uv_scale;
+  ImVec2 uv_white_pixel;
+  decltype(atlas.TexUvLines) uv_lines{};
+  std::int32_t pack_id_mouse_cursors = 0;
+  std::int32_t pack_id_lines = 0;
+  std::uint32_t configs_count = 0;
+  std::uint32_t fonts_count = 0;
+  std::uint32_t rects_count = 0;
+  reader.Get(width);
+  reader.Get(height);
+  reader.Get(uv_scale);
+  reader.Get(uv_white_pixel);
+  reader.Get(uv_lines);
+  reader.Get(pack_id_mouse_cursors);
+  reader.Get(pack_id_lines);
+  reader.Get(configs_count);
+  reader.Get(fonts_count);
+  reader.Get(rects_count);
+
+  // Read and validate everything before touching the atlas
+  std::vector<CachedConfig> configs(configs_count);
+  for (auto &config : configs) {
+    reader.Get(config);
+  }
+  std::vector<CachedCustomRect> rects(rects_count);
+  for (auto &rect : rects) {
+    reader.Get(rect);
+  }
+  std::vector<CachedFont> fonts(fonts_count);
+  std::vector<const char *> glyphs(fonts_count);
+  for (std::uint32_t index = 0; index < fonts_count; ++index) {
+    reader.Get(fonts[index]);
+    glyphs[index] =
+        reader.Take(std::size_t{fonts[index].glyphs} * sizeof(ImFontGlyph));
+  }
+  const auto pixels_size =
+      static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+  const auto *pixels = reader.Take(pixels_size);
+  const auto valid_index = [](std::int32_t index, std::uint32_t count) {
+    return index >= -1 && index < static_cast<std::int32_t>(count);
+  };
+  auto valid = !reader.Failed() && reader.AtEnd() && width > 0 && height > 0;
+  for (const auto &config : configs) {
+    valid = valid && valid_index(config.dst_font, fonts_count);
+  }
+  for (const auto &rect : rects) {
+    valid = valid && valid_index(rect.font, fonts_count);
+  }
+  for (const auto &font : fonts) {
+    valid = valid && font.config_data >= 0 && font.config_data_count >= 0 &&
+            font.config_data + font.config_data_count <=
+                static_cast<std::int32_t>(configs_count);
+  }
+  if (!valid) {
+    ASLOG(warn, "font atlas cache file {} is corrupted", path.string());
+    return false;
+  }
+
+  atlas.Clear();
+
+  for (std::uint32_t index = 0; index < fonts_count; ++index) {
+    auto *font = IM_NEW(ImFont);
+    font->ContainerAtlas = &atlas;
+    atlas.Fonts.push_back(font);
+  }
+
+  atlas.ConfigData.resize(static_cast<int>(configs_count));
+  for (std::uint32_t index = 0; index < configs_count; ++index) {
+    const auto &cached = configs[index];
+    auto &config = atlas.ConfigData[static_cast<int>(index)];
+    config = ImFontConfig();
+    // The font data is not needed anymore once the atlas is built
+    config.FontData = nullptr;
+    config.FontDataSize = 0;
+    config.FontDataOwnedByAtlas = false;
+    config.SizePixels = cached.size_pixels;
+    config.OversampleH = cached.oversample_h;
+    config.OversampleV = cached.oversample_v;
+    config.PixelSnapH = cached.pixel_snap_h;
+    config.MergeMode = cached.merge_mode;
+    config.GlyphExtraSpacing = cached.glyph_extra_spacing;
+    config.GlyphOffset = cached.glyph_offset;
+    config.GlyphMinAdvanceX = cached.glyph_min_advance_x;
+    config.GlyphMaxAdvanceX = cached.glyph_max_advance_x;
+    config.RasterizerMultiply = cached.rasterizer_multiply;
+    config.EllipsisChar = cached.ellipsis_char;
+    config.DstFont =
+        cached.dst_font < 0 ? nullptr : atlas.Fonts[cached.dst_font];
+    std::memcpy(config.Name, cached.name.data(), sizeof(config.Name));
+    config.Name[sizeof(config.Name) - 1] = '\0';
+  }
+
+  for (std::uint32_t index = 0; index < fonts_count; ++index) {
+    const auto &cached = fonts[index];
+    auto *font = atlas.Fonts[static_cast<int>(index)];
+    font->FontSize = cached.font_size;
+    font->Ascent = cached.ascent;
+    font->Descent = cached.descent;
+    font->MetricsTotalSurface = cached.metrics_total_surface;
+    font->ConfigData = cached.config_data_count == 0
+                           ? nullptr
+                           : &atlas.ConfigData[cached.config_data];
+    font->ConfigDataCount = static_cast<short>(cached.config_data_count);
+    font->FallbackChar = cached.fallback_char;
+    font->EllipsisChar = cached.ellipsis_char;
+    font->Glyphs.resize(static_cast<int>(cached.glyphs));
+    if (cached.glyphs > 0) {
+      std::memcpy(font->Glyphs.Data, glyphs[index],
+          std::size_t{cached.glyphs} * sizeof(ImFontGlyph));
+    }
+    font->BuildLookupTable();
+  }
+
+  atlas.CustomRects.resize(static_cast<int>(rects_count));
+  for (std::uint32_t index = 0; index < rects_count; ++index) {
+    const auto &cached = rects[index];
+    auto &rect = atlas.CustomRects[static_cast<int>(index)];
+    rect = cached.rect;
+    rect.Font = cached.font < 0 ? nullptr : atlas.Fonts[cached.font];
+  }
+  atlas.PackIdMouseCursors = pack_id_mouse_cursors;
+  atlas.PackIdLines = pack_id_lines;
+
+  atlas.TexWidth = width;
+  atlas.TexHeight = height;
+  atlas.TexUvScale = uv_scale;
+  atlas.TexUvWhitePixel = uv_white_pixel;
+  std::memcpy(atlas.TexUvLines, uv_lines, sizeof(atlas.TexUvLines));
+  // The atlas owns (and frees) its pixels, they can't stay in the mapping
+  atlas.TexPixelsAlpha8 = static_cast<unsigned char *>(IM_ALLOC(pixels_size));
+  std::memcpy(atlas.TexPixelsAlpha8, pixels, pixels_size);
+  atlas.TexPixelsUseColors = false;
+  atlas.TexReady = true;
+
+  // Touch the file so that it is kept when pruning
+  std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), error);
+  return true;
+}
+
+auto FontAtlasCache::Save(const ImFontAtlas &atlas, std::uint64_t key)
+    -> bool {
+  if (atlas.TexPixelsAlpha8 == nullptr || atlas.TexPixelsUseColors) {
+    // Only the alpha8 atlases produced by stb_truetype are supported
+    return false;
+  }
+
+  Writer writer;
+  writer.Put(CACHE_MAGIC.data(), CACHE_MAGIC.size());
+  writer.Put(key);
+  writer.Put(static_cast<std::int32_t>(atlas.TexWidth));
+  writer.Put(static_cast<std::int32_t>(atlas.TexHeight));
+  writer.Put(atlas.TexUvScale);
+  writer.Put(atlas.TexUvWhitePixel);
+  writer.Put(atlas.TexUvLines);
+  writer.Put(static_cast<std::int32_t>(atlas.PackIdMouseCursors));
+  writer.Put(static_cast<std::int32_t>(atlas.PackIdLines));
+  writer.Put(static_cast<std::uint32_t>(atlas.ConfigData.Size));
+  writer.Put(static_cast<std::uint32_t>(atlas.Fonts.Size));
+  writer.Put(static_cast<std::uint32_t>(atlas.CustomRects.Size));
+
+  for (const auto &config : atlas.ConfigData) {
+    CachedConfig cached{};
+    cached.size_pixels = config.SizePixels;
+    cached.oversample_h = config.OversampleH;
+    cached.oversample_v = config.OversampleV;
+    cached.pixel_snap_h = config.PixelSnapH;
+    cached.merge_mode = config.MergeMode;
+    cached.glyph_extra_spacing = config.GlyphExtraSpacing;
+    cached.glyph_offset = config.GlyphOffset;
+    cached.glyph_min_advance_x = config.GlyphMinAdvanceX;
+    cached.glyph_max_advance_x = config.GlyphMaxAdvanceX;
+    cached.rasterizer_multiply = config.RasterizerMultiply;
+    cached.ellipsis_char = config.EllipsisChar;
+    cached.dst_font = IndexOf(atlas.Fonts, config.DstFont);
+    std::memcpy(cached.name.data(), config.Name, cached.name.size());
+    writer.Put(cached);
+  }
+
+  for (const auto &rect : atlas.CustomRects) {
+    CachedCustomRect cached{};
+    cached.rect = rect;
+    cached.rect.Font = nullptr;
+    cached.font = IndexOf(atlas.Fonts, rect.Font);
+    writer.Put(cached);
+  }
+
+  for (const auto *font : atlas.Fonts) {
+    CachedFont cached{};
+    cached.font_size = font->FontSize;
+    cached.ascent = font->Ascent;
+    cached.descent = font->Descent;
+    cached.metrics_total_surface = font->MetricsTotalSurface;
+    cached.config_data =
+        font->ConfigData == nullptr
+            ? 0
+            : static_cast<std::int32_t>(
+                  font->ConfigData - atlas.ConfigData.Data); // NOLINT
+    cached.config_data_count = font->ConfigDataCount;
+    cached.fallback_char = font->FallbackChar;
+    cached.ellipsis_char = font->EllipsisChar;
+    cached.glyphs = static_cast<std::uint32_t>(font->Glyphs.Size);
+    writer.Put(cached);
+    writer.Put(font->Glyphs.Data,
+        static_cast<std::size_t>(font->Glyphs.Size) * sizeof(ImFontGlyph));
+  }
+
+  const auto pixels_size = static_cast<std::size_t>(atlas.TexWidth) *
+                           static_cast<std::size_t>(atlas.TexHeight);
+  writer.Put(atlas.TexPixelsAlpha8, pixels_size);
+
+  // Write to a temporary file and rename it, so that a concurrent or
+  // interrupted write never leaves a truncated cache file behind
+  const auto path = CacheFilePath(key);
+  auto temp_path = path;
+  temp_path += ".tmp";
+  std::error_code error;
+  std::filesystem::create_directories(path.parent_path(), error);
+  {
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    out.write(writer.Buffer().data(),
+        static_cast<std::streamsize>(writer.Buffer().size()));
+    if (!out) {
+      ASLOG(warn, "could not write font atlas cache file {}",
+          temp_path.string());
+      out.close();
+      std::filesystem::remove(temp_path, error);
+      return false;
+    }
+  }
+  std::filesystem::rename(temp_path, path, error);
+  if (error) {
+    ASLOG(warn, "could not write font atlas cache file {}: {}", path.string(),
+        error.message());
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+  ASLOG(debug, "font atlas cached in {} ({} bytes)", path.string(),
+      writer.Buffer().size());
+
+  PruneCacheFiles();
+  return true;
+}
+
+auto FontAtlasCache::Populate(ImFontAtlas &atlas,
+    const std::vector<FontSource> &sources) -> bool {
+  ASAP_ASSERT(atlas.Fonts.empty());
+
+  const auto key = Key(atlas, sources);
+  if (Load(atlas, key)) {
+    return true;
+  }
+
+  for (const auto &source : sources) {
+    switch (source.kind) {
+    case FontSource::Kind::DEFAULT: {
+      auto config = source.config;
+      config.GlyphRanges = source.ranges;
+      atlas.AddFontDefault(&config);
+    } break;
+    case FontSource::Kind::COMPRESSED_TTF:
+      atlas.AddFontFromMemoryCompressedTTF(source.data, source.data_size,
+          source.config.SizePixels, &source.config, source.ranges);
+      break;
+    case FontSource::Kind::TTF: {
+      // The font data is used in place, ImGui only needs a mutable pointer
+      // to free it when it owns it
+      auto config = source.config;
+      config.FontDataOwnedByAtlas = false;
+      atlas.AddFontFromMemoryTTF(const_cast<void *>(source.data), // NOLINT
+          source.data_size, config.SizePixels, &config, source.ranges);
+    } break;
+    }
+  }
+  atlas.Build();
+  Save(atlas, key);
+  return false;
+}
+
+} // namespace asap::ui
@@ -0,0 +1,89 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Description of a font added to the atlas.
+ *
+ * The `config` is passed as is to the `ImFontAtlas::AddFont*` functions. The
+ * `data` and `ranges` are not copied and must outlive the atlas.
+ */
+struct FontSource {
+  enum class Kind {
+    /// The ImGui embedded font (ProggyClean), `data` is not used.
+    DEFAULT,
+    /// A TTF font compressed with ImGui's `binary_to_compressed_c`.
+    COMPRESSED_TTF,
+    /// A TTF font, used in place (not owned by the atlas).
+    TTF
+  };
+
+  Kind kind{Kind::DEFAULT};
+  const void *data{nullptr};
+  int data_size{0};
+  ImFontConfig config{};
+  /// Glyph ranges (zero terminated), or nullptr for the default ranges.
+  const ImWchar *ranges{nullptr};
+};
+
+/*!
+ * \brief On-disk cache of the baked font atlas.
+ *
+ * Rasterizing the fonts (in particular the thousands of glyphs of the Material
+ * Design Icons font) is the most expensive part of the startup. Once the atlas
+ * has been built, its pixels, glyph tables and font metrics are saved in the
+ * cache directory under a key computed from everything that has an influence
+ * on the result: the font data, sizes, glyph ranges, oversampling and the other
+ * font config parameters, the atlas parameters and the ImGui version.
+ *
+ * When a cache file with the same key exists, it is memory mapped and the
+ * atlas is restored from it without going through stb_truetype. A missing,
+ * truncated or corrupted cache file, or a key mismatch, simply results in the
+ * atlas being built normally and the cache being re-written.
+ *
+ * An atlas restored from the cache does not keep the font data, it can't be
+ * re-built incrementally: to change the fonts, `Clear()` the atlas and call
+ * `Populate()` again with the new sources.
+ */
+class FontAtlasCache : public asap::logging::Loggable<FontAtlasCache> {
+public:
+  FontAtlasCache() = delete;
+
+  /*!
+   * \brief Add the fonts to the atlas and build it, from the cache when
+   * possible.
+   *
+   * The atlas must be empty. Return true when the atlas was loaded from the
+   * cache, false when it was built (and saved in the cache).
+   */
+  static auto Populate(ImFontAtlas &atlas,
+      const std::vector<FontSource> &sources) -> bool;
+
+  /// Cache key for the given sources and atlas parameters.
+  [[nodiscard]] static auto Key(const ImFontAtlas &atlas,
+      const std::vector<FontSource> &sources) -> std::uint64_t;
+
+  /// Restore a built atlas from the cache, return false if there is no valid
+  /// cache entry for the `key`.
+  static auto Load(ImFontAtlas &atlas, std::uint64_t key) -> bool;
+
+  /// Save a built atlas in the cache under the `key`.
+  static auto Save(const ImFontAtlas &atlas, std::uint64_t key) -> bool;
+
+  static const char *const LOGGER_NAME;
+};
+
+} // namespace asap::ui
@@ -9,11 +9,12 @@
 
 namespace asap::ui {
 
+/// Names of the font assets, in the asset pack (see `assets::AssetStore`).
 class Fonts {
 public:
   // Material Design Icons
-  static const unsigned int MATERIAL_DESIGN_ICONS_COMPRESSED_SIZE = 248964;
-  static const unsigned int MATERIAL_DESIGN_ICONS_COMPRESSED_DATA[];
+  static constexpr const char *MATERIAL_DESIGN_ICONS =
+      "fonts/materialdesignicons-webfont.ttf";
 };
 
 } // namespace asap::ui
@@ -0,0 +1,332 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/fonts/glyph_cache.h"
+
+#include <contract/contract.h>
+#include <glad/gl.h>
+#include <glad/gl_state.h>
+
+#include <algorithm> // for fill, min
+#include <cmath>     // for round
+
+// ImGui compiles its own copy of stb_truetype with static linkage in
+// imgui_draw.cpp, so we need ours.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+#elif defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imgui/imstb_truetype.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace asap::ui {
+
+const char *const GlyphCache::LOGGER_NAME = "main";
+
+namespace {
+
+/// Space left between the glyphs in a page, so that the linear filtering does
+/// not bleed neighbours in.
+constexpr int GLYPH_PADDING = 1;
+
+} // namespace
+
+GlyphCache::GlyphCache(const void *ttf_data, int ttf_size, Settings settings)
+    : settings_(settings),
+      ttf_data_(static_cast<const unsigned char *>(ttf_data)),
+      ttf_size_(ttf_size) {
+  ASAP_ASSERT(settings_.max_pages > 0);
+  // A glyph must always fit in an empty page
+  ASAP_ASSERT(static_cast<float>(settings_.page_size) >
+              2.0F * settings_.size_pixels);
+}
+
+GlyphCache::~GlyphCache() {
+  Clear();
+}
+
+auto GlyphCache::LoadFont() -> bool {
+  if (font_) {
+    return true;
+  }
+  if (font_failed_) {
+    return false;
+  }
+  auto font = std::make_unique<stbtt_fontinfo>();
+  if (ttf_data_ == nullptr || ttf_size_ <= 0 ||
+      stbtt_InitFont(font.get(), ttf_data_,
+          stbtt_GetFontOffsetForIndex(ttf_data_, 0)) == 0) {
+    ASLOG(error, "could not load the font of the glyph cache");
+    font_failed_ = true;
+    return false;
+  }
+  scale_ = stbtt_ScaleForPixelHeight(font.get(), settings_.size_pixels);
+  int ascent = 0;
+  int descent = 0;
+  int line_gap = 0;
+  stbtt_GetFontVMetrics(font.get(), &ascent, &descent, &line_gap);
+  baseline_ = std::round(static_cast<float>(ascent) * scale_);
+  font_ = std::move(font);
+  return true;
+}
+
+auto GlyphCache::HasGlyph(ImWchar codepoint) -> bool {
+  return LoadFont() && stbtt_FindGlyphIndex(font_.get(), codepoint) != 0;
+}
+
+auto GlyphCache::Find(ImWchar codepoint) -> const Glyph * {
+  const auto found = glyphs_.find(codepoint);
+  if (found != glyphs_.end()) {
+    pages_[found->second.page].last_used_frame = ImGui::GetFrameCount();
+    return &found->second.glyph;
+  }
+  if (missing_.count(codepoint) != 0) {
+    return nullptr;
+  }
+  return Rasterize(codepoint);
+}
+
+auto GlyphCache::Rasterize(ImWchar codepoint) -> const Glyph * {
+  if (!LoadFont()) {
+    return nullptr;
+  }
+  const auto glyph_index = stbtt_FindGlyphIndex(font_.get(), codepoint);
+  if (glyph_index == 0) {
+    missing_.insert(codepoint);
+    return nullptr;
+  }
+
+  int advance = 0;
+  int left_bearing = 0;
+  stbtt_GetGlyphHMetrics(font_.get(), glyph_index, &advance, &left_bearing);
+  int x0 = 0;
+  int y0 = 0;
+  int x1 = 0;
+  int y1 = 0;
+  stbtt_GetGlyphBitmapBox(
+      font_.get(), glyph_index, scale_, scale_, &x0, &y0, &x1, &y1);
+  const auto width = x1 - x0;
+  const auto height = y1 - y0;
+
+  int x = 0;
+  int y = 0;
+  const auto page_index = Allocate(width, height, x, y);
+  if (page_index == settings_.max_pages) {
+    // All the pages hold glyphs of the current frame
+    return nullptr;
+  }
+  auto &page = pages_[page_index];
+
+  if (width > 0 && height > 0) {
+    std::vector<unsigned char> coverage(
+        static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    stbtt_MakeGlyphBitmap(font_.get(), coverage.data(), width, height, width,
+        scale_, scale_, glyph_index);
+    const auto stride = static_cast<std::size_t>(settings_.page_size);
+    for (int row = 0; row < height; ++row) {
+      auto *dst = &page.pixels[static_cast<std::size_t>(y + row) * stride +
+                               static_cast<std::size_t>(x)];
+      const auto *src =
+          &coverage[static_cast<std::size_t>(row) *
+                    static_cast<std::size_t>(width)];
+      for (int col = 0; col < width; ++col) {
+        dst[col] = IM_COL32(255, 255, 255, src[col]); // NOLINT
+      }
+    }
+    if (page.dirty_begin >= page.dirty_end) {
+      page.dirty_begin = y;
+      page.dirty_end = y + height;
+    } else {
+      page.dirty_begin = std::min(page.dirty_begin, y);
+      page.dirty_end = std::max(page.dirty_end, y + height);
+    }
+    ScheduleUpload();
+  }
+
+  const auto page_size = static_cast<float>(settings_.page_size);
+  Glyph glyph;
+  glyph.texture = reinterpret_cast<ImTextureID>( // NOLINT
+      static_cast<std::uintptr_t>(page.texture));
+  glyph.offset =
+      ImVec2(static_cast<float>(x0), baseline_ + static_cast<float>(y0));
+  glyph.size = ImVec2(static_cast<float>(width), static_cast<float>(height));
+  glyph.uv0 = ImVec2(static_cast<float>(x) / page_size,
+      static_cast<float>(y) / page_size);
+  glyph.uv1 = ImVec2(static_cast<float>(x + width) / page_size,
+      static_cast<float>(y + height) / page_size);
+  glyph.advance_x = std::round(static_cast<float>(advance) * scale_);
+
+  page.codepoints.push_back(codepoint);
+  page.last_used_frame = ImGui::GetFrameCount();
+  const auto inserted = glyphs_.emplace(codepoint, Entry{glyph, page_index});
+  return &inserted.first->second.glyph;
+}
+
+auto GlyphCache::PageHasRoom(const Page &page, int width, int height) const
+    -> bool {
+  const auto new_shelf =
+      page.cursor_x + width + GLYPH_PADDING > settings_.page_size;
+  const auto x = new_shelf ? GLYPH_PADDING : page.cursor_x;
+  const auto y = new_shelf ? page.cursor_y + page.shelf_height + GLYPH_PADDING
+                           : page.cursor_y;
+  return x + width + GLYPH_PADDING <= settings_.page_size &&
+         y + height + GLYPH_PADDING <= settings_.page_size;
+}
+
+auto GlyphCache::Allocate(int width, int height, int &x, int &y)
+    -> std::size_t {
+  if (pages_.empty() || !PageHasRoom(pages_[current_page_], width, height)) {
+    if (pages_.size() < settings_.max_pages) {
+      Page page;
+      page.pixels.assign(static_cast<std::size_t>(settings_.page_size) *
+                             static_cast<std::size_t>(settings_.page_size),
+          IM_COL32(255, 255, 255, 0));
+      page.cursor_x = GLYPH_PADDING;
+      page.cursor_y = GLYPH_PADDING;
+      page.dirty_begin = 0;
+      page.dirty_end = settings_.page_size;
+      // The texture is allocated now, so that the glyphs can refer to it, and
+      // filled by the next upload
+      glGenTextures(1, &page.texture);
+      asap::gl::BindTexture(GL_TEXTURE_2D, page.texture);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, settings_.page_size,
+          settings_.page_size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+      pages_.push_back(std::move(page));
+      current_page_ = pages_.size() - 1;
+      ScheduleUpload();
+    } else {
+      // Evict the least recently used page, but never one holding glyphs
+      // already used in this frame
+      const auto frame = ImGui::GetFrameCount();
+      auto victim = settings_.max_pages;
+      for (std::size_t index = 0; index < pages_.size(); ++index) {
+        const auto used = pages_[index].last_used_frame;
+        if (used != frame &&
+            (victim == settings_.max_pages ||
+                used < pages_[victim].last_used_frame)) {
+          victim = index;
+        }
+      }
+      if (victim == settings_.max_pages) {
+        return victim;
+      }
+      Evict(victim);
+      current_page_ = victim;
+    }
+  }
+
+  auto &page = pages_[current_page_];
+  if (page.cursor_x + width + GLYPH_PADDING > settings_.page_size) {
+    // Start a new shelf
+    page.cursor_x = GLYPH_PADDING;
+    page.cursor_y += page.shelf_height + GLYPH_PADDING;
+    page.shelf_height = 0;
+  }
+  x = page.cursor_x;
+  y = page.cursor_y;
+  page.cursor_x += width + GLYPH_PADDING;
+  page.shelf_height = std::max(page.shelf_height, height);
+  return current_page_;
+}
+
+void GlyphCache::Evict(std::size_t index) {
+  auto &page = pages_[index];
+  for (const auto codepoint : page.codepoints) {
+    glyphs_.erase(codepoint);
+  }
+  page.codepoints.clear();
+  std::fill(
+      page.pixels.begin(), page.pixels.end(), IM_COL32(255, 255, 255, 0));
+  page.cursor_x = GLYPH_PADDING;
+  page.cursor_y = GLYPH_PADDING;
+  page.shelf_height = 0;
+  page.dirty_begin = 0;
+  page.dirty_end = settings_.page_size;
+  ++evictions_;
+  ScheduleUpload();
+}
+
+void GlyphCache::ScheduleUpload() {
+  const auto frame = ImGui::GetFrameCount();
+  if (upload_frame_ == frame) {
+    return;
+  }
+  upload_frame_ = frame;
+  // The background draw list is rendered first, before any window using the
+  // glyphs of this frame
+  ImGui::GetBackgroundDrawList()->AddCallback(
+      [](const ImDrawList * /*list*/, const ImDrawCmd *command) {
+        static_cast<GlyphCache *>(command->UserCallbackData)->Upload();
+      },
+      this);
+}
+
+void GlyphCache::Upload() {
+  for (auto &page : pages_) {
+    if (page.dirty_begin >= page.dirty_end) {
+      continue;
+    }
+    asap::gl::BindTexture(GL_TEXTURE_2D, page.texture);
+    const auto offset = static_cast<std::size_t>(page.dirty_begin) *
+                        static_cast<std::size_t>(settings_.page_size);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, page.dirty_begin, settings_.page_size,
+        page.dirty_end - page.dirty_begin, GL_RGBA, GL_UNSIGNED_BYTE,
+        &page.pixels[offset]);
+    uploaded_bytes_ += static_cast<std::size_t>(page.dirty_end -
+                                                page.dirty_begin) *
+                       static_cast<std::size_t>(settings_.page_size) *
+                       sizeof(std::uint32_t);
+    page.dirty_begin = 0;
+    page.dirty_end = 0;
+  }
+}
+
+void GlyphCache::Clear() {
+  for (auto &page : pages_) {
+    if (page.texture != 0) {
+      asap::gl::DeleteTextures(1, &page.texture);
+    }
+  }
+  pages_.clear();
+  glyphs_.clear();
+  current_page_ = 0;
+}
+
+void GlyphCache::Icon(ImWchar codepoint) {
+  const auto *glyph = Find(codepoint);
+  const auto pos = ImGui::GetCursorScreenPos();
+  const auto width =
+      glyph != nullptr ? glyph->advance_x : settings_.size_pixels;
+  ImGui::Dummy(ImVec2(width, settings_.size_pixels));
+  if (glyph != nullptr) {
+    const auto min = ImVec2(pos.x + glyph->offset.x, pos.y + glyph->offset.y);
+    const auto max = ImVec2(min.x + glyph->size.x, min.y + glyph->size.y);
+    ImGui::GetWindowDrawList()->AddImage(glyph->texture, min, max, glyph->uv0,
+        glyph->uv1, ImGui::GetColorU32(ImGuiCol_Text));
+  }
+}
+
+auto GlyphCache::GetStats() const -> Stats {
+  return {glyphs_.size(), pages_.size(), evictions_, uploaded_bytes_};
+}
+
+} // namespace asap::ui
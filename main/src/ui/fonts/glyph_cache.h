@@ -0,0 +1,169 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct stbtt_fontinfo;
+
+namespace asap::ui {
+
+/*!
+ * \brief Glyph cache rasterizing the glyphs of a font on demand, the first time
+ * they are used.
+ *
+ * The baked font atlas is the right thing for the text and the few icons used
+ * in the UI, but baking a whole icon font or large Unicode ranges up front
+ * makes the startup slow and the atlas huge. This cache starts empty: a glyph
+ * is rasterized (with stb_truetype) the first time it is looked up, and packed
+ * in one of a bounded number of fixed size texture pages.
+ *
+ * When all the pages are full, the least recently used page which was not used
+ * in the current frame is evicted and reused. The memory is therefore bounded
+ * by the page budget, whatever the number of glyphs drawn over time.
+ *
+ * Pixels are uploaded to the GPU incrementally: only the rows of the pages
+ * touched since the last upload are sent with `glTexSubImage2D`. The upload is
+ * scheduled automatically, as a callback at the start of the background draw
+ * list, so that it happens in the render pass of the frame using the glyphs.
+ *
+ * The cache must be used from the UI thread, and destroyed while the OpenGL
+ * context is still alive.
+ */
+class GlyphCache : public asap::logging::Loggable<GlyphCache> {
+public:
+  struct Settings {
+    /// Font size in pixels.
+    float size_pixels{13.0F};
+    /// Width and height in pixels of a texture page.
+    int page_size{512};
+    /// Maximum number of texture pages.
+    std::size_t max_pages{4};
+  };
+
+  /// A rasterized glyph. Positions are relative to the top left corner of the
+  /// line, at the font size.
+  struct Glyph {
+    ImTextureID texture{nullptr};
+    ImVec2 offset;
+    ImVec2 size;
+    ImVec2 uv0;
+    ImVec2 uv1;
+    float advance_x{0};
+  };
+
+  struct Stats {
+    std::size_t glyphs{0};
+    std::size_t pages{0};
+    std::size_t evictions{0};
+    std::size_t uploaded_bytes{0};
+  };
+
+  /*!
+   * \brief Create a cache for the given TTF font, which is used in place and
+   * must outlive the cache.
+   *
+   * The font is loaded when the first glyph is looked up, and no texture is
+   * created until then.
+   */
+  GlyphCache(const void *ttf_data, int ttf_size, Settings settings);
+
+  GlyphCache(const GlyphCache &) = delete;
+  GlyphCache(GlyphCache &&) = delete;
+  auto operator=(const GlyphCache &) -> GlyphCache & = delete;
+  auto operator=(GlyphCache &&) -> GlyphCache & = delete;
+
+  ~GlyphCache();
+
+  /// Whether the font has a glyph for the codepoint.
+  [[nodiscard]] auto HasGlyph(ImWchar codepoint) -> bool;
+
+  /*!
+   * \brief Find the glyph for the codepoint, rasterizing it if needed.
+   *
+   * Must be called while building a frame. Return nullptr if the font has no
+   * such glyph or if the page budget is exhausted by the glyphs of the current
+   * frame.
+   */
+  auto Find(ImWchar codepoint) -> const Glyph *;
+
+  /// Draw the glyph as an item, like a single character of text.
+  void Icon(ImWchar codepoint);
+
+  /// Upload the rows of the pages modified since the last upload. Called
+  /// automatically during the rendering of the frame.
+  void Upload();
+
+  /// Drop all the glyphs and release the textures.
+  void Clear();
+
+  [[nodiscard]] auto GetSettings() const -> const Settings & {
+    return settings_;
+  }
+
+  [[nodiscard]] auto GetStats() const -> Stats;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  struct Page {
+    unsigned int texture{0};
+    /// RGBA pixels, white with the glyph coverage in the alpha.
+    std::vector<std::uint32_t> pixels;
+    /// Shelf packing state.
+    int cursor_x{0};
+    int cursor_y{0};
+    int shelf_height{0};
+    /// Rows to upload, empty when dirty_begin >= dirty_end.
+    int dirty_begin{0};
+    int dirty_end{0};
+    int last_used_frame{-1};
+    std::vector<ImWchar> codepoints;
+  };
+
+  struct Entry {
+    Glyph glyph;
+    std::size_t page;
+  };
+
+  auto LoadFont() -> bool;
+  auto Rasterize(ImWchar codepoint) -> const Glyph *;
+  /// Find room for a `width` x `height` rectangle, evicting a page if needed.
+  /// Return the page index, or max_pages if there is no room.
+  auto Allocate(int width, int height, int &x, int &y) -> std::size_t;
+  auto PageHasRoom(const Page &page, int width, int height) const -> bool;
+  void Evict(std::size_t index);
+  void ScheduleUpload();
+
+  Settings settings_;
+  const unsigned char *ttf_data_;
+  int ttf_size_;
+
+  std::unique_ptr<stbtt_fontinfo> font_;
+  bool font_failed_{false};
+  float scale_{0};
+  float baseline_{0};
+
+  std::unordered_map<ImWchar, Entry> glyphs_;
+  /// Codepoints known to have no glyph in the font.
+  std::unordered_set<ImWchar> missing_;
+  std::vector<Page> pages_;
+  std::size_t current_page_{0};
+  int upload_frame_{-1};
+  std::size_t evictions_{0};
+  std::size_t uploaded_bytes_{0};
+};
+
+} // namespace asap::ui
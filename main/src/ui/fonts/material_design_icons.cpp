@@ -1,10404 +0,0 @@
-/*     SPDX-License-Identifier: BSD-3-Clause     */
-
-//        Copyright The Authors 2021.
-//    Distributed under the 3-Clause BSD License.
-//    (See accompanying file LICENSE or copy at
-//   https://opensource.org/licenses/BSD-3-Clause)
-
-// File: 'materialdesignicons-webfont.ttf' (358456 bytes)
-// Exported using binary_to_compressed_c.cpp
-
-// Copyright (c) 2014, Austin Andrews (http://materialdesignicons.com/),
-// with Reserved Font Name Material Design Icons.
-// Copyright(c) 2014, Google(http://www.google.com/design/) uses the
-// license at:
-// https://github.com/google/material-design-icons/blob/master/LICENSE
-
-// This Font Software is licensed under the SIL Open Font License,
-// Version 1.1.This license is copied below, and is also available with a
-// FAQ at : http://scripts.sil.org/OFL
-
-#include "fonts.h"
-
-namespace asap::ui {
-
-// clang-format off
-const unsigned int Fonts::MATERIAL_DESIGN_ICONS_COMPRESSED_DATA[248964 / 4] = {
-    0x0000bc57, 0x00000000, 0x38780500, 0x00000400, 0x00010036, 0x000a0000,
-    0x00030080, 0x2f534f20, 0x53bc3f32, 0x01000028, 0x002d0382, 0x616d6356,
-    0x11c7e970, 0x280000b6, 0x38138258, 0x796c674a, 0xad04c566, 0x5000002d,
-    0x8e040080, 0x616568d8, 0xc3700f64, 0x204182db, 0x210382d0, 0x10826836,
-    0x0bf30323, 0x200b8275, 0x260382ac, 0x746d6824, 0x82186a78, 0x01003209,
-    0x26000080, 0x636f6cd8, 0x93bb1561, 0x2900006c, 0x3b0f82a4, 0x78616ddc,
-    0x00da0a70, 0x010000e8, 0x00000008, 0x6d616e20, 0xecaa6565, 0xdf040044,
-    0x02316f82, 0x736f70b2, 0x6d11fd74, 0xe20400e1, 0x9600000c, 0x2dab8329,
-    0xc0ffc001, 0x00022e00, 0xfeff0000, 0x11830202, 0x02880a82, 0x84b60921,
-    0x00012e11, 0x2cddc600, 0x3c0f5ff6, 0x020b00f5, 0x23008300, 0xa84129d7,
-    0xff270787, 0x02bffffe, 0x82ce0101, 0x0008210f, 0x33824387, 0xdc223d82,
-    0x15821a00, 0x15820020, 0x0a000022, 0x66820182, 0x00850020, 0x28820120,
-    0x05009028, 0x0f000800, 0x12826601, 0x07864720, 0x1900f524, 0x30838400,
-    0x82030521, 0x29029215, 0x64456650, 0x01f04000, 0xbb85b5f9, 0x41207782,
-    0x01202682, 0x02830382, 0x3b831820, 0x26030010, 0x000023d1, 0x03860300,
-    0x66001c21, 0x442205eb, 0x09840300, 0x04001c24, 0x1b822800, 0x07820620,
-    0x02000129, 0xb5f90000, 0x8200ffff, 0x01f02100, 0x10210783, 0x82258400,
-    0x2008820f, 0x10068406, 0x09010400, 0x00008428, 0x00003401, 0x03821802,
-    0x03825c20, 0x0000b824, 0x03822403, 0x03829c20, 0x0000f424, 0x03826404,
-    0x0000e424, 0x03827005, 0x06200782, 0x06282b82, 0x070000b0, 0x0800008c,
-    0x08212782, 0x24078298, 0x090000fc, 0x24038274, 0x0a0000d0, 0x82038238,
-    0x820b2007, 0xd80b2527, 0x680c0000, 0xe0230382, 0x820d0000, 0x7c0e2913,
-    0xc00e0000, 0x1c0f0000, 0x78240382, 0x00100000, 0x47820382, 0x00481128,
-    0x00f81100, 0x0b821200, 0x73821220, 0x00241324, 0x4f821300, 0x2b821320,
-    0x00081425, 0x82481400, 0x250b8203, 0x00004c15, 0x03826c16, 0x0000c823,
-    0x2d8f8217, 0x00003418, 0x0000cc18, 0x0000b419, 0x0382441a, 0x1b206782,
-    0x1c203782, 0x1c200b82, 0x1d207b82, 0x1e201f82, 0x1e243f82, 0x1e000088,
-    0x1f245f82, 0x1f000038, 0x1f203782, 0x1f20e382, 0x20206782, 0x20252782,
-    0x200000ac, 0x820382d4, 0x6421251f, 0x90210000, 0x1f820382, 0x9b822220,
-    0x6b822220, 0x47822220, 0x00182325, 0x82802300, 0x00e82403, 0x82142400,
-    0x823c2003, 0x82842003, 0x00f02403, 0x825c2500, 0x009c2303, 0x2f822600,
-    0x82282621, 0x82502007, 0x00982403, 0x82042700, 0x246b8203, 0x0000b027,
-    0x20338228, 0x207b8228, 0x202b8228, 0x208b8228, 0x82138328, 0x8229206f,
-    0x8229206f, 0x822a207b, 0x782a241f, 0x822a0000, 0x822b200b, 0x822b2023,
-    0x822c2073, 0xdc2c259b, 0x2c2d0000, 0x94240382, 0x482e0000, 0xc4230382,
-    0x822f0000, 0x682f2157, 0xe4240782, 0x30300000, 0x6b820382, 0x73823120,
-    0x27823220, 0x5b823220, 0xd7823220, 0x1f823320, 0xab823320, 0x07823420,
-    0x00a83424, 0x13823400, 0x00403525, 0x828c3500, 0x245b8203, 0x00002436,
-    0x259b8236, 0x0000bc36, 0x03820837, 0x03825420, 0x0000ac23, 0x20c38238,
-    0x250b8238, 0x0000b038, 0x03820c39, 0x39203f82, 0x3a207382, 0x3a202f82,
-    0x3a24ef82, 0x3b0000d0, 0x3b206782, 0x3b24ab82, 0x3c0000d4, 0x3c245382,
-    0x3d0000cc, 0x3d247f82, 0x3e0000ec, 0x3e24b382, 0x3f0000c8, 0x3f283782,
-    0x400000e0, 0x41000020, 0x41215382, 0x82078258, 0x3c422427, 0x82420000,
-    0x82432067, 0xe4432437, 0x82440000, 0xc044246b, 0x82450000, 0x8246205f,
-    0x824620d7, 0x824620cf, 0x8247207b, 0x804824eb, 0x82480000, 0x2849244b,
-    0x82490000, 0x904a246b, 0x824b0000, 0x824b204f, 0x4c4c24ef, 0x824c0000,
-    0x104d2507, 0x744d0000, 0x27820382, 0x00344e30, 0x00a44e00, 0x00b85000,
-    0x00f05100, 0xdb825300, 0x93825420, 0x63825520, 0x009c5529, 0x00fc5500,
-    0x82605600, 0x25878203, 0x00005c57, 0x0382a857, 0x0000d824, 0x03821c58,
-    0x03826c20, 0x59200f82, 0x5920ab82, 0x59207b82, 0x59202f82, 0x5a209f82,
-    0x5a208b82, 0x5b204382, 0x5c205382, 0x5d20d382, 0x5e209f82, 0x5e202f82,
-    0x5f209b82, 0x5f282782, 0x600000b4, 0x6100007c, 0x6120f782, 0x62248382,
-    0x630000c4, 0x63201f82, 0x63209382, 0x6420ff82, 0x6420a782, 0x64242382,
-    0x650000e8, 0x6521e382, 0x82078264, 0x82662027, 0x786624d3, 0x82660000,
-    0x826720a7, 0x82672023, 0x826720cb, 0x8c68250b, 0x08690000, 0xc0230382,
-    0x826a0000, 0x826a20ab, 0x826b202b, 0x826b2033, 0x826c20a7, 0x386d2423,
-    0x836d0000, 0x20938207, 0x20d7826e, 0x252b826f, 0x0000886f, 0x03821070,
-    0x00008423, 0x20bf8271, 0x20cb8271, 0x24e38271, 0x0000f471, 0x20678272,
-    0x20278272, 0x20a38272, 0x24c38272, 0x0000fc72, 0x206f8273, 0x24938273,
-    0x00000474, 0x283b8274, 0x00000c75, 0x00009475, 0x209f8276, 0x20ef8276,
-    0x241f8277, 0x0000bc77, 0x203b8278, 0x201f8278, 0x205b8279, 0x20978279,
-    0x20d7827a, 0x2447827a, 0x0000507b, 0x2053827c, 0x20af827c, 0x2073827d,
-    0x2037827e, 0x20f7827e, 0x29f3827f, 0x0000d07f, 0x0000a880, 0x03821881,
-    0x82200782, 0x82204382, 0x8325cb82, 0x84000030, 0x82038234, 0x828420f3,
-    0x8285209b, 0xd4852437, 0x82860000, 0xa08624cf, 0x82870000, 0x8087242f,
-    0x82880000, 0x68882193, 0x5b820782, 0x33828920, 0xfb828920, 0x00908924,
-    0x5f828900, 0x7f828a20, 0x00408a24, 0x27828a00, 0x9f828a20, 0x23828a20,
-    0xab828b20, 0xbb828b20, 0x00e08b24, 0x6b828c00, 0x0b828c20, 0x00e88c25,
-    0x823c8d00, 0x009c2303, 0x4f828e00, 0x82708e21, 0x29638207, 0x0000a48f,
-    0x0000dc8f, 0x03821490, 0x03824820, 0x9020cb82, 0x90201782, 0x90245b82,
-    0x910000e4, 0x91202b82, 0x9124c382, 0x920000c8, 0x92245782, 0x930000ac,
-    0x93256f82, 0x940000b8, 0x8203822c, 0x8295202b, 0x8c95293b, 0x10960000,
-    0x54970000, 0xdb820382, 0x2b829820, 0x00089929, 0x00889900, 0x820c9a00,
-    0x82982003, 0x20e38203, 0x2033829b, 0x2483829b, 0x0000f89b, 0x20f7829c,
-    0x2433829d, 0x00005c9d, 0x28bb829d, 0x00006c9e, 0x0000b49e, 0x2013829f,
-    0x251b829f, 0x0000d49f, 0x038258a0, 0xa120d382, 0xa2241b82, 0xa2000024,
-    0xa220e782, 0xa324d782, 0xa3000084, 0xa4243382, 0xa4000020, 0xa4201b82,
-    0xa5245b82, 0xa5000018, 0xa5203782, 0xa629cf82, 0xa6000038, 0xa7000090,
-    0x23038230, 0xa8000068, 0xa8215382, 0x82078264, 0x82a920c7, 0x82a9202f,
-    0xd0a9243f, 0x82aa0000, 0x82aa20a7, 0x44ab244f, 0x82ab0000, 0x1cac284f,
-    0x94ac0000, 0x82ad0000, 0x70ad212f, 0xec230782, 0x82ae0000, 0x82ae2083,
-    0x82af2053, 0x82b020cb, 0x82b02017, 0x82b02083, 0x82b120bf, 0x82b12017,
-    0x34b228af, 0xa4b20000, 0x82b30000, 0x82b3206b, 0x40b42873, 0xb8b40000,
-    0x82b50000, 0x82b520eb, 0x00b62533, 0x48b60000, 0x13820382, 0x2b82b720,
-    0x0014b824, 0x1382b900, 0x2782ba20, 0x0098ba25, 0x8208bb00, 0x00b42303,
-    0x1382bc00, 0xab82bc20, 0x82acbc21, 0x24f3820b, 0x00003cbd, 0x200b82bd,
-    0x20cb82be, 0x20d782be, 0x20af82be, 0x24a782bf, 0x0000b0bf, 0x20a782c0,
-    0x207f82c0, 0x203482c0, 0x20c382c1, 0x20ff82c1, 0x202f82c2, 0x254f82c2,
-    0x00000cc3, 0x038260c3, 0xc4245382, 0xc4000028, 0xc525af82, 0xc5000004,
-    0x82038250, 0x82c62083, 0x82c62097, 0x82c72057, 0x82c7202f, 0xc4c7251b,
-    0x20c80000, 0xa0230382, 0x82c90000, 0x82c9207f, 0x82ca201b, 0x82ca202f,
-    0x82ca2027, 0x82cb20f7, 0x8ccb24b3, 0x82cb0000, 0xe4cb244f, 0x82cc0000,
-    0x82cc20cb, 0xf8cc25ef, 0x64cd0000, 0xe8270382, 0x84ce0000, 0x82cf0000,
-    0x82d0204f, 0x82d0207b, 0x82d02043, 0x82d1208f, 0x82d1200f, 0x82d2203f,
-    0x82d22083, 0x82d3205b, 0x82d320c7, 0x82d4200f, 0x94d42807, 0xc0d40000,
-    0x82d50000, 0x82d5204b, 0x40d6247f, 0x82d60000, 0x82d6208b, 0xd8d7245f,
-    0x82d80000, 0x82d92053, 0x00da2463, 0x82da0000, 0x82db2007, 0x82db2043,
-    0x7cdc241b, 0x82dd0000, 0x82dd202b, 0x82dd208f, 0xecdd258f, 0x24de0000,
-    0x0f820382, 0x5b82de20, 0x0b82df20, 0x2382df20, 0xcf82e020, 0x5782e020,
-    0x0078e124, 0x6382e200, 0x00fce228, 0x00a8e300, 0xd382e500, 0x00e0e528,
-    0x00bce600, 0xab82e700, 0x826ce721, 0x208b8207, 0x205b82e7, 0x209782e8,
-    0x202382e8, 0x241782e9, 0x000044e9, 0x245382e9, 0x0000b8ea, 0x20db82eb,
-    0x251782eb, 0x000010ec, 0x038274ec, 0xed287382, 0xed000098, 0xee0000f0,
-    0xee202782, 0xee201f82, 0xef201382, 0xef209782, 0xf024ab82, 0xf0000050,
-    0xf1247782, 0xf1000008, 0xf225e382, 0xf2000004, 0x82038268, 0x82f3200b,
-    0x9cf32863, 0xf8f30000, 0x82f40000, 0xd4f42527, 0x30f50000, 0x88230382,
-    0x82f60000, 0x82f620eb, 0x82f6208f, 0x82f720b7, 0x82f7204b, 0x82f82027,
-    0x58f8243b, 0x82f90000, 0xb0fa24d3, 0x82fb0000, 0x82fb20bf, 0xe8fb2563,
-    0x3cfc0000, 0xbb820382, 0x6782fd20, 0x0064fd28, 0x00d0fd00, 0x6782fe00,
-    0xcb82fe20, 0x4782ff20, 0x00b8ff25, 0x82140001, 0x00882403, 0x82080101,
-    0x003c2403, 0x82000301, 0x00702403, 0x820c0501, 0x82b02003, 0x00d82403,
-    0x82500601, 0x008c2403, 0x82240701, 0x824c2003, 0x82a82003, 0x00cc2303,
-    0x3b820801, 0x1b820820, 0x82a00821, 0x00ec230b, 0x1b820901, 0x00040a29,
-    0x00980a01, 0x82180b01, 0x00e82403, 0x82280c01, 0x200f8203, 0x281f820c,
-    0x01005c0d, 0x0100ac0d, 0x2147820e, 0x0782900e, 0x0100e024, 0x0382380f,
-    0x10203f82, 0x10247f82, 0x10010054, 0x11207382, 0x11295782, 0x11010068,
-    0x120100e4, 0x23038240, 0x130100a4, 0x13240782, 0x140100d4, 0x14249b82,
-    0x150100bc, 0x15202f82, 0x15202f82, 0x16201b82, 0x16240b82, 0x16010048,
-    0x16253b82, 0x170100f0, 0x82038244, 0x8217205f, 0x2c18247f, 0x82180100,
-    0x8219200b, 0x821920d7, 0xc81924ab, 0x821a0100, 0x7c1a21e7, 0x47820782,
-    0x00fc1a25, 0x82781b01, 0x20178203, 0x20b3821c, 0x203b821c, 0x252f821c,
-    0x0100101d, 0x0382741d, 0x1e20b782, 0x1e20d782, 0x1e28ff82, 0x1e0100c0,
-    0x1f0100f4, 0x1f205382, 0x2020c782, 0x2020db82, 0x21207f82, 0x2120f382,
-    0x21202382, 0x21243782, 0x220100d8, 0x22244782, 0x23010094, 0x23204382,
-    0x23214f82, 0x820b829c, 0x8224203b, 0x82252013, 0x6c25292b, 0xd0250100,
-    0x34260100, 0x87820382, 0x00c42624, 0x93822701, 0x00842724, 0x3b822801,
-    0x00b42828, 0x00582901, 0xd3822a01, 0x9f822a20, 0x00602b24, 0x23822b01,
-    0x23822c20, 0x00e02c24, 0x6b822d01, 0x00302e2c, 0x00cc2e01, 0x00982f01,
-    0x1f823001, 0x77823020, 0x1f823120, 0x00643124, 0xb3823101, 0x1f823220,
-    0x6b823320, 0x1b823320, 0x87823420, 0xe3823420, 0x0f823520, 0xf3823520,
-    0x3f823620, 0xc7823620, 0x67823720, 0x00683824, 0x2b823901, 0x1b823a20,
-    0x3f823a20, 0x3b823a20, 0x00503b29, 0x00a83b01, 0x82143c01, 0x00e82403,
-    0x82383d01, 0x00b82703, 0x00543e01, 0x1b823f01, 0x00b03f24, 0x43824001,
-    0x00084124, 0xf3824101, 0x00004224, 0x77824201, 0x47824320, 0x0f824320,
-    0x00204429, 0x00804401, 0x823c4501, 0x209f8203, 0x20d38246, 0x24fb8246,
-    0x0100f846, 0x20878247, 0x206b8248, 0x20478248, 0x20d38248, 0x25e38249,
-    0x0100a449, 0x03822c4a, 0x01008823, 0x2053824b, 0x251b824b, 0x0100ac4b,
-    0x0382244c, 0x4c201b82, 0x4d20e782, 0x4d205382, 0x4e207f82, 0x4e201382,
-    0x4f204382, 0x4f204382, 0x4f200f82, 0x4f201f82, 0x50201f82, 0x50241f82,
-    0x50010068, 0x51243782, 0x51010034, 0x51257f82, 0x520100e0, 0x23038228,
-    0x5301007c, 0x53205782, 0x5324a382, 0x540100dc, 0x54201382, 0x5528df82,
-    0x55010044, 0x560100d4, 0x5621df82, 0x82078260, 0x8257208f, 0x5c582883,
-    0xc0580100, 0x82590100, 0x8c59216b, 0xd8280782, 0x4c5a0100, 0x105b0100,
-    0x1b820382, 0x17825c20, 0x83825c20, 0x73825d20, 0x009c5d25, 0x82405e01,
-    0x20778203, 0x2463825f, 0x0100b05f, 0x20278260, 0x247f8260, 0x0100fc60,
-    0x202f8261, 0x24ab8262, 0x01003062, 0x24638262, 0x01001463, 0x245b8263,
-    0x0100f063, 0x28878264, 0x0100f464, 0x0100cc65, 0x25238266, 0x01004866,
-    0x03820c67, 0x6820d382, 0x6920db82, 0x69244782, 0x690100bc, 0x6a204782,
-    0x6a287f82, 0x6b0100ec, 0x6c0100c8, 0x6d201f82, 0x6d247b82, 0x6d010070,
-    0x6e206f82, 0x6e208f82, 0x6f208f82, 0x6f204f82, 0x6f247782, 0x700100b8,
-    0x70203b82, 0x7020ef82, 0x71202b82, 0x71201f82, 0x71201782, 0x7225c782,
-    0x72010018, 0x82038274, 0x827320eb, 0xb47324f7, 0x82740100, 0x8474241f,
-    0x82750100, 0x82752033, 0x827620ff, 0xd076250f, 0x90770100, 0xf8230382,
-    0x82780100, 0x3c792413, 0x82790100, 0x827a2033, 0x827a20eb, 0x827b20af,
-    0x827b20cb, 0x827c2067, 0x827c2033, 0x827c204f, 0x827d209b, 0xa07d25bf,
-    0x087e0100, 0x9b820382, 0x2f827e20, 0x93827f20, 0xbf827f20, 0x00508028,
-    0x009c8001, 0x73828101, 0xb3828120, 0xbf828220, 0x07828220, 0x00688325,
-    0x82a88301, 0x00f42403, 0x82308401, 0x20738203, 0x20a38285, 0x20bb8285,
-    0x20af8285, 0x20478286, 0x24c38286, 0x0100bc86, 0x230f8386, 0x870100f0,
-    0x87205f82, 0x87218782, 0x820b828c, 0x34882577, 0x7c880100, 0xd4230382,
-    0x82890100, 0x8289201b, 0xc089253b, 0x1c8a0100, 0x5f820382, 0xaf828a20,
-    0x004c8b24, 0xd3828b01, 0x87828c20, 0x00e88c24, 0x73828d01, 0x00e48d24,
-    0xb3828e01, 0x2f828e20, 0x0f828e20, 0x17828e20, 0x1f828f20, 0x2f828f20,
-    0x00249028, 0x00949001, 0x8b829101, 0x47829220, 0x23829220, 0x7f829220,
-    0x07829320, 0xf3829420, 0x07839420, 0x95209782, 0x95200b82, 0x9524a382,
-    0x960100dc, 0x96208782, 0x96246f82, 0x970100ac, 0x97218782, 0x82078254,
-    0xe0972443, 0x82980100, 0x7898211b, 0xbf820782, 0x00149924, 0x0b829901,
-    0x0b829920, 0x00749a24, 0x43829b01, 0x00889b24, 0x53829c01, 0x00f89c29,
-    0x00849d01, 0x82b89e01, 0x200b8203, 0x259f829f, 0x0100a09f, 0x03820ca0,
-    0x03826020, 0xa1294f82, 0xa1010020, 0xa2010090, 0x8203822c, 0x82a220b7,
-    0x82a32047, 0xbca3253b, 0x28a40100, 0xfb820382, 0x0038a524, 0x8782a501,
-    0xcf82a620, 0xf782a620, 0x3382a720, 0x009ca728, 0x00fca701, 0x4782a801,
-    0x3382a820, 0x0782a920, 0xd382a920, 0x8b82aa20, 0x6b82aa20, 0x0044ab24,
-    0x4382ab01, 0x9f82ac20, 0x3b82ac20, 0x9b82ad20, 0xff82ae20, 0x008cae25,
-    0x8230af01, 0x00b02403, 0x8240b001, 0x24438203, 0x010098b1, 0x205382b2,
-    0x243382b2, 0x010080b2, 0x20a782b3, 0x204782b3, 0x200f82b4, 0x209382b5,
-    0x204f82b5, 0x202f82b6, 0x28db82b7, 0x010068b7, 0x0100ccb7, 0x201b82b8,
-    0x284f82b9, 0x010008ba, 0x010070ba, 0x240f82bb, 0x0100a4bb, 0x200f82bc,
-    0x200f82bc, 0x202b82bd, 0x20d782bd, 0x286382be, 0x0100b4be, 0x0100d4bf,
-    0x211b82c0, 0x078258c0, 0xc1240f82, 0xc101001c, 0xc2256b82, 0xc3010004,
-    0x82038224, 0xe8c3243b, 0x82c40100, 0x5cc42137, 0x63820782, 0x2f82c520,
-    0x2f82c520, 0x1f82c620, 0xb782c620, 0x00c8c625, 0x822cc701, 0x00a02303,
-    0xc382c801, 0x1382c820, 0x00e0c824, 0x0b82c901, 0x0b82c920, 0x0028ca28,
-    0x009cca01, 0x3782cb01, 0xd382cb20, 0x4b82cc20, 0x00c0cc25, 0x8264cd01,
-    0x00ec2303, 0x0782ce01, 0x00dcce24, 0x5f82cf01, 0x5382d020, 0xcb82d020,
-    0x00d8d025, 0x8214d201, 0x826c2003, 0x20578203, 0x242782d2, 0x010020d3,
-    0x249b82d3, 0x010054d4, 0x215382d5, 0x078284d5, 0xd5205782, 0xd6201b82,
-    0xd6200f82, 0xd620d782, 0xd7205782, 0xd720bb82, 0xd720df82, 0xd7202b82,
-    0xd820af82, 0xd8295382, 0xd80100d0, 0xd90100f8, 0x8203824c, 0x3cda2433,
-    0x82da0100, 0x82db20ef, 0x7cdb2527, 0x18dc0100, 0x0f820382, 0x0000dd24,
-    0xb782dd01, 0xb782dd20, 0x00c4dd24, 0x9b82de01, 0xdf82de20, 0x7382df20,
-    0x00bcdf25, 0x8248e001, 0x203f8203, 0x207382e0, 0x209b82e1, 0x205782e1,
-    0x206782e2, 0x205b82e2, 0x24c382e3, 0x0100a4e4, 0x214382e5, 0x078234e5,
-    0xe6204f82, 0xe724cb82, 0xe9010078, 0xe9286782, 0xea0100d4, 0xeb010058,
-    0xec24d782, 0xec01001c, 0xec20af82, 0xed203382, 0xee203382, 0xee287f82,
-    0xee010074, 0xef0100f4, 0xef20c382, 0xf0204f82, 0xf0204382, 0xf0286382,
-    0xf00100ac, 0xf10100fc, 0xf1200f82, 0xf1207b82, 0xf2201b82, 0xf2204782,
-    0xf3243b82, 0xf3010010, 0xf4242f82, 0xf501005c, 0xf5219b82, 0x24078288,
-    0xf60100e0, 0x82038244, 0x82f7206f, 0xa8f72413, 0x82f80100, 0x82f82007,
-    0x82f82047, 0x82f920b7, 0x94f9281b, 0xe8f90100, 0x82fa0100, 0x82fa208b,
-    0x0cfb24db, 0x82fb0100, 0x04fc2543, 0x28fc0100, 0xa0200382, 0x5f820382,
-    0x003cfd29, 0x00b8fd01, 0x8220fe01, 0x00982303, 0x6f82ff01, 0x0088ff29,
-    0x00000002, 0x82900002, 0x00e02403, 0x82380102, 0x00bc2403, 0x82200202,
-    0x00dc2403, 0x826c0302, 0x20178203, 0x25278204, 0x02001805, 0x03827c05,
-    0x0200b428, 0x02004406, 0x03820807, 0x03825c20, 0x08252f82, 0x08020014,
-    0x24038280, 0x090200d4, 0x20038230, 0x82038274, 0x3c0a283f, 0xa40a0200,
-    0x820b0200, 0xc80b2507, 0x0c0c0200, 0x4b820382, 0x00640d24, 0x43820e02,
-    0x00cc0e29, 0x00940f02, 0x822c1002, 0x00502303, 0x77821102, 0x00781124,
-    0x2f821202, 0x0b821320, 0x00041424, 0x83821402, 0x83821420, 0x00d81524,
-    0x4b821602, 0x009c1729, 0x00f81702, 0x82241802, 0x20b78203, 0x207f8218,
-    0x208b8219, 0x200b8219, 0x20cb821a, 0x20a3821a, 0x246b821a, 0x0200fc1a,
-    0x2153821b, 0x0782841b, 0x1c243f82, 0x1c02001c, 0x1c205b82, 0x1d201b82,
-    0x1d295782, 0x1d020070, 0x1e0200e8, 0x82038234, 0x821e2033, 0x821f20af,
-    0x821f209f, 0x821f207b, 0x821f209f, 0x582024a7, 0x82210200, 0x8222200b,
-    0xc4222483, 0x82230200, 0x822320a7, 0x822420b3, 0x682524df, 0x82260200,
-    0x822720a3, 0x8c272473, 0x82270200, 0x4028249f, 0x82280200, 0x8228206f,
-    0x82292063, 0x8229208f, 0x822a2033, 0x822b203f, 0x822c202b, 0x822c20ef,
-    0x802d2423, 0x822e0200, 0x822e2037, 0x302f2813, 0xc02f0200, 0x82300200,
-    0x8230209b, 0x823120db, 0xd0312413, 0x82320200, 0x8232209f, 0x82322097,
-    0x82322083, 0x8233204b, 0x5c332497, 0x82340200, 0xa034217f, 0x13820782,
-    0xdf823420, 0x47823520, 0x00543528, 0x00f83502, 0x1f823602, 0xdf823620,
-    0x4f823620, 0x4f823720, 0x00103824, 0x2b823802, 0x0b823920, 0x00503924,
-    0x97823902, 0x0b823a20, 0x00b43a25, 0x82083b02, 0x24ff8203, 0x0200f03b,
-    0x2063823c, 0x2097823c, 0x207f823d, 0x2067823e, 0x24db823e, 0x0200dc3e,
-    0x244f823f, 0x0200d43f, 0x20078240, 0x205f8240, 0x242f8241, 0x0200ec41,
-    0x20a38242, 0x28078242, 0x02003c43, 0x02009843, 0x24ff8244, 0x02005844,
-    0x215b8245, 0x07829445, 0x46209782, 0x4728e382, 0x47020024, 0x480200bc,
-    0x4820c782, 0x48206382, 0x49206382, 0x4920ab82, 0x4a205382, 0x4a20c782,
-    0x4a205782, 0x4b254782, 0x4b02003c, 0x82038264, 0x824c200b, 0x824c20bf,
-    0x6c4d247b, 0x824e0200, 0x824e2037, 0x824f20bf, 0xcc4f2477, 0x82500200,
-    0x9c502427, 0x82510200, 0x825120a3, 0x14522477, 0x82520200, 0x8253201f,
-    0x40532477, 0x82530200, 0x8254206b, 0x82552007, 0x82562063, 0x825720eb,
-    0x82572063, 0x82582007, 0x82582037, 0x8258207f, 0x305924eb, 0x82590200,
-    0x045a243b, 0x825a0200, 0xc85a24b3, 0x825b0200, 0x825b2027, 0xc45c24b3,
-    0x825d0200, 0x825e201b, 0xb45e2423, 0x825f0200, 0x825f205f, 0x825f20c7,
-    0x10602457, 0x82600200, 0x8260207b, 0x82602087, 0x20612547, 0x38610200,
-    0x60200382, 0xe4230382, 0x82620200, 0xd062250b, 0x48630200, 0xe7820382,
-    0xcf826420, 0x00006524, 0x33826502, 0x1b826620, 0x007c6624, 0x6b826602,
-    0x37826720, 0x5b826720, 0xfb826820, 0x1f826920, 0x004c6924, 0x43826a02,
-    0xf3826a20, 0x00286b25, 0x828c6b02, 0x24638203, 0x0200246c, 0x2423826c,
-    0x0200946c, 0x20d3826d, 0x2043826e, 0x2453826e, 0x0200ec6e, 0x242f826f,
-    0x0200d46f, 0x249b8270, 0x0200f470, 0x24078271, 0x02004472, 0x24c38272,
-    0x0200a073, 0x20838274, 0x24c38275, 0x02007075, 0x246b8275, 0x02005076,
-    0x207b8276, 0x24978277, 0x02003c78, 0x24238278, 0x0200e078, 0x20178279,
-    0x205f8279, 0x20bf8279, 0x2463827a, 0x0200a47a, 0x2423827a, 0x02000c7b,
-    0x204f827b, 0x2057827b, 0x2067827b, 0x200f827c, 0x20a7827c, 0x2037827c,
-    0x20fb827c, 0x245b827d, 0x0200587d, 0x2437827d, 0x0200547e, 0x2043827e,
-    0x20ab827f, 0x28a38280, 0x02001081, 0x0200bc81, 0x20838282, 0x214f8282,
-    0x0b82c482, 0x83209782, 0x84204b82, 0x842dfb82, 0x84020084, 0x850200f8,
-    0x860200c0, 0x2803821c, 0x8702009c, 0x880200b0, 0x82038218, 0x008925fb,
-    0x34890200, 0x90240382, 0x088a0200, 0x43820382, 0x00248b24, 0x1f828c02,
-    0x37828c20, 0x0f828d20, 0xb7828e20, 0x6f828f20, 0x007c9024, 0x07829102,
-    0x006c9224, 0x5b829302, 0x00ec932d, 0x00a89402, 0x00609502, 0x822c9602,
-    0x250f8203, 0x0200d097, 0x03827898, 0x0200f423, 0x20978299, 0x20c3829a,
-    0x205b829b, 0x205b829c, 0x2093829c, 0x2023829c, 0x2093829d, 0x20d7829d,
-    0x200f829e, 0x246b829f, 0x0200d89f, 0x21c782a0, 0x078270a0, 0x03829820,
-    0x0200b423, 0x205f82a1, 0x205782a1, 0x203f82a1, 0x204782a2, 0x20eb82a3,
-    0x244782a3, 0x0200e8a3, 0x248382a4, 0x020044a5, 0x292782a5, 0x020028a6,
-    0x0200c8a6, 0x038240a7, 0x0200d424, 0x038268a8, 0x0200ac27, 0x020048a9,
-    0x254382aa, 0x020094aa, 0x038204ab, 0xac20ff82, 0xac203382, 0xad24f382,
-    0xad020014, 0xad24d382, 0xae0200c4, 0xae205782, 0xae251382, 0xaf0200b0,
-    0x82038234, 0x82b02093, 0xb8b0241f, 0x82b10200, 0x82b12023, 0x82b2209b,
-    0x82b22047, 0xdcb224f3, 0x82b30200, 0x9cb3212f, 0xbf820782, 0x0074b424,
-    0x1f82b402, 0x00a4b525, 0x8258b602, 0x00cc2303, 0xfb82b702, 0x5782b720,
-    0x4b82b820, 0x9782b820, 0x0030b924, 0x1f82b902, 0x2f82b920, 0x5382ba20,
-    0x002cbb24, 0xc782bb02, 0x0f82bb20, 0x00d0bc24, 0x2782bd02, 0xb782bd20,
-    0x8382be20, 0x5f82be20, 0x0f82bf20, 0x0088bf24, 0x2782c002, 0x1782c020,
-    0xeb82c120, 0x9382c120, 0xbb82c220, 0xfb82c220, 0x0782c320, 0x00a8c324,
-    0x2382c402, 0x001cc529, 0x00a0c502, 0x8208c602, 0x82702003, 0x00e02303,
-    0xa782c702, 0x9f82c720, 0x7b82c720, 0xfb82c820, 0x00f8c824, 0x4382c902,
-    0x2382ca20, 0x1f82ca20, 0x7b82cb20, 0xdf82cc20, 0x9382cc20, 0x0010cd24,
-    0xaf82cd02, 0x0b83cd20, 0xce258b82, 0xcf020068, 0x82038200, 0x82d02063,
-    0x82d020f3, 0x50d1244b, 0x82d10200, 0x82d1204f, 0x18d2249b, 0x82d20200,
-    0x82d2200f, 0xb8d3240b, 0x82d40200, 0xb4d424ab, 0x82d50200, 0x82d6206b,
-    0x98d624ff, 0x82d60200, 0x82d620fb, 0x82d720db, 0x82d7209b, 0x84d72413,
-    0x82d70200, 0x82d8202b, 0x48d9240b, 0x82d90200, 0x82da200f, 0x0cdb240b,
-    0x82dc0200, 0x7cdc2423, 0x82dd0200, 0x82de209f, 0x82de20ef, 0x82df203f,
-    0x38e025f3, 0x40e10200, 0x8c230382, 0x82e20200, 0x82e2209f, 0xcce2247f,
-    0x82e30200, 0x82e3209b, 0xf4e3242f, 0x82e40200, 0x82e52017, 0x74e525d3,
-    0x04e60200, 0x57820382, 0x0028e724, 0x3f82e702, 0xbb82e820, 0x1782e820,
-    0x00bce825, 0x8254e902, 0x20f78203, 0x201b82ea, 0x201382ea, 0x208b82ea,
-    0x24ff82eb, 0x020060eb, 0x25bb82eb, 0x020010ec, 0x038270ec, 0xed202b82,
-    0xed207382, 0xed208382, 0xee20bf82, 0xee28a382, 0xee0200ac, 0xef0200fc,
-    0xf0241f82, 0xf0020030, 0xf1208782, 0xf1203782, 0xf2248b82, 0xf2020044,
-    0xf2204b82, 0xf3208b82, 0xf3243782, 0xf30200a4, 0xf4243782, 0xf4020034,
-    0xf4249b82, 0xf50200c4, 0xf5210b82, 0x82078280, 0x82f62017, 0xc0f62407,
-    0x82f70200, 0x94f72487, 0x82f80200, 0x82f820b3, 0x82f8204b, 0x50f9255f,
-    0xa8f90200, 0x4b820382, 0x00e8fa25, 0x826cfb02, 0x203f8203, 0x201782fc,
-    0x208f82fc, 0x246782fc, 0x020024fd, 0x240b82fd, 0x0200c8fd, 0x206f82fe,
-    0x244b82fe, 0x020048ff, 0x28f782ff, 0x0300f0ff, 0x0300c000, 0x24078201,
-    0x03008402, 0x2d078202, 0x03006003, 0x0300c403, 0x0300ac04, 0x03821c05,
-    0x06250b82, 0x06030018, 0x20038254, 0x24038294, 0x070300dc, 0x2003825c,
-    0x280382e0, 0x080300fc, 0x0903008c, 0x24038230, 0x0a0300a0, 0x8203823c,
-    0x480b2417, 0x820b0300, 0x820c202b, 0xa80c2537, 0x380d0300, 0x78200382,
-    0xe4230382, 0x820e0300, 0xf80e250b, 0x900f0300, 0x6f820382, 0x00201028,
-    0x00d81003, 0x3f821103, 0x3b821120, 0x00581224, 0x73821203, 0x004c1324,
-    0x5b821303, 0x2b821320, 0x00241428, 0x009c1403, 0x77821503, 0x00d01525,
-    0x822c1603, 0x292b8203, 0x03002817, 0x0300bc17, 0x03821418, 0x03008024,
-    0x03820419, 0x19207b82, 0x19247b82, 0x1a0300d4, 0x1a200f82, 0x1a202b82,
-    0x1a24bb82, 0x1b0300b0, 0x1b21cf82, 0x82078268, 0x821c2043, 0x821c20ab,
-    0x821d2053, 0x821d201f, 0x821d20fb, 0x821e2083, 0x821e200b, 0x821e2047,
-    0x821f203b, 0xac1f24bb, 0x82200300, 0x822020af, 0x44212463, 0x82210300,
-    0x0822242f, 0x82220300, 0xdc22255f, 0x60230300, 0xf4230382, 0x82240300,
-    0xc024255f, 0x64250300, 0xc7820382, 0x67822620, 0x00982628, 0x00cc2603,
-    0x3f822703, 0x82b82721, 0x00ec2407, 0x82302803, 0x20338203, 0x20f38229,
-    0x24638229, 0x0300502a, 0x255b822a, 0x0300f02a, 0x0382402b, 0x0300e823,
-    0x20e3822c, 0x2007822c, 0x2087822d, 0x30bf822e, 0x0300902e, 0x0300fc2e,
-    0x0300a42f, 0x03007430, 0x20f38231, 0x20138231, 0x241b8232, 0x03008832,
-    0x20cb8232, 0x209b8233, 0x289b8233, 0x03008c34, 0x0300e034, 0x20578235,
-    0x205f8235, 0x25278236, 0x03001437, 0x03827c37, 0x38207f82, 0x3820df82,
-    0x38204382, 0x3920ab82, 0x3920c782, 0x39202782, 0x3920a782, 0x3a205f82,
-    0x3a29b382, 0x3a03004c, 0x3b0300b0, 0x82038248, 0x823b20fb, 0x823c2097,
-    0x823c2023, 0x823e204b, 0x823f207f, 0x583f2423, 0x823f0300, 0x823f20ff,
-    0x82402067, 0x82412013, 0x82422013, 0x82422057, 0x0c43286b, 0x84430300,
-    0x82440300, 0x8244209b, 0x824420e7, 0x8244208f, 0x8245203b, 0x8245202f,
-    0x8246207f, 0x824620e3, 0x824720a7, 0x6447281f, 0xb8470300, 0x82480300,
-    0x8248209f, 0x8249204b, 0x824a20a3, 0x824a20c7, 0x824b20cf, 0x004c241b,
-    0x824c0300, 0x824c208f, 0x824c2063, 0x824d209f, 0x824d2063, 0x824e2053,
-    0x824e2063, 0xcc4e256b, 0x244f0300, 0x33820382, 0x0f824f20, 0x5f824f20,
-    0x00105025, 0x825c5003, 0x82b42003, 0x24778203, 0x03002051, 0x20578251,
-    0x24738251, 0x0300e851, 0x202b8252, 0x20738252, 0x204b8253, 0x29ff8254,
-    0x03006854, 0x0300c854, 0x03822855, 0x5620ab82, 0x5720cb82, 0x57200b82,
-    0x58284b82, 0x58030070, 0x590300dc, 0x59205382, 0x5a201b82, 0x5a202f82,
-    0x5a249782, 0x5b0300c4, 0x5b243782, 0x5c0300f8, 0x5d205b82, 0x5d201782,
-    0x5e20df82, 0x5e201b82, 0x5f25c782, 0x5f030040, 0x82038284, 0x8260207f,
-    0x826020db, 0x826020b3, 0x8260201f, 0x826120c3, 0xb061240b, 0x82620300,
-    0x78622153, 0xa7820782, 0x33826220, 0x73826320, 0x1b826320, 0x00986324,
-    0xb3826403, 0xf7826420, 0x63826420, 0xb7826420, 0x67826420, 0x0f826520,
-    0x00546624, 0x87826603, 0x00f46625, 0x82306703, 0x207b8203, 0x257b8268,
-    0x03000469, 0x0382ac69, 0x6a202782, 0x6a251382, 0x6b0300a4, 0x8203825c,
-    0x586c24ef, 0x826c0300, 0x826d20c3, 0x826e208f, 0xc06e24db, 0x826f0300,
-    0x826f2013, 0x827020df, 0x82702013, 0x82712007, 0x3c72243b, 0x82720300,
-    0x8272203b, 0x8273201f, 0x8873295b, 0xd8730300, 0xa0740300, 0xcc230382,
-    0x82750300, 0x82752033, 0x827620bf, 0x827720fb, 0x8277200b, 0x007824db,
-    0x82780300, 0x8279200f, 0x82792097, 0x827a202b, 0x827a20bf, 0x827a203f,
-    0x827b2087, 0x827b2043, 0x827b20bf, 0x827b203f, 0x827c202b, 0x827c20a7,
-    0x707c2863, 0xf07c0300, 0x827d0300, 0xe47d241b, 0x827e0300, 0x747f24ef,
-    0x82800300, 0xc880299b, 0x68810300, 0x18820300, 0xd0230382, 0x82830300,
-    0x8283200b, 0x8284207b, 0x82842057, 0x82852033, 0x82862093, 0x82862027,
-    0x408724df, 0x82870300, 0x48882457, 0x82880300, 0x82892073, 0x8289206f,
-    0x208a2577, 0x288b0300, 0xe0230382, 0x828c0300, 0x248d251b, 0x948d0300,
-    0x5b820382, 0x00788e24, 0xeb828e03, 0x00f48e24, 0x23828f03, 0x8b828f20,
-    0x00109024, 0x1f829003, 0xbf829020, 0x006c9124, 0x17829203, 0x0f829220,
-    0x00149329, 0x00909303, 0x82549403, 0x24338203, 0x03008095, 0x20938295,
-    0x208b8296, 0x20f78297, 0x202f8297, 0x25738298, 0x0300b498, 0x03823899,
-    0x9a20c782, 0x9b200382, 0x9b209f82, 0x9c25cf82, 0x9d03009c, 0x8203825c,
-    0x589e2927, 0xbc9e0300, 0x509f0300, 0xc4230382, 0x82a00300, 0xa8a02597,
-    0x08a10300, 0x88230382, 0x82a20300, 0x0ca324e7, 0x82a30300, 0x64a424eb,
-    0x82a40300, 0x82a620eb, 0x98a62963, 0xeca60300, 0x4ca70300, 0xdc230382,
-    0x82a80300, 0xe8a8244f, 0x82a90300, 0x82a92007, 0x82aa202b, 0x82ab2027,
-    0x82ab208f, 0x82ac2097, 0xd4ac255b, 0x40ad0300, 0x93820382, 0x0004ae24,
-    0xbf82ae03, 0x7b82af20, 0x0b82b020, 0x003cb124, 0x9382b103, 0x0024b228,
-    0x00c8b203, 0xd782b303, 0x0782b320, 0xbb82b420, 0xef82b420, 0x6782b420,
-    0xab82b520, 0x006cb628, 0x00a0b603, 0x9b82b703, 0x8278b721, 0x20a78207,
-    0x20cf82b8, 0x207782b8, 0x20a782b9, 0x200782b9, 0x200782ba, 0x200782ba,
-    0x200782bb, 0x200782bb, 0x200782bc, 0x200782bc, 0x200782bd, 0x2c9382bd,
-    0x030070be, 0x0300f8be, 0x03005cbf, 0x204782c0, 0x206782c0, 0x20a782c1,
-    0x206382c1, 0x249f82c2, 0x030080c2, 0x24bf82c2, 0x030018c3, 0x245f82c3,
-    0x03002cc4, 0x251382c4, 0x0300b8c4, 0x038210c5, 0xc5200b82, 0xc6208b82,
-    0xc7244782, 0xc703001c, 0x2f820783, 0x00c0c824, 0xcb82c903, 0xd382c920,
-    0x00acc924, 0x3f82ca03, 0x0098ca24, 0x0782cb03, 0x0782cb20, 0x2782cc20,
-    0x1782cc20, 0x0f82cd20, 0x8b82ce20, 0x0028cf24, 0x4b82cf03, 0x00d4cf24,
-    0x6382d003, 0x00b4d024, 0x5f82d103, 0x0782d120, 0x0024d225, 0x82b0d203,
-    0x20b78203, 0x209b82d3, 0x20af82d3, 0x245f82d4, 0x030014d5, 0x200b82d5,
-    0x20a782d6, 0x20ff82d6, 0x200f82d7, 0x252382d7, 0x0300a4d8, 0x03820cd9,
-    0x0300d028, 0x030094da, 0x038200db, 0x03825020, 0x0382a020, 0x0300e423,
-    0x206b82dc, 0x244f82dc, 0x0300bcdd, 0x25ab82de, 0x030048df, 0x038290df,
-    0xe0250b82, 0xe0030020, 0x82038288, 0x82e120ff, 0x82e12087, 0xfce1247f,
-    0x82e20300, 0x82e22077, 0x82e3205b, 0xf4e3291b, 0x74e40300, 0x08e50300,
-    0xfb820382, 0x7f82e620, 0x8f82e620, 0x00f0e624, 0x2f82e703, 0x003ce824,
-    0x0383e903, 0xe9290b82, 0xea0300e0, 0xeb030084, 0x8203821c, 0x4cec240f,
-    0x82ec0300, 0x82ed2067, 0x82ed201f, 0x82ee203b, 0x82ef208b, 0x82f020b7,
-    0x82f020a3, 0x68f1243f, 0x82f20300, 0x82f2206b, 0x38f3241b, 0x82f30300,
-    0x82f320d7, 0x82f420ab, 0xacf4253f, 0x5cf50300, 0x87820382, 0x1782f620,
-    0x3382f720, 0x0044f725, 0x8218f803, 0x00982403, 0x8230f903, 0x00c82703,
-    0x0058fa03, 0x4782fb03, 0x0b82fb20, 0x0054fc28, 0x00d0fc03, 0xb782fd03,
-    0x0782fd20, 0x1b82fe20, 0x7f82fe20, 0x7f82ff20, 0x00c4ff25, 0x82680004,
-    0x00f02403, 0x82700104, 0x00dc2403, 0x82440204, 0x00982403, 0x82080304,
-    0x00882403, 0x821c0404, 0x825c2003, 0x00bc2403, 0x82180504, 0x82742003,
-    0x00d42303, 0x1f820604, 0x82340621, 0x00c82707, 0x00600704, 0x27820804,
-    0x00b00824, 0x3f820904, 0x2b820920, 0x00480a2d, 0x00d80a04, 0x00580b04,
-    0x822c0c04, 0x00b42303, 0x63820d04, 0x00b80d24, 0x4f820e04, 0x6b820e20,
-    0x2b820f20, 0x00fc0f25, 0x826c1004, 0x00ec2803, 0x00781104, 0x82941204,
-    0x250b8203, 0x0400ac13, 0x03823014, 0x04008423, 0x25a78215, 0x04000c16,
-    0x03824c16, 0x03827c20, 0x0400d024, 0x03826417, 0x0400cc23, 0x24838218,
-    0x04009c18, 0x208f8219, 0x24b78219, 0x0400001a, 0x2047821a, 0x203f821a,
-    0x2407821b, 0x0400501c, 0x203f821c, 0x209f821d, 0x201f821d, 0x2407821e,
-    0x0400381e, 0x2057821e, 0x2983821e, 0x04003c1f, 0x0400a41f, 0x03820820,
-    0x21241382, 0x220400f8, 0x2220a782, 0x2320d782, 0x25201b82, 0x26290782,
-    0x26040080, 0x270400f0, 0x23038220, 0x2804008c, 0x28212b82, 0x820782a8,
-    0x68292813, 0xe4290400, 0x822a0400, 0x942a25cb, 0x242b0400, 0x2f820382,
-    0xab822c20, 0x17822c20, 0x07822d20, 0x2b822d20, 0x57822d20, 0x67822e20,
-    0x1f822f20, 0x77822f20, 0x93823020, 0x00403124, 0x53823204, 0x82c03221,
-    0x202b8207, 0x251b8233, 0x04004833, 0x03828833, 0x3325bf82, 0x340400ec,
-    0x82038204, 0x6c3421af, 0xb0200782, 0xd4230382, 0x82350400, 0x82352073,
-    0x30362497, 0x82360400, 0x8236208f, 0xe836245f, 0x82370400, 0xd0372423,
-    0x82380400, 0x8239205b, 0xcc392477, 0x823a0400, 0xfc3a2497, 0x823b0400,
-    0x823c201b, 0x823c206f, 0x983d25b3, 0x143e0400, 0x5c200382, 0x8b820382,
-    0x00643f24, 0x33823f04, 0x00a04028, 0x00284104, 0xdf824204, 0x82784221,
-    0x207f8207, 0x243f8243, 0x04009c43, 0x20578243, 0x20338244, 0x202b8244,
-    0x24878244, 0x04001845, 0x28b78245, 0x04001046, 0x04007c46, 0x20a38247,
-    0x208b8247, 0x20e78247, 0x201f8248, 0x20578248, 0x24cf8249, 0x0400b449,
-    0x2037824a, 0x202b824a, 0x24cb824b, 0x0400704b, 0x2013824b, 0x2937824c,
-    0x0400544c, 0x0400a44c, 0x0382584d, 0x4e202f82, 0x4e209782, 0x4f20b382,
-    0x4f201b82, 0x4f241b82, 0x4f040080, 0x5024af82, 0x50040034, 0x51208f82,
-    0x51204f82, 0x52243b82, 0x52040040, 0x53202782, 0x53243782, 0x540400e4,
-    0x54205382, 0x5524e382, 0x56040088, 0x56206b82, 0x57247f82, 0x57040030,
-    0x58200782, 0x59204382, 0x5a206382, 0x5a203382, 0x5b200f82, 0x5b20cf82,
-    0x5c206b82, 0x5d240f82, 0x5d040048, 0x5d249782, 0x5e0400e8, 0x5e242f82,
-    0x5f040090, 0x60206b82, 0x6020a782, 0x61244b82, 0x6104002c, 0x62243382,
-    0x6204000c, 0x62202b82, 0x63202782, 0x63244f82, 0x640400f4, 0x65202b82,
-    0x65203382, 0x66204b82, 0x66251b82, 0x670400d4, 0x20038228, 0x8203828c,
-    0x82682093, 0x826920af, 0x82692037, 0x826a201f, 0x826b2063, 0x4c6b241b,
-    0x826b0400, 0x826b203f, 0x826c20ab, 0x826c2027, 0x946d2407, 0x826e0400,
-    0x746e213f, 0x6b820782, 0x00086f28, 0x00ac6f04, 0x9f827004, 0x00a87024,
-    0x37827104, 0x00e07124, 0x93827204, 0x82387221, 0x20cb8207, 0x20478273,
-    0x25538273, 0x04001874, 0x03828474, 0x75244782, 0x7604009c, 0x76241782,
-    0x770400cc, 0x77219782, 0x82078260, 0x82782037, 0x8279206f, 0x7c792587,
-    0xbc790400, 0x2b820382, 0x00247a25, 0x82587a04, 0x20c78203, 0x20e3827b,
-    0x288b827b, 0x0400507c, 0x0400ec7c, 0x2cf7827d, 0x0400207e, 0x0400b87e,
-    0x04005c7f, 0x20638280, 0x20438280, 0x24df8280, 0x04005481, 0x20678281,
-    0x205f8282, 0x247f8282, 0x04001c84, 0x20eb8284, 0x246b8285, 0x0400d885,
-    0x207f8286, 0x20738286, 0x205b8287, 0x20538287, 0x20cf8287, 0x20538287,
-    0x25478288, 0x0400dc88, 0x03827889, 0x8a240f82, 0x8a040070, 0x8b201b82,
-    0x8c208f82, 0x8c24ef82, 0x8d040064, 0x8e20f382, 0x22081782, 0x0600d88e,
-    0xeaff0000, 0x9601d601, 0x1f001300, 0x27002300, 0x2f002b00, 0x33130000,
-    0x33353315, 0x82152315, 0x23352803, 0x33352315, 0x83212335, 0x82108208,
-    0x25352118, 0x21201e82, 0x01200382, 0x2b250786, 0x2a80aa80, 0x2e04842a,
-    0x2baa2a01, 0xfe2baa2b, 0x00012bd5, 0x83aafe2b, 0x95012105, 0x80201b86,
-    0x2b231a84, 0x822b56aa, 0x82218200, 0x00002305, 0x03820500, 0x83820020,
-    0x0b005726, 0x21001700, 0x34208182, 0x0e378182, 0x17161401, 0x34012e37,
-    0x07253736, 0x0614011e, 0x013e1707, 0x85052634, 0x34262617, 0x1607013f,
-    0x20138514, 0x2f138307, 0x26343632, 0x21211d69, 0x1a171e1d, 0x1001171a,
-    0x1e200684, 0xfe291082, 0x141412f2, 0x18181e12, 0x20038296, 0x340b821e,
-    0x1818126c, 0x01181824, 0x584e1d57, 0x181e1d4e, 0x183d483d, 0x8306861e,
-    0x11202812, 0x112e362e, 0x8348181e, 0x83048215, 0x011e210e, 0x24213283,
-    0x20aa8318, 0x06334106, 0xaf8a8220, 0xb1ae4c20, 0x14062223, 0x37b18316,
-    0x22231507, 0x15231506, 0x3b161433, 0x35363201, 0x34233533, 0x35012b26,
-    0x2728c9ac, 0x950c0916, 0x56090c95, 0x162e0685, 0x4d1d8101, 0x1e1d4d59,
-    0x3e473e17, 0x06861e17, 0x1f291283, 0x2e352f11, 0x49181e12, 0x82ef8218,
-    0x2e123104, 0x181f2f35, 0x24191924, 0x0c558018, 0x0c092b09, 0x55240484,
-    0x00020000, 0x31080082, 0x6b01ab01, 0x11000800, 0x1e010000, 0x22061401,
-    0x17363426, 0x1517011e, 0x013e3521, 0x30240001, 0x30304830, 0x02604924,
-    0x6002aafe, 0x30016b01, 0x02823049, 0x3001d52a, 0x242b2b24, 0x04000030,
-    0x00224282, 0x4386d601, 0x19001525, 0x90130000, 0x35252447, 0x82071533,
-    0x25d52103, 0x4e853c83, 0x6101ab27, 0x2a2a1e01, 0x2553902a, 0x556b6b2c,
-    0x56832a2a, 0x5b840320, 0x8001c02f, 0x10000700, 0x00002000, 0x32013e37,
-    0x229a8216, 0x83010e37, 0x16323ea7, 0x16141127, 0x36322133, 0x26341135,
-    0x06222123, 0x48580480, 0x00ff0458, 0x362401c0, 0x34028224, 0x011219ff,
-    0x1919122a, 0x13d6fe12, 0x22205518, 0xc0152022, 0x2318831b, 0xd6fe3a24,
-    0x1d841783, 0x00820020, 0x6b880420, 0x1300032d, 0x24001b00, 0x21250000,
-    0x82352111, 0x8a152054, 0x2e033664, 0x07062201, 0x32273315, 0x22263436,
-    0x01161406, 0x01d6fe95, 0x314c8a2a, 0x36420347, 0x60c00342, 0x281b1b14,
-    0x012b1b1b, 0x7d832b2a, 0x13246b85, 0x18e5fe18, 0x10240082, 0x1b291b66,
-    0x73820282, 0xd02de385, 0x08005601, 0x17001100, 0x32130000, 0x0e854116,
-    0x37273730, 0xc0173717, 0x402a2a20, 0x40202a2a, 0x71820154, 0x3beb5438,
-    0x194c2219, 0x3f2b5501, 0x2b3f2a2a, 0x202a01ba, 0x2a202525, 0x15824018,
-    0x3b411e20, 0x06f34306, 0x13000a24, 0xcd821f00, 0x27012e2a, 0x1632013e,
-    0x03010e17, 0x37386287, 0x1e07010e, 0x013e1701, 0x01012e37, 0x15432800,
-    0x58485804, 0x28431504, 0x26052341, 0x02785b1b, 0x835b7802, 0x26792f05,
-    0x201f2501, 0x1f202222, 0x242e0125, 0x02822437, 0x1a864020, 0x002c2083,
-    0x00000400, 0xff01c0ff, 0x0900c001, 0x82073f41, 0x820720b4, 0x1e332674,
-    0x27071301, 0x20678237, 0x41658223, 0xa02a0fc1, 0x670e511d, 0x07200b8d,
-    0x0988f543, 0x41ebfe21, 0x0b2a0ec6, 0x0201511d, 0x5f3d6584, 0x09877c01,
-    0x41e4fe21, 0x7f840bcd, 0x02000036, 0x006b0100, 0x001a0011, 0x002c0023,
-    0x23153700, 0x23352315, 0x2e24e382, 0x33363401, 0x0b82fa82, 0x20059143,
-    0x220c8205, 0x84352115, 0x36342cf8, 0x06141632, 0x2f2a16eb, 0x82152007,
-    0x1b2208f8, 0x3c072015, 0x120c0c09, 0x0c010c0c, 0xfe057630, 0x307505ab,
-    0x49303024, 0x2beb3030, 0x17132b2b, 0xfd820101, 0x01131722, 0x12232183,
-    0x822a550c, 0x2a2b2214, 0x0619432b, 0x28077b41, 0x01c001d5, 0x00070096,
-    0x218b8210, 0x6a832500, 0x27207282, 0x20071943, 0x06564237, 0x1733172e,
-    0x013e3337, 0x26341135, 0x00ff8001, 0x8036f684, 0x32202019, 0xfeae2020,
-    0x191813d6, 0x40405512, 0x19191255, 0xee83136b, 0x2001d13a, 0x31212131,
-    0x12184720, 0x1812d5fe, 0x01404001, 0x2b011218, 0x00001812, 0x20054742,
-    0x2aff82eb, 0x000c0008, 0x25000015, 0x82070622, 0x012e28e2, 0x35331525,
-    0x42013e17, 0x402b06ae, 0x01067530, 0xfe750656, 0x4380aba5, 0x952005dc,
-    0x5620c085, 0xc38ac682, 0xc8830420, 0x01eb012b, 0x000a0056, 0x001c0013,
-    0x23518325, 0x17011e07, 0x2e224d82, 0x5c872301, 0x58872720, 0x55396189,
-    0x16130b09, 0x67058001, 0x05672ad4, 0x66052b01, 0x24241b2a, 0xc6242437,
-    0x2a06841c, 0x240e01ab, 0x25353518, 0x83252626, 0x012a2105, 0x37221b83,
-    0x07860124, 0x07207683, 0x08207b88, 0x2706cd41, 0x0037002e, 0x01000046,
-    0x87081b43, 0x90272076, 0x23052311, 0x95822635, 0xaa823320, 0x35230725,
-    0x8237013e, 0x82372008, 0x21b48aae, 0x1c466001, 0x43122005, 0xa0200552,
-    0x012f0d8c, 0x0a01a04b, 0x2911210e, 0xd6c00240, 0x82294002, 0x14552f07,
-    0x34181834, 0x055f2714, 0x5f05d601, 0x4c453501, 0x01752805, 0x2b2b3f2a,
-    0x8d742a3f, 0x1a76290e, 0x07050b0f, 0x1a0a1a02, 0x02200282, 0x46210782,
-    0x2500820b, 0x3a3a2323, 0xd7822323, 0x03820520, 0x0002002e, 0x08005601,
-    0x19001000, 0x31002500, 0x210aab41, 0x5f411617, 0x0d564105, 0x07222328,
-    0x16071416, 0x9c472327, 0x15012f09, 0x01045824, 0x6a580400, 0x0240011c,
-    0x5b41b039, 0x1b862d05, 0x0a1b2424, 0x0a13130a, 0x402b40cb, 0xab2e0282,
-    0x2b2b2020, 0x17042020, 0x182b2b25, 0x6b41331f, 0x1a03250b, 0x16041a45,
-    0x40202483, 0x23489285, 0x001f2207, 0x35918228, 0x16323315, 0x23153315,
-    0x012b0614, 0x23352622, 0x36343335, 0x0782013b, 0x4405c043, 0x01210842,
-    0x0e974615, 0x54018026, 0x95015480, 0x21055a41, 0x70462b6b, 0x202b2809,
-    0x1f2b2b1f, 0x442a0120, 0x748205b2, 0x00000337, 0xab01d5ff, 0x09006b01,
-    0x1a001500, 0x1e010000, 0x06141701, 0x22fd8207, 0x8207021f, 0x3e3f08ee,
-    0x37273701, 0x1e271501, 0x24000101, 0x1e270130, 0x262e0664, 0x401b2580,
-    0x374601fb, 0x55011b98, 0x01382f68, 0x2530016b, 0x64072d20, 0x80d5261f,
-    0x2b401c24, 0x98082c1e, 0x19fbfe1b, 0x45290b68, 0xe34608d7, 0x001a2207,
-    0x0a6d4123, 0x52482720, 0x46072007, 0x372007f0, 0x21074e42, 0x27430001,
-    0x43302006, 0x24360524, 0xfe024e32, 0x324e02fc, 0x26191913, 0x2bab1919,
-    0x2b40402b, 0x3043c02b, 0x01e82906, 0x17170c20, 0x1ac1200c, 0x26201b82,
-    0x8f43c882, 0x0014220d, 0x41758b1d, 0x974309c5, 0x83f02012, 0x43402058,
-    0x6b820e9a, 0x62440282, 0x0beb4308, 0x5b841120, 0x2d10ce44, 0x07173727,
-    0x07270717, 0x37273727, 0xcb824001, 0x06aafe23, 0x23cb8675, 0x2d1e2df9,
-    0x2e240282, 0x1e2e2e1e, 0x8706fc43, 0x8232205a, 0x321d8714, 0x00040000,
-    0x01cdff00, 0x006b01de, 0x0017000e, 0x822d0024, 0x011e23c5, 0x59830617,
-    0x2e230626, 0x17363401, 0x2007e248, 0x22178427, 0x83010f06, 0x03430815,
-    0x37013e35, 0x17161506, 0x36294b01, 0x420e0101, 0x1c16431e, 0x29363629,
-    0x2d1e1e17, 0x258c1e1e, 0x11010130, 0x2414141c, 0x01863030, 0x010b455a,
-    0x3601c014, 0x42161d29, 0x010f421e, 0x2a365236, 0x821e2e1e, 0x01d63602,
-    0x171d2530, 0x0102150a, 0xfe304930, 0x2f232bab, 0x2a1c1903, 0x0d5b4121,
-    0x1b001122, 0x440b5b41, 0x07290717, 0x2f372717, 0x17010f01, 0x21fd8407,
-    0xfd885601, 0x0e34b129, 0x18173e2f, 0x8e0f2f3e, 0x201c2afb, 0x3905283c,
-    0x3c280539, 0x089b4200, 0xab01eb2d, 0x26001d00, 0x00003200, 0x82333613,
-    0x010e2be3, 0x27012e07, 0x17163734, 0x39471506, 0x22272407, 0x44072607,
-    0x24880887, 0xad013e2a, 0x84642d26, 0x64840303, 0x10290582, 0x020a1411,
-    0x6c52526c, 0x23058202, 0x54071c20, 0x26057444, 0x013d2da9, 0x842d3d01,
-    0x9b012205, 0x822b8510, 0x282c2505, 0x201c0711, 0x05822d85, 0x0a150a22,
-    0x20059a4a, 0x822c8756, 0x05002632, 0xd0ff0000, 0x34a38301, 0x00120009,
-    0x0024001b, 0x0100002e, 0x15171632, 0x012e3523, 0x2409842f, 0x013e3521,
-    0x052c4937, 0x33061422, 0x073b0887, 0x17353315, 0x15233507, 0x2a550127,
-    0x01800567, 0x2a961316, 0xd5fe0566, 0x442a6705, 0x8f20054a, 0x2f05b445,
-    0x454580b1, 0x00014580, 0x35352625, 0x010d2518, 0x26220783, 0xb3452b25,
-    0x2a058505, 0x463030d0, 0x45303045, 0x4c030000, 0x0b240867, 0x20001700,
-    0x5f488b82, 0x2e03230a, 0x8d452701, 0x010e2205, 0x07bf4927, 0x48000121,
-    0x78270962, 0x0261485b, 0x84486102, 0x49082005, 0x012106c0, 0x0a654895,
-    0x8782fe21, 0x2024821e, 0x05a348a9, 0x00820020, 0x77820520, 0x01c02b08,
-    0x00ce01c0, 0x0039002b, 0x0041003d, 0x1300004f, 0x32171636, 0x27013e17,
-    0x16173626, 0x07140706, 0x3637011e, 0x26060716, 0x7e822627, 0x18821282,
-    0x37343724, 0x1282012e, 0x1e331336, 0x23011d01, 0x23152335, 0x17363435,
-    0x37353315, 0x37230733, 0x3b061b4d, 0x35272622, 0x268d013e, 0x0c0e0b43,
-    0x05030b09, 0x351c263a, 0x190a0739, 0x2d1b250f, 0x0b2f1493, 0x2b19122a,
-    0x12192b2a, 0x3f2c7f2a, 0x8240ab2c, 0x18122c00, 0x01180101, 0x39341bb2,
-    0x831a0907, 0x42272137, 0x04224c85, 0x14822739, 0x07012408, 0x250e1a0a,
-    0x43272d1c, 0x080d0e0a, 0x3905020b, 0x1801e0fe, 0x2b2b8012, 0x2a181280,
-    0xab2b2b2b, 0x82552bab, 0x12552250, 0x21ee8218, 0xef820400, 0xab01d53d,
-    0x0900ab01, 0x2b002000, 0x00003600, 0x3d012e17, 0x14153301, 0x32030706,
-    0x83011e17, 0x06b94508, 0x82012e21, 0x363734d2, 0x07010e17, 0x2634013e,
-    0x05011e27, 0x0e37013e, 0x82161401, 0x12eb2c33, 0x12198019, 0x13151715,
-    0x820a0b16, 0x191232b0, 0x13160b0a, 0x3401c215, 0x12120f2c, 0xfe342c0f,
-    0x200a88ab, 0x2191822b, 0xc9832b2b, 0x06d62808, 0x2435561a, 0x19122948,
-    0x48291219, 0x1a563524, 0x76369606, 0x5d611f18, 0x3e141e4e, 0x143e3333,
-    0x615d4e1e, 0x8276181f, 0x820120ac, 0x01ea35ab, 0x009601c0, 0x25000014,
-    0x34352735, 0x07062226, 0x37150715, 0x17200383, 0x22081082, 0x12abc001,
-    0xaa01121b, 0x4b4a2aaa, 0x6b2a6b2b, 0x12120e75, 0x2a6b750e, 0x20207535,
-    0x20201515, 0x84020075, 0x82c42043, 0x000f2643, 0x1300001a, 0x3b3d8a17,
-    0x17013717, 0x22012e35, 0x1f011d06, 0x6a433501, 0x4b2bab7f, 0x1b7a2a4a,
-    0x01bbb0fe, 0xa6255682, 0x6b500144, 0x224b8850, 0x821b7a4f, 0x2561840f,
-    0x2a15a74e, 0x5b860000, 0x8001eb22, 0x5b820982, 0x27211724, 0xa0822113,
-    0x1e112508, 0x35013b01, 0x11211123, 0x32331523, 0x2e113736, 0x00018001,
-    0x80fec080, 0x01011812, 0x55551218, 0x55558001, 0x15360b84, 0x19150180,
-    0x1200ff12, 0x00012a18, 0x182a00ff, 0x12000112, 0x97420019, 0x01ea2e06,
-    0x009901d6, 0x0017000b, 0x0021001d, 0x07874b25, 0x011e3726, 0x03010e17,
-    0x340a1f43, 0x17152307, 0x07022f37, 0x07272517, 0x40000117, 0x54010154,
-    0x44058540, 0x02390806, 0x6520476c, 0x1b635510, 0x8f011b62, 0x15621b62,
-    0x3f405402, 0x54020254, 0x2328823f, 0x516d0254, 0x512a2985, 0x3c80546d,
-    0x20d3321a, 0x02822052, 0x05005323, 0x05db4700, 0x09829920, 0x87871120,
-    0x66823720, 0x95430382, 0x218d8b0a, 0x8885012f, 0x162ee126, 0x4a178044,
-    0xaa208d96, 0x8a218887, 0x2026832d, 0x208e97df, 0x2089870f, 0x088b5000,
-    0x03009933, 0x13000700, 0x25001f00, 0x00003600, 0x37270713, 0x23038205,
-    0x17011e07, 0x20056345, 0x4508843e, 0x072a0763, 0x07171533, 0x013e0727,
-    0x08820637, 0x16144708, 0x06171617, 0xc6012e23, 0x01591958, 0x19591827,
-    0x02604968, 0x48496002, 0x61010161, 0x02483648, 0x37364802, 0x48010148,
-    0x0e45204c, 0x2101eb57, 0x0101131c, 0x3b2a1e25, 0x60491513, 0x1d4a7b01,
-    0x4b1e4a4a, 0x31822d1d, 0x49283785, 0x49012960, 0x01493636, 0x1f340584,
-    0x281d1f61, 0x18432916, 0x13183029, 0x28103b25, 0x6101040e, 0x220ccf41,
-    0x820d0003, 0x002322b9, 0x25b98233, 0x13170727, 0x8c82010e, 0x36342723,
-    0x220c8237, 0x82371707, 0x821520c2, 0x363225b9, 0x13371737, 0x27201282,
-    0x14280c82, 0x35361707, 0x0627012e, 0x22080782, 0x1f131eab, 0x1b3113c6,
-    0x12015440, 0x1d1b4f10, 0x11181e18, 0x6c021916, 0x1a402452, 0x620d1b2f,
-    0x82ba621b, 0x2109221a, 0x08128213, 0x21272d39, 0x1e7a0118, 0xcdfe1e0f,
-    0x54021310, 0x13311b40, 0x131d1b85, 0x1911141f, 0x6c522440, 0x2f171802,
-    0x5240011b, 0x021b5320, 0x191b3f54, 0x512e2620, 0x1301026d, 0x41000920,
-    0x0b220af7, 0xf7511700, 0x01002406, 0x51231523, 0x232106e0, 0x16fd4107,
-    0xb3821720, 0x03822520, 0x2a150124, 0x02824040, 0xff411520, 0x82832016,
-    0xeefe2ca9, 0x011b621b, 0x402b4000, 0x42ab2b40, 0x23201700, 0x53239f82,
-    0x46205220, 0x08210b23, 0x05bb4800, 0x21082551, 0x8a4d012e, 0x0b874205,
-    0x4d000121, 0x09270589, 0x52363629, 0x46293636, 0xd5200a2e, 0x21057f4d,
-    0x18830175, 0x01365223, 0x0c8f4e34, 0x82000321, 0xeb013000, 0x03009601,
-    0x0a000700, 0x23250000, 0x82153335, 0x21052203, 0x2ed68203, 0xff2a2a2a,
-    0xebd60100, 0x2bab5695, 0x8495016b, 0x00210897, 0x01c00100, 0x000f0080,
-    0x00170013, 0x32211300, 0x14111516, 0x22212306, 0x34113526, 0x23351736,
-    0x21038315, 0x5050016b, 0x19122306, 0x4682bc19, 0x4f800121, 0x122809df,
-    0x8080d519, 0x002b2b56, 0x7f83e78b, 0x7f891320, 0x1520dd8c, 0x2a214082,
-    0x25d48a15, 0x2bd680ab, 0xc98c1501, 0x03249b8b, 0x14000c00, 0x07204b85,
-    0x2707cb47, 0x15072313, 0x35373317, 0x1532d583, 0x180f0f0c, 0xa0440f0f,
-    0x70a07070, 0x10dc80ab, 0x02821017, 0x82310121, 0xa070230d, 0x97820400,
-    0xeb010039, 0x02009601, 0x09000500, 0x00000d00, 0x03210301, 0x15372113,
-    0x82073533, 0x00012903, 0xebd601eb, 0x8cbefea1, 0x012b9782, 0x016bfe95,
-    0xc0ebfe40, 0x84805656, 0x823582d2, 0x83012740, 0x19002901, 0x85822600,
-    0x22230629, 0x27062327, 0x4f352606, 0x5308055e, 0x07333731, 0x3233011e,
-    0x012e2737, 0x15062223, 0x3e331614, 0x82013701, 0x0d260c0f, 0x2a382001,
-    0x1b313933, 0x36100b29, 0x0d11072d, 0x075b0508, 0x1f1b141d, 0x2013171b,
-    0x3904440a, 0x4001013e, 0x1d463730, 0x2872341b, 0x2444031d, 0x20222f27,
-    0x2324012a, 0x3b547182, 0x002b3608, 0x0010000c, 0x002d001e, 0x37000031,
-    0x15171632, 0x3d012e23, 0x267c8201, 0x3533011d, 0x87331521, 0x013b2c0f,
-    0x33152715, 0x011d1632, 0x82070614, 0x35273a23, 0x23353317, 0x01181280,
-    0x18181256, 0x2b012b12, 0x19122a2a, 0xd52a1219, 0x820f842b, 0x2b2b2718,
-    0x1218d52b, 0x1d820156, 0x20057247, 0x210a862b, 0x12845680, 0x0e820120,
-    0x2babab38, 0x00000400, 0xda01eaff, 0x2f009701, 0x4d003b00, 0x00005d00,
-    0xef820625, 0x010e2729, 0x27262227, 0x82373634, 0x363529f2, 0x2223022e,
-    0x07060706, 0x35371982, 0x3617013e, 0x011e1716, 0x16141507, 0x27071617,
-    0x07062635, 0x83331614, 0x0e172329, 0x35822301, 0x82362621, 0x3217261e,
-    0x16363736, 0x241c8237, 0x1e363726, 0x083d8201, 0x3e3726b5, 0x07540101,
-    0x070c0d07, 0x251e2a17, 0x1c21012f, 0x01193a18, 0x09120b02, 0x02041911,
-    0x05043708, 0x162a4a0c, 0x0714112f, 0x06080d01, 0x33206606, 0x19111202,
-    0x9303080f, 0x3d2d5c23, 0x04032a6b, 0x3a6b2d04, 0x07275227, 0x24050e05,
-    0x1606070d, 0x120c0930, 0x05010403, 0x0405530b, 0x170b100b, 0x2d2c0113,
-    0x0a0c2e23, 0x0b070208, 0x11071116, 0x06010912, 0x31060501, 0x0e010127,
-    0x1d32140f, 0x0a171359, 0x0c660709, 0x13231701, 0x0f190117, 0x1a1aaf1d,
-    0x0503262a, 0x011d1a02, 0x08021011, 0x02020611, 0x010e0501, 0x03112f0c,
-    0x220c0302, 0x82000100, 0x01550800, 0x002401d6, 0x3700001b, 0x013e1732,
-    0x17163237, 0x011e3736, 0x36071417, 0x14011e33, 0x2e210706, 0x69363401,
-    0x2f01080a, 0x09291a23, 0x261d2214, 0x09080201, 0x161c1c16, 0x241ac6fe,
-    0x2403d324, 0x171c012e, 0x26010119, 0x0307081d, 0x1c2b1c01, 0x36230101,
-    0x06074223, 0x2509e350, 0x0037002b, 0xf24b2500, 0x23372407, 0x87053315,
-    0x1725280c, 0x010e2315, 0x86272622, 0x82352005, 0x15212287, 0x09fa4427,
-    0x8001352d, 0x1c12120e, 0x352e1212, 0x85b6fe5f, 0x3901290a, 0x24012b40,
-    0x80012436, 0x2b300584, 0x01121801, 0x4040c02b, 0x3540402a, 0x121b1201,
-    0xbf220282, 0x09868b35, 0x6b55df26, 0x1b24241b, 0xeb280383, 0x56011812,
-    0x402b402b, 0xfd820282, 0x48080021, 0x173d08f3, 0x24001b00, 0x2c002800,
-    0x39003000, 0x00004200, 0x16323313, 0x23113315, 0x26220614, 0x28058635,
-    0x36343311, 0x35211507, 0x07434c05, 0x15013b25, 0x85333723, 0x4e072003,
-    0xe95007a3, 0x56d52908, 0x2b800c09, 0xd60c120c, 0x2b260382, 0x01610c80,
-    0x2545ff2a, 0x2b742906, 0x1515402b, 0x6b15152b, 0x2005b54e, 0x053c454f,
-    0x0c950125, 0x8280fe09, 0x8309200b, 0x82012003, 0x55402309, 0x3e451555,
-    0x822e8205, 0x30012334, 0x02823048, 0x13856c20, 0x0221c383, 0x23008200,
-    0x9601c001, 0x3533bb82, 0x22010000, 0x16140706, 0x15231517, 0x012e1533,
-    0x82353327, 0x1e352608, 0x37363201, 0x230b8415, 0x3507010e, 0x35260882,
-    0x2e35013e, 0xe6520701, 0x01200807, 0x01241b00, 0x40401417, 0x2011311e,
-    0x4e1a2b6b, 0x2b1a4e5a, 0x31101f6b, 0x1440401e, 0x1b240117, 0x20089f87,
-    0x21141c24, 0x942b2e07, 0x2a1a2005, 0x2a25246a, 0x6a24252a, 0x0521192a,
-    0x072e2b94, 0x241c1421, 0x066c532a, 0x37053f48, 0x01d601c0, 0x000300c4,
-    0x001c0007, 0x00360029, 0x01000050, 0x07333523, 0x3f350382, 0x26273601,
-    0x2226010f, 0x06262707, 0x010e011f, 0x26342115, 0x20bc8217, 0x2aac8315,
-    0x2634013d, 0x1d062221, 0x82161401, 0x25a982b9, 0x3b161417, 0x0d851501,
-    0x22863320, 0x32332d08, 0x21013d36, 0x15154001, 0x7615156b, 0x0706061c,
-    0x3e1a1f08, 0x0e07201a, 0x1c181b07, 0x521d0001, 0x0101120d, 0x12121b12,
-    0x120e88fe, 0x0c820782, 0x090c2823, 0x20098316, 0x0817832a, 0x0c091620,
-    0x550100ff, 0x27161616, 0x0608071c, 0x0d0d2006, 0x070e0620, 0x2035121c,
-    0x126b3520, 0x3582950e, 0xd523048d, 0x834b0c09, 0x854b2014, 0x090c3605,
-    0x000400d5, 0x01d5ff00, 0x00a20196, 0x00110008, 0x002c0023, 0x06f35600,
-    0x23061422, 0x2307fa45, 0x0727013f, 0x072aea83, 0x1d010e17, 0x34352101,
-    0x30490526, 0x82352005, 0x055b41bf, 0x06858920, 0x122d8f30, 0x1e481e31,
-    0x1c2d1231, 0x212a0121, 0x5c4af7fe, 0xd6fe2305, 0xf3410001, 0x3a058505,
-    0x31112d63, 0x11311010, 0x253e152d, 0x3e251616, 0x025440e3, 0x55405402,
-    0x82030000, 0x01f0318f, 0x009601b6, 0x00290021, 0x13000032, 0x1e331533,
-    0x073e7582, 0x35013e17, 0x07010e33, 0x012f011f, 0x0f272206, 0x27013f01,
-    0x37363435, 0x32160733, 0x11822737, 0xe1473720, 0xeb240807, 0x120e0b2a,
-    0x14122309, 0x1b1f012b, 0x41280243, 0x41235223, 0x097c0228, 0x220b0e12,
-    0x201a3a1a, 0x170a1a0a, 0x2408af85, 0x012a9501, 0x094b0d12, 0x1b2e123d,
-    0x74184227, 0x11711a2f, 0x2f1a7111, 0x0d4b09d7, 0x0cca0112, 0x0909360c,
-    0x20b38569, 0x06c34b00, 0x9b84ad20, 0x00002c32, 0x22010e25, 0x07062226,
-    0x2e272622, 0x013e3701, 0xa382a682, 0x16321723, 0x21a58217, 0xab82011e,
-    0x3e035b08, 0x0e163701, 0x36262702, 0x1f0d8f01, 0x1c2e1b29, 0x0d211513,
-    0x0f1a181d, 0x24151b2e, 0x1a2b0d0d, 0x04142e0b, 0x32040327, 0x890e0104,
-    0x0210230c, 0x1222160d, 0x15200e02, 0x010f0f1f, 0x792a1521, 0x011d1834,
-    0x13010110, 0x011b0f01, 0x27302828, 0x3e012302, 0x1301110e, 0x04831c23,
-    0x0000003e, 0xff000005, 0x01d601d6, 0x001900ab, 0x003c002c, 0x00440040,
-    0x36331300, 0x07061737, 0x15299082, 0x2b061411, 0x27071701, 0x065d4823,
-    0x83331121, 0x37272e0a, 0x013b011e, 0x26233726, 0x11133736, 0x22af8223,
-    0x84170633, 0x17162233, 0x06114427, 0x12a95530, 0x0b0e1819, 0x18181283,
-    0x27076c12, 0x0883bf0b, 0x03b75e08, 0x1b4c2c09, 0x2e411014, 0x46020105,
-    0xc0191301, 0x04120e96, 0x3b03053d, 0x3b271418, 0x2bb50202, 0x2b2bd52b,
-    0x1d236b01, 0x01151318, 0xebfe1218, 0x101a1912, 0x0112192a, 0x2a181215,
-    0x0e15ebfe, 0x0a08230c, 0x66031515, 0x01ebfe42, 0x19432415, 0x0c052b29,
-    0x0c071123, 0x4040ea0b, 0x2fcf8440, 0xab010000, 0x17002b01, 0x2b001b00,
-    0x33002f00, 0x35200f82, 0x1d36a282, 0x3b161401, 0x15231501, 0x37013e33,
-    0x2b012e35, 0x23073501, 0x1a833335, 0x1e150724, 0x16821701, 0x34013d24,
-    0x11820726, 0x01211583, 0x058347ab, 0x23063d4d, 0x2b6a2b12, 0x2205554e,
-    0x822b1218, 0x82a820c9, 0x012b220d, 0x067d4700, 0x1684b282, 0x80802b22,
-    0x7c4d1183, 0x23068206, 0x2b2b80d5, 0x31086b46, 0x001a004c, 0x010e2500,
-    0x012e2107, 0x37363427, 0x89823526, 0x82173221, 0x011e3004, 0x011e0715,
-    0x2f01d501, 0x24fefe24, 0x8228012f, 0x171e2c0c, 0x2a0b0e14, 0x0134362c,
-    0x827f251e, 0x341b8213, 0x05052e20, 0x011e1605, 0x012a1d0d, 0x072e4302,
-    0x0a002d07, 0x05334d00, 0x0b009634, 0x21001600, 0x29002500, 0x31002d00,
-    0x39003500, 0xf9823d00, 0x2411a74c, 0x012e013f, 0x82738203, 0x010f3f83,
-    0x2737011e, 0x33073707, 0x013f2315, 0x35370717, 0x23271533, 0x010f3335,
-    0x15073727, 0xf6503523, 0x60492a0d, 0x15170102, 0x3b16a051, 0x2c0a8a22,
-    0x10412110, 0x0f531515, 0x200c1017, 0x51088795, 0x282c0c0e, 0x22496002,
-    0x51a0163b, 0xabfe1715, 0xaa2d0b89, 0x65214110, 0x160f4220, 0x15156a10,
-    0x20088775, 0x20008200, 0x27d38401, 0x008001ab, 0x1300002a, 0x30052550,
-    0x33013e15, 0x33021e32, 0x3233023e, 0x06151716, 0x057d4d07, 0x82062221,
-    0x115108a7, 0x3435012e, 0x1e178036, 0x2e130f11, 0x131a1215, 0x241a0e13,
-    0x0c090507, 0x020b0101, 0x3723242e, 0x0b23121c, 0x1e110f2a, 0x1e018001,
-    0x061a1116, 0x05090513, 0x0b010407, 0xab090c04, 0x1001060d, 0x010e0101,
-    0x01470509, 0x111a062f, 0x09001e16, 0x29008200, 0x6b01ab01, 0x07000300,
-    0x694b0b00, 0x001b2706, 0x0023001f, 0x1f422500, 0x82272006, 0x82172007,
-    0x86072003, 0x86152003, 0x2217830f, 0x82565501, 0x56802200, 0x87028856,
-    0x5615220a, 0x2201822a, 0x82d65656, 0x2103831f, 0x6a8256aa, 0x83093f5c,
-    0x820f206f, 0x152127f3, 0x11211721, 0xdd823721, 0x26353332, 0x80014027,
-    0x011580fe, 0x76aafe56, 0x0180010a, 0x552b0382, 0xd5ebfe16, 0x20200901,
-    0x44000109, 0xd6260657, 0x03009601, 0x3d830d00, 0x25211126, 0x33352111,
-    0x35309283, 0xfe2a012b, 0xfeaa01d6, 0x2bd62ad6, 0xd6fe9501, 0x55220982,
-    0xb75cd62b, 0xeaff2207, 0x20378301, 0x064b4c09, 0x8205615f, 0x15052205,
-    0x203f8623, 0x270d8227, 0x6b2bc02b, 0xaa01552b, 0xd5250683, 0x9501aaaa,
-    0x210f8255, 0x0583c02a, 0x4caa6a21, 0x09200d43, 0x3521818c, 0x88838225,
-    0xfed52381, 0x8287d6d5, 0xd656d524, 0x008200d6, 0xbf420620, 0x0b6b4108,
-    0x82130021, 0x23372375, 0x87833315, 0x35331724, 0x8f823723, 0x92820720,
-    0xc0c02b27, 0x016b6b95, 0x2c898215, 0x2a40156b, 0x95014040, 0x556b96c0,
-    0x260482c0, 0xaa404095, 0x82010040, 0x01ee2f4f, 0x009201d2, 0x2500001f,
-    0x17372733, 0x48822707, 0x17220684, 0x0d832335, 0x33071723, 0x82148235,
-    0x15012e0a, 0x541e206b, 0x6b201e54, 0x54541f20, 0x8b06821f, 0x93d5200d,
-    0x43308614, 0x962a06d3, 0x08005601, 0x27010000, 0xac823507, 0x0123352f,
-    0x2ae21e95, 0x37018dd5, 0xd58de21e, 0x8dde822a, 0x37132227, 0x05dc4d17,
-    0x268c6b20, 0x28840420, 0x7f01bf22, 0x11274b82, 0x23001a00, 0x82010000,
-    0x21f282a4, 0xa5821533, 0x23210784, 0x223a8627, 0x4e371127, 0x072e0521,
-    0x601ea001, 0x7e2b964d, 0x962b601e, 0x0483fe4d, 0x0f836020, 0x86016021,
-    0x201d8411, 0x211284fe, 0x1e84c0fe, 0x01206782, 0x00240382, 0x6b01a901,
-    0x00236b82, 0x41113313, 0xeb2c0518, 0xa91e762a, 0x01761ea9, 0x7500ff6b,
-    0x75200983, 0x04842684, 0x15202b88, 0xd5302b85, 0xa9344a56, 0x014a34a9,
-    0x334ac06b, 0x4a33a9a9, 0x220a7f42, 0x4412000b, 0x13200d73, 0x2322ac82,
-    0x48442315, 0x406b230d, 0x21444056, 0xc2fe230c, 0xbb47556b, 0x058f4206,
-    0x47820620, 0x00001e2a, 0x35332725, 0x27331533, 0x2011c444, 0x050a5e3e,
-    0x6b204983, 0x230a964e, 0x0260495b, 0x20072c51, 0x20538255, 0x0aa14ed5,
-    0x45512820, 0x07b3420a, 0x9601c028, 0x1a000600, 0x6b882000, 0x0f06173b,
-    0x2f220601, 0x35272601, 0x36013f36, 0x16011f32, 0x15072717, 0x01353717,
-    0x296d8300, 0xa90a0155, 0xa9050e05, 0x0888010a, 0x9595c023, 0x296c8395,
-    0x5e060d60, 0x065e0404, 0x0887c00d, 0xa6544725, 0x41a65454, 0x0e200c1f,
-    0x220d1f41, 0x41371707, 0x10220c1b, 0x19416b6b, 0x6ba8220c, 0x0faf566b,
-    0xaf561a20, 0x0b89520d, 0x0e414d8f, 0x8e22200b, 0x0b0e4159, 0x65837e20,
-    0x04000023, 0x054b4b00, 0x87428020, 0x42372009, 0x37220787, 0x87422707,
-    0x011f2105, 0x2105c242, 0x87423527, 0x1ecb2c07, 0x2b954c60, 0x2b601e7e,
-    0x83ac4c95, 0x83602004, 0xa960210f, 0x1c841085, 0x1184ac20, 0x1c846a20,
-    0x13430020, 0x01ab2206, 0x23678269, 0x21152500, 0x21059443, 0x7b42ab01,
-    0x42d52007, 0x8d82068d, 0xc0432b8f, 0xab012106, 0x20067b42, 0x068c42eb,
-    0x230c6341, 0x25000012, 0x2c051e46, 0x1e37013e, 0x35170501, 0x35233533,
-    0x0b0c4201, 0x6bc2fe25, 0x42c05555, 0x6b230b39, 0x51405640, 0x83420c0f,
-    0x013f2706, 0x23153315, 0x508a3715, 0x012e0723, 0x250e8227, 0x3e17011e,
-    0x65429501, 0x42c0201a, 0x6b881b9e, 0x870a8342, 0x1883426b, 0xc0206d83,
-    0x84158142, 0x420b206c, 0x1f411782, 0x410e200c, 0x27220d1f, 0x1b411707,
-    0x6ba8220c, 0x0b19416b, 0x6b6b1022, 0x240c1741, 0x0017000b, 0x4141821a,
-    0x27200a04, 0x8f0a1c41, 0x0e67424d, 0x430c7341, 0x22200aad, 0x01206582,
-    0x00226782, 0x1742a801, 0x15372505, 0x37170721, 0x55214d82, 0x06924401,
-    0x8e081642, 0x86332027, 0x0f124227, 0x1225f38c, 0x3e370000, 0x05ce5601,
-    0x012e0723, 0x05624f25, 0x1f442b20, 0x3e01210a, 0x5a161242, 0x13420a2f,
-    0x07252706, 0x33352335, 0x508a0735, 0x0e825983, 0x27012e26, 0x6b01010e,
-    0x20391442, 0x08934f03, 0x85079744, 0x1a97446b, 0x14426d83, 0x42cb201b,
-    0x02201714, 0x22087b47, 0x410e000b, 0x17220d1f, 0x1b412737, 0x1412420b,
-    0x420a1741, 0x04410613, 0x05d64a0b, 0x010e1725, 0x8e012e07, 0x2a12424d,
-    0x200d3f47, 0x07844425, 0x20066747, 0x05664749, 0x47050f42, 0x3f21068b,
-    0x061e4701, 0x8de26b2c, 0x49e22ad5, 0x8dd52ae2, 0x478600e2, 0x6801a929,
-    0x00000800, 0x48112325, 0x6a440700, 0x42152006, 0x00200764, 0x860a2347,
-    0x072c482b, 0x6b442b20, 0x46152006, 0x052016f7, 0x250ba556, 0x33153307,
-    0xdb453335, 0x6b5b240c, 0x55405640, 0x01240b33, 0x55556b3e, 0x420c5b43,
-    0x0127065f, 0x23152317, 0x8a172335, 0x42272050, 0x0722075c, 0x8946011e,
-    0x17f74605, 0x422b0121, 0xb3411a7d, 0x0a734406, 0x05206b86, 0x85187344,
-    0x2b01216d, 0x84157644, 0x18f9466d, 0x240b9b4a, 0x000e000b, 0x0b234100,
-    0x07273722, 0x220c1f41, 0x416b6b10, 0xa8200b1d, 0x20157744, 0x0a084105,
-    0x20413720, 0x464d8f0a, 0x598b0efb, 0x240e7f42, 0x00000200, 0x050765ff,
-    0x1a001225, 0x64010000, 0x0f2911f4, 0x3f012f01, 0x01011f01, 0x05416795,
-    0x4040552b, 0x19191255, 0x5828287f, 0x21038258, 0xe8649501, 0x84e8200f,
-    0x28582117, 0x250a8344, 0x002f0008, 0x8f672500, 0x55132007, 0x232305f5,
-    0x58062722, 0x1727054f, 0x32161415, 0x64013d36, 0x2b0805ff, 0x2315013b,
-    0x36342622, 0x261a0001, 0x26263426, 0x2b7d581a, 0x2018271f, 0x583e3e58,
-    0x1a13013e, 0x658c6513, 0x6b6b4665, 0x807d7d58, 0x342b1f83, 0x7d150126,
-    0x2c201f58, 0x82012020, 0x2c3e2921, 0x14140d1f, 0x65461f0d, 0x2a232782,
-    0x4e7db07d, 0x2b240883, 0x00002800, 0x54063741, 0x232f05e5, 0x3634012e,
-    0x23153337, 0x1614010e, 0x823e013b, 0x84272081, 0x3317390b, 0x4232a015,
-    0x32420101, 0x303024e0, 0x1e17b524, 0xa0a0171e, 0x090c0c09, 0x14840a84,
-    0x8240cb21, 0x4232311e, 0x49300102, 0x1e010130, 0x20011e2d, 0x0c120c01,
-    0x13840984, 0x00002022, 0x30060341, 0x009601ab, 0x00220014, 0x22210500,
-    0x3e112726, 0x2ae38201, 0x33351737, 0x11171632, 0x5127010e, 0x3d33057c,
-    0x23353301, 0x80012615, 0x181200ff, 0x12180101, 0x4f353615, 0x7d37054d,
-    0x24181812, 0x0a554019, 0x01121815, 0x95181256, 0x18952020, 0x82aafe12,
-    0x24192909, 0x6b121818, 0x0006712b, 0x00255c82, 0x01d5ff00, 0x226b82d6,
-    0x500f0007, 0x002d0603, 0x27370713, 0x1f073717, 0x17073701, 0x200b8227,
-    0x20068513, 0x240a8217, 0x16173707, 0x06f24914, 0x013f3429, 0x35a03236,
-    0x82351e1e, 0x86cb2003, 0x856a2007, 0x83352c0e, 0x44342e34, 0xf8070731,
-    0x85071107, 0x49012106, 0x35222884, 0x0786b435, 0x83000121, 0x20038238,
-    0x212b82c8, 0x28823147, 0x8207f821, 0x8211202b, 0x065b4933, 0x4b01d62e,
-    0x0a000200, 0x15000e00, 0x013f0000, 0x33268c82, 0x33173337, 0xf5821327,
-    0x33372908, 0x07273335, 0x18197233, 0x0f29442e, 0x44280f44, 0x40eaea4b,
-    0x7575406a, 0x4e4eb240, 0x2a2ac079, 0x2beafec0, 0x76766a2b, 0x4582e682,
-    0xab22e783, 0x4b82ab01, 0x00001d34, 0x27371501, 0x07010e15, 0x26371716,
-    0x17013e35, 0x0d831607, 0x17073522, 0x372f0c82, 0x55000126, 0x02604955,
-    0x0f1f1a01, 0x83c64901, 0x85362004, 0x40013610, 0x40565540, 0x33496002,
-    0x211b1f28, 0x1f244936, 0x4936201c, 0x6a148701, 0x082b0c6f, 0x30002700,
-    0x00003900, 0x42161437, 0x112305c5, 0x4b353315, 0x3622089a, 0x82841737,
-    0x20096e62, 0x05ca4217, 0x25363222, 0xeb203087, 0x23050953, 0x0147382a,
-    0x2605d753, 0x1e742001, 0x622a2391, 0x80200870, 0xff202085, 0x2006ec53,
-    0x06645355, 0x29552225, 0x5b3a5109, 0x372805dc, 0x911e7327, 0x304f1a01,
-    0x20086d5e, 0x202585c0, 0x4f068509, 0x6b270a4f, 0x14000800, 0x6c002300,
-    0x012e0931, 0x3634012e, 0x1632013b, 0x37070614, 0xe8612327, 0x011f2f05,
-    0x26010e16, 0x1e168b01, 0x1e1e2d1e, 0xf654ecfe, 0x1e623108, 0x41015b4e,
-    0x021c2e39, 0x1a0b043d, 0x016b0117, 0x2d242083, 0x01abfe1e, 0x2e056557,
-    0x5b551601, 0x01032f03, 0x0dad0b17, 0x820b0917, 0x0300217a, 0x01230483,
-    0x824901c0, 0x000c257b, 0x37000010, 0x2605dd4a, 0x15351521, 0x82173523,
-    0x556b2d03, 0x1e89891e, 0xd5550155, 0x56abd5d5, 0x56250b83, 0x2b2b952a,
-    0x0abb5ad5, 0x01000225, 0x440e0080, 0x0625058b, 0x1617010f, 0x063b6c17,
-    0x65070321, 0x1720052a, 0x01345582, 0x16c0fed5, 0x0c73730c, 0x12400116,
-    0x1e521919, 0x4d1e4d4c, 0x4c2a0282, 0x80014c1e, 0xadad1201, 0x556c0112,
-    0xf3fe2105, 0x1d851784, 0x29063b42, 0xc0010000, 0x1b008001, 0x09822400,
-    0x07010e26, 0x23371723, 0x2508cd48, 0x1e072726, 0x0e823301, 0x07012e24,
-    0x9843012e, 0x00012805, 0x40026c52, 0x5f405655, 0x312508ed, 0x3c181e26,
-    0x22158221, 0x6e276c02, 0x01260690, 0x526c0280, 0x855d5555, 0x1e1a2309,
-    0x12821513, 0xbe6c5222, 0x43054664, 0xea20059f, 0xab227b82, 0x21410400,
-    0x00142606, 0x15071300, 0x05d85b21, 0x21352122, 0x3d06a957, 0x01caf535,
-    0xfe406b95, 0xfe950196, 0xc040aa6b, 0x6bab0140, 0x96552b2b, 0x4000ff96,
-    0x008296c0, 0x69000021, 0xd622057f, 0xa7514001, 0x1300240e, 0x97231133,
-    0x2a2b2c03, 0x1515402a, 0x5640402a, 0x82401515, 0x40402a0b, 0x01151555,
-    0x0100ff40, 0x20039500, 0x05635300, 0x01000223, 0x27678c96, 0x00290020,
-    0x003b0032, 0x2a086d98, 0x35231501, 0x013b3634, 0x16322515, 0x3523011d,
-    0x15013523, 0x22231533, 0x05013d26, 0x14153335, 0x35012b06, 0x402b2b55,
-    0x822b1616, 0x16162284, 0x2e0b8440, 0x192b96fe, 0x55015512, 0x552b1912,
-    0x8255abfe, 0xd5012107, 0xa2971184, 0x56562b2e, 0x2a2a1812, 0x56561218,
-    0x56d6fe2a, 0x12840884, 0x0035d182, 0x7601d5ff, 0x4800a701, 0x2e370000,
-    0x011e3701, 0x2e35011f, 0x25078a03, 0x26171617, 0xf65a3427, 0x56372006,
-    0x0721056e, 0x2e089115, 0x012e3523, 0x01060c9c, 0x070e301b, 0x8d192919,
-    0x02032f08, 0x0b110105, 0x0601110c, 0x1b300e05, 0x20820601, 0x08900720,
-    0x29192a2e, 0x16291339, 0x0c132110, 0x241e0e31, 0x0436098e, 0x18131406,
-    0x30171931, 0x09141518, 0x16102113, 0x0e1e2429, 0x09910c31, 0x0e272723,
-    0x09c3421e, 0x80019625, 0x82001300, 0x33252710, 0x33352115, 0x03842335,
-    0x2315212c, 0x2b153315, 0x32011e01, 0x914b3736, 0x15802405, 0x8215d6fe,
-    0x2a012100, 0xc0300482, 0x24362401, 0x04380401, 0x2b2b3804, 0x802a802b,
-    0x1c290483, 0x231c2424, 0x4c03034c, 0x063f5e00, 0x7001d938, 0x1d000b00,
-    0x26370000, 0x011e3736, 0x07061607, 0x0637012e, 0x54821716, 0x4c263621,
-    0x0e2806f2, 0x5b032b01, 0x035b7d7d, 0x1f350584, 0x50774503, 0x6c030b5e,
-    0x0e391317, 0x1e18111d, 0xe9116532, 0x35028211, 0x05054b05, 0x3f04124b,
-    0x26202304, 0x52060783, 0x03250306, 0x2f446908, 0x01eb2409, 0x51170096,
-    0x333905f9, 0x022f2622, 0x013b013e, 0x1f323637, 0x16323301, 0x0e010f17,
-    0x07032301, 0x08625b33, 0x140c753b, 0x01023806, 0x6361090c, 0x62071606,
-    0x010c0961, 0x14063901, 0x80408b0c, 0x05674340, 0xca0a0d33, 0x8c0c090a,
-    0x0c8c0909, 0x0acd0709, 0x5b5b010d, 0x06a34355, 0x2b127353, 0x00240012,
-    0x13000028, 0x17231533, 0x2006bc57, 0x05795117, 0x8c830120, 0x33363426,
-    0x15163221, 0x27248684, 0x40213733, 0x2b320084, 0x6bc04040, 0xfe405540,
-    0x05140dcb, 0x090c0238, 0x87825601, 0x14053938, 0x2ebcbe0d, 0x9501e8fe,
-    0xaa402a40, 0x556b8040, 0x0dabfe55, 0x8e829f0a, 0xa2248a82, 0x802a0d0a,
-    0x20085b63, 0x064f43ab, 0x37207f86, 0x82050447, 0x23352283, 0x063f4b37,
-    0x7c827f96, 0x7f9b8482, 0x7e99eb20, 0x5f560020, 0x01803005, 0x00130096,
-    0x35230100, 0x0e231523, 0x72111501, 0x112c06f5, 0x64012634, 0x0c248024,
-    0xc80c1010, 0x01280482, 0x012a2a6b, 0xb9fe0c10, 0x0c250b82, 0x100c4701,
-    0x05374d00, 0x03283f83, 0x00001700, 0x33112325, 0x8e05e652, 0xaa552345,
-    0x488a0faa, 0x00014023, 0x914a8f2b, 0xa435204b, 0xeb55214b, 0x4bb74a91,
-    0xc9c08021, 0xab95214b, 0xab214bc9, 0x214bc995, 0x4bc980c0, 0xa155eb21,
-    0x2301214b, 0x2225c741, 0x91400001, 0x0e5f424c, 0x15214ba8, 0x254b912b,
-    0xff000003, 0xab4201ea, 0x00072205, 0x09df631b, 0xf7421320, 0x2a152113,
-    0x4f200082, 0x250ab342, 0x2bc06b95, 0xb5420001, 0x42002010, 0x13220a6b,
-    0x45431900, 0x35032515, 0x33153723, 0x27084b43, 0x10100dc7, 0x2b552b85,
-    0x23104f43, 0xa076abfe, 0x2608d34a, 0x01eb01ea, 0x83050096, 0x23252653,
-    0x15330735, 0x2aa78e03, 0x012e1137, 0x6b40eb01, 0x43237240, 0xc72b05a3,
-    0x0101100c, 0xd696d510, 0x918001aa, 0x20ff85a8, 0x225384ec, 0x841d0009,
-    0x205582ff, 0x129f4127, 0xec205984, 0x80235982, 0x900eabab, 0x436a205c,
-    0x5b851171, 0x0322af83, 0x5b861700, 0x8310bd43, 0x84172055, 0x000121c9,
-    0xd120578f, 0x7d436c83, 0x82952010, 0x890020ca, 0x0005215b, 0xeb20b7a3,
-    0xc020b797, 0xc4114543, 0x6bd521b7, 0x9b0f6c42, 0x410320b7, 0xb798176f,
-    0x43150121, 0x00201219, 0xb2171741, 0x432a205f, 0xd742122d, 0x0017270d,
-    0x011e0100, 0xa16c1115, 0x34112d06, 0x35333736, 0x15071533, 0x64013533,
-    0x26071e46, 0x9580240c, 0x466b01aa, 0x01250c21, 0x2bab2a2a, 0x27ab8a2b,
-    0x00170013, 0x1300001b, 0x27234d89, 0x84013e11, 0x3317284d, 0x33252315,
-    0x83f92335, 0x05cb4250, 0x80230c29, 0xffabab6b, 0x93abab00, 0x95162257,
-    0x08534f00, 0x21308346, 0xf5920115, 0x23440220, 0x00132208, 0x21f3951f,
-    0xd4733517, 0x25fb8c09, 0x402a4015, 0xa7912a40, 0x402bd623, 0x41028240,
-    0x1f220c03, 0x03412300, 0x23052215, 0x265e8215, 0x33353335, 0x41053315,
-    0x0121100b, 0x05b26416, 0x4155fe21, 0xd6201310, 0x15216784, 0x08475395,
-    0x01802408, 0x00150096, 0x002d0019, 0x0e072500, 0x36230701, 0x3436013f,
-    0x07062226, 0x32013e23, 0x07141716, 0x44333523, 0x413614fd, 0x030c0813,
-    0x1a14042b, 0x1824180c, 0x30012a01, 0x40013048, 0x0f452a2a, 0x14bb350b,
-    0x1d0d1208, 0x240c1b15, 0x24121818, 0x1d243030, 0x16012aa3, 0x6d117644,
-    0x962008af, 0x2820f382, 0x362b8982, 0x3e211533, 0x06353701, 0x82012e07,
-    0x830a838a, 0x011d248d, 0x8417011e, 0x2f262211, 0x3aac8201, 0x45400135,
-    0x0196fe50, 0x0f1b4e5b, 0x2129220a, 0x495f020a, 0x0c120c01, 0x84035e4a,
-    0x1c0f3e0e, 0x2d3c01ab, 0x0b550c34, 0x088a1027, 0x13131119, 0x08513b11,
-    0x0c0c0901, 0x51080109, 0x260f833b, 0x2ddd0919, 0x586a013c, 0x1d310c5f,
-    0x34002b00, 0x22170000, 0x3f342726, 0x26223501, 0x06074f3d, 0x14011d2f,
-    0x17152306, 0x010e1516, 0x16142523, 0x27a38217, 0x07012f34, 0x37060727,
-    0x3507d065, 0x01241b80, 0x0c09750b, 0x12561218, 0x75090c18, 0x1b24010b,
-    0x6f82ebfe, 0x0c090029, 0x6c363004, 0x4faa0450, 0x24080579, 0x131c2415,
-    0x0c27cc0f, 0x18121609, 0x09161218, 0x0fcc270c, 0x40241c13, 0x01010c09,
-    0x5405100c, 0x058a6c36, 0x072065b9, 0x24058349, 0x009601c0, 0x93979f1d,
-    0x206b9680, 0x06774100, 0x0e255783, 0x00002c00, 0x24d38837, 0x07152335,
-    0x1d004106, 0xd4866b20, 0x7c2a7c24, 0xf5921504, 0xc9862b20, 0x5d5dd725,
-    0x954705d7, 0x820020ed, 0x57042000, 0x838308c3, 0x36003122, 0x272987ae,
-    0x3f231737, 0x22141601, 0x27919f34, 0xb6291d6b, 0x13092d39, 0x802799a3,
-    0x1e62471c, 0x41131301, 0xd6220723, 0x714c9601, 0x09b55705, 0x35070622,
-    0x220b3d74, 0x67173736, 0x95200721, 0x2308cf73, 0x221e1b25, 0x2208375b,
-    0x726b303a, 0xc02005de, 0x22091f74, 0x59097715, 0x3c240855, 0x01791d60,
-    0x2005e27c, 0x20778700, 0x08778296, 0x0e000337, 0x21130000, 0x011b2303,
-    0x16360333, 0x3f361617, 0x40015501, 0x2204eb2a, 0x29111d16, 0x15451b12,
-    0xfe950106, 0xfe800156, 0x062401aa, 0x09171103, 0x06004509, 0x3b008200,
-    0x4a01d601, 0x1f000500, 0x33002a00, 0x4a004600, 0x2e250000, 0x07062201,
-    0x23071637, 0x32294882, 0x33373637, 0x27060706, 0x07ed6b22, 0x34051628,
-    0x23272627, 0x1a823315, 0x32332723, 0x2b0d8236, 0x1617012b, 0x020e0714,
-    0x3311012b, 0x85083382, 0x07060714, 0x35233716, 0x02a20133, 0x03152517,
-    0x8a010288, 0x210b1301, 0x3304070a, 0x2e191102, 0x2a343a26, 0x0c0c2819,
-    0x0a10fcfe, 0x11383911, 0x3864110a, 0x0d0e1512, 0x0a923113, 0x2318080b,
-    0x31807714, 0x080c0c14, 0x6bbd140d, 0x1514ba6b, 0x0d051316, 0x070c1c19,
-    0x11090409, 0x2f011c12, 0x12353234, 0x15411114, 0x47010407, 0x0d660805,
-    0x64040623, 0x0d122f10, 0x0a010712, 0x30111c01, 0x0806090e, 0x27551b5d,
-    0x828b2009, 0x001a2de9, 0x36320500, 0x011e2337, 0x26343537, 0x08058e72,
-    0x0e011d34, 0x07011d01, 0x01352115, 0x01181200, 0x92180156, 0x1c122e32,
-    0x2b322e12, 0x18155601, 0x80181212, 0x0c49326a, 0x12120d0f, 0x480c0f0d,
-    0x152b6a33, 0x07440015, 0x008b2e0a, 0x0013000c, 0x25000022, 0x17072701,
-    0x224a8406, 0x91073717, 0x06073066, 0xfeab0107, 0x3c1b37fc, 0x25012b11,
-    0x8bc01b2b, 0x08102a6d, 0x0c013107, 0x213b1b38, 0x22608229, 0x83301b2b,
-    0x4e9c2378, 0x78864833, 0x04030522, 0xab267388, 0x07009601, 0x73841b00,
-    0x3e35232a, 0x1f163201, 0x012e3501, 0x0722ce85, 0xcc820e15, 0x8282ce83,
-    0x14233535, 0xc0550116, 0x36523601, 0x3b012b01, 0x121b122f, 0x823a2f01,
-    0xb66b2d0a, 0x18551912, 0x36298b55, 0x75752936, 0x0e29de82, 0x0e12120e,
-    0x32490c0e, 0x20de8275, 0x7c7c8355, 0x052c0dcb, 0x25001900, 0x1e330000,
-    0x3f363201, 0x1d216d89, 0x206d8701, 0x0a6d4627, 0x1801d536, 0x68011824,
-    0x14323e01, 0x3e32141c, 0x80012d01, 0x402a406b, 0x12360282, 0x59121818,
-    0x0c4e357c, 0x13130f0f, 0x4e0c0f0f, 0x172d7c35, 0x1a837f17, 0xe3434020,
-    0x82d52008, 0x000922df, 0x286f821d, 0x1700002d, 0x37363716, 0x20c88336,
-    0x22e29137, 0x82333727, 0x1e072414, 0x82272501, 0x3e332b87, 0x0405f501,
-    0x55030916, 0xec8c9d18, 0x2b2a2b3b, 0x1f262f03, 0xe5fe2821, 0x042e271e,
-    0x1528032b, 0x14050201, 0x18120808, 0x30fb8ff5, 0x5733802b, 0x47181e1d,
-    0x571d1e5f, 0x00472a33, 0x053f7300, 0x73419383, 0x002a3305, 0x25000032,
-    0x22012e35, 0x37150706, 0x35211517, 0x78463537, 0x2207270c, 0x14333526,
-    0x99821306, 0x011e3724, 0x99822517, 0x20822320, 0x55012b08, 0x36523601,
-    0xfe2beb01, 0x3a012b95, 0x1b12012f, 0x013b2f12, 0x5518128b, 0x2803a319,
-    0x2f261f21, 0x21b7fe03, 0x042b0328, 0x9841272e, 0x168b2505, 0x2b15152b,
-    0x290c9d41, 0x121218f5, 0x2a000118, 0x9e831847, 0x47188923, 0x49ad822a,
-    0xab2007bf, 0x20063741, 0x299f8224, 0x23153307, 0x35233735, 0x19421733,
-    0x3c2b231a, 0x02826b3c, 0x2c415520, 0x12b62b0c, 0xef185519, 0x49262649,
-    0x7b8caa26, 0x260a1942, 0xff000002, 0x826e01d2, 0x0013336f, 0x37000023,
-    0x34112315, 0x15163236, 0x15070614, 0x0682011e, 0x3722272d, 0x35013e35,
-    0x06222334, 0x8316011d, 0xc5350809, 0x325b3632, 0x2a281a21, 0x0422303a,
-    0x182d241b, 0x1e371d1a, 0x5e017649, 0x262b362e, 0x01082e1a, 0x2a242e06,
-    0x299f0136, 0x2c162303, 0x11bc1c1f, 0x391a1b01, 0x08df4400, 0x2505e758,
-    0x13000020, 0xdf581533, 0x58232009, 0x172d06f4, 0x33152315, 0x33353315,
-    0x7c352335, 0x06dc5819, 0xff111930, 0x01191100, 0x40a91601, 0x40402b40,
-    0xdc589501, 0x19112e07, 0x56011119, 0x40a81810, 0x2b6b6b2b, 0x20638240,
-    0x30cf8206, 0x010002ea, 0x000800a7, 0x00290014, 0x003e0032, 0x21d78247,
-    0xd6832622, 0x60061421, 0x37230898, 0x8237012e, 0x2e272b64, 0x0f062701,
-    0x16070601, 0x7682011f, 0x13372722, 0x42182993, 0x6b2e0826, 0x3f2a2a20,
-    0x2e1f2b2b, 0x3c01013c, 0x05832d2e, 0x4459a439, 0x09110529, 0x0a4f0a10,
-    0x48110101, 0x7e323026, 0x3f2b2b1f, 0x84202a2a, 0x842d201e, 0x116e272a,
-    0x16211515, 0x337d0b16, 0x87b52005, 0x261c823b, 0x0846262c, 0x82010109,
-    0x1410293d, 0x8b6b2b0b, 0xebfe3223, 0x9b232591, 0x82162016, 0x5a002002,
-    0x270806a7, 0x00800180, 0x13000009, 0x35371711, 0x07011f27, 0xc64f6b11,
-    0x6f3623b0, 0xabfe8001, 0x3b576f2b, 0x013e1953, 0x0005000e, 0x2a05a767,
-    0x00030080, 0x00160012, 0x82290025, 0x15332333, 0xb14b0723, 0x27350805,
-    0x15333735, 0x37070614, 0x13333523, 0x3d012e35, 0x15173301, 0x012b010e,
-    0x35032622, 0x2aeb1533, 0x090c2b2a, 0x010c0940, 0x090c552b, 0x6b404015,
-    0x2b550c09, 0x2c128401, 0x40014015, 0x0c099695, 0xc06b090c, 0x24218295,
-    0x95fe2bc0, 0x211a8280, 0x2482c095, 0x49010c24, 0x7a822b2b, 0x7f840720,
-    0x2b01d626, 0x13000f00, 0x23083f6f, 0x25000034, 0x8306d371, 0x013d3069,
-    0x15173634, 0x33253533, 0x011d011e, 0x85230614, 0x012b2206, 0x24148237,
-    0x23353307, 0x20b08237, 0x2f038235, 0x12406b01, 0x40121818, 0x12191912,
-    0x6a80fe40, 0x03830783, 0x402a6a22, 0x96210082, 0x2000822a, 0x861982c0,
-    0x402b2923, 0x18019640, 0x18122b12, 0xd5270585, 0x40ab4040, 0x83d58016,
-    0x05074497, 0x9601eb2c, 0x4c004600, 0x5d005500, 0x93826400, 0x2e071426,
-    0x07062701, 0x29065d6c, 0x22270617, 0x010e2726, 0x595e0623, 0x37362106,
-    0x07370e83, 0x013e3526, 0x36342637, 0x07010e37, 0x36171614, 0x17163237,
-    0x8235013e, 0x011e2b3a, 0x011e0714, 0x37321625, 0x41182226, 0x53840845,
-    0x16141522, 0x26822e83, 0x01eb013e, 0x0c2b3b04, 0x0101010b, 0x3506242f,
-    0x22070727, 0x38111138, 0x27070722, 0x2e250635, 0x6a081682, 0x3b2b0c0b,
-    0x45020104, 0x1d241135, 0x11011714, 0x162d1e0f, 0x110f0f26, 0x1d141701,
-    0x45351124, 0x4219ddfe, 0x22441819, 0x1c12130d, 0x02081212, 0x23011b21,
-    0x03211b86, 0x0769231d, 0x01372a06, 0x08080201, 0x24093727, 0x01020331,
-    0x1e1a1a1e, 0x30030201, 0x27370925, 0x01020808, 0x062a3701, 0x03473507,
-    0x103a471c, 0x821b2c0e, 0x011e3857, 0x260f0f10, 0x0e2c1b16, 0x1c473a10,
-    0x104a4703, 0x01731610, 0x82121a12, 0x1e322e02, 0x05040c30, 0x0c522b1e,
-    0x2b081e30, 0x08bf431e, 0x01d63e08, 0x000d0096, 0x01000011, 0x03071516,
-    0x22212306, 0x34270327, 0x23371337, 0x0cc90117, 0x0b032812, 0x030be6fe,
-    0xf50c1228, 0x01168416, 0x7e0e0395, 0x0c0cf1fe, 0x0e7e0f01, 0x8ce5fe03,
-    0x22478c8c, 0x651a000b, 0xda6d0def, 0x33172805, 0x36173335, 0x5e012e37,
-    0x5b220cff, 0xd3826049, 0xab311b27, 0x0201112e, 0x0c066660, 0x6002282c,
-    0x18412749, 0x29244d80, 0xf7586049, 0x825b2008, 0x000f3d09, 0x001f0017,
-    0x002f0027, 0x37000037, 0x0614011e, 0x013f2307, 0x06141632, 0x3337012b,
-    0x17200786, 0x37211785, 0x870f8517, 0x013f211f, 0x74271786, 0x101b1b10,
-    0x834a0e49, 0x0f4a2206, 0x290683ce, 0x10300e4d, 0x4d101c1c, 0x1485210f,
-    0x0685dd20, 0x29855820, 0x1401e52b, 0x4a011420, 0x151f1575, 0x20038349,
-    0x200f8575, 0x200b8376, 0x2704832c, 0x1e150176, 0x004a0115, 0x200aff4d,
-    0x062d5926, 0x011f142b, 0x14062223, 0x07013b16, 0x2325820e, 0x013e1701,
-    0x06828883, 0x012e3728, 0x012e012f, 0x1f822627, 0x1722b282, 0xf877010e,
-    0x5c088205, 0x24080541, 0xcb4b0aab, 0x0d12120d, 0x090d887e, 0x0b141601,
-    0x052a0a16, 0x60494660, 0x262d0102, 0x375e3105, 0x0b0a0507, 0x09894a95,
-    0x2d3d2a08, 0x402a2a20, 0x80012a2a, 0x122d070c, 0x0855121c, 0x19110d16,
-    0x090c0101, 0x015c4522, 0x30486101, 0x2103174c, 0x0c02192e, 0x0ab04489,
-    0x2a011f28, 0x3f2b2b3f, 0xbb5f002a, 0x0027260a, 0x13000030, 0x05b35f21,
-    0x15012b22, 0x23229982, 0x07831e15, 0x27262227, 0x35373634, 0x21b68223,
-    0x574d2335, 0x22132105, 0x322bdd82, 0x40263436, 0x0c098001, 0x8215090c,
-    0x13802970, 0x36240118, 0x13180124, 0x01211282, 0x20168215, 0x05344dc9,
-    0x0c950134, 0x0c092b09, 0x010c0995, 0x1520072e, 0x1c24241c, 0xf6822015,
-    0x85090c21, 0xabfe2118, 0x2c09eb72, 0xff000003, 0x010002c0, 0x000b00c0,
-    0x06a94f15, 0x230b2441, 0x17161407, 0x2d06dc6d, 0x01272634, 0x0001011e,
-    0x0303906d, 0x05856d90, 0x02785b29, 0x2c011719, 0x8427441c, 0xd4fe2509,
-    0xc001441c, 0x6d2e1d88, 0x78022890, 0x1c44275b, 0x19172c01, 0x0b8556fe,
-    0x17d4fe26, 0x04000019, 0x2c0c2f7f, 0x003e002e, 0x0e232500, 0x3b161401,
-    0x21e68301, 0x05833327, 0x83012b21, 0x153727f6, 0x011d031e, 0xcd76010e,
-    0x013e2105, 0x16212182, 0x45461815, 0x5c332007, 0x012206c5, 0xfc82572b,
-    0x04830920, 0x83386021, 0x21048309, 0xe882018a, 0x1b240126, 0x01241b80,
-    0x552b0682, 0xfe56241c, 0x181812aa, 0x82560112, 0x4eab2005, 0x41200637,
-    0x27050d41, 0x0c091515, 0x40090c01, 0x95252b85, 0x1c24241c, 0x050c6080,
-    0x77422f85, 0x017a2107, 0x20054378, 0x08b18213, 0x013d0727, 0x27370717,
-    0x07271523, 0x37170717, 0x27373315, 0x28283d01, 0x157a6528, 0x77771e62,
-    0x7a15621e, 0x5128645c, 0x221282b7, 0x8461a179, 0x79a22311, 0x0082005c,
-    0xcf4d0520, 0x00022808, 0x00130005, 0x9521001c, 0x0737284f, 0x17071416,
-    0x82263736, 0x27342304, 0x4a821301, 0x5d8a6420, 0x141bae2b, 0x01201914,
-    0x09318f01, 0x2d699109, 0x5e261c71, 0x3f321a26, 0x1832403e, 0x76821734,
-    0x2c06cf49, 0x009601c0, 0x00060003, 0x00170009, 0x2377831b, 0x010f3717,
-    0x2329cb91, 0x01170727, 0x2b2a2a95, 0x28d38e83, 0x2b2b2a89, 0x2b2b2beb,
-    0x82db905c, 0x069f4314, 0x6382ab20, 0xd9820820, 0x0000162b, 0x17071701,
-    0x15232737, 0x08264117, 0x20080e82, 0x15011735, 0x411e2228, 0xa22a157a,
-    0x1e778d1e, 0x315c1562, 0x0128961e, 0x1e232844, 0x2b6b7941, 0x2614846c,
-    0x1e315ba2, 0x82295109, 0xff0027ab, 0x017a01c0, 0x2f4100c0, 0x20b78305,
-    0x1531411f, 0x3d6f1320, 0x82172006, 0x108d4107, 0x2b2b222c, 0x562b2bab,
-    0x288f2a2a, 0xd582b750, 0x62a27a2c, 0x1e78771e, 0x5c7aa262, 0xbc82d5fe,
-    0x002b2b22, 0x45062341, 0x102005b3, 0x1a22c182, 0xc3822100, 0x17072408,
-    0x07352307, 0x37273727, 0x17333517, 0x27153715, 0x15232515, 0x37233523,
-    0x33270713, 0x01153335, 0x415c5c3a, 0x15280899, 0x00012828, 0x402b2b2a,
-    0x2b260082, 0x5c1c012b, 0x6983795c, 0xa23ae682, 0xb8295151, 0x40d95129,
-    0x00ff5640, 0x40405656, 0x00001800, 0xcb01f5ff, 0x236b8b01, 0x28260808,
-    0x36003100, 0x48003f00, 0x5a005100, 0x6c006300, 0x76007100, 0x80007b00,
-    0x8e008900, 0x9c009700, 0xae00a500, 0x9582b700, 0x20075151, 0x07204407,
-    0x45180888, 0x172408e1, 0x34321406, 0x22060b63, 0x8c372634, 0x88369a0d,
-    0x08c84931, 0x34363725, 0x84131422, 0x8404833f, 0x6117200e, 0x142205b6,
-    0x1c831716, 0x85882520, 0x93992084, 0x0e2b0128, 0x121b1212, 0x06850d12,
-    0xb8446320, 0x0d092105, 0x48221484, 0x7861130a, 0x0a8c2306, 0x89614a14,
-    0x8617860c, 0x85b42006, 0x860e202f, 0x27368322, 0x140a9f13, 0x0a1309e1,
-    0x9e241285, 0xcafe140a, 0x49230a85, 0x9336140a, 0x0b01214a, 0x20067861,
-    0x057f6155, 0x0d446020, 0x86b62005, 0x01ff2415, 0x854b1414, 0x014b2412,
-    0x85b61313, 0x8555200a, 0x06474506, 0x48445620, 0x850b2006, 0x85762041,
-    0x824a201c, 0x95fe2139, 0x96200482, 0xd6203782, 0x7420468d, 0x60202285,
-    0x0c201982, 0x00224a94, 0x376d000e, 0x001f260d, 0x00280024, 0x0615422d,
-    0x55004c27, 0x67005e00, 0x0a017a00, 0x20078741, 0x0c904137, 0x34363729,
-    0x15251422, 0x83033521, 0x7a072008, 0xd2410722, 0x23118709, 0x21352107,
-    0x43873a89, 0x4d180720, 0x152008ea, 0x2d133b41, 0x0a13095f, 0xdffe1309,
-    0x09558001, 0x2185a113, 0x93414c20, 0x25068506, 0xfe80011d, 0x3b8c8080,
-    0x55202086, 0x41063441, 0x0686064a, 0x14014b2c, 0x13015514, 0x2b2b7413,
-    0x0782e0fe, 0x25860c20, 0x1c124a23, 0x20028212, 0x06954155, 0x7f2bf621,
-    0x36860601, 0x79416020, 0x00002305, 0x4b431200, 0x00042208, 0x080d820d,
-    0x20001724, 0x2e002500, 0x56005100, 0x68005f00, 0x7a007100, 0x84007f00,
-    0x95008900, 0x00009e00, 0x32140637, 0xa7421734, 0x05294307, 0x57431284,
-    0x83052007, 0x0825430d, 0x43172721, 0x35220615, 0x41482734, 0x17372306,
-    0x3f852326, 0x37221383, 0x30831301, 0x84411320, 0x234c1808, 0x41118708,
-    0x1725087a, 0x14223436, 0x84048327, 0x33172109, 0x1d232185, 0x41011e01,
-    0x40200888, 0x2308b442, 0x9f13094c, 0x01240c88, 0xf5140a37, 0x22055441,
-    0x840651a9, 0x3c012a08, 0x19120e0c, 0x033c0212, 0x270f8503, 0xa5fe1c50,
-    0x4c130adb, 0x430c7b41, 0xa2200637, 0xf4321485, 0x0ae1140a, 0x13095f13,
-    0x120d0505, 0x02121b12, 0x18850f0f, 0x1301a024, 0xc5424a13, 0x82eb2009,
-    0x4149200e, 0x0a200688, 0xfb211a89, 0x24138451, 0x3c030309, 0x227a8202,
-    0x873c0c0e, 0x1b512a0f, 0xa0fe5b01, 0x01141401, 0x43458521, 0x56200721,
-    0x200cec42, 0x204b824b, 0x82258394, 0x82ab2003, 0x0d12257f, 0x5e0f0a05,
-    0x20099b48, 0x0823480e, 0x0d000834, 0x25001900, 0x2f002a00, 0x3d003400,
-    0x47004200, 0x1b454c00, 0x25002106, 0x23080345, 0x34321406, 0x1805de49,
-    0x20116344, 0x831c8417, 0x05734104, 0x2105b341, 0x0d842634, 0x17830720,
-    0x4512fd41, 0x01210803, 0x0863442b, 0x616e3420, 0x5449200a, 0x022808b5,
-    0x130a1078, 0x49130a09, 0x29087b44, 0x37130a5f, 0x09361309, 0x05834a13,
-    0xd6830c20, 0x48067e41, 0x4a200778, 0x4a20ff82, 0x210a4172, 0xe4547e01,
-    0x785b2208, 0x201c829e, 0x20038254, 0x41038281, 0x20200645, 0x3f200e86,
-    0x96200782, 0x410a9341, 0xe74e0655, 0x01d62e06, 0x0021002b, 0x010e3700,
-    0x34352622, 0x2d038237, 0x17163236, 0x3e373216, 0x15163201, 0x03820714,
-    0x2622062c, 0xab222627, 0x24372401, 0x04821010, 0x562a0123, 0x280c8b2a,
-    0x24241b95, 0x11111a1b, 0x2107831a, 0x0d8c0303, 0x00000028, 0xff000001,
-    0x935001ea, 0x05003605, 0x11373632, 0x012b012e, 0x35072715, 0x07062223,
-    0x33011e11, 0x055f6901, 0x35801224, 0x73691536, 0x0f616906, 0x02204782,
-    0x20080349, 0x05e95c14, 0x260ec369, 0x06141115, 0x82211507, 0x331125c6,
-    0xd5950111, 0x2b384986, 0x19126a2b, 0x00ff3c19, 0x402b1912, 0x00011219,
-    0x206a1812, 0x12186a20, 0x2a201184, 0x2b226882, 0xa354d5fe, 0x0096230b,
-    0x618e000f, 0x83163221, 0x3727255c, 0x13233517, 0xd5206190, 0xd2245e82,
-    0x96562b2b, 0x5e85628b, 0x2020c025, 0x8aaafe6b, 0x052f5063, 0x7701eb21,
-    0x1b2507d7, 0x00001f00, 0x067e4f25, 0x07821520, 0x0e211329, 0x1e110701,
-    0x41213301, 0x03260528, 0x01331123, 0x00849615, 0x41feab21, 0x2f410627,
-    0xc0c02907, 0x205520c0, 0x0001204a, 0x8206a77a, 0x121526de, 0x01c1fe18,
-    0x062f4115, 0xeb01f52e, 0x20006101, 0x00002c00, 0x22232601, 0x3006fa59,
-    0x33161411, 0x33013e37, 0x3e171636, 0x17163201, 0x216b8316, 0x20840326,
-    0x17833520, 0xc0011732, 0x3e1f2724, 0x3f3e1818, 0x0407183e, 0x18371705,
-    0x3b080d82, 0x34374217, 0x06070217, 0x24181301, 0x17421c27, 0x271c4217,
-    0x0b550124, 0x0f11110f, 0xc7fe110f, 0x0a010604, 0x120f010d, 0x0c0a120e,
-    0x01050601, 0xe7fe0e37, 0xf50e120b, 0x0b01120e, 0x2b0c9b52, 0x00140004,
-    0x15331300, 0x21250727, 0x86060242, 0x6b8026ee, 0x00013536, 0x06796bff,
-    0x07850120, 0xab6b0125, 0x4bd52020, 0x01200c5c, 0x28084f82, 0x01960100,
-    0x000a0080, 0x22230100, 0x37111506, 0x26341117, 0x12d66b01, 0x18959518,
-    0x12198001, 0x4040abfe, 0x18135501, 0x207b8500, 0x202f8700, 0x31098210,
-    0x11151632, 0x34110727, 0x37173336, 0x07270727, 0x36846b01, 0x85561226,
-    0x1e38671e, 0xeb243d8b, 0x38681f85, 0x210eef65, 0x5482000a, 0x438a0120,
-    0x870d396c, 0x1912274b, 0x40182419, 0x4e8b0a55, 0x2418ab2c, 0x6a121919,
-    0x0005702b, 0x00820002, 0xc3830120, 0x0f000425, 0x82250000, 0x3533218f,
-    0x6b22ca8b, 0xcd85d66b, 0x2f2f4025, 0x8b2b1501, 0x8c0320d1, 0x821b203b,
-    0x2311243d, 0x8a133711, 0x15332e92, 0x15231533, 0x35233523, 0xd66b0133,
-    0x2293876b, 0x822b2b2a, 0x01402702, 0x2febfe15, 0x52891101, 0x17825520,
-    0x8a2b2a21, 0x000a2293, 0x0d274116, 0x410a3554, 0x4c84082d, 0x4685de8b,
-    0x1f2b479b, 0x37170701, 0x37273717, 0x87270727, 0x34192647, 0x33331f34,
-    0x8b05841f, 0x3477244d, 0x82331e33, 0x82342002, 0x53002005, 0xc022066b,
-    0xb3658001, 0x000f2206, 0x82f78213, 0x821120df, 0x86272003, 0x21072607,
-    0x95012111, 0x20008280, 0x2b0382aa, 0x8001ab80, 0x80d580fe, 0x2a80d6fe,
-    0x0e820483, 0x11000022, 0x7b082b49, 0x2738115b, 0x2f002b00, 0x37003300,
-    0x3f003b00, 0x00004300, 0x33152337, 0x21352107, 0x777b0783, 0x82052007,
-    0x67052013, 0x272006e9, 0x03830b82, 0x07861720, 0x13870b8b, 0x2b2b6b23,
-    0x8387832b, 0x822a2006, 0xfe2b2204, 0x841082d6, 0x25048209, 0x562a2a56,
-    0x05822b2b, 0x2b2baa29, 0x552a2aaa, 0x84552b2b, 0x2b802205, 0x220f8255,
-    0x822a2b55, 0x2bab2307, 0x03822a2b, 0xc5822b20, 0x82802b21, 0x2bd52205,
-    0x820582d5, 0x054342c7, 0x01c12708, 0x000900c1, 0x0100000e, 0x012f3436,
-    0x010f2226, 0x07270717, 0xba013315, 0x06320606, 0x502a0612, 0x50d65015,
-    0x0a826a01, 0x86063221, 0x2e07410d, 0xef822120, 0x03820720, 0x03822720,
-    0xfb863720, 0x35210524, 0x0f861721, 0xff820320, 0x03821520, 0x07413720,
-    0x8713200a, 0x2013822f, 0x210b8203, 0xdb829501, 0xea82de84, 0xfe2b2b2a,
-    0xfe8001ab, 0x2a2aab80, 0x80210d82, 0x2200822a, 0x822b2b56, 0x825520e4,
-    0x202482eb, 0x2000892b, 0x29f3822a, 0x2ad52b2a, 0x2b2a2bd5, 0x04820001,
-    0x1b848020, 0x82abfe21, 0x2bab270a, 0x002b00ff, 0xd3410d00, 0x05eb600c,
-    0x23001f23, 0x0bcf4100, 0x82250021, 0x82152083, 0x82ab8203, 0x7d098291,
-    0xa783062f, 0x23210d82, 0x20158227, 0x83c38625, 0x4ecb83af, 0xbb83071d,
-    0x802b2b25, 0x82abab2a, 0x827e8202, 0x82a784a5, 0x822b207d, 0x2091850b,
-    0x20b7842a, 0x21ae8255, 0x27835501, 0x2bd52a23, 0x84bc8301, 0x84a8832c,
-    0x822b20ad, 0x2c8342af, 0xb7860120, 0x77411720, 0x82352006, 0x41112007,
-    0x3720068f, 0x01230782, 0x87231133, 0x8317831b, 0x86352013, 0x200f832b,
-    0x210b8215, 0xb4824001, 0x88852b20, 0x0b82be85, 0x6e41fe20, 0x220f8205,
-    0x882a562b, 0x55012500, 0xd52ad52b, 0x8022eb82, 0x0682fe2b, 0x82d52b21,
-    0x80012306, 0x0e822ad5, 0x15828020, 0x1784f683, 0x00820020, 0x77411520,
-    0x0da77e0c, 0x2c0b7b41, 0x0043003f, 0x004b0047, 0x0053004f, 0x83cf8700,
-    0x41032097, 0x07200683, 0xaf830786, 0x1b83bb83, 0x3f422720, 0x8b0b8306,
-    0x18eb8703, 0x83072741, 0x42df852f, 0xaa24075c, 0x2baa2a2a, 0x0b820086,
-    0x0c86e682, 0x42ab2b21, 0x0f830668, 0x0121e886, 0x200c822a, 0x83038280,
-    0x20e582d5, 0x8303822b, 0x820382e8, 0x2b2a2114, 0x00210b85, 0x056b5700,
-    0x290d7f44, 0x001b0017, 0x15233700, 0x03831733, 0x21112123, 0x20038201,
-    0x06034305, 0x07823520, 0x9284c020, 0xd6fe8024, 0xef422a01, 0x82012005,
-    0x83562053, 0x82d52084, 0x852a2076, 0x22948315, 0x82002b80, 0x2c174200,
-    0xe3411320, 0x43152006, 0x11200683, 0x17240782, 0x07231133, 0x830aab43,
-    0x4135201b, 0x1b420a63, 0x20238307, 0x20178213, 0x05f641eb, 0x1d425520,
-    0x057d4406, 0x82062f41, 0x07204296, 0x2b201783, 0x42057c43, 0x2b200608,
-    0x26051242, 0x2bd62b80, 0x6cd52a2b, 0x2b2107c4, 0x20c785fe, 0x14174208,
-    0x21001d25, 0x86210000, 0x8605208d, 0x26918707, 0x11331125, 0x42073521,
-    0x708206ab, 0x4500ff21, 0x2b250716, 0x2babfe2b, 0x08bc4201, 0x02827082,
-    0x80feab22, 0x6e821282, 0x202c3341, 0x20758625, 0x83078227, 0x237d83ff,
-    0x21352125, 0x4407cf45, 0x6f4207e3, 0x073b4107, 0x1b830783, 0x82074b43,
-    0x06ac458c, 0x01219c83, 0x228c8480, 0x422b2b2b, 0x6b420b6d, 0x2aab2909,
-    0x2bd52bd5, 0x2a2bd5fe, 0xd5250682, 0xd62b2b2a, 0x05c6452b, 0x20055d42,
-    0x451e822a, 0x25202e8f, 0x41061344, 0x756e05f3, 0x24b38705, 0x23113307,
-    0x831f8213, 0x86032023, 0x83c78727, 0x43138723, 0x2a430833, 0x2baa220a,
-    0x06d2442b, 0x82082f44, 0x2b2b21ea, 0x0120c183, 0x20098845, 0x86f1822b,
-    0x83c883d2, 0x201d84c0, 0x08975e00, 0x9601d62a, 0x14000b00, 0x26001d00,
-    0x4d0e7f58, 0x0887084a, 0x1e060728, 0x2e013e01, 0x8b580601, 0x5166200c,
-    0x182c05eb, 0x24181812, 0x09931818, 0x12211f09, 0x94580382, 0x4fbe200c,
-    0x802805c8, 0x19192418, 0x104a1824, 0x12222184, 0x4d180009, 0x3d2208bf,
-    0x7f820800, 0x53002f25, 0x74250000, 0x3720070b, 0x8505d457, 0x3e352a05,
-    0x17163201, 0x1e373615, 0x052e7a01, 0x26870720, 0x15160529, 0x23060714,
-    0x83012f22, 0x26272505, 0x013f3435, 0x36260583, 0x37011f16, 0x1d82013e,
-    0x01010f26, 0x1f2f1f48, 0x25330282, 0x1a273401, 0x2a0c0c2a, 0x0233271a,
-    0x0a0f0a01, 0x86201701, 0xc534210f, 0x013e2285, 0x05080440, 0x29050905,
-    0x06090628, 0x2f030705, 0x0f0d032f, 0x04292805, 0x2e040e0e, 0x45831894,
-    0x26171f34, 0x1a010134, 0x011a1616, 0x98263301, 0x070a0a07, 0x1087124e,
-    0x85273421, 0x27370823, 0x05090605, 0x36360704, 0x0a050407, 0x3f3e0505,
-    0x0b080605, 0x36360602, 0x090b0206, 0x003f0505, 0x00000300, 0xc601f0ff,
-    0x0b009301, 0x18000f00, 0x06370000, 0x48371707, 0x27080519, 0x37150307,
-    0x32363727, 0x22061416, 0x0a9a3426, 0x0cb57602, 0x220d1f0c, 0x6b7cf30d,
-    0x0d1107f1, 0xc20d110d, 0xb5320e0b, 0x1e291182, 0xe5fe0d0d, 0xcf2b6f7b,
-    0x22148206, 0x4a00110d, 0xd62e061b, 0x19009601, 0x00001d00, 0x16323313,
-    0x0484011d, 0x23061425, 0x65262221, 0x352a05d0, 0x35173634, 0x56d51523,
-    0x02821812, 0x2d07b44b, 0x56681856, 0x12189501, 0xea12192b, 0x04821912,
-    0x2b181328, 0x2b551812, 0xaf84002b, 0x01000022, 0x23205787, 0xb04b599f,
-    0x255f9205, 0x6f1e8d0b, 0x658c1e2d, 0x85191221, 0x8cf52565, 0x1e2c6e1e,
-    0x24206b90, 0x13206b9f, 0x9205546f, 0x6b2b246c, 0x8c405640, 0x24d1876b,
-    0x566aebfe, 0x216a8256, 0x04830300, 0x6ba0d788, 0x6f701720, 0x236bac05,
-    0x55556b40, 0x43065f4f, 0x0021056f, 0x080d7701, 0xda5b3e20, 0x0c37430d,
-    0xab2f3386, 0x0e009601, 0x22130000, 0x14011e07, 0x75160706, 0xd53b0570,
-    0x3a302f3b, 0x3b2f303a, 0x0303785b, 0x1c950178, 0x6078601d, 0x78021c1d,
-    0x84785b5b, 0x000025d2, 0x9601eaff, 0x0f203b82, 0x17223b86, 0x3c87010e,
-    0x1e22c028, 0x01015242, 0xa2654252, 0x95012806, 0x496d1609, 0x65166d49,
-    0x3f830591, 0x3f820220, 0xf201ce24, 0x7b82b201, 0x00001e2c, 0x3e272225,
-    0x27263401, 0xba843336, 0x35372508, 0x23072723, 0x15170715, 0x33371733,
-    0x00013735, 0x2921181d, 0x1d182129, 0x01014936, 0x47647549, 0x46466447,
-    0x402d0584, 0x4e3e0f0c, 0x010c0f3e, 0x49363649, 0x821587c6, 0x0000211b,
-    0x0b226389, 0x56181b00, 0x3f220d49, 0x628c2701, 0x84000121, 0x83428258,
-    0x845a865e, 0x18402060, 0x200ae854, 0x21768938, 0x5f8b0046, 0x16000622,
-    0x11205f82, 0x5a96bb84, 0x548d7520, 0x56840020, 0x0320508d, 0x24081341,
-    0x00140008, 0x0ba95724, 0x8c0b607c, 0x373521b8, 0x08746418, 0x2041c18b,
-    0x1501250a, 0x30483001, 0xd4200282, 0x2841c98a, 0x2477890c, 0x00170007,
-    0x26c9821a, 0x23072327, 0x41173337, 0x052c0f86, 0x31012733, 0x290f440f,
-    0x51452a45, 0xfe29628a, 0x6b1932f6, 0xc0c02a2a, 0x0a7f419c, 0x004e0e22,
-    0x28062341, 0x01bc01fc, 0x00090086, 0x29d18212, 0x011e0717, 0x16362707,
-    0xd2820717, 0x05833720, 0x9d012808, 0x04117a1e, 0x3514870e, 0x2621a419,
-    0x2d9f6806, 0x86014924, 0x35197a1e, 0x040e8714, 0x4921c311, 0x689f2d24,
-    0x44002705, 0xc122067b, 0x4b828101, 0x4b821820, 0x26273508, 0x17010f22,
-    0x05343637, 0x0e070622, 0x011e2301, 0x37013e33, 0xba012634, 0x0711061d,
-    0x06bf3bbf, 0x241bd5fe, 0x0e1b0101, 0x24182e0f, 0x01240130, 0x06061d5d,
-    0x072d1782, 0x1c24c211, 0x17141515, 0x1c243001, 0x06a34324, 0x4e01ab21,
-    0x37200553, 0x24099b70, 0x27262337, 0x324e1837, 0x07062707, 0x06331523,
-    0x0582011d, 0x05823982, 0x32011e2a, 0x35333736, 0x013d3623, 0x35260582,
-    0x01332734, 0x0082562b, 0x0f3c803b, 0x2f1e2318, 0x2f0e200e, 0x0f18231e,
-    0x2b022d3c, 0x3c2d022b, 0x3a483a11, 0x3f0c8611, 0x2a802bc0, 0x23101a80,
-    0x03032e1e, 0x10231e2e, 0x0b0b2a1a, 0x0b152b15, 0x231d2b0a, 0x0a2b1d23,
-    0x0b210c84, 0x28008200, 0xff000006, 0x01d601ea, 0x34fd82c0, 0x00190006,
-    0x0021001d, 0x01000025, 0x11073307, 0x17271121, 0x05955233, 0x07755518,
-    0x11013b26, 0x37153335, 0x25200382, 0x01270382, 0xe16b3601, 0x61ab5601,
-    0xc65c05d1, 0x40260805, 0xff552b6b, 0x8b016b00, 0xeafe2a36, 0x6b951601,
-    0xeafe1218, 0x12181812, 0x18121601, 0x5555ebfe, 0x6b969615, 0x7a824040,
-    0x08066f41, 0x5601c03a, 0x3c003100, 0x15250000, 0x22070614, 0x2e012f26,
-    0x011f0702, 0x22230706, 0x2e23012f, 0x26222701, 0x3e333634, 0x32013b01,
-    0x013f013e, 0x3217013e, 0x1e011d16, 0x37061401, 0x273e2f82, 0x37273436,
-    0x5501011e, 0x0902090c, 0x220f1a09, 0x011a1120, 0x072b0a01, 0x09041c03,
-    0x7884010c, 0x40090c28, 0x0f232411, 0x2282091a, 0x0c090c2e, 0x0e11620c,
-    0x1e12121e, 0x55c0110e, 0x033a2282, 0x100d1508, 0x04460104, 0x4e07010a,
-    0x18090c01, 0x0c091924, 0x160c1103, 0x0d820407, 0x0c01552f, 0x16150c12,
-    0x121e0f26, 0x0f1e1237, 0x20b78326, 0x2b048304, 0x9701ab01, 0x0c000300,
-    0x34001500, 0x2123bb82, 0x7e072135, 0x948205e0, 0x27230887, 0x5e151716,
-    0x3724053d, 0x1e153335, 0x3639c283, 0x3736013d, 0x07012e35, 0x01070626,
-    0x0100ff80, 0x120e2000, 0x12121c12, 0x250685ce, 0x0c150159, 0x96821509,
-    0x7c82aa20, 0x15210782, 0x058c5501, 0xeb6bd522, 0x20066758, 0x29078601,
-    0x26131d15, 0x090c0c09, 0x05831616, 0x1d13262a, 0x022136d5, 0x00362102,
-    0x22065741, 0x7d6b01eb, 0x072e0633, 0x07010e33, 0x16072722, 0x37013e17,
-    0x04822133, 0x63173221, 0x23340505, 0x95013717, 0x49014055, 0x1f1b2136,
-    0x60493328, 0x95fe4002, 0x562a0d8b, 0x55150155, 0x0f014936, 0x88831a1f,
-    0x55220989, 0xfd820055, 0xd5ff003a, 0xb601eb01, 0x1c000800, 0x00003300,
-    0x06021e13, 0x36342622, 0x17011e17, 0x15217282, 0x20e88221, 0x06ff6f27,
-    0x3632072c, 0x011e3335, 0x26343632, 0x94492123, 0x33372605, 0x09f51614,
-    0x3fcf8316, 0x36299f16, 0x14160101, 0x161480fe, 0x29360101, 0x17154060,
-    0x1e01201e, 0x161e1e2d, 0x1e16eafe, 0x012c0882, 0xb5011e20, 0x0f242805,
-    0x9e1d220a, 0x19272282, 0x7b7b0d2a, 0x82192a0d, 0x40402838, 0x17171e95,
-    0x842e1e1e, 0x23098202, 0x00020000, 0xab2c9b85, 0x27001b00, 0x35210000,
-    0x012b2634, 0x27210482, 0x05067723, 0x23011d24, 0x04820622, 0x2b08a382,
-    0x37363203, 0x07012f34, 0x011e1506, 0x1219c001, 0x40121915, 0x1813402a,
-    0x2b181315, 0x12ebd601, 0x24070118, 0x18010625, 0x40181355, 0x2a360c82,
-    0x1218012a, 0x55131840, 0x2b012b2b, 0x090d1218, 0x0d094040, 0x0b6a1812,
-    0x01c02b08, 0x000b00c0, 0x003f0023, 0x598a0100, 0x07271724, 0x65832206,
-    0x2726072e, 0x33161415, 0x3d363221, 0x26070601, 0x2b05fc47, 0x1507010e,
-    0x3f011e14, 0x32161701, 0x3e270483, 0x2e013d01, 0x84000101, 0x0724297c,
-    0x17741801, 0x163c1617, 0x32080482, 0x0c12181e, 0x09560109, 0x1e18120c,
-    0x6b2a6b08, 0x1801241b, 0x2d2e0b24, 0x2e0c220d, 0x18240b2e, 0x40012401,
-    0x0a0c1219, 0x0c0a3f3f, 0x17d51912, 0x82151517, 0x01012c03, 0x0c09620c,
-    0x0c62090c, 0x82aa0101, 0x1b2425b8, 0x01171221, 0x0b293183, 0x010c2e2e,
-    0x1b211217, 0x20b58224, 0x08734700, 0x2113dd50, 0x0d441300, 0x012b2506,
-    0x11352622, 0x2405ef65, 0x35331507, 0x97038633, 0xd695250b, 0x12181812,
-    0xd6250485, 0x2b2a2b2b, 0x21058b2b, 0x75559501, 0x562a220b, 0x05e75056,
-    0x20072d50, 0x05384c55, 0x28055f41, 0xc0010000, 0x0300ab01, 0x05d35600,
-    0x2135212b, 0x35231527, 0x22231523, 0x166a1806, 0x012b320b, 0x15230735,
-    0xfe950133, 0x402a01d6, 0x13152baa, 0x05237e18, 0x15121928, 0x2b6b6b15,
-    0x548296ea, 0xfe131825, 0x831912d6, 0x18132517, 0x006beb2b, 0x85088f44,
-    0x2500215f, 0x59945d9a, 0x277f5692, 0x20538508, 0x05294421, 0xb2843520,
-    0x0721b691, 0x20018227, 0x215b8517, 0xb68b2b15, 0x68174628, 0x2b44172d,
-    0xb7826bea, 0x5a182b20, 0xac200be0, 0x00221884, 0xef420400, 0x00052608,
-    0x002e0010, 0x3069823a, 0x07171533, 0x15213727, 0x3e352633, 0x17323701,
-    0x05b54105, 0x41013b21, 0x484507b0, 0x065a6305, 0x180e3721, 0x340a7c6a,
-    0x10342040, 0xd6fe5544, 0x54020e63, 0xfe1d233f, 0x181813d6, 0x08928413,
-    0x14191224, 0x54020116, 0x14361e40, 0x013a2c68, 0x2c2c3a01, 0x3b01013b,
-    0x1b1f3cab, 0x1deab927, 0x02543f23, 0x5441f20e, 0x2cac8206, 0x14821219,
-    0x54401e36, 0x14160102, 0x212c87d2, 0x9e822c2c, 0x0326b38b, 0x24001b00,
-    0xb3822800, 0x15213529, 0x17163201, 0x46010e11, 0xae860972, 0x15210132,
-    0x27012e21, 0x23053311, 0xc0013335, 0x2b01d5fe, 0x2d057d59, 0x1812d5fe,
-    0x2a161218, 0x95fe2bab, 0x0d832b01, 0x012b0123, 0x27008255, 0x2b01c0c0,
-    0x00ff1219, 0x01241e83, 0x2b191200, 0xfe290082, 0x18012b80, 0x80000112,
-    0x0a334155, 0x21227f83, 0x7f9d2a00, 0x27010f26, 0x05371737, 0x81958587,
-    0x395f3527, 0xfe482217, 0x208787e1, 0x26839355, 0x163a5fac, 0x85eb4822,
-    0x42002088, 0x27200e23, 0x11258582, 0x33131121, 0x107b4715, 0x13823520,
-    0x73570720, 0xfe95250b, 0x152bead6, 0x07506d18, 0x15131828, 0x2a6aaa2b,
-    0x02824040, 0x00012b26, 0x800100ff, 0x0cec6c18, 0x802b2b28, 0x40402b40,
-    0x4b43002b, 0x22738310, 0x42213521, 0x03201797, 0x22074b57, 0x42071707,
-    0xe023139d, 0x84163434, 0x34172202, 0x12a34234, 0x34d5fe23, 0x85198234,
-    0x207b8202, 0x43038204, 0x072407c7, 0x23001f00, 0x2323f182, 0x9a173315,
-    0x82072081, 0x2b01281f, 0xfe6a9696, 0x432a01d6, 0x3c250d1a, 0x2a95d6d6,
-    0x11194340, 0xe7909520, 0x00256b83, 0x23153337, 0x24699a05, 0x016b6b95,
-    0x22659100, 0x91556beb, 0x5ac78262, 0x56360723, 0x00000800, 0x07331513,
-    0x33153717, 0xf88dc035, 0x012af81e, 0x06822a55, 0x82d58d21, 0x065b4426,
-    0x76018926, 0x0c000300, 0x3725ef82, 0x33270727, 0x3a2d8215, 0x01273335,
-    0x1e491e6b, 0x1e744b82, 0x0d604b80, 0xc01e481e, 0x801e7377, 0x85006088,
-    0x01c0275b, 0x000a002b, 0x2f820100, 0x82233521, 0x3717295b, 0x77a2a201,
-    0x952bab62, 0xa2261982, 0x62ab2b77, 0x1e82c095, 0x01236483, 0x186b01ab,
-    0x200da751, 0x288682ab, 0x4d018dd5, 0xd58df81e, 0x8387892a, 0x00062327,
-    0x0565000f, 0x35172605, 0x3715012b, 0x2f5b8217, 0x312b0127, 0x313e1e3e,
-    0x653180d6, 0x6b01712a, 0x80200c84, 0xa2220c82, 0x638771b4, 0x4001c024,
-    0xc1821300, 0x012e3528, 0x06222123, 0xcc46011d, 0x35372f05, 0x6b013517,
-    0xff090c01, 0x0c0c0900, 0x05820109, 0xe0550123, 0x200b834b, 0x220483d6,
-    0x89ea554b, 0x82d6207f, 0x000722a7, 0x28458217, 0x35231527, 0x013f1533,
-    0x05537e21, 0x3e21172e, 0x34113501, 0x55800126, 0x2b55abab, 0x290a1967,
-    0xaa44446b, 0x01564444, 0xb85b1218, 0x9b4b180b, 0x00ab2408, 0x50110004,
-    0x17250531, 0x07032315, 0x2a4f8717, 0x21033717, 0x17153317, 0x82171537,
-    0x80220857, 0x50ab9b10, 0x0b0a2b1b, 0x3b011218, 0xfe2a1b2a, 0x0c2f55fc,
-    0x01185549, 0x010f9b15, 0x062b1b40, 0x5e840c13, 0x011b2a2d, 0x0c2e5665,
-    0x0155843a, 0x82181204, 0x000221b8, 0x01250082, 0x009601c0, 0x23b7830f,
-    0x23170713, 0x372efb88, 0x07113717, 0x2b012e35, 0x1b461701, 0xfe85103a,
-    0x4405073d, 0x0c01551b, 0x01ef8409, 0x0c3a1b95, 0x0c09d609, 0x011b4404,
-    0x094b551a, 0x4f00ef0c, 0x132c0ab7, 0x28001f00, 0x33130000, 0x33173337,
-    0x27053879, 0x012e2107, 0x36341135, 0x7018c482, 0x0882080f, 0x2206142d,
-    0x55363426, 0x2b802b40, 0x47181240, 0xbd200634, 0x290b076a, 0x3624241b,
-    0x6b012424, 0x27412a2a, 0x743f200e, 0x2d2208d7, 0xa9742a3d, 0x84032007,
-    0x01d623d3, 0x83830080, 0x83822720, 0x47470720, 0x18272010, 0x290c2768,
-    0x012f013f, 0xc017010f, 0xb1684427, 0x44122308, 0x828c4027, 0x1b3a3a2e,
-    0x013a3a1b, 0x12182b80, 0x191200ff, 0x22050c5f, 0x6ac0fe2b, 0x143d0a7a,
-    0x3b1a1b3b, 0x001b1a3b, 0x00050000, 0x01c0ff00, 0x00c00196, 0x00170007,
-    0x00240020, 0x2787822b, 0x012e1533, 0x13070622, 0x3b278e86, 0x35363201,
-    0x64263411, 0x1332082b, 0x2b353315, 0x15331501, 0xd6952737, 0x493c4904,
-    0x6248d604, 0x537d2008, 0x3d2a05cb, 0x6a6ac06a, 0x95014040, 0x00821be0,
-    0x470b0121, 0xab240b34, 0x18241801, 0xfe270282, 0x2a2a2aff, 0x8840402b,
-    0x82ab2087, 0x000f2487, 0x861c0018, 0x46212087, 0x2723098a, 0x76013e11,
-    0x37200826, 0x07207f82, 0x1e831082, 0x84230321, 0x01802187, 0x4205475e,
-    0x9220079e, 0x2a058b41, 0x01952a06, 0x01496c49, 0x8255556b, 0x82c0208c,
-    0x12562985, 0x01121919, 0x801912aa, 0x2f068741, 0x402b2b6c, 0x1e17f5fe,
-    0x0b01171e, 0x2a2bd5fe, 0x56188f84, 0x5108092f, 0x000c0007, 0x001b0014,
-    0x00280020, 0x16072500, 0x37363233, 0x011e0527, 0x012f3717, 0x1415010e,
-    0x23253317, 0x35013e17, 0x012e2734, 0x37010f27, 0x06222326, 0x25011707,
-    0x27181653, 0xfe4e1c44, 0x2e4210fb, 0x1a534d4f, 0x01a0041e, 0x1a6ca002,
-    0x1083091e, 0x85653421, 0x9080381e, 0x87171905, 0x11472f22, 0x1c904087,
-    0x15162a4a, 0x491dbb56, 0x832a162a, 0xb0202111, 0xab421c83, 0x000e240a,
-    0x8231001d, 0x2b698285, 0x37013e33, 0x16332734, 0x27010e15, 0x23288c82,
-    0x1407010e, 0x35262317, 0x23231682, 0x82072327, 0x1115230f, 0xcf431614,
-    0x1a002d08, 0x1b550f2c, 0x2d040124, 0x2d3d0102, 0xd8230c8b, 0x42802744,
-    0x552d0a4f, 0x01141601, 0x0a0b1b24, 0x3d2d0b0a, 0x200c8bd5, 0x10d54241,
-    0x43480020, 0x053f4205, 0x18000827, 0x23001c00, 0x975d1800, 0x42372009,
-    0x03200e3e, 0x21093542, 0x25420001, 0x42592005, 0x52200836, 0x26062f42,
-    0x18241940, 0x18192418, 0x210c4564, 0x274255fe, 0x00032508, 0x01c0ff00,
-    0x23072742, 0x1300001f, 0x4c0f2342, 0x342205db, 0x17421326, 0x20788516,
-    0x110f4203, 0x60562b20, 0xabfe2105, 0x55060242, 0x092a0a0b, 0x00001d00,
-    0x15233525, 0xc3823727, 0x41371721, 0x40261361, 0x804b4b80, 0x4d41204b,
-    0x3675240d, 0x824b4b36, 0x41ab2003, 0xcb83133b, 0xd601ea26, 0x0b00ab01,
-    0x2a068344, 0x32363426, 0x1416011f, 0x6e272206, 0x272405a7, 0x15011e37,
-    0x2205c456, 0x18011e33, 0x3d084976, 0x110d0669, 0x1a0d9706, 0x491e0d22,
-    0x1a010260, 0x211d1e17, 0x5b5b7802, 0x022a0278, 0xe1854960, 0x0639012b,
-    0x79060d11, 0x0d1a220d, 0x2614828d, 0x1e183d24, 0x642c4e1d, 0x4923059c,
-    0x43940160, 0x7b430683, 0x01ea3106, 0x00960180, 0x00130009, 0x001e001a,
-    0x37000026, 0x26368482, 0x3734013d, 0x17323717, 0x07062207, 0x17013e27,
-    0x27343507, 0x06821637, 0x85153721, 0x3739081e, 0x192418d5, 0x182b4f06,
-    0x150d2e15, 0x35123f04, 0x2d06509a, 0x5555111d, 0x55182419, 0x191912eb,
-    0x13142a12, 0x4d08a950, 0x173e0d0e, 0x2c505c1b, 0x194d090d, 0x555a56b6,
-    0x24a482ed, 0x00560212, 0x317f8204, 0x01c00100, 0x00030056, 0x0015000c,
-    0x3f000031, 0x70823301, 0x36342624, 0x5f181632, 0x37280adb, 0x012b012e,
-    0x010f0622, 0x2206d14f, 0x8821013d, 0x206b2b09, 0x0d2020ea, 0x121b1212,
-    0x5058f812, 0x04fc2f05, 0x0bea0b10, 0x0c2c0410, 0x0c091609, 0x06840001,
-    0x6060d523, 0x054b586a, 0xd5260585, 0x090c0c09, 0xc44fab80, 0x00ab2109,
-    0x30085358, 0x000b0080, 0x001b000f, 0x1300001f, 0x21112315, 0x05324c11,
-    0x15210724, 0x24612521, 0x0526080a, 0x55353315, 0x40d60140, 0x01955680,
-    0x0180fe80, 0x2b2b2b00, 0x00ff2a2a, 0x40800180, 0x2b01d5fe, 0x6b404040,
-    0x1383abd5, 0x2b211882, 0x06b36c2b, 0xc001c022, 0x5775ef88, 0x27212205,
-    0x08366b23, 0xf5672320, 0x16142605, 0x14151725, 0x05dc7306, 0x0986ec82,
-    0x013e372a, 0x1632013b, 0x17163227, 0x2305e37d, 0x17013e27, 0x262a0b82,
-    0x36270722, 0x202a016b, 0x0341eaea, 0x41dd2005, 0x01210511, 0x05044117,
-    0x0441ff20, 0x412c2005, 0x90380519, 0x1f193e22, 0x2e342e12, 0x3e181e12,
-    0x1e192322, 0x1e0d220d, 0xca609519, 0x410c2041, 0x802a0c1c, 0xb70c0c09,
-    0x121e181a, 0x34821313, 0x01551a22, 0x33823482, 0x0700002a, 0xd5ff0000,
-    0xaf01c001, 0x3d24d388, 0x55004900, 0x2c1ac941, 0x010e2327, 0x1415010f,
-    0x3e331716, 0x05c94101, 0x25200985, 0x4d050374, 0x3523070a, 0x8227012e,
-    0x2227820b, 0x8737013e, 0x26ed410b, 0x0ed5fe26, 0x021c0212, 0x01220282,
-    0x0a877812, 0x0d791224, 0x15850112, 0x60ab1227, 0x1c126b60, 0x30028812,
-    0x010b0ad5, 0x800a0b01, 0x010c09aa, 0x15090c01, 0x29078515, 0x1201c0aa,
-    0x0226120d, 0x06822602, 0x0b960120, 0x2d066b57, 0x0096015c, 0x25000033,
-    0x14062307, 0x05863317, 0x010e2208, 0x012f2622, 0x27343633, 0x36342723,
-    0x3e262737, 0x011f1601, 0x32363435, 0x37011d16, 0x011e013e, 0x0803820f,
-    0x04550132, 0x2d0a0a31, 0x0a0a2c16, 0x18010828, 0x15011824, 0x240a0a20,
-    0x1e171a11, 0x110f0305, 0x120c0a05, 0x1106200c, 0x2d06010e, 0x16eb1815,
-    0x6b011301, 0x2b240382, 0x12181812, 0x563b0883, 0x2b071f13, 0x030a1108,
-    0x09260e07, 0x31090c0c, 0x0c020725, 0x08360711, 0x4400001e, 0xc1200567,
-    0x275b9b82, 0x6d002005, 0x013d0892, 0x07173315, 0x16141506, 0x23352117,
-    0x3f343522, 0x36323301, 0x3536013f, 0x21272634, 0x08607227, 0x6b012108,
-    0x24191813, 0x98fe1818, 0x051d4d2b, 0x00011218, 0x130105f7, 0x06130c9f,
-    0x090c034c, 0x3a14c4fe, 0x24268682, 0x18401919, 0x02821825, 0x2a550139,
-    0x0b0935a2, 0x2b011812, 0x23010205, 0x058a0a0c, 0x010c0905, 0x85abfe2a,
-    0x8200201f, 0x67042000, 0x082908e7, 0x2e002500, 0x00003200, 0x06b05a25,
-    0x33013637, 0x011e2117, 0x010f1415, 0x012b010e, 0x3b14010f, 0x2e211501,
-    0x229e8301, 0x87132327, 0x013f2525, 0x6b011721, 0x73827882, 0x46bdfe3c,
-    0x093c0114, 0x064c030c, 0x139f0c13, 0xfff70501, 0x05181200, 0x802b4d1d,
-    0xb9831912, 0xfe3cd225, 0x834032f2, 0x18252109, 0x01349e82, 0x0505090c,
-    0x230c0a8a, 0x012b0503, 0x090b1218, 0xd5fea235, 0x95221d85, 0x9f896b6b,
-    0xab01c430, 0x14000b00, 0x37001d00, 0x33130000, 0xa14d3335, 0x33152205,
-    0x07654603, 0xe85c3320, 0x063b4108, 0x23072724, 0x56412327, 0x4eeb200c,
-    0x56200511, 0x20052341, 0x209085c4, 0x053f41e4, 0x52255225, 0x41465b96,
-    0x04290855, 0x2b400001, 0xff2b4040, 0x05054700, 0x45280585, 0x0a0c2303,
-    0xc0961595, 0x21085641, 0x9f480000, 0x00802607, 0x001b000d, 0x8761181f,
-    0x34252707, 0x35012b26, 0x81822636, 0x35361623, 0x230d8327, 0x011d0622,
-    0xb382b982, 0x0521bd82, 0x09c65b15, 0x35333729, 0x15173337, 0x5f011e33,
-    0x152c050f, 0x13ab0123, 0x0e022b18, 0x1318551e, 0x05820982, 0x2b552b27,
-    0x0156562b, 0x08e15b00, 0x2a562a22, 0x2008c782, 0xd52b2b80, 0x18955555,
-    0x06101513, 0x171401c0, 0x1313186b, 0x40409518, 0x552a0001, 0x181812eb,
-    0x29048212, 0x2b2b2a01, 0xbd18012a, 0x074e2b40, 0x0040360c, 0x000c0003,
-    0x1300001c, 0x37211121, 0x0614011e, 0x36342622, 0x31958227, 0x15163215,
-    0x33363433, 0x35262235, 0xfe800140, 0xc149c080, 0x18502505, 0xd6181212,
-    0x01240483, 0xc000ff40, 0x2306b449, 0x56181216, 0x04821383, 0x00080022,
-    0x01230082, 0x825601d6, 0x00072c5b, 0x00230017, 0x0038002c, 0x85480041,
-    0x35253765, 0x14251521, 0x22153316, 0x34231506, 0x32352326, 0x35173536,
-    0x3f4c012e, 0x36323405, 0x15171627, 0x35272206, 0x34350736, 0x07062226,
-    0x8b011e15, 0x35332a14, 0x37150723, 0xfeaa012b, 0x22958256, 0x881601aa,
-    0x56d6208f, 0x1f2b0609, 0x13010109, 0x122c0101, 0x8301121b, 0x0a202112,
-    0x29080f84, 0x16151541, 0xfe550116, 0xebeb2bc0, 0x6b1812d5, 0x19121219,
-    0x6a12186b, 0x18181215, 0x19121512, 0x09013c19, 0x2b0a0a2b, 0x11902909,
-    0x0b6b542d, 0x04000a15, 0xeaff0000, 0x4101eb01, 0x22200733, 0x2d173541,
-    0x3533013e, 0x05272622, 0x15211533, 0xa5826b21, 0x1bc08028, 0x24372424,
-    0x73834f24, 0x8301d521, 0xfe0123b1, 0x8c822b80, 0x44418020, 0xd62a2216,
-    0x08674a2a, 0x09826b20, 0x33001329, 0x21250000, 0x4e352111, 0x032b0e19,
-    0x32333533, 0x34013d36, 0x43012b26, 0x4941070f, 0x013b2a05, 0x33152315,
-    0xaafeab01, 0x0b527501, 0x162ad229, 0x090c0c09, 0x882b5540, 0x01402308,
-    0x204d2b00, 0xebfe220e, 0x24238216, 0x2a160c09, 0x47088716, 0x07310a8b,
-    0x14000f00, 0x00002700, 0x011e1537, 0x012e3317, 0x2b078807, 0x01263433,
-    0x07062221, 0x21353315, 0x099c7218, 0x6c52153c, 0x84032b02, 0x013c2e64,
-    0x4054022b, 0x8f012440, 0x181280fe, 0x80012b01, 0x07829595, 0xeb18013c,
-    0x526c022b, 0x2a538464, 0x402d3d01, 0x1b405454, 0x18410124, 0xfe404013,
-    0x3d532bd6, 0x00002305, 0x00820005, 0x01eb012f, 0x00120080, 0x0021001a,
-    0x002e0029, 0x206c9200, 0x218c8605, 0x08842125, 0x9b8c2520, 0x778ec020,
-    0x8543fe21, 0x1c01299a, 0x5d40d6fe, 0x80fe7815, 0x8020a389, 0x9520808c,
-    0x4325a185, 0x405e1523, 0x21a68940, 0x236d0000, 0x01eb2905, 0x001d00ab,
-    0x37000026, 0x8307fe55, 0x35373c07, 0x15071733, 0x35231117, 0x0622012e,
-    0x01231507, 0x011d010e, 0x26343533, 0x832b2a2b, 0x2a403302, 0xea405656,
-    0x18241801, 0x55016a01, 0x0c2a0c09, 0x00832bab, 0x80406b22, 0x40331f82,
-    0x124000ff, 0x40121818, 0x0e010001, 0x0b26260b, 0x4100000e, 0xd4220687,
-    0x6d826001, 0x002f2008, 0x00550038, 0x2e070100, 0x010e2701, 0x0f010e17,
-    0x17371701, 0x1e371707, 0x37363201, 0x83273717, 0x211b8203, 0x1e822636,
-    0x45010f21, 0x332007ac, 0x072d0887, 0x011e0733, 0x35363233, 0x07061433,
-    0x22248322, 0x82012e23, 0x8216200c, 0x37290813, 0x0f1c0001, 0x18042743,
-    0x010b091b, 0x03250529, 0x131f0a21, 0x13556e55, 0x03210a1f, 0x01290525,
-    0x181b090b, 0x0f432704, 0x05786f5c, 0x06858920, 0x2a4c4008, 0x0b10040f,
-    0x190b120e, 0x06130c12, 0x120c1306, 0x0e120b19, 0x0104100b, 0x37130215,
-    0x40520103, 0x070f140d, 0x140f0615, 0x28271313, 0x13132728, 0x15060f14,
-    0x0d140f07, 0x03015240, 0x703e1337, 0x0585055d, 0x0b1d402e, 0x120e120d,
-    0x0a0c0118, 0x18010c0a, 0x0d220a82, 0x0082000b, 0x00000233, 0x9601d5ff,
-    0x0300ab01, 0x00001300, 0x33112325, 0x07634d35, 0x33513320, 0xd66b2106,
-    0x2309054f, 0x562a012b, 0xfe203e82, 0x820acc6d, 0x22438939, 0x85170007,
-    0x23032445, 0x8f133335, 0xe0702b49, 0x565645e0, 0x241caa2a, 0x04831c24,
-    0x2b014025, 0x821595fe, 0x1b242f7e, 0x241baafe, 0x1b240101, 0x241b5601,
-    0x33580000, 0x016b2206, 0x214f8296, 0x0d69001b, 0x003f270f, 0x06220100,
-    0x884d011d, 0x11372c0a, 0x35272634, 0x33072634, 0x82152315, 0x586d1803,
-    0x370b9608, 0x0c094001, 0x18181256, 0x18126b12, 0x0c0a0c01, 0x166b6b74,
-    0x15152b16, 0x56200282, 0x01260890, 0x40090c95, 0xf1551318, 0x130c2707,
-    0x0c094606, 0x2b826a80, 0x15151523, 0x82038216, 0x83162002, 0x060b4100,
-    0x4f418020, 0x00172506, 0x35232500, 0x50085141, 0x0320076f, 0x01371182,
-    0xaaaaaa55, 0x12191813, 0x191912aa, 0x80aaaabc, 0x180156d5, 0x83d5fe12,
-    0x2b012492, 0x46fe1812, 0xff22085f, 0x4f8501d5, 0x1c000c22, 0x11234f83,
-    0x4c220333, 0x60410645, 0x1137280b, 0x5501012e, 0x4b60c0c0, 0x4830051e,
-    0x1e1e17ab, 0x1e16ab17, 0x401e0101, 0x80fe2b01, 0x2705004b, 0x1e01c001,
-    0x1796fe17, 0x17261683, 0x1e176a01, 0x1f450000, 0x00022205, 0x051f4501,
-    0x63832020, 0x37333523, 0x05324623, 0x3405bf4a, 0x21252634, 0x010e2135,
-    0x1523011d, 0x01233521, 0x165555d5, 0x05474a80, 0x0c240682, 0x800161fe,
-    0x182a6182, 0xd62b012b, 0x0c2a9655, 0x1b85d509, 0x2b210682, 0x22d6822b,
-    0x824040eb, 0x00043367, 0x02e3ff00, 0x009d0100, 0x00150012, 0x00240020,
-    0x65840100, 0x33351724, 0x68882315, 0x03231724, 0x435b1707, 0x37172705,
-    0x17213513, 0x6382eb01, 0x552b0127, 0x0904402e, 0x386b820c, 0x1b2ce5e5,
-    0x012b0a27, 0x0e1b327a, 0x012bbcfe, 0x59090c15, 0x40966f2b, 0x31778401,
-    0x4801e525, 0x100b271b, 0x1b3240eb, 0x2b2b4201, 0x0b520000, 0x01802205,
-    0x20e982c0, 0x064f4213, 0x2306e942, 0x11150622, 0x2605ad4b, 0x26341135,
-    0x68353303, 0x0126087f, 0xaaaaaa55, 0x9f411912, 0x2b273305, 0x2a2a552b,
-    0x6b2b2b56, 0x19550001, 0x12abfe12, 0xd6820118, 0x12550126, 0x2b00fe19,
-    0xde820083, 0x22084b79, 0x84140080, 0x002825dd, 0x1300002c, 0x23054446,
-    0x37153317, 0x3e33e682, 0x34013d01, 0x17072326, 0x07171537, 0x35072715,
-    0x42273727, 0x152006b0, 0x55280782, 0x12181812, 0x2b4040ab, 0x40200786,
-    0xab2b0084, 0x40406b6b, 0x80016b6b, 0x82d51318, 0x406a2378, 0x7c826a40,
-    0x1912d532, 0x4a2a2a2b, 0x2b4b2020, 0x20204b2b, 0x2b2b2a4a, 0x2d05036f,
-    0xd601eaff, 0x1a007801, 0x00001e00, 0xd0821501, 0x23154c08, 0x23272317,
-    0x23372307, 0x37012f26, 0x011f1636, 0x35233733, 0x2733010f, 0x4a6ad501,
-    0x2f502134, 0x3016b914, 0x050f0558, 0x0f091444, 0x4a5d3903, 0x8f2d354c,
-    0x2a550127, 0x2aaa2b6b, 0x0e01aa2a, 0x080307ca, 0x2a6ba709, 0x455555c0,
-    0xc0260837, 0x07008001, 0x075d0f00, 0x27253505, 0x3337013e, 0x3527010e,
-    0x2317011e, 0x1407012e, 0x35260717, 0x15271382, 0x2217010e, 0x82372726,
-    0x32490816, 0x01061737, 0x14102b59, 0x2c035603, 0x065e4767, 0xa22f0456,
-    0x02134a08, 0x30254960, 0x194e305f, 0x18280d4a, 0x262b1215, 0x220c4a1e,
-    0xf5492d15, 0x475e0656, 0x14712f22, 0x2c252b12, 0x5606654b, 0x2cdb3505,
-    0x14122b25, 0x20348201, 0x20008200, 0x22048401, 0x828c01d6, 0x002f0885,
-    0x21113725, 0x37113311, 0x07173717, 0x37330727, 0xfe617401, 0x8a762a56,
-    0x8b70255b, 0x7c5e307e, 0x01dcfea8, 0xccf4fe80, 0xc1169d51, 0x84a1da50,
-    0x08a7543a, 0x00000f24, 0x3d820129, 0x33353324, 0x07853315, 0x82d50121,
-    0x552b213e, 0x37820183, 0xc0c0ab28, 0xebfe1501, 0x7385006a, 0x0b23fb83,
-    0x82130000, 0x3231832d, 0x21153315, 0x55552b40, 0x80fe5556, 0x80d58001,
-    0x8d805556, 0x000c215f, 0x97839f82, 0x84152121, 0x550121a4, 0x66219683,
-    0x26a28401, 0xc1159cc5, 0x822bb050, 0xcbca2365, 0x38840400, 0x04245f83,
-    0x10000900, 0x25054d45, 0x07011e35, 0xd6820614, 0x26222708, 0x06173727,
-    0x37013e27, 0x01260715, 0x6049abc0, 0x52232929, 0x184a2d0c, 0xd423508b,
-    0x99496002, 0x02abd512, 0x10827360, 0x29ab8f2d, 0x128a5023, 0x016148ab,
-    0x8822589e, 0x004926b7, 0x09000005, 0x2a468201, 0xffc00137, 0x571e7500,
-    0x852b01e2, 0x05074407, 0x01f90123, 0x29098249, 0x000d0009, 0x37173700,
-    0x76822527, 0x23011736, 0x09170727, 0x01771e77, 0x1f59e1b3, 0x79000178,
-    0xa21f881e, 0x89220f82, 0x148259e2, 0x881e0023, 0x41b7821e, 0x0f21091b,
-    0x05601800, 0x08b47e08, 0xd6fe9522, 0x21082d5d, 0x245d8001, 0x663a820b,
-    0x325c0e07, 0x3a7e180b, 0x0d07660b, 0x26052f48, 0x009601d6, 0x6517000b,
-    0x77180d27, 0x00200c7d, 0x2016c576, 0x178f7615, 0x240a9757, 0x000f0080,
-    0x24cd9113, 0x11211107, 0x22d18b01, 0x8dd6fe12, 0x822b20d4, 0x002a2410,
-    0x82000200, 0xc0012f00, 0x05008001, 0x00001500, 0x17372737, 0x88181737,
-    0xd5250f6d, 0xa24c1e6a, 0x0a1f411e, 0x826b5521, 0x6b1f2110, 0x890e2441,
-    0x000522ef, 0x204b8711, 0x0a2b4127, 0x95204785, 0x850aa877, 0x77802048,
-    0x43180a6b, 0x17230c5f, 0x18001d00, 0x240aeb67, 0x26371732, 0x274f8823,
-    0x37170725, 0xab010727, 0x24082541, 0x25211718, 0x275c882b, 0x601ed4fe,
-    0xc0b71ed5, 0x22085c41, 0x880f2207, 0x84292067, 0x0c47411b, 0x18001222,
-    0x21236b82, 0x58353311, 0x3d230a0c, 0x85272301, 0xfe952466, 0x42d5d5d6,
-    0x2b210720, 0x233f84ec, 0x2b2a012b, 0x21070341, 0x128414aa, 0x274a5282,
-    0x01d62406, 0x840f0096, 0xbc791853, 0x21332509, 0x03151632, 0x2e08e476,
-    0xff1218d5, 0x18181300, 0x12000113, 0x82ff8018, 0x6b2a2204, 0x06395812,
-    0xfe12182a, 0x12182aaa, 0xeafe1601, 0x03215383, 0x05af6400, 0x03009626,
-    0x1c001300, 0x20052b5d, 0x23599821, 0x0100ffab, 0x5d903d82, 0x58000121,
-    0x618c099b, 0xb3835f89, 0x5f821e20, 0x3f265b97, 0x27072701, 0xbb920107,
-    0x1e96c025, 0x931e4278, 0x968024c1, 0x8241771e, 0xeb6a1854, 0x0012240b,
-    0x82210018, 0x33352167, 0x27061b4f, 0x36341135, 0x2315013b, 0x20062345,
-    0x08264117, 0xc988ab20, 0x3eaaaa28, 0xaa1e8c42, 0x2b418a60, 0x80802105,
-    0x29072d41, 0xbe00ff2a, 0xaa1f8d42, 0x3341f660, 0x09db420a, 0x0b00032f,
-    0x21130000, 0x15132111, 0x35331533, 0x05e84e23, 0x95952b22, 0x20053c54,
-    0x2f088255, 0x07000095, 0xf0ff0000, 0x9601eb01, 0x1e000f00, 0x2206df7d,
-    0x82500047, 0x012e2139, 0x0805ca6c, 0x07061425, 0x07222615, 0x37012e17,
-    0x17373627, 0x1e17013e, 0x25010e01, 0x37171636, 0x16071716, 0x2e060706,
-    0x18253601, 0x32075582, 0x2e270717, 0x1e352701, 0x22060701, 0x32163727,
-    0x46012f37, 0x07210571, 0x2e4418eb, 0x0a240808, 0x129b0a16, 0x10340310,
-    0x280f3406, 0x1c0e1712, 0x129cfe31, 0x06340f28, 0x10033410, 0x1b321812,
-    0x0109010d, 0x3905b559, 0x021f0141, 0x231c0d11, 0x1b481b2b, 0x0f220f1f,
-    0x2301018a, 0x02110d1c, 0x44181901, 0x21080958, 0xdf03033c, 0x1e14240b,
-    0x0d1e160f, 0x310f0a04, 0x0a7c0d2f, 0x161e0d04, 0x24141e0f, 0x2f0d0d0b,
-    0x0d513632, 0x0c123705, 0x0a1c1113, 0x78330d24, 0x07121514, 0x220c3707,
-    0x0a240d33, 0x0f44111c, 0x01802906, 0x00050049, 0x0100000b, 0x372dc382,
-    0x2707021f, 0x62011737, 0x1e80801e, 0x21058562, 0x0c844901, 0x05841e20,
-    0x8206f342, 0x0189222d, 0x25378640, 0x37170727, 0x0482022f, 0x89012722,
-    0x2a852484, 0x8a220121, 0x20378944, 0x21378796, 0x70823713, 0x82023f21,
-    0x77372104, 0x02213698, 0x23008200, 0x56018001, 0x37206b85, 0x07229c82,
-    0x3983022f, 0x5d8a9e20, 0xa18c3720, 0x2205fb45, 0x82090180, 0x13002233,
-    0x842c8417, 0x090121cb, 0x51820684, 0x20068346, 0x238b8449, 0x37272500,
-    0x0121c382, 0x201d8449, 0x20238e5e, 0x21238556, 0x7a83013f, 0x228bb720,
-    0x16206787, 0x3f226783, 0x44821701, 0x1f849e20, 0x05847720, 0x2908b75d,
-    0x001b0096, 0x00250020, 0xd7601300, 0x15172305, 0x3b4e1527, 0x07352a08,
-    0x23353735, 0x33033335, 0x83838235, 0xeb330804, 0xc02b2b2a, 0x1801802a,
-    0x80011824, 0x2b2bc02a, 0x15162b6b, 0x16152bd5, 0x2b2a9501, 0x112b4c49,
-    0x19126aa6, 0xa66a1219, 0x494c2b11, 0x6baafe2b, 0x826b1515, 0x0bdf4503,
-    0x14000b22, 0x300d2b70, 0x17160607, 0x26273616, 0x52000106, 0x6c02026c,
-    0x2a058452, 0x361f1f2f, 0x382c833f, 0x87800173, 0x25188212, 0x21733873,
-    0x1b82e20f, 0x00820020, 0x03820a20, 0xc0010022, 0x0e2f6118, 0x2005054d,
-    0x09e5692c, 0xc1822720, 0x3320d382, 0x0f8b0387, 0xd8823720, 0x11231524,
-    0xbf823521, 0x2a2a2a23, 0x05287380, 0xab2a0888, 0x01804040, 0x802b8080,
-    0x2f74d62a, 0x2a80290a, 0x40408080, 0xd5d5fe2a, 0xab2cd789, 0x1e001500,
-    0x23010000, 0x0622012e, 0x200fc65d, 0x08d95423, 0x0759952d, 0x07202a20,
-    0x19191259, 0x822a0112, 0x4ea72005, 0x012705c3, 0x17171380, 0x65121913,
-    0x12210711, 0x058e4e19, 0x2808e748, 0x000700ab, 0x00190010, 0x18d7822f,
-    0x87103d8d, 0x9433205e, 0x8001297d, 0x580400ff, 0x80045848, 0x20055053,
-    0x2072851b, 0x2a8a8f9e, 0x22201e2b, 0x01e22022, 0x82243724, 0x06407e02,
-    0x0020968f, 0x240ad74a, 0x000800ab, 0x2095820c, 0x23f78226, 0x3634012e,
-    0x17208683, 0x20066c41, 0x208a9513, 0x217b8500, 0x00822a0c, 0x808f8020,
-    0x01550122, 0xc125f585, 0x012bd580, 0x207a9015, 0x08b76203, 0x0f000625,
-    0x18002500, 0x9e08b771, 0x6b0025ff, 0x6b405640, 0x4024f596, 0xd555556b,
-    0x70907685, 0x870ca763, 0x15232673, 0x33153727, 0x22739e27, 0x826b5555,
-    0x25739658, 0x6a6b4080, 0x7498ab40, 0x0524e789, 0x24000e00, 0x9d08c148,
-    0x55d52672, 0x1e8d371e, 0x26729680, 0x371e5655, 0xa2801e8c, 0x5b152073,
-    0xc94205ff, 0x3307281e, 0x21113335, 0x42013311, 0x622517d1, 0xd6fe2ad6,
-    0x17d7422a, 0x1c825520, 0x002a0124, 0x63530000, 0x01c02305, 0xa77b00ab,
-    0x00142105, 0x01201582, 0x20064442, 0x20078207, 0x22f59d03, 0x82d66b01,
-    0x96402300, 0xf8962b96, 0x2b000128, 0x2b802a80, 0xfa980001, 0x37068f4e,
-    0x00960179, 0x003c001d, 0x0067005e, 0x25000070, 0x2622010e, 0x013e3527,
-    0x2305a467, 0x013d3632, 0x25067d47, 0x07061415, 0x51183227, 0x322907da,
-    0x34353736, 0x17163236, 0x84308515, 0x07372324, 0x24822326, 0x79741a82,
-    0x17162705, 0x22272607, 0x10822707, 0x21056256, 0x42181716, 0x272007a0,
-    0x012b0887, 0x2d1e0140, 0x0901011e, 0x8201090d, 0x120e29ab, 0x1b2a1a01,
-    0x15900e12, 0x01230482, 0x84273b27, 0x3a012418, 0x83013956, 0x0a3c3d1a,
-    0x111e100d, 0x0124151a, 0x012d442d, 0x111a1524, 0x0a0d101e, 0x291b0c0b,
-    0x640c011b, 0x2a0c1f53, 0x1e1e1675, 0x09062616, 0x82260609, 0x4d092c17,
-    0x120e1605, 0x0e121818, 0x84530516, 0x1d722505, 0x4b1d2828, 0x4b251f83,
-    0x2b39392b, 0x3e1f8472, 0x01071f28, 0x071a1314, 0x2d2d2201, 0x1a070122,
-    0x07011413, 0x0102051f, 0x151b1b15, 0x83470201, 0x86a8838c, 0x3b741807,
-    0x001d230f, 0xb15b2500, 0x011e2408, 0x82011e13, 0x2e072cef, 0x013e2701,
-    0x07171517, 0x4c013527, 0x6623176b, 0x4c701060, 0x792a146f, 0x68785b5a,
-    0x441b3970, 0xa7500080, 0x01c02f05, 0x000b00ab, 0x001d0017, 0x00290024,
-    0x8f4b0100, 0x012e2108, 0x0c358718, 0x37171527, 0x15173527, 0x2d018221,
-    0x33153137, 0x00012335, 0x0101553f, 0x05834054, 0x2c3f5527, 0x3a01013a,
-    0x2d05842c, 0x34104417, 0x0100ff35, 0x2b2b5500, 0x8518ab01, 0x2c220abb,
-    0x21853b01, 0x3b2c2c33, 0x1c284e27, 0x40ea3c1e, 0x5555402b, 0x060000ab,
-    0x23008200, 0x6b01eb01, 0x26248b86, 0x38002f00, 0x640ddf46, 0x33200c45,
-    0x0529fe83, 0x36342622, 0x17163337, 0x2e088327, 0x1707013b, 0x34012e27,
-    0x06013b36, 0x4c400107, 0x02220827, 0xf2714960, 0x204b240a, 0x653b1631,
-    0x512b05db, 0x09550f0a, 0x2c090c0c, 0x83170101, 0x0f402407, 0x186b010a,
-    0x2c16bb87, 0x1732502a, 0x120c773b, 0x1417010c, 0x2306826b, 0x016a1515,
-    0x14210682, 0x08835b17, 0xb0019622, 0x122dc582, 0x24001e00, 0x07130000,
-    0x35330717, 0x41b28c07, 0x37290dbc, 0x1e2f3527, 0x276b2655, 0x0945417c,
-    0x41405421, 0x012d0e45, 0x27551eaf, 0x0145266b, 0x54404054, 0x20058401,
-    0x0765412d, 0x3a2c2c28, 0x1c274f26, 0xdf583c1e, 0x89ab2008, 0x1701277f,
-    0x17371707, 0xcc410735, 0x8001231c, 0x5f825526, 0x809beb20, 0x8227ab21,
-    0x6b262222, 0x20819d96, 0x21838400, 0x836101c0, 0x00172405, 0x4228001d,
-    0x072a1f49, 0x21353315, 0x15273715, 0x48423521, 0x2bb6271c, 0x55550001,
-    0x484200ff, 0x40ab271f, 0x40565540, 0x00820040, 0x04840120, 0x56019637,
-    0x00000b00, 0x27072701, 0x17071707, 0x27371737, 0x771e9501, 0x21028777,
-    0x0c8a3701, 0x220a374f, 0x4f1b000f, 0x0320117f, 0x4b4f4582, 0x17072105,
-    0x07547018, 0x122a0127, 0x4d5a1919, 0xad6b184d, 0x63012008, 0xd5200d6c,
-    0xeb501a8a, 0x01c02806, 0x000f0080, 0x921f0013, 0x11212461, 0x18010f21,
-    0x21075b91, 0x658c3717, 0xd6fe1225, 0x992a2a01, 0x01ab236a, 0x1d8a482a,
-    0x220c734f, 0x4317000b, 0x10410e47, 0x01372109, 0x200bed50, 0x50428aa8,
-    0x68200cf9, 0x8f185b8d, 0x23200d8f, 0x21190951, 0x7a41010f, 0x20698208,
-    0x868f1848, 0x4f482009, 0x022508d5, 0x37372478, 0x2302871e, 0x48610215,
-    0x47182687, 0x7e200cb1, 0x002d248a, 0xff000002, 0x01d601d5, 0x000b0080,
-    0x89db8233, 0x013f31cf, 0x011d1632, 0x23070614, 0x011e3315, 0x23153315,
-    0x2e340b83, 0x35233501, 0x37363433, 0x2e233533, 0x34013d01, 0x37013336,
-    0x1626508a, 0x12181812, 0x9b181656, 0x56200d07, 0x01211483, 0x22268340,
-    0x82381e38, 0x5e372c02, 0x12d51219, 0x012a0118, 0x562a090c, 0x0683056e,
-    0x1a552a20, 0x50002005, 0x072e0c7b, 0x00001300, 0x17150713, 0x27353733,
-    0x93181707, 0xb0260934, 0x70a07070, 0xc9419d70, 0x2211830c, 0x415570a0,
-    0xd9821063, 0x8909f354, 0x1733274d, 0x27230715, 0xd4423735, 0x27372207,
-    0x2c558507, 0x57577c8e, 0x1f58577c, 0x3d1f3e3e, 0x2105843d, 0x5b858001,
-    0x17822b20, 0x1e7c5722, 0x1c821687, 0x31088f42, 0x0017006b, 0x003f002f,
-    0x35232500, 0x35331523, 0x29631533, 0x35272705, 0x013b013e, 0x6b821632,
-    0x0e211786, 0x05416301, 0x83363421, 0x37172117, 0x280ecf5c, 0x2b208001,
-    0x090c202b, 0x051a4140, 0x95200682, 0x01201083, 0x04841184, 0x52aa0121,
-    0xd5290a71, 0x160b400b, 0x090c0c09, 0x20048356, 0x200d8c16, 0x0ed35c80,
-    0xd3430020, 0x00022507, 0x12006b01, 0x21056f42, 0xdc44010e, 0x212c0806,
-    0x2e37013e, 0x0c9d0101, 0x4a2f3b56, 0x01403115, 0x01364901, 0x013c2e15,
-    0x38ea3801, 0x2e010148, 0x33460727, 0x01024836, 0x3b2b2d3d, 0x8405e743,
-    0x00052347, 0x1f530018, 0x06126306, 0x85052c45, 0x4ad5264f, 0x1e6f2c1e,
-    0x2654923b, 0x2c1e4b55, 0x91081e6e, 0x255b835a, 0xd601eaff, 0xa3829601,
-    0xa5821e20, 0x26222326, 0x33373634, 0x1e279f82, 0x32331701, 0x54061416,
-    0x60310c26, 0x24241cb5, 0x2d07031c, 0x0130241e, 0x1e1e170b, 0x0a154377,
-    0x37246b2f, 0x231c0124, 0x25300101, 0x011e2e1e, 0x08e9522a, 0x8a785b21,
-    0x000622c3, 0x25678219, 0x35332707, 0xc4921533, 0x6b6b0126, 0x7256406b,
-    0xab25c492, 0x55556b6b, 0x20c3953f, 0x25608200, 0x13006b01, 0x5b822600,
-    0x012e2122, 0x1529c389, 0x14011e33, 0x012e2706, 0x0f7d4127, 0xebfe952e,
-    0x24303024, 0x293d0b0f, 0x20014232, 0x1420d882, 0x40317592, 0x30493001,
-    0x012f2501, 0x0b324201, 0x24362401, 0x498192a9, 0x02210603, 0x20838200,
-    0x25858207, 0x3700002d, 0x86842317, 0x4f472720, 0x17332406, 0x82050137,
-    0x07062385, 0x92823617, 0x97831720, 0x82141521, 0x013e270d, 0xa5012e35,
-    0x8b83d0ab, 0x353b402e, 0x49010145, 0x1b2bfa36, 0x42019bfe, 0x30248e82,
-    0x1e181f25, 0x12289e85, 0x18151f0f, 0xabeb3801, 0x65339184, 0x3548033b,
-    0x2a024836, 0x8165011b, 0x01014838, 0x850d1f18, 0x121b29a2, 0x0f1f081e,
-    0x3b2b1b2d, 0x8207df67, 0x00962297, 0x0a617815, 0x42062221, 0x15220688,
-    0x137c3521, 0x2e272b05, 0x15330701, 0x33153723, 0x03860735, 0x42000121,
-    0x0020099b, 0x27059c42, 0x90560c2a, 0x8015aaaa, 0x013e0083, 0x06272f95,
-    0x49363346, 0x01555501, 0x3b2b2e3c, 0xe9473903, 0x15158096, 0x2b16162a,
-    0x5c181515, 0x96350a47, 0x2c001600, 0x34003000, 0x3c003800, 0x32250000,
-    0x27263436, 0x06df6523, 0x010e2329, 0x35171614, 0x48371521, 0x2320056b,
-    0x2408b976, 0x1e33013e, 0x208c8401, 0x23988233, 0x27333523, 0x01260782,
-    0x24241c95, 0xe982201c, 0x0b3d292d, 0x3030240f, 0x1d000124, 0x8201382a,
-    0xff152281, 0x2a8c8200, 0x15314001, 0x563b2f4a, 0x8495aae6, 0x380482a6,
-    0x2437246b, 0x42320a01, 0x262f0102, 0x30483001, 0xa96a6a01, 0x2e2b3b03,
-    0x2cb9833c, 0x46333649, 0x012f2706, 0x9696a247, 0x21bb826b, 0xab42152a,
-    0x23152510, 0x17372335, 0x2513ab42, 0x6b40562b, 0x3542326b, 0x56ab2412,
-    0x426a6a56, 0x831813ab, 0x0f2b0987, 0x1f001700, 0x34130000, 0x79213336,
-    0x13230ae8, 0x82353311, 0x173525eb, 0x11331523, 0x40200382, 0x2f062c50,
-    0x13d6fe12, 0x2a554018, 0x552a802a, 0x55012a55, 0x83057872, 0x82012005,
-    0xaa2b27f8, 0x012bd52b, 0x13482b00, 0x001e220a, 0x215d823d, 0x5b460622,
-    0x22098209, 0x82013b16, 0x012e2b5d, 0x37363223, 0x33353335, 0x14831632,
-    0x15331725, 0x82010e23, 0x2b062209, 0x25158201, 0x2233013e, 0x27822726,
-    0x5e83ab20, 0x83151521, 0x2a2a2905, 0x12121801, 0x802a0118, 0x01241392,
-    0x55121980, 0x23821c83, 0x2b209882, 0x20050752, 0x4614942b, 0xab290873,
-    0x07006b01, 0x00000f00, 0x21e88501, 0xf9832111, 0x01330382, 0x6b404040,
-    0x406baafe, 0x2b6b0140, 0x012b00ff, 0x84aafe56, 0x072f4edb, 0x2f4e8020,
-    0x000f2406, 0x5e00001f, 0x352007c3, 0x2720c382, 0x8d760383, 0x8023250d,
-    0x6b956b6b, 0x04820082, 0x240a8976, 0x2b2b2bab, 0x20038280, 0x0b7651ab,
-    0x2b0d0f47, 0x00150005, 0x07171300, 0x012f3727, 0xde26538e, 0x441e6262,
-    0x89575544, 0x12192307, 0x11842201, 0x4d8d7c20, 0x2009a75a, 0x23e98203,
-    0x001d000d, 0x08094e18, 0x57942720, 0x82150121, 0x826b21a8, 0x0a204b84,
-    0xab205d89, 0x4d20aa82, 0x02216092, 0x24008200, 0x8001c001, 0x26ab8400,
-    0x37170701, 0x42013f27, 0x11230a4b, 0x86333634, 0x52ac849a, 0xac930661,
-    0x1721ab9d, 0x10034107, 0x3e25ab85, 0x1e44441e, 0x84ab8f62, 0x41c02014,
-    0xbb410c0c, 0x2b2b2335, 0x0082956b, 0x782b6b21, 0x80230b45, 0x822b562b,
-    0xd5802103, 0x0020608c, 0x3209cb75, 0x00050080, 0x001b000b, 0x07151300,
-    0x37271517, 0x41350717, 0xeb2911c3, 0xa0763939, 0x3b3b7777, 0x096841aa,
-    0x3c35012d, 0x753c3939, 0x3d777777, 0x8c863a3a, 0x056b415e, 0x8001ab22,
-    0x9b4a5982, 0x14200805, 0x3e270706, 0x2f263401, 0x010e1701, 0x07171614,
-    0x3634012e, 0x1b187801, 0x1523181b, 0xcd151616, 0x23200584, 0x012d0f82,
-    0x70632580, 0x1f162563, 0x1f586658, 0x83068616, 0x080b4312, 0x2005634b,
-    0x110d4437, 0x4e233721, 0x3227051c, 0x34331716, 0x83232726, 0x013b2369,
-    0xf048011e, 0x82232006, 0x83332077, 0x0c254484, 0x0d16cb25, 0x820d1212,
-    0x2a012604, 0x1f161f2b, 0x8e04822b, 0x0b3e4410, 0x1201aa2d, 0x0e12121b,
-    0x01012a20, 0x8c2b3f2a, 0x219f880c, 0x535701d6, 0x56252006, 0x012c05e8,
-    0x17072737, 0x63633701, 0x8c80801e, 0x9d560584, 0x059a5705, 0x00223682,
-    0x2b5a0008, 0x00042107, 0x08059555, 0x2a00262e, 0x31002e00, 0x07250000,
-    0x35372715, 0x06010f22, 0x16141507, 0x3216011f, 0x013e013f, 0x2f26013d,
-    0x011f2601, 0x07373507, 0x15173527, 0x152a6082, 0x1537012f, 0x07172707,
-    0x00824201, 0x05055208, 0x010307c1, 0x0a05c802, 0x0102c805, 0x05c10703,
-    0x9290405d, 0x31a05042, 0x029050e3, 0x31505092, 0x012cc031, 0x03a92c2d,
-    0x8508047f, 0x87020506, 0x03870303, 0x08850604, 0xea037f04, 0x8d57612c,
-    0x8258362d, 0x37152142, 0x60836156, 0x200b3657, 0x08334221, 0x4401d621,
-    0x19340553, 0x21330000, 0x23252135, 0x21353335, 0x17011e15, 0x37013e33,
-    0x3b09f366, 0x0180fe80, 0xfe2b2b80, 0x253001aa, 0x01302480, 0x1818122b,
-    0x2b40ea2b, 0x013025d5, 0x40281282, 0x13401218, 0x03000018, 0xe722fb82,
-    0x5382bd01, 0x0c000834, 0x00001e00, 0x27213537, 0x27071737, 0x23013d37,
-    0x5d183715, 0x2e2d0ce1, 0x40352701, 0x1e252b01, 0x251e5959, 0x2550832b,
-    0x30012b12, 0x5d835624, 0x83262a21, 0xea262a15, 0x196b4040, 0x18124012,
-    0x82148216, 0x00ab211b, 0xcf4c0082, 0x4d37200d, 0x154a0e2d, 0x23bb8205,
-    0x3503012e, 0x2321cc83, 0xbd451822, 0x05ea5707, 0x2305f845, 0x15012b06,
-    0x180c4d4d, 0x290bd07e, 0x40552b5e, 0x090c0c09, 0x08872a16, 0x200c5f4d,
-    0x0a745028, 0x16ecfe23, 0x06b9672a, 0xff4a0888, 0xc0ff2605, 0x16000002,
-    0x28ad8200, 0x21352115, 0x00fe0002, 0xcf441840, 0x0018230b, 0x99831700,
-    0x35219e82, 0x09084711, 0x07012b25, 0x64c02306, 0x012d067b, 0x18181256,
-    0x074f8212, 0x090c1508, 0x05d27440, 0x2105de74, 0x7b52064f, 0x0018240b,
-    0x9a290020, 0x3537284f, 0x0622012e, 0x6b371507, 0x609107b5, 0x3b028a26,
-    0x55023b30, 0x91054371, 0x16aa226d, 0x26008215, 0x2419ab16, 0x18241818,
-    0x260cb35e, 0x001f0018, 0x9b300027, 0x37152d7d, 0x11211133, 0x3e352325,
-    0x17163201, 0x91084256, 0x420a2784, 0x01aafe94, 0x8b9daa00, 0x42428027,
-    0x00ff0001, 0x2092842a, 0x41918795, 0x1c220d0f, 0x919a2000, 0x23351324,
-    0x03821715, 0x4a238191, 0x912a2a2a, 0x000126fd, 0x2b565555, 0xff49182b,
-    0x20f7830c, 0x41f98223, 0x372019c5, 0x3720f785, 0x9106d555, 0x20ee846c,
-    0x927182c0, 0x22e48672, 0x83ab5580, 0x0aab4c76, 0x1e001822, 0x1d5ed99a,
-    0x246a9205, 0x378d1eab, 0x20d9911e, 0x41178495, 0x1f220d3b, 0x619a2500,
-    0x2525d586, 0x17372707, 0x2a689237, 0xaafe9442, 0x4b750b01, 0x91572d1e,
-    0x20d5866e, 0x201e84aa, 0x5fa11800, 0x7418200c, 0x0524050b, 0x013d012e,
-    0x2c06b243, 0x16322133, 0x010e1517, 0x0607012b, 0x2d778323, 0x27152135,
-    0x013e1123, 0x21152137, 0x24430001, 0x068e7d07, 0x074f5736, 0x69420a08,
-    0x2b55d5fe, 0x01121801, 0x2babfe55, 0x40090c01, 0x07004018, 0x4f18122f,
-    0x41418007, 0x012bd6d6, 0x01181200, 0x7f62182b, 0x417b830b, 0xeb9620c7,
-    0x6b5ce498, 0x825f830a, 0x18ef4370, 0x20065341, 0x0a637d37, 0x96236d96,
-    0x8240402a, 0x24749802, 0x402b40d5, 0x206a8240, 0x08834604, 0x1c001826,
-    0x24002000, 0x231bd141, 0x23152335, 0x76910386, 0x2b2ba025, 0x912b2b2a,
-    0x18ea2070, 0x20081f41, 0x256b8a05, 0x0023001f, 0xeba20027, 0x35232524,
-    0x03860733, 0x0a2c7491, 0xaafe9442, 0x2b2b1601, 0x552a2a56, 0x48427d93,
-    0x846a2006, 0x10974384, 0x3b003725, 0x4a130000, 0x3b2005b9, 0x22063975,
-    0x7933013f, 0x233605cd, 0x23112105, 0x37233507, 0x33170622, 0x16323634,
-    0x0e070614, 0x0a821501, 0x013e3736, 0x07263435, 0x55353315, 0x12181812,
-    0x0b090c56, 0x824f0708, 0x8d820b83, 0x42945639, 0x241caf80, 0x120c2a02,
-    0x11080a0c, 0x08062a0c, 0x3723130f, 0x4595012a, 0x40240592, 0x4f060c09,
-    0x3b05a345, 0x4200ff2a, 0x1718e042, 0x120b0909, 0x0f0a050e, 0x050b0910,
-    0x160e1707, 0x2b2b8b1b, 0x410f6b43, 0x3720222b, 0x410a9152, 0x7421162b,
-    0x0a955337, 0x41102b46, 0xd520062d, 0x410a1d53, 0x23420e33, 0x1503241f,
-    0x4f053521, 0x8291061c, 0x2a016027, 0xaaaad6fe, 0x112542d5, 0x2a6a0126,
-    0x2b2b552a, 0x00200282, 0x0ae76418, 0x25293b45, 0x15211521, 0x10471533,
-    0x420a2b12, 0x2baafe94, 0x00ff0001, 0x7691c0c0, 0xc023f086, 0x412a2b2b,
-    0xd528056f, 0xab01c001, 0x10000d00, 0x2405ad5e, 0x27113315, 0x060f4215,
-    0x37230322, 0x21077264, 0x1882013b, 0x95012323, 0x2300826a, 0xd2191912,
-    0x132d0682, 0x6a121918, 0x80012b2b, 0x80ebfe2b, 0x05226fc0, 0x80c0fe23,
-    0x057764c0, 0xd6012b22, 0x200bcf41, 0x06716403, 0x013f0722, 0x180b7765,
-    0x2508335f, 0x51af2f01, 0x365280af, 0x0a5b2b0a, 0x0d140d0d, 0xaf51910d,
-    0x32525551, 0x83bc200a, 0x0d142114, 0x2b0ca341, 0x000c0003, 0x00240018,
-    0x07023f00, 0x088b5d18, 0x17ba8f18, 0x9145952b, 0x0b082645, 0x0b0b100b,
-    0x596e8b08, 0x55240a64, 0x39914591, 0x10222083, 0x7a8ac20b, 0x850bdb48,
-    0x0000227f, 0x05234a01, 0x17001324, 0xf9642000, 0x0f694d05, 0x3335132c,
-    0x33012f15, 0x0f141617, 0x0a712301, 0x05354305, 0xc0300583, 0x3c55b46b,
-    0x46060647, 0x00012b3d, 0x550100ff, 0x2c095d4c, 0xd5fe1813, 0x55562b2b,
-    0x07110746, 0x216e8246, 0x04830500, 0x4d000221, 0x1e2c06d7, 0x2a002600,
-    0x35010000, 0x17152707, 0x0fe66618, 0x45730520, 0x60172007, 0x372c0618,
-    0x01333523, 0x404040c0, 0x1256fe55, 0x2a06ec7c, 0x1bc4fe19, 0x24372424,
-    0x60ff9c24, 0xaa2a050c, 0x1501aaaa, 0x162b2b16, 0x8689952a, 0x40191222,
-    0x28065f73, 0x222015ff, 0x806b2022, 0x089b4600, 0x2605a35d, 0x001c0013,
-    0x66232100, 0x1720099d, 0x2d06fd6e, 0x010e2127, 0x11331115, 0xea950121,
-    0x7683eaea, 0x522a0483, 0x181200ff, 0x0100012a, 0xb46d2a2b, 0x01012705,
-    0x2b011218, 0xc46d1812, 0x2b012105, 0x7f54eb86, 0x00042806, 0x00120009,
-    0x8238001b, 0x170728eb, 0x26073537, 0x18143234, 0x2008d749, 0x07646027,
-    0x3536372f, 0x0622012e, 0x32171614, 0x26071737, 0x05425d23, 0x2734372f,
-    0x35331737, 0x2b809501, 0x140ad595, 0x05c2498a, 0x06851220, 0x01073c2f,
-    0x30304830, 0x32101324, 0x24131032, 0x300c8230, 0x95320701, 0x80800140,
-    0xcb15962b, 0xa1141401, 0x05de6401, 0x0786ff20, 0x26890720, 0x3c893220,
-    0x00159525, 0x78000200, 0xab3d05ef, 0x28001000, 0x23370000, 0x1135012e,
-    0x21373634, 0x33112115, 0x17071735, 0x23152311, 0x056f5635, 0x57111521,
-    0x3d2505c9, 0xeb153301, 0x2c8b8296, 0xff000112, 0x55559600, 0x192beaaa,
-    0x07274112, 0x01552b23, 0x2d188218, 0x2b011812, 0x402b00ff, 0x2b012b40,
-    0x2c838080, 0x6dd5fe21, 0x2b200541, 0x0943a118, 0xc001c024, 0x79820700,
-    0x00002623, 0x226f8225, 0x60353315, 0x9526208c, 0xd62ad6fe, 0x215f952a,
-    0x01152516, 0x2a404056, 0x22061e5f, 0x75131818, 0x012307ec, 0x57181256,
-    0x8020086f, 0x0c280982, 0x00001a00, 0x33352301, 0x2009576f, 0x055b4621,
-    0x2405bc6a, 0xd5d54001, 0x05636240, 0x00ff5022, 0x2707524f, 0xfe550001,
-    0x243724d6, 0xf1420282, 0x4300200a, 0xff250553, 0x01eb01d5, 0x205b86ab,
-    0x225d8223, 0x18152335, 0x2008f46d, 0x86461813, 0x07372d0b, 0x15211133,
-    0x27012e21, 0x96d66b01, 0x2005cb42, 0x090a7086, 0x012b8023, 0x052c412b,
-    0x55552b23, 0x06c362d6, 0x56550126, 0x181200ff, 0x28057142, 0xd5fe8001,
-    0x1218012b, 0x37d38600, 0x008001be, 0x00090005, 0x37000015, 0x16012726,
-    0x23150717, 0x35332735, 0x28087b48, 0x0107145d, 0x13071461, 0x054b4896,
-    0x07024030, 0x07610114, 0x2b2bf814, 0x2b4040d5, 0x9b634040, 0x82802008,
-    0x00062e51, 0x00220012, 0x15232500, 0x01211733, 0x20468a05, 0x0c234125,
-    0x0126342f, 0x2a6b6b6b, 0x2a01d6fe, 0x202be0fe, 0x2102822b, 0x5f582001,
-    0x2075250a, 0x352a012a, 0x2b201683, 0x4810fb6b, 0xb58309cb, 0x25002122,
-    0x2e226f82, 0x34552701, 0x18b98b05, 0x350b4a48, 0x23353303, 0x3d240001,
-    0x1a17f218, 0xc9600201, 0x2a2a202b, 0x7b452b20, 0x6b6b2c0c, 0x171a0115,
-    0x243d18f2, 0x82fe6049, 0x2a2a227a, 0x0a0845a0, 0x20d8fe22, 0x2705c755,
-    0xc1010000, 0x1c008101, 0x2e267782, 0x40003700, 0x2b5d4900, 0x2734290b,
-    0x2331012e, 0x07012e35, 0x32210489, 0x05de7716, 0xa1440720, 0x20118708,
-    0x88118717, 0x6501201a, 0x032609fc, 0x012b0d05, 0x03830113, 0x13011623,
-    0x05a77136, 0x06853220, 0xdb7c7820, 0x23068305, 0x6712121c, 0x22661485,
-    0x1010280a, 0x0f150308, 0x82160107, 0x0f2b2303, 0xdd7b4107, 0x01552405,
-    0x82121b12, 0x85152002, 0x862a2006, 0x863f200e, 0x20df8207, 0x30038204,
-    0x01d60100, 0x000f006b, 0x00460013, 0x1300004d, 0x0d441821, 0x33113a0e,
-    0x23111311, 0x0e011d16, 0x33010f01, 0x37012f15, 0x013e3736, 0x17010e27,
-    0x3f098223, 0x35331123, 0x37361637, 0x06222634, 0x36262307, 0x07011e37,
-    0x17070616, 0x07352327, 0x55333735, 0x0805c34e, 0x12aafe39, 0x96121818,
-    0x01041bc0, 0x4732030b, 0x1d21016e, 0x15020406, 0x21010513, 0x1b060101,
-    0x11011537, 0x13061101, 0x12022001, 0x020e2827, 0x0b110701, 0x432620ca,
-    0x5a6b0103, 0x2a240e5c, 0x000100ff, 0x30080383, 0x0b080709, 0x1a360513,
-    0x1f241501, 0x02210708, 0x09021802, 0x00ff0b08, 0x09010112, 0x07070f0e,
-    0x0327020c, 0x02022603, 0x2b08091a, 0x181b0c7b, 0x08975100, 0x04008022,
-    0x2d066f45, 0x005a0051, 0x00680067, 0x14163700, 0x04843422, 0x75089d4e,
-    0x172d08ba, 0x2622010e, 0x26373627, 0x2e063727, 0x24f98201, 0x17011e17,
-    0x2ae88237, 0x17010e07, 0x36173236, 0x82012f26, 0x3e172ff3, 0x16363701,
-    0x010e1617, 0x07061727, 0xe8622716, 0x30218208, 0x22012e35, 0x17140706,
-    0x0ae03736, 0x140a4a14, 0x05924441, 0x06855f20, 0x015e2808, 0x01496c49,
-    0x01191901, 0x22241303, 0x122c0602, 0x0d061209, 0x022e140b, 0x170b0b05,
-    0x0b0b1736, 0x142e0205, 0x82060d0b, 0x062c2617, 0x13242202, 0x2b2c8203,
-    0x3030247f, 0x24303048, 0x01141d24, 0x01280882, 0x40511d14, 0x01131301,
-    0x96200382, 0x8505d444, 0x82952005, 0x242e0827, 0x2c21161d, 0x1d0a051a,
-    0x05060c0e, 0x11070d02, 0x03134714, 0x0a192608, 0x0826190a, 0x14471303,
-    0x020d0711, 0x0e0c0605, 0x1a050a1d, 0xc382212c, 0x23051346, 0x20170c2b,
-    0x20233e83, 0x18e80c17, 0x2f093b46, 0x0003006b, 0x00170007, 0x35210100,
-    0x35211121, 0x48102b79, 0x0f790500, 0x1501260e, 0x8000ff2b, 0x0ece41ab,
-    0x00820020, 0x00000427, 0xeb01eaff, 0x27578701, 0x01000020, 0x05152135,
-    0x01320382, 0x1517011e, 0x2123010e, 0x013d2622, 0x03373634, 0x0a821521,
-    0x4b182720, 0x4b180787, 0x55280f8b, 0xc0fe4001, 0x2b011812, 0x2b256c82,
-    0x016a6aaa, 0x226e8200, 0x5e1912d5, 0xfe260509, 0x12182aaa, 0xbb8200eb,
-    0x02236f82, 0x18960100, 0x2108636c, 0x314c0033, 0x35333a05, 0x1d062223,
-    0x23253301, 0x33153315, 0x01263435, 0x16141523, 0x2335013b, 0x2f118221,
-    0x013d3632, 0x1e152523, 0x32213301, 0x2e353736, 0x06219683, 0x36a58217,
-    0x35211535, 0x1255552b, 0xaa012b19, 0x192b5555, 0x192b44fe, 0x83555512,
-    0x2113820c, 0xe44680fe, 0x26fb8607, 0xff00012a, 0x826b0100, 0x8056288c,
-    0x1256562a, 0x18d6fe18, 0x7407628a, 0xbc250952, 0x2aaa5555, 0x0673472a,
-    0xab01eb2c, 0x19001000, 0x11370000, 0x89821523, 0xa0829484, 0x27353322,
-    0xee82a583, 0x82953321, 0x12182349, 0x52822ad6, 0xab12182b, 0x560155ab,
-    0x12d62a56, 0x24058218, 0x1812ab2b, 0x0667412a, 0x01000025, 0x888001c0,
-    0x820020f7, 0x20e885df, 0x82df8703, 0x20f185e8, 0x245f8403, 0x01062223,
-    0x82d38395, 0x20cb83cf, 0x20d984d6, 0x21ed842b, 0x06828001, 0xfe181323,
-    0x821384ab, 0x2a01211d, 0x87592983, 0x00562108, 0x21053378, 0x01823521,
-    0x18062221, 0x2707b149, 0x2634013d, 0xd6fe9501, 0x0c2eb918, 0x2ad65522,
-    0x2109a84f, 0x43860000, 0x80019622, 0x470b7778, 0x3b210574, 0x05c74d01,
-    0x786b0121, 0x4c180d77, 0x00200c73, 0x860c6b59, 0x82112087, 0x010e2f87,
-    0x011e1107, 0x013e2117, 0x012e1137, 0x4e448001, 0x056d4805, 0x84000121,
-    0x12a67b07, 0x270a8741, 0x00230017, 0x35233700, 0x20051e55, 0x224b8215,
-    0x82231533, 0x23152455, 0x46012e35, 0x41290b81, 0x5d092c2c, 0x5d442a44,
-    0x20088709, 0xb98d18b6, 0xab542109, 0x2184188b, 0xb363ee20, 0x20f5820a,
-    0x06234800, 0x20000824, 0x8f182c00, 0x07200a63, 0x01217aa2, 0x051c4400,
-    0x829c9b20, 0x08415718, 0x8b9d6920, 0x82000221, 0xc0012700, 0x06005601,
-    0xfb821000, 0x17272108, 0x07371737, 0x07061415, 0x3d012e21, 0x2b6b2101,
-    0x754b4b75, 0xff090c2b, 0x010c0900, 0x95ea6b2a, 0xea210082, 0x05586040,
-    0x2006374a, 0x293f82ea, 0x00130096, 0x25000017, 0x9c180f06, 0x17211202,
-    0x18218237, 0x2411fb9b, 0x607f7f7f, 0xf79b180d, 0x47472210, 0x08374447,
-    0x8501c021, 0x001b2257, 0x275b991f, 0x27351705, 0x15073505, 0xfe266397,
-    0x018080ec, 0x6a95802a, 0x9049b327, 0x488f8f48, 0x21728290, 0x04830700,
-    0x01eb012b, 0x0005006b, 0x000d0009, 0x065b5e11, 0x07010036, 0x35371715,
-    0x27071727, 0x35331525, 0x2715011f, 0x35071537, 0x07200b83, 0x28080f82,
-    0x95955501, 0x51519696, 0x95fcfe51, 0xd5555556, 0x6ac0fe55, 0x6b014040,
-    0x5757a857, 0x2f2e25a8, 0x2b2b202f, 0x31643143, 0x25028264, 0x552a2a1e,
-    0x67822b2b, 0x0b246b89, 0x13000f00, 0x2108e97a, 0xac491300, 0x05352c09,
-    0x27331523, 0x07233533, 0x83152335, 0x820e826d, 0x35333009, 0x6bd69580,
-    0x4001d695, 0x40aa4040, 0x82402b40, 0x82ab2008, 0x00012409, 0x82956b6b,
-    0x40952402, 0x82ab40d5, 0x6402851b, 0xc024087f, 0x03009601, 0x2c08d582,
-    0x27210100, 0x1e132521, 0x32013b01, 0x01133736, 0x09f2fe87, 0xb0fe2001,
-    0x1018022b, 0x021810d6, 0x5615012b, 0x107bfe2a, 0x01101515, 0x21318285,
-    0xdf41ff00, 0x82032005, 0x001921a7, 0x03253d84, 0x3e272622, 0x05a34901,
-    0x498f0320, 0x241b9026, 0x04380401, 0x01220282, 0x548bdb24, 0x24c0fe2d,
-    0x034d231c, 0x1c234d03, 0x886a0124, 0x86002061, 0x828b2063, 0x0020299f,
-    0x00300028, 0x35331300, 0x24055d77, 0x1417011e, 0x06f96806, 0x2607c652,
-    0x23113337, 0x5a331517, 0x078505a2, 0x2b802731, 0x252b2b2a, 0x0f10012f,
-    0x01011613, 0x822b2936, 0x0b20080f, 0x56552b20, 0x161e1e16, 0x1e174b56,
-    0x6b01171e, 0x2b2a2a2a, 0x15263405, 0x290d0d25, 0x01362919, 0x2a2a0f82,
-    0x9500012b, 0x2d1e016b, 0x0686011e, 0x00820020, 0x04840120, 0x8001b43e,
-    0x00002900, 0x33170737, 0x011e2307, 0x37363233, 0x23010e15, 0x2327012e,
-    0x37273337, 0x46080482, 0x3237013e, 0x2e071716, 0x06222301, 0x97073307,
-    0x12db0202, 0x2e4712bc, 0x18153c24, 0x6140213c, 0x2c154a15, 0x15410101,
-    0x40611535, 0x131b4628, 0x2e243e14, 0x12f21247, 0x2b1515d5, 0x1b1e2f26,
-    0x0115133c, 0x822b3946, 0x46392a0d, 0x2b1b1f01, 0x262f1f1b, 0x287f882b,
-    0x00800180, 0x33000023, 0x27668235, 0x3523012f, 0x3e272633, 0x70848582,
-    0x010e2729, 0x1533021f, 0x82071623, 0x153b0878, 0x01251e8b, 0x34370201,
-    0x3c010105, 0x09201731, 0x1319090b, 0x02012021, 0x034f5404, 0xae1d0a06,
-    0x23380f1b, 0x1a2a1115, 0x083c3421, 0x07042506, 0x20290101, 0x212a1b1f,
-    0x831a271e, 0x8500206e, 0x236f83ef, 0x1300001c, 0x1620ed82, 0x0e29f283,
-    0x23150701, 0x35272317, 0x82808233, 0x2e3208ed, 0xab012b01, 0x104615d5,
-    0x2b154407, 0x0f293805, 0x36803680, 0x7f04291c, 0x24096316, 0x80013616,
-    0x2b18122b, 0x01063a2a, 0x012b9595, 0x132b1c23, 0x0b6d0017, 0x01ab2808,
-    0x001b0080, 0x1822001e, 0x2307677c, 0x33173335, 0x8206e842, 0x231525c6,
-    0x23152327, 0x2a05d059, 0x1d273337, 0x17273301, 0x82272335, 0x2b552522,
-    0x2b61492b, 0x07850084, 0x1818562c, 0x187a1949, 0x01311831, 0x00828000,
-    0x2b2a2b22, 0x2a250686, 0x802a2a55, 0x4604822b, 0x15250a5f, 0x00001d00,
-    0x20698237, 0x0688661e, 0x07596a18, 0x23352f08, 0x33152337, 0x26343632,
-    0x29a01580, 0x75293636, 0x152b8080, 0x75b51515, 0x1e1e1775, 0x360195eb,
-    0x2b013652, 0x2a6b6b2a, 0x1e6a952b, 0x23411e2e, 0x82962006, 0x001a2bc7,
-    0x010e2500, 0x07352307, 0x03843735, 0x37153324, 0x03840715, 0x37013e29,
-    0x6c029501, 0x82402a52, 0x3d3c8200, 0x54406b6b, 0x6c52c002, 0x2e18b002,
-    0x2d172617, 0x26405017, 0x2726272d, 0x0194272d, 0x53864054, 0x53826b20,
-    0xa5832520, 0x32011e27, 0x022e013e, 0x22458227, 0x7b153335, 0x2225054b,
-    0x021e010e, 0x366e8217, 0x2e352315, 0x012b9501, 0x01243624, 0x02404722,
-    0x40212901, 0x8f012921, 0x12803010, 0x12231818, 0x1d2b230f, 0x2f2f082c,
-    0x8e1d2c08, 0x0873830f, 0x01e7ff57, 0x009601a1, 0x05000019, 0x012f2606,
-    0x26220607, 0x36341135, 0x17351732, 0x0f06011e, 0x06161701, 0x08230107,
-    0x352f0410, 0x0c0c1106, 0x07f50611, 0x43070b02, 0x0806042e, 0x08050315,
-    0x0c042b65, 0x09400109, 0xce01050c, 0x010d1106, 0x1009640e, 0x00020004,
-    0x22578600, 0x8228000e, 0x16362dcd, 0x2737011f, 0x023f3626, 0x17371527,
-    0xd7206798, 0x312a6682, 0x06033227, 0xb0310608, 0x74945226, 0x1d829020,
-    0x6a126a22, 0x01256582, 0x1fe6940a, 0x208398a1, 0x29838201, 0x01db01e5,
-    0x0017009b, 0xb8180100, 0x332307fe, 0x18332707, 0x2c07e54c, 0x01173723,
-    0x5b5b6b15, 0x5b5b466b, 0x21078646, 0x0d8b4001, 0x937a1583, 0x01ab2e09,
-    0x001e0096, 0x16321300, 0x1636011d, 0x26028817, 0x07010e15, 0x82012e23,
-    0x35172cdf, 0x12d53634, 0x03250319, 0x82022602, 0x32028205, 0xab043804,
-    0x04313901, 0x01184c0e, 0x60121895, 0x880f0201, 0x154b2c02, 0x9008156b,
-    0x454f0b28, 0x831812ab, 0x83032067, 0xab012c04, 0x0a008001, 0x22001600,
-    0x82010000, 0x011e285a, 0x2e373632, 0x84150701, 0x0e352408, 0x8b262201,
-    0x06686e0b, 0x02609227, 0x02f46002, 0x8b078460, 0x80013004, 0x25243001,
-    0x24253030, 0x24407f30, 0x83243030, 0x88472004, 0x83441809, 0x2073850a,
-    0x99e18226, 0x32172475, 0x82063537, 0x150523ec, 0xf0793533, 0x28789105,
-    0x27272e49, 0x0160492e, 0x96c88229, 0x0c01297b, 0x30010c40, 0x002a2a1c,
-    0x8708236d, 0xa42e20f3, 0xa24c187f, 0x25879f0b, 0x2b404069, 0x07414040,
-    0x238b8518, 0x402a4024, 0x00280282, 0x00000200, 0x9401eaff, 0x2106334c,
-    0x41180500, 0x15290861, 0x27071737, 0x01351737, 0x05705300, 0x1f600337,
-    0x601f9494, 0x19241815, 0x01182419, 0x1f60eaaa, 0x601f9393, 0x086347ea,
-    0x92019427, 0x11000800, 0x22438900, 0x83352337, 0x27072142, 0x2a204388,
-    0x8027448c, 0x941e60d5, 0x82601e94, 0x06b74442, 0x4001f522, 0x19224382,
-    0x4a180000, 0x2520083b, 0x2e254182, 0x010e2301, 0x06754707, 0x01324b87,
-    0x51932106, 0x412e4c17, 0x0e2a0c5b, 0x5e3a5173, 0x9a85951d, 0x22936e30,
-    0x012b2533, 0x4d073e4e, 0x36010262, 0xf341002e, 0x05e74906, 0x20001324,
-    0x5f822900, 0x33351726, 0x27352335, 0x2609e771, 0x0e17013e, 0x18011d01,
-    0x20074c9d, 0x08e27507, 0x8040002a, 0x241b8080, 0x36240101, 0x6d750483,
-    0x4e742006, 0x553005e2, 0x2a2b2b40, 0x401c24c0, 0x1b24241b, 0x2a241c40,
-    0x200a676a, 0x05a74e6a, 0x06000022, 0x0123e083, 0x825601d6, 0x247f8309,
-    0x003a002d, 0x20838243, 0x20818207, 0x20839a33, 0x05556037, 0x27262223,
-    0x249d8a35, 0x012e3537, 0x209d8805, 0x209d82d5, 0x249d90d5, 0x24241c8c,
-    0x24ad8937, 0xfe0c0101, 0x20b0a1f7, 0x20c79e2b, 0x33c78402, 0x00800196,
-    0x00110007, 0x27230100, 0x15230723, 0x16140121, 0x3f05ba4c, 0x4a950121,
-    0x4a166a16, 0xebfe2a01, 0x12aa1219, 0x0100ff19, 0x2b15156b, 0x1912ebfe,
-    0x00011219, 0x04280083, 0xeaff0000, 0x8001c101, 0x2208654a, 0x6b030100,
-    0x350805d2, 0x13170327, 0x35031333, 0x27351533, 0xc1011737, 0x11170341,
-    0x031711aa, 0xaa393341, 0x4455ce39, 0x80014444, 0x14108ffe, 0x71011014,
-    0x01c0fe2b, 0x55ebfe40, 0x16826755, 0x0d075718, 0x0500023a, 0x17010000,
-    0x21031321, 0xfe880001, 0x01d588f0, 0xda1a01aa, 0xaafe2b01, 0x0c202882,
-    0x00210382, 0x059b6301, 0x1809794a, 0x180c716e, 0x231019b7, 0x21113311,
-    0x1806225a, 0x4a17995d, 0x6b22079d, 0xc4672a01, 0x55e72708, 0xaaaad6fe,
-    0x0182162a, 0x2a220585, 0x01826a2a, 0x260d9d6f, 0x01d6fe2b, 0x7855552a,
-    0x402106a8, 0x8600842a, 0x2cd78606, 0xeb01eaff, 0x03009601, 0x00001900,
-    0x06734e25, 0x1e110726, 0x07013b01, 0x273a9582, 0x37363233, 0x01012e11,
-    0x0180fec0, 0x1280fe80, 0x18010118, 0xaa2a9512, 0x0a84952a, 0x2ad6952c,
-    0x00ff1218, 0x15401912, 0xc55b4015, 0x09874105, 0x57828020, 0x814b0f20,
-    0x8d5e1806, 0x82152014, 0x210383d8, 0xd683aaab, 0xd3820485, 0x95012a22,
-    0x240b5556, 0x562b2b2a, 0x08cf5f2a, 0x0100002a, 0x006b01c0, 0x00050002,
-    0x07325382, 0x88011b03, 0xc0c078f0, 0xd54001c0, 0xaafe0001, 0x63465601,
-    0x207f8309, 0x3125830d, 0x07153337, 0x07231533, 0x23373523, 0x552b8080,
-    0x04844b4b, 0x55400125, 0x826b9555, 0x05db5003, 0x01d60123, 0x2e578496,
-    0x000c0008, 0x00140010, 0x01000019, 0x83270733, 0x13172502, 0x27231733,
-    0x2b080384, 0x07372307, 0x0127011b, 0x566a4055, 0x40952b56, 0x2a2b6b2a,
-    0x162a6a40, 0x152b4056, 0xd5551540, 0x000155d5, 0xabab9595, 0x40000195,
-    0x6a260083, 0x01d6fe80, 0x9b4e802a, 0x0007240a, 0x8217000f, 0x010f285b,
-    0x013f011f, 0x84020f27, 0x86172006, 0x95012d0e, 0x1b3a3a1b, 0xf03b3b1b,
-    0x35767635, 0xa0200382, 0x01230f86, 0x841b3bab, 0x8405200a, 0x35352216,
-    0x21268475, 0x577a1b1b, 0x82802009, 0x00182159, 0x117db918, 0x42075553,
-    0xa7200b40, 0x42057945, 0x95200d30, 0x09e75318, 0x220b776a, 0x92210018,
-    0x07166355, 0x08fd7a18, 0x3c205e8b, 0x0cc04e18, 0x2b20658d, 0x20054b45,
-    0x088462d5, 0x82000421, 0x43012000, 0x6b830537, 0x6d922a20, 0x9c081954,
-    0x20d58676, 0x877d9a7d, 0x8d6b20e3, 0x096f6885, 0x85000f21, 0x92332083,
-    0x5c7c9085, 0xae5c0854, 0x19054108, 0x19121222, 0xe820f283, 0x13419c85,
-    0x8dd5201b, 0x05e3459b, 0x220b1f41, 0xad3c0033, 0xe27a189d, 0xa0c18708,
-    0x427d20a6, 0x06840520, 0xa2191921, 0x426a20ad, 0x6a20063c, 0x4f08d741,
-    0xb78f058b, 0xb9a44520, 0x1810ef41, 0x4108699c, 0x70412969, 0x4112200d,
-    0x6b202177, 0x1b42c286, 0x20d18f06, 0x08b36102, 0x1c000b26, 0x35250000,
-    0x0805ba5b, 0x35333723, 0x3127011f, 0x010f2226, 0x011f1406, 0x013f3216,
-    0x2b013436, 0x090c2a56, 0xc05a4a6b, 0xc0061107, 0x2c028206, 0x06c00711,
-    0x5540358b, 0x35010c09, 0x2012854b, 0x58068612, 0x08240c53, 0x18001400,
-    0x37205f83, 0x2007c25c, 0x0a9e6727, 0x82331721, 0x20038275, 0x2dcd85d5,
-    0x01614812, 0x49486101, 0x60020260, 0x00822a8d, 0x2007de42, 0x0a6e67d5,
-    0xc06ba922, 0x0e5bb118, 0x19000f2c, 0x00002100, 0x27262205, 0x73503707,
-    0x374a0809, 0x27263431, 0x3e331523, 0x35230701, 0x14163233, 0x28020106,
-    0x235b1c45, 0x78020112, 0x02775a5a, 0x3e197702, 0x39505138, 0x1818753e,
-    0x151f1f1a, 0x560c181a, 0x795a3029, 0x5a790202, 0x2fd4795a, 0x01d6013a,
-    0x1c6c073b, 0x07461c34, 0x82e82007, 0x00962411, 0x820f0007, 0x0031236f,
-    0x57863700, 0x342a6585, 0x26220326, 0x3707012f, 0xab182627, 0x03200808,
-    0x1425ec82, 0x1e370717, 0x05687001, 0x6984fe20, 0x4f511a34, 0x363d3f38,
-    0x0f17371f, 0x10060f24, 0x475f0201, 0xf3825e47, 0x94824720, 0x5c221325,
-    0x8227461b, 0x79022708, 0x341b6a8b, 0x8382a01b, 0xfe3b5e35, 0x0d1316eb,
-    0x22112305, 0x02614826, 0x48486302, 0x827e0161, 0x2a3025a5, 0x1b180d57,
-    0x5a210882, 0x06db5b7b, 0x56019622, 0x0c280982, 0x00001500, 0x21352125,
-    0x2008cb58, 0x08074917, 0xd6fe9525, 0x43952a01, 0x1220050f, 0xab220685,
-    0xa343802a, 0x09c3440d, 0x13000326, 0x25001c00, 0x35234d82, 0x6d251523,
-    0xca7b0e5d, 0x08c54208, 0xd66b0124, 0xd7470001, 0x18132305, 0x785d1318,
-    0x49092006, 0xab220551, 0xb56c2a2a, 0x1813210a, 0x2007f47e, 0x07fe49aa,
-    0x24087f4a, 0x00080080, 0x05634118, 0x084d8d18, 0x56212521, 0x17270540,
-    0x3d013e21, 0x18263401, 0x210804b9, 0x8e4a2125, 0x21332305, 0x18833632,
-    0x1925db84, 0xfe040119, 0x227782aa, 0x82560109, 0xe1fe2105, 0x8c056142,
-    0x00012114, 0x2305dc43, 0x80090c80, 0x08a94c18, 0x41abfe21, 0x8021050a,
-    0x84158401, 0x49002004, 0x0361050b, 0x00072105, 0x23110d49, 0x25000039,
-    0x2206d848, 0x18352317, 0x1808c776, 0x200b6f41, 0x8f178215, 0x3537280f,
-    0x11211123, 0x832b8001, 0x84ab2000, 0x2ad62104, 0x55200086, 0x04821484,
-    0x01d5802b, 0x802b80aa, 0x2b2a802a, 0x8202832b, 0x9541180b, 0x55d6230a,
-    0x4b6080fe, 0x05e34605, 0xeb00ab28, 0x11000800, 0x91821a00, 0x41013e21,
-    0x272005f4, 0x01210890, 0x061b4455, 0x078e8120, 0x1742c020, 0x061e420c,
-    0x5b420020, 0x012b2206, 0x5c5b886b, 0x541807c5, 0x088808c8, 0x8607764c,
-    0x4406863c, 0x708f078c, 0x230de757, 0x3700000a, 0x3405816c, 0x17231523,
-    0xfe2a016b, 0x552a01d6, 0x15955580, 0x8080c02b, 0x06874195, 0x56016b22,
-    0x41080371, 0x00210f8b, 0x13681837, 0x15332208, 0x210ba227, 0x68182b95,
-    0xd6200f15, 0x2b201184, 0x41058741, 0x06860686, 0x14855620, 0xa7820020,
-    0x01000025, 0x940001c0, 0x83838487, 0x8217207b, 0x21079b7f, 0x6a852b40,
-    0x0a826b83, 0x2b238883, 0x822b2b80, 0x2202976c, 0x85000000, 0x0140227b,
-    0x247b9580, 0x23153313, 0x20038237, 0x20079e07, 0x20679cc0, 0x84868201,
-    0x829a8b8e, 0x820020f2, 0x29f78200, 0x00100080, 0x011e1300, 0x66830617,
-    0x7e063521, 0xb53e05e0, 0x01024232, 0x1fc0b01a, 0x0142322c, 0x80014201,
-    0x2c324201, 0x1ab0c01f, 0x32420201, 0xef6f4232, 0x000e260c, 0x2500001e,
-    0x233a8423, 0x16323634, 0xde634983, 0x80012e0f, 0x221f1680, 0x2d432c2c,
-    0x7c150101, 0x0a2b6015, 0x157c402b, 0x432d0101, 0x1f222c2c, 0x06876516,
-    0x01121925, 0x8218132a, 0x46072063, 0x092c08d7, 0x22001400, 0x36002c00,
-    0x4d004100, 0x262e6d82, 0x31333627, 0x010e1732, 0x3e272607, 0x73823703,
-    0x33352728, 0x17373632, 0xc082030e, 0x2105a856, 0xaf55012b, 0x28d28405,
-    0x17161736, 0x22312326, 0x46398207, 0x40080bb6, 0x100e5e01, 0x231e1210,
-    0x39792406, 0x1e14042a, 0x0d141b2c, 0x1a12c61b, 0x1e0a2d50, 0x0617222f,
-    0x095c1413, 0x46261320, 0x2d091017, 0x16341e6b, 0x1e113022, 0x2095110a,
-    0x1a202403, 0x33050616, 0x0a90655a, 0x3e373708, 0x21080232, 0x1f013036,
-    0x1c1e1908, 0x0a453509, 0x0e0802a6, 0x1f1e0a16, 0x36160a1c, 0x232d0ab4,
-    0x3924080b, 0x27111321, 0x0e2e2014, 0x36293f03, 0x0c0e0407, 0x4b189a16,
-    0x08210cb0, 0x09734a00, 0xf3821720, 0x37002d28, 0x48003f00, 0x9d485400,
-    0x26132c11, 0x17323727, 0x2207010e, 0x82373627, 0x171628eb, 0x17352706,
-    0x83373632, 0x41262013, 0x17210b04, 0x28f78306, 0x26171617, 0x27072223,
-    0x0b004136, 0x080b6f49, 0x0d09e938, 0x04181519, 0x1d285519, 0x1e0c1406,
-    0x13090e13, 0x38120c8a, 0x2f2a0720, 0x06411b09, 0x301b0d16, 0x21060b11,
-    0x181f2a4a, 0x0c101822, 0x19021669, 0x08101216, 0x0a5b3f24, 0x0d90490a,
-    0xe0fe3208, 0x0501232c, 0x16212618, 0x140a160c, 0x07302506, 0x06010274,
-    0x2e0f100a, 0x07941f0f, 0x0508191f, 0x1917271a, 0x142c0e1b, 0x261c2c02,
-    0x0f120305, 0x0b385b6c, 0x08d75f18, 0x8001d622, 0x29067d48, 0x003c002c,
-    0x27232500, 0x03821723, 0x27262224, 0xe8833634, 0x011e213e, 0x33372715,
-    0x33351707, 0x26220507, 0x1e333634, 0x06141701, 0x2e352622, 0x010e1701,
-    0x27200784, 0x2c821783, 0xd5012a08, 0x30861515, 0x0a90462a, 0x202a011f,
-    0x01131a1e, 0xf00c0900, 0x5b302a46, 0xabfe1025, 0x090c0c09, 0x0c013024,
-    0x18010c12, 0x21068499, 0x13833649, 0xd5604937, 0x0c4b4b2b, 0x03280b09,
-    0x01091601, 0x4b20090c, 0x2020604b, 0x212883aa, 0x21832430, 0x2a181222,
-    0x36210683, 0x23358449, 0x00006002, 0x2305db70, 0x008b01e0, 0x2a056946,
-    0x37172500, 0x35270715, 0x7c171117, 0x17300995, 0x01072737, 0x84275d00,
-    0x5c5c2884, 0x845b5b84, 0xe0330584, 0x89838383, 0x4f1c194c, 0x01191c4f,
-    0x564d4d4e, 0x84564949, 0x50992405, 0x52005050, 0xc033087f, 0x1900a201,
-    0x00003100, 0x020e1425, 0x27012e23, 0x8207010e, 0x59262005, 0x3e2305ac,
-    0x82271602, 0x08327a0d, 0x080aae49, 0x07b50174, 0x0c0a0d0e, 0x43141025,
-    0x05121222, 0x1d280213, 0x10133526, 0x520c2031, 0x0a112011, 0x0a040c1a,
-    0x0f171009, 0x03054e11, 0x6e4f4e70, 0x874c0202, 0x08191d0a, 0x04052904,
-    0x0501042d, 0x24360d04, 0x022b0301, 0x17052403, 0x090f0abc, 0x150e1a08,
-    0x0e0b0716, 0x51510607, 0x01016853, 0x51535564, 0x00020000, 0x01fcff00,
-    0x009601d8, 0x00270008, 0xe34b1300, 0x59372007, 0x162b08e6, 0x06162736,
-    0x26062307, 0x82013e27, 0x081882aa, 0x013e3729, 0x12120db5, 0x1212121b,
-    0x19013c2e, 0x1d371a15, 0x0301272f, 0x07805d3b, 0x3105075d, 0x031b3d0b,
-    0x040d2310, 0x6355013b, 0x403d0506, 0x1c2d3c01, 0x0e020f2d, 0x041b140e,
-    0x030ca80c, 0x342e4d21, 0x0442041e, 0x2b060108, 0x05834137, 0xcb01f534,
-    0x1c008b01, 0x3c002c00, 0x27370000, 0x32363426, 0x0787011f, 0x06141627,
-    0x07012f22, 0x8e078517, 0x17012115, 0x34851887, 0x0d0f5a28, 0x370d221a,
-    0x0683375b, 0x0b8a9720, 0x1e179f30, 0x07100d06, 0x110d075a, 0x01161e07,
-    0x0f8b1f3c, 0x0d0f9324, 0x35841a22, 0x97200682, 0x17250b8a, 0x11071e16,
-    0x2735820d, 0x1e060d10, 0x1f7a0117, 0x8b6a0f8b, 0x0019340b, 0x00300024,
-    0x012e2500, 0x34352327, 0x35012b26, 0x73363233, 0x1e2206d0, 0xf5411701,
-    0x37342705, 0x16141517, 0xe6411333, 0x057e3b0b, 0x0c150f15, 0x092a8009,
-    0x122a010c, 0x013a3019, 0x41a81701, 0x66050253, 0xc8181219, 0x4d3d0ba3,
-    0x4001100d, 0x0c2b0c09, 0x12182b09, 0x37531409, 0x094d3b21, 0x1214435d,
-    0x19121566, 0x0bce6a01, 0x2c0cc76a, 0x0018000b, 0x003d001e, 0x16070100,
-    0x33778215, 0x27072722, 0x013e0301, 0x07272637, 0x33011d16, 0x3507011e,
-    0x16261382, 0x06141513, 0x2182012b, 0x332a0482, 0x15062707, 0x2e071716,
-    0xa0453501, 0x26073605, 0x2020d501, 0x3e5b7802, 0x011b2032, 0x17153c65,
-    0x5a140101, 0x35b88204, 0x210b108e, 0x1219751c, 0x090c012a, 0x532c2e2a,
-    0x1e1f0105, 0x29821715, 0x1b42252d, 0x5001111e, 0x5b3e3220, 0x83200278,
-    0xe2fe3735, 0x2c213b17, 0x06065a25, 0x43100140, 0x0f200a29, 0x12094301,
-    0xd3822b18, 0x12532d29, 0x1e2b3914, 0x8225421b, 0x1517232c, 0xc2820b1e,
-    0x0001003c, 0x01d5ff00, 0x009e01c5, 0x37000014, 0x21170436, 0x1537011e,
-    0x3e272606, 0xc8821701, 0x26332b08, 0x012b3a06, 0xf4fe045b, 0x6c568f04,
-    0x5d0606c4, 0x031a0207, 0xd9cc0b99, 0x46ed12c5, 0x355a2d22, 0x46577648,
-    0x192a0201, 0x7f5a256d, 0x82562008, 0x00063809, 0x21070100, 0x21152105,
-    0x018e0001, 0x01ddfe1c, 0x01d6fe2a, 0x182bd555, 0x2d0a1f52, 0x00050030,
-    0x2900000d, 0x37173501, 0x04832517, 0x07271529, 0x80fec001, 0x84a6508a,
-    0x50a62704, 0x602f50d0, 0x04822fb2, 0x2e602f22, 0xc0215f86, 0x29378601,
-    0x17373533, 0x07111537, 0x08830727, 0x50a64023, 0x8237828a, 0x604f2a05,
-    0x01d0502f, 0x602e4f01, 0x5f09822f, 0x06200c53, 0x1d336f82, 0x00002100,
-    0x15231713, 0x05233523, 0x33353327, 0x75053315, 0x9263083e, 0x15172a05,
-    0x56953533, 0x01402b40, 0x2105832b, 0x6618d5fe, 0x122408d9, 0x559501d6,
-    0x80260085, 0x12801219, 0x04821818, 0x802b1923, 0x22668280, 0x82000200,
-    0xd6012300, 0xd7826b01, 0x82001521, 0x352724ff, 0x18353717, 0x200fa340,
-    0x210083ab, 0x6918aafe, 0x012708f4, 0x2b6a6a15, 0x642b6b6b, 0x4f871144,
-    0x0300b324, 0xb3831200, 0x17273722, 0x2508a160, 0x17013f36, 0x4b825516,
-    0x8d53d520, 0x13012405, 0x8313c1c1, 0x6b6b214b, 0x2606676a, 0x780c19d5,
-    0x64000c78, 0x0f200be3, 0x17204782, 0x26120d67, 0x21112137, 0x66270735,
-    0xbd270bd7, 0x01aafeab, 0x66abab56, 0x952610ac, 0xcd00ff6b, 0x57876a6a,
-    0x01000230, 0x001600c0, 0x0037002e, 0x011e0100, 0xb8561517, 0xa7411805,
-    0x35332b07, 0x2707013e, 0x16371715, 0xbb863317, 0x34113524, 0x0c823736,
-    0x0e371733, 0x33150701, 0x01263435, 0x011e17b5, 0x090c0c09, 0x2804836b,
-    0xab9f1e01, 0x161159ab, 0x32d88555, 0x04eb1218, 0x01120d71, 0xc0011240,
-    0x0b161e01, 0x8356090c, 0x29048225, 0xea1e160b, 0x376a2b6b, 0xee54010c,
-    0x05756b05, 0x0a0b562a, 0x0d1201ab, 0x120d0b0b, 0x260a3747, 0x00060096,
-    0x4418000f, 0x3226063f, 0x1e233736, 0x8d182701, 0x088708bc, 0x4805f549,
-    0x41180532, 0x00270c27, 0xda0d3a26, 0x68253a0d, 0xa32005b1, 0x21059945,
-    0xbe18493d, 0x49200939, 0x250a0049, 0x2121294b, 0x76188a29, 0xc1200e62,
-    0x230af04f, 0x79027e01, 0x70083149, 0x162f0b43, 0x29001d00, 0x00003600,
-    0x22010e25, 0x85232726, 0x15063005, 0x3e17011e, 0x2f343701, 0x07010e01,
-    0x44012e21, 0x128206e8, 0x83011e21, 0x48b082b2, 0x012e05ee, 0x2f300295,
-    0x01200123, 0x02302f23, 0x72850610, 0x30a50629, 0x2801174d, 0x49a54d17,
-    0xd3310a61, 0x1e0e2f1c, 0x20282007, 0x2f0e1e07, 0x1e1e17eb, 0x21038317,
-    0xd2851615, 0x80151628, 0x27272e01, 0xd58aaa2e, 0x01cb2408, 0x0b1e1115,
-    0x1e0b0f0f, 0x00001511, 0xff000005, 0x01e001ea, 0x00180096, 0x002b0024,
-    0x003f0032, 0x82161300, 0x163224a6, 0x82373617, 0x861620a7, 0x373624a5,
-    0x4705012e, 0xc684057b, 0x06142725, 0x483d2622, 0x37200696, 0x202ebe8c,
-    0x451c3b1e, 0x3b1c454c, 0x1618011e, 0xae850123, 0x16230125, 0x418a0118,
-    0xc9240a3d, 0xc0131a13, 0x40210382, 0x2ec38b60, 0x111d9301, 0x17191917,
-    0x2e1a1d11, 0x85433414, 0x344324b8, 0x41b92e14, 0x74260aa5, 0x0e12120e,
-    0x05842020, 0xcf92bb20, 0xcf82d620, 0x17000b24, 0x85412000, 0x18b68a06,
-    0x6b0cccbd, 0xe982050a, 0x07965318, 0x0121c68c, 0x20ad8aab, 0x0a74412c,
-    0xab47fe20, 0x42962005, 0x6a20061a, 0xda5bbf8b, 0x85492005, 0x0a7641ac,
-    0x91182620, 0xb3200c6f, 0x8341b48b, 0x24b38305, 0x00110008, 0x22b3821d,
-    0x52000035, 0x17200895, 0x20079e52, 0xbd4b1807, 0x32332217, 0x05777c16,
-    0xb5363422, 0x88206585, 0x2005df42, 0x16d84258, 0x09801b25, 0x83090c0c,
-    0x42d52004, 0x78211ddd, 0x24c1835b, 0x785b5a79, 0x060951fe, 0x0000063f,
-    0xd201e8ff, 0x3a009601, 0x51004500, 0x66005c00, 0x00007d00, 0x010e2213,
-    0x06170607, 0x21068507, 0x0782010f, 0x16010e2b, 0x1e171617, 0x36161701,
-    0x22ba8237, 0x83272636, 0x23068201, 0x3631012e, 0x2506c849, 0x3217022e,
-    0x2d821e33, 0x3e012e34, 0x021e2301, 0x06310706, 0x3736012e, 0x0e232217,
-    0x13821e01, 0x17012e22, 0x09835a82, 0x07232623, 0x204d8232, 0x214c8332,
-    0x69831617, 0x82262221, 0x37780845, 0x1307f236, 0x060a081d, 0x180a0513,
-    0x0b050102, 0x0d060606, 0x03090b02, 0x180f0909, 0x4d272045, 0x01283524,
-    0x07030604, 0x04090d12, 0x140d0908, 0x22060409, 0x0a1f0616, 0x5e020407,
-    0x1b180103, 0x1c2f2305, 0x16872006, 0x181c031e, 0x1d042217, 0x01010617,
-    0x0e020b09, 0x0c020b12, 0x010c0893, 0x010d130b, 0x099c0a0b, 0x101e1308,
-    0x0e07131e, 0x0c080706, 0x23382308, 0x07300582, 0x0d950105, 0x151d1421,
-    0x1d040304, 0x03101118, 0x3b080082, 0x220d0309, 0x0f141025, 0x06051617,
-    0x37180e06, 0x0623170c, 0x02080a10, 0x0d09180f, 0x16131107, 0x09010312,
-    0x0a1b0b0c, 0x322603a2, 0x3124061e, 0x311f011e, 0x1f010224, 0x24032333,
-    0x0a277482, 0x0b110e02, 0x82120b01, 0x0d133573, 0x02040267, 0x02010402,
-    0x0d1d0603, 0x09141409, 0x03061d0d, 0x420c0b45, 0xf06d23e3, 0x08ec4208,
-    0x2505f463, 0x27070622, 0xe342013e, 0x42882018, 0x68200549, 0x2005ea42,
-    0x23e2422b, 0x2b850620, 0x39852020, 0x11156e2a, 0x0e0e0c1f, 0x15111f0c,
-    0x0e20b38c, 0x2306e142, 0x13000046, 0x14238982, 0x82012e07, 0x3526218a,
-    0x8a051c64, 0x4203200e, 0x1e2418ef, 0x23061401, 0x3533ce83, 0x34262223,
-    0x1812c036, 0x13060601, 0x06061318, 0x8b921801, 0x432e200c, 0x192e1c00,
-    0x092b1824, 0x15010c0c, 0x0a0c1218, 0x03830c0a, 0x8b181221, 0x00ff210b,
-    0x430dec45, 0xe825090e, 0x0c120c01, 0x82008220, 0x01002106, 0x0026df82,
-    0x6b01eb01, 0xd3821e00, 0x1533152d, 0x23150723, 0x33152335, 0x64153335,
-    0x0d820627, 0x35271182, 0x40953533, 0x822b2a40, 0x2a403000, 0x40402bab,
-    0x0140802b, 0x2a2b2b6b, 0x82ab4040, 0x4056260c, 0x2b5540d5, 0x067f482b,
-    0x06254f83, 0x00002500, 0x23508237, 0x013d2327, 0xab23589d, 0x822b6aaa,
-    0x245c8d51, 0x6a2babeb, 0x2d5f9696, 0x00160196, 0x00070003, 0x35212500,
-    0x03821521, 0xfe950125, 0x832a01d6, 0x2aeb2303, 0x6f482aaa, 0x01c02808,
-    0x00030080, 0x82170013, 0x20c68229, 0x0e695501, 0x13830520, 0x270d5b55,
-    0x6bd60001, 0x15012a2a, 0x2409c374, 0x2a951813, 0x2cd7832a, 0xd101f1ff,
-    0x0f008101, 0x00001600, 0x7dbb1801, 0x0326080e, 0x3f321617, 0x5a012701,
-    0xc40d0d6a, 0x4b1b441a, 0x0de20d0d, 0x0d4cf322, 0x694b0d22, 0x0e697401,
-    0x19c40d22, 0x06824b19, 0xfe0de228, 0x0c0c4cf3, 0x8518694c, 0x6b24091b,
-    0x22001900, 0x232d5382, 0x012e2301, 0x33373634, 0x013e3537, 0x27ac823b,
-    0x3337011d, 0x0614011e, 0x33088d60, 0xff17ab01, 0x18123f00, 0x241c1218,
-    0x15090c01, 0x3a9c0c09, 0xfe210d82, 0x053345f8, 0xff150130, 0x24180100,
-    0x5c240118, 0x090c0c09, 0x0c839c1c, 0x96183f20, 0x022d08b7, 0xeaff0000,
-    0x8001d601, 0x23001300, 0xe7651800, 0x3523280d, 0x15231523, 0x70210333,
-    0x791805a3, 0xc75307ac, 0x552a2d05, 0x382a5580, 0x1d154601, 0xbafe151d,
-    0x80210582, 0x2a008340, 0xc04040c0, 0x1c014001, 0x82d0fe16, 0x01152513,
-    0x001c1630, 0x2005674f, 0x27638256, 0x000b0003, 0x1300000f, 0x8206b95e,
-    0x1d352a5e, 0xeb353301, 0x2aaa6a2a, 0x2a208256, 0x96155555, 0xab565696,
-    0x8200d5d5, 0x20378500, 0x223784ab, 0x8214000c, 0x15332337, 0xee5e2723,
-    0x232c0805, 0x27070127, 0x27352315, 0x2a2aeb37, 0x2a562a40, 0x00016644,
-    0xaa56651b, 0x5580011b, 0x96565640, 0x1bcafe67, 0xabba6565, 0x0100001b,
-    0xfe26e382, 0x8101a601, 0xe1826300, 0x3317363f, 0x1e173237, 0x26363701,
-    0x27013e35, 0x0e071606, 0x26060701, 0x013f2627, 0x16373435, 0x2a1a8236,
-    0x012f3617, 0x3436013d, 0x82140627, 0x8323201c, 0x3734211c, 0x2505cf43,
-    0x1617011e, 0x3782012f, 0x07062628, 0x22022f06, 0x12460607, 0x14062105,
-    0x3c084785, 0x37161722, 0x391c198f, 0x0a181d3b, 0x02060712, 0x0b180b06,
-    0x30090502, 0x0a3c1a1b, 0x05010107, 0x0c16411e, 0x020b0e03, 0x090e0203,
-    0x060e040a, 0x02143917, 0x10260b02, 0x040a411d, 0x086c8201, 0x04010120,
-    0x050d0601, 0x10794234, 0x1d010509, 0x01060309, 0x03030202, 0x0c020701,
-    0x0c0a0122, 0x00820105, 0x05024108, 0x0b140805, 0x0b062715, 0x0e0f0d15,
-    0x0f040302, 0x2524130d, 0x08010f12, 0x0619090c, 0x14190c03, 0x01180e16,
-    0x0309180a, 0x04020203, 0x0a1b421b, 0x090d0804, 0x12020216, 0x070e0a22,
-    0x06010207, 0x07324482, 0x0308020f, 0x42180915, 0x08174347, 0x13080213,
-    0x73410106, 0x01e62d07, 0x009601b7, 0x003e0008, 0x25000042, 0x3005c151,
-    0x2e372627, 0x34012b01, 0x06222726, 0x23071517, 0x28fe8222, 0x36161716,
-    0x011e3527, 0x33028217, 0x07061415, 0x36022e23, 0x26351733, 0x011e0706,
-    0x36163337, 0x79083182, 0x15372307, 0x0b084201, 0x1901180d, 0x2a074a17,
-    0x1d1b3311, 0x12020a1c, 0x02140152, 0x3b321e01, 0x20010226, 0x011d1b1b,
-    0x012d1007, 0x0609010c, 0x043b0510, 0x2f162801, 0x02064905, 0x5645fc19,
-    0x021702c8, 0x04022002, 0x110a9504, 0x14021a02, 0x18123c0c, 0x0d721f18,
-    0x30061e07, 0x01032703, 0x02271118, 0x0f010215, 0x21010917, 0x26251002,
-    0x3d05011c, 0x1e457778, 0xcc824658, 0x82000221, 0x16012300, 0x17446001,
-    0x33132905, 0x15172315, 0x2aeb3523, 0x01250082, 0x2b2aeb60, 0x0b035f2b,
-    0x20001734, 0x21010000, 0x011d0622, 0x11213533, 0x15233521, 0x74761614,
-    0x342f0805, 0x37170326, 0x23170727, 0x95013315, 0x1813d6fe, 0xfe2a012b,
-    0x12192bd6, 0x19122a01, 0x6b1ed019, 0xce371e6b, 0x188001ce, 0xfe555513,
-    0x825555d6, 0x241a8214, 0xf4fe1813, 0x211a821f, 0x8b882a38, 0x25050345,
-    0x2500001e, 0x4c821527, 0x11051528, 0x2137013e, 0x9683011e, 0x33217283,
-    0x05484b15, 0x56eb0124, 0xcb70c0c0, 0xff2b2209, 0xcd6a1800, 0x55c02609,
-    0x2b402a40, 0x053e6f01, 0x4040122b, 0x404000ff, 0x01011812, 0x063b5818,
-    0xef82eb20, 0x14000822, 0x0d5dcd84, 0x193f4c07, 0x24241b29, 0x1b242436,
-    0x18013d2d, 0x25083d78, 0x1d1d7d51, 0x0584517d, 0x79000121, 0xaa2006aa,
-    0x29821d88, 0x58010a26, 0x01584747, 0xb7610584, 0x01eb3609, 0x00050080,
-    0x00220015, 0x13000032, 0x012e3517, 0x06170727, 0x22dc8215, 0x55173732,
-    0x272405e4, 0x0706011f, 0x37221085, 0x08821701, 0x17071424, 0x28823736,
-    0x07822220, 0x0144fc27, 0x215f1b24, 0x24058202, 0x16210707, 0x25688219,
-    0x0a306b01, 0x8c821a36, 0x482b3226, 0xba86fe1b, 0x08231282, 0x8219313e,
-    0x282d2e10, 0x0001122e, 0x241b0343, 0x07211101, 0x22068207, 0x830b2102,
-    0x8c1925c2, 0x412a0931, 0x12259d82, 0x7a011b47, 0x24b68255, 0x293e1215,
-    0x2210823c, 0x44072e0f, 0xd3310853, 0x09009301, 0x16001100, 0x07250000,
-    0x27010f27, 0x2302833f, 0x14163236, 0x03210b82, 0x080d8207, 0x2e9d0124,
-    0x2062a41e, 0x2d1ea527, 0x27331360, 0xc65a2913, 0x1e9e3517, 0xa51e2dc6,
-    0xa4622027, 0x13232e1e, 0x15823327, 0x35fefe25, 0x421e9e17, 0xc1240747,
-    0x03008101, 0x37275583, 0x37173727, 0x82222627, 0x1707244e, 0x83331507,
-    0x3637380d, 0xac299434, 0x06327a29, 0x29430612, 0x65be1e1e, 0x291e1ebf,
-    0x822b0643, 0x32712214, 0x22138406, 0x84be65bf, 0x00122113, 0x01340082,
-    0xeaff0000, 0x96016b01, 0x00001300, 0x0e231501, 0x33011d01, 0x3d08316b,
-    0x0137013e, 0x0a0b2b6b, 0x40564040, 0x25300140, 0x01559501, 0x56350c13,
-    0x5556aaaa, 0x3b823024, 0x56020021, 0x23200aab, 0x24119f56, 0x06222305,
-    0x2a4e8207, 0x35331533, 0x35233533, 0x823b3634, 0x092b646c, 0x3527012d,
-    0x2b012a20, 0x4040402b, 0x562b090c, 0x2b2a0d38, 0x40361f2b, 0x2b409595,
-    0xfb840c09, 0xd620a782, 0x102fa782, 0x00001600, 0x07010e01, 0x011f1614,
-    0x5d163137, 0x0322058a, 0xff820727, 0x5a00012a, 0x25290279, 0x201d4901,
-    0x02320882, 0x6c354479, 0x01683773, 0x546f0295, 0x4c1c4f2e, 0x08820828,
-    0xfe6f5428, 0x783838fa, 0x70183535, 0x9620087b, 0x230a7b59, 0x3700001e,
-    0x2720ab82, 0x18063d46, 0x2307434e, 0x35171105, 0x373a0182, 0x55151733,
-    0x56d65656, 0x56562a56, 0x6a80fe56, 0x40156b6b, 0x2b2b4015, 0x95182a55,
-    0x5523090b, 0x83552a01, 0xd5d52200, 0x25b78bd5, 0x00340008, 0xff542500,
-    0x8207200a, 0x162608c3, 0x17163617, 0x2e27010e, 0x07062701, 0x2e070616,
-    0x013e3701, 0x06272637, 0x013e2726, 0x17011e17, 0x36263736, 0x715d0001,
-    0x46023a05, 0x10102711, 0x3e0a1003, 0x4b040363, 0x0f1d0916, 0x19200d07,
-    0x2710463a, 0x2b15850f, 0x174a0402, 0x06101d08, 0xd51a200d, 0x20057b4c,
-    0x871188c0, 0x0b0f2427, 0x8403623e, 0x243d8315, 0x1146391a, 0x413d8628,
-    0xcb2206cb, 0x09824001, 0x00000534, 0x05371101, 0x15012737, 0xb68afeb6,
-    0xff4001b6, 0x00828000, 0x00820020, 0x03820620, 0xd601002c, 0x03008001,
-    0x15001100, 0x8f431900, 0x15333006, 0x33350723, 0x1d011e15, 0x23152301,
-    0x41352335, 0x3720073d, 0xa918f587, 0xeb2e0fe8, 0xea406a6a, 0xea40241c,
-    0x96964016, 0xe6852a96, 0x16b7fe22, 0x09350882, 0x18181216, 0x152b4001,
-    0x24018080, 0x4040801b, 0x555555c0, 0x850382d5, 0x0c2b2ad8, 0x0c099609,
-    0x126a1219, 0x3a858219, 0x01d5ff00, 0x00ab01d7, 0x00280004, 0x1300003c,
-    0x0f271521, 0x36323301, 0x84011e37, 0x013b2904, 0x2f263637, 0x012e3501,
-    0x07b78518, 0x07150729, 0x0517010e, 0x82062722, 0x2b3e0802, 0x36331501,
-    0x37321637, 0x35331716, 0x80000180, 0x1a012c80, 0x2b10102c, 0x10102b34,
-    0x28011a2c, 0x1b090803, 0x40121801, 0x18124080, 0x08091b01, 0x2e7f0103,
-    0x285a2828, 0x2a2a2e28, 0x0882292d, 0x2a2d292a, 0x29544001, 0x1218c129,
-    0x0382b682, 0x10098e25, 0x82630902, 0x4040212d, 0x63293882, 0x09100209,
-    0x1b1b1cb9, 0x256a821c, 0x01151515, 0x0082002b, 0x9c180220, 0x022a086b,
-    0x00001000, 0x25173501, 0x9b180622, 0x2725094f, 0xfe761501, 0x764282f5,
-    0x9982076e, 0x66757521, 0x00210980, 0x08234c80, 0x9601ab23, 0x61438300,
-    0x0126069d, 0x33012f33, 0x67771117, 0x11272705, 0x3313013e, 0xda822335,
-    0x55820384, 0xab957622, 0x0ae35318, 0x2b2b272e, 0x552a2a56, 0x00012b2b,
-    0xff802075, 0x2b05687c, 0xfe181256, 0xab808080, 0x000056ab, 0x85072349,
-    0x82162063, 0x245f90a9, 0x27072737, 0x25599007, 0x4c196571, 0x568f1922,
-    0x1e66a125, 0x4519224d, 0xbb870827, 0x57932220, 0x27012e22, 0x08df5118,
-    0x013e3324, 0x63902634, 0x2a07e130, 0x0a26171e, 0x01011f19, 0x168b1b24,
-    0x6e8f1b1e, 0x231ceb2e, 0x03141701, 0x241b1a23, 0x2c1e0101, 0x08477618,
-    0x1b207787, 0x35297793, 0x16331523, 0x3e170706, 0x28709001, 0x063156bd,
-    0x23182419, 0x27689021, 0x291f5555, 0x46161215, 0x0021da82, 0x0cdb4104,
-    0x18001422, 0x25236596, 0x90152135, 0xc0d22562, 0x00ff0001, 0xab225f8f,
-    0x47742b2b, 0x0bcf6105, 0x0b000723, 0x24c18200, 0x33352325, 0x06ab6037,
-    0x2410785d, 0x4096962b, 0x200082d6, 0x0a735d2a, 0x2a204982, 0x18224f82,
-    0x8618fe13, 0xe74108bb, 0x000d270a, 0x002c0010, 0x44421300, 0x1517240c,
-    0x82230733, 0x33272203, 0x20068235, 0x230b8317, 0x17372335, 0x35250b82,
-    0x33372723, 0x0b534280, 0x2076a72b, 0x2b2b1656, 0x40165616, 0x87048240,
-    0x95012109, 0x320a5f42, 0x2a2b7520, 0x2a2a2424, 0x2b2b3536, 0x2b2b2424,
-    0x49003635, 0xd7860b2b, 0x23072729, 0x17332737, 0x90073337, 0x2b5a26d7,
-    0x452b2f2f, 0x20058445, 0x23db8b80, 0x6b6b5151, 0x4b5e0382, 0x09c7420f,
-    0x1720df83, 0x6e43df82, 0x17072a0c, 0x15330723, 0x37270727, 0x0b744380,
-    0x76761628, 0x3c2d9656, 0xfb693d3d, 0x80002a0a, 0x97457520, 0x3c3d3d2e,
-    0x0cc74300, 0x24000831, 0x1e370000, 0x34363201, 0x17062226, 0x88232735,
-    0x27372261, 0x09214906, 0xc0070622, 0x2206f448, 0x87ab80ea, 0x0b0e246c,
-    0x49211a5e, 0x112a0924, 0x24241cab, 0xa8242437, 0x0c5680f7, 0x5f082305,
-    0x80180111, 0x212208fc, 0x6342001a, 0x0015220e, 0x1363421e, 0x07352124,
-    0x7f45012f, 0x10694207, 0x00011225, 0x67552b55, 0x6f4205fc, 0xab80240f,
-    0x636b2a55, 0x03440553, 0x183b410b, 0x15371725, 0x41273723, 0x3f250f3b,
-    0x2d972d3d, 0x0e3b413c, 0x2d3d2f26, 0x003c2d96, 0x23089f58, 0x009601ab,
-    0x1d225783, 0x95412600, 0x16322813, 0x15331517, 0x6e333523, 0x3323070f,
-    0x8f263435, 0x1b152d68, 0xaa150124, 0x1b240115, 0x0c2a0c09, 0x2b30708e,
-    0x55151c24, 0x251b1555, 0x090c012a, 0x0c091515, 0x002d7a82, 0xff000003,
-    0x01d601c0, 0x000200c0, 0x05536b10, 0x012f2e08, 0x14111733, 0x2e210706,
-    0x34113501, 0x21110736, 0x26222115, 0x40011135, 0xaa957575, 0xff121880,
-    0x19181300, 0xfe560144, 0x011812aa, 0x062f452b, 0x1801012f, 0x12550112,
-    0x80fe5519, 0x0112192b, 0x10db4480, 0x26149941, 0x1614010e, 0x82373632,
-    0x152321d5, 0x2911d744, 0x18181252, 0x40011824, 0x97410956, 0x01d6210f,
-    0x18241882, 0x702a6b12, 0x08334e18, 0x4507cb44, 0x1725139b, 0x35211123,
-    0x10f94123, 0x016b7d24, 0x5a8e9500, 0xaafe2a23, 0x087361c0, 0x5346c020,
-    0x00192806, 0x00510046, 0x425f0057, 0x6a18085d, 0x173309c9, 0x06011f16,
-    0x3637010f, 0x27013e17, 0x27072326, 0x83372726, 0x012b2109, 0x3505bb4d,
-    0x020f0631, 0x0607010e, 0x3632031f, 0x3736013f, 0x2732011e, 0x1d821417,
-    0x3336273d, 0x06071632, 0x3f013e07, 0x013f2601, 0x010f1617, 0x75752b01,
-    0x1980ab96, 0x8200ff12, 0x0d7c3bfa, 0x2a1d0913, 0x920e0b03, 0x09040205,
-    0x14131c27, 0x0406010e, 0x0507060a, 0x08820a06, 0x07062d08, 0x13131410,
-    0x02010114, 0x0d090a01, 0x2003141f, 0x1a231136, 0x05020203, 0x02021810,
-    0x15c31216, 0x0b0e010f, 0x0205074b, 0x04030503, 0x4308e68e, 0x07101ede,
-    0x16010f05, 0x0f063a1c, 0x0d020f05, 0x16032511, 0x0a050b2c, 0x131e1506,
-    0x0a26221d, 0x0609180d, 0x02070105, 0x0a02221f, 0x15080806, 0x020b0302,
-    0x04262106, 0x9a0b1306, 0x01030e1d, 0x00151007, 0x32050349, 0x008001c0,
-    0x003c000a, 0x0057004c, 0x0066005e, 0x82063700, 0x36372bd4, 0x26272637,
-    0x26220617, 0x86820627, 0x22230128, 0x3726022f, 0x1782013e, 0x03823620,
-    0x012e3122, 0x3b2d0c82, 0x16173201, 0x16150706, 0x36171617, 0x440b8333,
-    0x07210fdf, 0x2139822e, 0x28821607, 0x54823520, 0x010e3308, 0x023f3607,
-    0x07012f36, 0x0f07f406, 0x2a020307, 0x1304051d, 0x231b057d, 0x04203610,
-    0x050d1f14, 0x02010a04, 0x13130201, 0x0b0a0d06, 0x0506080f, 0xc6820206,
-    0x0a05082f, 0x150d0604, 0x0d0f0a08, 0x01040927, 0x0a264511, 0x01322408,
-    0x03021611, 0x02051018, 0x0b0407c5, 0x560e010d, 0x06040401, 0xd7060103,
-    0x0a0c1c18, 0x03050f01, 0x82341004, 0x062508ff, 0x1f22020a, 0x05010702,
-    0x0d180906, 0x15110604, 0x1e131d22, 0x050a0615, 0x03162c0b, 0x06071125,
-    0x0f050f02, 0x0b4946f5, 0x0602ec34, 0x1d030b02, 0x130b0204, 0x01ba0406,
-    0x01061115, 0xaf440e03, 0x000d260b, 0x00200010, 0x13614628, 0x15331536,
-    0x35331523, 0x3e333523, 0x23263401, 0x14011e15, 0x35012b06, 0x2e0e5d46,
-    0x551515e0, 0x241c2a15, 0x0c091c24, 0x462a090c, 0x802f1057, 0x012a1616,
-    0x2a243724, 0x0c120c01, 0x1800002b, 0x360aff45, 0x001e000e, 0x37000026,
-    0x37363233, 0x27362736, 0x012b012e, 0x53133315, 0x17220ea2, 0x79833335,
-    0x35d1232f, 0x140a1a18, 0x0a140101, 0x265b181a, 0x050c69c4, 0x66300583,
-    0x14161531, 0x0909a214, 0x141e2111, 0x01d60a09, 0x250cae7e, 0x17014dc0,
-    0xcf461421, 0x0c3b7f0c, 0x4f111521, 0x012109f7, 0x05435495, 0x08bb5518,
-    0x6baa6b22, 0x25189747, 0x00170014, 0x56460100, 0x37362209, 0x054e7311,
-    0x35271725, 0x462b0117, 0x1228084c, 0x569f0118, 0x76374056, 0x270b0845,
-    0x2b2b2af2, 0x75759d40, 0x48109f44, 0x5882159d, 0x35331522, 0x23103944,
-    0x969640fd, 0x260e5143, 0x2f8096fe, 0x8c2f802f, 0x000d2457, 0x41250010,
-    0x172213e1, 0x02823733, 0x23353329, 0x27073315, 0x83270723, 0x0ede4109,
-    0x2b20f623, 0x29028220, 0x13155515, 0x13182a18, 0xe0415515, 0x96552a0e,
-    0x2a964040, 0x2f2f5a2a, 0x0523555a, 0x01000034, 0x008001c0, 0x001c000c,
-    0x27232500, 0x33272307, 0x02833717, 0x2e0f5443, 0x2b204b01, 0x2433202b,
-    0x2a1e2a21, 0x43172421, 0x55240a0e, 0xa0d6a0a0, 0x55200082, 0x200c7b41,
-    0x0cc74904, 0x5f831620, 0x2a115d4b, 0x37273717, 0x07271727, 0x41170717,
-    0x152b102d, 0x32321f4f, 0x1e509f1f, 0x411e3131, 0xe02b0f35, 0x32311e4f,
-    0x1e50501e, 0x451e3132, 0xd6290877, 0x1d00ab01, 0x25002100, 0x99e01800,
-    0x13002e07, 0x36343533, 0x011e3337, 0x32331517, 0x31048216, 0x0e152311,
-    0x22012b01, 0x34113526, 0x33150536, 0x03862335, 0x35211b82, 0x080b8633,
-    0x0a204b24, 0x09075e07, 0x120d2001, 0x01aaaa01, 0x0ec00d12, 0x43011212,
-    0x802a802b, 0x2b2a2b2b, 0x012bd62b, 0x1f821a80, 0x07090129, 0x0b0e121a,
-    0x820ac0fe, 0x010e241f, 0x69120e55, 0xc020061f, 0x2105b46a, 0x9b820700,
-    0x55010021, 0x07210523, 0x07bb7e00, 0x00002b22, 0x07df6818, 0x200f0d6b,
-    0x20108213, 0x21038323, 0x8d843311, 0x176b9182, 0xd52b2107, 0xd5225485,
-    0x0883aa2b, 0x01210482, 0x20918400, 0x82058480, 0x2016820c, 0x20a082fe,
-    0x829d822b, 0x257b8277, 0xc001d5ff, 0x77868001, 0x24001f25, 0x82002800,
-    0x3713217b, 0x82059c55, 0x05112167, 0x1720ff82, 0x23210383, 0x26708627,
-    0x35012f11, 0x83152327, 0x15112814, 0x011c1527, 0x83501b8f, 0x227c846b,
-    0x821ad619, 0xd52b2d0b, 0x2b2b2506, 0x1b650119, 0x501c71fe, 0x01210a82,
-    0x22048225, 0x842a2a55, 0xbcfe27a2, 0x0525442b, 0x8682562a, 0x19192b22,
-    0x0025ea82, 0x01ffff00, 0x088782ac, 0x0000153e, 0x06161525, 0x26012f22,
-    0x27313537, 0x33013e26, 0x011e3221, 0x2b01010f, 0x07110e01, 0x7b01082a,
-    0x070d0306, 0x0d072a01, 0xc07b0603, 0x060e0aa8, 0x7d0a082b, 0x0a11089d,
-    0x9d08110a, 0x86051344, 0x0013214b, 0x25205a82, 0x4b8a4c87, 0x82172721,
-    0x013722bb, 0x24518240, 0x01075606, 0x25518966, 0x2a55aa66, 0x54821855,
-    0x09085624, 0x5485826e, 0x6c7a8226, 0x6ba12b75, 0x28078b4a, 0x01f001e5,
-    0x000b0080, 0x21a98221, 0x50182737, 0xb588096c, 0x698a2320, 0x3c3b0127,
-    0x3d3c1e3c, 0x2205821e, 0x83593c3d, 0x082b266f, 0x057b0102, 0x26c28202,
-    0x020d072b, 0x82047b05, 0x3b3b211a, 0x3c222083, 0xce92da3c, 0x00030024,
-    0x7387ff00, 0x25001f22, 0xdd99758e, 0x3d3d3a23, 0x845b821f, 0x02442802,
-    0x5507110e, 0x89660108, 0xa9672478, 0x8b542b54, 0x9632207c, 0x257f82f5,
-    0xc0010000, 0x89824001, 0xf7820720, 0x37002008, 0x27213521, 0x03352115,
-    0x80233533, 0x00ff0001, 0xeb800140, 0x2aab5656, 0xff2b2b6b, 0x4f002b00,
-    0xc32c0837, 0x12009601, 0x47002900, 0x97005b00, 0x22344382, 0x23012e27,
-    0x26060722, 0x32333637, 0x07161716, 0x27220506, 0x37230c82, 0x82173236,
-    0x2706240e, 0x82262726, 0x0607221e, 0x29298313, 0x3e352627, 0x011e3701,
-    0x0d830617, 0x07062224, 0x0c821714, 0x37203482, 0x35230f83, 0x83153236,
-    0x32332a0e, 0x06163637, 0x2e230723, 0x225d8201, 0x82363435, 0x7b1e2058,
-    0x272605ec, 0x0607010e, 0x59850615, 0x70343521, 0x22280867, 0x012e3526,
-    0x14150622, 0x0806f757, 0x037c014c, 0x20391e02, 0x0a08383f, 0x22453c08,
-    0x0408203f, 0x04c9fe03, 0x20050703, 0x34743430, 0x10052030, 0x2f2b1d07,
-    0x1d2c2e6b, 0x03048003, 0x170a130e, 0x33334402, 0x14010244, 0x54380101,
-    0x0a130138, 0x06060c12, 0x1c269504, 0x13821b18, 0xbf085882, 0x0a0e0820,
-    0x34071303, 0x11251903, 0x38251717, 0x19010125, 0x02011925, 0x4c2e4257,
-    0x06010c13, 0x04130309, 0x56160f10, 0x02634b34, 0x26372501, 0x19261901,
-    0x200f1414, 0x01040917, 0x0e100161, 0x0611041e, 0x06110f20, 0x02700608,
-    0x192d0806, 0x2d181a1a, 0x29070c08, 0x16181816, 0xfefe0429, 0x13180e03,
-    0x41313428, 0x31410101, 0x35280a0a, 0x232f2835, 0x070c1612, 0x13280308,
-    0x0a1c3110, 0x0e27170a, 0x1301020f, 0x15072c05, 0x20391611, 0x1b23231b,
-    0x11181811, 0x0102523e, 0x221a282d, 0x091a270c, 0x2a2a0907, 0x342e1e27,
-    0x475f0201, 0x1a24241a, 0x12171712, 0x0f14311b, 0x11040612, 0x320b774d,
-    0x000b00b2, 0x37000020, 0x3e272622, 0x0e163703, 0x691e0301, 0x3d2005f1,
-    0x3205587d, 0x37013e17, 0x1dfa012e, 0x1f010127, 0x0c113539, 0x82053a01,
-    0x27013118, 0x24202b43, 0x49600201, 0x01026049, 0x1d262b4b, 0x1b397582,
-    0x3a582916, 0x40028601, 0x2c2c2225, 0x61260822, 0x01614837, 0x57486101,
-    0x06b74393, 0xc001f631, 0x32008401, 0x00008a00, 0x27263425, 0x8327012e,
-    0x06240804, 0x34273507, 0x012f2623, 0x06010f06, 0x17010e07, 0x15061533,
-    0x15070607, 0x3207010e, 0x16063336, 0x37011e17, 0x272c8582, 0x2e011f16,
-    0x011e0701, 0x1716011f, 0x0e221b82, 0x31821501, 0x020f2224, 0xbc822706,
-    0x26213f82, 0x05ce5427, 0x06262724, 0x0f832707, 0x36023f30, 0x013f3237,
-    0x36013f22, 0x23013e35, 0x14830627, 0x36373524, 0x6a842637, 0x23012e32,
-    0xc001013e, 0x1a050103, 0x230e0812, 0x02215961, 0x25080083, 0x07030105,
-    0x03030201, 0x04090702, 0x01020302, 0x08010201, 0x74281a15, 0x0144393b,
-    0x052431a0, 0x03071106, 0x1f820318, 0x0d012808, 0x05100101, 0x08020604,
-    0x080a1414, 0x03050b05, 0x06090d08, 0x02340c18, 0x06040a01, 0x1415091c,
-    0x0301020a, 0x82090b04, 0x02042d4c, 0x0202080b, 0x05190905, 0x02020406,
-    0x52082d82, 0x09041604, 0x0c010709, 0xc6491d09, 0x1c061107, 0x090a132f,
-    0x221d111d, 0x06010402, 0x04020d02, 0x040a0707, 0x06070213, 0x0a081302,
-    0x03090306, 0x21512a02, 0x1615212f, 0x0ba93e61, 0x0a060720, 0x031f0603,
-    0x06030d0e, 0x23040935, 0x04020b02, 0x82030603, 0x020321aa, 0x07375f82,
-    0x05071502, 0x04010307, 0x07060704, 0x03030211, 0x02030a0b, 0x82050604,
-    0x0210225a, 0x29da8203, 0x0f140202, 0x05050603, 0xef820607, 0x00151824,
-    0x00820002, 0xd6012008, 0x28005601, 0x00003100, 0x012e3725, 0x0e070627,
-    0x36322701, 0x36272634, 0x17161716, 0x8337013e, 0x054b5a08, 0x82010e21,
-    0x5402821c, 0x2908089a, 0x35100001, 0x06030e52, 0x1115270b, 0x15110f0f,
-    0x03060b27, 0x2326370b, 0x12163c20, 0x40300917, 0x31430101, 0x0d0b1a0d,
-    0xa5546016, 0x15280805, 0x1d280440, 0x08120b0f, 0x2a3f2b01, 0x12080101,
-    0x2317100b, 0x05014609, 0x121f090a, 0x1e1e2f0b, 0x1e120b2f, 0xc0040b09,
-    0x8405af54, 0x0804849e, 0x6b01ab22, 0x00000900, 0x11232701, 0x17333533,
-    0x33013533, 0x782ac008, 0x40019608, 0x9595fe2b, 0x0400d52a, 0x0548278a,
-    0x01002705, 0x27231533, 0x32821523, 0x22064857, 0x5f271523, 0x2f4b051f,
-    0x82332006, 0x27173517, 0x3b153335, 0x01231501, 0x08967833, 0x2ac02a78,
-    0x162a2b2b, 0x2b200482, 0x2a220082, 0x0b824016, 0x40012a28, 0x01952ad5,
-    0x1982d66b, 0x19842a20, 0x0d830484, 0x43412b20, 0x219f8506, 0x738a0011,
-    0x83150721, 0x27232fa7, 0x96763501, 0xc02a760a, 0x600b8096, 0x4a860b55,
-    0x82802b21, 0x2d3b8601, 0x008001ac, 0x0030001c, 0x16321300, 0x1c45011d,
-    0x013e3305, 0x06141535, 0x27012e07, 0x011d010e, 0x36341123, 0x19871517,
-    0x0e352723, 0x2c198501, 0x120c0980, 0x222c192b, 0x2626301c, 0x2e068430,
-    0x021e0c2a, 0x2e1e2232, 0x010d1f1e, 0x82111901, 0x32222c08, 0x090c8001,
-    0x010b0713, 0x82032503, 0x85ab2002, 0x82058206, 0x0c0926d1, 0x1c025a5b,
-    0x260c8202, 0x4b011301, 0x82010901, 0x17022109, 0xff299783, 0x019601ea,
-    0x00030096, 0x33978206, 0x01231133, 0x2b953507, 0xaa00012b, 0x56fe9501,
-    0xee771501, 0x85099b41, 0x93bd9dbf, 0x22979ca9, 0x59000100, 0x06200763,
-    0x152e8182, 0x23131533, 0x96409537, 0x95015656, 0x8782c0ea, 0x099b5418,
-    0xa782da20, 0x0a000233, 0x00001100, 0x27173701, 0x37330723, 0x25331733,
-    0x3c328411, 0x19196701, 0x29452a04, 0x290f440f, 0x954066fe, 0x1d015555,
-    0xc0784e4e, 0xffc02b2b, 0x20478200, 0x091345c0, 0x052def83, 0x00000e00,
-    0x23372325, 0x07251715, 0x3c758217, 0x01371737, 0xd656566b, 0x1bfcfeb5,
-    0x584d406a, 0x2eaaeb1b, 0x6b1bceb5, 0x5983c04f, 0x0d1b7d1b, 0x07000334,
-    0x14000b00, 0x27370000, 0x21370721, 0x35032135, 0x4f181533, 0xc0260801,
-    0x40000140, 0xd782ff40, 0x4080c022, 0x27050d43, 0x806a6aeb, 0xea56fe2a,
-    0xef42cf82, 0x4b042009, 0x354a083b, 0x00122205, 0x07b54900, 0x23073723,
-    0x2e578327, 0x2b271507, 0x1b65011b, 0x40c08050, 0x83ef6b44, 0x2f403253,
-    0xfe1b5001, 0x4f4f1b9b, 0x6a6a9bcf, 0x2ec02a16, 0x0c474d2e, 0x82000d21,
-    0x0e252eac, 0x37230701, 0x3e330717, 0x37353701, 0x24058205, 0x37270733,
-    0x31158223, 0xc0010715, 0xa0526c02, 0x39271e70, 0x2b015440, 0x0d8b80fe,
-    0x6c52c023, 0x25198202, 0x6b405401, 0x0b8a952a, 0xad180020, 0x103b0d93,
-    0x19001500, 0x22001d00, 0x2b002600, 0x34002f00, 0x3c003800, 0x33250000,
-    0x82352335, 0x23072b03, 0x33161411, 0x25213521, 0x1185013e, 0x15831520,
-    0x1e23352d, 0x15231301, 0x33153733, 0x82032634, 0x22032308, 0xce4e0706,
-    0x33152406, 0x822b4001, 0x2bd52500, 0x00011219, 0x2a22e782, 0x0e821912,
-    0xd52b2b32, 0x6718012b, 0x2b802a2a, 0x2a2a9219, 0x01181255, 0x55201584,
-    0x55221782, 0x238200ff, 0x18012a26, 0x802b8012, 0x1b822082, 0x1c822a20,
-    0xff181328, 0x2b012b00, 0x13831318, 0x00090022, 0x01200082, 0x31056f62,
-    0x000b0007, 0x001f001b, 0x00280023, 0x0030002c, 0x9d823b00, 0x99821720,
-    0x82051956, 0x1e15248c, 0x77331701, 0x03200570, 0xcf831782, 0x23351325,
-    0x86271614, 0x2b9528d8, 0x2a2a562b, 0x6bd5d5aa, 0x12250746, 0x2b671919,
-    0x8270822b, 0x85192078, 0x2b2b23b0, 0x7d82d555, 0x13232187, 0x8280fe18,
-    0xd5fe28ac, 0x5519122b, 0x532a2b2b, 0xd62408d3, 0x17009601, 0x2206c74c,
-    0x18271700, 0x2e0c1261, 0x2b012e35, 0x1d062201, 0x14150301, 0x83211716,
-    0x03290891, 0x01231533, 0x60353315, 0x01121835, 0x18181256, 0x0c014012,
-    0x0c09c009, 0x01090c15, 0xea0c0900, 0x00014040, 0x01351515, 0x2c1b834b,
-    0x1812aafe, 0x0c0c0995, 0x80019509, 0x06ed7780, 0x5600ff27, 0x16165601,
-    0x06175500, 0xab01c02d, 0x0e000500, 0x42003c00, 0x82370000, 0x012e21f8,
-    0x14260582, 0x34262206, 0x0e820736, 0x82373221, 0x3632237b, 0x415c013d,
-    0x3e272206, 0x05344601, 0x26343522, 0x26239a83, 0x83010e27, 0x010e2227,
-    0x34198213, 0x0240010e, 0x6c02526c, 0x1e1e176e, 0x721e1e2e, 0x11171e01,
-    0x2a09820d, 0x1e17110d, 0x0e100101, 0x9101100e, 0x52882612, 0x6c52026c,
-    0x240584ab, 0x2d1e01a2, 0x3402821e, 0x011e1665, 0x1e160409, 0x0904161e,
-    0x11161e01, 0x19070619, 0x21438310, 0x5a820409, 0x14821720, 0x10264782,
-    0x19060719, 0x7184f5fe, 0x01000023, 0x05db4600, 0x11006b24, 0x86180000,
-    0x21200802, 0x2305c741, 0x80d5012b, 0x20084f6d, 0x0db26c12, 0x1813d522,
-    0xfb503982, 0x01d62a06, 0x0007006b, 0x00220010, 0xb9611800, 0x23372310,
-    0x99182327, 0x3d250938, 0x01263401, 0xb4611895, 0xab7d220c, 0x2065892b,
-    0xa8611855, 0x18252209, 0x0bbc6d40, 0x0b6e7085, 0x00112109, 0x01208082,
-    0x2005156d, 0x06535507, 0x1f33372b, 0x23352301, 0x01172315, 0x07ca41ab,
-    0x8012182c, 0x2a469b2b, 0x40015b46, 0x59421219, 0x00012a06, 0x2b011812,
-    0x5b555595, 0x20008200, 0x08034104, 0x09000437, 0x20000e00, 0x33010000,
-    0x17272317, 0x17333723, 0x17372707, 0x2fc39207, 0x3f3d3325, 0x1e766636,
-    0x17ac066d, 0xa635203c, 0x012cc48b, 0xa1616b00, 0x2e2c0a36, 0xeb5f396a,
-    0x0429c39b, 0x00001600, 0x3717013f, 0x25619117, 0x364a606b, 0x1b41164a,
-    0x6080230c, 0x4f8d6040, 0x82191221, 0x880320bb, 0x001126bf, 0x0026001d,
-    0x12154100, 0x35233533, 0x0622012e, 0x15231507, 0x1d163237, 0x34352301,
-    0x0d234136, 0x0115952c, 0x01243624, 0x0c095515, 0x2b410c2a, 0x56eb2910,
-    0x24241b15, 0x8056151b, 0x4109e356, 0x23200b8b, 0x34257597, 0x15163236,
-    0x8e7b8733, 0x0c6a2472, 0x852b0c12, 0x2a719276, 0x0c0c092a, 0x24241c09,
-    0x49562a1c, 0x6b270883, 0x18000600, 0x82250000, 0x353321cf, 0x24123541,
-    0x56562b01, 0x0c35416a, 0x55404025, 0x41956a40, 0xbb820f85, 0x02eaff2d,
-    0x00960100, 0x001a0011, 0x59230100, 0x36250a4e, 0x2634013d, 0x07874505,
-    0xaad50123, 0x070f582b, 0x19125533, 0x2b44fe19, 0x80011219, 0x6b0180fe,
-    0xff12182a, 0x25128200, 0x1812d512, 0x0483fe2a, 0x00030023, 0x24578600,
-    0x00160004, 0x0add411f, 0x8d08ad59, 0x6095255e, 0x154b354b, 0x80256296,
-    0x60406080, 0x8a6692eb, 0x20bf8367, 0x23c1821e, 0x011d011e, 0x27053d57,
-    0x013e1127, 0x0517013b, 0x25076058, 0x35211533, 0xa783d501, 0xc353fe20,
-    0x2b802306, 0xc28300ff, 0x80191228, 0x6b015501, 0xc1821801, 0xd5821920,
-    0xc7820020, 0xd5fe2b22, 0x01237082, 0x47d5d52b, 0x5b8206f3, 0x6b01d622,
-    0x297e7182, 0x43352006, 0xd37011d0, 0x0ac64305, 0x2bd54022, 0x200f7141,
-    0x0ac34100, 0x1d001126, 0x17130000, 0x43061e72, 0x172008bd, 0x210acd61,
-    0xc1432bd5, 0x40eb280a, 0x40402b40, 0x432b6b01, 0x6b200dc1, 0x2b211583,
-    0x96a78d40, 0x181f205b, 0x8c0a6eb7, 0x2db5275b, 0x2e2d1e2d, 0x02822e1e,
-    0x61902d20, 0x19879320, 0x2d2d1e22, 0x7b44bf8c, 0x07172713, 0x35331533,
-    0xe4422733, 0x441b200d, 0x5622157b, 0xb7835a56, 0x04830420, 0xd6012908,
-    0x07008001, 0x17000f00, 0x00002600, 0x27330321, 0x03331737, 0x16323325,
-    0x36342315, 0x07061417, 0x35012e23, 0x37173337, 0x0d851282, 0x01363434,
-    0x182f204b, 0x20531b25, 0x1c6ab6fe, 0xc624ea24, 0x07821c24, 0x206b1529,
-    0x0c091520, 0x82c0090c, 0x15013a04, 0xfe6b0a61, 0x1c24d5eb, 0x1b95241c,
-    0x24010124, 0x2020401b, 0x010c120c, 0x06276b01, 0x01eaff2b, 0x009b01c5,
-    0x2500001a, 0x06474b16, 0x012e0729, 0x17013e37, 0x83260635, 0x33230805,
-    0x01163615, 0x275d19ab, 0x0e0e141e, 0x5d271e14, 0x22522219, 0x4e023d58,
-    0x52222a45, 0x0abc3aeb, 0x82011301, 0xbc0a3d02, 0x120e2e3a, 0x0f3c2940,
-    0x6b2b4523, 0x02000e12, 0xeaff0000, 0x8001d801, 0x1d000d00, 0x0e215d82,
-    0x08c38301, 0x33352733, 0x33071737, 0x36262305, 0x23373637, 0x23153335,
-    0x011e1716, 0x3001d501, 0x30244024, 0x223a9101, 0xebfe2d30, 0x05030195,
-    0x6b0d1209, 0x050a110d, 0x82178302, 0x652b2f1e, 0x30805213, 0x55523261,
-    0x52552b2b, 0xb7496132, 0x01af3908, 0x0014006f, 0x13000030, 0x041e023e,
-    0x042e040e, 0x011f013e, 0x27371737, 0x27240388, 0x17072707, 0xa02b0387,
-    0x3c43411b, 0x01050b23, 0x88352510, 0x13162a09, 0x19131a1a, 0x1a131a23,
-    0x20078224, 0x2c0d8c19, 0x251a2001, 0x0b050110, 0x41433c23, 0x22098835,
-    0x82191396, 0x212d8226, 0x2e85231a, 0x9b820d8a, 0x03820720, 0xb9010026,
-    0x10007901, 0x18289d82, 0x20001c00, 0x28002400, 0x012ea583, 0x07163637,
-    0x0607030e, 0x013e3726, 0xa8820717, 0x3f210385, 0x22078201, 0x8417010f,
-    0x24a58207, 0x114f4c21, 0x85a38208, 0x085d2407, 0x8218082d, 0x07582803,
-    0x0713072d, 0x8283082d, 0x083e2307, 0x9d83072e, 0x4f110824, 0x9b82214c,
-    0x25820786, 0x03824220, 0x21820220, 0x2e076d28, 0x2d082808, 0x0b829807,
-    0x0003002f, 0x01feff00, 0x008001d6, 0x002e0008, 0x0a316432, 0x011e2722,
-    0x2605c26f, 0x27012e07, 0x820e0723, 0x26222504, 0x35373634, 0x2b080583,
-    0x2637013b, 0x3e27012b, 0x33150301, 0x0e200137, 0x121c1212, 0x664d0e12,
-    0x0e060102, 0x2334453e, 0x1c110324, 0x3d080d02, 0x090c0c09, 0x502b0383,
-    0x0915100a, 0x68660201, 0x83c01305, 0x121c372a, 0x496002c0, 0x061f3219,
-    0x2f01064a, 0x08085c26, 0x0c120c01, 0x04824001, 0x1508232b, 0xedfe6049,
-    0x05004040, 0x0d6b4a00, 0x13000f2d, 0x21130000, 0x33172115, 0x8a072315,
-    0x01402807, 0x5580fe80, 0x8b55d6d6, 0x80012407, 0x852b2a2b, 0x98468202,
-    0x8215204b, 0x84038b47, 0x8d47834b, 0x204bba03, 0x05574500, 0x07870120,
-    0x172097a5, 0xe3849782, 0x97840786, 0x44838020, 0x99838020, 0xe78d0989,
-    0x2605f747, 0x006b017b, 0x7f0f0007, 0x33250625, 0x06141632, 0x23058427,
-    0x3e172307, 0x2f059664, 0x013e3311, 0x01012e37, 0x0e4b4b20, 0x40591212,
-    0x0e340482, 0x13107840, 0x86252f01, 0x012c2297, 0x40751801, 0xbf121b12,
-    0x012e0382, 0x10200b1b, 0xfe013025, 0x222e01d5, 0xb74f2718, 0x56350808,
-    0x10000800, 0x15130000, 0x17073317, 0x21353337, 0x33071707, 0x80371737,
-    0x2d0f333c, 0x9bfe7c22, 0x4034941b, 0x011b7921, 0x243c0455, 0x1b40502c,
-    0x794e7b94, 0x091b5b1b, 0x0a00c026, 0x1c000d00, 0x27050944, 0x36321614,
-    0x25012e35, 0x27203f82, 0x06204782, 0x093d4618, 0x02952908, 0x24180226,
-    0xfe250319, 0x256766d7, 0x6e331fbe, 0x0a760909, 0x0a750a19, 0x173202cb,
-    0x12181812, 0x66223217, 0x1ebf1666, 0x1a201982, 0x02821682, 0x49001a21,
-    0xab4c08c3, 0x820f2009, 0x153323ab, 0xf1412723, 0x80c0230a, 0xe8418080,
-    0x822b2008, 0x802b27e0, 0x2bd52bd5, 0x3e822b2a, 0x42060021, 0x1720127f,
-    0x35204385, 0x05244382, 0x17352315, 0x07200382, 0x40204f86, 0xd5244a87,
-    0x01abd5d5, 0x80234c83, 0x830180fe, 0x2b2a2650, 0x2a2a562b, 0x42568355,
-    0x95821587, 0x4d915187, 0x80204b8d, 0x9b824886, 0x01209f96, 0x25204d82,
-    0x9b839382, 0xdd420383, 0x82012007, 0x058a42a0, 0x82d5d521, 0x18a096aa,
-    0x220cf75a, 0x8416000b, 0x353328ef, 0x35231133, 0x82231523, 0x07352b08,
-    0x11333735, 0x2b401533, 0x02822b55, 0x352aeb2a, 0x012b2b35, 0xfe80806b,
-    0x2b265582, 0x1f311ece, 0x751800ff, 0x6b20094b, 0x22051758, 0x88153313,
-    0x23213543, 0x3f342622, 0x26343601, 0x23150622, 0x1632013e, 0x33010f14,
-    0x01324e86, 0x18128080, 0x180c680b, 0x012b1924, 0x18304930, 0x5b878067,
-    0x0c23192e, 0x19240c6f, 0x30251219, 0x6e184930, 0x8309bb63, 0x8d272063,
-    0x330121a7, 0x2505fa48, 0x2622012b, 0x7c833527, 0x33352322, 0x3522c083,
-    0x6987013e, 0x12550022, 0x55254c82, 0x2b011812, 0x22008255, 0x8718012b,
-    0x82012069, 0x05fd480b, 0x55151526, 0x1515552b, 0x0b475318, 0x8301c021,
-    0x0016226f, 0x24718d19, 0x35233521, 0x25688237, 0x27152315, 0x63870735,
-    0x6b6b4027, 0x2b15152b, 0x28598736, 0x96962a6b, 0x4d956b2a, 0x099f484d,
-    0x2a204f85, 0x01214d8d, 0x82478233, 0x061423c3, 0xc1862307, 0x34363223,
-    0x8ace8526, 0x245e82c2, 0x24303024, 0x82c4832b, 0x12182104, 0x01200482,
-    0x2b2cc88b, 0x49300155, 0x12190130, 0x24181515, 0x9f4dee85, 0x22778506,
-    0x8f280024, 0x011e2779, 0x3523011d, 0x42411523, 0x013e250c, 0x35331517,
-    0x200b3a41, 0x05136e2b, 0x7a825520, 0x12180123, 0x0c3b4155, 0x55151522,
-    0x064b1383, 0x55aa2206, 0x06334455, 0x6b01b426, 0x11000b00, 0x2526718d,
-    0x27071707, 0x4e425537, 0x5f012605, 0x6a1f4d4d, 0x264d876a, 0x1e4c4de2,
-    0x44006b6a, 0x3f830933, 0x42050746, 0x37270a51, 0x07153335, 0x86231533,
-    0x95d62143, 0x41870082, 0x6f2aab21, 0x7f920c13, 0x07173725, 0x86273717,
-    0x4de2253b, 0x6b6b1e4d, 0x33417e90, 0x84eb2006, 0x002722bf, 0x24c18d2b,
-    0x33373337, 0x21038407, 0x87832315, 0x37230723, 0x23038323, 0x23373335,
-    0x36411883, 0x32d52c06, 0x2b072b06, 0x24062a07, 0x8b2d0429, 0x0458230b,
-    0x7287042a, 0x8240d521, 0xeccc1800, 0x822b2008, 0x12874469, 0x16001225,
-    0x51370000, 0x272b0644, 0x01352115, 0x35213521, 0x82173517, 0xd5eb2112,
-    0xab200082, 0x2407d444, 0xd5d55655, 0x2a4e82ab, 0xfe2b2b55, 0x55952b80,
-    0xa32bc0aa, 0x8203204f, 0x15272348, 0x56820737, 0x55834f87, 0x83555521,
-    0x244f8757, 0xaa952bd5, 0x214f8255, 0x00820001, 0x0180012d, 0x000b006b,
-    0x33151300, 0x82152307, 0x249e823e, 0x3c482fd5, 0x240382ab, 0xab406b01,
-    0x45028240, 0xd6220893, 0x3b5b7601, 0x82152006, 0x826482c7, 0x300582c2,
-    0x33072135, 0x15330727, 0x23371723, 0xff0001d5, 0x34038700, 0x4b4a3555,
-    0x4a4b3535, 0xaa2aab35, 0x2a2ad62a, 0x4ad64a4a, 0x20c7884a, 0x264b8460,
-    0x00190010, 0x8226001d, 0x15212681, 0x21351521, 0x084d7415, 0x08bd4a18,
-    0x158b1720, 0x2b019524, 0x0382d5fe, 0x120e9527, 0x12121b12, 0x2006850d,
-    0x2611894d, 0x802a5501, 0x48b52a2a, 0x802005ae, 0xb5230685, 0x85352a2a,
-    0x45cb8209, 0x6b24077f, 0x06000200, 0x08615d18, 0x17370024, 0xc3823723,
-    0x013e1329, 0x06222634, 0x41131614, 0xe182079f, 0x6b356b2d, 0x2b55550b,
-    0x24181812, 0x8b671919, 0x60f523e2, 0xf08256d6, 0x82241821, 0x0118291a,
-    0xfe2a2a3f, 0x2a562ad6, 0x6b20e388, 0x22082f41, 0x4127001b, 0x07250f33,
-    0x23353315, 0x82028237, 0x33152206, 0x577c8203, 0x232006a5, 0xe883e487,
-    0x266ad52a, 0x27274026, 0x2a151540, 0x40210285, 0x054e4140, 0x142c802f,
-    0x2a142c16, 0x00ff1656, 0x160a160a, 0x56da8256, 0xc02c0643, 0x1f009601,
-    0x35010000, 0x21232634, 0x2e06cf53, 0x3d013e21, 0x23153301, 0x3b161415,
-    0x82363201, 0x0135260b, 0xff090c80, 0x05165300, 0x07820120, 0x0cd5152f,
-    0x0c092b09, 0x156b01ab, 0x090c0c09, 0x22198555, 0x83eb5515, 0xabc0210d,
-    0x2609fb44, 0x006b016b, 0x82110009, 0x011e2961, 0x23070614, 0x17112315,
-    0x3e05e744, 0x25150115, 0x2a253030, 0x1912552b, 0x012a1219, 0x4930016b,
-    0x01800130, 0x2418802b, 0x44005519, 0x962a064f, 0x06002b01, 0x00000d00,
-    0xfe823325, 0x07331522, 0x012f0685, 0x802a402b, 0x2b40d540, 0x56554080,
-    0x82568080, 0x52738903, 0x0f210597, 0x06177600, 0x37233525, 0x82113315,
-    0x40352101, 0xc02f0082, 0x6a406b80, 0x409595c0, 0x00ff406b, 0x45400001,
-    0x03230a2b, 0x83000b00, 0x35212235, 0x37318221, 0x33353315, 0x35330335,
-    0x80014023, 0x6a2b80fe, 0x56c06a56, 0xab2b9556, 0x40234382, 0x4c40c0fe,
-    0xeb2606eb, 0x14009f01, 0x9f822500, 0x16231535, 0x012e0706, 0x011e1737,
-    0x37361637, 0x21272636, 0x82232535, 0x010e2606, 0x17160617, 0x081a8223,
-    0x0116364b, 0x2a145eeb, 0x06327f6f, 0x0e3f0455, 0x0105330c, 0xfdfe141c,
-    0x03558901, 0x12343514, 0x29180103, 0x7e080b86, 0x2bc03986, 0x08067c28,
-    0x3301087a, 0x10010317, 0x091b1124, 0x3404582b, 0x072b0304, 0x080c2006,
-    0x7c091a86, 0x247f8400, 0x01d301ff, 0x82b58240, 0x0701227f, 0x9af01817,
-    0x23132608, 0x013e3735, 0x347b8235, 0x27010f22, 0x1e33013e, 0x06141501,
-    0x3315010f, 0x62625501, 0x3602871e, 0x1813689b, 0x0d0c0118, 0x090e0909,
-    0x190f1908, 0x0e10161a, 0x8a220137, 0xbffe3621, 0x1c151116, 0x010b090c,
-    0x07190804, 0x141a0109, 0x0b0e1e12, 0x069b4101, 0x9601d322, 0x17207b91,
-    0x23207b87, 0x17227b85, 0x7bb51632, 0x12154027, 0x090c1d14, 0x2479850c,
-    0x1f121519, 0x2379820d, 0x00010000, 0x012d0082, 0x006b01a4, 0x0100001f,
-    0x032e0717, 0x08dd822b, 0x33021e20, 0x32352315, 0x013d023e, 0x020e2223,
-    0x01372707, 0x0714188b, 0x0914110f, 0x130b0236, 0x0382800b, 0x09360238,
-    0x070f1114, 0x6b011814, 0x190f065d, 0x08e0030d, 0x1502080e, 0x06820215,
-    0x0d03e026, 0x5d060f19, 0x0ce76018, 0x15000628, 0x27250000, 0x01822115,
-    0x62150321, 0x35290607, 0x14010e23, 0x55c00116, 0x388982ff, 0x2b2a2bab,
-    0x3024ab2b, 0x40554030, 0x0001402a, 0xebebeb6b, 0x4830012a, 0x23478830,
-    0x009601ab, 0x37274784, 0x35170735, 0x8d273521, 0x56ab2647, 0xd6000156,
-    0x8346822b, 0x40552245, 0x20478255, 0x21458996, 0x00820002, 0x01960139,
-    0x00030080, 0x33000014, 0x37213521, 0x3537013e, 0x010e1523, 0x82272622,
-    0x011e2f07, 0xfe2a016b, 0x493695d6, 0x2a013501, 0x05822a40, 0x2a2b492f,
-    0xab364802, 0x2b2b1fab, 0x36abab1f, 0x0c274b48, 0x8d820220, 0x0e000a28,
-    0x17130000, 0xe24a1123, 0x82072006, 0x6aab2207, 0x055046d5, 0x84eb9521,
-    0xd62b2907, 0xd52b2b01, 0x2b552b2b, 0x13583e82, 0x2e3f870a, 0x00160012,
-    0x001e001a, 0x01000022, 0x82032317, 0x33152841, 0x15252315, 0x8f053523,
-    0x221b8207, 0x4d6b0001, 0x402605ba, 0x40800140, 0x068dc0fe, 0x2a217089,
-    0x2100822b, 0x00822a56, 0x08825520, 0x09207c85, 0xbe08a34b, 0x80802d7b,
-    0xff808001, 0x01555500, 0xd5fe5580, 0x7b9d8286, 0x23056b4d, 0x008001c0,
-    0xeb877b85, 0xd38b1120, 0xfe224289, 0x9f732bd6, 0x0d39080b, 0x00001a00,
-    0x012e3525, 0x06222123, 0x33371115, 0x23373632, 0x14152115, 0x17013b16,
-    0x01263411, 0x090c016b, 0x0c09ebfe, 0x0c09d555, 0xebfe2b56, 0x55eb090c,
-    0x09c0c00c, 0x2516820c, 0x890c56d5, 0x1b822bc0, 0x6c400121, 0x0120055b,
-    0x3508c35d, 0x01000006, 0x35071735, 0x00013523, 0x01ababab, 0xabab5615,
-    0x1e83aa56, 0x0000032e, 0xa001eaff, 0x27009601, 0x43002b00, 0x07282782,
-    0x2307010e, 0x011d0622, 0x1e217483, 0x05a25e01, 0x2623072f, 0x0f060706,
-    0x27260601, 0x37013e11, 0x82178233, 0x23272206, 0x2f96820e, 0x36011e14,
-    0x3b36023f, 0x3f013e01, 0x36373601, 0x4808a582, 0x0508010a, 0x0e0e0853,
-    0x07064608, 0x02100201, 0x3d060701, 0x09050908, 0x04011e1b, 0x070e0101,
-    0x010705b5, 0x23092303, 0x011217e4, 0x0710080a, 0x02010366, 0x020e1546,
-    0x06091115, 0x35550110, 0x09010604, 0x09080808, 0x2f338201, 0x0703062d,
-    0x06050101, 0x01231f0b, 0x15010102, 0x01318582, 0x990fd00e, 0x1901362b,
-    0x0c96fe0c, 0x0701030c, 0x26188276, 0x4c5c0a16, 0x821b1b2b, 0x840520d4,
-    0x829620d3, 0x001523d3, 0xc7660019, 0x33002405, 0x66352315, 0x3b2005ab,
-    0x82070a7d, 0x15032111, 0x2005b145, 0x821e8317, 0x2bc02603, 0x12181812,
-    0x220483d6, 0x82d6ab2b, 0x2a162100, 0x15250082, 0x01121915, 0x30148340,
-    0x1912c0fe, 0x6b011515, 0xc0fe6b6b, 0xc04015aa, 0x216e822b, 0x6f880400,
-    0x6f860920, 0x3313002e, 0x011d1632, 0x36343521, 0x23061401, 0x03836882,
-    0x3d262225, 0x82272101, 0x82072071, 0x82952003, 0xd6fe2864, 0x18120118,
-    0x82802b12, 0x2a012275, 0x296982ea, 0x12189501, 0x18126b6b, 0x678396fe,
-    0xc0267783, 0x952a2a6a, 0x678d4040, 0x67880320, 0x15333523, 0x216b8227,
-    0x668b1115, 0x34113524, 0x67861736, 0x402aab22, 0x6483ce85, 0xc028da82,
-    0x2b15012a, 0x1218802b, 0xda87ca85, 0x6b6b2a23, 0x896583ab, 0x073b41cb,
-    0x22130023, 0x215e8206, 0x87443316, 0x36322106, 0x26205e82, 0x2305d34a,
-    0x37231533, 0x95221682, 0xc5861812, 0xc0121829, 0xd6162a2a, 0x832a16d6,
-    0x23628dc9, 0xaa402b55, 0x6382c984, 0x0100002c, 0x00560196, 0x000b0005,
-    0x3f4f0011, 0x824b8206, 0x2335214f, 0x22058b41, 0x82231523, 0x6a6b33db,
-    0x6ac02a40, 0x2a40402a, 0x6a96406a, 0x2a55012a, 0x09846a40, 0x00200f82,
-    0x25204792, 0x15224182, 0x47842723, 0x05833720, 0x84013b21, 0x2b012147,
-    0xea23488a, 0x84952a6a, 0x83088247, 0x05274347, 0x7c01922b, 0x00002300,
-    0x0f062601, 0x32398201, 0x27010e07, 0x3727012e, 0x1617011e, 0x23013f36,
-    0x77373335, 0x0735050d, 0x4d01012e, 0x06021a12, 0x0409403c, 0x21162434,
-    0x1404200b, 0x2310820d, 0x0643400a, 0x01311088, 0x1216014f, 0x246c2b3d,
-    0x1602022c, 0x100c2010, 0x220f8201, 0x88412b68, 0x0ca35c0f, 0x09000426,
-    0x13000e00, 0x28087d82, 0x35331707, 0x35331505, 0x1523012f, 0x35013f33,
-    0x01171523, 0x75404060, 0x4080ebfe, 0x40757560, 0x01408060, 0x80404000,
-    0x830b85a0, 0x57611812, 0x82402008, 0x001f2841, 0x00310028, 0x82331300,
-    0x010e29b7, 0x27262207, 0x23010e23, 0x3e21c882, 0x0b355701, 0x08945a18,
-    0x2e087b62, 0x4836d695, 0x36480202, 0x1612311d, 0x841d3112, 0x2b21260c,
-    0x2a2a2b2b, 0x05054ba0, 0x06853320, 0x0140012b, 0x49363649, 0x14141701,
-    0x20098417, 0x0506533f, 0x024b4020, 0x49068605, 0x2d080623, 0x008001b6,
-    0x000c0008, 0x25000038, 0x36342622, 0x06141632, 0x3335012b, 0x07273117,
-    0x15010e17, 0x32331614, 0x06141537, 0x013d2622, 0x1982012e, 0x2405935d,
-    0x35331107, 0x06195d33, 0x80013422, 0x3305de5f, 0xa6808089, 0x0f2d174f,
-    0x0b171e13, 0x0c120c0a, 0x15121801, 0x80290382, 0xd6011812, 0x1e2e1e20,
-    0x05f45feb, 0x4f2f6a2b, 0x1b062d16, 0x041e1711, 0x3238829a, 0x18136009,
-    0x18181395, 0xa0abfe13, 0x1e1e166b, 0x4b17cb16, 0xeb30063f, 0x2b005601,
-    0x33002f00, 0x3b003700, 0x00003f00, 0x1812316a, 0x210aed53, 0xc6431133,
-    0x21078307, 0xad423307, 0x8a372005, 0x2bc02307, 0x00822b2a, 0x86076054,
-    0x0531750a, 0x2a2a5625, 0x822b2b55, 0x55012502, 0x2a55556a, 0x8205cc5e,
-    0x29028221, 0x552a0001, 0x6a6a6a55, 0x00875595, 0x00820020, 0x52180620,
-    0x0b220873, 0xa5821c00, 0x41003824, 0x72184a00, 0x2e200b23, 0x2406185e,
-    0x23012e07, 0x30048206, 0x17013e27, 0x06010f06, 0x011e0607, 0x26363736,
-    0x21038327, 0x75730726, 0x20088807, 0x08877333, 0x0bf68d18, 0x495b2408,
-    0x1e010260, 0x203a171b, 0x1e1b3041, 0x74600201, 0x181d070d, 0x220d060a,
-    0x04040720, 0x06031e07, 0x415a0409, 0x49200587, 0xcd200685, 0x01210685,
-    0x5f471895, 0x2823080a, 0x27496002, 0x16151841, 0x41182a01, 0x27604927,
-    0x05490d01, 0x0d201116, 0x160b110d, 0x0f094b09, 0x41020104, 0x402005a5,
-    0x0b4d7018, 0x0021ee82, 0x08ef8402, 0x9801d824, 0x3b003100, 0x013f0000,
-    0x22060727, 0x3426012f, 0x3236013f, 0x1416011f, 0x3617010f, 0x07141632,
-    0x0f873717, 0x29831f87, 0x25342622, 0x2d05a250, 0x31373634, 0x070f1ecd,
-    0x06100611, 0x06827906, 0x07070f34, 0x11061f0f, 0x0f1e060d, 0x0f061206,
-    0x07780606, 0x06820711, 0xcd1e0f22, 0x01271582, 0xd5181280, 0x820f1219,
-    0x06062132, 0x07213582, 0x202e8278, 0x25208206, 0x110d061e, 0x43821f06,
-    0x0d821020, 0xcd201488, 0x22281582, 0x15121801, 0x01181215, 0x8029b386,
-    0x16006b01, 0x00001f00, 0x05724301, 0xba7c1520, 0x05764309, 0x010e3808,
-    0x36321614, 0x00012634, 0x01014936, 0x2b2b2f3b, 0x2f2b2b2a, 0x4901013b,
-    0x30302436, 0x01303048, 0x3648026b, 0x2c094531, 0x2b2a2a2b, 0x3145092c,
-    0x01294836, 0x82304930, 0x82638302, 0x01c02b59, 0x00140080, 0x1300001d,
-    0x0e591716, 0x07352305, 0xb7641716, 0x013e2105, 0x08345918, 0x202ac028,
-    0x2bab626d, 0x5b83176d, 0x61886c83, 0x17010029, 0x62ab2b6d, 0x852a216c,
-    0x49362316, 0x7a83012a, 0x2108774a, 0xd74d01d5, 0x6d282005, 0x07250851,
-    0x06141516, 0x23cd8f07, 0x07171637, 0x7729d088, 0x512b954c, 0x2b253011,
-    0x38b9822b, 0x01012f25, 0x1a202e3c, 0x24241c3a, 0x01242437, 0x4d952a6b,
-    0x27211a52, 0x82d78239, 0x092c2d20, 0x3d2d2739, 0x19110101, 0x24362401,
-    0xc0180282, 0x2f220bd7, 0x778a3800, 0x778ecf82, 0x27373633, 0x27372707,
-    0x33352315, 0x37172315, 0x36170717, 0x20878a32, 0x25f482a2, 0x01011167,
-    0x8882262f, 0x262b2b22, 0x11328982, 0x1e1e1e19, 0x4d962b30, 0x1f1f1e30,
-    0x1a421a19, 0x74831b3b, 0x80012426, 0x6762ab2b, 0x2122968d, 0x2c831a19,
-    0x2b964d28, 0x1e1f1f30, 0xa28a1119, 0x26053f5d, 0x9601c001, 0x41000d00,
-    0x0e2505e5, 0x37150701, 0x2c018317, 0x07012e35, 0x06141632, 0x36342622,
-    0x0d5b1833, 0x52002408, 0x8440026c, 0x6c022800, 0x18181292, 0x86181824,
-    0x95012506, 0xea526c02, 0x40271a84, 0x7e6c52ea, 0x76192418, 0x058205da,
-    0x7b6f0020, 0xeb250808, 0x2c009601, 0x34003000, 0x46003d00, 0x4e004a00,
-    0x15250000, 0x21230614, 0x013d2622, 0x35272622, 0x013b013e, 0x82058226,
-    0x31172672, 0x3e313717, 0x21098301, 0x05830714, 0x010e152b, 0x23353305,
-    0x15233505, 0x07a64103, 0x08873720, 0xc1470520, 0xd5013806, 0xaafe1218,
-    0x0c091812, 0x12180101, 0x24010444, 0x091b101b, 0x82090c0c, 0x01243006,
-    0x18124404, 0xfe0c0101, 0x01969677, 0x43559656, 0x772005e6, 0xfe260685,
-    0xab2aabf7, 0xd582abc0, 0x0cab123a, 0x19124009, 0x241c0b0a, 0x10100c0e,
-    0x1c240e0c, 0x12190a0b, 0xab0c0940, 0x01220083, 0xe1430156, 0x21498205,
-    0x0a820c12, 0x822a5521, 0x22e38200, 0x7f000001, 0x33280643, 0x013f0000,
-    0x17160617, 0x1526b382, 0x3632011e, 0xdc823437, 0x15061722, 0x28052d43,
-    0x27072227, 0x07012e36, 0x0eef4327, 0x7c372508, 0x0d0b0424, 0x18010c0a,
-    0x0c011824, 0x19012c0a, 0x12181824, 0x04370506, 0x240e1d0d, 0x0d220d11,
-    0xab0c0cab, 0xde340684, 0x1a0e257c, 0x13067607, 0x1919120c, 0x06130c12,
-    0x06052c67, 0x3882bb82, 0x0f370227, 0x24030c1c, 0x832a8711, 0x83002031,
-    0x01ff269b, 0x008001c0, 0x45401844, 0x012b2b09, 0x3537012e, 0x013e2726,
-    0x04823437, 0x06342729, 0x07222607, 0x8215012e, 0x820620b9, 0x061736b7,
-    0x27220607, 0x26272634, 0x16321706, 0x37160617, 0x07061615, 0x056a4a23,
-    0x2a016b22, 0x2e087a83, 0x0103055e, 0x35210b02, 0x03021301, 0x171b1a07,
-    0x1a1b1732, 0x13020307, 0x09213501, 0x0e210903, 0x0b020e0f, 0x080d010b,
-    0x01271a01, 0x825e0503, 0x013a0832, 0xfe121980, 0x021912d6, 0x1a35040d,
-    0x36270209, 0x1b03151f, 0x11040214, 0x04110606, 0x031b1402, 0x27361f15,
-    0x04130702, 0x02100214, 0x0c080401, 0x061d0211, 0x020d0421, 0x72831219,
-    0xcb840020, 0xd601f426, 0x40009601, 0x33083546, 0x013d3616, 0x2e372606,
-    0x36262301, 0x15011e33, 0x36373216, 0x27210d82, 0x27048234, 0x17163437,
-    0x3e173236, 0x062d1582, 0x0e151607, 0x011e0701, 0x1614011d, 0x08f78237,
-    0x01012e78, 0x02785b00, 0x07415001, 0x011d2c07, 0x0c010f08, 0x1010020c,
-    0x030b250f, 0x023a250a, 0x08040216, 0x38191f1c, 0x081c1f19, 0x02160303,
-    0x0806253a, 0x50400807, 0x01780201, 0x5b780295, 0x01176c48, 0x07240507,
-    0x0d120321, 0x12030409, 0x15051701, 0x3c2b0208, 0x1e051623, 0x13040116,
-    0x04130707, 0x051e1601, 0x2b3c2316, 0x0f140502, 0x0107053a, 0x5b486c17,
-    0x134f0078, 0x82562008, 0x001d26c7, 0x13000023, 0x05346b33, 0x17160629,
-    0x2307031e, 0x82023e26, 0x2e2722a0, 0x32028201, 0x33171637, 0xaaab3736,
-    0x0a090c05, 0x01070716, 0x821e0a09, 0x82aa2057, 0x1e320860, 0x0701090a,
-    0x090a1607, 0x0203250c, 0x0103024c, 0x1e593095, 0x1e1a241c, 0x0614174a,
-    0x05050902, 0x14060209, 0x1a1e4a17, 0x591e1c24, 0x1e1e2206, 0xf7430022,
-    0x0003240a, 0x821e001a, 0x33152d79, 0x15212735, 0x15171107, 0x35373521,
-    0x25087082, 0x3634013d, 0x2735013b, 0x35170335, 0xd5abd523, 0x15151501,
-    0x5116d5fe, 0x12190e0c, 0x402a1640, 0x406b0140, 0x13822a40, 0x1882aa20,
-    0x261e1529, 0x950d1505, 0x822b1912, 0x1eeb2210, 0x22db8db3, 0x82070003,
-    0x11332361, 0x65821323, 0xaaaaab2c, 0x9501562a, 0x800156fe, 0x27894040,
-    0x96016126, 0x29002300, 0x0e222783, 0x984d1701, 0x08064107, 0x086e3620,
-    0x37363505, 0x14172636, 0x35263307, 0x0705aaab, 0x050e0603, 0x0d0f2808,
-    0x3c0e0c41, 0x08280f0d, 0x03060e05, 0x62072507, 0x0a950105, 0x461c1a1c,
-    0x18161518, 0x15194d1b, 0x05104107, 0x19150729, 0x16181b4d, 0x82461815,
-    0x2620271c, 0x00261a1a, 0xe74c0200, 0x000a2208, 0x2d878215, 0x011d0622,
-    0x34333533, 0x011d2326, 0xf9531423, 0x1cab2606, 0x24ea4024, 0x2b02821c,
-    0x01241caa, 0xf51c2495, 0x75241cf5, 0x09820382, 0x00000022, 0x08051f4f,
-    0x1601fe22, 0x36000f00, 0x00004600, 0x1f062237, 0x3b011e01, 0x3f363201,
-    0x23263601, 0x012e2307, 0x3626012f, 0x17241082, 0x17361716, 0x0a82d082,
-    0x010f1622, 0x82051960, 0x8322201a, 0x08368f0b, 0x0908407d, 0x0f020a01,
-    0x130b400a, 0x06011702, 0x1a402b07, 0x040a0427, 0x1c801b23, 0x0e020410,
-    0x1004020e, 0x221b801c, 0x27040a03, 0x291a401a, 0x0f071307, 0x29071306,
-    0x01060791, 0x0b130316, 0x01100940, 0x0809010b, 0x3f080beb, 0x0a0f0e0b,
-    0x96090544, 0x401a2201, 0x0514271c, 0x06030306, 0x1b271405, 0x01221942,
-    0x3a192001, 0x173c0404, 0x06099520, 0x0e0f0c41, 0x0b07410a, 0x82000200,
-    0xd6013500, 0x0b006b01, 0x00001b00, 0x07352325, 0x11231527, 0x33371733,
-    0x117d5418, 0x80802b29, 0x91911a2b, 0x67aafe1a, 0x40280831, 0xbb5050bb,
-    0x5b5b0001, 0x230b0a63, 0x18120001, 0xcb4e5682, 0x01c53905, 0x00050096,
-    0x0015000d, 0x0032001d, 0x010e0100, 0x07013e17, 0x16062322, 0x07200784,
-    0x36230782, 0x82220726, 0x36372507, 0x010e1726, 0x18820882, 0x26376f08,
-    0x06160706, 0x37362627, 0x8901012e, 0x2d251b42, 0x0203c446, 0x16150823,
-    0x04047513, 0x1014181c, 0x06055701, 0x0c122115, 0x6636a00c, 0x4662090f,
-    0x01093d23, 0x1e02034e, 0x06a12d15, 0x95012f04, 0x08086e08, 0x4f0a076e,
-    0x1d550406, 0x013f1002, 0x04314608, 0x09043314, 0x3301253a, 0x04733c33,
-    0x1b273201, 0x10181409, 0x3e492c0e, 0xae821415, 0x00010027, 0x01eaff00,
-    0x26af82cb, 0x2500001e, 0x4c331523, 0x3725077d, 0x3717011e, 0x07d06834,
-    0x013e3e08, 0x01272637, 0x088bc3c7, 0x583f3251, 0x41570102, 0x28013632,
-    0x785d484b, 0x63750202, 0x01026c58, 0x3d3ad301, 0x45550137, 0x03015743,
-    0x042a0324, 0x7c030333, 0x037e5456, 0x12586901, 0x5355180a, 0x00402a09,
-    0x0024001b, 0x0100002d, 0x07b35021, 0x013f362c, 0x1632013e, 0x1716011f,
-    0x44653233, 0x4c222005, 0x2819067b, 0x200808a4, 0x8afeba01, 0x0b0f0f0a,
-    0x1e061266, 0x10161004, 0x10071e04, 0x0f0f0c66, 0x1b14d4fe, 0x1b1b281b,
-    0x3c0685b8, 0x0b104001, 0x010f0cdf, 0x0c094a10, 0x104a090c, 0xdf0c0f01,
-    0x1cb7100b, 0x2a1b1b2a, 0x4105851c, 0xd62008a3, 0x0c28f382, 0x21001800,
-    0x38002c00, 0x3723fb82, 0x82353631, 0x163333ef, 0x27010e17, 0x1e173736,
-    0x37323301, 0x37012e07, 0x8e85010e, 0x011e2729, 0x06222317, 0x183e2707,
-    0x370ce277, 0x0b4a0001, 0x0c660d10, 0xf4600201, 0x0c4a1601, 0x0e0e1826,
-    0xe9523f34, 0x2e063649, 0x174d303f, 0x072d2094, 0x29461732, 0x4b02785b,
-    0x1535077d, 0x13171480, 0x221e0c21, 0x2fa96049, 0x17138026, 0x5d0a5905,
-    0x05f34842, 0x2e019029, 0x581e2627, 0x4b2b231e, 0x27790aab, 0x01eb2608,
-    0x001700ab, 0x21b58220, 0xa1822500, 0x2607544a, 0x011d0637, 0x8215010e,
-    0x36322ba3, 0x34363237, 0x14062226, 0xe24a3716, 0x012e2105, 0x0136b382,
-    0x1d200863, 0x5249670d, 0x5a01026c, 0x2f260c46, 0x2a374801, 0x72821541,
-    0x2424373f, 0x0248361c, 0x37364802, 0x48010148, 0x5a460c80, 0x526c0201,
-    0x1d0d6749, 0x410d0820, 0x2215822a, 0x8224912f, 0x24372225, 0x232487c0,
-    0x00483637, 0x2605eb42, 0x009601d6, 0x82140008, 0x62292091, 0x49180c7b,
-    0x178217db, 0x4c05d24c, 0x012e08e2, 0x18181240, 0x52181824, 0x02026049,
-    0x53184960, 0x302110d2, 0x221d8301, 0x856a1824, 0x18c02326, 0x02821825,
-    0x2a88ab20, 0x01604923, 0x0a29417e, 0x26859320, 0x82192e21, 0x18252452,
-    0x63000000, 0xa78505b3, 0x1a00112a, 0x2c002300, 0x3e003500, 0x6e0ae34e,
-    0x272008a6, 0x42097f4d, 0x1a880682, 0x2008086c, 0x07145a17, 0x85800121,
-    0x4c122069, 0xa4270516, 0x22171711, 0x8c911717, 0x8c5c2014, 0x822b200d,
-    0x209682b7, 0x062d4c80, 0x23172927, 0x17231616, 0x20158da8, 0x20ee86c1,
-    0x07f14b7f, 0x00000432, 0x0002d5ff, 0x0800ab01, 0x18001100, 0x00003800,
-    0x1808234a, 0x29082084, 0x17353337, 0x27233507, 0x28710722, 0x05174205,
-    0x32331622, 0x097af818, 0x26231282, 0x8219126b, 0x18220880, 0x30302512,
-    0x51303049, 0x4b55554b, 0x1f0d0f75, 0x84643f68, 0x64840303, 0x0d1f683f,
-    0x1717190f, 0x8541243f, 0x3f242405, 0x8eeb1717, 0x4069298f, 0x95405555,
-    0x013b3203, 0x36823082, 0x323b0126, 0x1b180903, 0x22071575, 0x5b09181b,
-    0xd62e0857, 0x15004001, 0x2a002100, 0x3c003300, 0xb7824500, 0x010e0726,
-    0x37013d26, 0x27059354, 0x1415011f, 0x022f2606, 0x4e0a1e68, 0x1d4208ee,
-    0x20118908, 0x06984d0e, 0x0b3faa3f, 0x04151520, 0x27c02735, 0x15150435,
-    0xc13f0b20, 0x2a162a2a, 0x0907b52a, 0x09090e09, 0x2606822c, 0x4409090d,
-    0x82090906, 0x820d8306, 0x406b3514, 0x1015010a, 0x31269d06, 0x26310101,
-    0x1510069d, 0xaa400a01, 0x16213583, 0x2226832a, 0x8325090d, 0x8429823b,
-    0x01252102, 0x6d181485, 0x6b22084b, 0xc9820e00, 0x2305ad51, 0x0043003a,
-    0x20059570, 0x2bce8623, 0x15173736, 0x35331533, 0x011e3727, 0x0721d484,
-    0x08b15101, 0x2b26c89a, 0x1b65011b, 0xce856680, 0x2a121525, 0x83d01b16,
-    0x090a24d1, 0x9ab9e5fe, 0x05eb70cb, 0xd1868020, 0x36172227, 0x1b252a16,
-    0x25d68455, 0x0104120a, 0xd09b2b1b, 0x25054744, 0xe8010000, 0x8f5c9601,
-    0x00260806, 0x37170713, 0x3721010f, 0x13230327, 0x8b498ba4, 0x18014a1d,
-    0x92920c49, 0xf5750192, 0x8075f580, 0x00011580, 0x634900ff, 0x82d62006,
-    0x001a3637, 0x0036002d, 0x012e2500, 0x1d060706, 0x16171401, 0x16013e37,
-    0x3a018217, 0x36373637, 0x26010e07, 0x26272637, 0x37160607, 0x021e1736,
-    0x27343736, 0x4d272606, 0x5e080971, 0x1030401d, 0x0103080e, 0x17301d04,
-    0x24473729, 0x0603050a, 0x4e42330f, 0x362e3a32, 0x50080107, 0x1f23104a,
-    0x10070a19, 0x7d587b19, 0x7d7db07d, 0x0b262cbd, 0x04181315, 0x08081a19,
-    0x1f131214, 0x370a0c37, 0x080a0f13, 0x80230c14, 0x27070a4b, 0x27040105,
-    0x061e1b79, 0x17130908, 0x839d0d04, 0x7db02132, 0xdb46e282, 0x821c2008,
-    0x331521ab, 0x26082a45, 0x37171632, 0x1823012e, 0x3308f05e, 0x7e150135,
-    0x44394f0b, 0x5a02025a, 0x14382244, 0x2d4c1b26, 0x2705ab45, 0xd5026f5a,
-    0x01463935, 0x1d821782, 0x26181a24, 0x6944231e, 0x5a792306, 0x93450015,
-    0x18d62008, 0x22081b70, 0x18272500, 0x240d386b, 0x17372707, 0x28048223,
-    0x0ea7c801, 0x0da70e26, 0x2806850d, 0x959595d5, 0x60606035, 0x831188e1,
-    0x82a82018, 0x59148215, 0x08210ccf, 0x05b34400, 0x01003f08, 0x07371523,
-    0x26343533, 0x33152703, 0x013d3632, 0x1415022b, 0x35013b16, 0x33150307,
-    0x23351727, 0x95010622, 0x6b165680, 0x80563c19, 0xaa6b1912, 0x8012196b,
-    0x166b5556, 0x18138056, 0x07858001, 0x82d5fe21, 0x8012211f, 0x16221f83,
-    0x2d830001, 0x0300183c, 0xdfff0000, 0xa001c001, 0x32001900, 0x00004200,
-    0x17011e01, 0x27070614, 0xc018013e, 0x07230984, 0x5535012e, 0x19880550,
-    0x07062225, 0x85171614, 0x4d032018, 0x01290ef6, 0x026c5200, 0x18161d21,
-    0x053a411c, 0x16181c29, 0x6c02211d, 0x82493652, 0x1017355a, 0x52360112,
-    0x10120136, 0x01171417, 0x06441d49, 0x06440612, 0x06830282, 0x82a00121,
-    0x482a2626, 0x3d16171b, 0x05914123, 0x3d232b08, 0x481b1716, 0x3e6c522a,
-    0x1d364901, 0x0d171231, 0x36291626, 0x26162936, 0x3112170d, 0xfe49361d,
-    0x060645e8, 0x07110645, 0x02820743, 0x41001121, 0x4b08053f, 0xbb01edff,
-    0x06009301, 0x10000900, 0x00001300, 0x37361137, 0x25260717, 0x16013f07,
-    0x27010f14, 0x07172737, 0xd2110140, 0x260111d2, 0x0c78b5e6, 0x3636310b,
-    0x0b31e6fd, 0x09146a01, 0x8609d2d2, 0x092bb584, 0x351c0920, 0x31849235,
-    0x2c06334a, 0x005601eb, 0x0028000b, 0x35232500, 0x07b54423, 0x59422520,
-    0x36342606, 0x17011e37, 0x0a324937, 0x34272808, 0x2beb0127, 0x2b2a2a2b,
-    0x55c0fe2b, 0x282c2603, 0x16283333, 0x2729081d, 0x0254403d, 0x41405402,
-    0x0201014d, 0x822b2bd5, 0x332a3b20, 0x01022c12, 0x01364e36, 0x27090e01,
-    0x54010127, 0x01544040, 0x0d414f01, 0xb3430606, 0x01c02808, 0x000f0080,
-    0x1835001b, 0x8913354f, 0x84272091, 0x26222691, 0x32333634, 0x26918516,
-    0x36321614, 0x4e273437, 0xfe2906e0, 0x191912d6, 0x15204701, 0x35028220,
-    0x190237d2, 0x2121191c, 0x05130e19, 0x2927191a, 0x31533636, 0x4f180201,
-    0xc0200d57, 0x202a2883, 0x1c0c2123, 0x23322301, 0x3d820609, 0x52360128,
-    0x0a2a3236, 0x07480007, 0x00132a0a, 0x00340030, 0x0055003c, 0x05796f00,
-    0x14111527, 0x17013b16, 0x05845833, 0x012e052c, 0x32373634, 0x2707011f,
-    0x5847012e, 0x37240806, 0x17333523, 0x010e1516, 0x07171637, 0x33272337,
-    0x26070616, 0x2b061417, 0x37273701, 0x36273717, 0x23353337, 0x2720da83,
-    0x152ccb82, 0x13c3ab01, 0x18181280, 0xab159612, 0x42080682, 0x3125dcfe,
-    0x18222531, 0x04021a02, 0x1c160c10, 0x02152c1c, 0x0101542f, 0x0a5b2d01,
-    0x15030c0f, 0x0f015507, 0x0c8e1013, 0x112b9609, 0x3a0f3a13, 0x4d1b0b1e,
-    0xbc192917, 0x55010c09, 0xfe121840, 0x821812ea, 0x16013806, 0x01cc1812,
-    0x01314a31, 0x01190117, 0x01010705, 0x141d2c1d, 0x8202210b, 0x242f3c89,
-    0x3f0b1014, 0x18220117, 0x0c099915, 0x39133b2b, 0x29223910, 0x56161616,
-    0x8200090c, 0x00013c00, 0x01f5ff00, 0x008a01d9, 0x0100001c, 0x07011e33,
-    0x27263423, 0x23070614, 0x82272636, 0x3e1723d8, 0x06833701, 0x26343808,
-    0x06674901, 0x13652822, 0x680f151d, 0x66342701, 0x010c0a0c, 0x1366010c,
-    0x010b0d12, 0xa8e70589, 0x03447204, 0x7003224a, 0x130d0c42, 0x1d334301,
-    0x5a02191a, 0x510a0000, 0xe518087f, 0x332311cb, 0x52130000, 0x07200622,
-    0x03840782, 0xf5563520, 0x82372005, 0x29038307, 0x23353317, 0x16322127,
-    0x91521115, 0x11352705, 0x56d53634, 0x0083562a, 0x07888020, 0x75805621,
-    0xfe26053d, 0x181911aa, 0x1c856b01, 0x84805621, 0x83562025, 0x220a8207,
-    0x52aa5680, 0x6a750585, 0x21fa8205, 0x9b820900, 0xe001c024, 0x0982a001,
-    0x26002226, 0x2c002900, 0x2f06f776, 0x1100003d, 0x27070137, 0x35262221,
-    0x27153711, 0x08838487, 0x10849182, 0x26056d5f, 0x25273303, 0x82172733,
-    0x27352102, 0x0882ba87, 0xc5011b30, 0xbbfe2b1b, 0x2aaa1911, 0x4f012b24,
-    0x06821812, 0x83564f21, 0x2bbb8204, 0x00ff1b1b, 0x1b801b1b, 0x4511561b,
-    0x11280e82, 0x1b850145, 0x2b1b3bfe, 0x45259982, 0x242b4f11, 0x24a8822a,
-    0x2a252ab1, 0x820b8356, 0xaafe29c4, 0x9b1be51b, 0x11459b1b, 0x80200c82,
-    0xbc820582, 0xbb820520, 0xeb01d539, 0x1300ab01, 0x27001f00, 0x31002b00,
-    0x15130000, 0x15231133, 0x82213533, 0x11232103, 0x2122a883, 0x0c821535,
-    0x21211482, 0x47108235, 0x232105e4, 0x074d5835, 0x15333528, 0x01561616,
-    0x0582562a, 0x01d6fe39, 0xfe16162a, 0x151616d6, 0x8055c040, 0x2a805555,
-    0xab01406a, 0x83d6fe56, 0x2023841d, 0x2e1e8440, 0xab152a01, 0x2b40c055,
-    0x2a6a1555, 0x82040000, 0x01002a8b, 0x008001d6, 0x00170005, 0x088b821b,
-    0x33010057, 0x27072315, 0x011f3207, 0x010f1516, 0x022f2206, 0x013f3426,
-    0x17010f36, 0x17072737, 0x33a20137, 0x241f7022, 0x062b0708, 0x19075502,
-    0x0c4f2707, 0x3405aa0c, 0x5b0f3c0e, 0x010f3d0f, 0x1e712b80, 0x062b0602,
-    0x0baa0909, 0x07264f0b, 0x03550818, 0x0e3c0f3d, 0x531c821f, 0xbc2208cf,
-    0x6b829601, 0x26010023, 0x06c05927, 0x0e070626, 0x17011e01, 0x3e220282,
-    0x02823701, 0x26363808, 0x271d9501, 0x08182f06, 0x24063118, 0x2006201e,
-    0x2d131825, 0x142e1e1e, 0x0f102518, 0x19690107, 0x08080209, 0x1e190902,
-    0x23494d50, 0x0202381d, 0x49221d38, 0x82502628, 0x06775062, 0x3e216385,
-    0x5e659c00, 0x994706ad, 0x012e2105, 0x02828e82, 0x4a363721, 0x1724061f,
-    0x06161716, 0x312c889c, 0x03142311, 0x1e090305, 0x0a1d0c0a, 0x13320882,
-    0x05061124, 0x08201117, 0x1306132a, 0x1021072a, 0xab99061a, 0x2a652008,
-    0x08041c44, 0x02270f03, 0x03102602, 0x441c0408, 0x1a3e0d2a, 0x0701080f,
-    0x02060101, 0x821a0f08, 0x000221bc, 0x01340082, 0x006901d6, 0x001c0018,
-    0x16320100, 0x23070614, 0x010e010f, 0x0805c769, 0x013f363b, 0x011d1617,
-    0x3335010f, 0x09c00115, 0x5f090c0c, 0x10032f03, 0x120d5d0a, 0x59090101,
-    0xc0240611, 0x0c000140, 0x19010c12, 0x130a086a, 0x090c8b0d, 0x09071069,
-    0xabc04405, 0x062b41ab, 0xd62d5582, 0x23006b01, 0x00002e00, 0x011e3125,
-    0x29618215, 0x35012e21, 0x31373634, 0xcc4d2237, 0x23072207, 0x087c823e,
-    0x06141749, 0x3221010f, 0x012f3637, 0x16170607, 0x0e0cbb01, 0xc0fe171e,
-    0x0c0e1e17, 0x0f0701a6, 0x24181911, 0x012a0118, 0x01304830, 0x01b51d23,
-    0x04030640, 0x08a5a508, 0x07630304, 0x1e160f18, 0x161e0101, 0x6007180f,
-    0x6b181117, 0x252c0684, 0x98082c1e, 0x5f060905, 0x0509065f, 0x2b056746,
-    0xab01e0ff, 0x06009601, 0x1b000d00, 0x04699182, 0x010f2705, 0x35233723,
-    0x33493733, 0x33250805, 0x37013e15, 0x4001012e, 0x20152015, 0x20165540,
-    0x0a402016, 0x0202664d, 0x4f0b4d66, 0x6702015b, 0x402a2ad5, 0x20038240,
-    0x82118280, 0x284b2517, 0x664d4a8e, 0x2b465e82, 0x3b5f8306, 0x0024000f,
-    0x0036002d, 0x1300003a, 0x17163221, 0x23010e11, 0x27262221, 0x17013e11,
-    0x272a6585, 0x013f3626, 0x011f1636, 0xba57013e, 0x08504b0b, 0x37173729,
-    0x00018027, 0x18011812, 0x3b090b66, 0x01493692, 0x13384901, 0x13080404,
-    0x29051008, 0x49011a16, 0x0c0c0936, 0x620c0c12, 0x64240685, 0x015a3735,
-    0x09115318, 0x18125623, 0x05d44e2a, 0x11082f24, 0x37820b04, 0x34113326,
-    0x6948361f, 0x7f050f57, 0x6525068a, 0x00722087, 0x28c08301, 0xab01c001,
-    0x00001b00, 0x2aa38201, 0x17011e15, 0x35233533, 0x8237013e, 0x23152309,
-    0x09823315, 0x0129aa82, 0x026c5200, 0x401b2401, 0x05c54755, 0x1b40552c,
-    0x6c020124, 0x6c02ab01, 0x0a829652, 0x3f2bab29, 0x54020254, 0x82ab2b3f,
-    0x52962224, 0x2157826c, 0x00820002, 0x802a5b82, 0x2a001a00, 0x22370000,
-    0xf6823d26, 0x14255684, 0x35012b06, 0x06e67733, 0x13153323, 0x06df5f21,
-    0x54472120, 0x0b9a2205, 0x82e2820f, 0x0b0f22f6, 0x05f9413b, 0x18c02a21,
-    0x230aa248, 0x660b0f40, 0x22821c82, 0x0f0b662c, 0x30242b55, 0x552b2430,
-    0x48184001, 0x7a820cb0, 0x00000424, 0xdb86c0ff, 0x23001f2b, 0x00002700,
-    0x17011e01, 0x20e58215, 0x207c8423, 0x26098227, 0x23153315, 0x8227012e,
-    0x351321ef, 0x03860a82, 0x922aed96, 0x802a802b, 0x02ab012b, 0xf391516d,
-    0xfe6d5123, 0x054e5d17, 0x01207b82, 0xd5207b82, 0x1f207b84, 0x41175741,
-    0x55221a5b, 0x5d418095, 0x2b152717, 0xd61b2401, 0x63856c52, 0x25066743,
-    0x3700002c, 0xcd8c3533, 0x83333721, 0x823320ea, 0x201682cf, 0x82f38a23,
-    0x2b2131f0, 0x01231c95, 0x18122b2b, 0x36480201, 0x02483616, 0x18345582,
-    0x18011512, 0x012b2b12, 0xfed51c23, 0x07fd4056, 0x80161e2d, 0x6b201182,
-    0x25821e82, 0x40402b22, 0x15202e82, 0x80290382, 0x072d1e16, 0x00002bfd,
-    0x27e38403, 0x00ab01e0, 0x00270013, 0x01248382, 0x011d1607, 0x28065d41,
-    0x15073523, 0x01270723, 0x20868227, 0x05984c07, 0x072e7982, 0x3e013d26,
-    0x34351701, 0xe0010727, 0xca820c2c, 0x95802708, 0x35258055, 0xc57a011b,
-    0x1e1b4629, 0x40203715, 0x75550154, 0xe76c020b, 0x5a014c03, 0xd623202c,
-    0x2b01241b, 0x2485a515, 0x1e013639, 0x18161f1b, 0x2b3f5402, 0x140f7519,
-    0xe96d5196, 0x4c10112b, 0x82010000, 0x01f8248b, 0x828001d6, 0x05002e8b,
-    0x27012e27, 0x3237013e, 0x013e1716, 0x052f5233, 0x1f00012c, 0x01016253,
-    0x321c3242, 0x04821212, 0x01014230, 0x1c075362, 0x323b7249, 0x14180142,
-    0x1a821814, 0x49723b22, 0x4a09bf44, 0x23200597, 0x2011954a, 0x058f5813,
-    0x06222322, 0x0582d783, 0x834a6082, 0x0fa72b0b, 0x0101312a, 0x190e1921,
-    0x04820909, 0x01012124, 0x794a2a31, 0xd5fe310d, 0x1e39250e, 0x0a0c2119,
-    0x19210c0a, 0x0025391e, 0x8308cf69, 0x002325bf, 0x25000027, 0x3320c385,
-    0x0582c385, 0x07010e23, 0x0ef54803, 0x21111725, 0x92000111, 0x01a4216e,
-    0x095a5a18, 0x2a011223, 0x216e8e55, 0xd9591d01, 0x82192005, 0x1912261b,
-    0x01d6fe2b, 0x20f7862a, 0x054341ff, 0x18000b23, 0x09454100, 0x07011f23,
-    0x28e38237, 0x010f010e, 0x3e273727, 0x084a4101, 0x4c141530, 0x4232a055,
-    0x53620101, 0x3960151f, 0x4f412811, 0x80072307, 0x4f41f26b, 0x951c2805,
-    0x0e0d6c6b, 0x41020000, 0x1422089f, 0xdd822800, 0xde890720, 0x013e3322,
-    0x0e22e583, 0x51411301, 0x23e88205, 0x011f011e, 0x36056541, 0x02020201,
-    0x01015b4d, 0x2a192129, 0x2a092809, 0x01292119, 0x41115b01, 0x1f200bc4,
-    0x3105d841, 0x44020234, 0x2a202e65, 0x1c16161c, 0x652e202a, 0xd5410801,
-    0x411c2009, 0xcb5905e7, 0x01923b08, 0x00030096, 0x3700001b, 0x13231533,
-    0x0e07011e, 0x34231503, 0x3637023e, 0x84822726, 0x3e233308, 0x4040d501,
-    0x313a572b, 0x0416230e, 0x23160440, 0x3512270e, 0x4001241b, 0x402b4901,
-    0x8108aa01, 0x1b181045, 0x2c1b101f, 0x270a1620, 0x1c24064c, 0x374f4837,
-    0x0016240c, 0x8326001a, 0x010e25e5, 0x36352315, 0x46065472, 0x072307ee,
-    0x18333523, 0x280c596a, 0x0e0b1341, 0x1a18012a, 0x09e9460c, 0x2a2a4023,
-    0x05ae4f15, 0x79370583, 0x1b0a14d0, 0x18240b17, 0x18240c1b, 0x30241218,
-    0xb81d2430, 0x5540012a, 0xf7560d4b, 0x82c02005, 0x821320db, 0x0f06287b,
-    0x2f220601, 0x84272601, 0x1f32247f, 0x18171601, 0x2113258c, 0x8c180d60,
-    0x00210f85, 0xcbcd1802, 0x00132208, 0x25499519, 0x17150727, 0x4f933537,
-    0x9595c023, 0x25539195, 0x54a65447, 0x1346a654, 0x051b4a08, 0x00002224,
-    0x47822301, 0x0e012f22, 0x0e491c19, 0x2726223c, 0x33011e07, 0x2e37013e,
-    0x20200101, 0x0b4b105b, 0x40026d51, 0x02405655, 0x664e3f54, 0x361f3705,
-    0x451a1e14, 0x026c5228, 0x15016c02, 0x2d1a376a, 0x526c02c5, 0x73185656,
-    0x1724087f, 0x1e1a1f15, 0x52211282, 0x09d3436c, 0x1801d626, 0x23001100,
-    0x36297782, 0x06161716, 0x07012e07, 0x22058326, 0x5a013e37, 0xc34d05cd,
-    0x06073605, 0x36262726, 0xbb0d0001, 0x0501010d, 0x0b0cad17, 0x010518ad,
-    0x080e8201, 0x04437c2d, 0x2c3e2f0e, 0x080c0c08, 0x0e2f3e2c, 0x15014304,
-    0x042e1402, 0x1632033e, 0x32160303, 0x2e043e03, 0x2a035714, 0x01222f03,
-    0x82021c02, 0x22012402, 0x822a032f, 0x05674780, 0x0a3af783, 0x35370000,
-    0x35331533, 0x33072733, 0x6a56d515, 0x40d5d540, 0xab808015, 0xd218c0c0,
-    0x200808af, 0x00800180, 0x0012000e, 0x001a0016, 0x34113300, 0x15373336,
-    0x11151632, 0x15233523, 0x23353337, 0x20038227, 0x2a038217, 0xaa121980,
-    0x55801912, 0x822a2a80, 0x55553102, 0x12150155, 0x19404019, 0x6bebfe12,
-    0x40402b6b, 0x73411182, 0x820a200c, 0x37002155, 0x37234582, 0x82152317,
-    0x15332506, 0x40ab3533, 0x95248083, 0x15408055, 0xef5b8283, 0x00062c06,
-    0x01f0ff00, 0x009c01c0, 0x820b0005, 0x00223587, 0x003d0031, 0x26062500,
-    0x05163627, 0x0e17013e, 0x16143701, 0x22220582, 0x0d822726, 0x07061422,
-    0x37250884, 0x0e07011e, 0x250a8201, 0x16373632, 0x0e823617, 0x48482520,
-    0x010e2d05, 0x01012e23, 0x0b9f0bc0, 0x8bfe9f0b, 0x69080684, 0x072020b5,
-    0x07350835, 0x1bbb2020, 0x15370220, 0x16040f0b, 0x35135035, 0x01133506,
-    0x140f0d1a, 0x1a0d0f14, 0x3520fbfe, 0x0b0f0416, 0x20023715, 0x5b03c01b,
-    0x9943077d, 0x7d074399, 0x3501785b, 0x3a3a3b1f, 0x8f351f3b, 0x30235403,
-    0x112a1429, 0x216f1811, 0x1b212929, 0x08081219, 0x6a1b1912, 0x11111805,
-    0x3029142a, 0x8b485423, 0x000b220c, 0x84c7821b, 0x333525fe, 0x33153335,
-    0x101a5118, 0x56558023, 0x20028255, 0x0a714815, 0x10839520, 0x48955521,
-    0x07200d61, 0x2308c74e, 0x001d0011, 0x09a95018, 0x11170026, 0x013b3634,
-    0xb4415b83, 0x15032107, 0x35206a84, 0x03207683, 0x20061f73, 0x20078605,
-    0x31078207, 0x55090c2b, 0x0c0955d6, 0x2b1556aa, 0x2a2b2b2a, 0x00825696,
-    0x4e000121, 0x153a06b5, 0x0c094001, 0x090c5555, 0x6a6ac0fe, 0x2a808001,
-    0x2b2b802a, 0x2b40aafe, 0x0382ab40, 0x44404021, 0x962408d7, 0x0b009601,
-    0x0f67b318, 0x89011d21, 0x0001277b, 0x0901553f, 0x02820983, 0x84540121,
-    0x95012d69, 0x5b405401, 0xb30707b3, 0x5454405b, 0x02825782, 0x24082f41,
-    0x005601eb, 0x834f840e, 0x112321b8, 0x2205464e, 0x5905012e, 0x012c078c,
-    0x2babaa95, 0x2b80012b, 0xdbfe3001, 0x2a067463, 0xfec0962b, 0xc04040c0,
-    0x597f3025, 0x4e820560, 0x2b06674a, 0x007f01ab, 0x25000009, 0x35253533,
-    0x332f4d83, 0xff802b01, 0x56805600, 0x5c49d901, 0x187882fe, 0x200d2783,
-    0x127b4719, 0x27353322, 0x71473985, 0x60c7250b, 0x406040c0, 0x260e6347,
-    0x4438a2b1, 0x6f5ae2fe, 0x0b290c1b, 0x00001400, 0x23112301, 0x82cf8235,
-    0x55212005, 0xc02809c0, 0x2b2a2b80, 0xc0800180, 0x2905dc58, 0xebfe0001,
-    0x15018080, 0x21636a2b, 0x65468205, 0x9622086b, 0x47840800, 0x2007fc55,
-    0x244e8213, 0x23152135, 0x31078215, 0x241b0001, 0x24243624, 0x012b4006,
-    0x2a402b00, 0x03419501, 0x56fe2605, 0x80959580, 0x93451855, 0x24438308,
-    0x001f0016, 0x18e3822b, 0x2308656b, 0x17011e33, 0x35234685, 0x8737013e,
-    0x35032c16, 0x013e3723, 0x011f1632, 0x85a01523, 0x400e2a9d, 0x20011812,
-    0x18012056, 0x291087f2, 0x1e150537, 0x40370416, 0xb0859501, 0x18016a2a,
-    0xa0a07512, 0x6b181275, 0x81821085, 0x100da226, 0x80a20d10, 0x200de348,
-    0x28cb8304, 0x17371737, 0x34110521, 0x05f46d26, 0x33161433, 0xb5363221,
-    0xfe604a36, 0x195501d6, 0x12d6fe12, 0x052c4819, 0x6040a028, 0x2a011580,
-    0x14861813, 0x22092f56, 0x829601ab, 0x000926dd, 0x3f000019, 0x254e8201,
-    0x27153301, 0xfa182507, 0x402b0f2a, 0xff52402e, 0x35366b00, 0x4cff0001,
-    0xed4c06e5, 0x522b2906, 0x016d5237, 0x2020ab40, 0x51061a64, 0x02210894,
-    0x05af4e00, 0x0f005622, 0x18067741, 0x28073d42, 0x3634013d, 0x27211733,
-    0xc7401807, 0x01162a0c, 0x364a602a, 0x12185501, 0x06496dd6, 0x6080ea24,
-    0xaf4a0040, 0x01d63006, 0x00020080, 0x00170012, 0x33270500, 0x83163213,
-    0x2107234c, 0x4c8a012e, 0xaa550023, 0x93451856, 0x234f8509, 0x5501562b,
-    0x08d24118, 0x1912d523, 0x235387eb, 0xc0010000, 0x16245382, 0x33002100,
-    0x50830b82, 0x88152321, 0x05846301, 0x15013323, 0x05f24c14, 0x013d332c,
-    0x06212726, 0x17161507, 0x01863533, 0x1295012d, 0x2b2a2b19, 0x13802a2b,
-    0x83121918, 0x2b552b66, 0xfe09012a, 0x010109ea, 0x18837609, 0x19800124,
-    0x08838012, 0x86412b20, 0x00ff2205, 0x20328455, 0x2321838b, 0x15010996,
-    0xd5823e82, 0x7f820020, 0x0d228b83, 0x09821b00, 0x07271522, 0x35280182,
-    0x21333634, 0x17071632, 0x2908c065, 0x01173717, 0x565540c0, 0x4c854055,
-    0x07824020, 0x12d6fe23, 0x2d128219, 0x408c5501, 0x41565656, 0x19191261,
-    0x0583409b, 0x10831220, 0x04000022, 0x24085b52, 0x00130003, 0x18eb821c,
-    0x820c4dd2, 0x37362e61, 0x05012e11, 0x011e1123, 0x21352117, 0x357a8225,
-    0xfec00133, 0xfe2b01d5, 0x181812d5, 0x122b0112, 0x18010118, 0xa6186efe,
-    0x012807c4, 0x3b2a3a14, 0x2b0155eb, 0x23891083, 0xabfe5522, 0x2b242882,
-    0x4b324be4, 0x2c0da742, 0x00160006, 0x15272500, 0x33353723, 0x0e2f4e35,
-    0x83950121, 0x09a54200, 0xaa2b1925, 0x1880aaaa, 0x210a8958, 0x4c821912,
-    0x2109e37c, 0x7f580008, 0x002c2405, 0x5b0e0100, 0x17210681, 0x05815823,
-    0x82112321, 0x33152c08, 0x05263435, 0x22233533, 0x76011d06, 0x35210754,
-    0x07dd4323, 0x55557a2b, 0x552b1912, 0xfe192b55, 0x820a84c4, 0x5555216a,
-    0x08c16718, 0x0e83d420, 0x82000121, 0x83258220, 0x8380200b, 0x0600212e,
-    0x2b428382, 0x237f8905, 0x37000035, 0x2205b276, 0x18112335, 0x1810a699,
-    0x5d08bd98, 0x1b5d08b1, 0x846b2008, 0x217c8472, 0x89832a01, 0x0b841220,
-    0x30249527, 0x30304830, 0x05164424, 0x01217784, 0x8482842a, 0xabfe218d,
-    0x95200b83, 0x2006855d, 0x06055d7f, 0x42000021, 0x0235053b, 0x006b0100,
-    0x002b0018, 0x2e212500, 0x32363401, 0x2e331716, 0x058a7501, 0xb5181720,
-    0x48291f74, 0x012b0130, 0x30112a33, 0x79b5181d, 0x2530291f, 0x150c432d,
-    0x3143011a, 0x097cb518, 0x06272f24, 0xb7183346, 0xab43081d, 0xea200805,
-    0xc001d601, 0x0a000300, 0x00001d00, 0x21152101, 0x33112117, 0x35331737,
-    0x23072723, 0x1115010e, 0x3405a644, 0x26341135, 0x00ff8001, 0xfe2b0001,
-    0x4a4c60aa, 0x55555660, 0x21ff8256, 0x05830112, 0xd5150127, 0x4b2b012b,
-    0x22fe824b, 0x42121801, 0x00200967, 0x03825282, 0xeb010028, 0x06004001,
-    0x89760000, 0x01212705, 0x223c502b, 0x79828060, 0x516b4024, 0xad188019,
-    0x57550897, 0x05fb4205, 0x421df942, 0xee421cf4, 0x00330817, 0xff000009,
-    0x01d501eb, 0x00050095, 0x0012000b, 0x0021001b, 0x002d0027, 0x00390033,
-    0x17163700, 0x17272635, 0x27373615, 0x3e173706, 0x06233701, 0x5f012e27,
-    0x272505d6, 0x37171623, 0x08188226, 0x36330726, 0x27263305, 0x26271607,
-    0x17161527, 0x07063527, 0x31793617, 0x7e243041, 0x231f3141, 0x18141e42,
-    0x63062b03, 0x2d06c261, 0x28072be8, 0x1e1c1c1e, 0x062b0728, 0x0c854c01,
-    0x1e222b86, 0x15831b24, 0x84221c21, 0x1e3a2615, 0x30203a18, 0x06d54645,
-    0xae214983, 0x2528821e, 0x1e314130, 0x278a6024, 0x00000023, 0x2bc38202,
-    0x01cf01d1, 0x000800af, 0x25000044, 0x26054242, 0x26370614, 0x52373627,
-    0x063705ef, 0x34353607, 0x010e2726, 0x26171415, 0x07062627, 0x16171614,
-    0x82070617, 0x011e2610, 0x06373637, 0x82108215, 0x2734212a, 0x36251782,
-    0x01263437, 0x05d04200, 0x82096b21, 0x211f3300, 0x091f441d, 0x1d230208,
-    0x0802231d, 0x1d441f09, 0x17961f21, 0xe2426b20, 0x4b230806, 0x06030306,
-    0x11223a12, 0x06051201, 0x3a240a0a, 0x243a1111, 0x05060a0a, 0x21110112,
-    0x0405123b, 0x95130503, 0x3a22211d, 0x5d09db46, 0x1422050b, 0xd5821d00,
-    0x310e2447, 0x17371727, 0x14112721, 0x35213316, 0xd5011121, 0xcb181218,
-    0xea310909, 0xff563f2b, 0x12188000, 0xd5fe2b01, 0x1200016b, 0x2a1d8618,
-    0x6a4f3a67, 0x12d5fed5, 0x75012a18, 0x0028057b, 0x01ab0100, 0x0006006b,
-    0x09af6c18, 0x2e11172a, 0x0e212701, 0x33150701, 0x212f5882, 0x1e152335,
-    0x3e211701, 0x562b0101, 0x54d6aaaa, 0x2b25071d, 0x00ff0001, 0x830d822b,
-    0xae6c185d, 0x0a5f5019, 0x10000624, 0xc7822000, 0x51822320, 0x011f232b,
-    0x22010e23, 0x35232726, 0x10534521, 0x562a552d, 0x5595552a, 0x24362401,
-    0x18015501, 0x290b3465, 0x564040eb, 0x24241b15, 0x6245d51b, 0x0a4f5f0f,
-    0x07000324, 0xd7821300, 0x33352323, 0x18038215, 0x220b6881, 0x822a1501,
-    0x0adf4e00, 0x00017826, 0xc080d62b, 0x210dce4e, 0x5f4b0400, 0x00033208,
-    0x001b000f, 0x1300001f, 0x13233533, 0x3e27012e, 0x05915001, 0x200b464f,
-    0x231b8203, 0x152a2aeb, 0x07b8bd18, 0x61020223, 0x09424f48, 0x2a707823,
-    0x2165822a, 0x1582eafe, 0x62632187, 0xc2fe220c, 0x0c476580, 0x6f820f20,
-    0x34002824, 0x75833d00, 0x54073654, 0x17200529, 0x82072755, 0x82352086,
-    0x1e172412, 0x18061401, 0x6f074f4f, 0xa6271011, 0x014634b4, 0x85344601,
-    0x21302706, 0x2b01012b, 0x0685bc21, 0x0f0b1228, 0x0f0f160f, 0x6e182d65,
-    0x6a430a13, 0x95012105, 0x39833288, 0x33892920, 0x20213a83, 0x22368301,
-    0x181f0f16, 0x200a2b6e, 0x06da432a, 0x0001002b, 0x01eaff00, 0x00960156,
-    0x26bb8217, 0x23272634, 0x45153335, 0xd8740630, 0x013e2a05, 0x090cd535,
-    0x0915aa15, 0x2b06860c, 0x0c095501, 0x012a2a01, 0xd6fe090c, 0x00200987,
-    0x04200082, 0xc36b4b82, 0x00252a05, 0x0032002c, 0x0100003b, 0x052d4f17,
-    0x07151623, 0x055c5921, 0xf3823320, 0x0e27222a, 0x36262701, 0x013f3637,
-    0x21820d82, 0x332e0582, 0x2637012e, 0x36171607, 0x37361601, 0x2182012e,
-    0x15017908, 0x15482d16, 0x170b0410, 0x06eefe01, 0x24151f2e, 0x6115710c,
-    0x2f232940, 0x1219164d, 0x122e1e25, 0x0f192e13, 0x2c1d4667, 0x2c09a308,
-    0x3031167a, 0x95fe0b1e, 0x1e21320e, 0x07130c2b, 0x14018001, 0x35111403,
-    0x15322921, 0x01012f26, 0x46391416, 0x05171001, 0x3a621b15, 0x0b102e2f,
-    0x55431922, 0x21290154, 0x153f2921, 0x292b170f, 0x030dbffe, 0x2235120f,
-    0x02003925, 0xf331c782, 0x9001ab01, 0x16000900, 0x22250000, 0x27262726,
-    0x28ac8234, 0x06072717, 0x011e1714, 0x08ba8232, 0x00013425, 0x25122e1a,
-    0x5a131301, 0x32797979, 0x423e1a32, 0x1e321a3e, 0x35251313, 0x5a132e1a,
-    0x3579793c, 0x82193488, 0x88342100, 0x2d061b41, 0xd6010000, 0x21006b01,
-    0x33002a00, 0x57823b00, 0x35333529, 0x15331521, 0x18161423, 0x2413aaf2,
-    0x0535013e, 0x0f076822, 0x27263738, 0x35070622, 0x16950133, 0x4016aafe,
-    0x090c1010, 0x010c0915, 0x078401ea, 0xfe10102b, 0x12120ed6, 0x9d12121b,
-    0x3506840d, 0x21423312, 0xabea183c, 0x80404080, 0x6c04170f, 0x090c0c09,
-    0x05831616, 0x17046c24, 0x02752b0f, 0x25058505, 0x06010a60, 0x93434b05,
-    0x000c2c0a, 0x00260019, 0x011e1300, 0x82153317, 0x34352404, 0x98052326,
-    0x01f62f0c, 0x01262735, 0x080a2734, 0x3402cdfe, 0x03822627, 0x11820a83,
-    0x01330a85, 0x01342795, 0x02342725, 0x660a08cc, 0x24013527, 0x83013428,
-    0x8206820a, 0xcc012815, 0x00000b07, 0x82ffff02, 0x01530804, 0x24006b01,
-    0x00003600, 0x34363225, 0x010f2226, 0x34262206, 0x011f3236, 0x22262737,
-    0x32161406, 0x3236013f, 0x22061416, 0x1707012f, 0x011e3716, 0x21070614,
-    0x34352622, 0x013e3736, 0x01163233, 0x2d2c205f, 0x0e66173e, 0x271c1c28,
-    0x12151010, 0x832d3f16, 0x290d250f, 0x11261c1c, 0x24080f83, 0x3f3a295e,
-    0x35ebfe2c, 0x152f434b, 0x5d362d4c, 0x2c3e2b4b, 0x1c0e5715, 0x0e0e1c26,
-    0x2c160f13, 0x57152b3e, 0x200d820d, 0x2e0d830f, 0x563d039f, 0x354b013e,
-    0x27054b2f, 0x6c004c30, 0x1b260953, 0x00002800, 0x984f3517, 0x22078506,
-    0x18152315, 0x2108b840, 0x5b5c0315, 0x16142705, 0x3632013b, 0x0082156b,
-    0x56168024, 0x07828016, 0x012a1527, 0x092a090c, 0x2b04840c, 0x2a562a15,
-    0x15555640, 0x40565515, 0x01210a82, 0x05a65915, 0x61000021, 0x40260873,
-    0x1b000800, 0x7b180000, 0x1e4308a9, 0x43072005, 0x1521064f, 0x2a7b8233,
-    0x18181295, 0x67191924, 0x572b400e, 0x0e240782, 0x952b555d, 0x2306b449,
-    0x012e2655, 0x26052459, 0x55262e01, 0x45005655, 0x112c0a2f, 0x30001a00,
-    0x00003900, 0x17163213, 0x26060b74, 0x2e07010e, 0x65363401, 0x6b8209c3,
-    0x15221a86, 0xa1773523, 0x4b1e8205, 0x8b2e070e, 0xf00a3020, 0x0a5b4055,
-    0x36292030, 0x82422936, 0x830d2005, 0x2b2a2414, 0x8c30402b, 0x95013116,
-    0x40401d23, 0x01231c40, 0x36523601, 0x121b123f, 0xaa230282, 0x821c2301,
-    0x40402314, 0x1584231d, 0x16850120, 0x18000021, 0x21088753, 0xa7830080,
-    0xa59c1e20, 0x8a94bd83, 0xaaaa1324, 0x768d8001, 0x12121c26, 0x2aeb121c,
-    0x8508ef42, 0x9e26205f, 0x3335225f, 0x06064115, 0x40226795, 0x0282402a,
-    0x19836b95, 0x6fac4020, 0x40181f20, 0x6f940af1, 0x371e9f22, 0x08f1b018,
-    0xab207494, 0xb77d208a, 0x0014280b, 0x2500001d, 0x82352315, 0x06272201,
-    0x08244723, 0x6a071421, 0x01320800, 0x404055d5, 0x37131230, 0x48010148,
-    0x02483637, 0x63429006, 0x83402005, 0x02062117, 0x23062c6b, 0x65121337,
-    0x22053350, 0x4f0c0000, 0xab61087b, 0x00272411, 0x183b002b, 0x461597cf,
-    0x35220572, 0x8f82023b, 0x7b153321, 0x1522064e, 0x206d3723, 0x21332a06,
-    0x013d3632, 0x95012634, 0x2000822a, 0x23038240, 0xc0aaaa2a, 0x16200683,
-    0xc0201088, 0x240a9d6e, 0x2a6a2aeb, 0x22038216, 0x826b2b80, 0x200c8605,
-    0x09df4f6a, 0x01000022, 0xc024a784, 0x08004001, 0x21359182, 0x17072737,
-    0x01212737, 0x4cd2fec0, 0x1e80801e, 0xd52e014c, 0x2008834d, 0x0883434d,
-    0x4901802d, 0x09000300, 0x21370000, 0x82372135, 0x1707282d, 0xff000180,
-    0x83628000, 0x2b402227, 0x820784a2, 0x0d00262e, 0xd5ff0000, 0x05375001,
-    0x0a000622, 0x31089955, 0x0022001e, 0x002a0026, 0x003e002e, 0x23370500,
-    0xea482337, 0xa0d01806, 0x1e08410a, 0x08f68f18, 0xaa550023, 0x250b41ea,
-    0xea562b26, 0x152b6b2b, 0x80220382, 0x05826a2b, 0x6b220c86, 0x58181318,
-    0x0020098a, 0xff21d783, 0x26b384ea, 0x000f000b, 0x84170013, 0x003125a7,
-    0x00380035, 0x2506e769, 0x013d2622, 0x64183734, 0x27240733, 0x17152335,
-    0x27210382, 0x20048333, 0x06165121, 0x15072727, 0x33012f33, 0x2e198327,
-    0x1527013b, 0x1b7a011c, 0x1812fb40, 0x82610109, 0x821620ad, 0x2f220803,
-    0x015a2a19, 0x0f18121a, 0x7a917e0c, 0x25258f2b, 0x25402a2a, 0x1b650125,
-    0x401b86fe, 0x10d61218, 0x11825b0b, 0x19240286, 0x59192a2f, 0x0e2c1482,
-    0x2b7e0515, 0x256b2b2b, 0x252a2a65, 0x240abb41, 0x0100000a, 0x07bc4115,
-    0x95013524, 0xb441e7fe, 0x44012405, 0x85562b01, 0x1880200a, 0x3d099b53,
-    0x00030040, 0x2500000c, 0x07231133, 0x21152117, 0x27371707, 0x2a2aab01,
-    0xd1fe4db4, 0x2e832f01, 0x00014025, 0x832a4d1e, 0x82002009, 0x82122000,
-    0x01002403, 0x182b01d6, 0x2014638e, 0x0a877b2b, 0x47004325, 0x82370000,
-    0x15352452, 0x7b173523, 0x0b820b81, 0x15332524, 0x07822123, 0x35012b28,
-    0x35230733, 0x03861733, 0x278e2520, 0x08057555, 0x80153325, 0x00ff0001,
-    0x16406a55, 0x1540162a, 0x4056fe55, 0x406a0140, 0xd52b2b55, 0x40552b2b,
-    0x2b2b4040, 0x822aebfe, 0x2303851b, 0x6b2b6b6a, 0x8405445e, 0x200b8a05,
-    0x21168a15, 0x8f51002b, 0x12240809, 0x32002400, 0x00004300, 0x020f2201,
-    0x1d161506, 0x16151401, 0x2f36013f, 0x22172601, 0x1f06010f, 0x36371601,
-    0x35210182, 0x21118226, 0x11872605, 0x34013d22, 0x17221f88, 0x30853633,
-    0x01012c08, 0x0a360707, 0x08030109, 0x4a0d0da1, 0x06078706, 0x4a0c0c4a,
-    0x23240d0d, 0x06030306, 0xd1fe0647, 0x08470204, 0x02064808, 0x84980102,
-    0x05483f1c, 0x05070607, 0x490d0c48, 0x07ab0106, 0x0c080b36, 0x03562929,
-    0xa2070a03, 0x07490e0d, 0x3c82068e, 0x233c0282, 0x07070524, 0x06480606,
-    0x4803010a, 0x04480a0a, 0x92040306, 0x06820703, 0x470d0d4b, 0x05225a82,
-    0x6e820e48, 0x00820020, 0x2a05c743, 0x005601d6, 0x0100000e, 0x71012b26,
-    0x01370a51, 0xea170c78, 0x12191912, 0x5d0c17ea, 0x18124301, 0x1812d612,
-    0x82831101, 0x08ff7236, 0x0400562c, 0x00001300, 0x33352325, 0x3e8e2717,
-    0xeaea5524, 0x428a294c, 0x6bd65523, 0x4c448b83, 0x3f29096f, 0x47004300,
-    0x00004b00, 0x487e8713, 0x0d870505, 0x37363233, 0x2b012e35, 0x15333501,
-    0x07062223, 0x3b011e15, 0x05d14401, 0x35231383, 0x85333523, 0x0723210d,
-    0x0ab39018, 0x1812d52d, 0xc0161218, 0x18131555, 0x82551318, 0x180125b9,
-    0x15aa1512, 0x55200885, 0x15231483, 0x8316c055, 0x56563524, 0x55556a56,
-    0x015555d5, 0x40121895, 0x2a2b1813, 0x4013182b, 0x0c831983, 0x18860b8b,
-    0xd6402a26, 0x00404040, 0x260e0366, 0x001d0017, 0x82350031, 0x010e2bc5,
-    0x1614011d, 0x21152333, 0x99852335, 0x99842720, 0x83331521, 0x821d96ab,
-    0x217d82a2, 0x73820001, 0x80131828, 0x95158080, 0xa583c06a, 0x12824020,
-    0x12828b83, 0x82ab0121, 0x20ba82c3, 0x8293822b, 0x2b01262e, 0x2b968055,
-    0x91138f6b, 0x002b2497, 0x993b0037, 0x92172097, 0x07052f91, 0x37170717,
-    0x37273717, 0x33370727, 0x9d8f2315, 0x9a8bd620, 0x1fa8fe27, 0x2d1f2e2e,
-    0x2205842d, 0x928080ab, 0x25a48da7, 0x2d2e1e0a, 0x02822d1e, 0x2e1e2e24,
-    0xb082550d, 0xef540920, 0x00132408, 0x441b0017, 0x00210c1b, 0x419f9213,
-    0xbb94074f, 0x35331527, 0x2315013b, 0x20078227, 0x8f038633, 0x2b1521bf,
-    0x280c5c41, 0xc02b95fe, 0x2beb8080, 0x91018215, 0x2b6b23bd, 0xc08d152b,
-    0x2b2b2b23, 0x06214455, 0x29085f49, 0x00190056, 0x00390035, 0x94823700,
-    0x012e233a, 0x33013e35, 0x07171632, 0x22232627, 0x16140706, 0x17363733,
-    0x33372337, 0x33230384, 0x82373307, 0x23072303, 0x03823307, 0x23372323,
-    0x3d188307, 0x250809f5, 0x01474718, 0x22184053, 0x0d160d09, 0x01302511,
-    0x0e1d292d, 0x08200d3c, 0x03820620, 0x822a0d21, 0x0d2a2315, 0x01840720,
-    0x2b0d2208, 0x140d150d, 0x6b150616, 0x01080434, 0x50493f51, 0x07350408,
-    0x2b302f03, 0x3c030232, 0x2b2a2b55, 0x85008255, 0x19802006, 0x290ae748,
-    0x008001d5, 0x1300000f, 0x01832107, 0x27010f22, 0x24087e82, 0x6b133717,
-    0x0a22010e, 0x010edffe, 0x65751021, 0xa7114707, 0x800140c1, 0x52472e47,
-    0x55232626, 0x40014040, 0x06f74300, 0x3f84aa20, 0x00001427, 0x23013f25,
-    0x08d08227, 0x0f331735, 0x23012f01, 0x03210317, 0x00012707, 0x049b0c57,
-    0x0cd605a2, 0x2f2f0593, 0x52062b03, 0x8b1e5201, 0x8318498b, 0x37802a2b,
-    0x45240d0d, 0xa6fe1f01, 0x82002626, 0x55032000, 0x032408a3, 0x32001200,
-    0x212e9382, 0x1e372111, 0x36323301, 0x1523013d, 0xee4f0614, 0x36323505,
-    0x2f263435, 0x35012e01, 0x3717013e, 0x010e0726, 0x011f1614, 0x20050650,
-    0x08a48227, 0x6580fe55, 0x18151b06, 0x110b241e, 0x0862040b, 0x19213421,
-    0x0b0b0917, 0x1b091f01, 0x1c182211, 0x0c091417, 0x10190d0e, 0xfe800106,
-    0x130e3f80, 0x7b7c1b1b, 0x0a010a0d, 0x15100e08, 0x1a16181a, 0x09050409,
-    0x10020e08, 0x01011e12, 0x08182b1a, 0x110a0504, 0x820a0c0a, 0x8206209b,
-    0x02003003, 0x00420100, 0x0013000b, 0x00310021, 0x82470039, 0x08ee49f7,
-    0x27010e2c, 0x010e1632, 0x0737012b, 0xb5823733, 0x013e3725, 0x87263637,
-    0x0f16230e, 0x0e853301, 0x25941720, 0x0cf91f19, 0x12dc2608, 0x1312060b,
-    0x1e350b12, 0x16111a08, 0x020a070a, 0x3b1a1905, 0x101e1b7f, 0x02070c18,
-    0x040c1f0c, 0x081b1a13, 0x34258680, 0x1a071f36, 0x08091612, 0x1804020a,
-    0x023e3b1a, 0x49373749, 0x38058402, 0x0e200da8, 0x0726773b, 0x0a110709,
-    0x8c251c19, 0x3e0b0750, 0x25121441, 0x08178c3b, 0x04000022, 0xe0ff0000,
-    0x8b01d601, 0x26001d00, 0x4d004400, 0x1e010000, 0x14011d01, 0x14230706,
-    0x15013b16, 0x21057e79, 0xd2823527, 0x3d37d982, 0x07220701, 0x013e1614,
-    0x22272635, 0x34013d26, 0x34013b36, 0x84232726, 0x05b0511e, 0x0e012b22,
-    0x37393f82, 0x26343732, 0x16150622, 0x231a9801, 0x09981a23, 0x22015c06,
-    0x221a5c1a, 0x2a068201, 0x42231a70, 0x0d08010e, 0x9be30109, 0x2001211c,
-    0x51202b82, 0x06223282, 0x3885240e, 0x06825020, 0x391a2333, 0x060913fc,
-    0x13060801, 0x501a2327, 0x0d07231a, 0x201e8801, 0x27318223, 0x0913fb39,
-    0x13090707, 0x08089343, 0x08008821, 0x24000f00, 0x36130000, 0x06161716,
-    0x37271527, 0x35361615, 0x0e37012e, 0x36161701, 0x82173537, 0x2f4d08e5,
-    0x27013e01, 0x35372606, 0x01586d2b, 0x31415501, 0x022f392f, 0x0201c13f,
-    0x05520b03, 0x08730831, 0x04175110, 0x01033465, 0x3d664147, 0x73275139,
-    0x2173f221, 0x14443328, 0x39580226, 0x94051b31, 0x245ec506, 0x42053105,
-    0x08402105, 0x05234394, 0x01000223, 0x2085826b, 0x23798217, 0x05211521,
-    0x20060546, 0x0ac94421, 0x56015526, 0x5601aafe, 0x2009f75a, 0x24338255,
-    0x192bd540, 0x05631812, 0x2b2b2309, 0xcb850000, 0x80201b82, 0x07200982,
-    0x0032cd82, 0x21352125, 0x33352303, 0x11211117, 0x35211523, 0x4883ab01,
-    0x56568032, 0x2b56feaa, 0xd5800002, 0x1515ebfe, 0xc0fe4001, 0x3f8a3e84,
-    0x0c000824, 0xb3762400, 0x8903200a, 0x2123219a, 0x28056c47, 0x16142333,
-    0x013e2117, 0xfd7d1835, 0x90b42007, 0x121926a6, 0x1912aa01, 0x05dc682b,
-    0xea2a0122, 0xea27b182, 0x13181813, 0x471912ea, 0xb382055c, 0x37430220,
-    0x006b2806, 0x00190015, 0x42211300, 0x33210658, 0x21af8217, 0xfd5b3337,
-    0x2c0b8305, 0x09800140, 0x15090c0c, 0x2b00fe2b, 0x2f098215, 0x0156011e,
-    0x090c016b, 0x010c09ea, 0x40151540, 0x2a220a85, 0x6218c0c0, 0x4022098f,
-    0xc3823900, 0x2f012e28, 0x23012e01, 0xaf82010e, 0x45363221, 0x85660672,
-    0x011f3005, 0x3436021e, 0x012e2726, 0x32333634, 0x73260717, 0x4b0806a6,
-    0x1415011e, 0x21800106, 0x0a2e0b28, 0x35271c2e, 0x2b1b2735, 0x3311100c,
-    0x0148361e, 0x28364801, 0x082a103d, 0x171d2f16, 0x24262515, 0x1b152920,
-    0x1210150f, 0x191f0101, 0x41301f21, 0x681d1f01, 0x34011e19, 0x1b013450,
-    0x19162617, 0x3b050a50, 0x14612629, 0x24180118, 0x200c060f, 0x0d25233a,
-    0x0e120114, 0x0b070f13, 0x29211e20, 0x220a1f5c, 0x821b0008, 0x331529be,
-    0x15371707, 0x21033533, 0x5905795a, 0x3d300750, 0x2b012301, 0xd11ed14c,
-    0xd6fe2b2b, 0x18139595, 0x2305265c, 0x2b80012b, 0x4c261482, 0x01abfe95,
-    0x0a612b2a, 0x00952107, 0xff315783, 0x01c001fe, 0x00050096, 0x2500000b,
-    0x0727013f, 0x2a03821f, 0x01273717, 0xc0239d00, 0x849d23c0, 0x7a6b2705,
-    0x1b95951b, 0x05837bb1, 0x00820020, 0x00000331, 0xd601feff, 0x0d00ab01,
-    0x16001200, 0x47130000, 0x072105e3, 0x08e94727, 0x37011f2c, 0x1b460727,
-    0x2dc0455a, 0x44824b1e, 0x1b506a34, 0x3ec02338, 0x1f193da8, 0x1bab0119,
-    0x2295355b, 0x50823b1e, 0x1b51522b, 0x30951bca, 0x1e143da8, 0x06ff5413,
-    0x8001d924, 0xe5821500, 0x82010e21, 0x1716244d, 0x82271236, 0x0e360809,
-    0x011e1701, 0x01013e17, 0x1d718c6b, 0x0d101429, 0x150482ac, 0x474f55ab,
-    0x02210201, 0x1501d13f, 0x0e56a323, 0x17010631, 0x1e173d01, 0x63140e19,
-    0x012e2124, 0x46823e8e, 0xd526ab82, 0x40018001, 0x53851400, 0x15231522,
-    0x2e07ca47, 0x35233533, 0x0001012e, 0x2b013024, 0x822a2b40, 0x30012903,
-    0x30014001, 0x6b2b8024, 0x2b250082, 0x00302480, 0x233f8406, 0x00c001d6,
-    0x2405474f, 0x00240020, 0x23f18228, 0x17353315, 0x25209f82, 0x17200382,
-    0x55909f82, 0xba6f0720, 0x2aeb2b06, 0x411e4171, 0x401ed6fe, 0x678b461e,
-    0x0155f92a, 0xc0015500, 0x40315555, 0x02821a82, 0x778c0f20, 0x822b3f21,
-    0x82002000, 0x84022000, 0x20bf857f, 0x27c1961d, 0x17163207, 0x3e352315,
-    0x2426ca8e, 0x56011812, 0xd18e1801, 0x12182a26, 0x18126b6b, 0xea275b87,
-    0x8001ab01, 0x6c000a00, 0x17200645, 0x21051341, 0x5082010f, 0x21052741,
-    0xe9821517, 0x01372a08, 0x072d2000, 0x012b19bb, 0x801bde30, 0x0f2b402b,
-    0x1b502b1b, 0x26018001, 0x802bbb1e, 0x1b143024, 0x802b2580, 0x3a651b80,
-    0x2048834f, 0x23008200, 0x80018001, 0x20277341, 0x20fb8480, 0x83008280,
-    0x06ef424c, 0xf3b63f85, 0xf38e518d, 0xc001df23, 0x05c76101, 0x7b010021,
-    0x172d073f, 0x1523012e, 0x3e17011e, 0x22353701, 0x072f5e06, 0x62261b26,
-    0x26623838, 0x01250584, 0x37240115, 0x2b028224, 0xea28234c, 0x24242701,
-    0x28ea0127, 0x420a6f74, 0x1b26051f, 0x00002400, 0x614e2301, 0x82372005,
-    0x0fa56407, 0x09f36318, 0xd5d59537, 0x55808055, 0xff16d5d5, 0x19191200,
-    0x12000112, 0x98fe1818, 0x05765a2a, 0x2a2b0127, 0x2b2a2bd5, 0x06795a95,
-    0x55211d84, 0xff6318fe, 0xd6012109, 0x2623c386, 0x18130000, 0x21084764,
-    0x217e1523, 0x16372305, 0x20653517, 0x88552010, 0x01402a5a, 0x1e1e2d1e,
-    0x550e1217, 0x217b8a2b, 0x5f844001, 0x76160124, 0x1f821e16, 0x0a010124,
-    0x7e8b4075, 0x210d575b, 0xeb84000b, 0x91652520, 0x22eb8a1a, 0x82552b55,
-    0x20e99402, 0x201983d5, 0x64e89355, 0x96200803, 0x1422eb82, 0xff421e00,
-    0x09a25705, 0x8d6f3d20, 0x55032005, 0x280805d6, 0x0123013d, 0x01544000,
-    0x090c1e22, 0x1e0c0980, 0x80540122, 0x0956090c, 0x9501800c, 0x26405401,
-    0x09311440, 0x31090c0c, 0x220a8214, 0x836cfe54, 0x0015270b, 0xff000003,
-    0x5f8701ea, 0x61822d20, 0x17011e36, 0x15070614, 0x012b0614, 0x013d2622,
-    0x3e35012e, 0x33351101, 0x13231086, 0x8207010e, 0x33152121, 0x37221582,
-    0x7095012e, 0x3d2d402c, 0x1c230101, 0x01231c56, 0x7c943d01, 0x82151521,
-    0x74012e7e, 0x212d3d01, 0x33330d34, 0x2d21340d, 0x086b483d, 0x10004026,
-    0x26002200, 0x23248b82, 0x16323315, 0x15208983, 0x25055369, 0x3b013e05,
-    0x85463501, 0x35332506, 0x37262223, 0x01310582, 0x25404055, 0x40253232,
-    0x01483740, 0xc7fe4801, 0x200b8801, 0x30198337, 0x01aaaa57, 0x4a322940,
-    0x49012932, 0x7f493636, 0x23088625, 0x10322901, 0x0bef6a18, 0x19006b29,
-    0x2e002900, 0x52003200, 0x35330669, 0x27352327, 0x1e15010e, 0x15013b01,
-    0x27012e23, 0x793f3634, 0xfe82098f, 0x8c822b20, 0x23153324, 0x03821727,
-    0x011b2b2b, 0x25561b65, 0x10362545, 0x22808712, 0x82fd1518, 0x1e222592,
-    0x011d181e, 0x6a261383, 0xae281c40, 0x347c2b19, 0x25552705, 0x0c352546,
-    0x8e851524, 0x12321e23, 0x269e821e, 0x1f113a24, 0x821c2a0a, 0x29280813,
-    0x2a2a6b29, 0x00000200, 0xc601faff, 0x1b008601, 0x00003800, 0x06141637,
-    0x34262722, 0x3236013f, 0x0f141617, 0x37273601, 0x21069958, 0x12863714,
-    0x06222086, 0xa1580717, 0x82342006, 0x06e23830, 0x2006110d, 0x55214b20,
-    0x201f1f21, 0x130a0901, 0x4b143327, 0x93074f13, 0x06132c15, 0x0d1107a2,
-    0x20562007, 0x821f1f4c, 0x1b202c31, 0x33140a19, 0x134c1327, 0x94074633,
-    0x07142316, 0x4b420011, 0x24ab8306, 0x002f001d, 0x0645413b, 0x8f8f0720,
-    0xc2832720, 0x91012e21, 0x172721c2, 0x1e24c182, 0x26270701, 0x2b26b082,
-    0x1b65011b, 0xaf8c3867, 0x82233821, 0x101123c4, 0x158c6a02, 0x561e4722,
-    0x1626c582, 0x0226080d, 0x5a410611, 0x38672105, 0x3828b78c, 0x070d0822,
-    0x91162a11, 0x472a158c, 0x0707231e, 0x261d3916, 0xbd831117, 0x002fbf84,
-    0x01c00100, 0x00120080, 0x001f0016, 0x71232100, 0x232306e9, 0x6f153311,
-    0x05200591, 0x7c670a82, 0x0155320a, 0x0113241d, 0x2c0c5555, 0x01362913,
-    0x5555d5fe, 0x0599562a, 0x18119031, 0x01901118, 0x14122b00, 0x9b283701,
-    0x18800001, 0x2208baa8, 0x82000400, 0x2a678400, 0x0022000f, 0x002f002b,
-    0x78320100, 0x33210c16, 0x2e788201, 0x07062227, 0x33152335, 0x32363435,
-    0x18011d16, 0x8209f197, 0x95012314, 0xc9661912, 0x01123606, 0x1e270120,
-    0x3c081b0e, 0x1119113c, 0x14140fbc, 0x2c15151e, 0x0e55683b, 0x1e71b533,
-    0x0d0f0127, 0x0c6ab318, 0x6a0c1111, 0x1f1401d4, 0x31028214, 0x00b3b3d5,
-    0x00000200, 0xd601ddff, 0x0d009601, 0x8b823400, 0x010f062f, 0x2f262706,
-    0x36372601, 0x26171617, 0x82018227, 0x2106820c, 0x1a830706, 0x07060728,
-    0x3716010e, 0x1c82013e, 0x82361621, 0x1e560823, 0x01363701, 0x130f0838,
-    0x0e050c0c, 0x35110f17, 0x1e8b1034, 0x03061134, 0x07020602, 0x1a3a3b17,
-    0x050a0307, 0x04203310, 0x0e0c0c06, 0x45150319, 0x01147c45, 0x031f0f09,
-    0x050e0101, 0x0a090c09, 0x0b0d0903, 0x08161509, 0x123543a6, 0x1c0b0b16,
-    0x02320e0e, 0x05823201, 0x330f1527, 0x0c140940, 0x2b208202, 0x39171b45,
-    0x04030940, 0x00081006, 0x2808b36e, 0x00ab01ab, 0x00210008, 0x6d28192a,
-    0x1716220c, 0x06bf7415, 0x013e3524, 0x1274013b, 0x05357307, 0x012e3524,
-    0x65640001, 0x74922005, 0x12210cad, 0x05935e15, 0x241b6b2b, 0x24018001,
-    0x24180155, 0x20028218, 0x09ad57bf, 0xed5e2b20, 0x6b2b2805, 0x2b1b2401,
-    0x48241b2b, 0xab280b43, 0x27001e00, 0x32010000, 0x2e217c8f, 0x05986f01,
-    0x011e3725, 0x18071517, 0x200bae42, 0x09297501, 0x01c01227, 0x01243624,
-    0x8581862b, 0x1501219e, 0x1b217a8a, 0x808d1824, 0xc02b2107, 0x6f439986,
-    0x01ab2206, 0x280982ab, 0x002b0022, 0x21352500, 0x27819f15, 0x3634012e,
-    0x06141632, 0x41057964, 0x85930d01, 0xd6d61524, 0x889e0001, 0x80180020,
-    0xab28091b, 0x0c000800, 0x2e002500, 0x200a4763, 0x61969417, 0x1520050a,
-    0x23109541, 0x0100ff6e, 0x410d4776, 0x41201699, 0x9d41998e, 0x46022010,
-    0x062d08db, 0x00001e00, 0x35233537, 0x27173533, 0x056b4333, 0x0805de46,
-    0x33153320, 0x23152311, 0xd5363435, 0x9a709595, 0x181812c0, 0x1912c012,
-    0x2bc0c02b, 0x56455019, 0xd4697045, 0x56562908, 0x56565601, 0x00001812,
-    0xdb225785, 0xf7629601, 0x28578606, 0x011d1632, 0x11233523, 0x082c4733,
-    0x3411352a, 0x6b013336, 0xc6709696, 0x5b825286, 0x58876082, 0xfe565623,
-    0x225283aa, 0x83011218, 0x20578258, 0x05d76500, 0x8f4a0d20, 0xfcdc1807,
-    0x012e2507, 0x07010e07, 0x01330d89, 0x03846400, 0x516d022b, 0x2b026d51,
-    0x3f648403, 0x422a0155, 0x2a24053c, 0x40015501, 0x52331182, 0x6c02026c,
-    0x52846452, 0x2e405402, 0x3c01013c, 0x7154402e, 0x0b240ceb, 0x25001900,
-    0x620d8151, 0x33240695, 0x013d3632, 0x557f7182, 0x23352308, 0x9d620001,
-    0x12ab2811, 0x46780218, 0x8256562a, 0x62152002, 0x1825129d, 0x785bab12,
-    0x7b1d8368, 0xff26055b, 0x01ae01e5, 0x5618009b, 0x012508b7, 0x37270717,
-    0x82048227, 0x17152206, 0x31088207, 0x37173733, 0x07010717, 0x6a1f87a6,
-    0x5b1e6a88, 0x08831e69, 0x5aa61e22, 0x012d0a84, 0x1e88a69b, 0x1e88886a,
-    0x871f6a5a, 0x2109825a, 0x0a84a61e, 0x24060743, 0x009601c0, 0x06254f11,
-    0x2d07c94a, 0x010e1523, 0x27012e07, 0x35333735, 0x03820523, 0x6c024027,
-    0x026c5252, 0x052b4155, 0x5555d629, 0x5555d5fe, 0x41802b01, 0x8021052d,
-    0x05294180, 0x402a8022, 0x09cf5718, 0xa001c022, 0x1f235786, 0x98130000,
-    0x07372559, 0x23371533, 0xd5245f94, 0x2b552b55, 0x0b246495, 0x00a075a0,
-    0x2205f741, 0x828001b6, 0x821e20bd, 0x05814963, 0x17331729, 0x27352707,
-    0x8223010e, 0x3e2708c0, 0x010e1701, 0x36321614, 0x3bcb2634, 0x1011014e,
-    0x206a1106, 0x2e12066a, 0x014f3b1a, 0x293b4f01, 0x36523636, 0x82800136,
-    0x2e1a230a, 0x1b820612, 0x1006112a, 0x3b4e0111, 0x012a4f3b, 0x52211a83,
-    0x07b74236, 0x9601d626, 0x17001300, 0x07206786, 0x785d6686, 0x15073006,
-    0x40c03533, 0x111d0154, 0x802a800c, 0x82332612, 0x54012b0b, 0x9501aa15,
-    0x33405401, 0x14821226, 0x1d110c22, 0x40250b82, 0x2a2a7f54, 0x20538d00,
-    0x4d53951f, 0x3521084a, 0x255b9223, 0x2a40402b, 0x5f924040, 0xc05e3f20,
-    0x08638605, 0xd701eb23, 0x0d009501, 0x00004300, 0x2b012e25, 0x15010e01,
-    0x3e331614, 0x1e273701, 0x36341701, 0x011e3337, 0x34118207, 0x27013e37,
-    0x0e070626, 0x011e1701, 0x07163637, 0x26272606, 0x22088236, 0x83061617,
-    0x4135200b, 0x7d08074d, 0x2c034a01, 0x27240221, 0x2c24212a, 0x2c185102,
-    0x02080a11, 0x0d01080c, 0x360d1806, 0x2a287a37, 0x7a1f1825, 0x170c1932,
-    0x23359c2a, 0x97445518, 0x36033736, 0x1102341a, 0x4632182c, 0xc2460101,
-    0x2f012724, 0x012a2621, 0x0180202b, 0x0a081113, 0x040f0101, 0x050608a9,
-    0x2e368219, 0x6c1d1c01, 0x13293f3b, 0x130d2507, 0xa03c511e, 0x36132737,
-    0x112fa63f, 0x100b1d19, 0x32450213, 0xd3864633, 0xc001ff28, 0x03008001,
-    0xd3821600, 0x35272308, 0x07233717, 0x15060727, 0x32171611, 0x3717013f,
-    0x26113536, 0x80804001, 0x80720375, 0x0a010878, 0x07840201, 0xfd2d2b2b,
-    0x2d2d582d, 0xfe080229, 0x287682be, 0x03292d2c, 0x0a420107, 0x0c2b4c00,
-    0x14000822, 0x660a9d52, 0x002a0cc2, 0x2e1e1e17, 0x40171e1e, 0x4f710154,
-    0x83cb2007, 0x1e2e2310, 0x507101ca, 0x0a936109, 0x17000b26, 0x2c002000,
-    0x23142944, 0x2e37013e, 0x24059e61, 0x06141632, 0x05537827, 0x01201484,
-    0x1758e918, 0x120e5b2d, 0x12121c12, 0x012e220e, 0x82054705, 0x2e012302,
-    0x4a180215, 0x4a180768, 0xde200e3d, 0x2a067b61, 0x32232e70, 0x56020256,
-    0x472e2332, 0xc34e09fb, 0x00142205, 0x18998221, 0x2013634b, 0x05c07907,
-    0x8e822720, 0x01010e27, 0x1e1e162b, 0x22f6822d, 0x8202543f, 0x820a29f6,
-    0x8054020a, 0x16156506, 0x01240c82, 0x221e2f3b, 0x2b120341, 0x17994c94,
-    0x5bb30719, 0x1b0e4d34, 0x29075f79, 0xab01eaff, 0x0e009601, 0x75821f00,
-    0x18012f21, 0x2a07bc94, 0x37173736, 0x06163203, 0x493e1707, 0x172807b9,
-    0x625d0136, 0x04441bb5, 0x2b346183, 0xab1b481c, 0x10011e17, 0x0114104d,
-    0x37204054, 0x690f4515, 0x10381d83, 0x07b35b11, 0x1b472834, 0x2f1e1a01,
-    0x3c1e4e0f, 0x0154401b, 0x11441518, 0xd520e787, 0x0b246f84, 0x2a001400,
-    0x08255718, 0x21050f44, 0x0f440622, 0x0e132205, 0x05c27401, 0x82061721,
-    0x36322ff2, 0x37272637, 0x0001011e, 0x08014936, 0x02820870, 0x49012c08,
-    0x18181236, 0x99181824, 0x60926002, 0x1f230102, 0x0101240d, 0x01496c49,
-    0x1f0d2401, 0x01950123, 0x994d3648, 0x4d990505, 0x4a544836, 0xfe3505a5,
-    0x303025eb, 0x0c231425, 0x16170f13, 0x17161e1e, 0x230c130f, 0x05876e00,
-    0x6b01ab2c, 0x13000600, 0x2d002000, 0x93823a00, 0x01271522, 0x13200182,
-    0x48058954, 0x272505fe, 0x15070622, 0x06595c1e, 0xae822720, 0x013e3522,
-    0x8205985f, 0x011d2119, 0x3730b783, 0x01012e35, 0xeafe20ab, 0x2015012a,
-    0x24241c2b, 0x07f6b918, 0x0c010127, 0xdf0c0c12, 0x82a2821b, 0x1c242313,
-    0x0f820c09, 0x01311482, 0xfe206b6b, 0x16012aeb, 0x01aafe20, 0x1b2b1b24,
-    0x23048424, 0x2b090c7f, 0x04832282, 0x16952b20, 0x5f450020, 0xcb370806,
-    0x0b001601, 0x00001200, 0x17333537, 0x23153337, 0x15270735, 0x33153325,
-    0x2b332707, 0x2b40402a, 0x0140402b, 0x56364000, 0xaa6b3555, 0x6eaa4040,
-    0xaa6e4040, 0x84606055, 0xd5ff293f, 0xab01c001, 0x14000500, 0x3a083f82,
-    0x37173727, 0x0e213517, 0x16111501, 0x3637011f, 0x26341137, 0x4c1e6ad5,
-    0xd6fe1ea2, 0x12011813, 0x0112adad, 0x1f6a6b19, 0x801ea24d, 0xfe121801,
-    0x740c17ec, 0x01170c74, 0x54181214, 0x2b080acb, 0x000f0003, 0x21271300,
-    0x2315010f, 0x23352115, 0x21353735, 0x012ba015, 0x6b752b16, 0xab6b0001,
-    0x2b0180fe, 0x80802a2a, 0xaa802b2b, 0x21057f56, 0x00820002, 0x01d60127,
-    0x00160063, 0x8287821c, 0x22c28231, 0x83352707, 0x0715238f, 0x08823717,
-    0x37071522, 0xab311084, 0x156b6b80, 0x7f7f1615, 0x6c566c16, 0x96961515,
-    0x3d008215, 0x644a1a5e, 0x0d7b3e3e, 0x4a0eaa0d, 0x3eac0e4a, 0x0d5e3e32,
-    0xe856770d, 0x0c190c0c, 0x4f4a000c, 0x82962008, 0x244508e5, 0x00002a00,
-    0x26343501, 0x010e1523, 0x07171615, 0x33013f15, 0x34373632, 0x07060726,
-    0x34352622, 0x37363536, 0x14151632, 0x2f151306, 0x01373601, 0x230a0b15,
-    0x7c10011d, 0x1c09732f, 0x16170123, 0x0b0a0d06, 0x3f048402, 0x165e2f98,
-    0x1a660110, 0x062f0b0a, 0x111a1520, 0xd62a2ce9, 0x20151c24, 0x0c010a40,
-    0x0304030a, 0x09290682, 0xf4fe0503, 0x07af2a2c, 0x21e1820c, 0x04840100,
-    0x5601d030, 0x00001500, 0x23012e01, 0x33071721, 0x03833337, 0x085a3220,
-    0xb7013d06, 0xfe17290e, 0x4e3024d6, 0x4e2f4230, 0x0c0d282f, 0x274e2a02,
-    0x31010a04, 0xde4c1212, 0x0f250082, 0x17b2c20d, 0x843e822c, 0x01d62a4b,
-    0x0025006a, 0x2f361300, 0x05fc4101, 0x17060731, 0x011f0615, 0x37352315,
-    0x013d013e, 0x87272307, 0x362e080e, 0x06015d27, 0x545f7c28, 0x01042276,
-    0xa7210401, 0x60010223, 0x08026f0d, 0x082c7f2d, 0x09240102, 0xd1073005,
-    0x032107d1, 0x0306f006, 0x08820721, 0xc2040329, 0x0ba3f4f4, 0x82083608,
-    0x820b2002, 0x09df4d6f, 0x33000327, 0x3b003700, 0x05d75f00, 0x35233528,
-    0x012b2634, 0x76822335, 0x22270382, 0x23011d06, 0x83153315, 0x16142403,
-    0x6115013b, 0x32240678, 0x33013d36, 0x07242b82, 0x37333523, 0x012f1c82,
-    0x55d6d66b, 0x2b12182b, 0x2b2b2a2b, 0x822b1812, 0x280c8a00, 0x2b2a2a80,
-    0xd6558080, 0x201b9256, 0x8335852b, 0x51968221, 0xc022065f, 0xcb554001,
-    0x13002306, 0x01881521, 0x80014024, 0x038880fe, 0x402b4025, 0x822b402a,
-    0x058b4134, 0xeb006b30, 0x00000200, 0x95371737, 0x6beb6b6b, 0xa341006b,
-    0x012b2206, 0x2617832b, 0x01170701, 0x836b6b2b, 0x88002003, 0x85402033,
-    0x013f261b, 0x6b6bd527, 0x86338955, 0x013f224b, 0x204b8217, 0x21178680,
-    0x7f4eeaff, 0x01003606, 0x15062221, 0x32213711, 0x34113536, 0xfeab0126,
-    0x551812aa, 0x27f78201, 0x18950118, 0x5580fe12, 0x53052854, 0x03240d8b,
-    0x15000700, 0x21056541, 0xf8532315, 0x21438807, 0x00822a15, 0x48899620,
-    0xab55eb24, 0x4b9ad52b, 0x1a000c22, 0x372b4b83, 0x37350533, 0x16011f36,
-    0x8d13010f, 0xa0802d94, 0x00ff752b, 0x25080793, 0xf6920707, 0x952c5889,
-    0x92362b2b, 0x07260606, 0x00019308, 0x0220608d, 0x2308136e, 0x00120004,
-    0x8d056976, 0x4a6b2555, 0x16604a36, 0x60234c8a, 0x8f806040, 0x89002046,
-    0x830d2047, 0x0d2d4147, 0x07210324, 0x32412111, 0xfe12250b, 0x56012bd5,
-    0x250c3841, 0x012bd6fe, 0xdf47002b, 0x0003260a, 0x000b0007, 0x053d4119,
-    0xb9550720, 0x29f08d07, 0x562b2b6b, 0x2b552a2a, 0x9f89eb2b, 0x832bd521,
-    0x0f934100, 0x09a35a18, 0x00000d23, 0x0b977701, 0x4d011721, 0x0126084a,
-    0x6b01552b, 0x5b551812, 0x93552005, 0x2101248b, 0x86152135, 0x8d372003,
-    0x18802045, 0x2409c66c, 0x18550001, 0x21918312, 0x52831218, 0x6b2b1522,
-    0xab200182, 0x974e5889, 0x05db5008, 0x1d4c1120, 0x0d334105, 0x67820520,
-    0xf5821720, 0x6d823720, 0x290b3a41, 0x0001c3fe, 0xabab00ff, 0x6f8355ab,
-    0x240c4241, 0x2b402b95, 0x0c434155, 0x2005075a, 0x0ac7511a, 0x34110729,
-    0x11153336, 0x83112137, 0x33152460, 0x84012315, 0xd5fe2198, 0x1924b282,
-    0xd5fe3d01, 0xc0215e83, 0x315883c0, 0x191200ff, 0x12800155, 0xe7fe2a18,
-    0x40000119, 0xf7532b2b, 0x05134305, 0x2105d942, 0xa3821527, 0x8d3f1521,
-    0x800122bb, 0x209f8255, 0x0993412b, 0x45459525, 0x824444ab, 0x0c274361,
-    0x26053746, 0x00960196, 0x501d000c, 0x222908a3, 0x3e352726, 0x010e1701,
-    0x315a8207, 0x3327012e, 0x3e17011e, 0x00013701, 0x0101241b, 0x04833624,
-    0x4701b026, 0x47382a38, 0x3a075a4e, 0x1c249501, 0x24241b80, 0x241c801b,
-    0x0a5139c0, 0x510a4141, 0x013c2d39, 0x442d3c01, 0x962f085b, 0x0d000500,
-    0x00002600, 0x27071425, 0x83073536, 0x16322763, 0x07012717, 0x68890627,
-    0x37323324, 0x73820727, 0x01273528, 0x091a1395, 0x70848031, 0x6501e532,
-    0x1e19591b, 0x0149362a, 0x2e420124, 0x0e23171a, 0x24088b82, 0x2026d580,
-    0x0317141b, 0x241c047f, 0xfe2b1c24, 0x0e591b9b, 0x09464605, 0x3c30374f,
-    0x0102230b, 0x80101b24, 0x6fb91800, 0x00962608, 0x001b000f, 0x217f8228,
-    0xe182010e, 0xab562320, 0x3e272208, 0x22878201, 0x82061407, 0x53e78315,
-    0x1e2706d9, 0x01710101, 0x82425c42, 0x36492171, 0xaf257983, 0x0e160e01,
-    0x20048401, 0x0909411a, 0x3c30d527, 0x4f37303c, 0x2a778409, 0x0f0f0b82,
-    0x0e0b840b, 0x823e0b0e, 0x8380207d, 0x1b802396, 0xf9820024, 0xc0ff0026,
-    0xab019601, 0x13228382, 0x295b1700, 0x72252005, 0x888706a8, 0x35330723,
-    0x23038323, 0x37363237, 0x10838388, 0x82950121, 0x268889f4, 0x552b2b54,
-    0x89152a2a, 0x2b502882, 0x3b31eb2b, 0x8538313b, 0x2bf32485, 0x41c02b2b,
-    0xeb20098f, 0x08d74418, 0x8001ab2b, 0x27000600, 0x00003000, 0x29748213,
-    0x17013e23, 0x1e152307, 0x6f823201, 0x37013e36, 0x23170733, 0x15070622,
-    0x2622010e, 0x27233527, 0x06332726, 0x08c54718, 0x3024c036, 0x3001aa01,
-    0x01161261, 0x01182418, 0x2b243001, 0x122b1616, 0x48310983, 0x12160130,
-    0x06a60610, 0x0c0c094d, 0x010c0c12, 0x2a1d8280, 0xaf903024, 0x19191215,
-    0x82256a12, 0x8415201e, 0x25302707, 0x1610af15, 0xd65e2a16, 0x82002005,
-    0x00062500, 0x01d5ff00, 0x0f2a9783, 0x1c001700, 0x32002600, 0x1d563a00,
-    0x069f4f06, 0x37208783, 0x2720ad83, 0x9283ae83, 0x2720b287, 0x1a82b188,
-    0x16140730, 0x27373233, 0x011b2b06, 0x033b1b65, 0xaf82232f, 0x0b121624,
-    0x07824e06, 0x0c3a5929, 0x2b01501f, 0x85220642, 0x8e3921bc, 0x2429bb86,
-    0x0cba2a0a, 0x1e050709, 0x051c5603, 0x2d223a22, 0xa582d982, 0x770f0b22,
-    0x3a27c382, 0x04910f0c, 0x84bf162a, 0x382523c7, 0xc6821663, 0x19240429,
-    0x0c092a1c, 0x82051e03, 0x069f44be, 0x2405ab4d, 0x000b0007, 0x2bbb820f,
-    0x17231533, 0x37333523, 0x13352315, 0x2b210782, 0x200083c0, 0x230483d5,
-    0xd5c08001, 0xc0230182, 0x4fc06bfe, 0x0f210c1f, 0x93451800, 0x47172012,
-    0x352005ff, 0x0b517518, 0xcb605520, 0x553d280a, 0x2a562a2a, 0x4555552a,
-    0x5a1805c4, 0x552408f7, 0x2b802b55, 0x55250282, 0x00005555, 0x33678201,
-    0x00960100, 0x000300d6, 0x35212500, 0xfe950121, 0xab2a01d6, 0x22069f4f,
-    0x85010000, 0x451320bb, 0x915b05e3, 0x6b01230f, 0x2575d6d6, 0x2aab220b,
-    0x07245fab, 0x132a0122, 0x2008ef52, 0x206182d6, 0x20fb8303, 0x0f157525,
-    0x6b233f82, 0x7502785b, 0xab210705, 0x0e10752a, 0xdf479582, 0x000b2406,
-    0x4e1b0017, 0x33201a49, 0x84156952, 0xd6c6225c, 0x136552d6, 0xe8207584,
-    0x0020ea83, 0x09d7f218, 0x0d550320, 0x15232205, 0x05764c37, 0x15230727,
-    0x15011e33, 0xcff21833, 0xaa552619, 0x181812c0, 0xc5f21812, 0x2bd52314,
-    0x4c62ab2b, 0x062b7105, 0x0c01012f, 0x0c092a09, 0x18012a01, 0x1912d512,
-    0x08e74100, 0x9601eb24, 0xe1840300, 0x21112128, 0x06222135, 0x3b5a1107,
-    0x05b06805, 0x18363221, 0x231bf1c4, 0x2a00016b, 0x23051247, 0x2b2a2a2b,
-    0x2806e648, 0xff000003, 0x010002d5, 0x215784ab, 0xe3550024, 0x011d2107,
-    0x2505165b, 0x33352315, 0xcb452335, 0x27333805, 0x34112311, 0x15213736,
-    0xabfed501, 0x19125501, 0x2b801219, 0x55802bab, 0x552005e5, 0x80215383,
-    0x08355555, 0x2705484a, 0x2b1812d6, 0x000100ff, 0x2b202382, 0x0420c782,
-    0x0129cc85, 0x00080080, 0x001a0011, 0x0a475029, 0x3b566682, 0x27088805,
-    0x0f062125, 0x17161701, 0x2007ad49, 0x05ea7395, 0x75717820, 0x2e068305,
-    0x0112121c, 0x16c0fe07, 0x0d73730c, 0x823e0117, 0x73a02092, 0x0b850be9,
-    0x334de020, 0x42122006, 0x0720056f, 0xf835f382, 0xc0010002, 0x10000c00,
-    0x3a003100, 0x4c004300, 0x00005500, 0x33ea8201, 0x012e3335, 0x14062223,
-    0x17370716, 0x36371723, 0x27072734, 0x0f361183, 0x15070601, 0x07010e23,
-    0x1e333615, 0x07141701, 0x3e352633, 0xee560501, 0x08887c07, 0x41081191,
-    0x2f2f5d01, 0x0d150628, 0x731a1a14, 0xc6995f3f, 0x270e0e20, 0x0b120670,
-    0x0b560b11, 0x18111c01, 0x2e0c0c01, 0x6d030240, 0xfe3e0102, 0x202019eb,
-    0x19212132, 0x4e353527, 0x1f013535, 0x32212119, 0x0e872020, 0x162e6535,
-    0x271a0c0b, 0x39346d1a, 0x230e2034, 0x096d270f, 0x82540b09, 0x19012848,
-    0x01030914, 0x820b303d, 0x3e313200, 0x311f01a3, 0x1f312020, 0x4d340193,
-    0x344d3333, 0x200f8e93, 0x21008200, 0x33450003, 0x00aa2905, 0x000d0004,
-    0x13000012, 0x3321da82, 0x05a34707, 0x3721352c, 0x012e3315, 0x025341eb,
-    0x3c519696, 0xaafe2e05, 0x530296c0, 0x5d09a901, 0x60498043, 0x24148202,
-    0x43a9d455, 0x873d825d, 0x00102647, 0x001b0016, 0x0d774520, 0x23273330,
-    0x15013f34, 0x013e2723, 0x07061517, 0x60823727, 0x1b2b2329, 0x1b1b6501,
-    0x82223c17, 0x2b502d48, 0x04920425, 0xe239146b, 0x04900901, 0x44457083,
-    0x16192305, 0x64830118, 0x11112b2d, 0x196ca987, 0x1f55d020, 0x82d48f1b,
-    0x22bb887d, 0x829401d6, 0x00092f7d, 0x0100002b, 0x011e3523, 0x37013e07,
-    0x81781715, 0x36322305, 0x8b46013d, 0x011d2108, 0x2e060446, 0x3527012e,
-    0x562b0133, 0x01d52f26, 0x8280262f, 0x01320803, 0x01243724, 0x152a2530,
-    0x19122a15, 0x2d2e3c01, 0x2f26013c, 0x2b01d601, 0x27390868, 0x68083927,
-    0x0939276b, 0x24241b17, 0x30246b1b, 0x18161501, 0x05586b12, 0x09172405,
-    0x82402739, 0x08bf628a, 0x1000942c, 0x19001500, 0x27001d00, 0x03413400,
-    0x2076840d, 0x32a28337, 0x36271527, 0x33271517, 0x011e1507, 0x37363217,
-    0x8a370627, 0x2b2729a5, 0x1b65011b, 0x1e300e1f, 0x25218685, 0x2fa982b1,
-    0xa117387f, 0x01564444, 0x20151b24, 0x62164807, 0xe45dad88, 0x171e2606,
-    0x3d01011c, 0x838f842d, 0x574127b5, 0x04cc1838, 0xb482a944, 0x12170125,
-    0x864d1449, 0x2a4421b7, 0x2209ab4e, 0x8218006b, 0x2317230c, 0x03872327,
-    0x15010e23, 0x064e6611, 0x80011126, 0x2b2b402b, 0x2a260382, 0x162a402a,
-    0x3c581812, 0x6b012205, 0x5a008456, 0x01200a53, 0x2409bf4d, 0x008001b2,
-    0x38f58211, 0x17371533, 0x27071707, 0x07352315, 0x37273727, 0x872aeb17,
-    0x15868615, 0x2b068487, 0x80018616, 0x4d254d9b, 0x9b4e254e, 0xaf500786,
-    0x000f220a, 0x11a75c21, 0x35331323, 0x25478217, 0x23350727, 0x59822715,
-    0x5c371721, 0x132b0799, 0x80131818, 0x3c153d2a, 0x863d153c, 0x0b925c06,
-    0xfe181327, 0x252346d5, 0x20028223, 0x18078646, 0x200c0742, 0x296b821d,
-    0x06141523, 0x36342622, 0xcc613237, 0x55012412, 0x612e1e40, 0x402005c3,
-    0x0a404118, 0x7500012b, 0x2d1e1e17, 0x760b011e, 0x08205d55, 0xa3452a20,
-    0x09236b05, 0x1d000d22, 0x618dcd84, 0x2405175a, 0x26222123, 0x05bd4b35,
-    0x8b112121, 0x0a715d65, 0x66972a20, 0x0c934c18, 0x2205bf4b, 0x8219000d,
-    0x233524cb, 0x57232615, 0x3d2105c2, 0x25e41801, 0x5501240b, 0x82120e55,
-    0x1e2e21b2, 0x220e577c, 0x82010b76, 0x171e22c7, 0x256c1875, 0x0100220b,
-    0x28008200, 0x80019601, 0x00000d00, 0x33538801, 0x35333537, 0x10100001,
-    0x52363629, 0x01550136, 0x0106c680, 0x36230982, 0x4840e029, 0x8f64081f,
-    0x47338406, 0x32250510, 0x35333736, 0x2b3a8623, 0x460a3020, 0x40300a46,
-    0x555b0a30, 0x23244085, 0x231c401c, 0xc0200482, 0x02214382, 0x23778700,
-    0x001b0012, 0x458b7986, 0x1e071123, 0x05ae4101, 0x4c8b8783, 0x7d546020,
-    0x87938405, 0x00012252, 0xc34118f5, 0xf6ff290c, 0x8001c001, 0x13000500,
-    0x17205b83, 0x05229282, 0x6a621707, 0x3e2a0805, 0x37173701, 0x55400001,
-    0x861cdcfe, 0x01013327, 0x36272936, 0x011b6502, 0x79407980, 0x861b2040,
-    0x29273602, 0x33010136, 0x7b656527, 0x82962008, 0x8212204b, 0x11332349,
-    0x7f4b1533, 0x33352106, 0x32214882, 0x20488317, 0x83e5845b, 0x102026ec,
-    0xff800110, 0x23e68500, 0x0601231c, 0x200a5f41, 0x82e59318, 0x142f4198,
-    0x220e3141, 0x4115406b, 0x002a0933, 0x001000c0, 0x37000019, 0x30410622,
-    0x012e210b, 0x23083141, 0x0a311fe0, 0x31288e82, 0x5b0a313e, 0x1f310a5b,
-    0x25053041, 0x401d23c0, 0x0484231d, 0x2c413520, 0x055f4f08, 0x92019923,
-    0x20df8200, 0x21d28225, 0xde57012e, 0x05455406, 0x39150135, 0x5402014a,
-    0x0254403f, 0x80364601, 0x68802a01, 0x823a5208, 0x5402370d, 0x0a513840,
-    0x002a2a54, 0x00000200, 0xd901eaff, 0x08009201, 0x97822700, 0x2007945e,
-    0x824b8a25, 0x723420e8, 0x33280686, 0x23352115, 0x60013e35, 0x2105b957,
-    0x5e888701, 0x0c15ab2d, 0x0c094009, 0x40550115, 0x57d54a39, 0x262006ac,
-    0x402d6c89, 0x0c0c0956, 0x2a6a5609, 0x00520853, 0x065b4100, 0x9601a024,
-    0x0c820500, 0x37170333, 0x00013717, 0x91910fa0, 0xfe95010f, 0x40400f7a,
-    0x289b850f, 0x01d001ee, 0x000b009b, 0x209b821b, 0x84248227, 0x17072303,
-    0x08843707, 0x07173723, 0x230c8227, 0x1eee0727, 0x3c270086, 0x428e3d97,
-    0x822dd32d, 0x1e5b2c0e, 0xd32e1f1e, 0x1e7c602e, 0x821f1f1f, 0x3c1e240f,
-    0x84333c97, 0x1e1f211b, 0x1e201b82, 0x61202582, 0x2008ab4e, 0x22638480,
-    0x41000024, 0x13200b47, 0x2c0e0544, 0x32013e17, 0x22061416, 0x36000126,
-    0x07b87a49, 0x44cb4921, 0x1328050c, 0x40131818, 0x30483001, 0x40230282,
-    0x88364901, 0x443f2021, 0x1323097b, 0x8324c018, 0x7930201f, 0x9626086f,
-    0x1a000a00, 0x77822600, 0x3736272a, 0x16372734, 0x27061415, 0x25065e6b,
-    0x2e071714, 0x64183501, 0x6a360ed5, 0x0c01182e, 0x7e171e2e, 0x132e2633,
-    0x18302418, 0x0117142e, 0x734b4054, 0x56792f09, 0x1824182e, 0x33262e13,
-    0x1eea361f, 0x92820c2e, 0x152e182a, 0x54401f36, 0x5b780241, 0x00202787,
-    0x04200082, 0x00330382, 0x6b01d601, 0x19000f00, 0x37002500, 0x1e010000,
-    0x18111501, 0x2b0933a3, 0x23351737, 0x15232715, 0x37173533, 0x20440982,
-    0x35232105, 0x23201583, 0x2506ba54, 0x013b011e, 0xd0503632, 0x12aa3e06,
-    0x60121818, 0x1a1a361a, 0x55558437, 0xca353535, 0x181b181a, 0x090c011b,
-    0x010c0955, 0x0b90466b, 0x18120027, 0x4b80eb01, 0x3002824b, 0x1b801b65,
-    0x50181b17, 0x4b4b606b, 0x0c096b60, 0x2097820c, 0x83038205, 0x7680209b,
-    0x242708e7, 0x21250000, 0x78152135, 0x07200698, 0x37220782, 0x01880727,
-    0x45181120, 0xb86d0748, 0x82962005, 0x96c02500, 0x2324c796, 0x04840182,
-    0x1c472320, 0x40d52905, 0x2a802b95, 0x24b1802a, 0xfe270089, 0x191912ab,
-    0x82550112, 0x05174673, 0x6701c23a, 0x32001d00, 0x00004700, 0x1e363013,
-    0x020e1401, 0x2726012f, 0x0e160626, 0x34210682, 0x05806b36, 0x37362636,
-    0x1607011e, 0x06140706, 0x013e3426, 0x022e3537, 0x07163634, 0x32211389,
-    0x08138636, 0x0e0ee283, 0x0d0f0a15, 0x0a313d05, 0x09080205, 0x1102180e,
-    0x0c6d1207, 0x0a140106, 0x010a1bbc, 0x0e1b0a01, 0x011b0316, 0x16031b01,
-    0x08174c0e, 0x17080101, 0x1302160d, 0x02130303, 0x1d010d16, 0x382d0e02,
-    0x03021430, 0x0306252e, 0x02122f0e, 0x1d2f2f1a, 0x065a0701, 0x11373202,
-    0x075b3b40, 0x013b5b07, 0x02130a08, 0x3a013a4c, 0x0a13024d, 0x472d2308,
-    0x30460707, 0x120b0801, 0x37013731, 0x0a12012f, 0x09b37c07, 0x08006b29,
-    0x34001e00, 0x45250000, 0x272f07a6, 0x1d011e33, 0x23352301, 0x17353315,
-    0x70233507, 0x0126058a, 0x3d012e23, 0x13823301, 0x27152325, 0x4d331537,
-    0x0120053f, 0x2e063163, 0x18129699, 0x402b962a, 0x18122b40, 0x8b680118,
-    0x9964180d, 0x01812607, 0x40401218, 0x2623836b, 0x126b1218, 0x8eabfe18,
-    0x20938410, 0x051b47ff, 0x93821a20, 0x00002e2a, 0x06222301, 0x010e011d,
-    0x09ca6e18, 0x23153329, 0x23353335, 0x4d172111, 0x47180648, 0x57820d34,
-    0x010c0a33, 0x01182418, 0xaa400a0c, 0x0001552a, 0x01aafe2b, 0x060a5456,
-    0x9c835620, 0x12194026, 0x0c130630, 0x122d0a82, 0x3006130c, 0xff2baaaa,
-    0x56012b00, 0x0830542a, 0x00202582, 0x28056f44, 0x01c001e7, 0x00400099,
-    0x06fb6469, 0x15072408, 0x1e011f16, 0x36323701, 0x2726013d, 0x15070623,
-    0x012f0614, 0x34013d26, 0x1f36013f, 0x011d1601, 0x83010f14, 0x22058211,
-    0x82062207, 0x82322011, 0x35372218, 0x2d248226, 0x14062217, 0x011e1716,
-    0x22231607, 0x3d832726, 0x06152f08, 0x36321716, 0x34022e34, 0x16323736,
-    0x013b1617, 0x26353632, 0x08090001, 0x0101109e, 0x0f0f2910, 0x01191607,
-    0x01041404, 0x022c1114, 0x02869f02, 0x0228032c, 0x07050c02, 0x35050202,
-    0x2a851208, 0x22089e3f, 0x21252523, 0x01011425, 0x01161f31, 0x04150401,
-    0x26332201, 0x13492329, 0x17171b0f, 0x08448203, 0x04030223, 0x04019901,
-    0xb8130a5b, 0x07170a13, 0x18190104, 0x010104b5, 0x0d0bb504, 0x02021908,
-    0x5c0103b8, 0x23028201, 0x0202b803, 0x19220882, 0x60820101, 0x1f040324,
-    0x31850505, 0x83045b2d, 0x0215321a, 0x1a070c04, 0x82031010, 0x24153037,
-    0x15331c01, 0x0e100908, 0x04100d01, 0x18380203, 0x2a0ddb4a, 0x00100002,
-    0x17352500, 0x6f062225, 0x27260984, 0xfe752b01, 0x7d6f13cb, 0xeb802306,
-    0x50187575, 0xd521087f, 0x203f8380, 0x24048303, 0x8001c001, 0x203f8300,
-    0x23418216, 0x33012f33, 0x07e74b18, 0x34113529, 0x21111736, 0x82352335,
-    0x75200847, 0x1980d5c0, 0x13d6fe12, 0x01131818, 0x75eb952a, 0x12d58020,
-    0x01121919, 0x2b18132a, 0x9595d6fe, 0x1c204f91, 0x13234f92, 0x82333533,
-    0x15232450, 0x8d331523, 0x2b682355, 0x02824040, 0xfe21588c, 0x211283c0,
-    0x5e18002b, 0xa785090f, 0x59852220, 0xa9912120, 0x5c820320, 0x15216282,
-    0x27608233, 0x75754001, 0x800001eb, 0x26096842, 0x2b2b6a96, 0x8c2b2b2a,
-    0x21bc8463, 0x188200ff, 0x97451982, 0x07134108, 0x18001422, 0x1726c592,
-    0x05352115, 0x17413315, 0xd6fe2211, 0x255c8cc0, 0x552b2bc0, 0xe7462b2b,
-    0x29098308, 0x000b0007, 0x35213700, 0x03820721, 0x48823720, 0x2a016b31,
-    0x012bd6fe, 0x55d5fe2b, 0x2aab2b01, 0x73ab2b80, 0x01290923, 0x002b01d6,
-    0x001e0005, 0x83338233, 0x251526da, 0x23070614, 0x070b4635, 0x84723320,
-    0x32232b05, 0x15071516, 0x36343523, 0x2583013b, 0x3a07bb74, 0x552a5515,
-    0x12185501, 0x2b2b5656, 0x18125656, 0x120e0e12, 0x121880aa, 0x5055552b,
-    0x2b250589, 0xd62bab55, 0x820b822b, 0x2b2b2bfe, 0x20121801, 0x0e12120e,
-    0x2b822b20, 0x1a820e84, 0x97452b20, 0x01c02808, 0x000f0080, 0x4c23001f,
-    0x1720117d, 0x18050574, 0x24071297, 0x15330727, 0x0b196923, 0x19128025,
-    0x842a1219, 0x2a2a2104, 0x200d1069, 0x51758255, 0x06830617, 0x7a802b21,
-    0x032f0c83, 0x1c001300, 0x30002c00, 0x11250000, 0x82011121, 0x0e1122d9,
-    0x07194c01, 0x1107372b, 0x2e211521, 0x21112701, 0x05f05e33, 0x45012b21,
-    0x1728053d, 0x01353315, 0x01d5fec0, 0x0120c182, 0xfe2a6182, 0x181812d5,
-    0x55015512, 0xed82abfe, 0x86000121, 0x25068216, 0x552b1218, 0x29822b01,
-    0x4b185620, 0x01240cdd, 0x2babfe56, 0x01231182, 0x84121855, 0x239c82bd,
-    0x0080802a, 0x830a336a, 0x0023229b, 0x48998627, 0x9a410fad, 0x23072706,
-    0x013d012e, 0x90843634, 0xd6fe9522, 0x0b575918, 0x11418020, 0x19122705,
-    0x2b2a1219, 0x1c822a01, 0x410c294d, 0x7c830d19, 0x82000221, 0x4b012000,
-    0x655b059f, 0x12d76f05, 0x2b2b0125, 0x4d6a562b, 0x55220a89, 0x578c2bab,
-    0xff20c384, 0x098f4c18, 0x22001922, 0x2124c382, 0x21352111, 0x09134d18,
-    0x2e11372f, 0x35330301, 0x27331523, 0x011e1123, 0x411c8217, 0x4941054f,
-    0x06574105, 0x552aa724, 0x2641eb2b, 0xabfe2205, 0x41798255, 0xfe260c43,
-    0x2a2ad5d6, 0xd052abfe, 0x82032005, 0x09ff54ba, 0x71871920, 0x2309af44,
-    0x26341135, 0x01257185, 0x01d6fe95, 0x26c18a2a, 0x2b562ba7, 0x182a012b,
-    0x230c2b4a, 0x2bd6d5fe, 0x220d0345, 0x82240014, 0x088d5355, 0x20090c43,
-    0x10685515, 0x12194025, 0x8380552a, 0x12552304, 0x698a5519, 0x1812d523,
-    0x08fd422b, 0x1a892082, 0x04226b83, 0x37410000, 0x00142606, 0x00280018,
-    0x246f8231, 0x3e333523, 0x05cc7d01, 0x15331528, 0x1d062223, 0x2b473301,
-    0x0d4c4105, 0x08d85018, 0x566b0122, 0x21067d42, 0x08825555, 0x18558021,
-    0x241ae250, 0x18012aab, 0x83248212, 0x2b5521fa, 0x420f5f41, 0x2b2105cc,
-    0x085f4400, 0x85008021, 0x25002197, 0x2108407e, 0x958e2327, 0x280d7041,
-    0x2a554001, 0x12191912, 0x82068355, 0x0d77418a, 0x842b8021, 0x2377827d,
-    0x2a561218, 0x210e8041, 0x27500000, 0x0018280a, 0x25000028, 0x48230614,
-    0xa24405a6, 0x127f410d, 0x0e0e1225, 0x82131812, 0x552a2475, 0x41181355,
-    0x13280881, 0x0ee01918, 0x200e1212, 0x410a9244, 0x83410e85, 0x00182609,
-    0x00250021, 0x25778235, 0x27012e35, 0x84413632, 0x24f28309, 0x36323315,
-    0x07ba4225, 0xdd422520, 0x6b012912, 0x0d0d1201, 0x18010112, 0x2b27fd82,
-    0x1255552b, 0x18d6fe18, 0x20085b52, 0x10954180, 0x8220ab21, 0x269a842c,
-    0x2a2b2b2a, 0x42bc192b, 0xf54205d9, 0x41002010, 0x18240b8f, 0x2c001c00,
-    0x3422a183, 0x31792326, 0x85232006, 0x8215209d, 0x013e2107, 0x25145549,
-    0x0e0e1240, 0x95821912, 0x822a2a21, 0x55192195, 0x200e0d43, 0x05a44580,
-    0x20092241, 0x0f994143, 0x6b430220, 0x00092208, 0x267d8219, 0x35233523,
-    0x73331533, 0x01231188, 0x82552b40, 0x087f41cb, 0x19191227, 0x56805655,
-    0x1c2f4456, 0x26001d22, 0x821a2f44, 0x3315216b, 0x44087841, 0x92271233,
-    0x2a2b2b2b, 0x4400ff55, 0x55231b36, 0x41808055, 0xdb42055e, 0x0003240a,
-    0x441d0013, 0x79841a37, 0x82103b44, 0x822a206e, 0x0e2241e4, 0xd6d5fe26,
-    0x00805656, 0x200cc342, 0x06895211, 0x42066a4b, 0x3c4407c3, 0x07324311,
-    0x41805521, 0x01210b38, 0x082d4300, 0x3f418020, 0x00112118, 0x2806694b,
-    0x012e3525, 0x3335012b, 0x060e4235, 0x2521ac42, 0x562b1218, 0xa6425580,
-    0x132a2521, 0x802a2b18, 0x451ca042, 0x1124098b, 0x25001500, 0x8b059f42,
-    0x1798428d, 0x2a121922, 0x9442f482, 0x122b2914, 0x802b2b18, 0x18012b2b,
-    0x41108e42, 0x13270ac3, 0x27002300, 0x82010000, 0x072944f5, 0x20051f47,
-    0x10247637, 0x35330323, 0x079e4423, 0x4506a344, 0x1923098d, 0x412a2abc,
-    0x41480870, 0x0c744106, 0x2b00ff25, 0x45050000, 0x032408af, 0x1b001700,
-    0x34201282, 0x3321eb82, 0x187d8315, 0x27088043, 0x06222335, 0x1614011d,
-    0x221db445, 0x452b2b15, 0x2b2606b5, 0x18125656, 0x1f44bd18, 0x18fe2010,
-    0x2c089856, 0x192b2ad5, 0x18132a12, 0x12182a2b, 0x45068280, 0x042018b7,
-    0x8708a743, 0x3700219f, 0x3e259d84, 0x34013d01, 0x05914126, 0x4d065a49,
-    0xeb25127e, 0x122a2a2a, 0x06c54619, 0x44bc1921, 0xab200e26, 0x2008c149,
-    0x0520412b, 0x450f4147, 0x0f220bbf, 0xd5491600, 0x37132611, 0x33152335,
-    0x0cc84907, 0x55805523, 0x0dc04955, 0x82d5fe21, 0x58ab2069, 0xeb2d06df,
-    0x0600ab01, 0x1a000a00, 0x00002300, 0x413f8525, 0x56201e58, 0xd5205182,
-    0x241a4d41, 0x2a2aab80, 0x23fb46ab, 0x00227785, 0xb584013f, 0x20135945,
-    0x20bd83eb, 0x0e2741d5, 0xbe835520, 0x4111dc46, 0x0f26099b, 0x31002d00,
-    0x1f413500, 0x41332012, 0xd94505a7, 0x05aa4108, 0x4f423320, 0x33372105,
-    0x41052d51, 0x2a220c3e, 0xdc451912, 0x20088905, 0x0f114b2a, 0x4bd5fe21,
-    0xa54b0888, 0x07ef4505, 0x802b5523, 0x0647592b, 0xab01eb2e, 0x07000300,
-    0x29002500, 0x42003900, 0x2005d542, 0x0ad94235, 0x85080f47, 0x4233208c,
-    0x98480b45, 0x2b152117, 0x73830083, 0x20071847, 0x05334c2b, 0x241eed42,
-    0x19802b80, 0x081d4712, 0x82121821, 0x120123af, 0xf942200d, 0x0000211b,
-    0x5f056352, 0xc787050f, 0x33410020, 0x41152007, 0xda411c59, 0x832a2014,
-    0x0f5d4100, 0x82111343, 0x165d41ab, 0x44111e43, 0x0f230ab7, 0x74001300,
-    0x6e180555, 0x33260b34, 0x33352317, 0x5b412335, 0x013b2105, 0x2305d247,
-    0x2634013d, 0x200bf341, 0x0ca543aa, 0x430d3b43, 0xb34410a3, 0x84012016,
-    0x05ca4167, 0xe5411720, 0x4813200a, 0x684a12d7, 0x2b402209, 0x06e04c2b,
-    0x2005ee4d, 0x1a65436e, 0x2b000123, 0x05ec492a, 0x192b2a28, 0x18128012,
-    0xb64400ff, 0x0c034d18, 0x21055745, 0x09412500, 0x13ab4116, 0x41150121,
-    0x6e200c12, 0x200e9043, 0x0fb844d5, 0xbc47ff20, 0x0cb7770e, 0x2f001b28,
-    0x00003300, 0x6f181101, 0x332409cb, 0x07163221, 0x0a8b7218, 0xa1412720,
-    0x33072512, 0xc0012315, 0x0cc56618, 0x822b2a21, 0xc02a2100, 0x230a5245,
-    0x012a2a3c, 0x220be247, 0x822b2b92, 0x4b802024, 0xa5840593, 0x18128024,
-    0x67462b2a, 0x051f4f0a, 0x40003722, 0x818a9182, 0xa7411520, 0x35072912,
-    0x35171533, 0x012b012e, 0x210bd741, 0x6f4d013e, 0x216d830a, 0xb5412b2a,
-    0x15e72210, 0x2a82822b, 0x19191215, 0x40401512, 0x4aea1812, 0x002008b5,
-    0x2a21c183, 0x0fb94180, 0x1515aa26, 0x18135540, 0x12222e82, 0x3c830118,
-    0x5c49a720, 0x0cef5006, 0x0021bb87, 0x4cb99025, 0xb9850d34, 0x83263421,
-    0x150723b9, 0xf942011e, 0x36322305, 0x42419501, 0x0ecf4105, 0x7985ae82,
-    0xaf82b483, 0x41d51921, 0xd04d0646, 0x16ab2e0d, 0x12564016, 0x16121818,
-    0x2a161812, 0x089a8218, 0x0007002c, 0x01eaff00, 0x008001d6, 0x00180009,
-    0x0020001c, 0x00280024, 0x2500002c, 0x2307010e, 0x3527012e, 0x32330121,
-    0x23011d16, 0x2b5c2315, 0x15172805, 0x35173533, 0x82071523, 0x82332007,
-    0x30078303, 0x3001d501, 0x30255524, 0xfe000101, 0x1812d680, 0x2a6584aa,
-    0x5680ab2b, 0xd6802b2b, 0x8224402b, 0x24303019, 0x1915012b, 0x186ac012,
-    0x12000112, 0x832b4019, 0x22cd8400, 0x182a2a56, 0x20085f4e, 0x30918380,
-    0x15072301, 0x35373317, 0x70a05001, 0x0170a070, 0x21048280, 0x0b4da070,
-    0x0007250a, 0x1300000f, 0x27292485, 0x15173307, 0x35272307, 0x262b83b0,
-    0x577c8e70, 0x86577c57, 0x2b702132, 0x57230b82, 0x5800007c, 0x8522068f,
-    0xdd829601, 0x3d003122, 0x2e33df82, 0x010e0701, 0x26272622, 0x16060706,
-    0x17011e17, 0x54140607, 0x172e05de, 0x013f3216, 0x012f3436, 0x3e37013e,
-    0x44562701, 0x5a172007, 0x013d0a81, 0x1118047c, 0x34043419, 0x04181119,
-    0x12150f08, 0x0851102a, 0x14070308, 0x08403f08, 0x34088213, 0x29105107,
-    0x840f1512, 0x2e1e1e17, 0x2e171e1e, 0x3d01013d, 0x3105842e, 0x0c070ab0,
-    0x11080811, 0x0f0a070c, 0x0a0b0d15, 0x30855101, 0x073f3f24, 0x0a820307,
-    0x0a01512a, 0xbe150d0b, 0x1e2d1e01, 0xa1220282, 0x36853c02, 0x3c2e2e22,
-    0x0024c682, 0xff000001, 0x29059771, 0x3f00000a, 0x11373501, 0x03821727,
-    0x55400735, 0x80e0e096, 0x1b40ea81, 0xcbfe2ad0, 0x011a501b, 0x42502070,
-    0x022b077b, 0x00400100, 0x0032000a, 0x82440038, 0x2feb82f9, 0x26220614,
-    0x25013e35, 0x14163233, 0x15230706, 0x172d0782, 0x011e1737, 0x012f010e,
-    0x2b010e07, 0x07324a01, 0x2e23352e, 0x07363401, 0x07373315, 0x3637012f,
-    0x0f212e82, 0x083b8201, 0xd5013429, 0x19032503, 0x26021824, 0x0955adfe,
-    0x15090c0c, 0x06130c2b, 0x0408468a, 0x2d081009, 0x0c13064e, 0x191912c0,
-    0x82152a12, 0xc00c2a1b, 0xf1144a2c, 0x0d110625, 0x23048306, 0x173102b5,
-    0x173d1b83, 0x120c8d31, 0x0c2a010c, 0x0429510a, 0x04041011, 0x0c0a871a,
-    0x40121801, 0x2a011812, 0x301a8201, 0x2b4c4080, 0x06243c1f, 0x2507100d,
-    0x00110d06, 0x28fb8204, 0x010002bf, 0x001c00ab, 0x27c98230, 0x1300007f,
-    0x1107010e, 0x53080b72, 0x352e09b4, 0x26343523, 0x1e321501, 0x3f363202,
-    0x25823501, 0x22010e25, 0x8425022e, 0x023e2511, 0x030e3533, 0x072a0e82,
-    0x22020e22, 0x012e2726, 0xfb821527, 0x023e3222, 0x17242f82, 0x033e3316,
-    0x2782378f, 0x26222334, 0x012e012f, 0x01120df5, 0x1e010114, 0x01011e2d,
-    0x00845615, 0xfdfe1230, 0x1d0f0a0a, 0x06081c2b, 0x0806120c, 0x0c82140a,
-    0x0a40012b, 0x2b1c100a, 0x0a0a0f1d, 0x20048215, 0x230c8214, 0x101c16c0,
-    0x07251b82, 0x070d1206, 0x832d8207, 0x170e240c, 0x87050611, 0x1d2b2720,
-    0x120d0707, 0x24820706, 0x28083a86, 0x09040807, 0xab011d07, 0xff0d1201,
-    0x171a1100, 0x1a171e1e, 0x2b2a2011, 0x0b2b2a2b, 0xd6fe120d, 0x1211072b,
-    0x30070912, 0x24518205, 0x12100808, 0x25108401, 0x012b0711, 0x0f831012,
-    0x11126a2c, 0x06080707, 0x0630050d, 0x12831209, 0x03100f23, 0x221b8601,
-    0x82060912, 0x08062237, 0x28438307, 0x03030711, 0x00120909, 0x06874300,
-    0x6e019922, 0x0806d54e, 0x3435363b, 0x15062226, 0x23151714, 0x27263335,
-    0x16323634, 0x33071415, 0x447b9901, 0x44375736, 0x014b4c7b, 0x4d548a54,
-    0x342d2b4d, 0x3837304d, 0x2d344c30, 0x4354322d, 0x54434d4d, 0x434e8232,
-    0x290806b3, 0x003d01d6, 0x003a001a, 0x011e2500, 0x0f061415, 0x012e2301,
-    0x17373634, 0x37013e27, 0x36171632, 0x17011e37, 0x07010e27, 0x18851716,
-    0x33221782, 0x357b1732, 0x23720805, 0x012e0722, 0x01010e23, 0x0e1712ac,
-    0x17f4040c, 0x05182020, 0x1e280101, 0x0f092114, 0x01231a13, 0x01221af1,
-    0x19260b01, 0x02171f21, 0x141c2501, 0x1b2b0b11, 0x02043224, 0x230c0e0f,
-    0x9d2e2114, 0x0e131a03, 0x01020617, 0x01202f20, 0x271e0501, 0x09111501,
-    0x1b220101, 0x1b26041c, 0x21011116, 0x0e022130, 0x160a251c, 0x2e01011b,
-    0x13100623, 0xb8822a01, 0x82000221, 0xc0012300, 0xf77a6b01, 0x4f072006,
-    0xd84906dc, 0x17290805, 0x35233533, 0x15231521, 0x35013e33, 0x01263411,
-    0x2a405500, 0xd6fe4040, 0x12191813, 0x2a015555, 0x19125555, 0x8056eb19,
-    0x045e1880, 0xd5d52909, 0x1218012b, 0x18120001, 0x180d134f, 0x4742e747,
-    0x953b0763, 0x00020000, 0x01ebff00, 0x009601eb, 0x001a0011, 0x11070100,
-    0x3e27012e, 0x60353701, 0x40080560, 0x15133733, 0x17071716, 0x01260727,
-    0x5242402b, 0x39460102, 0x02026a54, 0x3e025d77, 0x211c2515, 0x302b0b8b,
-    0xfe209501, 0x283a07a2, 0x2b0b3625, 0x3a364f0c, 0x011f0852, 0x0e072b06,
-    0x15602011, 0x25bb8d1d, 0x00230010, 0x61823700, 0x013e352d, 0x1e373637,
-    0x07061401, 0x18132606, 0x0807b442, 0x3736324b, 0x2634013e, 0xc1012e27,
-    0x01011310, 0x261b1013, 0x2b39392b, 0x012c1b12, 0x02026c52, 0x25094e67,
-    0x221e1a41, 0x411a1e22, 0x20351354, 0x13352008, 0x50010120, 0x01015078,
-    0x0242010c, 0x6b4f526c, 0x1b171a06, 0x1b495649, 0x20cc8217, 0x28db8208,
-    0x01ab01ea, 0x001b00ab, 0x938f1824, 0x8242200a, 0x011e27e7, 0x16321517,
-    0x0782011d, 0x82056165, 0x35270890, 0x35333634, 0x2217013e, 0x33011d06,
-    0x07263435, 0x33070622, 0x3307012e, 0x27171627, 0x23371723, 0x17272617,
-    0x82072733, 0x1e23292a, 0x1b000101, 0x0c090124, 0x2108ac82, 0x49496002,
-    0x2e010260, 0x01090c27, 0x0c091b24, 0x1d090c2a, 0x11be1131, 0x221b9631,
-    0x2e568b02, 0x07869b55, 0x16852220, 0x24379282, 0x090c161b, 0x304e1617,
-    0x01016148, 0x4e304861, 0x0c091716, 0x82241b16, 0x1616363a, 0x166b0c09,
-    0xaa161414, 0x550f1221, 0x11215555, 0xab555510, 0x21118301, 0x7f470000,
-    0x22d38906, 0x183b0032, 0xa808554d, 0x850320d1, 0x223721c1, 0x31062677,
-    0x0e273417, 0x17161401, 0x17142536, 0x2634013e, 0xdca20627, 0xcc851d20,
-    0x90611d20, 0x076e2805, 0x10131310, 0x8500ff07, 0x21e2a607, 0xd78400ff,
-    0x2419aa32, 0x19241818, 0x0315162b, 0x03172117, 0x14161614, 0x15200884,
-    0x200bb753, 0xe3601806, 0x17372509, 0x21350723, 0x7206bd62, 0x14220529,
-    0x68693316, 0x562b2f07, 0x2a55552a, 0x552a01c0, 0x24362401, 0x6543d501,
-    0x2a013105, 0x95191912, 0x55565640, 0x241bd5d5, 0x00011b24, 0x4d0b694a,
-    0x05320ac3, 0x17000e00, 0x29002000, 0x00004400, 0x07171625, 0x28413627,
-    0x41232008, 0x37200731, 0x8808295e, 0x16210808, 0x15060706, 0x3217011e,
-    0x16371737, 0x37013e33, 0x012e2734, 0x22010e37, 0x12000126, 0x1d2f2f1d,
-    0x8280827d, 0x12e821e7, 0x1929eb83, 0x303024c4, 0xb1303049, 0x08068425,
-    0x141a4120, 0x48020c15, 0x5d070736, 0x3607075d, 0x150c0248, 0x6e2b1a14,
-    0x1c6b6e6e, 0x0f2f2f0f, 0x38821982, 0x85182521, 0x01352105, 0x20055461,
-    0x37078601, 0x2c5e3ba6, 0x49361c19, 0x5d5d0101, 0x36490101, 0x5e2c191c,
-    0x2c2c223b, 0x500a2b4d, 0x002505cb, 0x21272113, 0x4c431805, 0x013f330b,
-    0x32213336, 0x35330117, 0x26016d23, 0x0100ff14, 0x16410a37, 0x1d0a3305,
-    0x00010f0a, 0xe7fe0a0f, 0x55018080, 0x100b1b16, 0xbf82f6fe, 0x0a01122a,
-    0x0c240b10, 0x40ccfe0c, 0x390b9b41, 0x000a0003, 0x1300001e, 0x03172137,
-    0x33353327, 0x27373315, 0x22212326, 0xfb5c010f, 0x11352d08, 0x01126d34,
-    0x75931400, 0x414a564a, 0xff205d82, 0x1d205d82, 0x01236d82, 0x8219122a,
-    0xfe162661, 0x2b2b75f6, 0x205b8290, 0x8a6b8a24, 0x001322c3, 0x20638317,
-    0x20bf9201, 0x20d78205, 0x05714517, 0x8fb60121, 0x84d420c0, 0x838120d8,
-    0x50012176, 0x1f22c68e, 0x74827616, 0x00820020, 0x00000528, 0xe201eaff,
-    0x63829601, 0x2500212e, 0x2f002b00, 0x2e370000, 0x36013f01, 0x32230282,
-    0x8216011f, 0x0f062302, 0x71181501, 0x27080982, 0x37153706, 0x27351705,
-    0x06073505, 0x013f1527, 0x082b0727, 0x04200505, 0x0e05a706, 0x0306a905,
-    0x0804041f, 0xa90a0115, 0x27080d83, 0xca0a010a, 0x80ecfe7f, 0x6a2a0180,
-    0x86120b0b, 0x05d6860c, 0x06380810, 0x04045d03, 0x3606045e, 0x0c051008,
-    0x5e060d6a, 0x06350d82, 0x9605760d, 0x49b3478e, 0x448f4890, 0x4f05053e,
-    0x4d164d7f, 0x209f8500, 0x069f7ec0, 0xf35b1b20, 0x18252005, 0x26120f72,
-    0x37170727, 0x82371723, 0x45fe1806, 0x7d28271a, 0x2a7ffe2a, 0x8f83417e,
-    0x71188020, 0x162612d9, 0x17471849, 0xfe18cc49, 0x69180a4b, 0x37201167,
-    0x220afd6c, 0x6c012e27, 0x681805fd, 0x072208ca, 0x11852622, 0x48463720,
-    0x36322205, 0x28108234, 0x013e3337, 0x01012e37, 0x050b6d75, 0x06854e20,
-    0x126d7820, 0x854d2005, 0x52683206, 0x6c02026c, 0x10120e52, 0x2e250e12,
-    0x6c02013c, 0x200619c0, 0x6501200d, 0x5620064c, 0xc0201685, 0x32822c82,
-    0x111b122b, 0x0101121a, 0x60492d3c, 0x22008200, 0x4c000006, 0x032106a7,
-    0x05977000, 0x1f00132d, 0x21050000, 0x35052135, 0x82371533, 0x33032803,
-    0x11052315, 0x84271121, 0x84272093, 0xd5012aa7, 0x000100ff, 0xc09556fe,
-    0x2a008255, 0x2a01abfe, 0x01241b95, 0x82043804, 0x24012302, 0x00822a15,
-    0xabab5533, 0xc0804001, 0xc0fe4001, 0x1b240149, 0x03034c24, 0x8206824c,
-    0x05234173, 0x8001eb22, 0x2b2b6982, 0x3d003400, 0x00005b00, 0x18171601,
-    0x2108af76, 0x64821516, 0x27012e24, 0x64473734, 0x16322305, 0xc9673617,
-    0x012e2f09, 0x010e1617, 0x013e012e, 0x013e0716, 0x0b83011e, 0x17321725,
-    0x82161407, 0x32362aa0, 0x22061417, 0x26220627, 0x340a8235, 0x3632011e,
-    0x01362735, 0x0b2d3800, 0x2a20121e, 0x161a0101, 0x05074106, 0x1a160631,
-    0x202a0101, 0x2d0b1e12, 0x01544038, 0x84405401, 0x19220805, 0x1c1e0d06,
-    0x1c1f0c0c, 0x1f1c06ac, 0x1e1c0c0c, 0x0c145f0d, 0x090d0915, 0x01130101,
-    0x0b0b2015, 0x08821520, 0x10820120, 0x010c1527, 0x0d1c0180, 0x24448210,
-    0x17092518, 0x058e4118, 0x09171824, 0x68821825, 0x1c0d1023, 0x8253872a,
-    0x70290859, 0x17082216, 0x1809222c, 0x09181616, 0x08172c22, 0x160a3922,
-    0x09010907, 0x100a0a06, 0x150b0b15, 0x060a0a10, 0x16060909, 0x082b4a0a,
-    0x9f69b520, 0x14372605, 0x11012b06, 0x057f4733, 0x0cd5232e, 0x3ecf6b09,
-    0x51010151, 0x09154f3e, 0x02268182, 0x513d3d51, 0x61180002, 0x6b35085b,
-    0x14000400, 0x17370000, 0x05211737, 0x27012e11, 0x07010e21, 0x283d8211,
-    0xb5013e21, 0xfe604a36, 0x22b582d6, 0x5efe1218, 0x012006b7, 0xb5240782,
-    0x15806040, 0x0e2e4518, 0x6f714f83, 0x2500210a, 0x84058841, 0x77661885,
-    0xd343180b, 0x785b2413, 0x71780202, 0x00201866, 0x3308ab87, 0x006b01d6,
-    0x001f0017, 0x07220100, 0x26272206, 0x11150623, 0x37321714, 0x16173236,
-    0x11353633, 0x26150734, 0x1e350722, 0x03c90101, 0x5fc85f03, 0x0c0c0303,
-    0x2a310887, 0x5454ae54, 0x026b01ae, 0x01022323, 0x0dc6fe0d, 0x2a098501,
-    0x360d3a01, 0xe81818e8, 0x71000118, 0xab24084f, 0x07009601, 0x20086783,
-    0x27343637, 0x1f140633, 0x37342601, 0x23263536, 0x14072221, 0x07141617,
-    0x33161506, 0x34373221, 0x2138838c, 0x52913518, 0x84150121, 0x1854216e,
-    0x0c21858e, 0x22cb8b03, 0x83290018, 0x0f0622cb, 0x2f638202, 0x32011e02,
-    0x36023f36, 0x2e022f34, 0x16320701, 0x154f6783, 0x37343105, 0x0001013e,
-    0x132c532b, 0x06121206, 0x56532c13, 0x2b280a89, 0x0f294c27, 0x4e4c290f,
-    0x012b0685, 0x0308086b, 0x43844313, 0x82080313, 0x260a8800, 0x3907072b,
-    0x82073972, 0x50068400, 0x9637086b, 0x36002400, 0x48003f00, 0x5a005100,
-    0x00006300, 0x31371713, 0x8233013e, 0x0714217e, 0xff530582, 0xc294180b,
-    0x11073109, 0x32363433, 0x11331516, 0x27071723, 0x37270723, 0x1808e770,
-    0x4709958a, 0xcf4707bd, 0x20088808, 0xb79418f4, 0x182f2008, 0x36093d55,
-    0x2401042f, 0x091b101b, 0x120c969f, 0x2d6d960c, 0x40124022, 0x75022d22,
-    0x772005f5, 0x49200685, 0x09200685, 0x0123068c, 0x1810107b, 0x2107cb94,
-    0x508300ff, 0x1200012c, 0x1c0b0a19, 0x660c0e24, 0x2b8200ff, 0x00010928,
-    0x5757193e, 0x94183e19, 0xff210fe1, 0x052d7601, 0x078e4120, 0x09bf5218,
-    0x2800ab22, 0xb5760c82, 0x3e112c05, 0x17163201, 0x22061415, 0x76352726,
-    0x2e210727, 0x056d7301, 0x013e172a, 0x60013537, 0x30493001, 0x8205924e,
-    0x20012659, 0x1e2d1e01, 0x33138401, 0x32324202, 0x40010142, 0x303025f5,
-    0x170a0125, 0xe0171e1e, 0xcb269a83, 0x1e1e16cb, 0x1583e016, 0x32f6fe24,
-    0x27820242, 0xef42f520, 0x01963508, 0x00070080, 0x25000012, 0x1e333523,
-    0x27061401, 0x35331123, 0x2206e845, 0x8245451a, 0x951737ec, 0x48374055,
-    0xd5480101, 0x24180156, 0x80feaa18, 0x36490180, 0x43884936, 0x56018024,
-    0x45820300, 0x33250025, 0x82032311, 0x2b012d03, 0x55ab5555, 0x2a012b55,
-    0x2a01d6fe, 0x22088f51, 0x849601d6, 0x7b132027, 0x06190991, 0x01260bc5,
-    0x552b2b40, 0x2c6e2b2b, 0xaa6b240b, 0x6980aaaa, 0x034411e7, 0x22738306,
-    0x821f0013, 0x5835204d, 0x1320051a, 0x450a0f4c, 0x01230b99, 0x8c802b15,
-    0x185b2057, 0x830a038e, 0x01aa2263, 0x20658a2a, 0x5fa21928, 0x6100200f,
-    0x89460567, 0x01002105, 0x21058052, 0x336a1337, 0x50012a06, 0x70a07070,
-    0x2a2b9070, 0x0788522b, 0x82ebfe21, 0x62aa20b8, 0x07240ddb, 0x17000f00,
-    0x4586f98a, 0xfd521720, 0x20fd8507, 0x0ad65265, 0x6b209983, 0xa0205a83,
-    0x3607d952, 0xff000005, 0x01da01fa, 0x00080083, 0x001a0011, 0x003b0023,
-    0x46361300, 0x3621056d, 0x22078537, 0x8707013e, 0x88252011, 0x06162c11,
-    0x27260607, 0x2e27010e, 0x843e3701, 0x1e400802, 0x011e1701, 0x0c2114b2,
-    0x0c222612, 0x1213ac12, 0x1127220c, 0x13f7210c, 0x25081a2a, 0x01071a29,
-    0x1a071292, 0x1a082529, 0x1301112a, 0x20411d0e, 0x101d4021, 0x2a040213,
-    0x20291612, 0x13152a1f, 0x3d08ed82, 0x2a3a2302, 0x2a3b2206, 0x3b2a0404,
-    0x3a2a0622, 0x17076423, 0x18102d34, 0x09092d33, 0x1018332d, 0xed17342d,
-    0x0a071c10, 0x1b03031a, 0x1223090b, 0x19112017, 0x3b02023b, 0x00271319,
-    0x00820002, 0x01cd012d, 0x00170081, 0x0100001c, 0x8216020e, 0x0e3e0890,
-    0x27010f01, 0x27072737, 0x1f323637, 0x05141601, 0x23071737, 0x0806ba01,
-    0x08060801, 0x090d010c, 0x155b1e58, 0x0652501e, 0x06320612, 0x50cc80fe,
-    0x2a0150cc, 0x0a0b0a06, 0x100f0805, 0x1d820810, 0x1d831420, 0x12211c82,
-    0x421c82e0, 0xc12008a3, 0x09226782, 0x67820e00, 0x2f34362d, 0x0f222601,
-    0x15051701, 0x82273733, 0x262b835a, 0xfe502706, 0x83ec50ad, 0x8258834b,
-    0x82b3200e, 0x0abf4a0d, 0xa5860f20, 0x200f9564, 0x824c8236, 0x8407204b,
-    0xba4e184b, 0x07f92b0a, 0x08081b07, 0x2cba2c16, 0xa2582c82, 0x18133005,
-    0x2a011219, 0x08871912, 0x07071b08, 0x82622c15, 0x579e8219, 0x03260a7b,
-    0x1b001300, 0xff642000, 0x27072b16, 0x011f3637, 0x17370716, 0x945f2307,
-    0x09b67105, 0x2c15f923, 0x21568316, 0x548282d6, 0x880af964, 0x2c162273,
-    0x20908315, 0x891f8280, 0x01eb3173, 0x00160096, 0x002a001f, 0x1300002f,
-    0x15070622, 0x5b073857, 0x352d0686, 0x3207012e, 0x23011d16, 0x21013e35,
-    0x22e68222, 0x84343637, 0x28ed82ef, 0x011e1675, 0x090c0c09, 0x0804836b,
-    0x171e0121, 0x0140120e, 0x083b0112, 0x28502806, 0x07320606, 0xec50ec55,
-    0x171e9501, 0x55090c0b, 0x6d010c09, 0x0b330534, 0x12151e17, 0x0e0b0b0e,
-    0x50270612, 0x06110727, 0x82440632, 0x03002227, 0x05ef4900, 0x0a009629,
-    0x18001400, 0x89010000, 0x0705236d, 0x6f820717, 0x2737172a, 0x37170737,
-    0x07088e01, 0x07323a83, 0xaffe0632, 0x50608a1b, 0x8b1c8a60, 0x56505621,
-    0x52889501, 0x841c2a21, 0x8a1b2217, 0x411782c1, 0xb62206c3, 0x09827601,
-    0x15000c29, 0x01090000, 0x72250117, 0x342205b0, 0x134e1726, 0x8b013007,
-    0x012ac0fe, 0x1be0fe40, 0x24372424, 0x841cba24, 0x75012106, 0x20211584,
-    0x22138301, 0x85d52437, 0x06bb4206, 0xab01c024, 0x39530b00, 0x23152405,
-    0x4d352335, 0x2325053a, 0x21072737, 0x28b38215, 0x37273521, 0x2a405501,
-    0x38028240, 0x3219396b, 0x2bf1fe1f, 0x2b80012b, 0x4040952b, 0x9540402b,
-    0x2a561244, 0x240e8280, 0x01008080, 0x08008200, 0x01c00138, 0x001d0080,
-    0x011e3700, 0x17363717, 0x16323316, 0x0614011d, 0x27012e23, 0x013b3634,
-    0x14151632, 0x8d071617, 0x2f2e4718, 0x28240c0a, 0x090c0c09, 0x0c04cd9a,
-    0x09824b09, 0xda090428, 0x2f18472e, 0x14820409, 0x04220f82, 0x14829acd,
-    0x24280924, 0x5f420a0c, 0x82ab2008, 0x00202c5b, 0x00310023, 0x27222500,
-    0x82010f26, 0x36372957, 0x34352627, 0x22012b26, 0x3a05fc4e, 0x34013d36,
-    0x07172726, 0x010f1735, 0x37331537, 0x23273727, 0x17072715, 0x83ab0107,
-    0x912f204b, 0x14342163, 0x46300082, 0x2e3d0a31, 0x310a3d2e, 0x753b3b0f,
-    0x2f09040c, 0xb128a393, 0x14841414, 0x51316514, 0x51242a83, 0x3c3c0f31,
-    0x83091f4a, 0xa024209b, 0x27372597, 0x33152315, 0x6b238a99, 0x9855556b,
-    0x6b60257e, 0x0056406b, 0x01200082, 0x002e0382, 0x2b010002, 0x00002000,
-    0x15072201, 0x01820706, 0x012f2232, 0x3e373426, 0x17163201, 0x010f1416,
-    0x26272206, 0x35350182, 0x33000126, 0x1f0b012f, 0x0612061a, 0x31060635,
-    0x31809280, 0x2e098206, 0x1f1a0612, 0x012f010b, 0x0e420f00, 0x85171006,
-    0x342f2312, 0x27852f34, 0x06101725, 0x4f0f420e, 0x07240b63, 0x2d000f00,
-    0x3327e182, 0x1527012e, 0x8717011e, 0x1c894107, 0x2b40012f, 0x1b2d3d01,
-    0x022b5624, 0x553f526c, 0x16834117, 0x3d2dc02e, 0x24012b01, 0x026c521b,
-    0x8b54012b, 0x63178041, 0x1d250c9b, 0x00002600, 0x0bf64113, 0x8a8e2320,
-    0x3517232c, 0x07273723, 0x55152335, 0x50420c09, 0x0904420a, 0x754af527,
-    0x01207615, 0x0c874280, 0x47182f31, 0x0d092f2e, 0x0c092824, 0x157620ab,
-    0x82804a75, 0x82032077, 0x01003c03, 0x00ab01c0, 0x001d0007, 0x0100003b,
-    0x36343523, 0x011f1632, 0x22012e35, 0x5d150706, 0x322607f1, 0x34013d36,
-    0x8a8e0726, 0x2a0d9f42, 0x15499a01, 0x1101141f, 0x442d1e01, 0x1b410a82,
-    0x6b012d16, 0x1414100a, 0x170a0a10, 0x0a171e1e, 0x21058544, 0xd182090c,
-    0x2641f520, 0x82a5821a, 0x068f43b0, 0x09457e18, 0x00003523, 0x13934325,
-    0x43010f21, 0x032406b1, 0x37231533, 0x0a5f6618, 0x07c18b18, 0x43ab0121,
-    0x2f200eac, 0x26062043, 0x402b2b83, 0x8a408080, 0x0c752205, 0x0bbf4309,
-    0x41090d21, 0x0125076e, 0x2b2b2b0b, 0x42038615, 0x058205c2, 0x01000227,
-    0x001f0080, 0x2399822a, 0x0622012e, 0x2106d45a, 0x01823637, 0x32363526,
-    0x17161517, 0x32310182, 0x3436013f, 0x27371725, 0x35332707, 0x01331523,
-    0x0ec742fa, 0x42672e21, 0xfe2d09e3, 0x1595758b, 0x804b6080, 0x352f5c20,
-    0x06cf4235, 0x05101833, 0x0f0f420e, 0x10050e42, 0x35060618, 0x76f51206,
-    0x21248296, 0x53428020, 0x1533282f, 0x37170733, 0x42353315, 0xa0241753,
-    0x7516764b, 0x241a5342, 0x76167520, 0x4776834b, 0x03270a9b, 0x25002100,
-    0x82250000, 0x421320dc, 0x03201c39, 0x9523fc83, 0x42162b2b, 0x4925162c,
-    0x95eb2b2b, 0x181942fe, 0x950b0122, 0x0420ef82, 0x00210382, 0x05676101,
-    0x84051b42, 0x9c172079, 0x82272079, 0x20038379, 0x247d9d01, 0xd52a2a56,
-    0x18c0432b, 0x2b2b8b22, 0x2d078365, 0x80010002, 0x37001700, 0x41003b00,
-    0xfb824500, 0x16054018, 0xcc442520, 0x11ec440c, 0x23150737, 0x15013b35,
-    0x37231523, 0x01152335, 0x0c091615, 0x090c9595, 0x22068556, 0x440f0116,
-    0x66200aec, 0x290d0845, 0x2b16dd7f, 0x2b152b40, 0x40185516, 0xc7310f3b,
-    0x35061305, 0x10180606, 0x0f420d06, 0x060e420f, 0x0534420f, 0x352f062f,
-    0x6b6b6035, 0x15402b40, 0x01000015, 0x24008200, 0x5601ab01, 0x230c8200,
-    0x11331513, 0x15260182, 0x36321614, 0xff4c2337, 0x35333305, 0x802b2b55,
-    0x01243724, 0x0c120c2b, 0x55012b01, 0x3582ff2a, 0xd518c020, 0xc021075b,
-    0x0887472a, 0x0f008026, 0x00002500, 0x0793aa18, 0x22064b56, 0x82330523,
-    0x205284d9, 0x82528533, 0x233522e7, 0xced4186b, 0xfe122308, 0x5b84ebeb,
-    0x65832a20, 0x2b2a4022, 0x2d0d4c62, 0x096b2b55, 0x1b090c0c, 0x6b1b2424,
-    0xad82abab, 0x00080029, 0x01eaff00, 0x829701cc, 0x7f112009, 0x4e2406bf,
-    0x64005900, 0x69837b84, 0x33263422, 0x2c075148, 0x013e1727, 0x17163637,
-    0x1e070616, 0x073b5201, 0x2e37362a, 0x013e3701, 0x17011e17, 0x4e082479,
-    0xc55208b5, 0x83322005, 0x26272223, 0x2524830f, 0x26363736, 0x09840e37,
-    0x27013f24, 0x6453cb26, 0x535d2005, 0x432c0579, 0x0e230f0f, 0x040a4d21,
-    0x16141a1b, 0x2b053f52, 0x1b1a1416, 0x214d0a04, 0x1c0f230e, 0x2005c24e,
-    0x2606855f, 0x013d2d22, 0x835a3d01, 0x0b873704, 0x16191e1b, 0x01042b13,
-    0x2509ab25, 0x132b0401, 0x1b1e1916, 0x40180001, 0x6b2d0bbd, 0x04130d01,
-    0x131a0e08, 0x3d190f29, 0x05445222, 0x193d222b, 0x1a13290f, 0x1304080e,
-    0x07d64e0d, 0xd64e0120, 0x02310807, 0x241b1d37, 0x371d1b24, 0x020101bc,
-    0x01061113, 0x03160a08, 0x080a1603, 0x13110601, 0x00000102, 0x00000200,
-    0xcc01f4ff, 0x0d008c01, 0x00001900, 0xe75b183f, 0x22062407, 0x83342627,
-    0x372208e3, 0x34363717, 0x5a072226, 0x28662797, 0x27972525, 0x43252767,
-    0x80060c10, 0x34194c5a, 0x97cf1a44, 0x12822525, 0x282c0582, 0x2c110966,
-    0x4b5a7f15, 0x1934441a, 0x2706235f, 0x00960180, 0x2500000f, 0x2406006a,
-    0x15331507, 0x310b8233, 0xd6165501, 0x226f2b16, 0x2aabc06f, 0x2a2bab2a,
-    0x43188080, 0x575f084f, 0x000b3505, 0x13000016, 0x27070137, 0x23352315,
-    0x1f353735, 0x27231501, 0x332f0982, 0x1b2b2315, 0x7f1b6501, 0xaa2b6f22,
-    0x82d1042b, 0x50013147, 0x1b9bfe1b, 0x2a807e7e, 0x2b10102b, 0x2a2fd12a,
-    0x09478618, 0x8001c02a, 0x00000e00, 0x37233533, 0x17210183, 0x27018323,
-    0x6b95d515, 0x6b406a40, 0x95240484, 0x6b6a6b40, 0x40200282, 0x20080352,
-    0x20b384d6, 0x207f821e, 0x0d564c21, 0x35331324, 0x01832733, 0x83330721,
-    0x18552001, 0x270a3645, 0x556b2aa8, 0x55405640, 0x6b200484, 0x0d618e18,
-    0x2a96fe24, 0x00825556, 0x13415620, 0x245f8306, 0x17000044, 0x05ce4f16,
-    0x30055d42, 0x3f012e17, 0x27262201, 0x1e37013e, 0x07010e01, 0x2d1d8906,
-    0x17161415, 0x14010f16, 0x35012e27, 0x1e823634, 0x06141723, 0x202a8207,
-    0x23268207, 0x5b211ec1, 0x07084518, 0x4b013408, 0x0301023d, 0x01050119,
-    0x0d111601, 0x050d010e, 0x1d111202, 0x30010125, 0x08322e28, 0x06010208,
-    0x47161506, 0x01493845, 0x1a10313d, 0x10040f06, 0x4f090c07, 0x4535085f,
-    0x230d186a, 0x0f11690f, 0x01011c17, 0x13251b11, 0x35011710, 0x3d73822c,
-    0x0e253601, 0x0402091a, 0x0a030518, 0x4b341830, 0x36440102, 0x0e014b38,
-    0x200e330a, 0x2f44000b, 0x01c02406, 0x41460080, 0x2b220931, 0xce823e01,
-    0x88011e21, 0x1e1527e1, 0x3f161701, 0xc3893601, 0x23010e2f, 0x3e372622,
-    0x23263401, 0x16070622, 0x20f2831f, 0x06dd6217, 0x016b2108, 0x1919122a,
-    0x0d07cf12, 0x1a050e04, 0x013a300f, 0x42374602, 0x14150145, 0x01060105,
-    0x31080703, 0x24339884, 0x0212101c, 0x0d0d0d05, 0x0101160f, 0x02180302,
-    0x824b0101, 0x6f012037, 0x30080649, 0x310c1b0b, 0x48010d0a, 0x01413437,
-    0x18324901, 0x06030a2e, 0x09010516, 0x34230e19, 0x252d0102, 0x1016342b,
-    0x111a2412, 0x080e161c, 0x210e6609, 0x05084e0d, 0x28081751, 0x009601c0,
-    0x00110008, 0x0b935719, 0x20079c7b, 0x23b48237, 0x012e011b, 0x2007a878,
-    0x06307d7d, 0x623a6a28, 0x24c0c024, 0x7d5b8062, 0x12ab2f05, 0x19241818,
-    0x282d7c19, 0x5501abfe, 0x2f412d28, 0x01963007, 0x00020053, 0x37111300,
-    0x5201eaab, 0x4795d6fe, 0x13220c37, 0xff6d1600, 0x15072215, 0x10f86d37,
-    0x676bd221, 0x13240dd1, 0x55aa6b18, 0x7805d743, 0x022705f3, 0x00000e00,
-    0x18173537, 0x220b9555, 0x425580d5, 0x02250837, 0x60c06078, 0x080842d5,
-    0x4d785b21, 0x0b240af7, 0x1a001700, 0x193f4718, 0x27370322, 0x2218d455,
-    0x55808086, 0xfe2418d7, 0x006060cd, 0x0809874b, 0x02005620, 0x0a000600,
-    0x11130000, 0x11331737, 0x33113323, 0x2aab4011, 0x406b4040, 0xd6fe5501,
-    0xb1529595, 0x05af4a06, 0x5601df28, 0x0c000900, 0x2f831200, 0x38050360,
-    0x15073533, 0x27071737, 0x2b371707, 0x160196c0, 0xb64bd52a, 0x4b1e2d6a,
-    0x2d3e8288, 0x56c02beb, 0x366b5580, 0x1e2e6a04, 0x6377884c, 0x00402108,
-    0x2107c358, 0x44823700, 0x33153326, 0x15212735, 0x2b290184, 0xd5d5aaaa,
-    0x0100ffaa, 0x27038300, 0x2a2a2a6b, 0x2b2a2bab, 0x0420af82, 0x00220382,
-    0x5753d601, 0x000b2506, 0x0100000e, 0x35203182, 0x052c0382, 0x01293521,
-    0x95013715, 0x6a0196fe, 0x15290386, 0x4001ebfe, 0x2b00016a, 0x22408280,
-    0x8c004080, 0x000f257b, 0x00170013, 0x21207b84, 0x09bc9918, 0x0123838b,
-    0x82552b55, 0x22888a02, 0x822a5656, 0x858c8502, 0x01c6218b, 0x4b84c785,
-    0xae771320, 0x07172106, 0x09017018, 0xd7820520, 0xc8832b20, 0x1e43c029,
-    0x3d1e3d3d, 0x823c1e3c, 0xc0fe2202, 0x06d653c0, 0x0f841120, 0x09231585,
-    0x42002a2a, 0x37080687, 0x006501da, 0x00230010, 0x13000034, 0x1e17011e,
-    0x27010e01, 0x012e3435, 0x27111506, 0x2736013f, 0x010f0626, 0x013e3735,
-    0x0f06021e, 0x012e2702, 0x15013f36, 0x16170607, 0x65080785, 0x133617cb,
-    0x2c01242b, 0x070f0621, 0x14705245, 0x0a17090f, 0x2f0e134b, 0x0e0b2e33,
-    0xd2980c0a, 0x0c180b19, 0x0f134872, 0x23091808, 0x65013407, 0x0f060f05,
-    0x0f1d532e, 0x040f0967, 0xfefe090a, 0x08281716, 0x04010306, 0x04062a1a,
-    0x14100605, 0x36050511, 0x1118082c, 0x1a282905, 0x01020708, 0x01240c04,
-    0x4b430009, 0x00562409, 0x1800000b, 0x240b1765, 0x2a809501, 0x20028280,
-    0x200483ab, 0x0a8f4880, 0x21d38a18, 0x2a566b23, 0x18028256, 0x830c9f4a,
-    0x18562010, 0x2218a34a, 0x8d17000b, 0xfe58187d, 0x184f860c, 0x840caf4a,
-    0xb34a184f, 0x8204200e, 0x21a882cf, 0xcb828001, 0x2400182a, 0x00003000,
-    0x23152301, 0x33063047, 0x36340523, 0x010e3537, 0x35171614, 0x0e25012e,
-    0x011e0701, 0x21050a67, 0x7f182e03, 0x012309e4, 0x63402a55, 0x2f2f0502,
-    0x46463926, 0x012f2639, 0x026d5115, 0x85516d02, 0x553f2505, 0x3f550101,
-    0x01210584, 0x2e288315, 0x472d152a, 0x60152e13, 0x2e156080, 0x88ed4713,
-    0x6d512328, 0x2987adfe, 0x00202f82, 0x4b180082, 0x23200d53, 0x20191344,
-    0xc55d1807, 0x785b221e, 0xc55d1802, 0x7802221c, 0xc55d185b, 0x00002309,
-    0x78180002, 0x0b220753, 0x75823300, 0x2207557b, 0x18353315, 0x84296b4b,
-    0x185620eb, 0x241a6f4b, 0x402b4040, 0x734b1840, 0x00002f23, 0x56019601,
-    0x11000b00, 0x15130000, 0xec821533, 0x33339182, 0x11013f35, 0xd5073523,
-    0x562a5656, 0x2a608a56, 0x43150136, 0x292605bd, 0xe2ebfe17, 0xfb59000b,
-    0x007f2409, 0x822f001e, 0x066d5b45, 0x011d0627, 0x1f011e17, 0x060f4e01,
-    0x3e013f2e, 0x35013f01, 0x06010f34, 0x2e012f22, 0x62080d82, 0x3637011f,
-    0x01141632, 0x0c1404d3, 0x130ca2fe, 0x05010205, 0x2603232b, 0x1329162d,
-    0x03252b07, 0x01052b23, 0x1708655c, 0x01096409, 0x50091712, 0x11170a50,
-    0x0d0c6501, 0x0b0d0101, 0x1a810707, 0x021b4a2b, 0x0304091c, 0x021b0902,
-    0x1a2b4a1b, 0x607f0681, 0x09600808, 0x09011217, 0x12084d4d, 0x18000017,
-    0x260a0f53, 0x0018000b, 0x182e0025, 0x2f0ef959, 0x3307010e, 0x1632013e,
-    0x012e3317, 0x37013e03, 0x08615018, 0x2108f359, 0x4e460001, 0x435b2d0a,
-    0x0856095d, 0x082d3c2d, 0x435d0956, 0xd7620c8c, 0x95012105, 0x2a0cd657,
-    0x231d4153, 0x53411d23, 0x8702acfe, 0x18d4200a, 0x21087f44, 0x00820002,
-    0x01ab0128, 0x000f0080, 0x98180013, 0x1123112d, 0x5c801121, 0x12220e8f,
-    0x314c0001, 0xff2b230d, 0xc3420100, 0x58c02009, 0x0b2506ef, 0x11170000,
-    0x32018533, 0x40153335, 0x40564055, 0x2a011555, 0xaa01d6fe, 0x58aa56fe,
-    0x3b441027, 0x33352106, 0x0db35418, 0x200a2463, 0xb554186b, 0x0b1e6307,
-    0x56565525, 0x7e96d6d6, 0x01230891, 0x8318132a, 0x0890848b, 0x01f60121,
-    0x000d006b, 0x03230100, 0x07233727, 0x17133317, 0x01373307, 0x37a95595,
-    0x60605560, 0x8238a855, 0x6b012906, 0xab63f2fe, 0x0e01abab, 0x00270582,
-    0xff000003, 0x82d601e9, 0x002224c3, 0x8232002a, 0x062329c3, 0x34032726,
-    0x15163236, 0x3e240484, 0x17163201, 0x032b0e89, 0x0327010e, 0x0622012e,
-    0x85330307, 0x33132f07, 0x0f013095, 0x24182604, 0x18241919, 0x03841801,
-    0x263d0a83, 0x1e010f04, 0x171b1505, 0x8e3d0506, 0x151b1706, 0x153d1a05,
-    0x01140901, 0x12120e6e, 0x34038f0e, 0x091492fe, 0x096c0101, 0xfe080b0b,
-    0x084301bd, 0xfe090b0b, 0x07e742be, 0x8001d32c, 0x1f001b00, 0x37330000,
-    0x03853723, 0xd9823320, 0x75180382, 0x13200a37, 0x73251182, 0x55085610,
-    0x25038217, 0x800f2b0f, 0x0d8c2b0f, 0x80162d28, 0x802b5516, 0x0082552b,
-    0x01250685, 0x00808000, 0x06a34600, 0x2805a77d, 0x002f002b, 0x36341300,
-    0x0bac4b33, 0x6e847282, 0x23237c86, 0x82372307, 0x33072103, 0x37207c83,
-    0x40200582, 0x7f05ea49, 0x553105e8, 0x0856072b, 0x082b072b, 0x072b0f2b,
-    0x082a072a, 0x82038255, 0x2a0f2909, 0x55412b08, 0x5501550f, 0x2609d157,
-    0x2b2b2b15, 0x822a562a, 0x21068305, 0xef875680, 0x8001ab29, 0x1d001900,
-    0x4e010000, 0x09460c54, 0x2327340b, 0x61013315, 0x01221c1f, 0x49363649,
-    0x1e1b2201, 0x5a012722, 0x012a05d2, 0x2a2a6e27, 0x111f4c01, 0x19822339,
-    0x23261f82, 0x181f1139, 0x0e5b2c48, 0x482c2e05, 0x0000d54c, 0xff000005,
-    0x01ab01c0, 0x21fd8296, 0xe150001d, 0x33052406, 0x9c132335, 0x82032071,
-    0x82072021, 0x40012403, 0x99212b2b, 0x2a2a297c, 0x2b2b562a, 0x76012b40,
-    0x482b8484, 0x36480202, 0x1e123923, 0x672c4917, 0x2c25054c, 0xffd54b49,
-    0x20f78200, 0x82008200, 0x20e9828b, 0x080749c0, 0x17001125, 0x86250000,
-    0x82172069, 0x33272707, 0x35211517, 0x04820737, 0x79832720, 0x2b2bab3e,
-    0x2f2a2a56, 0xd6fe5188, 0x80016b40, 0x5555806b, 0x2b552a55, 0x7b858551,
-    0x6ac0c06a, 0x43605282, 0x00ab2708, 0x00190015, 0x70441300, 0x23152206,
-    0x9c581915, 0x23352208, 0x3e508233, 0x1801aa2b, 0xaa011824, 0x2b267b15,
-    0x2b253625, 0x40157b26, 0x80012a01, 0x12181812, 0x8280ea2b, 0xc0ea2200,
-    0xf34318c0, 0x204f8509, 0x2f519b29, 0x26230607, 0x37363527, 0x1e011f32,
-    0x07061401, 0x982d6195, 0x01090503, 0x03050901, 0x0808051e, 0x2d6f8e05,
-    0x0a010392, 0x04010a55, 0x0a0b051d, 0xcf83050a, 0x04830420, 0x01d60132,
-    0x00030080, 0x0010000c, 0x0100001e, 0x17211521, 0x2107c263, 0xa67a2307,
-    0x011d2105, 0x332ad483, 0x01263435, 0x0100ff80, 0x18501500, 0xaa493005,
-    0xd6fe40aa, 0x0155241c, 0x01245500, 0x5e6b5580, 0x952e05af, 0x1c24806a,
-    0x80555580, 0x0000241c, 0x9f590600, 0x00082d08, 0x002a0016, 0x0032002e,
-    0x01000036, 0x089d6018, 0x2705255a, 0x35231521, 0x01333634, 0x2916d864,
-    0x27351707, 0x15073517, 0x7a859501, 0x75820920, 0x7582ff20, 0x15011c2b,
-    0x05690a01, 0x0a69050e, 0x2a088801, 0x3f3f3f80, 0xaa404094, 0x85400140,
-    0x82552091, 0x5656218f, 0xfe3e8f82, 0x39060da6, 0x06390404, 0x060c700d,
-    0x34040434, 0x1c1c0c06, 0x23642222, 0x3f3f2240, 0xae824022, 0x9d82af83,
-    0x6b01d622, 0x22081341, 0x82260022, 0x209f8211, 0x27b38717, 0x15233507,
-    0x17011e37, 0x23065947, 0x25373634, 0x03821e83, 0xab2b0123, 0x34a185c0,
-    0x1bab8022, 0xd5400124, 0x011c2440, 0x2a2a2a6a, 0x56566b01, 0x2a8e85c0,
-    0xd5555580, 0x6b1b2401, 0x826b5555, 0x6b2b2522, 0x2a2a966b, 0x3206f360,
-    0x009601c0, 0x001d0013, 0x00320025, 0x0043003a, 0x6500004c, 0x052413eb,
-    0x33353315, 0x23218d83, 0x057a5f07, 0x83372321, 0x33172611, 0x34353627,
-    0x5a148926, 0xb61807aa, 0x01210855, 0x089766c0, 0xfe290888, 0x12101aab,
-    0x10121919, 0x2bb9820b, 0x101b4009, 0x11111c0e, 0x0a101218, 0x762d0e83,
-    0x2d1e1e17, 0x0c161e1e, 0x10191111, 0x11316610, 0x2b802028, 0x40192418,
-    0xda82012b, 0x2b804027, 0x160c332b, 0x230e8712, 0x24362401, 0x1a230282,
-    0x82152015, 0x00002102, 0x08085b41, 0x28004023, 0x35003100, 0x42003e00,
-    0x00004600, 0x23072201, 0x011d010e, 0x33171614, 0x3b161415, 0x3d363201,
-    0x5c098a01, 0x27220552, 0xf6522623, 0x33072408, 0x53252315, 0x0520072c,
-    0x15200c82, 0x012f0382, 0xbd1e2555, 0x12181812, 0x2b090c16, 0x84800c09,
-    0x83162005, 0x1f122d10, 0x2a2a2025, 0xe12b2b3f, 0x00015656, 0x2205ee4e,
-    0x8256eefe, 0x40012a00, 0x12180115, 0x01181280, 0x20ed8315, 0x87058515,
-    0x01202112, 0x3f243483, 0x15151f2a, 0x23052a4f, 0x1615152b, 0x012dc782,
-    0xe6ff0000, 0x9601c001, 0x00001f00, 0x08327413, 0x56153321, 0x172605a0,
-    0x33352737, 0xb6853335, 0x83552321, 0x80162a58, 0x2a3c1e5a, 0x805a1e3c,
-    0x230e8316, 0x090c9501, 0x01226a82, 0x168237c0, 0x82373721, 0xc0372217,
-    0x20128401, 0x05734700, 0x5a01c02c, 0x00000d00, 0x17373337, 0xdb821737,
-    0x2707273c, 0x3c402307, 0x47441a5b, 0x65325544, 0xab552a15, 0x4757bfaf,
-    0x9f82322b, 0xb351004f, 0x01eb2d06, 0x002f00ab, 0x35232500, 0x012b2634,
-    0x98830482, 0x04832320, 0x011e3337, 0x23070614, 0x3b161415, 0x013e3501,
-    0x15171632, 0x3d363233, 0x31048201, 0xb5012634, 0x56121820, 0x561e2e1e,
-    0x18201812, 0x04822121, 0x01511227, 0x01203220, 0x23108251, 0xd51e1e17,
-    0x07821883, 0x27821720, 0x29861889, 0x00223883, 0x0082000b, 0x01c00127,
-    0x00030080, 0x22b78207, 0x79290025, 0x392406a7, 0x41003d00, 0xdd58c783,
-    0x23352409, 0x19153337, 0x2308cbe5, 0x23352315, 0x0f820382, 0x17233522,
-    0x03200a82, 0x3720ec82, 0x25201e82, 0x07200786, 0x402b0786, 0x2aab2b2b,
-    0x2a552b2a, 0x462b802b, 0x552107da, 0x820f842b, 0xabfe2210, 0x20058280,
-    0x27048355, 0x55aa2ad5, 0x2a2b552b, 0x06820082, 0x03832b20, 0x55558026,
-    0x55805501, 0x04833e82, 0x0483d520, 0x0f00002a, 0xc0ff0000, 0xc0010002,
-    0x1f2cb384, 0x27002300, 0x2f002b00, 0x37003300, 0x4a29b384, 0x5c005300,
-    0x00006500, 0x20818213, 0x82a28225, 0x06b97f94, 0x4b231521, 0x16820754,
-    0xad833320, 0x33350524, 0xd4840315, 0x05353322, 0x27200782, 0x8406cd59,
-    0x272321eb, 0x34252682, 0x15013b36, 0x05eb4425, 0x01352322, 0x22234083,
-    0x83013d26, 0x06142438, 0x8235012b, 0x560122bb, 0x20b48380, 0x2500832b,
-    0x2a402a40, 0xaa82fe2b, 0x2baa2b29, 0x562b00ff, 0x826b2b2b, 0x23d582fa,
-    0x12192bc0, 0x122bcd82, 0xfe552b19, 0x125555ab, 0x84d50119, 0x806b2111,
-    0xeb200082, 0x4020f685, 0x56234182, 0x82404015, 0x84012013, 0x2bd52a4d,
-    0x2a2a6a2b, 0x55952b55, 0x203283aa, 0x2431832b, 0x80fe2b55, 0x84088455,
-    0x09002e12, 0xd5ff0000, 0xab01eb01, 0x41003800, 0x26fd8500, 0x007c006c,
-    0x189a008c, 0x2209c168, 0x52352637, 0x0727055c, 0x15072722, 0x65333617,
-    0x27390546, 0x23273734, 0x0e151607, 0x34262201, 0x17323736, 0x06273537,
-    0x34012e23, 0xa0691836, 0x44032008, 0x1320078a, 0x11880887, 0x3617053b,
-    0x011d1632, 0x06270717, 0x3727012e, 0x27373527, 0x3717023e, 0x14150717,
-    0x23668206, 0x1e361725, 0x1e831c82, 0x3d262228, 0x37112701, 0x61823634,
-    0x0e071736, 0x75072702, 0x0e013629, 0x0e026e02, 0x36523601, 0x171d2936,
-    0x1d220082, 0x0c823629, 0x29271694, 0x2d1e1e16, 0x85171e1e, 0x44ff2006,
-    0x068506db, 0x19b2fe28, 0x18090c04, 0x05821806, 0x19010128, 0x09010119,
-    0x0e82040c, 0x19220582, 0x15861601, 0x23840620, 0x13831820, 0x84180621,
-    0xab012220, 0x22778301, 0x87170202, 0x44172177, 0x8e86f582, 0x2a201692,
-    0x2106b075, 0x0886ecfe, 0x8f160121, 0x0e1a3511, 0x02070903, 0x040e0a0e,
-    0x02060901, 0x020ef60e, 0x04010906, 0x02250f82, 0x0e030907, 0x20168635,
-    0x2225850b, 0x8310cafe, 0x100b2115, 0xb35f2384, 0x6b220808, 0x17000300,
-    0x33002300, 0x33250000, 0x14172335, 0x15012b06, 0x22233523, 0x3e352726,
-    0x32013b01, 0x97791516, 0x33352705, 0x33353315, 0x55182137, 0x342b0b4e,
-    0x2b350126, 0x090c4b2b, 0x61102010, 0x40260581, 0x20950c09, 0x0282202b,
-    0xd6feaa22, 0x33080559, 0x094b40a0, 0x0c20200c, 0x0c095609, 0x2b6b090c,
-    0x3535802b, 0x0fdc4e18, 0x00000024, 0x00820002, 0x01c00131, 0x00130080,
-    0x01000027, 0x0617011e, 0x83151707, 0x06272892, 0x27012e07, 0x5017013e,
-    0x323a052e, 0x34262737, 0x011f3236, 0x012e3536, 0x6c520001, 0x1d1c0102,
-    0x1e27090c, 0x4958392d, 0x3d2d3e05, 0x2d3d0101, 0x0d3d1215, 0x3d0d221a,
-    0x013d0108, 0x526c0280, 0x271e2d39, 0x1c1d0c09, 0x220b8201, 0x82536c52,
-    0x2b278221, 0x220d3d08, 0x123e0c1a, 0x003d2d15, 0x87487482, 0x4b3c2008,
-    0x71830501, 0x37217a84, 0x08aa5015, 0x2726342f, 0x06141607, 0x34272622,
-    0x06153736, 0x45bc1807, 0x8a232008, 0x97012422, 0x4b1a171e, 0x02250615,
-    0x3b2f4153, 0x052d4b01, 0x1e121432, 0x30483018, 0x151c2401, 0x24180101,
-    0x0a0c0118, 0x26099066, 0x1e570121, 0x4b243d18, 0x4326052d, 0x092b095d,
-    0x474b3144, 0x2e1b3605, 0x48181e11, 0x1e243030, 0x0c2d072d, 0x18181219,
-    0x06130c12, 0x087d4eb0, 0x5a4e2c21, 0xd623063b, 0x66009601, 0x25330509,
-    0x3f003200, 0x59004c00, 0x07130000, 0x37270717, 0x8e173727, 0x35012107,
-    0x26056e4c, 0x3523011d, 0x46371521, 0x225f05a3, 0x87332005, 0x3537230c,
-    0x0c82012e, 0x09956818, 0x3d2c1988, 0xaa263401, 0x252b1f1f, 0xa52b1e1e,
-    0xa6200786, 0x2a2c0785, 0x1218a6fe, 0x18125601, 0x2baafe2a, 0x2005ea48,
-    0x2506844c, 0x4d0c0101, 0xd5590c09, 0x26118505, 0x2f80010c, 0x8213422f,
-    0x86112003, 0x86132007, 0x56fe2a07, 0x191912aa, 0x2a2aaa12, 0xaa6818aa,
-    0x4f099d09, 0xd626091b, 0x1200ab01, 0x4a181a00, 0x372c12fb, 0x17071725,
-    0x35211521, 0x05331533, 0x18071e48, 0x2e099151, 0x09010c0f, 0xfeefa310,
-    0x2b0001aa, 0x63eafe2b, 0x012405ad, 0xff121940, 0x2d069869, 0x6e05150e,
-    0x552b4427, 0x242b2b2b, 0x02822437, 0x02287482, 0xeaff0000, 0x96016b01,
-    0x5c050b55, 0x3b3a0627, 0x37363201, 0x27012e35, 0x26343523, 0x23153317,
-    0x180c09c0, 0x18126b12, 0x06820101, 0x6b0c0c2e, 0x0c95016b, 0x1295fe09,
-    0xeb121818, 0x55241582, 0x55950c09, 0x200ab356, 0x37bd820d, 0x2500003d,
-    0x0714011e, 0x07272317, 0x34263723, 0x010e3736, 0x07171407, 0x24066059,
-    0x27070617, 0x42628336, 0x0725057a, 0x3e35012e, 0x06595901, 0x09822720,
-    0x01012e22, 0x092fb682, 0x37372d43, 0x1809432d, 0x01302412, 0x421d1306,
-    0x012f068b, 0x0106131d, 0x60492430, 0x1b1d0102, 0x422d2610, 0x2d34054d,
-    0x1d1b1026, 0xeb600201, 0x0c221801, 0xb99696b9, 0x2b18220c, 0x10242682,
-    0x3022330f, 0x31058d42, 0x0f332230, 0x57302410, 0x26496002, 0x1d2a1841,
-    0x34513458, 0x58342605, 0x41182a1d, 0x05636f26, 0x65000421, 0x85280573,
-    0x11000800, 0x21001900, 0x0621c985, 0x29c48222, 0x37272217, 0x17373216,
-    0xa3822506, 0x010e1727, 0x26343315, 0x49b68327, 0x18390578, 0x323f1218,
-    0x142e1446, 0xecfe3246, 0x303b4601, 0x1baa1b17, 0x463b3017, 0x3a948201,
-    0x24181824, 0x6b20ff18, 0x206b0b0b, 0x1a6843d5, 0x1a290b77, 0x770b291a,
-    0x4d43681a, 0x9624087b, 0x17000b00, 0x2119d953, 0x62430001, 0x85058505,
-    0x180584bb, 0x54184f6d, 0x06442c37, 0x012e2108, 0x5b206998, 0x8405a344,
-    0x20759805, 0x05a34468, 0x00200584, 0x57053f49, 0x232005b3, 0x21088548,
-    0x8818003b, 0x012d08b9, 0x25231533, 0x15163221, 0x15211523, 0x20018333,
-    0x06ce4514, 0x2605d245, 0x3634013d, 0x83352305, 0x27232419, 0x18353315,
-    0x820b9b86, 0x05e24514, 0x17201782, 0x25084782, 0x2a2aab01, 0x5601aafe,
-    0xfe401812, 0x40ea40d6, 0x2a561218, 0x12405640, 0x52011818, 0x4040d5d5,
-    0x15d52b80, 0x02871615, 0x2a2a562f, 0x6a2a1501, 0x552b1218, 0x18121640,
-    0x2c008216, 0x12d61218, 0x166bd518, 0x2b2b152a, 0xc78a1880, 0x5cab200b,
-    0x2e0809d3, 0x000001eb, 0x0100000d, 0x21070622, 0x011e2115, 0x34013e33,
-    0x16ab0126, 0xbdfe0720, 0x20074301, 0x24241b16, 0x13180001, 0x0118132a,
-    0x45243624, 0x2f82059f, 0x1601eb29, 0x00001000, 0x87351737, 0x83272034,
-    0x15352442, 0x85030156, 0x831b2035, 0xc0fd2343, 0x39854055, 0x13180123,
-    0x06334b40, 0x7385d620, 0x16321323, 0x20738217, 0x053a7a0e, 0x2e825520,
-    0xfe430123, 0x867293bd, 0x23738637, 0x21350725, 0x37203486, 0x35254283,
-    0xfe56eb01, 0x217489fd, 0x748d0301, 0x0025b38a, 0x00001700, 0x82348213,
-    0x1e3322e6, 0x05fa5c01, 0x818a2320, 0x4689dc20, 0xfc830a86, 0x0885c188,
-    0x5382fe82, 0x83010021, 0x000f23c7, 0x5d503700, 0x010e2d08, 0x23272622,
-    0x2007992b, 0x9907202a, 0xd5250686, 0x13181813, 0x2004832a, 0x08b35900,
-    0x0800562e, 0x1a001100, 0x00001e00, 0x32363425, 0x8e07c946, 0x23252c08,
-    0x2b013311, 0x19192418, 0x8c801824, 0xaa012406, 0x54c02a2a, 0x122005fe,
-    0xa722068c, 0x7f45d6fe, 0x01e03407, 0x008001eb, 0x00130005, 0x2500001b,
-    0x37270717, 0x82112717, 0x821720f4, 0x231724f5, 0x4e152327, 0x2b340598,
-    0x1ecd0101, 0x4e1e6ccb, 0x30246bcb, 0x44151901, 0x40423e2b, 0x12345382,
-    0xcb1ec940, 0x4f4f1e6d, 0x30011501, 0x0b281924, 0x956a6a74, 0x2f538882,
-    0x01eb2806, 0x000f0060, 0x551c0012, 0x78180645, 0x17290ab3, 0x23173715,
-    0x013b3426, 0x086a8232, 0x96013520, 0x0101120d, 0x6afe0d12, 0x0101110e,
-    0x277aa811, 0xe40a0ae2, 0x0108010a, 0xf50e1260, 0x0484120e, 0x468b5528,
-    0x0a1401c6, 0x3f560605, 0x01c02508, 0x00190096, 0x22059b52, 0x8a371700,
-    0x18112001, 0x24094157, 0x21052707, 0x69691835, 0x20402108, 0x01210096,
-    0x74691840, 0x8b15200b, 0xaa012125, 0x95240d8b, 0x802a802b, 0x09775e18,
-    0x21059b57, 0x7e7a2500, 0x011e2308, 0xc9589501, 0x3fc0210a, 0x22090259,
-    0x82050000, 0x010026bb, 0x005601ab, 0x24b9820b, 0x0039002b, 0x7fc3183d,
-    0x013e2508, 0x07012e37, 0x07dd5018, 0x27231722, 0x2005654d, 0x06104f15,
-    0x3d262226, 0x37363401, 0x073b0d8c, 0x01353315, 0x015b440b, 0x44445b01,
-    0x5a02025a, 0x0c092bba, 0x1919080a, 0x436b1618, 0x092305cb, 0x835e0c0c,
-    0x23078209, 0x550115a1, 0x442a2787, 0x01695b44, 0x0815090c, 0x1d82020b,
-    0x15166b2d, 0x0c151615, 0x0c094009, 0x85401601, 0x15152208, 0x08ab8215,
-    0x0000039a, 0xda01d5ff, 0x0f007f01, 0x2f001f00, 0x07250000, 0x2327010e,
-    0x15372715, 0x17372733, 0x3325011e, 0x011f1632, 0x37010f37, 0x37270727,
-    0x2703013e, 0x013f3626, 0x27011f27, 0x23153307, 0xd1012606, 0x0f1a0835,
-    0x3c35352b, 0x08275c2f, 0x6bebfe01, 0x15071910, 0x256e3825, 0x265d2f1e,
-    0x36481907, 0x16080107, 0x25396d25, 0x0f4d5f1e, 0x0e5c771b, 0x602b010e,
-    0x35522a60, 0xfa1e0d42, 0x15250d11, 0x3416025e, 0x0d433552, 0x5d9bfe11,
-    0x250c1e0e, 0x165f0115, 0x0e016b34, 0x25082743, 0x002a0083, 0x5d510033,
-    0x26342505, 0x26072227, 0x82639982, 0x22233205, 0x26270706, 0x010e010f,
-    0x0e232607, 0x17141501, 0x05c55a07, 0x25362722, 0x34054743, 0x06173634,
-    0x012e2722, 0x1617013e, 0x1e363732, 0x22270601, 0x056d4326, 0xd5015008,
-    0x0e14171e, 0x49174330, 0x19192418, 0x05140b12, 0x1a030a55, 0x0e183b20,
-    0x171e1714, 0x526c0202, 0x02026c52, 0x0bebfe17, 0x0e160e0e, 0x62209c0e,
-    0x06020320, 0x5a170408, 0x06080417, 0x0e0b1402, 0x0e0e150f, 0x011d17cb,
-    0x56041e0d, 0x82181216, 0x0c280846, 0x0b021509, 0x0f120162, 0x171d010d,
-    0x3b13101d, 0x4f01014f, 0x1610133b, 0x0e10140f, 0x12730e17, 0x06090312,
-    0x0e0e0302, 0x09284982, 0x0e15103d, 0x000e160f, 0x29089b44, 0x002b01d6,
-    0x25000010, 0xcc82012e, 0x7f170721, 0x21080545, 0x01353307, 0x2b4b1e89,
-    0x3217724b, 0x20395712, 0xc04e1737, 0x011d1ade, 0x34104554, 0x13150140,
-    0x3f82c04d, 0x2205b34b, 0x548b01ab, 0xf94606eb, 0x332b0805, 0x012e2335,
-    0x33373634, 0x27371707, 0x23011f07, 0x3be03315, 0x4e02024e, 0x294b4b3b,
-    0x79293636, 0x76761e42, 0x2b27421e, 0x822b012b, 0x281a8214, 0x5236012b,
-    0x1e420136, 0x22168275, 0x65002beb, 0x6b2208bb, 0x0c821c00, 0x56012e21,
-    0xa183097e, 0x83081e77, 0x4b7920a3, 0x3d260830, 0x0e2c0f59, 0x304b2a41,
-    0x96452308, 0x834b3901, 0x47012408, 0x4b2e2638, 0x45210883, 0x096f4c96,
-    0x00562808, 0x002e0025, 0x22062500, 0x26073527, 0x26233727, 0x27333734,
-    0x1737013e, 0x17323635, 0x17163715, 0x14163307, 0x82172307, 0x072721dc,
-    0x3305c341, 0x55012622, 0x360a160a, 0x4b350d10, 0x354b0202, 0x36081005,
-    0xea200f8f, 0x20053545, 0x2f1f8357, 0x0b35110d, 0x08350b15, 0x4b350610,
-    0x354b0101, 0x77220f8a, 0x28831812, 0x2709f752, 0x0003006b, 0x00170013,
-    0x1807c579, 0x280a8946, 0x013e2117, 0x26341135, 0x06ed6707, 0x07821720,
-    0x03823520, 0xfeab0122, 0x0dc35918, 0x2b2bbd27, 0xaa2b2b55, 0x1900822a,
-    0x2112023a, 0x00822b7f, 0x41802a21, 0xdd390867, 0x1c006b01, 0x33250000,
-    0x34332707, 0x22262726, 0x17140607, 0x1737011e, 0x230c8206, 0x32363734,
-    0x55080c82, 0x69479501, 0x1312616a, 0x25286627, 0x254e1f25, 0x2c71321f,
-    0x88353232, 0xc0191934, 0x2f196a6a, 0x28252513, 0x0c1e2766, 0x0d1d2011,
-    0x3588352a, 0x3e1a3232, 0x00040000, 0x01d5ff00, 0x00c001a6, 0x0018000c,
-    0x00310021, 0x06220100, 0x013e1707, 0x37171632, 0x0989012e, 0x56062221,
-    0x37240850, 0x15062223, 0x0aab7019, 0x3100013a, 0x1a1e2055, 0x1a465046,
-    0x9b55201e, 0x2c270f1e, 0x151e0f27, 0x55363e36, 0x25057f46, 0x0c09802e,
-    0x0483090c, 0x25c00127, 0x1d1b1e20, 0x2b28821e, 0x0e1e8125, 0x1e0e1111,
-    0xd3171714, 0x081e2519, 0x0900ff28, 0x0c01010c, 0x07820109, 0x7f590020,
-    0x8203200c, 0x001c27a1, 0x37232500, 0x70180533, 0x165b0dbb, 0xa0802d0a,
-    0x00ff752b, 0x260708a8, 0xe0a80606, 0x2c0ae24e, 0x362b2b55, 0x250707a7,
-    0x01a80808, 0x026a182b, 0x06934a0d, 0x8363c020, 0x38618206, 0x35170735,
-    0x27233521, 0x27371533, 0x33152115, 0x55d66b01, 0x2a000155, 0x290682d6,
-    0x552a00ff, 0x40555540, 0x05848080, 0x250deb5b, 0x0012000e, 0x4d660019,
-    0x062b4505, 0x3523152a, 0x27153305, 0x0717013d, 0x2b2b5182, 0x1b65011b,
-    0x5555bb40, 0x822a9090, 0x552a2450, 0x662baf55, 0x40200554, 0x90264e83,
-    0x5a653b10, 0x0a83d92b, 0x00002a28, 0xff000003, 0x978301ea, 0x0f000624,
-    0xfb821800, 0x07233527, 0x17153315, 0x24a09023, 0x202b1515, 0x25a48c76,
-    0x16158080, 0xa98c2b55, 0xac830120, 0x01ab0128, 0x001600ab, 0x43830100,
-    0x20082d75, 0x28098223, 0x2e37013e, 0x6b000101, 0x059f436b, 0x2b370582,
-    0x49496002, 0x60020260, 0x6b565501, 0x4802566b, 0x01483736, 0x84374801,
-    0x48492213, 0x089f4461, 0x5601c024, 0xf7820900, 0x32365383, 0x012e1716,
-    0x509595d5, 0x6d0f2873, 0x95550001, 0x38355795, 0x2b828553, 0x84000221,
-    0x202b8404, 0x8481860f, 0x8327202d, 0x01272237, 0x23348615, 0x559595ef,
-    0x28253889, 0x40959540, 0x08398255, 0x0003002d, 0x01fdff00, 0x009601d9,
-    0x00300024, 0x25000039, 0x37362637, 0x1617013e, 0x010e0706, 0x27060723,
-    0x0e07010e, 0x17272604, 0x82023e16, 0x34372117, 0x0b8c6418, 0x0808c352,
-    0x140f0128, 0x21151601, 0x11121444, 0x142f151f, 0x0d0e0d13, 0x07080717,
-    0x2a272012, 0x230b3511, 0x08070812, 0x2e740f1a, 0x0419013c, 0x624e08d0,
-    0xa7270805, 0x152e1513, 0x14121120, 0x16152045, 0x04080b13, 0x260f0b0e,
-    0x0c010b1c, 0x11010917, 0x0c0f261c, 0xf509050e, 0x872d3c01, 0x72292039,
-    0x3b590632, 0xc0002107, 0x072fc182, 0x0f000b00, 0x17001300, 0x23050000,
-    0x82353335, 0x8a072003, 0x82372007, 0xd501220b, 0x2100822a, 0x00822b55,
-    0x24052244, 0x2b2b2a15, 0x22038480, 0x82002b80, 0x06270800, 0xeaff0000,
-    0x6b010002, 0x29000d00, 0x33002e00, 0x3b003700, 0x15130000, 0x36343533,
-    0x011e3337, 0x3533011d, 0x48333501, 0x21200638, 0x14321083, 0x15332306,
-    0x2b061423, 0x35262201, 0x32140633, 0x04833734, 0x2c07654c, 0x12196b55,
-    0x2b19126a, 0x125555fe, 0x05185018, 0x55121823, 0x2c148480, 0x4c130935,
-    0x163f130a, 0x40016a40, 0x211e82d5, 0x1a820101, 0x18fed521, 0x840e848e,
-    0x13132336, 0x03820101, 0xab151528, 0x00009595, 0x00820002, 0x01ab0123,
-    0x38098240, 0x37000005, 0x11031117, 0xc0b6f507, 0x0180c0b6, 0x0100ff00,
-    0x00008000, 0x24cb8203, 0x019601e0, 0x2c0982ab, 0x00220012, 0x37172500,
-    0x07233727, 0x0a274f27, 0x013e1722, 0x0806404f, 0x1f16142f, 0x01170701,
-    0x441e441e, 0x4c4b0110, 0x3d01110e, 0x013d2d2d, 0x17150f11, 0x40405401,
-    0x14180154, 0x241e624b, 0x88431f44, 0x260f4b4b, 0x058a4116, 0x2e261631,
-    0x401f3714, 0x54020254, 0x14371f40, 0x441f614b, 0xff6905f7, 0x0a9b6505,
-    0x35231523, 0x25038533, 0x21112103, 0x00842aeb, 0x56019627, 0x566baafe,
-    0x230182d6, 0xaa01d6fe, 0x08085347, 0x6b01be20, 0x1a001600, 0x26010000,
-    0x23172327, 0x010e2337, 0x16060307, 0x33373317, 0x013e3317, 0x0782012f,
-    0x82013108, 0x05581104, 0x085a0534, 0x013a010c, 0x077e090d, 0x0a7b0748,
-    0x04de010d, 0x5a010438, 0x40400110, 0xfe060a01, 0x010f0ad5, 0x0f016b6b,
-    0x55557c0a, 0x31085e82, 0x00000500, 0xa601fbff, 0x10006601, 0x19001500,
-    0x26001d00, 0x023f0000, 0x1433013e, 0x27020f06, 0x35022e22, 0x23071707,
-    0x07173735, 0x07011f35, 0x23513723, 0x3c3c3a07, 0x28983836, 0x3c0b4646,
-    0x140e160f, 0x381e0f05, 0x341a1b1f, 0x1e190371, 0x052f6c98, 0x0b3c933d,
-    0x98284646, 0x4b3c3638, 0x160e1405, 0x1f391e2e, 0x1e340356, 0xf51a1a27,
-    0x82121b12, 0x0a0b4502, 0x77820e20, 0x1e010030, 0x06141701, 0x2e373607,
-    0x27152701, 0x06821137, 0x37363424, 0x16820706, 0x07173530, 0x6c520001,
-    0x241b1f02, 0x49600201, 0x0b8b5555, 0x01550131, 0x2f1b3748, 0x2f271c11,
-    0x5540013e, 0x8896fe55, 0x023d210f, 0x00210f82, 0x25e88304, 0xab01ab01,
-    0xe3820f00, 0x21001b22, 0x82089144, 0x3e15226e, 0x29708201, 0x35171603,
-    0x23012f26, 0xa7181716, 0x3f08074b, 0x61611501, 0x2f3b3b2f, 0x02025341,
-    0x2e26bf53, 0x2b34191c, 0x101e1d05, 0x061d1e11, 0x6901052b, 0x535f6142,
-    0x45614409, 0x5d092b09, 0xfe5d4343, 0x2b051dd9, 0x2e531105, 0x7c181e25,
-    0x1d2e251e, 0x830a2350, 0x00192377, 0x33190026, 0x012a1061, 0x011d1632,
-    0x012b0614, 0xe4823735, 0x86230721, 0x40552bf9, 0x12191912, 0x18181240,
-    0x04826801, 0x40c0122e, 0x01016148, 0x4802022b, 0x01565636, 0x0ce6b918,
-    0x84ebfe21, 0xeb952828, 0x15496002, 0x82493615, 0x865620ff, 0x82aa20ef,
-    0x000524ef, 0x8311000b, 0x172533ef, 0x06233736, 0x37361507, 0x26370627,
-    0x17160727, 0xc354012f, 0x2e352906, 0x37363401, 0x1f680115, 0x042dc182,
-    0x1f262e65, 0x1d057819, 0x3204121f, 0x30fb8461, 0x3b3b2f41, 0x251d752f,
-    0x2b4d1c2e, 0x111f1c06, 0x23e2838e, 0x4261751d, 0xfe82f784, 0x44614524,
-    0x6b535309, 0x000c220d, 0x2def841c, 0x35071735, 0x1707010e, 0x013e2723,
-    0x766c3337, 0x012b2b05, 0x11352622, 0x33013634, 0x35442315, 0x56d52b05,
-    0x02483656, 0x01012b02, 0xf04dde61, 0x23ff8205, 0xc0c0fcfe, 0x012dfc82,
-    0x5556406b, 0x36490140, 0x60491515, 0x0b60182c, 0x18122b09, 0x1895ebfe,
-    0x19124012, 0xef4c0000, 0x01c02305, 0xed44006b, 0x00232505, 0x3700002d,
-    0x20078a44, 0x2e648521, 0x2b353317, 0x35331501, 0x012e0725, 0x82070622,
-    0x16322590, 0x2226010f, 0x55280985, 0x0c095601, 0xaafe090c, 0x20080582,
-    0x55151574, 0x1e00012a, 0x3e473e17, 0x4d1d1e17, 0x1e1f4d59, 0x1e184918,
-    0x2e352e12, 0x090c01ab, 0x83238255, 0x2b553704, 0x1eac2b2b, 0x181a1a18,
-    0x21211d1e, 0x18181e59, 0x1414111e, 0x5b5b0000, 0x01c02306, 0x9c820096,
-    0x2723372c, 0x37353337, 0x17331517, 0x04852307, 0x1516322d, 0x33363423,
-    0x2b2b80eb, 0x83151580, 0x2e038305, 0x19801912, 0x2b2aeb12, 0x15151540,
-    0x822a2b2b, 0x1218231b, 0x97481812, 0x01a22709, 0x00080062, 0x12820010,
-    0x564c3720, 0x1e272807, 0x2e231701, 0x86152701, 0x14843607, 0x1a281a1a,
-    0xbc8d1b1a, 0x99033c03, 0x03775a74, 0x4056013d, 0x27138372, 0x03ef1a28,
-    0x99748dbc, 0x77241882, 0x0156405a, 0x6208f769, 0x1824056f, 0x28002000,
-    0x2109e96c, 0xa4412123, 0x70132005, 0x4676085e, 0x2e33220b, 0x06cb6c01,
-    0x12d6fe2c, 0x0e471919, 0x121c1212, 0xc5472e12, 0x785b2506, 0x90032b02,
-    0x200daa64, 0x06ef6fff, 0x012b6b2d, 0x60493649, 0x78022b57, 0x82906d5b,
-    0x2e878283, 0xe301ddff, 0x1b00a301, 0x013f0000, 0x18273717, 0x8d07a868,
-    0x1e012c07, 0x1e161f25, 0x3517351e, 0x82171e1e, 0x34162107, 0x1f300782,
-    0x3517341f, 0x96fe5a26, 0x161e2638, 0x16351f1e, 0x24871c86, 0x25351722,
-    0x00221c82, 0x6b670005, 0x00a02a05, 0x00260008, 0x0036002e, 0x0a4d603e,
-    0x17370336, 0x27353315, 0x33011e37, 0x2f262235, 0x23012e01, 0x07230622,
-    0x37341382, 0x27072707, 0x36342622, 0x27153337, 0x3634012e, 0x0715013b,
-    0x07820f83, 0x60012708, 0x24181812, 0x163b1818, 0x0d2d2b2c, 0x1c223c17,
-    0x06160e31, 0x07050b13, 0x262b6f05, 0x29086922, 0x090c0c09, 0x05832a40,
-    0x83956a21, 0x55280805, 0x24184b01, 0x18241919, 0x2b5ed7fe, 0x402ba080,
-    0x1b2a1b1a, 0x0c092219, 0x48642f02, 0x2b16ad0f, 0x0c120cc0, 0x01552b01,
-    0x2b210682, 0x210482aa, 0xa341002a, 0xceff2d05, 0xb201e601, 0x1c001300,
-    0x29002500, 0x1f25b982, 0x0f170701, 0x2a9b8201, 0x37012f07, 0x17013f27,
-    0x7a071737, 0x07341061, 0x01072737, 0x264b0d8e, 0x530d4c26, 0x0e523b3b,
-    0x4b26264a, 0x70200983, 0x3a0cd571, 0xb81eb890, 0x26528301, 0x52264b4b,
-    0x0e3c3b0d, 0x4a4b2653, 0x3c0e5226, 0x45014b3b, 0x952005a5, 0x40200685,
-    0x8f862782, 0xc0268182, 0x04008001, 0x5b440c00, 0x28808405, 0x013e3525,
-    0x010e3337, 0x22038227, 0x18212507, 0x310d7152, 0x4a364a6b, 0x2dd6fe60,
-    0x022b013c, 0x01403f54, 0x60181b24, 0x40390c1f, 0x80604060, 0x3c012b80,
-    0x93543f2d, 0x6b01241b, 0xd6fe1219, 0x12191912, 0x05546601, 0x56000321,
-    0xab36053b, 0x2b002300, 0x00003300, 0x27071713, 0x17071707, 0x07171636,
-    0xe882012e, 0x272b0d83, 0x27371737, 0x013f3426, 0x821f3236, 0x0e172713,
-    0x32350701, 0x8f833536, 0xf8349b83, 0x1e2d2e79, 0x10091932, 0x0d4b0d20,
-    0x190a0705, 0x2e2e1f31, 0x21081383, 0x0f0d0d3c, 0x3d0d220d, 0x01b52d1e,
-    0x18122430, 0x48610180, 0x01024836, 0x2e2e79ab, 0x0a19311f, 0x30820507,
-    0x0910202c, 0x2d1e3219, 0x2d2d792e, 0x2d823d1e, 0x0d0d0f33, 0xe82d1e3c,
-    0x2b013024, 0x61481218, 0x48022a01, 0x086f5636, 0x2500802e, 0x00003000,
-    0x06270737, 0x23153307, 0x35297d83, 0x15213527, 0x011e1507, 0x270f8217,
-    0x07272633, 0x27263727, 0x34080a82, 0x32170706, 0x23061416, 0x37012f22,
-    0x1d1eb436, 0x5529061c, 0xaa4a5f01, 0x4aaaaa01, 0x2955015f, 0x1e1d1c06,
-    0x2a30241d, 0x12692430, 0x0a121818, 0x09525209, 0x2811827f, 0x4f152b2f,
-    0x442b1072, 0x2602822b, 0x154f7210, 0x82242f2b, 0x071c2d28, 0x1c072a2a,
-    0x1824195c, 0x04272604, 0x240ad34b, 0x0019000f, 0x11dd431d, 0x010e172d,
-    0x17273307, 0x07012e33, 0x43352115, 0xa7200bd2, 0x4528d982, 0x01422c09,
-    0x2a01b930, 0x2a0d7246, 0x2530012a, 0x30253b3b, 0x48d6d67f, 0xeb29089f,
-    0x06008001, 0x00000c00, 0x05ce6001, 0x1715053e, 0x01073537, 0xc0ebeb00,
-    0x9580fe2b, 0x80019595, 0x94698080, 0x515659ab, 0x00525651, 0x042c0082,
-    0xc0ff0000, 0xc001ff01, 0x0d000900, 0x27399b82, 0x2e170000, 0x1e232701,
-    0x27371701, 0x01370117, 0x0f222603, 0x17140601, 0x30531801, 0x06c67a07,
-    0xa017073a, 0x20074335, 0x0e678d0b, 0x00ff7f51, 0xea000188, 0x880a190a,
-    0x01010909, 0x7b200785, 0x0b331e88, 0x653d5f1a, 0x51010284, 0x88000116,
-    0x170100ff, 0x82880909, 0xfffe2123, 0xf1200785, 0x8f871e87, 0xfa01d522,
-    0x07208f82, 0x3f2c8d84, 0x3e010000, 0x1d163201, 0x33072301, 0x2305045b,
-    0x012e3523, 0x2009b67e, 0x20ad8807, 0x097d4225, 0x012db28c, 0x1f140166,
-    0x6b114915, 0x090c0c09, 0x063e7a01, 0x44359722, 0x2a08bc86, 0x1e371f01,
-    0x79f27930, 0x0a341e2d, 0x0a870a1a, 0x0a00010a, 0x0988091a, 0x150f8b01,
-    0x800b0f15, 0x0956090c, 0x1e160b0c, 0x840b161e, 0x19f5210a, 0x8327cd82,
-    0x89510103, 0x852f1e36, 0x22c78537, 0x820a00ff, 0x001a213e, 0x088f6e18,
-    0x12009a24, 0xbf821600, 0x41088d82, 0x07230717, 0x37353717, 0x013e3717,
-    0x0726012f, 0x01270717, 0xb70e1080, 0x2a2b4b20, 0x204a562a, 0x0c020ab8,
-    0x2b100e2f, 0x99012a96, 0x4a20b80c, 0x2b2a2a56, 0x0fb7204b, 0x0c2f0d20,
-    0x2a952b2e, 0x7b430100, 0x00963306, 0x25000020, 0x1135013e, 0x1d062223,
-    0x34352301, 0x1e413b36, 0x11320805, 0x012b010e, 0x013d2622, 0x01161433,
-    0x9518122b, 0x24400c09, 0x241cea1c, 0x1b240155, 0xd5241cd5, 0x18011519,
-    0x0c150112, 0x1cead509, 0x151c2424, 0x0684ebfe, 0x5a05db46, 0xab200517,
-    0x2108bb6a, 0x94180019, 0x073608f5, 0x37333523, 0x1e110723, 0x32213301,
-    0x2e113736, 0x2b800101, 0x0284402b, 0x80ab8022, 0x00285483, 0x01011812,
-    0x56150118, 0x2a220083, 0x0f82ff80, 0x4105504c, 0xb320060b, 0x11225782,
-    0xb9821d00, 0x83072721, 0x5b372001, 0x17340a28, 0x27173707, 0x07372737,
-    0xb3011727, 0x3e421d56, 0x1f3e561d, 0x07034918, 0x3ae01f27, 0x03353504,
-    0x2b058439, 0x80551d23, 0x801d5580, 0x54403627, 0x362e2083, 0x401d5d27,
-    0x1d3f2324, 0x24233f1d, 0x93180040, 0x2b26086f, 0x0e000600, 0x6d821700,
-    0x21152908, 0x011e3335, 0x15331505, 0x35333533, 0x012e3625, 0x011e010e,
-    0xfed50136, 0x3024c0eb, 0xaa8057fe, 0x13c3fe80, 0x26332701, 0xd52b0382,
-    0x3001802a, 0x2b2b2a65, 0x8414292a, 0x01262110, 0xe7225387, 0x53886501,
-    0x37250727, 0x25011e17, 0x25528217, 0x37253717, 0x5485013e, 0xdb012a08,
-    0x2df8fe0f, 0xfe1d22b6, 0x60aa8b3a, 0x6d6bfe0f, 0x31171118, 0x30181131,
-    0x795f288f, 0x0b3e0d42, 0x22226032, 0x0d019228, 0x22148330, 0x18001131,
-    0x27082749, 0x0008002b, 0x37000013, 0x7007a366, 0xbb82056a, 0x95012e32,
-    0x3724241c, 0x1b012424, 0x012babaa, 0xab3001d6, 0x37280d83, 0x96968024,
-    0x302580d6, 0x2608f743, 0x008001ee, 0x8220000b, 0x23353443, 0x17011e15,
-    0x2e233533, 0x012e0501, 0x2e27010f, 0x82012b01, 0x14250814, 0x17331716,
-    0x55013e37, 0x2d3c012a, 0x241b8080, 0x18079101, 0x0648180c, 0x804a0d14,
-    0x49951c24, 0xc0080d4f, 0x06537ec0, 0x070c5529, 0x0b950b05, 0x82ab800d,
-    0x24952327, 0x5f6e1907, 0x20678309, 0x20678e1f, 0x05b56423, 0x15217985,
-    0x37c68333, 0x3c012b6b, 0x1c80802e, 0x204a0124, 0x806b1218, 0x951b2401,
-    0x12120e60, 0x65236288, 0x85191295, 0x1c12225e, 0x2bc78812, 0x008001ad,
-    0x00210015, 0x06162500, 0x3720b682, 0x2722c582, 0x52823335, 0x07151626,
-    0x25163233, 0x0126dd8a, 0x0f1202aa, 0xc9831560, 0x126b8029, 0x0c1e2a18,
-    0x83c4fe12, 0x55552875, 0x0f26241c, 0x82554017, 0x80ab2673, 0x0e951219,
-    0x20d7878e, 0x09234200, 0x00982508, 0x00140008, 0x1300002d, 0x013e012e,
-    0x010e011e, 0x26222313, 0x1723012f, 0x3317011e, 0x1e272337, 0x06353701,
-    0x2e261082, 0x0e230701, 0x22821f01, 0x013b3308, 0x0e723717, 0x1e211506,
-    0xd4221506, 0x04231996, 0x072a2a2a, 0x0596293a, 0x37191668, 0x14351b1e,
-    0x0a140723, 0x03161401, 0x1822051d, 0x01205192, 0x2b840b48, 0xfe061d3f,
-    0xca181eed, 0x013227d1, 0x100e5780, 0x10052e04, 0x06051b10, 0x14200402,
-    0x401d177e, 0x29968220, 0x00000300, 0xab01f5ff, 0x97889601, 0xd4542620,
-    0x88072006, 0x262225f4, 0x35232705, 0x1f499f82, 0x82272006, 0x15072198,
-    0x332c0f82, 0x1a0da217, 0x221a1a22, 0x3d012b2f, 0x0805dd41, 0x4a6c2a3c,
-    0x1c1f4017, 0x061e1236, 0x14010b12, 0x2401011b, 0x014b6c1b, 0x19220d4d,
-    0xd51a2219, 0x3c2ec0c0, 0x3b242b01, 0x1b134f6c, 0x13182f01, 0x01080721,
-    0x7b141b01, 0x4b01241b, 0x8b820200, 0xc001d524, 0x8b82ab01, 0x00001226,
-    0x010e3325, 0x35228482, 0x6c843537, 0x013e2208, 0x00013537, 0x3c500995,
-    0x02c09595, 0x6a54546a, 0x6843c002, 0x427abe13, 0x5b80562f, 0x8e17178e,
-    0x06e34f5b, 0x24051f76, 0x00240020, 0x2245832a, 0x50151632, 0x232e098e,
-    0x36343335, 0x2e35013b, 0x37352701, 0x61821517, 0x15070325, 0x84153133,
-    0x0f907c5d, 0x013a302e, 0x3a018080, 0x55551530, 0x40013420, 0x37096d60,
-    0x36591523, 0x55393955, 0x01155936, 0x80472408, 0x15233f09, 0x00100000,
-    0xbf820082, 0x0600802a, 0x11000d00, 0x19001500, 0x08f35a18, 0x5d053751,
-    0x1320089d, 0x352a9182, 0x32213634, 0x23011d16, 0x0a500735, 0x4e078207,
-    0x3320050f, 0x2327128b, 0x013d2622, 0x66271533, 0x25200655, 0x5535078e,
-    0x010c2b16, 0x2b0c095f, 0x2a802b55, 0x00012b80, 0x2b16090c, 0x200b8480,
-    0x2715826b, 0x012b2b2b, 0xabfe2b80, 0x1082068b, 0x0c091622, 0xc0592783,
-    0xfe2b2205, 0x832985c0, 0x823e850e, 0x2a552109, 0x24053f6d, 0x00002b2b,
-    0x50db8812, 0x132407c3, 0x1c001700, 0x3125df88, 0x3a003600, 0x059d6900,
-    0x00004b23, 0x24a38213, 0x23353307, 0x20038237, 0x20078611, 0x24078235,
-    0x35363211, 0x83088323, 0x2303241c, 0x82033315, 0x35172a14, 0x01161423,
-    0x26343315, 0x8305822b, 0x82132019, 0x82272015, 0x27298203, 0x80c00622,
-    0xd6d62b80, 0x2b20bf82, 0x9682e182, 0x82191221, 0x2aaa2204, 0x2005822a,
-    0x29038280, 0x3c01192b, 0x2a92192b, 0x1f84d52a, 0x21845520, 0x82000121,
-    0x2b2a2633, 0x2a2b80fe, 0x23fc822b, 0x801219d5, 0x01241f82, 0x00ff2b55,
-    0x12240f82, 0x2b800119, 0x552b4682, 0x2bd5fe2b, 0x2b802a80, 0x88010019,
-    0x843b20df, 0x5f3320bd, 0x33200800, 0x88071b5b, 0x057f6807, 0x86152321,
-    0x84a48207, 0x200785d2, 0x8597826b, 0x055a4102, 0x78820e8e, 0x26861794,
-    0x430d0021, 0x80200603, 0x14220982, 0x61411800, 0x05656808, 0x3f003b24,
-    0x417c4300, 0x27332109, 0x33208382, 0x42062268, 0x13200b31, 0x42075042,
-    0x37201539, 0x152c3682, 0x1b8f011c, 0xe5102b3a, 0x5b01102b, 0x23083c42,
-    0x2b802a2b, 0x2e103442, 0x65012b2b, 0x1c71fe1b, 0xe52b103b, 0x42552b10,
-    0xab200b36, 0x21143042, 0x7f640000, 0x0008240a, 0x691a0011, 0x002a0a2b,
-    0x3b363413, 0x15231501, 0x86822523, 0x33352325, 0x82031632, 0x061425ae,
-    0x2135012b, 0x33250882, 0x26222315, 0x20058213, 0x20038211, 0x20038213,
-    0x2e038225, 0x4012182b, 0xaa012a40, 0x1240402a, 0x822a2a18, 0xc0fe210d,
-    0xaa210b84, 0x28008256, 0xfe2a2ad6, 0x012a2a80, 0x201b826b, 0x23008240,
-    0x98fe182a, 0x33822884, 0x92011828, 0x2aaafe2a, 0x27820001, 0xe7419782,
-    0x058f5e05, 0x2d330034, 0x010d1501, 0xfec0012b, 0xfe400140, 0x95c0c0c0,
-    0x23822b2b, 0x2305d768, 0x00ab01c0, 0x43058f5c, 0x00210bbb, 0x0f575013,
-    0xc4512120, 0x21232105, 0x86066750, 0x51be180f, 0x33132407, 0x86152335,
-    0x82032003, 0x86072008, 0x0b715003, 0x7d500920, 0x210b8b0a, 0x00841574,
-    0x832a5521, 0x50012000, 0xaa250b7b, 0x0956090c, 0x2104840c, 0x48180cab,
-    0x01230af2, 0x42d52b00, 0x2b2405e8, 0xaa2a2aab, 0x0021ce84, 0x21d38204,
-    0x1f510100, 0x001b2109, 0x1d51c591, 0x33172306, 0x0b512315, 0xaa162410,
-    0x506b01aa, 0xd5210ef8, 0x0ba76f2b, 0x37002723, 0x059b4200, 0x71454720,
-    0x41232018, 0x9751051f, 0x012b2207, 0x0e294103, 0x25411720, 0x41272006,
-    0x01200621, 0x200f8e45, 0x41f18396, 0x9621052a, 0x0db051c0, 0x55151525,
-    0x452a2a2a, 0x2b200aa1, 0x200c1541, 0x250d8b2a, 0x2bd62b55, 0x02832bab,
-    0xa7420020, 0x01d52a05, 0x009601d6, 0x00090006, 0x26c5822d, 0x00490045,
-    0x8751004d, 0x172726c7, 0x07172715, 0x07ce5627, 0x87073f46, 0x273329cd,
-    0x3d012e23, 0x013f2701, 0x2325cd87, 0x27233527, 0x05075705, 0x2f012b23,
-    0x21d58501, 0xd582012f, 0x1031d184, 0x0419c03b, 0x0c3a2b1b, 0x0c095609,
-    0x090c9595, 0x27d78416, 0x09102b3b, 0x241c2b0c, 0xda25d785, 0x012a193c,
-    0x23ef8359, 0x153c802f, 0x55200082, 0x3a26dc83, 0x3a1a1a3a, 0x16832b1c,
-    0xe2860482, 0x0c012a27, 0x1b2b0f09, 0x23e28515, 0xaa2a1a3c, 0x2005aa41,
-    0x24e78280, 0x2b061510, 0x22d7822b, 0x82c0ff00, 0x00ab26e3, 0x002b0010,
-    0x28e38235, 0x0042003f, 0x004a0046, 0x0909424e, 0x27012b22, 0x2725a983,
-    0x27070136, 0x24d28321, 0x013b3634, 0x82e68627, 0x2f262409, 0x42053701,
-    0x2a8205ea, 0x09831720, 0x84032721, 0x822720db, 0x412320d9, 0x3c4207b4,
-    0x2bef3206, 0x07272a04, 0x151b8a01, 0x0c09b0fe, 0x2bd0090c, 0x270683a5,
-    0x040a2b25, 0x7a011c2c, 0x442a0b83, 0x0c09c480, 0x1515d12f, 0xbd411010,
-    0x07e04205, 0x042b2a28, 0x31fe0826, 0xc785151b, 0x5627e682, 0x032c0c09,
-    0x4d1b2c0a, 0x802d0513, 0x19090cab, 0x2b00012e, 0x2bba0fd5, 0x06e542aa,
-    0x200fe342, 0x1be34223, 0x22056544, 0x42352315, 0x402212eb, 0x0282402a,
-    0x2411ef42, 0x402b4040, 0x634f1840, 0x096b5409, 0x22194b43, 0x69173727,
-    0x07210564, 0x10534327, 0x1e374d23, 0x90028737, 0x38eb236c, 0x0282381e,
-    0x00241f84, 0x000b0000, 0x4405bf52, 0x2b21058f, 0x0b0b4600, 0x53004d22,
-    0x1723e985, 0x44010e15, 0x17240b83, 0x15072715, 0x2106be41, 0x1f543317,
-    0x013d2305, 0x8f443634, 0x050c4917, 0x27012e38, 0x15073735, 0x40171614,
-    0x0c095501, 0x090c0101, 0x0c09abfe, 0x0d84090c, 0x848a3621, 0x01ab240b,
-    0x82df171c, 0x069e4414, 0x832b5621, 0x60f52b00, 0x2a2a3501, 0x35600135,
-    0xaa44171e, 0x180f2c0f, 0x090c373d, 0xab0c0956, 0x411a4224, 0xa84405d5,
-    0x2b952f10, 0x0c472d40, 0x402d470c, 0x19391802, 0xf7820628, 0xf7820220,
-    0xd201ea29, 0x08009601, 0x18004000, 0x2a0a4fbe, 0x37273436, 0x26012f36,
-    0x8226010f, 0x012b2405, 0x61010f22, 0x06260582, 0x1406011f, 0x06820717,
-    0x013f162e, 0x16011f16, 0x3f32013b, 0x17373601, 0x36390e82, 0x20000127,
-    0x2a402a2a, 0x01017f2a, 0x2b04062d, 0x10350904, 0x08020814, 0x23038256,
-    0x09351014, 0x06211182, 0x211a992d, 0x3b830175, 0x352a403b, 0x230a160a,
-    0x074a0806, 0x080d1503, 0x38090938, 0x03150d08, 0x06084a07, 0x5e189723,
-    0x38240d5b, 0x51004800, 0x1429cd82, 0x0f161707, 0x012f0601, 0x82058206,
-    0x21c982c3, 0x0e820727, 0x013f2626, 0x27373426, 0x36230682, 0x8236011f,
-    0x82c382bd, 0x371721c9, 0x30820e82, 0x6e181620, 0xfa530fd0, 0x70012f08,
-    0x03042001, 0x2506031e, 0x01060d0c, 0x03823c06, 0x250b0e23, 0x22118206,
-    0x87012004, 0x0e0b211a, 0x0d211a86, 0x201a870c, 0x0aba5e25, 0xd554a720,
-    0x07c03a05, 0x06041808, 0x0f010533, 0x06280509, 0x09052806, 0x3305010f,
-    0x08180406, 0x2118840e, 0x18890206, 0x84060221, 0x5eb92018, 0xb8180be8,
-    0x837b07a3, 0x0003390b, 0x000f000c, 0x1300001b, 0x25231533, 0x0614011e,
-    0x36342622, 0x25231707, 0x33096e7c, 0xc0c02b33, 0x36294a01, 0x36365236,
-    0x01c060c1, 0x2a40406a, 0x01210282, 0x83168295, 0x36522413, 0x836aaaff,
-    0x00402111, 0x0808cb47, 0x6b01c030, 0x00000900, 0x0e152725, 0x013e0701,
-    0xc0011517, 0x0f6d6f95, 0xd5507328, 0x86125696, 0x01363752, 0x01000057,
-    0xecff0000, 0x9601c001, 0x2b822200, 0x27070631, 0x37273436, 0x34363216,
-    0x07062226, 0x82071714, 0x16142606, 0x06173732, 0x05d46315, 0x1980012e,
-    0x02029811, 0x24351296, 0x01243624, 0x35390885, 0x24019712, 0x69242434,
-    0x07580f01, 0x11580710, 0x24243724, 0x5708071c, 0x28238210, 0x07075810,
-    0x3523231b, 0x4c6b8423, 0x978205c7, 0xbc4c0120, 0x06b64c0a, 0x4cab0121,
-    0xf34c09b0, 0x00092209, 0x82998213, 0x012e2bc3, 0x17373527, 0x37013e03,
-    0x3c832735, 0x36860120, 0xc0c0c02a, 0x9501563e, 0xd5550295, 0x2c06ee4c,
-    0xabfe5656, 0x69487712, 0x48694242, 0x09c35f77, 0x0c00ab22, 0x2a204b82,
-    0x4a824d82, 0x011e332e, 0x33373632, 0x1e27010e, 0x3e231701, 0x40630382,
-    0x06566105, 0x08095f18, 0x3d2d0025, 0x82012b01, 0x280582c7, 0x241b2d3d,
-    0x24018001, 0x0b9d18b0, 0x08bd6f07, 0x3c01ab22, 0x242a1b82, 0xd43c2d1b,
-    0x1b1b2401, 0x35823f24, 0x2d3d0124, 0x7a511318, 0x13002206, 0x27878b18,
-    0x001d0006, 0x01000020, 0x3324d582, 0x3217012e, 0x0b8f5d18, 0x013b3622,
-    0x9482e282, 0x27370324, 0x70850001, 0x80187a20, 0x7a86090e, 0xa0a0ab23,
-    0x83898201, 0x09746d6a, 0x85181321, 0xebfe2476, 0x6300566a, 0x802b092b,
-    0x15000700, 0x22001e00, 0x82002600, 0x151321fd, 0x2705c44b, 0x1d062205,
-    0x21353301, 0x34220e82, 0x10762326, 0x201e8609, 0x08078233, 0xaa2b802b,
-    0x1cebfe2b, 0x2a014024, 0x151c2440, 0x120c0c09, 0x2be20c0c, 0x2b2b2a2b,
-    0x2a558001, 0x246b552a, 0x4040801c, 0x2a241c80, 0x05907701, 0x6b6b7f28,
-    0x6b6b5656, 0x7f820300, 0xab010024, 0xf34d6b01, 0x25002a06, 0x33071707,
-    0x17030735, 0x38018201, 0x07270735, 0x1e3c0117, 0x2c762c43, 0xf4fe2c4a,
-    0x2c0c011e, 0x6f1e6fc9, 0x821184a2, 0x2112850c, 0x13826f76, 0x02000022,
-    0xa0224b84, 0x4b846001, 0x15010028, 0x15331523, 0x06850737, 0xea550125,
-    0x824b4bea, 0x60012503, 0x4a352b35, 0x4b200483, 0x33852f82, 0x8001db2a,
-    0x18001200, 0x17010000, 0x35367e82, 0x17372723, 0x07233533, 0x37333523,
-    0x17332133, 0x01232707, 0x0082706b, 0x2d3c3b2d, 0xc020202a, 0x3bc04560,
-    0x8260c0fe, 0x0145230c, 0x00826080, 0x2d3c4027, 0x40c08029, 0x430682c0,
-    0x80200857, 0x0d28d382, 0x21130000, 0x23272315, 0x373cd382, 0x37211533,
-    0x1515016b, 0x574c7e16, 0xfe151689, 0x6b0177eb, 0x7e6d406b, 0x00ab6b2b,
-    0x2206835b, 0x608001d6, 0x1b200873, 0x15203b85, 0x2506254d, 0x07353725,
-    0x93823723, 0xd3820382, 0x012b3730, 0xaa2b55aa, 0x6a01552b, 0x803d5216,
-    0x0383803c, 0x561a0826, 0xabd58001, 0x2a240082, 0x80523c16, 0x19220083,
-    0xbf4a553c, 0x052b7608, 0x0f000b28, 0x013b0000, 0xe2832335, 0x11331724,
-    0x03821323, 0x40404026, 0x6a40406b, 0x40270584, 0x01959540, 0x8200ff00,
-    0x00002a8b, 0xff000002, 0x01d701f9, 0x2fa18282, 0x37000018, 0x37342627,
-    0x1707011f, 0x27072707, 0x3e0bd161, 0x19195aad, 0x931f5496, 0x1e93931e,
-    0x1a0f0bd0, 0x17194920, 0x3d1a1f09, 0x441a5aa3, 0x8616951a, 0x3d192918,
-    0x170a1e1b, 0x19204a19, 0x00218382, 0x285b8401, 0x008401da, 0x17000015,
-    0x057d5827, 0x17071723, 0x08038537, 0x2f220622, 0xce1e6d01, 0x5c0d0d04,
-    0x45154514, 0x46144513, 0x220d5d13, 0x1e06050d, 0x210d05ce, 0x45145d0e,
-    0x5d250186, 0x00050c0c, 0x834f8600, 0x000e23ab, 0x9f8d2500, 0xd03d0122,
-    0xca20978c, 0x8d8b0e82, 0x8b880220, 0x1f000522, 0x0220e787, 0xf282e584,
-    0x8d013f21, 0x20ed8496, 0x92ec8435, 0x86f3859f, 0x20a9921e, 0x606b8207,
-    0xe55005cf, 0x001d2407, 0x82250021, 0x012e23c0, 0xb055012b, 0x23272408,
-    0x82173335, 0x20078703, 0x240f8635, 0x1801ab01, 0x09bf5512, 0x4b2beb21,
-    0x5521068d, 0x2600822a, 0x012b2b56, 0x5518126b, 0x162006ca, 0x2b291182,
-    0x2b55aa55, 0x0055552a, 0x05075a00, 0x23072b56, 0x25000015, 0x20064361,
-    0x0d255613, 0x35821520, 0x896b2a21, 0x18012761, 0x2bc06aab, 0x1f561501,
-    0x01dd280f, 0x008001c3, 0x82120006, 0x263421b9, 0x2f08b982, 0x17070117,
-    0x3b161415, 0x17373201, 0x18950137, 0xf2329612, 0x381bb9fe, 0x0bd61218,
-    0x011c2809, 0x32191255, 0x1b1101f2, 0x1912ef38, 0x001c2906, 0x2208eb5d,
-    0x839601eb, 0x151323ff, 0x1e571533, 0x06f97705, 0x078c2320, 0x352b6383,
-    0x2bc03533, 0x2b181380, 0x51802a80, 0x182d06a4, 0x012b8013, 0x18408095,
-    0x80804012, 0x23038740, 0x80401812, 0xf3825f82, 0xcb6b0020, 0x82022005,
-    0x820920a9, 0x2f11390b, 0x11231101, 0x01271133, 0x2b9596ab, 0x550195c0,
-    0x9595d6fe, 0x2a01d6fe, 0x8f440782, 0x00562108, 0x13232f86, 0x82013f11,
-    0x1123232d, 0x2e925537, 0x64822582, 0x01800123, 0x36398240, 0x25000006,
-    0x03231133, 0x55012737, 0xb5d52b2b, 0x000140b5, 0x838000ff, 0x20278f86,
-    0x82528237, 0x2b802257, 0x21248720, 0x238600ff, 0x01c03b08, 0x00180080,
-    0x01000043, 0x1607011e, 0x07010e15, 0x2e062722, 0x35263702, 0x3237013e,
-    0x03163617, 0x3435013e, 0x2e012f26, 0x1e333602, 0x36321701, 0x23012e35,
-    0x06070626, 0x32821f16, 0x06141539, 0x27012e07, 0x06150622, 0x21800116,
-    0x010e0819, 0x171d2e3c, 0x8942552b, 0x5e32080a, 0x22192e2e, 0x01150d2a,
-    0x12211213, 0x010d0a0f, 0x35221f36, 0x22160102, 0x15090d39, 0x12122414,
-    0x2d010c09, 0x55214001, 0x2e1d172b, 0x080e013c, 0x0a894219, 0xf1fe2808,
-    0x141e2601, 0x03090823, 0x020e170a, 0x090b021d, 0x1f011c17, 0x09201225,
-    0x070d030f, 0x0301110b, 0x090c0322, 0x41002313, 0xcf83064b, 0xcf822a20,
-    0x00005829, 0x37012e25, 0x85373634, 0x2ac284b4, 0x013e3701, 0x17163233,
-    0x82230614, 0x070623b4, 0xc386011e, 0xfc942482, 0x22073908, 0x06171406,
-    0x1637021e, 0x27343632, 0x07022e36, 0x2b010126, 0x080a0128, 0x11201010,
-    0x330b0813, 0x0101131e, 0x2f1c1d30, 0x0d090c02, 0x011f1e10, 0x250b1301,
-    0x5729161e, 0x2a150a41, 0x11241cb4, 0x4a39110b, 0x87351225, 0x5f270808,
-    0x08111f01, 0x1e03010a, 0x060a0f02, 0x080d030b, 0x1b20101d, 0x09091419,
-    0x01021902, 0x03080a16, 0x121e0808, 0x41e0221a, 0x0c26151e, 0x25123524,
-    0x5482394a, 0x00200888, 0x03340082, 0xdaff0000, 0xa601e601, 0x45000300,
-    0x00005100, 0x0717013f, 0x2e24fc82, 0x27010f01, 0x2e220787, 0xff820e01,
-    0x86270721, 0x010e2507, 0x17011e17, 0x09822883, 0x08831620, 0x82171621,
-    0x012f222a, 0x20178237, 0x21098533, 0xa2180616, 0xda2c085b, 0x8c391339,
-    0x10060809, 0x1c131b09, 0x1c280784, 0x120f0409, 0x39090308, 0x1b270786,
-    0x02030809, 0x8408070b, 0x0603281f, 0x091c080e, 0x82070f06, 0x22218214,
-    0x84070b03, 0x22662609, 0x736c6d3e, 0x27058420, 0x133713d2, 0x11100301,
-    0x37234282, 0x83100309, 0x081d214a, 0x08226082, 0x0786131d, 0x10030a28,
-    0x01080708, 0x1f830902, 0x010e092b, 0x0e1d0901, 0x0f030201, 0x21218209,
-    0x3b820806, 0x691d0822, 0x53824d87, 0x13420020, 0x01eb3506, 0x0009006b,
-    0x001d0013, 0x35232500, 0x33352337, 0x07330715, 0x01240992, 0x484880eb,
-    0xab200282, 0x49210687, 0x2c098249, 0x2b552bc0, 0x2a80552b, 0x562a2a56,
-    0x260b8480, 0x00000400, 0x8301eaff, 0x00072d57, 0x00150011, 0x1300001f,
-    0x27070137, 0x61895382, 0x15332524, 0x6588010f, 0x011b2b29, 0x50801b65,
-    0x851a0111, 0xe6fe255c, 0x808c1f6f, 0xe6696084, 0x2a802305, 0x5d841714,
-    0x252a2a23, 0x470884b1, 0x962009a7, 0x28061f68, 0x0035001f, 0x15213700,
-    0x085b8221, 0x33272328, 0x36372315, 0x15232634, 0x06141632, 0x011e1507,
-    0x35331517, 0x23072634, 0x3634012e, 0x06223533, 0x33171614, 0x15831632,
-    0x2b012e3c, 0xc0fe4001, 0x20208a01, 0x12202035, 0x101e2915, 0x25101717,
-    0x2420012f, 0x0a83215b, 0x28281e2c, 0x1811211e, 0x2a012001, 0x0083406b,
-    0x3d14f027, 0x22162029, 0x36118216, 0x30302431, 0x01263824, 0x20142219,
-    0x01293c29, 0x231c1516, 0x8200251e, 0x4e062000, 0x962706eb, 0x0b000700,
-    0x83000f00, 0x00382b9f, 0x23171300, 0x37173315, 0xa1820501, 0x3521a585,
-    0x8aa18c23, 0x2bab8a95, 0x952b2335, 0x1b95d595, 0x700195fe, 0x2020a786,
-    0x7c20a486, 0x1f209b86, 0x542aac87, 0x9540013f, 0x011b9640, 0xad82b06b,
-    0x1f14ed23, 0x2aa98411, 0x252c2c25, 0x15164338, 0x881d221b, 0x3f9b23af,
-    0xab820100, 0xc101002c, 0x4f007601, 0x22250000, 0x01822726, 0x06070632,
-    0x23012e27, 0x33262726, 0x013e3736, 0x012e3635, 0x37270f82, 0x36163336,
-    0x82342637, 0x36173211, 0x14161716, 0x37011e07, 0x06161732, 0x17020e07,
-    0x25108214, 0x06073217, 0x3c852207, 0x42080982, 0x0001010e, 0x0e0a1913,
-    0x0a121110, 0x03030204, 0x01062a02, 0x0a1a2204, 0x1106060a, 0x010c060a,
-    0x130b1202, 0x14060201, 0x3c11113c, 0x01020614, 0x02120b13, 0x0a060c01,
-    0x0a060611, 0x04221a0a, 0x832a0601, 0x04320835, 0x1011120a, 0x0c190a0e,
-    0x040b070d, 0x01020101, 0x07090c05, 0x1e06070c, 0x0a02120c, 0x0303070e,
-    0x050a0608, 0x2e1d0201, 0x0216280e, 0x0e281602, 0x23821d2e, 0x08060a2c,
-    0x0e070303, 0x0c12020a, 0x2e82061e, 0x820c0921, 0x01012623, 0x0d070b04,
-    0x27f38300, 0xd501eaff, 0x3a009601, 0x0808a94c, 0x37013e2e, 0x2f013d26,
-    0x37270701, 0x27173727, 0x36021f37, 0x35012e37, 0x1632013e, 0x07061417,
-    0x023f1716, 0x17370717, 0x27071707, 0x1415010f, 0x0121fb82, 0x0548696b,
-    0x13012208, 0x053f0e10, 0x2a2f0636, 0x140c2a0b, 0x0d39050f, 0x010e0c13,
-    0x01243624, 0x0d130c0e, 0x140f0539, 0x0819820c, 0x36062f44, 0x100e3f05,
-    0x3c2d5513, 0x2d3c0101, 0x150f2918, 0x0325091b, 0x180d140e, 0x05301913,
-    0x11210236, 0x101a090a, 0x1c24241c, 0x0a091a10, 0x36022111, 0x13193005,
-    0x0e140d18, 0x1b092503, 0x00290f15, 0xc35e0900, 0x000b3008, 0x00180013,
-    0x0026001e, 0x0034002e, 0x8242003c, 0x0a9f77d4, 0x072bae82, 0x36372723,
-    0x1736030f, 0x820f1733, 0x270482d6, 0x37363526, 0x06151605, 0x07201983,
-    0x272a1583, 0x0607011f, 0x3f272623, 0x3b823301, 0x18013721, 0x080c234a,
-    0x062d3935, 0x0e082560, 0x1a370726, 0x3a407e24, 0x7346381b, 0x05361a12,
-    0x55012101, 0x16140109, 0x40f82012, 0x3243273c, 0x16134075, 0x182c3917,
-    0x2e100be2, 0x18010e1b, 0x080b384a, 0x1d011330, 0x0316120d, 0x061b1608,
-    0x364d2928, 0x4731520e, 0x15141242, 0x1c32303d, 0x47272e1f, 0x3a460740,
-    0x2a474211, 0x1c010625, 0x24181325, 0x93441d0b, 0x00022505, 0x09004001,
-    0x3128df82, 0x33130000, 0x15171632, 0x230aa35f, 0x05013e35, 0x1d201382,
-    0x17258182, 0x3d013e21, 0x08bd5f01, 0x84213521, 0x2b952727, 0x80011812,
-    0x0682bd18, 0x1801802f, 0x0916e7fe, 0x0112190c, 0x0c19122a, 0x2c0a8209,
-    0x4080fe40, 0x1940010c, 0x12555512, 0x22058519, 0x18090c40, 0x2d07507d,
-    0x090c0c09, 0xc02a2ac0, 0x00000c09, 0x03820400, 0xd6010024, 0x5f447601,
-    0x00152706, 0x33353700, 0x03820715, 0x6b820320, 0x07330532, 0x23353327,
-    0xd5231737, 0x5656abab, 0xabfe0001, 0x09420b19, 0x2a802a2a, 0x2a00012a,
-    0x4a4ad62a, 0x002c0282, 0x00000500, 0xbc01e5ff, 0x02009b01, 0x0d200b82,
-    0x1f20db82, 0x3737db82, 0x2f071117, 0x23072301, 0x23173337, 0x012f3327,
-    0x35170731, 0x82233537, 0x07340861, 0xc5153315, 0x46454546, 0x330f3e07,
-    0x35434042, 0x0b0e3047, 0x5c66820a, 0x0165639a, 0xfe464655, 0x644646d6,
-    0x5cd6d63a, 0x892a292e, 0x2901911b, 0x29028e1d, 0x1220b391, 0x1523b382,
-    0x82273533, 0x15032a03, 0x33253521, 0x11330727, 0x22b08c33, 0x832ad52b,
-    0x85ff20ad, 0xeafe21ad, 0x6b20f788, 0x4383f786, 0x438ff78f, 0x4384ab20,
-    0x0123f186, 0x84060016, 0x82a620ef, 0x00092aef, 0x002c0011, 0x003c0039,
-    0x22f1823f, 0x5107011e, 0x1732052c, 0x16140622, 0x17363233, 0x37013b35,
-    0x013e3736, 0x787e2737, 0x011e2506, 0x07010e15, 0x7a080282, 0x15062237,
-    0x3e171614, 0x26343502, 0x11173727, 0x29a62707, 0x50270125, 0x0e282625,
-    0x1d0f1010, 0x0b0a5801, 0x0a090b16, 0x0e01030e, 0x2a012438, 0x01262824,
-    0x290f1012, 0x110d2519, 0x0e0a100f, 0x46a30e06, 0x01464545, 0x2c3c022b,
-    0x5c3c3932, 0x4a23223c, 0x26b28f23, 0x07060404, 0x0e010b14, 0x2a201e20,
-    0x27310201, 0x0d11301e, 0x14b3020e, 0x01130e11, 0x09090801, 0x414e1a11,
-    0x0020055f, 0x18093749, 0x2c081fa3, 0x21352137, 0x35211535, 0x23353301,
-    0x059a4d40, 0x8080fe24, 0x2819ab80, 0x07200a87, 0x29083782, 0x01eb0100,
-    0x000d001c, 0x001a0014, 0x0026001f, 0x0033002e, 0x33151300, 0x012e013e,
-    0x2e072223, 0x07062701, 0x33152726, 0x04830635, 0x07232622, 0x11860a83,
-    0x16150725, 0x8235013b, 0x16550825, 0xf7063517, 0x011c1eba, 0x0a0c181f,
-    0x27283705, 0x1e0b0a2e, 0x06133605, 0x0b132e06, 0x1402022c, 0x09062f0c,
-    0x2d090404, 0x01121201, 0x1f03ae03, 0x26042030, 0x2e010132, 0xa4a00206,
-    0xa3a40606, 0x9f960e01, 0x01013c03, 0x0e0f8362, 0x34680264, 0x0f4f0f18,
-    0x069f4700, 0x9601c02a, 0x42003900, 0x54004b00, 0xe2449982, 0x011e2507,
-    0x37013e17, 0x330cf744, 0x010e0706, 0x1e070607, 0x010e1501, 0x34272622,
-    0x27263736, 0x0483bf82, 0x013e3522, 0x18081e70, 0x2008684e, 0x07676903,
-    0x241b802a, 0x01121701, 0x11331113, 0x132a0282, 0x01171201, 0x01243624,
-    0x12841418, 0x22860f88, 0x14011326, 0x1b240118, 0x2005af50, 0x200685f7,
-    0x2b068589, 0x1c249501, 0x0e082014, 0x16351618, 0x182d0282, 0x1420080e,
-    0x1c24241c, 0x11062115, 0x87108b1a, 0x111a2424, 0x50152106, 0x012009e0,
-    0x2106e850, 0xf050d6fe, 0x00002105, 0x2d08676b, 0x0018009b, 0x002a0021,
-    0x00490040, 0xfd821300, 0x88058947, 0x2e3522ea, 0x87e48301, 0x20db88d2,
-    0x070b4105, 0x8f183520, 0x1e210913, 0x27711801, 0x21fa8308, 0xe17a1318,
-    0x20d9860c, 0x20d28609, 0x050b4137, 0x5b2b1329, 0x18122b5b, 0x86401813,
-    0x01802c17, 0x20151b24, 0x20078807, 0x8a241b15, 0x852a200a, 0x00ff21ba,
-    0x1c870785, 0x5b46af29, 0x1218465b, 0x882007af, 0x06df41da, 0x61019621,
-    0x1d240507, 0x00002d00, 0x08b56318, 0x62760720, 0x22e88205, 0x5403010e,
-    0x372007b8, 0x29064053, 0x3632013b, 0x26341135, 0x7a820001, 0x7d823620,
-    0x200aca7d, 0x054d552d, 0x82d67d21, 0x83122007, 0x83c02004, 0x362423c0,
-    0x0247aa24, 0x2d3d2106, 0x55242d82, 0x18241801, 0x2b200282, 0x200bdd6c,
-    0x26008200, 0xff000004, 0x82c001d5, 0x000b2793, 0x002a001b, 0x134a0033,
-    0x65062005, 0x1720056f, 0x34249682, 0x07062737, 0x36209882, 0x37200782,
-    0x23230f82, 0x82013e27, 0x15162491, 0x6a012f11, 0x2b270712, 0x1b7a011b,
-    0x82100b1f, 0x1b952780, 0x1e100124, 0x7e82011c, 0x1e1e2b24, 0x07825212,
-    0x058f0424, 0x1a820e15, 0x856b2a21, 0x500133ac, 0x1c86fe1b, 0x1218091f,
-    0x2401d0fb, 0x1e12191b, 0xa4822b1e, 0x1e1c0124, 0x07824010, 0x0f0c8f22,
-    0xe622a682, 0x5018ef2b, 0xdb6208c9, 0x00803509, 0x0021000a, 0x25000031,
-    0x34272622, 0x07013f36, 0x1603010e, 0x09eebe18, 0x1416313c, 0x2e272206,
-    0x013e3501, 0x07061405, 0x34262206, 0x37013e37, 0x16372734, 0x99820001,
-    0x0e125508, 0x1e0876cf, 0x2d303a13, 0x6049211c, 0x171a0102, 0x07110d07,
-    0x7802211d, 0x1d213001, 0x060c1107, 0x0c011a17, 0x246b1b1a, 0x081d121c,
-    0x1310cc78, 0x1b011501, 0x61010b1a, 0x173e2448, 0x060d1106, 0x5a2d4d1d,
-    0x4d2dd379, 0x110d061d, 0x243d1806, 0x302c1e20, 0xff229f84, 0xf35d01e0,
-    0x00082205, 0x089f8210, 0x07270732, 0x37253717, 0x0333011f, 0x37330323,
-    0xadcd0133, 0xcb6c1e4e, 0x2c2c9efe, 0x286d2c29, 0x78182d6d, 0x1e4fadc9,
-    0x762acb6d, 0x15016a76, 0x0040ebfe, 0x0c4f5218, 0x20000f26, 0x3a002e00,
-    0x2e2d4982, 0x2e060701, 0x36373601, 0x011e1716, 0x20f1830e, 0x23128c27,
-    0x26270607, 0x20822186, 0x0c366e18, 0x367e3008, 0x0d08348e, 0x3b080705,
-    0x05073e9e, 0x04091009, 0x742c060d, 0x040b0734, 0x813c0606, 0x1e040533,
-    0x714b0b07, 0x06030905, 0x05547b05, 0x185b6503, 0x0807115b, 0xd7780232,
-    0x02100a1f, 0x020e1007, 0x05220c12, 0x38030d10, 0x1b030306, 0x0602100e,
-    0x11020c0d, 0x0c031f0f, 0x2e060a41, 0x0a06011a, 0x331b0209, 0x2f010b02,
-    0x0cd56a18, 0xcb820620, 0xd601002c, 0x05008001, 0x11000b00, 0xcd821700,
-    0x0000293b, 0x14061713, 0x21130717, 0x07222607, 0x36271125, 0x21132734,
-    0x37321637, 0xa47c1827, 0x08514208, 0x16166c2c, 0x0001556c, 0x20542036,
-    0x0c821f01, 0x84ff1721, 0x244a270b, 0x30483030, 0x49422430, 0x83402006,
-    0x0136251f, 0x16165740, 0xfe212086, 0x210b82f6, 0x248301be, 0x29304822,
-    0x2c074242, 0xff000004, 0x01ce01f0, 0x00030093, 0x248f8407, 0x17013f00,
-    0x82038307, 0x6b272006, 0x073c07d3, 0xc037012f, 0x1c147013, 0xfe136f13,
-    0x49564ad5, 0x0d190c0c, 0x970fb522, 0x605e120f, 0xfa201382, 0x012a0382,
-    0x4a56490a, 0x190d220d, 0x1782720c, 0x4f5e4b21, 0x0f240ac3, 0x2b001f00,
-    0x3408e582, 0x17011e21, 0x07010e11, 0x27012e21, 0x17013e11, 0x011d0622,
-    0x013b1614, 0x013d3632, 0x07232634, 0x15171633, 0x26230706, 0x80363527,
-    0x241b0001, 0x1b240101, 0x250785ff, 0x0c0c0930, 0x0483d609, 0x0a6aa025,
-    0x830a0101, 0x80012104, 0x1b201f89, 0x3f202f83, 0x27822286, 0x22854020,
-    0x00212782, 0x2ce38204, 0x010002c0, 0x000f00c0, 0x001c0016, 0x2d89913c,
-    0x07061401, 0x27011e35, 0x36022e15, 0x7f823717, 0x0e152324, 0xad820701,
-    0xa9821520, 0x082cbc18, 0x0c823520, 0x7516352c, 0x42321601, 0x32420101,
-    0x0784eafe, 0x1b050122, 0x4f3f0082, 0x1f012116, 0x321c156b, 0x01302419,
-    0x13203401, 0x0e180e24, 0x28191f30, 0x2130012a, 0x89c00124, 0x8332202f,
-    0xfe2b083f, 0x031f19bd, 0xac170872, 0x2f180568, 0x2511201a, 0x03141506,
-    0x23272528, 0x13027907, 0x1a161014, 0x03161702, 0x2428242f, 0x4d066e08,
-    0xea24079b, 0x9901ab01, 0x2b069b4d, 0x00170013, 0x2500001b, 0x21153335,
-    0x3f250382, 0x27071701, 0x82038637, 0x82032006, 0x01300813, 0xa7fe2772,
-    0xbc082a26, 0xae10a308, 0x93197e10, 0x1f733518, 0x11bf8d72, 0x73999973,
-    0x2627257e, 0x23512381, 0x1d7b1ea6, 0x9a179ad5, 0x2727b6fe, 0x01206783,
-    0xd6290484, 0x0f005601, 0x15010000, 0x21018423, 0x01853533, 0x5540012e,
-    0x56955556, 0x55015555, 0x40565555, 0x40200882, 0x04842e84, 0x9601d624,
-    0x91820900, 0x37271725, 0x820f012f, 0x0001348f, 0x99742384, 0x74993c3c,
-    0x96505023, 0x8d8d0d65, 0x8396650d, 0x4c02202a, 0x092e0813, 0x00001500,
-    0x37072725, 0x1f013f27, 0x58180701, 0x5a2a0ce5, 0x50185a5a, 0x69292969,
-    0x7d434250, 0x36402d0a, 0x08456736, 0x45096061, 0x5a7902ee, 0x00221887,
-    0x83880200, 0xb9830520, 0x82352521, 0x8617204e, 0x17372988, 0x24000127,
-    0x8515475e, 0x84298d85, 0xc7772384, 0x5b3e0856, 0x829385b4, 0x223f839d,
-    0x8501eaff, 0x25f982c3, 0x07013713, 0x9787012f, 0x2b271728, 0x1b65011b,
-    0xd0826c24, 0x82874e21, 0x9a0529d0, 0xfe1b5001, 0x41241b9b, 0x0621d882,
-    0x21d88294, 0x838b9a15, 0x88054f5a, 0x24878b3e, 0x5e471550, 0x298c8d24,
-    0x3d5c3178, 0x08565608, 0x908a5c3d, 0x280cf344, 0x00300022, 0x00420039,
-    0x077b1800, 0x1e172809, 0x36323301, 0x82373537, 0x34250805, 0x07062226,
-    0x22230715, 0x013e2707, 0x013e1613, 0x36012f26, 0x010e011e, 0x0e372726,
-    0x34262201, 0x07163236, 0x06715b14, 0x0807334d, 0x156e4b2b, 0x16200552,
-    0x4801221a, 0x2e2e2202, 0x32012e44, 0x720f1304, 0x0d077708, 0x0c0a0a19,
-    0x0e22111c, 0x0722220e, 0x2e1e01e5, 0x2302821e, 0x1722175d, 0x2e4d0282,
-    0x55012907, 0x1b152245, 0x34031a22, 0x2e383982, 0x0a4a0122, 0xfe6e542f,
-    0x1a0a05bf, 0x070b0618, 0x0e23230e, 0x179b0f0e, 0x1e223883, 0x38831117,
-    0x8f5c1720, 0x0007360b, 0x00190011, 0x25000022, 0x2337013e, 0x2707010e,
-    0x2e331733, 0x29c58201, 0x2e351733, 0x1e232701, 0xf9181301, 0x153408de,
-    0x4007533a, 0x40202d07, 0x083e4056, 0x08618061, 0x2d20563e, 0x532b1182,
-    0x7d7d584f, 0x177d7db0, 0x823a5307, 0x40be2610, 0x3f57573f, 0x232983be,
-    0x76015339, 0xb0211983, 0x0617427d, 0x56019622, 0x22056355, 0x82231101,
-    0x01272701, 0xeb2a4095, 0xb8555501, 0x08374b07, 0x2786d620, 0x00000a2a,
-    0x33112301, 0x13170703, 0x01290682, 0x6b40406b, 0x40d5ebeb, 0x26328540,
-    0x2a019595, 0x8600d6fe, 0x86c0205b, 0x13002333, 0x01823311, 0x8c6b3721,
-    0x0543565a, 0x5789eb20, 0x11331327, 0x07171323, 0x20068203, 0x42569595,
-    0x08220a8b, 0x89823600, 0x33070941, 0x011e1525, 0x33011e17, 0x3537013e,
-    0x3435013e, 0x07062226, 0x15201182, 0x08994218, 0x15233523, 0x05094a33,
-    0x33353108, 0x0a950135, 0x0c120c0b, 0x019ffe0c, 0x4b0b303c, 0x024e3b32,
-    0x37241713, 0x17010124, 0x29360113, 0x2d0a3021, 0x2b560138, 0x30493001,
-    0x15012b01, 0x2a058e49, 0x4630c080, 0x013b3108, 0x494f3b4e, 0x4d3209d0,
-    0x01013629, 0x450b1d22, 0x8040c02e, 0x24303024, 0xa3844080, 0x9601e828,
-    0x1c009601, 0xa3842000, 0x14011d3b, 0x14152306, 0x06010f06, 0x26012f26,
-    0x35013f36, 0x013d2622, 0x1d333634, 0x2f8d8201, 0x1818126b, 0x850c0f12,
-    0x12082011, 0x41100c08, 0x96210e83, 0x05467601, 0x160dab24, 0x14823e04,
-    0x20102730, 0x197e1f08, 0x18124012, 0x0040402a, 0x00820001, 0x1f570120,
-    0x25002705, 0x01211121, 0x1482ff80, 0x17834020, 0x38055741, 0x006b01c0,
-    0x00110003, 0x25000015, 0x013b3523, 0x07212735, 0x33153315, 0x3c038235,
-    0x1521013d, 0x80000121, 0xfe15c080, 0xd61515aa, 0xaafe2b55, 0x55405601,
-    0x2b6b6b2b, 0x22008280, 0x41002bd6, 0x6b220af7, 0x45820900, 0x47842120,
-    0x3e832320, 0x07333523, 0x684a8223, 0x5982055d, 0x23152123, 0x38578411,
-    0x15550111, 0x1515162b, 0x402b2b6a, 0xaa402a2a, 0xaa40d6fe, 0x2bc0aa56,
-    0x2c0f8240, 0x15401516, 0xfe404016, 0x015656ea, 0x0a876716, 0x2d000336,
-    0x3f003600, 0x47004300, 0x54005000, 0x33370000, 0x33032317, 0x2006c86f,
-    0x4ab08217, 0x1d2a053a, 0x011e3301, 0x06141115, 0xba5b1523, 0x05097605,
-    0x05480520, 0x080e4807, 0xdb823720, 0x35210523, 0x50661821, 0x82172008,
-    0x82802050, 0x166b2183, 0x20058b64, 0x05ea612a, 0x18121627, 0xd6401218,
-    0x21068240, 0xb14b3d01, 0x854c2005, 0xfe892406, 0x855601aa, 0x852b2003,
-    0x829e2011, 0x4095243e, 0x18151601, 0x240d5a53, 0x1912ebfe, 0x26008215,
-    0x15011219, 0x4c3f1812, 0xa24c069a, 0x55162407, 0x866b95c0, 0x40952113,
-    0x3207a74c, 0x009701ab, 0x000c0003, 0x00190010, 0x2500002c, 0x18333523,
-    0x2008717a, 0x080c8b27, 0x06261321, 0x011e1507, 0x21150733, 0x36322735,
-    0x012e3537, 0x6b6b8001, 0x12120e20, 0x8312121c, 0x854b6b6b, 0x49523209,
-    0x2a010260, 0x00012020, 0x012a2020, 0x6bd56002, 0x062375eb, 0x09887f20,
-    0x023f0131, 0x1fcb3621, 0x0b0b202b, 0xcb1f2b20, 0x82002136, 0x84012000,
-    0x01fe3804, 0x00260016, 0x2e233700, 0x26012f01, 0x32013b36, 0x36171617,
-    0x83373617, 0x0f16250a, 0x07010e01, 0x22201a85, 0x952e0b83, 0x04271a40,
-    0x1b23040a, 0x04101c80, 0x06190e02, 0x5534173b, 0x401a2201, 0x0514271c,
-    0x06030306, 0x1b271405, 0x01221942, 0x08200619, 0x93467782, 0x01c03d05,
-    0x00060056, 0x0100000d, 0x15231527, 0x07271533, 0x35333517, 0x55c00123,
-    0x55d69696, 0x01270482, 0x2a405500, 0x82552a40, 0x07534405, 0x80019622,
-    0x132e3385, 0x33153307, 0x35173335, 0x17231523, 0x2282c037, 0x2b824020,
-    0x01555523, 0x24388280, 0x559696d6, 0x0ac34255, 0x13007d26, 0x2d002400,
-    0x3e22e782, 0x184f3701, 0x061b4405, 0x372fdf82, 0x27370706, 0x3f362726,
-    0x17071701, 0x192e0706, 0x2909882e, 0x2447232b, 0x24234823, 0x08882347,
-    0x19198e31, 0x01041669, 0x187a0901, 0x191a7067, 0x4aa44823, 0x40260556,
-    0x03011911, 0x02820325, 0x06854020, 0x11190134, 0x490601ab, 0x0c08051b,
-    0x49225506, 0x03010b85, 0x5b4a8325, 0x47052007, 0x531808e7, 0x002209ab,
-    0x136e3325, 0x22232414, 0x43112726, 0x17260504, 0x2b010e11, 0x15693501,
-    0x82072006, 0x680383ff, 0x40201091, 0x20052265, 0x240685aa, 0x55161640,
-    0x6800832b, 0x01260d87, 0x0c0c0900, 0x0582ff09, 0x1c82d520, 0x2a2a5622,
-    0xb7452482, 0x01b13006, 0x00030080, 0x13000016, 0x17371723, 0x55220607,
-    0x35210548, 0x3e0d8333, 0x94141617, 0x6a15c029, 0x06110712, 0x1e1e3943,
-    0x1ebf65be, 0x0643391e, 0x14c05501, 0x84061281, 0x65bf2213, 0x211384be,
-    0x00820011, 0xeb820220, 0xab01d52b, 0x0e00ab01, 0x00001d00, 0x0a1f4e25,
-    0x27371539, 0x1707013d, 0x17011e35, 0x36170714, 0x01012e37, 0x01493600,
-    0x7d1a1f0f, 0x5521054f, 0x2f0d8855, 0x36490140, 0x281f1b21, 0x02604933,
-    0xeb555640, 0x128a0382, 0x00820020, 0x03820420, 0x44010021, 0x143c05f7,
-    0x29001800, 0x33370000, 0x23372335, 0x011e3715, 0x07061415, 0x37013e15,
-    0x07272634, 0x27231482, 0x82171614, 0x2e073f07, 0x36343501, 0x010e3537,
-    0xd52a2aeb, 0x14113080, 0x4738262f, 0xa3171b01, 0x1bab2a2a, 0x11873217,
-    0x4080ab34, 0x2e112f80, 0x0e412a1b, 0x3d590f2c, 0xe3173d24, 0x0582402b,
-    0x158a3320, 0x82030021, 0x82fd20e7, 0x826b20e7, 0x002725e7, 0x0100002d,
-    0xd9857986, 0x17252724, 0xe8820706, 0x37207687, 0x15280e82, 0x37173736,
-    0x06351701, 0x012f2282, 0x122f80ab, 0x19200f14, 0x181a0101, 0x8432c5fe,
-    0x82608207, 0x08ac2f13, 0x32161908, 0x7db1fe1b, 0x081f1619, 0x75846b01,
-    0x1f1b2024, 0x83823228, 0x84331521, 0x2c8a8506, 0x05ac1b20, 0x0d072c03,
-    0x50011b32, 0x2107822f, 0x57730420, 0x00802a09, 0x0015000f, 0x22210100,
-    0x080c5f06, 0x012e1132, 0x33112103, 0xc0013315, 0x181280fe, 0x12180101,
-    0x0710e619, 0xd580fe23, 0x0d2d7bab, 0x01abfe25, 0x8200552a, 0x82002045,
-    0x01eb2245, 0x27f18280, 0x000c0007, 0x00140010, 0x2d095170, 0x00350030,
-    0x003d0039, 0x13000041, 0x695e3533, 0x22352206, 0x073b6f06, 0x23351725,
-    0x8301011e, 0x827a8217, 0x82252020, 0x6f032003, 0x0123068e, 0x6f373632,
-    0x17200886, 0x15211482, 0x2500832b, 0x2baa1812, 0x0983ab2b, 0x01180125,
-    0x82d6ab92, 0x2b2b27a4, 0x2b2b00ff, 0x00822a55, 0x82550121, 0x821c82b7,
-    0x56230820, 0x00012a2a, 0x802a802b, 0x99fe192b, 0x802b2a2b, 0x0119122b,
-    0x12558080, 0x2bd5fe19, 0x80fe2bd5, 0x822a012b, 0x12192405, 0x82d52a80,
-    0x00002131, 0x2210a37d, 0x821f001b, 0x462120b7, 0x07280569, 0x35012e21,
-    0x17363411, 0x21053547, 0x07860535, 0x2a016b24, 0x0c7a1912, 0x216d8207,
-    0x0482d6fe, 0x54180120, 0x55200f2d, 0x80200083, 0x67850483, 0x01eaff2f,
-    0x009601eb, 0x000d0009, 0x00150011, 0x28678221, 0x11151632, 0x012b0614,
-    0x20618311, 0x205d8207, 0x21038203, 0x076a3317, 0x12eb2709, 0xc0121818,
-    0x0083962a, 0x2b405523, 0x78028240, 0x013107f5, 0x5656aaaa, 0x01565680,
-    0x96565600, 0x402a4040, 0x21668240, 0x57440500, 0x20678a08, 0x05f67a01,
-    0x11013b27, 0x35231507, 0x20038217, 0x21038213, 0x67182307, 0x01210908,
-    0x8568ae15, 0x21cf8367, 0x6f4d000f, 0x82272005, 0x0e4a7fcf, 0x2720d58c,
-    0x200a756a, 0x856d8396, 0x23d98304, 0x371e378c, 0x87075a6a, 0x121825de,
-    0x18125601, 0xab20e289, 0x02872382, 0x0620e882, 0xc023e784, 0x87009601,
-    0x001f217f, 0xf56e8183, 0x0eb9410f, 0x48330321, 0xc141053c, 0xd5aa2514,
-    0x012a802b, 0x0a95c518, 0x63405521, 0x402405bf, 0x55400140, 0x8205b36e,
-    0x00002377, 0x7782d601, 0x0c00072e, 0x21001d00, 0x29002500, 0x07250000,
-    0x0a977818, 0x84820320, 0x07151723, 0x48028223, 0x3f4205a3, 0x0122080b,
-    0x152c15cf, 0x071b0908, 0x812c81d6, 0x2b01ab2c, 0x52011812, 0x12842759,
-    0x80121818, 0xd5fe802b, 0x2082a380, 0x1b070724, 0x20827f09, 0x18950124,
-    0x1e825912, 0x01121925, 0x42181200, 0xff820751, 0xff840a20, 0x8001d622,
-    0x5918ff8a, 0x002109f7, 0x25828213, 0x06141115, 0x818d2123, 0x2335172c,
-    0x33150515, 0x35330735, 0x07863723, 0x37221383, 0x88191523, 0x56270d39,
-    0x5680562a, 0x825600ff, 0x82802000, 0xd6562103, 0x01250483, 0xfe121980,
-    0x25a983c0, 0x19124001, 0x00854055, 0x40402b25, 0x836b40ab, 0x230f8204,
-    0x000040ab, 0x22052341, 0x415601eb, 0x1720119b, 0x23060d6c, 0x013e3527,
-    0x820f5543, 0x33152592, 0x40152315, 0x0f5f6418, 0x6b2a6b24, 0x048200ff,
-    0x2b56ab27, 0x1855012b, 0x07b65412, 0x24099e41, 0x2b402b96, 0x08fb4200,
-    0x1500802d, 0x1d001900, 0x2d002100, 0x41250000, 0x3d210504, 0x3c521801,
-    0x0533210b, 0x17206c82, 0x35230383, 0x73071523, 0x23240549, 0x33352335,
-    0x07c3b818, 0xff822a20, 0xfe200382, 0x0282fb82, 0x6956d621, 0x402705dc,
-    0x191912eb, 0x842b9512, 0x85952000, 0x405625fd, 0x2a40402a, 0x22064744,
-    0x8c9601d6, 0x2634287b, 0x06222123, 0x4b33011d, 0x8c420535, 0x33252405,
-    0x83372315, 0x23152303, 0x19822735, 0x08b8a218, 0x6855d520, 0x207b9605,
-    0x2c7ba095, 0x000b006b, 0x001f001b, 0x00270023, 0x096d4300, 0x25273724,
-    0xf6710614, 0x21372407, 0x8815011e, 0x353324fd, 0x4337c923, 0x01210958,
-    0xc842182a, 0x82fc850c, 0x6dab2005, 0x372208f5, 0x24467338, 0x86402005,
-    0x83402006, 0x08cf4900, 0x6b01eb30, 0x13000300, 0x21250000, 0x21372111,
-    0x8218010e, 0x372a07de, 0x01012e11, 0x01d6fe95, 0x66462b2a, 0xf94b180e,
-    0x824e8212, 0xff002345, 0x018201c0, 0x07220982, 0x51851700, 0x35230324,
-    0x558f1333, 0xcafe9b29, 0x56703601, 0x53ff5556, 0x1b20050c, 0x25061c53,
-    0xfe55012b, 0x4282156b, 0xfe1b2423, 0x052e5380, 0x07820120, 0x03215c82,
-    0x225b8900, 0x861c000c, 0x012e275b, 0x16323634, 0x60830614, 0x14111527,
-    0x3e211716, 0x37b68601, 0xa04001c0, 0x1b12120d, 0xfe881212, 0x1e1e17d5,
-    0x162b0117, 0x1e01011e, 0x55206283, 0x26066b4b, 0x1e01ea01, 0x846afe16,
-    0x01162517, 0x001e1696, 0x230cab4e, 0x1300001a, 0x2c056c50, 0x27050614,
-    0x22012b26, 0x14011d06, 0x06457e1f, 0x5d857520, 0xc0460130, 0x1296120c,
-    0x0cc00c18, 0x0c960c24, 0x72832b01, 0x62121b25, 0x82180cc0, 0x82158216,
-    0x00242114, 0x2f055f43, 0x80010002, 0x14000b00, 0x2c002300, 0x3c003300,
-    0x0e58c582, 0x8725200a, 0x2125216b, 0x0cc1b318, 0xac180720, 0x1727070b,
-    0x23373632, 0x8737011e, 0x4001210f, 0x08f14a18, 0xfe490123, 0x05f54cdf,
-    0xfe77012f, 0x800d16ce, 0x01160d80, 0x19191232, 0x271585d2, 0x082b1e34,
-    0x492b08a2, 0x40230d85, 0x87364901, 0x4f6a203a, 0xd52d0528, 0xafaf1001,
-    0x12190110, 0x18132a01, 0x06004dab, 0x1c246b25, 0x866a241c, 0xb7a8180c,
-    0x821a200d, 0x004808c3, 0x34363213, 0x14062226, 0x011e0516, 0x2206010f,
-    0x3d26012f, 0x37363401, 0x011f1633, 0x14161737, 0x3727010f, 0x12120e75,
-    0x0112121b, 0x0d010c0b, 0x0d240c6a, 0x12180c95, 0x430c126b, 0x0c0c9315,
-    0x017a1573, 0x121c1200, 0x37280282, 0x6b0c240c, 0x0c950c0c, 0x18261c82,
-    0x180c0101, 0x11829316, 0x18157321, 0x29091393, 0x009601d6, 0x001a0008,
-    0x778a001e, 0x77886383, 0x32013b27, 0x27371317, 0x23728707, 0x960c0c61,
-    0x89414482, 0x960c2306, 0x9d4195b6, 0x22168208, 0x410c0c96, 0xfe2406b9,
-    0x95b5968c, 0x8908ef47, 0x00222267, 0x206ba026, 0x06a8543f, 0x77277399,
-    0xab1e761e, 0x9a1e551e, 0x1e37267b, 0x1e401e75, 0x20d98256, 0x05976800,
-    0x17248383, 0x38002f00, 0x15287f82, 0x2307010e, 0x011e3315, 0x2b05564f,
-    0x23353337, 0x3527012e, 0x35331507, 0x19821382, 0x35221f82, 0x13821523,
-    0x3e221982, 0x2a5b1701, 0x3beb2907, 0x2c2c0851, 0x2a3b5108, 0x2a280888,
-    0x29073929, 0x29390729, 0x3e200887, 0x21050f42, 0x278d9501, 0x57203083,
-    0x3183288c, 0x29426220, 0x6b002005, 0x0c2b0c43, 0x35001500, 0x013f0000,
-    0x42071733, 0x232007bf, 0x37240887, 0x012b012e, 0x23249b82, 0x010f0622,
-    0x23050c69, 0x21013d36, 0x6b240988, 0x2020ea20, 0x20054643, 0x052642f8,
-    0x1004fc31, 0x3580350b, 0x2c04100b, 0x0916090c, 0x8400010c, 0x60d52306,
-    0x57436a60, 0x28058505, 0x2b0c09d5, 0x80090c2b, 0x21bf82ab, 0x27821609,
-    0xab090c22, 0x29092b5e, 0x000f0080, 0x0025001b, 0xab490100, 0x07504705,
-    0x57173321, 0x3e210503, 0x26988201, 0x33153707, 0x82071735, 0xa199189d,
-    0x4095260b, 0x54010154, 0x29058440, 0x405640ab, 0x80015640, 0xd4701219,
-    0x872b2009, 0x2422821c, 0x2b2b4094, 0x22038240, 0x82000100, 0x014a0800,
-    0x006501c3, 0x3f000015, 0x0f263602, 0x36262701, 0x16362537, 0x2f060307,
-    0x010e0701, 0x05a306d1, 0x57ca0808, 0x0111020f, 0x04100c55, 0x5819073a,
-    0x3208032b, 0x0305945a, 0x041c8004, 0x05830810, 0xeffe120f, 0x29410e1d,
-    0x4d820504, 0x2208577f, 0x45030080, 0x35200749, 0x2106034c, 0xb982013b,
-    0x3632332c, 0x012e1137, 0x80fec001, 0x9e458001, 0xaa6b3907, 0x0118126b,
-    0x01551801, 0x12192b00, 0x181200ff, 0x12182b2b, 0x19120001, 0x8508df47,
-    0x0871464f, 0x21112526, 0x16320111, 0x2205a24e, 0x4e352315, 0x332506b6,
-    0x23153317, 0x06f34615, 0x67850783, 0x12205c84, 0x12226587, 0x0082802b,
-    0x0382aa20, 0x70828020, 0x0100ff22, 0x5527738e, 0xab2b2a56, 0x82552b2b,
-    0x2dd182c1, 0x8001ba01, 0x1d001400, 0x00002600, 0xc85b3201, 0x16142605,
-    0x17373617, 0x05135d06, 0x1a5a2720, 0x07c14208, 0x32600135, 0x261b1827,
-    0x29363629, 0x25191921, 0x025a442e, 0x5d9c5a02, 0xb942061a, 0x1b553706,
-    0x3601193e, 0x01013652, 0x01163d13, 0x44445a02, 0x24012c5b, 0x02822436,
-    0x08edbc18, 0x82000321, 0xab012d00, 0x09008001, 0x1b001200, 0x11370000,
-    0xd683da82, 0x825d1520, 0x09364308, 0x6a80c024, 0x648cab6a, 0x40011522,
-    0x80220082, 0x588e6b01, 0x0805f741, 0x56019626, 0x00000b00, 0x37153313,
-    0x23170733, 0x23150727, 0x556b4095, 0x4d4d6d6d, 0x55014026, 0xc57b8080,
-    0x00682a92, 0x03200082, 0x2d08e74b, 0x001f0014, 0x0100002a, 0x0e171632,
-    0x04831401, 0x27262225, 0x8334013e, 0x14172b04, 0x012e0706, 0x1e373634,
-    0x05840501, 0x012d0f84, 0x1c472800, 0x23282823, 0x4650471c, 0x2c08831d,
-    0x17fd461d, 0x21211c16, 0xfe17161c, 0x2a098756, 0x181b9501, 0x5362531e,
-    0x881b181e, 0x25d52b08, 0x43181b43, 0x1b184350, 0x0a892543, 0x83828f85,
-    0x8001d62b, 0x11000a00, 0x00001400, 0x848a8213, 0x0e33087a, 0x33350301,
-    0x1533011b, 0x55330727, 0x241c0a0c, 0x0c0a1c24, 0x9a9a3b2a, 0xd66bd53b,
-    0x21134001, 0x3624010c, 0x210c0124, 0x012badfe, 0x2bd1fe2f, 0x1800d1fc,
-    0x582d03f5, 0x0c24059b, 0x2d001c00, 0x1e257782, 0x14011d01, 0x055e5506,
-    0x0cfdc018, 0x3f363226, 0x23370701, 0x3b231985, 0x82163201, 0xab250827,
-    0x24181812, 0x01921919, 0x2e2b2e3c, 0x012a013b, 0x01304930, 0x59165bc9,
-    0x12191912, 0x01181280, 0x1218012b, 0x8324826b, 0x30953204, 0x2c2c0945,
-    0x24304509, 0x62243030, 0x12184e5a, 0x21198356, 0x13761256, 0x01d62208,
-    0x20858696, 0x05b15937, 0x3523152e, 0x3327012e, 0x3e17011e, 0x15273701,
-    0x05209785, 0x2b28858f, 0x1b65011b, 0x1f310d73, 0x25248386, 0x28092c1d,
-    0x01219782, 0x28898a49, 0x9bfe1b50, 0x241c721b, 0x25828606, 0x1c210101,
-    0x80831027, 0x8d036521, 0x8205208b, 0x0026088f, 0x8001c001, 0x09000300,
-    0x13000f00, 0x00001a00, 0x3537013b, 0x3d363207, 0x22010701, 0x37011d06,
-    0x37150733, 0x98820117, 0xc626012a, 0x122bbd3d, 0x00ff5519, 0x68340482,
-    0xfe66fabd, 0x0b1003a2, 0xbd085f01, 0x1219fa3d, 0x8001552a, 0x0c820583,
-    0xa2fe0228, 0x0103100b, 0x7f42175e, 0x82eb2008, 0x002128ef, 0x00340024,
-    0x69333700, 0x3421057f, 0x055a4136, 0x52353321, 0x6b1805b1, 0x36390870,
-    0x27071737, 0x1d163221, 0x35232601, 0x07221521, 0x55363435, 0x0118122b,
-    0x255e8215, 0x01151912, 0x0d821218, 0x2afe1633, 0x55a81816, 0x56019655,
-    0x17131812, 0x1317aafe, 0x227f8318, 0x8219122a, 0x21058526, 0x07824040,
-    0x4040ab2d, 0xcc1218ea, 0x0cc0c00c, 0x821812cc, 0x002a08e7, 0xdc01e4ff,
-    0x0a00a101, 0x18000e00, 0x2a002200, 0x30002d00, 0x36003300, 0x0e130000,
-    0x17161401, 0x3e27012e, 0x01170501, 0x545b1327, 0x010f2107, 0x08085e5b,
-    0x010e1753, 0x37272207, 0x07370716, 0x2f17013f, 0x17051701, 0x231da007,
-    0x42331e23, 0x01420101, 0xb4fe1e29, 0x1e20c81e, 0x0d251e09, 0x3b1d250e,
-    0x17071819, 0x1d0a0a1d, 0x4201d116, 0xa51e2832, 0x063c5e16, 0x2f2f1827,
-    0xf2fe4718, 0x9501363c, 0x3d4c3d12, 0x221a8212, 0x831f4232, 0x01280839,
-    0x24151418, 0x23240217, 0x10711801, 0x02111d11, 0x13011b1c, 0x01423270,
-    0xb41ea516, 0x3b684718, 0x053b6536, 0x002f18c1, 0x2906334a, 0x0096016b,
-    0x00200012, 0xbf582500, 0x013e2b09, 0x15171632, 0x1527011e, 0xb118010e,
-    0xb5680948, 0x14162508, 0x24362401, 0x7f20e782, 0x6808a962, 0x1b2c069b,
-    0x1caa0f2c, 0xaa1c2424, 0x83a52c0f, 0x09bd5d18, 0x4e008321, 0xc0200543,
-    0x03356b82, 0x0c000700, 0x24001100, 0x36003200, 0x3f003a00, 0x00004400,
-    0x07d84401, 0x27260782, 0x34231517, 0x8d9f0727, 0x23152723, 0x82298235,
-    0x23072a03, 0x06331535, 0x6b012315, 0x25008355, 0x2b551045, 0x5d622406,
-    0x20aa9206, 0x31248380, 0x06314510, 0x2b80012b, 0x2a2b2b2a, 0x172b3e13,
-    0x5c692b14, 0x2cc09705, 0x552b2b6b, 0x17562b2b, 0x14552a13, 0x08675417,
-    0x39059752, 0x2500001c, 0x022b1133, 0x010f0622, 0x1e011d06, 0x07013b01,
-    0x1f141514, 0x48573701, 0x952c0805, 0xc0555656, 0x4105150d, 0x12180103,
-    0x17091587, 0x01010c8c, 0x00018018, 0x08960c0e, 0x18122b08, 0x0e030362,
-    0x0c8d1709, 0x1813d512, 0x2106ef42, 0x5b8501d5, 0x22001b22, 0x11275d82,
-    0x32031133, 0x82151716, 0x27240860, 0x37013d26, 0x27262223, 0x013f3435,
-    0x1733013e, 0x33150723, 0x95013707, 0x1812ab56, 0x8c0c0101, 0x87150917,
-    0x032a0982, 0x0d150541, 0xbb3fc1c0, 0x69825d18, 0x0100ff3b, 0xd5121900,
-    0x178d0c12, 0x62060e09, 0x082b1218, 0x0e0c9608, 0x712b952b, 0x08b3475d,
-    0x1800ab23, 0x2ecb8300, 0x012b012e, 0x34353437, 0x0607012f, 0x821e1507,
-    0x363229ce, 0x3536013f, 0x23113305, 0xc38a9682, 0xd6851220, 0x562afe24,
-    0xc683eb56, 0x850d0421, 0x191221c6, 0xc021da84, 0x6ecd8201, 0xab23092f,
-    0x84000300, 0x111324cf, 0x83131123, 0x255682c2, 0x011d1617, 0xdc833307,
-    0x010f142d, 0x2723010e, 0x23353733, 0x966b0737, 0x19bc24ce, 0x8300015d,
-    0x88ff20cd, 0x070d21cf, 0xff20cf91, 0x26056760, 0x002f0017, 0x41232500,
-    0x14310698, 0x07013b16, 0x011f1615, 0x013d3637, 0x34272634, 0x21e78226,
-    0xe6832635, 0x14011d25, 0x85331716, 0xe00132e6, 0x03100a90, 0x090c0231,
-    0x06010f6f, 0x12096a11, 0x200a89ee, 0x341b850e, 0x71090beb, 0x091b0605,
-    0x0a05440c, 0x09691107, 0x120d8b0e, 0x200d8c56, 0x5f218401, 0x6b24080f,
-    0x26000900, 0x240b635f, 0x37363437, 0x2a848235, 0x1d010e21, 0x14011e01,
-    0x4e150706, 0x3d310507, 0x01012e01, 0x174c4c4c, 0x21215b47, 0x1876475b,
-    0x05284f12, 0x83181221, 0x56012109, 0x182f0e82, 0x5731315a, 0x5454053a,
-    0x120f3a05, 0x82550118, 0x18012603, 0x18015512, 0x200c8b24, 0x053f4800,
-    0x6b01d626, 0x24001c00, 0x22059f50, 0x4f151716, 0x3e21079f, 0x207d8201,
-    0x21858235, 0x81821e21, 0x07010e25, 0x8222012e, 0x27332184, 0x21071c4d,
-    0x7a93ab01, 0x42034b2e, 0xc0034236, 0x1b1b1460, 0xc01b1b28, 0x6d217e99,
-    0x24008218, 0x291b6610, 0x6a02821b, 0x2727101b, 0x23010000, 0x86153335,
-    0x190a4103, 0x01363424, 0x00842a15, 0x0741c020, 0x01182411, 0x828a2a0b,
-    0x41762001, 0x24221602, 0x00820018, 0x00012208, 0x01eaff00, 0x00960180,
-    0x13000006, 0x37170717, 0x55803727, 0x406b6b40, 0x55950155, 0xeb6a6aeb,
-    0x0abf4c55, 0x17000b24, 0xe14e2200, 0x0bb2640d, 0x012e072b, 0x16071523,
-    0x34363732, 0x34651801, 0x13012817, 0x275a192e, 0x18262766, 0x2818c764,
-    0x80131379, 0x2726265a, 0x219e8266, 0x9f840400, 0xab01c024, 0xb9790b00,
-    0x67931806, 0x3713230c, 0x75832726, 0x2208044c, 0x58072634, 0x3322056a,
-    0xf74b0001, 0x1e56240a, 0x181e100e, 0x33083b82, 0x16026c52, 0x552a2abf,
-    0x02158080, 0x543f4054, 0x3f540202, 0x0b292c82, 0x1f0e101f, 0x6d021714,
-    0x29208251, 0x22526c02, 0x9680753d, 0x8383002b, 0x0200002c, 0x00430101,
-    0x00280013, 0x9882005f, 0x0e14253c, 0x022e2202, 0x3e34013d, 0x021e3202,
-    0x012e3715, 0x1d020e22, 0x021e1401, 0x16833e32, 0x2e172626, 0x032e2702,
-    0x33231e86, 0x82022e34, 0x261d821f, 0x15031e17, 0x82230614, 0x2335213b,
-    0x34322c85, 0x15371525, 0x01231133, 0x0f0a0513, 0x050b0f14, 0x06820b05,
-    0x050a6008, 0x251f0b14, 0x0c0c151f, 0x1e261e16, 0xc90b0b16, 0x10191204,
-    0x04080f0c, 0x0f0c0804, 0x2a04080d, 0x221b140a, 0x0a0a131a, 0x0c0f1911,
-    0x11030810, 0x0b0d0611, 0x140a2907, 0x141c231e, 0x4000fe0a, 0x13a6062b,
-    0x0707111b, 0x35131b11, 0x07101a14, 0x131a1007, 0x0b0b0d4e, 0x291e291b,
-    0x821b2a1e, 0x822a2008, 0x29360808, 0x090e098f, 0x06050204, 0x06090907,
-    0x0a080504, 0x10160c05, 0x150f0909, 0x090e1117, 0x07060303, 0x0c0a0507,
-    0x080c0703, 0x0b11160b, 0x19140f08, 0xcd162497, 0xbb430001, 0x01c32906,
-    0x00360043, 0x25000072, 0x0420ed83, 0x93050b41, 0x872720ec, 0x2e2726ec,
-    0x033e2701, 0x050f4127, 0x34331532, 0x3233023e, 0x0e140716, 0x15012b02,
-    0x021e3233, 0x290e1c41, 0x01263435, 0x1a1105bd, 0x8d820b10, 0xfa870120,
-    0x87130b21, 0x0d0e2cfa, 0x1103090f, 0x0a0e0710, 0x86280107, 0xca3108fb,
-    0x090b1105, 0x01050a0f, 0x241d160b, 0x2a0c151e, 0x090e0a06, 0x05011413,
-    0x190b100b, 0x0c120a1a, 0x09141606, 0x2b060b0f, 0x231e170e, 0x040c171f,
-    0x2e02418d, 0x08272208, 0x0c05040c, 0x1207100f, 0x0a09121b, 0x080f1913,
-    0x1405090d, 0x0a0e0912, 0x0a052106, 0x15140a10, 0x2a718205, 0x0a111b12,
-    0x121c130a, 0x82001109, 0x00052100, 0x3605ab69, 0x000700ab, 0x00180014,
-    0x0032001c, 0x012e2500, 0x17373427, 0x5a070306, 0x32370591, 0x2f371737,
-    0x23351701, 0x33152337, 0x012e0717, 0x17070623, 0x5b1e3736, 0x28080694,
-    0x37272634, 0x54400001, 0x21cc1401, 0x1f3b1bea, 0x526c0201, 0x1b352f3c,
-    0x2a2a2ba5, 0x56808055, 0x223d191e, 0x221f2f3b, 0x08228329, 0x011f1f33,
-    0x151e1416, 0x29405402, 0x0114cb21, 0x2f3b1b55, 0x026c523b, 0xa51b3620,
-    0x96492b62, 0x131e212b, 0x1f1f0117, 0x54020113, 0x1f212a3f, 0x3d223c2e,
-    0x8b5a1818, 0x01802808, 0x00090096, 0x8213000e, 0x13003fa9, 0x17071521,
-    0x37352115, 0x07271727, 0x37273315, 0x37152335, 0x27071533, 0x55000180,
-    0x0382ff55, 0x5555d523, 0x270282aa, 0x2b2b562a, 0x55809501, 0x552d8b82,
-    0x5555b555, 0x4b55b64b, 0x2b10204b, 0x20ff822b, 0x08274d07, 0x1b000534,
-    0x24002000, 0x2d002800, 0x00003900, 0x17153325, 0xaa572707, 0x011e2905,
-    0x07010e15, 0x23272622, 0x2905ef59, 0x26331513, 0x35332735, 0x72820523,
-    0x36330724, 0xed4f2337, 0x012c080b, 0x1034202b, 0x2b01d644, 0x14011812,
-    0x40540116, 0x8215351f, 0x12181812, 0x80560e64, 0x802b0180, 0x1b0b5cab,
-    0x3a2ceb82, 0x2c3a0101, 0xc0340584, 0x271c1e3c, 0x12182401, 0x1f351582,
-    0x16015440, 0x12180114, 0xfe263f83, 0x231d40eb, 0x00824095, 0x1b256a23,
-    0x822e8704, 0x08a34634, 0x0b002b24, 0x7c181300, 0xd14d0d1f, 0x15332305,
-    0x1e496b01, 0x3c2e2505, 0xe83c0101, 0x7c828083, 0x2a066249, 0x3d2d2d3d,
-    0x24180195, 0x47560118, 0xb08207eb, 0x1c254b84, 0x1e130000, 0x4bd08301,
-    0x23260510, 0x011e3335, 0x556c0614, 0x84952008, 0x842e204f, 0x4301235b,
-    0x58828080, 0x1bd8fe29, 0x24372424, 0x8b2b0124, 0x8356205e, 0x016a215f,
-    0x2005204f, 0x08d34500, 0x9601d624, 0x53181200, 0x2b2409d3, 0x23270701,
-    0x21058458, 0x2f4d0155, 0x55552105, 0x01290783, 0xff121895, 0x55191200,
-    0x05dc5855, 0x6766a784, 0x00122206, 0x05875b16, 0x205b3220, 0x2c438806,
-    0x07233501, 0x36373323, 0x0f26012f, 0x2b508e01, 0x602b753d, 0x07079235,
-    0x93070825, 0xff2a5d8f, 0x932b2b00, 0x06260708, 0x57469306, 0x0012240a,
-    0x94200017, 0x350125ab, 0x35072707, 0x8e073d50, 0x55522368, 0x384e802b,
-    0x2a668f05, 0x56abebfe, 0x18d5802b, 0x46191924, 0xcf6705e7, 0x00122209,
-    0x26699419, 0x17331117, 0x8d113337, 0x67122462, 0x8f674444, 0xff2a255c,
-    0x01444400, 0x220d2741, 0x9b250019, 0x58072055, 0x61920adb, 0x402ac023,
-    0x96028240, 0x402b2468, 0x1840402b, 0x250c07d1, 0x00160012, 0x8718001a,
-    0xdd410aab, 0x1517280a, 0x15053521, 0x82073533, 0x286a8d07, 0xfe2a0128,
-    0x01d5d5d6, 0x25678f00, 0x552a2a40, 0x02822b2b, 0x2b570020, 0x001d220a,
-    0x3dd18241, 0x1415010e, 0x011e1716, 0x37263617, 0x3e170616, 0x013e3701,
-    0x27263435, 0x2e07010e, 0x4f4f0701, 0x05c54205, 0x22231182, 0x83363526,
-    0x7a17201a, 0x220805ee, 0x3e27012e, 0x3a309501, 0x2610101a, 0x18044120,
-    0x20410418, 0x1a101026, 0x212d303a, 0x2d211d1d, 0x821f2d1f, 0x1b280802,
-    0x16010124, 0x09220e10, 0x1b010704, 0x011b2626, 0x22090407, 0x0116100e,
-    0x95012401, 0x23324c02, 0x8a18124b, 0x09830908, 0x08310282, 0x4b12188a,
-    0x024c3223, 0x01011301, 0x12022913, 0x39028302, 0x3e1d2232, 0x07761511,
-    0x3e22151d, 0x223e0202, 0x76071d15, 0x1d3e1115, 0xa3413222, 0x01e82f05,
-    0x00960180, 0x001a000c, 0x2500003e, 0xb6820622, 0x2e353729, 0x33363401,
-    0x82260615, 0x351721a2, 0x03201385, 0x3327de82, 0x013e0706, 0x86010e33,
-    0x06172105, 0x0e22fb83, 0x28842701, 0x36377708, 0x12000127, 0x3804022c,
-    0x0c0c0904, 0x054b0509, 0x15133f03, 0x5d070551, 0x08192907, 0x050e0119,
-    0x13023616, 0x331b091c, 0x042a2b02, 0x1007010b, 0x5904054e, 0x04662727,
-    0x01146206, 0x101a9508, 0x15010d1f, 0x0c120c01, 0x1f170155, 0x1b01222f,
-    0x1a3e3030, 0x0b150102, 0x15212f27, 0x27132e28, 0x1d201b11, 0x10020e44,
-    0x442e1a0d, 0x02013948, 0x2f4c4f33, 0x5f72081c, 0x00002905, 0x8001ab01,
-    0x11000800, 0x4820c982, 0x22210d82, 0x05295926, 0x5508b664, 0x372408ad,
-    0x013e3523, 0x2e230482, 0x82012b01, 0x231524db, 0x8a17011e, 0x05b64c04,
-    0x23853720, 0x82013e21, 0x181824d3, 0x18181824, 0x2b0da06b, 0x231c4099,
-    0x0c014001, 0x0c09aa09, 0x23230782, 0x8501401c, 0x83128603, 0x2103821d,
-    0x39821900, 0x6b192423, 0x25418301, 0x186b1824, 0x02821825, 0x0818c02f,
-    0x09161e2c, 0x16090c0c, 0x18082c1e, 0x2303821f, 0x19072d1e, 0x19231083,
-    0x821e2d07, 0x6500201d, 0x16210b87, 0x052d5b00, 0xd5823020, 0x24086d65,
-    0x17333733, 0x07716533, 0x165a0320, 0x24d58207, 0x33351733, 0x2df48815,
-    0x65430001, 0x202a0103, 0x512a3020, 0x7a652b2a, 0x65a92005, 0x3d230591,
-    0x652a6b6b, 0x012107a7, 0x07796595, 0x652b2b21, 0xfe21067b, 0x06335abe,
-    0x82559521, 0x86962000, 0x0533420c, 0x9601ea39, 0x1e009601, 0x2b002700,
-    0x35250000, 0x3723012e, 0x15233533, 0x4c220733, 0x0721058c, 0x229e8615,
-    0x88013e23, 0x2f9b838a, 0x47019501, 0xd6461038, 0x4b341066, 0x22172001,
-    0x02239585, 0x85951c1b, 0xd65d2793, 0x2bb457d6, 0x0082201f, 0xb42b1f2e,
-    0x22062218, 0x0a2a2a0a, 0x06250120, 0x5f227f86, 0x0082006b, 0x03820320,
-    0xd601002a, 0x0f005601, 0x1c001300, 0x2009bd68, 0x05375321, 0x80453320,
-    0x9072180c, 0x12182309, 0x7e452b01, 0x0aa65d0b, 0x220b7a45, 0x18000400,
-    0x4509b3fc, 0x052706e5, 0x32133327, 0x5c011d16, 0x648e09a4, 0xaa550025,
-    0x5c181256, 0x678b089a, 0x0c192b20, 0x6b840efc, 0x25080726, 0x00920707,
-    0x00306b83, 0x01db0100, 0x0003005b, 0x000b0007, 0x1300000e, 0x20068756,
-    0x30078237, 0x40171117, 0x2b552b2b, 0x2a2a562b, 0x15019b55, 0x240083aa,
-    0x9b360146, 0x20008200, 0x2b048401, 0x008001ab, 0x33000019, 0x2e230635,
-    0x07294018, 0x33171622, 0x08057844, 0x15272221, 0x29110feb, 0x081d0136,
-    0x19293601, 0x32050d2a, 0x42020242, 0x5b101032, 0x53360106, 0x8214121b,
-    0x1417291b, 0x32324201, 0x6f040142, 0x270bb745, 0x001f000f, 0x0100002f,
-    0x0e8f5c18, 0x06140325, 0x792e2307, 0x15250806, 0x2b061417, 0x09af5401,
-    0xa001152a, 0x1e17c0fe, 0x4001171e, 0xd3260582, 0x0b4f0b0e, 0x04820f0f,
-    0x84ba0e21, 0x230f8405, 0x171e9501, 0xfe282489, 0x010e0bbc, 0xf30b0e01,
-    0x88202883, 0xdf880488, 0x4001d62d, 0x00000a00, 0x07273725, 0x82173727,
-    0x01152c01, 0x55683155, 0x55801e9e, 0x88403186, 0x18802009, 0x2209cf6f,
-    0x82060016, 0x1527222f, 0x2b018221, 0xfe55d501, 0xc04001c0, 0x402a4055,
-    0x00215282, 0x86048401, 0x17012453, 0x83072707, 0x35172152, 0x0120538a,
-    0x2f85548b, 0x9601eb2e, 0x00000200, 0x15032133, 0x01ebd601, 0x08336518,
-    0x052b1785, 0x03010000, 0x21130321, 0x82eb0001, 0xfea12a1e, 0xfe9501be,
-    0xfe40016b, 0x0b4f41eb, 0x28002424, 0x29822c00, 0x06222327, 0x012e2307,
-    0x05205a2b, 0x17011e24, 0x03820e15, 0x35332808, 0x35272636, 0x3337013e,
-    0x013d3632, 0x15333505, 0x33352321, 0x0f2faf01, 0x01aa011b, 0x1a550f1b,
-    0x30062f10, 0x821e2331, 0x1e2d080d, 0x06303123, 0xfe1a102f, 0x2b012b80,
-    0x95012b2b, 0x1a10101a, 0x211a10c0, 0x042c062f, 0x0606151f, 0x2c041f15,
-    0x1a212f06, 0x96c0c010, 0x23b98496, 0x9e01e8ff, 0x0926c382, 0x00001800,
-    0x51541725, 0x23360808, 0x15072735, 0x1d010e23, 0x34353301, 0x1e440126,
-    0x5a1e6262, 0x732b2b73, 0x15151673, 0xaa181216, 0x5171dc18, 0x074a6f51,
-    0xfb076a6a, 0x42151542, 0x15121801, 0x44821215, 0x00000422, 0x61060749,
-    0x332805d1, 0x15130000, 0x013b1614, 0xf486d095, 0x33072324, 0x2d7f2315,
-    0x06162506, 0x2b372622, 0x5520d692, 0xda83f286, 0xd5280382, 0x6a2202aa,
-    0x95010222, 0xfb83e195, 0x96962a29, 0x20756b96, 0x49202a2a, 0x474b0a37,
-    0x01002105, 0x99054164, 0x096b419a, 0xd6442b08, 0x45101a6a, 0x2e262605,
-    0x02aa0214, 0x25282e14, 0x1a104504, 0x014080fe, 0x01404016, 0x962a2a6b,
-    0x2e201a10, 0x1f042c06, 0x63410815, 0x202e2905, 0x9698101a, 0x006b6b6b,
-    0x2b090f41, 0x0028001f, 0x0030002c, 0x23151300, 0x2a1b1141, 0x15330735,
-    0x2e07010e, 0x41273501, 0x95200614, 0x6a287e93, 0x240180ab, 0x6b20201b,
-    0x86838282, 0x85969520, 0xab2a2a22, 0x20054060, 0x838e8380, 0x00002e8f,
-    0x6b01eb01, 0x0c000800, 0x2b001500, 0x034e1800, 0x2317220a, 0x08974535,
-    0x35232523, 0x26868221, 0x011e3315, 0x86373632, 0x01352205, 0x05914580,
-    0x5f2a1223, 0x2d0985eb, 0xfe401d01, 0x011812d5, 0x3624012b, 0x93820124,
-    0x2b210582, 0x06974535, 0x3535bf23, 0x290a86c0, 0x180156df, 0x241beb12,
-    0x03831b24, 0x46006b21, 0x8b8308cb, 0x1c00152b, 0x29002000, 0x00003200,
-    0x20749113, 0x2a968227, 0x23350717, 0x33173335, 0x6f072317, 0x21200736,
-    0x40200887, 0x40287e8f, 0x56569640, 0x35968080, 0x0e20a589, 0x6b20ad86,
-    0x5529858c, 0x56552b56, 0x350b2b40, 0x0b555d4b, 0xc34c9a82, 0x01e83706,
-    0x00210080, 0x21000033, 0x27262223, 0x22060735, 0x3426012f, 0x0e41013f,
-    0x5f172006, 0x15270776, 0x2737010e, 0x83060706, 0x17072525, 0x33153337,
-    0x0136ab82, 0x0c09aa55, 0x11071b01, 0x06063d06, 0x2401237e, 0x23012436,
-    0x0d82067e, 0x07112408, 0x560c011b, 0x1b0e0a5c, 0x0f2e1b25, 0x15401f5c,
-    0x0c401580, 0x0617aa09, 0x11073c06, 0x18127d07, 0x827d1218, 0x063c2308,
-    0x43821706, 0x0b5bf42e, 0x10141108, 0xd52b1f5b, 0x00002bd5, 0x22209b8a,
-    0x14249b93, 0x013e1716, 0x9c8c7f82, 0x07010e25, 0x9727012e, 0x8220209b,
-    0x259a8c00, 0x1f1f2811, 0x99911128, 0x15331325, 0x8c133315, 0x291b259b,
-    0x1b291010, 0x012d9c87, 0xfeff0000, 0x80016b01, 0x00001400, 0x05e84225,
-    0x7a821520, 0x35372908, 0x013e3523, 0x33153337, 0x0d566b01, 0x353d3613,
-    0x3036012f, 0x56350219, 0x110f60d5, 0x35010155, 0x06567a26, 0x00551a35,
-    0xff3ddf84, 0x01b001fa, 0x000b0086, 0x3f000017, 0x35331501, 0x010e1537,
-    0x0115012b, 0x15233507, 0x2c498207, 0x5035013b, 0x012bd55b, 0x01d51218,
-    0x2a088605, 0x60455b55, 0x19128a2a, 0x87300145, 0x0a7f4309, 0x11000924,
-    0xc74c1500, 0x113c0805, 0x23072307, 0x05112335, 0x33112135, 0x27333715,
-    0x27231533, 0x55352315, 0x566a8001, 0x016a4040, 0x40d5fe80, 0x2b2b6b40,
-    0x012b402b, 0x6a00ff95, 0x15014040, 0x00ffc095, 0x6bc04040, 0x00210082,
-    0x062f4600, 0x6b01e024, 0x0c822e00, 0x36070636, 0x26070637, 0x07010e27,
-    0x012e1714, 0x16140627, 0x15272617, 0x06280582, 0x1e272223, 0x010e1701,
-    0x5c080784, 0x37013e33, 0xdf013627, 0x0b1d1b19, 0x2a1a1f1b, 0x03013426,
-    0x0c22613a, 0x12171216, 0x0d0b2029, 0x2e090809, 0x203a171e, 0x471e0b0b,
-    0x01857f27, 0x40011b01, 0x2112040b, 0x011c0610, 0x0b273401, 0x2a32040a,
-    0x0c283115, 0x22010a01, 0x02030731, 0x1301231c, 0x16130114, 0x0c5fa005,
-    0x4b971814, 0x1833200c, 0x20119962, 0x867c8205, 0x840620a8, 0x82a383a4,
-    0x2706229b, 0x829f8216, 0x3e3721a5, 0x0c826618, 0x21012408, 0x0d040f08,
-    0x10081011, 0x064b1d15, 0x0b153829, 0x0a0e0f0d, 0x0c131801, 0x0f290b0c,
-    0x2c12162e, 0x6b55481d, 0x23080d64, 0x08100687, 0x150b0207, 0x231d040a,
-    0x1721032e, 0x01092e15, 0x061b1806, 0x05230203, 0x0c030e0c, 0x5b04010f,
-    0x250b2f4d, 0x002f0023, 0x97a22500, 0x0b086e18, 0xa27a0121, 0x76782097,
-    0xf9200a5b, 0xe72095a2, 0x840ccd79, 0x000025a3, 0x4601db01, 0x08058342,
-    0x23171322, 0x23173315, 0x013d2622, 0x33270523, 0x33272335, 0x011d1632,
-    0x465b8033, 0x12b62b8b, 0x5b014618, 0x45270988, 0x192b805a, 0x85b08012,
-    0x0cc75106, 0x14000b2c, 0x34002400, 0x4d004400, 0x215b5600, 0x011e3a0b,
-    0x013e1623, 0x010e012e, 0x27220716, 0x32331607, 0x17013e37, 0x0e233736,
-    0x08fa8301, 0x27263320, 0x26272606, 0x17072223, 0x36340736, 0x07062737,
-    0x1e071416, 0x2e371701, 0x010e1701, 0x3b83011e, 0x085ea718, 0x8ad50121,
-    0xa12908cc, 0x050b130a, 0x060b1413, 0x120e112c, 0x0e101a17, 0x1d101e03,
-    0x29032504, 0x03291f1f, 0x101d0425, 0x100e031e, 0x0e12171a, 0x3a1f8239,
-    0x0c0c0b23, 0x12111805, 0x097f110e, 0x13140b06, 0xc1130b05, 0x160e0e0b,
-    0x41c00e0e, 0x2d080a4f, 0x13130505, 0x1314040b, 0x0b2007ac, 0x05111004,
-    0x261d2c1c, 0x1d260195, 0x11051c2c, 0x200b0410, 0x20134b07, 0x2918200a,
-    0x140b220b, 0x0a820c21, 0x13064822, 0x13234a83, 0x83017005, 0x0e16214b,
-    0x2f096375, 0x00170080, 0x13000023, 0x17160627, 0x3632011e, 0x2720f682,
-    0x0723d882, 0x8222010e, 0x373621f0, 0xba44e382, 0x3e200805, 0x0b1eb701,
-    0x44141202, 0x12134608, 0x031f0b03, 0x29101b0b, 0x1a102804, 0x6c524b0b,
-    0x526c0202, 0x01370584, 0x4e350409, 0x07071115, 0x354e1511, 0x13680704,
-    0x06030306, 0x877e6813, 0x2225821f, 0x6b010000, 0x1620087f, 0x61820c82,
-    0x14152323, 0x246e8206, 0x14153335, 0x25828216, 0x013e2335, 0x4f820001,
-    0x3724ab2e, 0x0c2b0124, 0xab010c12, 0x95016c02, 0xaa2d4482, 0x1c24241c,
-    0x0c091515, 0x52aa090c, 0x083b5f6c, 0x9601c026, 0x1d000600, 0xac824d82,
-    0x012e2123, 0x27549727, 0x010f4d33, 0x324e0f1e, 0x6b265c90, 0x30303a01,
-    0x62932b3a, 0x22086b44, 0x8210002b, 0x06222961, 0x33152707, 0x33013e27,
-    0x3f05ff41, 0x4b2b0b01, 0x4ec04c1e, 0x39203717, 0x17321257, 0x1d150172,
-    0x4dc04d1a, 0x40011513, 0x54451034, 0x22076b41, 0x448b01ab, 0x6b7805ff,
-    0x35233406, 0x34013e33, 0x17232726, 0x17372707, 0x1533010f, 0x18200123,
-    0x212c4476, 0x00820002, 0x0162013c, 0x0005006b, 0x0100000b, 0x07270727,
-    0x37170717, 0x01273717, 0x44441e62, 0x0585621e, 0x844d0121, 0x84b8200c,
-    0x08bf4605, 0x80016222, 0x25203785, 0x37223582, 0x3582012f, 0x01170723,
-    0x22358800, 0x843c1e62, 0x84c4200b, 0x82002005, 0x4a042000, 0x1f29085b,
-    0x3f002f00, 0x00004700, 0xc3861813, 0x5d352008, 0x352206f1, 0xd9821523,
-    0x05200587, 0x366d0882, 0x21288405, 0x0f822735, 0x83152321, 0x2324820b,
-    0x07353315, 0x35310c82, 0x2b233533, 0x16569555, 0x1515552b, 0x15558055,
-    0x36078240, 0x162b5501, 0x80152a56, 0x15958015, 0x55154015, 0x2a152b2b,
-    0x82012b16, 0x8255200c, 0x8224820d, 0x56162512, 0x2a158095, 0x15263782,
-    0x15808015, 0x40839515, 0x2b804024, 0xab822a16, 0x39058b4e, 0x007301d9,
-    0x00390025, 0x0100004d, 0x1417011e, 0x0616010e, 0x0706010f, 0x0583010e,
-    0x022e0628, 0x013e013f, 0x05823637, 0x3634032d, 0x07170716, 0x012f2627,
-    0x8234012e, 0x36570811, 0x1e143217, 0x0e161302, 0x26012f02, 0x2f012e27,
-    0x1e173701, 0x16011f01, 0x0a013301, 0x01020501, 0x171a0303, 0x01040208,
-    0x080a2f37, 0x060f2124, 0x061c036f, 0x0229220b, 0x03010401, 0x1f13450a,
-    0x01020311, 0x07060501, 0x02050706, 0xef010302, 0x22211305, 0x82303807,
-    0x01022c32, 0x1c071822, 0x012f3804, 0x8209016b, 0x0247081c, 0x35030204,
-    0x1e080e2d, 0x0d424f05, 0x1e180809, 0x0e039e09, 0x2b240d05, 0x02010304,
-    0x0f020105, 0x04212114, 0x01010601, 0x03060903, 0x03050103, 0xedfe0301,
-    0x04171f0b, 0x0c434f08, 0x01081f04, 0x0e051b42, 0x82434e03, 0x068346f6,
-    0x0805e774, 0x00000a2a, 0x37233537, 0x07152317, 0xc0152135, 0x55959555,
-    0x6b2a01d5, 0x80959580, 0x002b2b56, 0x00000100, 0x9601e6ff, 0x3000ab01,
-    0x15270c82, 0x35231533, 0x83072733, 0x793e2006, 0x14230a05, 0x60013b16,
-    0x332c0c36, 0x013d3632, 0x40013533, 0x402b4015, 0x0b2f0282, 0x1a281b0e,
-    0x0b0e0101, 0x0c401219, 0x821a010e, 0x0c0e3e0c, 0x15191240, 0x2a562b01,
-    0xaa5656aa, 0x0e15062c, 0x141a1a14, 0x2c06150e, 0x06411912, 0x250d8516,
-    0x19410616, 0x63562a12, 0xeaff2305, 0x8782d601, 0x13000f25, 0x4a002600,
-    0xf0510583, 0x013d2305, 0x93842634, 0x9f842520, 0xbe5e2320, 0x20168406,
-    0x05275d40, 0x1812eb2d, 0xebeb1218, 0x2b4001eb, 0x82012beb, 0x210f830a,
-    0x0987ab01, 0x01231e82, 0x8296eb2b, 0x842b201b, 0x62348228, 0x738a0883,
-    0x2b7f0520, 0x07641805, 0x37332607, 0x05333523, 0x05a54235, 0x23238282,
-    0x8207010e, 0x5033207b, 0x538305b5, 0xeb265f83, 0x2bc0feeb, 0x73842aeb,
-    0x10820120, 0x09881520, 0x2a252182, 0xeb2a95eb, 0x8374822b, 0x210f8219,
-    0x3f430600, 0x00172208, 0xf15a181b, 0x13002108, 0x36175969, 0x07231533,
-    0x16353315, 0x33152317, 0x23350706, 0x33272615, 0x4d362335, 0x078307ab,
-    0x3625c02c, 0x0e2c2b0f, 0x25802536, 0x08840e37, 0x2a2a5527, 0x1526802b,
-    0x85028226, 0x2b452b06, 0x2b2b012b, 0x2a2a952b, 0x298c9501, 0x3b838020,
-    0x052b2a22, 0x26282a89, 0x2a512680, 0x2b6b2a2a, 0x2d09f757, 0x000e0080,
-    0x00210012, 0x2e230100, 0xb25c2701, 0x27332608, 0x07352315, 0x2314840e,
-    0x3237013e, 0x012ea383, 0x62152bd5, 0x026d513e, 0x3e516d02, 0x87821662,
-    0x48130423, 0x05a95c2c, 0x13482c28, 0x3a000127, 0x08460145, 0x45012205,
-    0x2ba7823a, 0x012e2755, 0x553f4054, 0x80272e01, 0x280b5f44, 0x001900ab,
-    0x00260022, 0x0a09422f, 0x210bf741, 0x13423523, 0x6f8e8206, 0x3320060e,
-    0x33238e82, 0x42353632, 0x55200612, 0x2e07fc41, 0xeb121856, 0x18126beb,
-    0x6b805501, 0x8456956b, 0x0619420a, 0x0d425620, 0x82552007, 0x832b201e,
-    0x826b2031, 0x82eb2000, 0x2c8b8331, 0xff000002, 0x01eb01d5, 0x00380096,
-    0x30fd8241, 0x06141632, 0x07272207, 0x33013e17, 0x22271517, 0x82fc8206,
-    0x17152a02, 0x36342723, 0x16072737, 0x05107e15, 0x17323329, 0x3e272637,
-    0x82163701, 0x35460807, 0x22073634, 0x32161406, 0x01263436, 0x12120d8b,
-    0x4f06080d, 0x2c502407, 0x4c291616, 0x23300120, 0x2b011715, 0x0a141701,
-    0x1201044f, 0x0e12121b, 0x114e0707, 0x25300101, 0x034f161e, 0x19129212,
-    0x18182419, 0x1a829501, 0x4f040124, 0x2c84140a, 0x3023152f, 0x294c2001,
-    0x502c1616, 0x064f0724, 0x30558208, 0x4f03121b, 0x30251e16, 0x4e110101,
-    0x120e0707, 0x05de5495, 0x2c086f42, 0x001200ab, 0x0021001b, 0x003d0034,
-    0x0a534143, 0x8209dd42, 0x150723c9, 0x01823533, 0x83331521, 0x116b4307,
-    0x23150728, 0x36323315, 0x2783013d, 0x67412320, 0x2b2b2e07, 0x12182aeb,
-    0x0118126b, 0x162a2b2b, 0x430e822a, 0x80270880, 0x18122b2b, 0x431540c0,
-    0x2a200788, 0x24050a43, 0x12180180, 0x2100822b, 0x90434015, 0x2b6b210b,
-    0x2b254682, 0x162a4015, 0x0aaf4900, 0x234fab20, 0x00192606, 0x00310028,
-    0x86b9863a, 0x823520a6, 0x22aa82a8, 0x75272634, 0x19440559, 0x4207200c,
-    0x2525070f, 0x3b011e15, 0x20e88201, 0x20a38540, 0x26a78240, 0xeafe1218,
-    0x4296eb2b, 0x56210822, 0x21c082eb, 0x9884c0fe, 0x9e82ad84, 0x32820284,
-    0x40408024, 0x28428096, 0xeb2b2207, 0x25bc8356, 0x2b2a1812, 0xcb430700,
-    0x26a39006, 0x3d363205, 0x18152301, 0x83094965, 0x25332198, 0x44061047,
-    0x37210a49, 0x25c28223, 0x07010e23, 0x15833505, 0x15331524, 0x5a83ab01,
-    0x2a402b24, 0x8c822b2b, 0x2a150124, 0x4f4495eb, 0x55552108, 0x0122a583,
-    0x81834001, 0x04831520, 0x00822a20, 0x122b2b23, 0x20a28218, 0x44a28295,
-    0x2a220664, 0xc88455eb, 0x0023ee84, 0x900c0000, 0x00232ea7, 0x0030002c,
-    0x003d0039, 0x004f0046, 0x1c554153, 0xf5419d82, 0x086c4105, 0x15330724,
-    0x54412723, 0x15052407, 0x87053533, 0x4218820c, 0x43270921, 0x2b011a13,
-    0x82402a2b, 0x131a2403, 0x832bedfe, 0x139322a0, 0x820e821a, 0x6b6b2ad1,
-    0x131a01ab, 0x6b012b28, 0x0676412a, 0x2c42eb20, 0x85012005, 0x832b2017,
-    0x82282000, 0x82da8241, 0x1a9523cc, 0x11829313, 0x6b21d183, 0x2516822b,
-    0x40152b2a, 0xf9826b40, 0x4e842a20, 0x9d180482, 0xc023080b, 0x76008001,
-    0x002405bb, 0x23071501, 0x37229e82, 0xb2833533, 0x9d820520, 0x9e400131,
-    0x629e8062, 0xff2a2a55, 0x012a2a00, 0x839e6280, 0x2a2b2202, 0x062f48d6,
-    0x0b6aff20, 0x00032b05, 0x0013000f, 0x37072500, 0x015b0317, 0x8237200a,
-    0x0001284c, 0xc06b6b6b, 0x828080aa, 0x562a2f02, 0xeaea2a15, 0x2a40aa01,
-    0x162a4040, 0x674c5656, 0x0543740c, 0x2f002b2c, 0x37003300, 0x15130000,
-    0x8c831733, 0x35204e82, 0x22059357, 0x84272307, 0x82252097, 0x33072297,
-    0x82a88417, 0x832320af, 0x2315221e, 0x06695607, 0x1c302b2e, 0x806b8022,
-    0x802a1227, 0x56226f19, 0x3005c845, 0x802811f9, 0x2e121f21, 0x2a49336b,
-    0x2b2b6b2a, 0x20cb82eb, 0x3a918295, 0x95802929, 0x2f204b80, 0x152b2a51,
-    0x4937162a, 0x2c952942, 0x802b802c, 0x822b2b2b, 0x09db779b, 0x79761920,
-    0x15012209, 0x82888333, 0x207b829a, 0x837b8333, 0x83a18389, 0x20038381,
-    0x3e9f8417, 0x55012315, 0x300f2d17, 0x3d2b1380, 0x1a2b1580, 0x2e138025,
-    0x2b2b553a, 0x802a2ad5, 0x82d62a2a, 0x80952b97, 0x806a406a, 0x6a80806a,
-    0x06827931, 0x78828282, 0x78821520, 0x7f420e20, 0x00113b0a, 0x0023001a,
-    0x002d0027, 0x003a0031, 0x00440040, 0x0051004d, 0x0063005a, 0x67821300,
-    0x3523152e, 0x1e37013e, 0x23011d01, 0x17352335, 0x13270887, 0x012b0614,
-    0x50353335, 0x35200525, 0x35212882, 0x4c058303, 0x33220530, 0x0c822715,
-    0x83153321, 0x88032012, 0x063f4112, 0x17205184, 0x40213f87, 0x26a8822b,
-    0x1812fd18, 0x83ab2b2a, 0x43552004, 0x962e0745, 0x40162a40, 0x01181295,
-    0x2b562b2b, 0x0a884015, 0x84ab2b21, 0x84a72031, 0x83012027, 0x0570480c,
-    0xc6441582, 0xeafe2106, 0x6b294883, 0x402b9540, 0x2aebfe15, 0x2929842a,
-    0x2a164080, 0x2b2b1501, 0x0e84ebfe, 0x8340c021, 0x18122178, 0x2a216082,
-    0x0a67762b, 0x13000f28, 0x1c001800, 0xfd822000, 0x07331522, 0x20081f42,
-    0x05b14227, 0x82011f21, 0x07ea47bd, 0x5410c02f, 0x80aa8051, 0x55105451,
-    0x55152a2a, 0x060a42aa, 0x80800126, 0x2a2a8095, 0x2b260482, 0x27982c2a,
-    0xeb412727, 0x41022005, 0x19220873, 0x43472100, 0x8233201e, 0x47232065,
-    0x80231435, 0x470180eb, 0x1882142a, 0x47000021, 0xc022051f, 0xd182ab01,
-    0x00000f2b, 0x17372737, 0x07271737, 0x055d5d15, 0x55d53535, 0x1e8d371e,
-    0x6a02c080, 0x026a5454, 0x371e5655, 0x18ab1e8c, 0x23092160, 0x00060000,
-    0x02260082, 0x00800100, 0x037a0003, 0x001f2805, 0x25000023, 0x18331123,
-    0x280f854c, 0x23353313, 0x35331517, 0x20078205, 0x29038207, 0xaaaa5501,
-    0x120ec00b, 0x04830e12, 0x4025f382, 0x2b40fe2b, 0x2602822b, 0x2b2a012b,
-    0x84fe0e12, 0x4001301b, 0xd5fe120e, 0x80802bd6, 0x80abd6ab, 0x82000100,
-    0xc0012300, 0x6d824001, 0x3a051b5b, 0x1d062221, 0x33161401, 0x37363221,
-    0x01351735, 0x090c016b, 0x0c0900ff, 0x8201090c, 0x55012305, 0x0b834be0,
-    0x0483d620, 0xea554b22, 0x4385ae85, 0x0f00962a, 0x00001700, 0x23170713,
-    0xfe824388, 0x3507112b, 0x012b012e, 0x3a1b4617, 0x24468510, 0x1b440507,
-    0x27568255, 0x9501ef84, 0x090c3a1b, 0x04254c82, 0x1a011b44, 0x205a8255,
-    0xd74618ef, 0x00562409, 0x821d0009, 0x233524fb, 0x82372715, 0x371725e8,
-    0x23263435, 0x2f0adf59, 0x1117013d, 0x4a801501, 0x204b804a, 0xd5fe090c,
-    0x2b285d84, 0x75550c09, 0x4b4b3636, 0x35200382, 0xbd85ab84, 0x01564b23,
-    0x225b8716, 0x828001c0, 0x001f23ab, 0xed860100, 0x3e21172b, 0x34013d01,
-    0x0e210726, 0x83fd8701, 0xab01230f, 0x558495fe, 0x05836b20, 0x01270b8a,
-    0x80090c80, 0x82010c09, 0x200682c5, 0x840685d5, 0x00002112, 0x2205634d,
-    0x5b5601c0, 0x00290623, 0x23113337, 0x11331133, 0x2d078201, 0xd5c0c0ab,
-    0x4095fe40, 0x15014040, 0x0385ebfe, 0x2208974d, 0x876b01d6, 0x41012033,
-    0x132006d9, 0x012c3382, 0x56fe5580, 0xd66a5555, 0xeb4001d6, 0x37820082,
-    0x33884020, 0x0120678a, 0x33846386, 0xfe6b552a, 0x806b6b95, 0x55016b6b,
-    0x07836787, 0x8205af4e, 0x01c021f9, 0x0a635f18, 0x9b186d83, 0x35260767,
-    0x01233533, 0x0082ab15, 0x0382d520, 0x8001ab2b, 0x80fe8080, 0x2b80d5d5,
-    0x83738ad5, 0x0013293b, 0x13000017, 0x07352115, 0x21064541, 0x2c4c2133,
-    0x21012705, 0x012b2135, 0x2f411595, 0x77fe2f0a, 0x6bfe9501, 0x40408001,
-    0x80090c6b, 0x04840c09, 0x83ebfe21, 0x040021c6, 0x00215782, 0x208f8c01,
-    0x20838237, 0x20038211, 0x24038217, 0x35331535, 0x238e8740, 0x80feabd5,
-    0x00209985, 0x67413788, 0x850f2007, 0x8205208d, 0x8294827d, 0x21352605,
-    0xfe6b0155, 0x22038c95, 0x822a2a55, 0x2b2a22c9, 0x066b432b, 0x3f897782,
-    0xc183d188, 0x41823520, 0x87862720, 0x07823520, 0x906bc020, 0x21078307,
-    0x0084566b, 0x55550129, 0x55d6fe55, 0x85155615, 0x05bf4306, 0x01205391,
-    0x2006177c, 0x06ab4313, 0x07820720, 0x01265383, 0x6beb6b55, 0x0287806b,
-    0x016b6b24, 0x00828055, 0x82ebfe21, 0x80802304, 0xe3958015, 0x03353322,
-    0x05233f82, 0x83231133, 0x82d5204f, 0xff6b2241, 0x83438400, 0x213c833e,
-    0x05821501, 0x00820020, 0x82000221, 0x248f8800, 0x21151300, 0x41db8335,
-    0x6f820917, 0xb3422a83, 0x5d0f2009, 0x50180647, 0x37240af3, 0x33012e11,
-    0x07210f82, 0x057c4e11, 0x34113524, 0x1f8a2126, 0x01260f83, 0x0c094015,
-    0x0482090c, 0x0c010123, 0x8306858d, 0xfe0c220d, 0x221887cc, 0x4455010c,
-    0x0b970b4a, 0x35069344, 0x007b01da, 0x01000020, 0x23060706, 0x26012f22,
-    0x27072223, 0x01823736, 0x17161725, 0x82163716, 0x08118208, 0x1617363f,
-    0x5403d501, 0x1a253c57, 0x04161323, 0x1f1f141d, 0x0c32152a, 0x110e050c,
-    0x0302360e, 0x20101020, 0x22014258, 0x46726c3f, 0x1a14457e, 0x02241c1c,
-    0x134f4905, 0x55010142, 0x67072516, 0x051e4103, 0x00820020, 0xb5013808,
-    0x0f008001, 0x16010000, 0x07010e15, 0x13370323, 0x3437013e, 0xa0012726,
-    0x355c0314, 0x21843d97, 0x07022918, 0x21800106, 0x43a64a2c, 0xfe0d6b01,
-    0x296227fd, 0x820b1f16, 0x82002032, 0xc9012c00, 0x44002b01, 0x36010000,
-    0x4d012b26, 0x22250706, 0x36013d26, 0x23c2822b, 0x1517011e, 0x83074863,
-    0x06172d1e, 0x011e1716, 0x3d363233, 0x32363401, 0x7f080b83, 0x2732013b,
-    0x2e27012e, 0x01023e02, 0x090602bc, 0x0208082c, 0x08171d01, 0x01050609,
-    0x010a440d, 0x03010f01, 0x112b0c04, 0x2c080803, 0x01010609, 0x461b281d,
-    0x050b1423, 0x1513140a, 0x132b0c12, 0x0e140304, 0x01081208, 0x1b012f07,
-    0x04080907, 0x071c3a03, 0x56070506, 0x07080210, 0x0a40140f, 0x30420207,
-    0x04080809, 0x27394d0a, 0x27080928, 0x120a0609, 0x0a121516, 0x11091019,
-    0x4909080b, 0x2b0a2b42, 0x000f0080, 0x1300004c, 0x11150622, 0x27050846,
-    0x26341135, 0x32330523, 0x1721b382, 0x34b38216, 0x3337022e, 0x14011d32,
-    0x013e3732, 0x33373635, 0x020e0716, 0x21e38214, 0xdc82011e, 0x2e012f24,
-    0xef850e01, 0x82262221, 0x263729d3, 0x19126b36, 0x2a011219, 0x34080583,
-    0x0b20e0fe, 0x091f0c03, 0x0a020303, 0x09320801, 0x16110a09, 0x0d200b02,
-    0x05230504, 0x15060d06, 0x08200e09, 0x0e0e1607, 0x08010408, 0x1433190f,
-    0x0101161c, 0x0dcd5705, 0x230c7523, 0x08148230, 0x0f2f072a, 0x0c010b0b,
-    0x150a0a3e, 0x0108022a, 0x35100b01, 0x0c080607, 0x071b1707, 0x01080d18,
-    0x061c0704, 0x291c1e06, 0x06030738, 0x250bdb57, 0x0048000b, 0xb14f0100,
-    0x012e2208, 0x18d7b907, 0x200c0f5a, 0x18d8b3e6, 0x200b0d5a, 0x2ed7b288,
-    0xff000003, 0x01d801d5, 0x000a00ab, 0x82340016, 0x0f2229d9, 0x32011e01,
-    0x26273736, 0x0e370887, 0x07262201, 0x010f0622, 0x21171606, 0x012f013e,
-    0x012b012e, 0x56011e17, 0x550807cc, 0x0001013f, 0x0818070e, 0x08191819,
-    0x1f5b0618, 0x3b3a3b13, 0x290e1f13, 0x0e4e292a, 0x031f0417, 0x7a010e0c,
-    0x1f030c0e, 0x110e1704, 0x03010207, 0x49484915, 0x02010315, 0x10ab0107,
-    0x06060843, 0xa9104308, 0x0d0d1655, 0x0a0e5516, 0x0d12740a, 0x01110d6d,
-    0x06821101, 0x05151228, 0x111b050b, 0x06821b11, 0x17471520, 0x00022906,
-    0x08004001, 0x29001100, 0x220ae15d, 0x64012e05, 0x372805fe, 0x1607010e,
-    0x37362317, 0x82085451, 0x080c82b0, 0x208b0123, 0x2b3f2a2a, 0x1fcbfe2b,
-    0x2a3f2b2b, 0x4232f62a, 0x601a0102, 0x4202011a, 0x01423232, 0x01324201,
-    0x21078416, 0x26830180, 0x012a3f22, 0xbf200786, 0x2c231a82, 0x842c1f1f,
-    0x202a821c, 0x47308402, 0x7c2c09a3, 0x13000c00, 0x00001900, 0x011e1501,
-    0x08228418, 0x34073c08, 0x3e152726, 0x33152501, 0x01071117, 0x3a3a2f2b,
-    0x0153412f, 0x1d0c5301, 0xfe1d1818, 0x6b6b55e0, 0x0e2c7b01, 0x0f4c684d,
-    0x4665102c, 0x1dab6546, 0x0bab0c2d, 0x6b805d2d, 0x446b5601, 0x562706bf,
-    0x05006b01, 0x84130000, 0x56952543, 0x00016a6a, 0x00201e85, 0x20057444,
-    0x201f848b, 0x2021870c, 0x82f18217, 0x826b2072, 0x01cb255b, 0x1c19191c,
-    0x40202e86, 0x00205a85, 0x04200082, 0x00240382, 0x8001c001, 0x132d4182,
-    0x26001f00, 0x07010000, 0x17072717, 0x20638223, 0xf9461835, 0x17272607,
-    0x36170714, 0x214e8337, 0xc884011e, 0x01361737, 0xa52d2d00, 0x5565651b,
-    0x1a165b6b, 0x1b2c222c, 0x200b95c0, 0x37d08215, 0x343a2f41, 0x0134181d,
-    0x2d2d6b01, 0x80651b6f, 0x115b906b, 0x1c0b2c08, 0x1b282182, 0x29211a1e,
-    0x10654630, 0x3420e882, 0x2f238482, 0x72000634, 0x562009e3, 0x23228382,
-    0xbd823500, 0x010f3322, 0x2c05ca51, 0x14163727, 0x34262206, 0x36373537,
-    0x180a8332, 0x2307746b, 0x22262307, 0x37212283, 0x081e8317, 0x1f323622,
-    0x80c00701, 0x180a2040, 0x1e0c1824, 0x30483018, 0x49189716, 0x18493030,
-    0x19240c1e, 0xee0c2419, 0x1e200685, 0x3b271485, 0x4055011e, 0x83230b8e,
-    0x23128419, 0x96011748, 0x2e823583, 0x0c204183, 0x18224688, 0x95821e3b,
-    0xeaff003e, 0xbc019601, 0x1f001600, 0x33250000, 0x26272335, 0x010f2227,
-    0x37353315, 0x17373303, 0x27220782, 0xfb71013f, 0x2d2b0808, 0x0a2b4d68,
-    0x74050515, 0x26532d26, 0x3527313e, 0x1610150f, 0x15152116, 0x114726eb,
-    0x6f240201, 0xb9fe0e4f, 0x886a43ad, 0x835e3d61, 0x16212116, 0x28070341,
-    0x008001d6, 0x001d0019, 0x39658226, 0x23061415, 0x35262221, 0x33363411,
-    0x1d163221, 0x06222301, 0x011e1507, 0x7f823533, 0x67221721, 0x012306db,
-    0x7c1219c0, 0xc02009aa, 0x2a05344d, 0x0d55d5d5, 0x121b1212, 0x45154012,
-    0x152b0924, 0x12aa1219, 0x75aa2b19, 0x82121c12, 0x00002302, 0x03820500,
-    0xd601002e, 0x0a009601, 0x17000e00, 0x43002000, 0x21227782, 0xd7583335,
-    0x15332505, 0x03213521, 0x08af5818, 0x17240887, 0x2e353623, 0x0f228c83,
-    0x07842701, 0x4b140721, 0x36200a9b, 0x2d06e14a, 0x232d6daa, 0x2d234848,
-    0x01aafe6d, 0x5a18eb56, 0x74320c59, 0x2401042f, 0x081c111b, 0x1c080b0b,
-    0x01241b11, 0x89182f04, 0x952b08c7, 0x62193c80, 0xea3c1962, 0x1816012a,
-    0x330ea54d, 0x1c0b0a2a, 0x0e0d0f24, 0x240f0d0e, 0x180a0b1c, 0x1813ea13,
-    0xef620484, 0x0003240a, 0x841c0007, 0x492120c3, 0x334c05ad, 0x33172605,
-    0x35173715, 0x058e4b33, 0x18ab0121, 0x8309354e, 0x6c562077, 0xeb2e05e6,
-    0xea2beb80, 0x12eb1218, 0x2a6a0118, 0xb1526a2a, 0xdb5d1805, 0x00962809,
-    0x000f000b, 0x842d0013, 0x06b8535d, 0x22413520, 0x15332505, 0x35233323,
-    0x4c084b69, 0x0b4108a7, 0x2b402408, 0x83402b80, 0x80eb2475, 0x8240eb80,
-    0x8280205a, 0x8a402065, 0x822a20f4, 0x21f28300, 0x14832b2b, 0xdb8a2b20,
-    0x62180a20, 0x223208cf, 0x2e002900, 0x3b003300, 0x4b004300, 0x56005000,
-    0x73465b00, 0x23152a08, 0x2315010e, 0x16143315, 0x28e58217, 0x23353335,
-    0x23272634, 0x05f47e35, 0x17011e33, 0x07013e23, 0x36230706, 0x23171637,
-    0x06330726, 0x27068214, 0x16333734, 0x26230714, 0x362b0786, 0x16330734,
-    0x33372617, 0x8222010e, 0x07062205, 0x05a27336, 0x16425229, 0x95950c09,
-    0x8556090c, 0x162e0806, 0x02025242, 0x11014960, 0x11093609, 0x290d092f,
-    0x17288817, 0x2fb70d29, 0x022f0101, 0x0101485c, 0x2f740148, 0x012f0202,
-    0x090d29bf, 0x24823d28, 0x5811022f, 0x09281729, 0x61019501, 0x0a5e4248,
-    0x77ea1916, 0x0a16300d, 0x6148425e, 0x1c230129, 0x1009231c, 0x82102626,
-    0x0b512303, 0x028d0b15, 0x11264a28, 0x241c2611, 0x07821c24, 0x0002002d,
-    0x01c0ff00, 0x00c001ab, 0x181c000b, 0x3608294e, 0x2e07010e, 0x012e2501,
-    0x0723012f, 0x1614010e, 0x3733011f, 0x1880013e, 0x290af642, 0x22012a01,
-    0x15aa151e, 0x0686221e, 0x4318c020, 0x36280a4b, 0x7a184529, 0x5245187a,
-    0x00200685, 0x02200082, 0xe8206784, 0x082d6782, 0x00002100, 0x37273325,
-    0x37270717, 0x05bb7e23, 0x17163723, 0x2e6b8a37, 0x0627013f, 0x356a2b01,
-    0x1e69691e, 0x852b6a35, 0x212e2359, 0x7089031e, 0x211e0324, 0x1f8336d5,
-    0x866b3621, 0x1f1b2295, 0x22738803, 0x881b1f03, 0x84db8373, 0x87372073,
-    0x3e172473, 0x822e3701, 0x27073062, 0x1733013f, 0x0614011e, 0x2f23010f,
-    0x88163701, 0xb7d52072, 0x065b4672, 0x7b018024, 0xbb750b00, 0x0001210d,
-    0x08225382, 0x02820870, 0x1549013c, 0x47364802, 0x98070798, 0x00483647,
-    0x00000200, 0xa801fdff, 0x0f007c01, 0x35821800, 0x07012f2f, 0x15010e17,
-    0x3217011e, 0x37173736, 0x2cab8227, 0x17070607, 0x626d0136, 0x0c471b9b,
-    0x25f08210, 0x39112b18, 0x4b82281b, 0x1711123c, 0x625303b7, 0x17471c9b,
-    0x4836142d, 0x380f1102, 0x99477d1b, 0x20151607, 0x93460eb8, 0x838f8508,
-    0x4921205d, 0x1f230d5b, 0x18270701, 0x44093352, 0x01210796, 0x20a58400,
-    0x2bb18436, 0x1680162d, 0x0f0f0b1b, 0x6b0f0f16, 0x01210685, 0x20b8847b,
-    0x20c48402, 0x211e8289, 0x1d830180, 0x5f0f1622, 0x77820786, 0x22090370,
-    0x8237000a, 0x8bd618d3, 0x35053309, 0x36342622, 0x36343533, 0x1632013b,
-    0x32331517, 0x08821d16, 0x2b061423, 0x20188501, 0x22128323, 0x82211517,
-    0x01333e21, 0x03250395, 0x02182419, 0x12d8fe26, 0x18121919, 0x18122b12,
-    0x1912aa01, 0x090c0c09, 0x21048355, 0x10821580, 0x1800ff2f, 0x32028b12,
-    0x18181217, 0x49321712, 0x203182c0, 0x260b8316, 0x56121816, 0x820c120c,
-    0xc02b2802, 0x2a2a1219, 0x85001912, 0x0000359b, 0x5601eb01, 0x27001200,
-    0x2e370000, 0x013e2701, 0x33013e37, 0x0382a482, 0x07061425, 0x48352335,
-    0x262305e0, 0x79062223, 0x3434050e, 0x3d2d8026, 0x2d3d0101, 0x382c4311,
-    0x250a064d, 0x2a253030, 0x292a0e82, 0x0c0b0739, 0x1b24241b, 0xa0821501,
-    0x3c012b32, 0x013c2e2d, 0x48012f26, 0x48300137, 0x15800130, 0x322a3583,
-    0x37240427, 0x18010124, 0x2b461824, 0x01eb2c08, 0x000b0080, 0x00390017,
-    0x82510045, 0x32332285, 0x25798216, 0x34012e23, 0x0b8a2136, 0x9a842520,
-    0x9a823720, 0x23240383, 0x012b2634, 0x0e269b88, 0x17140701, 0xb3841723,
-    0x23053d41, 0x011e2137, 0x2705eb46, 0xd5403634, 0x090c0c09, 0x01220483,
-    0x0a836b1e, 0xfe210483, 0x25c289c9, 0x2b023024, 0xc48a1219, 0x2d040123,
-    0xd1781829, 0x740c2307, 0x34831501, 0x82ebfe21, 0x0c802405, 0x46010c12,
-    0x40200b43, 0x2639d582, 0x4801012e, 0x30010138, 0x16181224, 0x01013c2d,
-    0x01042731, 0x0a0b1b24, 0x0e6d4680, 0x87420020, 0xeaff2d05, 0x9601eb01,
-    0x3a003100, 0x4c004300, 0xf083f182, 0x7c41ef82, 0x22232b0f, 0x3b363426,
-    0x34013e01, 0x87412726, 0x8331830e, 0x08b2421d, 0x11872720, 0xa5828020,
-    0xa0410920, 0x22c18410, 0x8c191215, 0x702421e5, 0x242a1082, 0x0e721818,
-    0x121b1212, 0xe1674812, 0x83952005, 0x0ebc41e2, 0x18231283, 0x41011824,
-    0x56210ac3, 0x23398219, 0x012b1924, 0x1b223a83, 0x00485612, 0x05ef4207,
-    0x3320df83, 0x5342df82, 0x20d69a13, 0x27c58333, 0x07333723, 0x23370733,
-    0x95116642, 0x841b20c5, 0x406b2716, 0x10502b2b, 0x77426b35, 0x20ba920f,
-    0x36138201, 0x6a95556a, 0x00000400, 0xc601eaff, 0x0900ab01, 0x28001300,
-    0x4a003300, 0x372705a7, 0x1f013f27, 0x6b170701, 0x173705ce, 0x07163207,
-    0x22060706, 0x37342627, 0x16363736, 0x021e0615, 0x63032e17, 0x4e080571,
-    0x13367b01, 0x36133838, 0x8e171744, 0x25240d23, 0x0f2c230d, 0x130e040e,
-    0x420d0a08, 0x3e3e42aa, 0x1a0e0e0d, 0x59471e04, 0x45562e0c, 0x032d0226,
-    0x01833330, 0x27412a69, 0x022a4127, 0x1a964040, 0x2b19192b, 0x2a2a011a,
-    0x0e0d1b6a, 0x823f3f0d, 0x0a0d3433, 0x2e0f1207, 0x261f4759, 0x56462502,
-    0x3383342d, 0x5a000330, 0x9a2208af, 0xa9821a00, 0x34002e28, 0x40003a00,
-    0xb1825300, 0x07011e28, 0x011d011e, 0xf1423336, 0x012e2c05, 0x33373634,
-    0x3e37012e, 0x82261701, 0x171626b6, 0x3237013e, 0x24108217, 0x17372726,
-    0x39c98226, 0x17061737, 0x07172726, 0x17160536, 0x05063727, 0x012e3523,
-    0x23070622, 0xe143010e, 0x015f0807, 0x06242610, 0x0b0a1814, 0x1c24241c,
-    0x3024ebfe, 0x15062430, 0x57160e0a, 0x0d381e1d, 0x12080107, 0x14171e32,
-    0x110e1701, 0x11133613, 0x030c10b3, 0x03ec143f, 0x042c3306, 0x0602bffe,
-    0x01032b32, 0x30014056, 0x2b013048, 0x12181812, 0x0c091501, 0x114b010c,
-    0x32122747, 0x0104041d, 0x84243724, 0x1a24081c, 0x212d2041, 0x1c160d3a,
-    0x150f2211, 0x15080118, 0x03085723, 0x080d3d1c, 0x0f3c0e0b, 0x11137e06,
-    0x0c152f20, 0xa5210584, 0x0881832b, 0x24180127, 0x0c010118, 0x04000c12,
-    0xefff0000, 0x9601eb01, 0x19000c00, 0x5c002600, 0x1e370000, 0x0e010f01,
-    0x3f012e01, 0x98f78201, 0x4437200c, 0xf0820832, 0x3121ed82, 0x2134821e,
-    0xf8443127, 0x172c080e, 0x0607010e, 0x3736012e, 0x35013e31, 0xc0272634,
-    0x1c020809, 0x09110f02, 0x0f021b03, 0x0309095e, 0x120f022c, 0x032c0208,
-    0x09085e0f, 0x0c821983, 0x09201f82, 0x29090545, 0x080f1101, 0x08100904,
-    0x29451c19, 0x0101350c, 0x10081317, 0x0908050a, 0xc012190c, 0x67090e03,
-    0x0f040809, 0x02200583, 0xa5250c82, 0x0e050809, 0x83058209, 0x2019880c,
-    0x08744329, 0x1d121c2b, 0x10100508, 0x300e0404, 0x095b451e, 0x2718242b,
-    0x1004040b, 0x13060411, 0x051a610c, 0x4406bb4a, 0x3e220563, 0x61444b00,
-    0x14162134, 0x2f06754f, 0x17013f34, 0x14060727, 0x32011e17, 0x34363736,
-    0x352b6044, 0x0c1919d7, 0x0c202020, 0x1e3c1919, 0x0d0d1e1e, 0x0f100f07,
-    0x61440d07, 0x1a243f26, 0x080c1b3f, 0x3f1b0c08, 0x3479631a, 0x0d210e34,
-    0x07040407, 0x0000210d, 0xff000002, 0xdf8501d6, 0xddb45b20, 0x2627373c,
-    0x1f323634, 0x013e3701, 0x010f011e, 0x011e3637, 0x17010f06, 0x22061416,
-    0xf882012f, 0x3f012e22, 0xab050242, 0x2f4334ed, 0x110d0623, 0x030c2207,
-    0x0209110f, 0x0f092f0d, 0x92090804, 0x34ffa613, 0x07220c57, 0x23060d11,
-    0x0408092f, 0x0d2f090f, 0x0f110902, 0x3d139203, 0x00080000, 0x01eaff00,
-    0x009601b9, 0x0014000b, 0x001e0019, 0x00280023, 0x0032002d, 0xff670100,
-    0x0e17220a, 0x05ca6001, 0x26172723, 0x20f48222, 0x82f9830e, 0x0725301f,
-    0x1727012e, 0x37013e07, 0x32162707, 0x46000137, 0x0585053e, 0x24241b37,
-    0x1b242436, 0x18361833, 0x1b145986, 0x05252504, 0x1901131b, 0x2a058226,
-    0x1b135858, 0x17339305, 0x7a011837, 0x2a200b1b, 0x2e06157a, 0x09094996,
-    0x2f100721, 0x19518519, 0x82de112f, 0xdd102104, 0xbb200e83, 0xcf441782,
-    0x00962209, 0x2caf8212, 0x0030002a, 0x003a0035, 0x3700003f, 0x82888233,
-    0x32332295, 0x05147416, 0x17363422, 0x200acc47, 0x47168305, 0x332705e3,
-    0x22012e37, 0x87370706, 0x840720cd, 0x554021c8, 0x2605a77a, 0x0c0c0955,
-    0x8280fe09, 0x01342205, 0x200b842a, 0x210582d6, 0x145a0901, 0x83ab2008,
-    0x400121a7, 0x0121d988, 0x20d4834c, 0x47f685c0, 0x552007e7, 0x2006c247,
-    0x053d4955, 0x241bab25, 0x87d51b24, 0x835120d8, 0x180020d3, 0x2009eb79,
-    0x28cb8296, 0x001d0018, 0x00270022, 0x20c99438, 0x30b19321, 0x34363703,
-    0x010f2226, 0x06222627, 0x16011f14, 0x21c29132, 0xac940901, 0x0742512e,
-    0x3307110d, 0x0d110733, 0x10074207, 0xab91bb8e, 0x43d4fe2e, 0x060d1106,
-    0x0d063434, 0x06430611, 0x0020ba82, 0xff240482, 0x01d601fd, 0x0720bbb6,
-    0x26073343, 0x34262206, 0xd936013f, 0x42ce2abb, 0x060c1107, 0x0c063333,
-    0x4feb8211, 0x17270a9f, 0x45002e00, 0x49370000, 0x2221092d, 0x518d8307,
-    0x072105dc, 0x05425117, 0x10861d82, 0x012e2127, 0x05333634, 0x20118221,
-    0x05264a36, 0x2627223f, 0x16323634, 0x26343632, 0x0c0c0955, 0x1812ab09,
-    0x070c2418, 0x18070d11, 0x24303048, 0x2b138295, 0x0d110c12, 0x24371206,
-    0xd6fe1c24, 0x09220e82, 0xc55b1501, 0x241b2407, 0x82123624, 0x120d2494,
-    0x48eb0c0c, 0x0c2a066d, 0x06110d06, 0x30483018, 0x11822b01, 0x110d0c29,
-    0x37241207, 0x82010124, 0x05414a0c, 0x12200d82, 0x0c205f82, 0x00211082,
-    0x28cb8a00, 0x00280014, 0x1300003f, 0x05844b17, 0x43360721, 0x22250b05,
-    0x33161406, 0x20a58321, 0x06b24727, 0x95171521, 0x0f802ac5, 0x32293d0b,
-    0x0f010142, 0x09c14712, 0x27088b47, 0x2a014a09, 0xcb012a40, 0x0129c193,
-    0x30260140, 0x14324201, 0x26b08409, 0x2a304930, 0x82192418, 0x350127a6,
-    0x202a2a20, 0x0a83d50b, 0xbe8d0120, 0x000a0023, 0x067b6100, 0x00072308,
-    0x0015000d, 0x0020001a, 0x002e0026, 0x00390033, 0x25000045, 0x33273436,
-    0x010f1416, 0x0e333736, 0x1d502701, 0x26210807, 0x27063327, 0x37013e23,
-    0x16330706, 0x27012e17, 0x33373426, 0x37171406, 0x36231716, 0x27262317,
-    0x0aaf661e, 0x01012e3a, 0x4803035d, 0x136e0505, 0x2f103f0b, 0x03036423,
-    0x1b350364, 0x700e520e, 0x1e2e0e82, 0x0b3f4a13, 0x212f1e13, 0x03480505,
-    0x16835d03, 0x1084af20, 0x756d8420, 0x1595230a, 0x0282152c, 0x29237625,
-    0x846c271b, 0x27942e0b, 0x1bd82e2e, 0xd3230a27, 0x270a2329, 0x21138445,
-    0x1482d515, 0x0f832e20, 0x18026521, 0x4a0b4765, 0xab26052b, 0x0b009601,
-    0xdf821700, 0x7c115b45, 0x2e210698, 0x2b088201, 0x26220614, 0x22033634,
-    0x3f342726, 0x2705e556, 0x0e151617, 0x00012301, 0x0a1f4418, 0x67454020,
-    0x12653411, 0x26070118, 0x4048401a, 0x0107261a, 0x95011218, 0x87405401,
-    0x7f292032, 0x64450a80, 0xacfe3207, 0x090d1218, 0x19191644, 0x0d094416,
-    0x02001812, 0x36008200, 0x8001d701, 0x27001e00, 0x1e010000, 0x07141701,
-    0x1f163233, 0x4d271601, 0x35280510, 0x3e013f06, 0x26013b01, 0x0b0f6d18,
-    0x00012508, 0x0b013024, 0x04161036, 0x18020726, 0x12aafe12, 0x26070218,
-    0x36101604, 0x2430010b, 0x24181812, 0x80011818, 0x183d0a82, 0x990e1313,
-    0x1912021d, 0x1d021219, 0x13130e99, 0x2a302418, 0x19192418, 0x04001824,
-    0x227b8b00, 0xa9460036, 0x1507247f, 0x82173533, 0x37272703, 0x07152335,
-    0x96543335, 0x013b2105, 0xa3067665, 0x2b92239e, 0x00822b15, 0x1295152b,
-    0x18010118, 0x152b4012, 0x34b19f40, 0x1535aa80, 0x2b2b2a20, 0x3515202a,
-    0x12561218, 0x56406a18, 0x0b8f432a, 0x38002936, 0x00004700, 0x0e011e25,
-    0x26062302, 0x3e032e27, 0x17363701, 0x2f054f41, 0x010e020f, 0x1617011e,
-    0x3f16011f, 0x17323601, 0x30066371, 0x37072726, 0x013e2726, 0x07010e17,
-    0x37071716, 0x05665116, 0x65012b08, 0x08010308, 0x14050918, 0x052d2826,
-    0x050e0111, 0x020a0609, 0x030f0306, 0x02090503, 0x0b0f0402, 0x07100b0f,
-    0x06031104, 0xb5424204, 0x32403105, 0x01202163, 0x495b7802, 0x1e010260,
-    0x382a3e14, 0x28080882, 0x03966002, 0x0e130e05, 0x14100102, 0x2820093a,
-    0x02080414, 0x04280802, 0x02090905, 0x0c160805, 0x0508060d, 0x01031406,
-    0x823782ec, 0x20013146, 0x40326321, 0x0228785b, 0x2a384960, 0x011e143e,
-    0x49210882, 0x2ae38560, 0x01ab01e0, 0x003300a0, 0x824c003c, 0x37072ae3,
-    0x2f262736, 0x0f062601, 0x24d78301, 0x0717013f, 0x23018206, 0x1e373617,
-    0x072ae482, 0x34353617, 0x07372726, 0xfe821606, 0x013f3622, 0x26210c82,
-    0x055b4527, 0x0316142c, 0x012e2306, 0x17373427, 0x2c830706, 0x01373308,
-    0x07315889, 0x73080203, 0x3a061107, 0x150f0208, 0x59282b08, 0x0d110202,
-    0x1f101020, 0x0901012a, 0x0b0c1320, 0x0e020446, 0x0e0a020b, 0x03030402,
-    0x6342120a, 0x63260805, 0x4232231d, 0x08201402, 0x202a0101, 0x04d10d13,
-    0x0a110b37, 0x02054407, 0x14083505, 0x27060110, 0x01045b18, 0x1f870a05,
-    0x231d2032, 0x060f2414, 0x020e0c66, 0x057e090e, 0x7909040b, 0x27058b42,
-    0x0113a8fe, 0x1c243143, 0x00206f87, 0x3405375e, 0x006b01fc, 0x00200007,
-    0x37000023, 0x23072327, 0x37173337, 0x20088207, 0x0c1c6b27, 0x37331722,
-    0x2e080282, 0xdc273305, 0x290f440f, 0xd1442b44, 0x20222019, 0x4518101a,
-    0x02604928, 0x32496002, 0x26021551, 0x2c252020, 0x183196fe, 0xc02a2a6b,
-    0x8287c0c0, 0x221d2100, 0x34055d41, 0x2b330102, 0xc0828209, 0x00004e79,
-    0xff000006, 0x01eb01e1, 0x358182a0, 0x00160007, 0x001e001a, 0x25000022,
-    0x37273717, 0x27233533, 0x9b6d2335, 0x3e172a05, 0x26343701, 0x33152305,
-    0x82168317, 0x70012b1e, 0x1d261e26, 0x806b4040, 0xda53231d, 0x23280805,
-    0x4040f8fe, 0x9f2a2a96, 0x3d1e261e, 0x5a261f27, 0x6767592b, 0x37243911,
-    0x48010148, 0x48392437, 0x153fd42b, 0x001e271f, 0x07200082, 0xb5227784,
-    0x7784b501, 0x29056756, 0x001b0017, 0x27013f00, 0x5e831107, 0x17072723,
-    0x217d8207, 0x0c820713, 0x03247282, 0x6a213521, 0x02827182, 0x824a0121,
-    0x2a812204, 0x2d0582ab, 0x802a2ac9, 0xd6fe2a01, 0x261e2716, 0x73822c01,
-    0x26b6fe34, 0x3f35271e, 0x269e013f, 0x3f14271f, 0x0080d7fe, 0x6b840900,
-    0x6b86eb20, 0x25090d64, 0x002b0027, 0x5e823700, 0x1320d283, 0x830ac95c,
-    0x2076830f, 0x20838213, 0x06bd6627, 0x0b823720, 0xd8824c20, 0x2a2a7923,
-    0x0a425515, 0x40407523, 0x2095853b, 0x2019821e, 0x2a0d85c0, 0x1e271e34,
-    0x2b013f7a, 0x85364802, 0x483631fb, 0x27a32b94, 0x0601271e, 0x7a1f261e,
-    0xa42b953f, 0xf341a582, 0x01e73506, 0x00040080, 0x001e0011, 0x26372100,
-    0x22130722, 0x3e170706, 0x07dea518, 0x3a080c8b, 0x214d0001, 0x414d2158,
-    0x28263075, 0x28626c62, 0x41753026, 0x27214e2b, 0x3a423a18, 0x4e212718,
-    0x01191966, 0x3325281a, 0x1e22221e, 0x80282533, 0x1233181b, 0x33121414,
-    0x8a001b18, 0x0014296b, 0x00290020, 0x17071300, 0x36216782, 0x2f058937,
-    0x03371737, 0x36170722, 0x17163233, 0x07012e37, 0x08840b82, 0x201c313b,
-    0x11260d0e, 0x15183012, 0x371e1927, 0x344d1f29, 0x45951b46, 0x2926333d,
-    0x24848536, 0x28440c0c, 0x3a80821f, 0x1f1b8001, 0x0d330a09, 0x0f0b300a,
-    0x360a1233, 0x46661703, 0x65011b46, 0x850a3317, 0x44012391, 0x8e84170a,
-    0x20088759, 0x2d998221, 0x0010000c, 0x00340019, 0x35232500, 0x9b463733,
-    0x8b838205, 0x3327290c, 0x07061407, 0x2737012e, 0x33300787, 0x013e3717,
-    0x011f1632, 0x28287d01, 0x0e130e03, 0x51260282, 0x0d042828, 0x02820d15,
-    0x2d2bc229, 0x0e13130d, 0x841c1d01, 0x2a2d3306, 0x15061e25, 0x1d061602,
-    0x0a2f8357, 0x0e140d0d, 0x0887bc0e, 0x029f0129, 0x1c03031c, 0x85686802,
-    0x8d9f2807, 0x09091473, 0x7e007314, 0x3f220833, 0x9b823a00, 0x06072733,
-    0x27262307, 0x3527012e, 0x06221533, 0x17011e17, 0x220c8237, 0x8507012e,
-    0x218a820f, 0x0b833637, 0x0f010e23, 0x200c8301, 0x0819822e, 0x06151759,
-    0x3f01010f, 0x0f112236, 0x0630300a, 0x0b6c0e1e, 0x380e0315, 0x2009330d,
-    0x0a160508, 0x030d0a5f, 0x200f070a, 0x0c522209, 0x05270615, 0x06521712,
-    0x1b550614, 0x802c670a, 0x6e1f2140, 0x011f0e6d, 0x0a0c0a0a, 0x601f831f,
-    0x09104911, 0x090a0105, 0x10130a08, 0x82144322, 0x0b013109, 0x280d5209,
-    0x080bbd34, 0x09010a01, 0x00ef1901, 0x9624b387, 0x0f005601, 0x1727b382,
-    0x07272315, 0x82373523, 0x371728b2, 0x1f011533, 0x87761f76, 0x8ac02002,
-    0x0000220b, 0x9f821803, 0x07280808, 0x1b000b00, 0x33370000, 0x33153335,
-    0x21052135, 0x21012115, 0x11171632, 0x2123010e, 0x11272622, 0x5580013e,
-    0x00ff5556, 0x4609c663, 0xff2105d1, 0x27078400, 0x962b2bd5, 0x800196c0,
-    0x08134118, 0x18125623, 0x06f74700, 0x9765ab20, 0x13003806, 0x13211121,
-    0x55352115, 0xaafe5601, 0x0100012b, 0x01aafe6b, 0x41d5d500, 0xab220673,
-    0x9183eb00, 0x35212523, 0x05ba5a21, 0x54569521, 0xab23089b, 0x83009601,
-    0x000f25a3, 0x1300001f, 0x0520a58a, 0x11202d82, 0xb583a99e, 0x012aad8c,
-    0x562b2b15, 0x406b6b80, 0xb08c4001, 0x22058f45, 0x826b01ab, 0x000d226b,
-    0x2b698411, 0x15231121, 0x33150121, 0x07152335, 0x55240582, 0x56000156,
-    0x2b255083, 0x01ab55ab, 0x820a8215, 0xab802710, 0x8080552b, 0x8f490000,
-    0x0a1b6607, 0x35372908, 0x15371537, 0x17073507, 0x15252715, 0x80403527,
-    0x8095d6eb, 0xd66b0180, 0x8a1c70c0, 0x8f03bbbe, 0x199202a6, 0x9628ba75,
-    0xcb71eb82, 0x05250809, 0x37003000, 0x4c004000, 0x00005800, 0x17373437,
-    0x0e25012e, 0x27010f01, 0x27263637, 0x27230607, 0x021f010e, 0x270d8607,
-    0x013e012b, 0x17163233, 0x31050e57, 0x1f07011e, 0x22230601, 0x15161327,
-    0x3707010e, 0x6f4f2f36, 0x5913200b, 0x1882055e, 0x49011e3d, 0x382e5710,
-    0x07013201, 0x15421306, 0x11070208, 0x07301010, 0x1d130701, 0x82154328,
-    0x12200807, 0x190c0f10, 0x3f243050, 0x100e0319, 0x0906070a, 0x1d013978,
-    0xd5191b20, 0x29310116, 0xa2010f38, 0x260ac74a, 0x0373565b, 0x84567303,
-    0x28c03905, 0x5717f023, 0x131d0b40, 0x0202c43d, 0x0102010d, 0x020d0103,
-    0xc5784d02, 0x26390d85, 0x13161a2d, 0x090b1419, 0x039a2a19, 0x0801070a,
-    0x53333028, 0x1b27a118, 0x0ae17890, 0x8761fe21, 0x2054824e, 0x41008200,
-    0x9629079b, 0x0e000800, 0x00002600, 0x33c38225, 0x2e352115, 0x011e2701,
-    0x27373632, 0x23011d22, 0x07062635, 0x33230282, 0x8207012e, 0x23153d02,
-    0x01233435, 0x02604900, 0x60025601, 0x4830019e, 0x0a600130, 0x032a0316,
-    0xd6010e01, 0x09829982, 0x0a162108, 0x24300180, 0x30242b2b, 0x30302481,
-    0x400a9524, 0x2d240135, 0x12120a01, 0x242d010a, 0x0a403501, 0xd6207b88,
-    0x2c069368, 0x0100001a, 0x01211521, 0x35233533, 0x05f94f21, 0x07353808,
-    0x32333517, 0x23263436, 0xfec00121, 0xfe800180, 0x01959580, 0x19191140,
-    0x55552b11, 0x27272f2b, 0x01c0fe2f, 0x00ff2a55, 0x3212562a, 0x40402b12,
-    0x2a57292b, 0x72000100, 0xae22050f, 0xcf821700, 0x26362723, 0x21b58227,
-    0xc4550717, 0x37370805, 0x3f321617, 0x01013e01, 0x100fc2e4, 0x2855211f,
-    0x135e405c, 0x4e1f200f, 0x1007c226, 0x01083107, 0x4f25c22b, 0x110d201f,
-    0x285c405c, 0x101f2155, 0x0707c20f, 0x88110731, 0x01c028af, 0x00080080,
-    0x83220012, 0x1107315b, 0x11211123, 0x27170723, 0x0f012f37, 0x27071701,
-    0x6318ba82, 0x01320b90, 0x2a6b6b6b, 0x6b2a2a01, 0x392b0d30, 0x2b391515,
-    0x7364650d, 0x12d63a06, 0x354b1919, 0xfe0a0135, 0x9e2a01d6, 0x0524371d,
-    0x24053434, 0x1219e637, 0x201a83fe, 0x4a268312, 0x11350b9f, 0x48002300,
-    0x36130000, 0x32333637, 0x1716011f, 0x26070626, 0x20048227, 0x31058205,
-    0x07010e07, 0x1e17011e, 0x013e0701, 0x26072634, 0x1183012f, 0x3726222b,
-    0x2e37013e, 0x26012f01, 0x5b208227, 0x3420085f, 0x7b083182, 0x01038927,
-    0x313d4033, 0x1c030405, 0x21310559, 0x0104120e, 0x0d010213, 0x2330070d,
-    0x18193603, 0x1d1a0816, 0x2915671e, 0x3c134812, 0x14020206, 0x01154011,
-    0x1501151c, 0x010c0b15, 0x78021e1b, 0x1e512f5b, 0x0e06150c, 0x01027101,
-    0x03041e21, 0x06351403, 0x03030a25, 0x02012004, 0x1a01020c, 0x273b011f,
-    0x1d294325, 0x884a5449, 0x4a122917, 0x32205113, 0x14542536, 0x010e1a01,
-    0x092e1f82, 0x2b4a1d01, 0x2502785b, 0x1f250120, 0xd3441108, 0x01dd3006,
-    0x0017004c, 0x37000020, 0x0607010e, 0x82333726, 0x331729bf, 0x011f1636,
-    0x27061633, 0x0e20c883, 0x3406d752, 0x1f281fbb, 0x053d0f23, 0x183d030a,
-    0x033d1872, 0x0f3d050a, 0x3d138223, 0x0c0c0945, 0x700c0c12, 0x02123102,
-    0x03128671, 0x17111117, 0x71861203, 0x02311202, 0xd95101bb, 0x4f002005,
-    0x6b210a87, 0x05e34d00, 0x37130026, 0x23270701, 0x3f217684, 0x22728701,
-    0x53360107, 0x2b260849, 0x1b65011b, 0x77845085, 0x85693b21, 0x01362673,
-    0x15eafe1c, 0x26738548, 0xfe1b5001, 0x83851b9b, 0x846f2279, 0x2676831f,
-    0x010a7277, 0x871d0417, 0xff052376, 0xe88200fe, 0x82560121, 0x001f2973,
-    0x00320023, 0x27000036, 0x25058e6d, 0x27071707, 0x105c2507, 0x013d3105,
-    0x013b3634, 0x33352335, 0x07151632, 0x07331523, 0x27231785, 0x82013e35,
-    0x07332b17, 0x01152335, 0x40214545, 0x05842140, 0x0ce00131, 0x19124009,
-    0x552a1219, 0x2b0c096b, 0x83802a2a, 0x0118240f, 0x82121801, 0x5a2b2f0c,
-    0x4b1b5251, 0x51521b4b, 0x164c4c1b, 0x26820c09, 0x2b191227, 0x6b090c2a,
-    0x260d842a, 0x40181280, 0x5c8080ea, 0xc22408bf, 0x11009601, 0x00269d82,
-    0x0f062201, 0x5d691701, 0x2f3a0805, 0x26363701, 0x06220523, 0x0607011f,
-    0x32013b16, 0x27013f36, 0x0123012e, 0x02070779, 0x08025789, 0x05053e07,
-    0x03885702, 0xbffe0605, 0x29030505, 0x06040241, 0x0208073d, 0x1b822a42,
-    0x0795013a, 0x04a1f304, 0x9f050807, 0x540805f1, 0x73490508, 0x04070805,
-    0x07054976, 0x20068b41, 0x05436400, 0x6706e769, 0x07230fe5, 0x82163233,
-    0x0616248a, 0x8326012b, 0x33072289, 0x23878316, 0x26222307, 0x26288682,
-    0x16106636, 0x34011016, 0x43300583, 0x0204042b, 0x03023c5f, 0x020a2b04,
-    0xb7035f3d, 0x1e310682, 0x2b0a022f, 0x2e010303, 0x0103011e, 0xfe101680,
-    0x382f87cc, 0xa904052b, 0x0105046f, 0x07aa7007, 0x3307013a, 0x06010753,
-    0x03325104, 0x0aa75106, 0x1b000b24, 0x9f822b00, 0x9f0ad34a, 0x0c82678f,
-    0x04280937, 0x39590103, 0x28040301, 0x59390308, 0x0928aa03, 0x032b1c02,
-    0x24168208, 0x021b2a02, 0x7c811803, 0x0553380c, 0x03679d04, 0x68060105,
-    0x0136079e, 0x064d3006, 0x4b040501, 0x4105042e, 0xdf200927, 0x08ef5b18,
-    0x01003008, 0x37270317, 0x07173527, 0x15372535, 0x01151707, 0x2a502a13,
-    0x89894ddf, 0x4d89cdfe, 0x0980014d, 0xb70989fe, 0x89893c4d, 0x3c894c3d,
-    0x423d4c4d, 0x80290af7, 0x26001d00, 0x00002f00, 0x05005f25, 0x2637272a,
-    0x06272627, 0x27012e23, 0x26059355, 0x17160714, 0x85271716, 0x3634221d,
-    0x07784337, 0x2480013d, 0x30483030, 0x0b010201, 0x261f0a07, 0x01014f3b,
-    0x4e3b3b4f, 0x07011201, 0x5cce170c, 0x39280557, 0x52363629, 0x01953636,
-    0x30252882, 0x0c171224, 0x211e8207, 0x2b853b4e, 0x0a1f2627, 0x58010b07,
-    0x054c5c01, 0x83016b21, 0x36522129, 0x00209a82, 0x2808e482, 0xaa01e6ff,
-    0x0f009701, 0x29001b00, 0x40003400, 0x36130000, 0x0714021f, 0x2f26010e,
-    0x3e372601, 0x011f1301, 0x07060716, 0x230d8206, 0x36262736, 0x14280d83,
-    0x06010f06, 0x14172627, 0x2628c082, 0x1636013f, 0x26223715, 0x0807946b,
-    0x13e2077e, 0x04050502, 0x050e0d04, 0x0e130c50, 0x52066a34, 0x1d0f0915,
-    0x05310a10, 0x0c01cf0b, 0x01104d15, 0x164e070a, 0x189f0304, 0x0a0e1b22,
-    0x35180839, 0x1b060b0c, 0x1e0d0a1c, 0x010e040d, 0x44150195, 0x080a0b59,
-    0x87090b03, 0x10080c12, 0x1e01eefe, 0x19241407, 0x0c55100d, 0x2b181213,
-    0x10062108, 0x1a020908, 0x880d1708, 0x1406051a, 0x0a4c0e0c, 0x14460d0a,
-    0x0d27270a, 0x10261b0b, 0x3b70d282, 0x00022d0b, 0x3f000022, 0x1e372701,
-    0x14171501, 0x0e24c782, 0x22072301, 0x2e24b782, 0x34273501, 0x3e38b382,
-    0x32373301, 0x6fd51617, 0x0404f76f, 0x1d080901, 0x2223530f, 0x081d2186,
-    0x80280d8c, 0x0f274040, 0x46121333, 0x0d8b1889, 0x37092b42, 0x008001c0,
-    0x00170007, 0x25000027, 0x35233523, 0x35331533, 0x15331523, 0x0f850b84,
-    0x4a183720, 0x01210e9b, 0x24008b2b, 0x13d6fe6a, 0x06266b18, 0x18825520,
-    0x2a2b8024, 0x03822b2a, 0x13185522, 0x0c22a718, 0x2e08834c, 0x000f006b,
-    0x0024001b, 0x00390030, 0x18210100, 0x2b0ea1c1, 0x34012e07, 0x0e173736,
-    0x17161401, 0x2c075e69, 0x013e2717, 0x37272634, 0x0614011e, 0x08654227,
-    0xaafeab23, 0x9caf1812, 0xe9fe2307, 0x0082191f, 0x13121e2b, 0x30246d13,
-    0x30304830, 0x200b8355, 0x20158313, 0x054b5092, 0x6d180120, 0xfe2e0f94,
-    0x3e1a1ffc, 0x1e1a3e42, 0x2e322f13, 0x3483010e, 0x25304822, 0x2f210d83,
-    0x20198412, 0x407e188a, 0x00062109, 0x012f0082, 0x006b01d6, 0x001f0013,
-    0x00270023, 0x7f2f002b, 0x15210b2f, 0x069b5223, 0x7f212321, 0x33260813,
-    0x33152535, 0x03822135, 0x07860520, 0xaa802b25, 0x842a2a80, 0x2a012e04,
-    0xaa2b2baa, 0x2bd5fe2b, 0xfe2b0001, 0x260583aa, 0x2b2b6b01, 0x83805680,
-    0x2a2a2204, 0x21028256, 0x00822b55, 0x0382d520, 0x7d822b20, 0x83040021,
-    0xeb012304, 0xc34f4001, 0x00112606, 0x15212500, 0x2d608221, 0x35330521,
-    0x07172523, 0x01173727, 0x294cff2b, 0xaaaa2f08, 0x9620a001, 0xeb402060,
-    0xaa2b802b, 0x0b84362a, 0x0b000022, 0xc0204784, 0x0320cb82, 0x4f06d94b,
-    0xc1700fa3, 0x82172006, 0x1f6a1807, 0x830f830b, 0x86252003, 0x8227201f,
-    0x6b402b7c, 0x6a6a8b6b, 0xfe6b6b8a, 0x4d182beb, 0x08840740, 0xababfe24,
-    0x0282d5ab, 0x6b800123, 0x8200832a, 0x063542d6, 0x80220983, 0xcf865656,
-    0x0021878b, 0x0a037137, 0x5d833520, 0x49800121, 0x078505d3, 0x6b2b5525,
-    0x83408016, 0x0003233b, 0x3761ff00, 0x00182b05, 0x00230020, 0x37272500,
-    0x97823736, 0x08057c41, 0x26070653, 0x17162327, 0x17371707, 0x33032337,
-    0x33173337, 0x01173727, 0x38013713, 0x2a963f17, 0x2e16ef96, 0x182b131e,
-    0x6b1e6d28, 0x602b8942, 0x1865182b, 0x2322982b, 0x3f01357f, 0x2a2a2b4c,
-    0x21343e2b, 0x6b2d3426, 0x98426a1e, 0x404000ff, 0x005d5d6a, 0x087f4100,
-    0x0800962b, 0x19001100, 0x00002100, 0x08b16813, 0x17163222, 0x3e29af82,
-    0x14163701, 0x34362707, 0x20078727, 0x058d42c0, 0x75302435, 0x06aafe06,
-    0x2020d675, 0x6a0d0d24, 0x2d233f3f, 0x4255012d, 0xd4230673, 0x822b2a2b,
-    0x25ce2f02, 0x13242155, 0x436b142c, 0x352241a6, 0x7282337e, 0x82020021,
-    0xf13808e7, 0x8e01ab01, 0x17000e00, 0x27010000, 0x14010e07, 0x3e32021e,
-    0x05263402, 0x013f3634, 0x15011e17, 0x79797901, 0x33191919, 0x333e423e,
-    0xeefe1919, 0x5a5a1313, 0x15011313, 0x3f351582, 0x19324040, 0x40403219,
-    0x2d20673f, 0x115e5d11, 0x0100202c, 0x3b008200, 0x8001c001, 0x00000500,
-    0x1f150501, 0xc0013301, 0x399280fe, 0xa1800114, 0x00923914, 0x04200082,
-    0x2008c357, 0x06ef4219, 0x7b6e0020, 0x36322606, 0x010e3537, 0x08044607,
-    0x012e332d, 0x37171507, 0x15173527, 0x82073533, 0x07d94603, 0x1b41243b,
-    0x49274118, 0x60020260, 0x14533749, 0x5e6d162e, 0xa0601070, 0x012a2a2a,
-    0x054b5795, 0x3a141623, 0x0681541b, 0x3a010232, 0x69524230, 0x391b4480,
-    0x95955670, 0x002a2ac0, 0xea26fb84, 0x96015601, 0xfb830800, 0x6a6d1320,
-    0x26222c05, 0x27263417, 0x0622012e, 0x8233011d, 0xc033246e, 0x82182518,
-    0x17952c02, 0x37240113, 0x40402a24, 0x83126b01, 0xad182c10, 0x1b092215,
-    0x961b2424, 0x42006a6a, 0xd920052f, 0x05234b82, 0x82001400, 0x3725215c,
-    0x0633c482, 0x011e3337, 0x2306010f, 0x26272627, 0x27013e37, 0x5317011e,
-    0x06210afb, 0x3ee58417, 0x16830301, 0xb0211430, 0x090a0d06, 0x080807d5,
-    0x3e05010d, 0x49a66830, 0x0d21156e, 0x82375413, 0x08bc82e1, 0x4303012e,
-    0x79020153, 0x16058436, 0x01812213, 0x06d50a1a, 0x6d0d0601, 0xa9162c3e,
-    0x02435301, 0x02013a30, 0x54374960, 0x15171713, 0x785b496e, 0x08096341,
-    0x8001de26, 0x2f002600, 0x35003200, 0x22010000, 0x15230706, 0x16060733,
-    0x012f3632, 0x15171633, 0x35211523, 0x37363523, 0x35231388, 0x18012e23,
-    0x3d08b34b, 0x25231707, 0x00012317, 0x84072015, 0x29073f2a, 0x3f082a51,
-    0xc01c0b43, 0x1cc0aa01, 0x1083430b, 0x3f092b27, 0x2007842a, 0x057f4a15,
-    0x40208224, 0x03823601, 0x14178025, 0x8220962a, 0x1c962800, 0x2a2aef0b,
-    0x851c0bef, 0x142a230d, 0x004b2b17, 0x50702305, 0x174f5050, 0x00002805,
-    0x80010002, 0x44000f00, 0x24250525, 0x00002d00, 0xa1801813, 0x4105200e,
-    0x072006fb, 0x05200782, 0xb482c382, 0x45012e21, 0x2b2208a9, 0x0450aa01,
-    0x56fe2105, 0x01220784, 0x0082aa12, 0xebfe9537, 0x01045824, 0x24580400,
-    0x3724241c, 0x80012424, 0xfe121801, 0x392284d6, 0x122a0112, 0x15153f18,
-    0x2a15152b, 0x22541616, 0x20151520, 0x2401a922, 0x02822436, 0x46000021,
-    0x0230054b, 0x00560100, 0x00100008, 0x00250019, 0x25000029, 0x17227987,
-    0x88821716, 0x3e288182, 0x22263401, 0x17161406, 0x232c0883, 0x14160722,
-    0x23271607, 0x15013315, 0x6a267a86, 0x0240011c, 0x8085b039, 0x241b863c,
-    0x0a0a1b24, 0xcb0a1313, 0x20ababab, 0x202b2b20, 0x25170420, 0x1f182b2b,
-    0xa1830133, 0x01243722, 0x03260783, 0x041a451a, 0x86822b16, 0x00020022,
-    0x3f080082, 0x9601cb01, 0x13000300, 0x21370000, 0x1f372115, 0x013e1601,
-    0x15032f26, 0x3515022f, 0x6afe9601, 0x0d725c9a, 0x0d0d0716, 0x6a293b71,
-    0x2b2b1f14, 0x031e19a5, 0x04161b0c, 0xb00ac11e, 0x6e08321c, 0x47854282,
-    0x7401da22, 0x12204782, 0x25284785, 0x010f012e, 0x07170727, 0x25220382,
-    0x4984013e, 0xa2012108, 0x720d1604, 0x6a582993, 0x01381f2a, 0x2b0d0d61,
-    0x0d0df22b, 0x0b891e03, 0x08201c99, 0x16045f60, 0x220cbb43, 0x82070003,
-    0x821f2095, 0x1533234f, 0x03823523, 0xa14a3720, 0x4303200a, 0x0e2308c2,
-    0x822aeb01, 0x50152000, 0xb7430b55, 0x24058405, 0x80d62b80, 0x05b143ea,
-    0x5b780226, 0x82fe785b, 0x0c0eee18, 0x1b476382, 0x057b5105, 0x0d000a23,
-    0x194c1800, 0x06154207, 0x37150526, 0x25170725, 0x2c0a2342, 0x80abd695,
-    0x0156ebfe, 0xfe565655, 0x2b0b82bf, 0x8001d6ab, 0x2b552b2b, 0x56ac152b,
-    0x6b200082, 0x080c5818, 0x2105b743, 0x734501d6, 0x00212c05, 0x06221300,
-    0x3533011d, 0x88073533, 0x20d38208, 0x5d441815, 0x1255290a, 0x80d62a18,
-    0xd52b1813, 0x3506467f, 0x181812ab, 0x18950112, 0x2ad6d612, 0xd5131855,
-    0x01552bd5, 0x15841218, 0x01200482, 0x20066744, 0x256382ab, 0x00180014,
-    0x75530500, 0x013b2606, 0x35173715, 0x058a5333, 0x23352725, 0x53800115,
-    0x12230672, 0x86353615, 0x1580215b, 0x56255a82, 0x20951812, 0x23608220,
-    0x1812aafe, 0x274dc482, 0x82eb2008, 0x00033153, 0x01000027, 0x25371507,
-    0x11070626, 0x37331614, 0x2c053252, 0x1716023e, 0x37013e16, 0x11272611,
-    0x08cc8226, 0x2e110750, 0x6a950101, 0x20f6fe6a, 0x0407183e, 0x18371705,
-    0x17183e1f, 0x17343742, 0x01060702, 0x27241813, 0x1817421c, 0x6095013e,
-    0x01aa60ea, 0xc8fe120f, 0x0b010605, 0x0e110f0d, 0x0c0b0111, 0x04060101,
-    0x080e3701, 0x010be0fe, 0x20010e12, 0xd78c0f12, 0xd7972020, 0x0b747218,
-    0x6723df91, 0x822b2b2a, 0x82e49002, 0x2a2a2213, 0x20e7822b, 0x38038207,
-    0x01d60100, 0x00150056, 0x00210019, 0x0033002a, 0x0045003c, 0x15071300,
-    0x0da56e23, 0x35012b29, 0x15330727, 0x6e331723, 0x07200513, 0x8708374c,
-    0x22072208, 0x05916206, 0x08873320, 0x2b2a9528, 0x090c0c09, 0x05838001,
-    0xd62a2b2b, 0x2a56d6d6, 0x0a2a0a0a, 0x05876241, 0x0685db20, 0x524ca520,
-    0x85b22005, 0x55012606, 0x090c162a, 0x823183ab, 0x2a162a04, 0x0115162a,
-    0x13010113, 0x063d441f, 0x07860120, 0xa3681f20, 0x83058505, 0x460520c6,
-    0x0b2808f3, 0x23001700, 0x35002c00, 0x630ed34d, 0xe15d0d3d, 0x08085011,
-    0x200cdd4d, 0x0a4b435b, 0xcb584920, 0x4836200a, 0x9e4a061a, 0x0b527506,
-    0x0b70f118, 0x5e6e2920, 0x482a200a, 0x29200631, 0x2007994a, 0x2ab38802,
-    0x00240018, 0x26221700, 0x7123013d, 0x152a09d1, 0x2b061411, 0x23060701,
-    0x0c490703, 0x37272705, 0x09c00727, 0x384b560c, 0x82122708, 0x0208074f,
-    0x7318371e, 0x152708f9, 0x1940090c, 0x83000112, 0x00ff2c21, 0x064f1912,
-    0x371e5501, 0x82381e38, 0x44248202, 0x0b240c5f, 0x2b001f00, 0x08f38918,
-    0x012e212c, 0x3f341135, 0x33173302, 0x7982011e, 0x36270723, 0x054f6e37,
-    0x011e172c, 0x27373217, 0x012f012e, 0x0b823706, 0x1a821420, 0x011b1a3c,
-    0xfe2b1b76, 0x021812f0, 0x2b802b68, 0x0e181240, 0x01010e6b, 0x171e2d3d,
-    0x0682194f, 0x2610103e, 0x26032017, 0x241b6b05, 0x0a510401, 0xfe1b6101,
-    0x012a1b8a, 0x00011218, 0x2a1e0607, 0xff2d0983, 0x6b0c1400, 0x3d2d1e17,
-    0x4f0e0101, 0x2e0682ab, 0x20032605, 0x30102617, 0x0b1b2401, 0x4304510a,
-    0xd6260887, 0x0b009601, 0xff641100, 0x3713250d, 0x07270727, 0x250ca941,
-    0x771e9546, 0x6d4f1e42, 0xcdfe210c, 0x4a821384, 0x220cef4f, 0x8d1d0017,
-    0x4517204d, 0x27240b59, 0x17371737, 0x0342598c, 0x605e240b, 0x8d77421e,
-    0x0bef4165, 0x84f7fe21, 0x0b23581f, 0x13000a24, 0x6f823100, 0x15010e27,
-    0x36321614, 0x0b014837, 0x1d06222a, 0x012e2301, 0x2634013d, 0x6205255f,
-    0x2b3a0513, 0x26343501, 0x1c0b0123, 0x24372424, 0x1b240101, 0x120c0c09,
-    0x092d0c0c, 0x09842b0c, 0x01211283, 0x280a8200, 0x090c4009, 0x49039501,
-    0x2329821e, 0x5d491e1c, 0x2705fe47, 0xab090c60, 0x15090c01, 0x15222083,
-    0x1482241c, 0x0c09ab23, 0x82938400, 0x01ab2a87, 0x0008006b, 0x001d0011,
-    0x08726c00, 0xc5431720, 0x43132007, 0x9a270a25, 0x3a26261d, 0x42bf2727,
-    0x1a2705e2, 0x01013a2c, 0x832b2c3a, 0x01d12105, 0x3a221883, 0xc9426526,
-    0x88012006, 0x2c2b2319, 0x5218003a, 0x822f0867, 0x1b000b00, 0x22001e00,
-    0x37130000, 0x42270701, 0x37250563, 0x27213505, 0x06644221, 0x2335332e,
-    0x27332327, 0x2733011d, 0x7c011b14, 0x37065342, 0xfcfe7e01, 0x122f012b,
-    0x04200e18, 0x107c5684, 0x0180e510, 0x85fe1b66, 0x3a084242, 0x012b2b38,
-    0x00ff1218, 0x80200c14, 0x80651055, 0x00020080, 0x01d5ff00, 0x829601c0,
-    0x18122073, 0x080bc78c, 0x05032731, 0x21272137, 0x1c152703, 0x1f1b8f01,
-    0x10d6100b, 0x01200218, 0xecfe093c, 0x246f012b, 0x1b6501cb, 0x1f1c71fe,
-    0x01101509, 0x2a561a1f, 0x42cab6fe, 0x2c3a0a2b, 0x44003800, 0x3e370000,
-    0x1e323302, 0x34331502, 0x2223022e, 0x011d020e, 0x11821e14, 0x37023e25,
-    0x820e1423, 0x022e2411, 0x4734013d, 0x2408179e, 0x0f0902d7, 0x090c080c,
-    0x130b2606, 0x1f15101b, 0x15090a14, 0x1a0f151f, 0x26010b14, 0x070c0a06,
-    0x04090f0c, 0x0bbd472b, 0x02614825, 0x84486102, 0xd8230805, 0x060a100b,
-    0x0f070d09, 0x0f0a1219, 0x06122119, 0x0e182212, 0x0d171109, 0x04080c06,
-    0x0b151109, 0x57c70b06, 0x82200bfd, 0x3e823887, 0x01000025, 0x4bff0000,
-    0x3a080583, 0x25000025, 0x3317011e, 0x26222315, 0x2b010e27, 0x3e333501,
-    0x2e113701, 0x35232701, 0x17163233, 0x013b013e, 0x010e2315, 0x01150107,
-    0x352a090c, 0x0101150a, 0x2a350a15, 0x8f010c09, 0x822b200f, 0x0c2a2513,
-    0x2a0c0909, 0x01201982, 0x0d882183, 0x63420020, 0x01963608, 0x00090080,
-    0x001d0015, 0x16143700, 0x3632013b, 0x17211135, 0x26018237, 0x27071707,
-    0x823f2707, 0x23073178, 0x80352115, 0x12aa1219, 0x3400ff19, 0x1e2d2d1f,
-    0x69330286, 0x4a166a16, 0x122b2a01, 0x01121919, 0x2e1e6800, 0x852e1e2e,
-    0x15d6251c, 0x002b2b15, 0x21053f4a, 0x034fd601, 0x20678408, 0x06254925,
-    0x07821520, 0x16140523, 0x26e08217, 0x3723013d, 0x83232723, 0x40013e68,
-    0x95955555, 0x00ff8080, 0x12801219, 0x40ebd518, 0x40155516, 0x2b6b0001,
-    0x2b2b2ad5, 0x05b64a55, 0x1640d525, 0x84002a16, 0xff39085f, 0x01c001ea,
-    0x00130096, 0x00260019, 0x00490033, 0x0f062500, 0x2f220601, 0x35272601,
-    0x36013f36, 0x16011f32, 0x15072717, 0x07353717, 0x011d011e, 0x26220614,
-    0x3634013d, 0x05374717, 0x82363221, 0x07262a0c, 0x3e352315, 0x012e3701,
-    0x283c8222, 0x1e373626, 0x010e0701, 0x28598207, 0x0e05a90a, 0x010aa905,
-    0x08088701, 0x9595c02f, 0x1f175695, 0x1f1f2f1f, 0x0d0d0917, 0x540d0d13,
-    0x0540046d, 0x13031301, 0x13022003, 0x01102528, 0x60043905, 0x045e060d,
-    0x0d065e04, 0x2a0887c0, 0x54a65447, 0x0103a654, 0x8239171f, 0x2304833d,
-    0x3b0a0d1e, 0x09384182, 0x6c0d0a3b, 0x45041619, 0x09061214, 0x2e040212,
-    0x09250204, 0x00023c1d, 0x26080b4f, 0x008a01ee, 0x820d000a, 0x821c20e1,
-    0x153322dd, 0x34ac8223, 0x33372723, 0x17353307, 0x37262221, 0x17323613,
-    0x25061613, 0x085d8221, 0x21121231, 0x21430142, 0xfed72344, 0x070d0c56,
-    0x061806d5, 0xfe0d06d6, 0xb05f0170, 0x23231a7d, 0x39656b14, 0x010a16b6,
-    0xfe0a0a60, 0x2b160aa0, 0x7a002101, 0x0f260937, 0x26001300, 0x55183100,
-    0x21081183, 0x11211117, 0x17010e07, 0x36373634, 0x010e1716, 0x27260627,
-    0x0717013e, 0x011d0622, 0x3632011e, 0x7d182634, 0x013b0cdd, 0x1127772a,
-    0x0c121102, 0x2201021d, 0x05410403, 0x1f064c06, 0x0e010c0c, 0x7d0d0c14,
-    0x20080dab, 0x01d6fe2b, 0x2503602a, 0x010c0103, 0x201f1801, 0x0c040118,
-    0x0418483f, 0x0f010e50, 0x1a0f0f0d, 0x08e34111, 0x9601d626, 0x1d001400,
-    0x36329f82, 0x00003a00, 0x17163201, 0x011e0706, 0x22061415, 0x97823526,
-    0xcf489084, 0x87272007, 0xea581808, 0x34262108, 0x08050942, 0x17072740,
-    0x1c160001, 0x0b130101, 0x1f301f0d, 0x01130b0d, 0x0a151d01, 0x0d140d0d,
-    0x0b080a0d, 0x0b0b100b, 0xb20909c4, 0xb10c1c0b, 0x0cb10b0b, 0xb1980b1c,
-    0x1001b1b1, 0x0d17131a, 0x140d1407, 0x04821a1a, 0x170d072c, 0x0d5e1a13,
-    0x140e0e14, 0xc745430d, 0x0c1b2105, 0x37833087, 0x3382cb20, 0x200b1b5e,
-    0x18b98208, 0x1809af5a, 0x20090e4e, 0x8f61182e, 0x0abb4809, 0xaa459520,
-    0x4bd52006, 0xeb600dfe, 0xd6420806, 0x0400b301, 0x17000800, 0x27250000,
-    0x25352115, 0x17273717, 0x07061415, 0x3d012e21, 0x013f3601, 0x00011617,
-    0xfe5601ab, 0xabababaa, 0xfe1218d5, 0x011812aa, 0x13c1c113, 0xa3a36b78,
-    0x6b6a6a32, 0x4243d56b, 0x0c192506, 0x000c7878, 0x24091355, 0x000a006b,
-    0x28558318, 0x37363435, 0x1d011e21, 0x20558702, 0x22678217, 0x82000137,
-    0x5601234d, 0x53851812, 0x56012a26, 0x1085ab2a, 0x10214b85, 0x240785f0,
-    0xa3a31bbe, 0x095b441b, 0x8001b637, 0x34002b00, 0x00003a00, 0x07273101,
-    0x15010e17, 0x32331614, 0x28ae8237, 0x013d2622, 0x012b012e, 0x066b7935,
-    0x35331123, 0x241c8233, 0x013d3632, 0xdb621834, 0x35073708, 0x33153723,
-    0x174fa601, 0x1e130f2d, 0x0c0a0b17, 0x18010c12, 0x03821512, 0x70828020,
-    0x1e20d627, 0x09351e2e, 0x3015820c, 0x552bde0c, 0x4f26012b, 0x1b062d16,
-    0x041e1711, 0x3315829a, 0x19126009, 0x19191295, 0xa0abfe12, 0x1e1e166b,
-    0x2c17cb16, 0x2305ad41, 0x6ba060ab, 0x8225f789, 0x3c002800, 0x05f14c00,
-    0x17161422, 0x617a8586, 0x06222905, 0x2206011d, 0x26343527, 0x213d0989,
-    0x15010f06, 0x17331523, 0x35333733, 0x3e373523, 0x40262701, 0x181d0c09,
-    0x18121c12, 0x2261821d, 0x86011401, 0x01220805, 0x4b04045f, 0x80161555,
-    0x35551515, 0x08040408, 0x090c8001, 0x0a2a1b76, 0x12120e86, 0x2a0a860e,
-    0xa883761b, 0x09095623, 0x3e078956, 0x502d0201, 0x2bd5d52b, 0x10042039,
-    0x00000c08, 0xff000003, 0x01d601d5, 0x001a0080, 0x472a0022, 0x23310631,
-    0x010e012f, 0x012e012b, 0x013b3634, 0x27333717, 0x82088323, 0x17372507,
-    0x07270733, 0x2d05cb75, 0x011b2b35, 0x2f2b1b7a, 0x0b022f07, 0x6283c008,
-    0x206b2108, 0xba150f20, 0x863a1c24, 0x1b25182f, 0x21841b53, 0x1c6a1c24,
-    0x1b500124, 0x2b1c86fe, 0x09083135, 0x2035bb83, 0x241c1520, 0x6b0a6140,
-    0x1b7185e9, 0x24010124, 0x0000001b, 0x26038201, 0x01960100, 0x8207006b,
-    0x33152283, 0x28018211, 0x40756b35, 0x406b0175, 0x201d82ff, 0x201f8240,
-    0x20ab8204, 0x2bab82ff, 0x000800c0, 0x002b0015, 0x01000044, 0x2e056b4c,
-    0x14170622, 0x2e010f06, 0x36343502, 0x7d071632, 0x3b300a12, 0x14150601,
-    0x011f011e, 0x33150737, 0x26222306, 0x4a082082, 0x2b263717, 0x14062201,
-    0x36323316, 0x01273435, 0x1924184b, 0x8a19221a, 0x0b181830, 0x50383520,
-    0x111a1538, 0x1a11d6fe, 0x0484111a, 0x1f102536, 0x0830d520, 0x1e1e1628,
-    0x18170d2b, 0x32230120, 0x2d252332, 0x12600101, 0x82231919, 0x58202c23,
-    0x260c1c1c, 0x3828205e, 0x839ebf38, 0x2a013e34, 0x0c141a11, 0x112f6726,
-    0x1e082222, 0x202c2023, 0x3216160d, 0x252e3246, 0x02000409, 0x82008200,
-    0x006b24c3, 0x82340019, 0x010e27e9, 0x33171407, 0xa1833e37, 0x33373627,
-    0x012e3536, 0x22138227, 0x8307012e, 0x013b26a0, 0x3f321617, 0x20a78201,
-    0x08b28234, 0x2606072b, 0x0607012f, 0x4232a007, 0x1b570401, 0x2c071b06,
-    0xbc0e050d, 0x32420104, 0x1010321e, 0x0c097e32, 0x7734090c, 0x770e0e0e,
-    0x220a8334, 0x820714a2, 0x05142622, 0x026b010f, 0x27208242, 0x0e010d48,
-    0x010b1e72, 0x422e2a82, 0x171a0102, 0x0cb51a17, 0x0e760c12, 0x0682760e,
-    0x02103127, 0x0e31710e, 0x0c134501, 0x07000323, 0x05315200, 0x0713002a,
-    0x15333533, 0x15052733, 0x35220582, 0x0d821721, 0x86053521, 0x2ad52213,
-    0x32018240, 0x2b2a00ff, 0x2a010001, 0x4ec0fe2a, 0x4ea42aa4, 0x82809501,
-    0x15952200, 0x22008216, 0x82ea2b15, 0x205b8200, 0x2fff8603, 0x00060080,
-    0x001b0012, 0x33070100, 0x33352115, 0x82066869, 0x013e21fd, 0x2b0a814d,
-    0x2a0140d5, 0x2e22d540, 0x05470501, 0x01220282, 0x1f4e222e, 0xc0802406,
-    0x825cabab, 0x5533280e, 0x33550303, 0x5a302e22, 0x5e830667, 0x04830520,
-    0x01eb013c, 0x00080080, 0x00350017, 0x0047003e, 0x010e0100, 0x2721010f,
-    0x2207012e, 0x01830706, 0x27262123, 0x2b0e8526, 0x36321614, 0x36273437,
-    0x15061732, 0x20057046, 0x22238223, 0x6b072226, 0x224b0af7, 0x01260808,
-    0x01352c00, 0x1e00011e, 0x2f2c3501, 0x1521085c, 0xd6010121, 0x22152101,
-    0x20915d04, 0x2a402a2a, 0x180a0101, 0xb682010a, 0x202a2a32, 0x0a082518,
-    0x25080a22, 0x1e1e1718, 0xd71e1e2e, 0x01380685, 0x02160280, 0x16026666,
-    0x09010ba9, 0x01010b09, 0x0109090b, 0x3f2b400b, 0x05253182, 0x05020205,
-    0x2c488205, 0x15192b3f, 0x19150303, 0x2d1e0115, 0x2002821e, 0x4d078601,
-    0x80240a0f, 0x2f002400, 0x0722d984, 0xf37f1716, 0x32212f05, 0x34013d36,
-    0x07273727, 0x07062326, 0xa6503526, 0x82372005, 0x173223c8, 0x8748010e,
-    0x013b0805, 0x02674d0b, 0x011e1e01, 0x01121801, 0x15181315, 0x2c2c402a,
-    0x0c2e3c32, 0x17324202, 0x192b102a, 0x0b0a2340, 0x2b014133, 0x80014f01,
-    0x27364901, 0x4b322720, 0x12181812, 0x8223284b, 0x1728082a, 0x100e1d01,
-    0x090a281d, 0xab12112b, 0x354b0802, 0x4e3b3636, 0x00000300, 0xab01eaff,
-    0x1800ab01, 0x2c002000, 0x23010000, 0x2006ca42, 0x8f401815, 0x209b8207,
-    0x29138337, 0x1632013e, 0x17231517, 0x9e5a1523, 0x15332505, 0x15800133,
-    0x2005086d, 0x05ea4515, 0x84000121, 0x01d42a07, 0x01253825, 0x2a409784,
-    0x22028240, 0x6d2b1501, 0x2b22055d, 0x84181218, 0x2b260732, 0x1c25251c,
-    0x1e83aa2b, 0x43004021, 0xc024055b, 0x17008001, 0x00318382, 0x06222101,
-    0x3533011d, 0x35211121, 0x16141523, 0x28808233, 0x26341135, 0x27371703,
-    0x2c7d8207, 0xfe950133, 0x2b1813d6, 0xd6fe2a01, 0x06fb5a2b, 0x6b1ed033,
-    0xce371e6b, 0x188001ce, 0xfe555513, 0x125555d6, 0x241a8319, 0xf4fe1813,
-    0x231a821f, 0x00002a38, 0x0820678a, 0x252e6783, 0x33352337, 0x07173727,
-    0x1d163213, 0x6f842701, 0x82443720, 0x0133310a, 0xcfcf382c, 0x6a6a1f38,
-    0x2b19124a, 0x2a01d6fe, 0x79836d82, 0x73131825, 0x82382a38, 0x82012071,
-    0x2a632710, 0x39d6fe39, 0x6f87632a, 0x3305ef44, 0xf3010000, 0x0d008001,
-    0x1e001b00, 0x00002100, 0x23261513, 0x25053b5b, 0x35333537, 0xc8821517,
-    0x17072608, 0x37331537, 0x1f273727, 0x17150701, 0x1010d507, 0x52363629,
-    0x40560136, 0x3b3b0f31, 0x3d0a310f, 0x0b3d2e2e, 0x24008214, 0x06c68001,
-    0x2c1a8201, 0x40e02936, 0x0f315155, 0x310f3c3c, 0x2b1d8351, 0x34141429,
-    0x05001414, 0xf6ff0000, 0x05226f84, 0x6d821300, 0x27002422, 0x17207183,
-    0x05216982, 0x091b4f07, 0x13371722, 0x40317793, 0x1bdbfe56, 0x01332785,
-    0x28293601, 0x1b640335, 0x337f9117, 0x40794079, 0x02861b20, 0x36292736,
-    0x27330101, 0x1a011b65, 0x63418892, 0x01892208, 0x23958240, 0x25000009,
-    0x0730df82, 0x11330317, 0x62890123, 0x80801e62, 0x5e2b2beb, 0x01220884,
-    0x2e82ff00, 0x20069341, 0x2a2f8780, 0x17071713, 0x013b2737, 0x84772311,
-    0x2bc02425, 0x8422012b, 0x202d8209, 0x32e78204, 0x010002ea, 0x00200080,
-    0x00390030, 0x01000042, 0x73070622, 0x372105a8, 0x18018236, 0x240e65fa,
-    0x07012e27, 0x082f6515, 0x15233524, 0x294f3523, 0x0aac4408, 0x3180492e,
-    0x06350606, 0x1f1a0612, 0x672e010b, 0x0a58f818, 0x897f3227, 0x01087008,
-    0x22048280, 0x52152a2b, 0x0c440632, 0x2f352107, 0x352e3282, 0x0f180606,
-    0x0f420e06, 0x060d420f, 0x47831810, 0x2f051335, 0x05405535, 0x55553571,
-    0x40057135, 0x016b2b2b, 0x82304930, 0x441f2002, 0x0022090a, 0x4f460004,
-    0x05075c07, 0x00001f27, 0x23353325, 0x36038635, 0x37013e05, 0x07173533,
-    0x010e2335, 0x33171614, 0x012e2315, 0x84aa2b01, 0xff270800, 0x3a4f0100,
-    0x0b40400b, 0x29363629, 0x4f3a4b4b, 0x2b4b2a2b, 0x3b8b2b4a, 0x402b024e,
-    0x36012a40, 0x2a013652, 0x88004f01, 0x00562163, 0x7a186388, 0x514e0b4b,
-    0x27372105, 0x34215b83, 0x826e8236, 0x2163986b, 0x64955501, 0x2705a34e,
-    0x009601cc, 0x37000038, 0x3423b582, 0x83343537, 0x011e2707, 0x011d1617,
-    0xf5641516, 0x26062d05, 0x1e070627, 0x010e1501, 0x27262223, 0x06836882,
-    0x60087482, 0x010e2726, 0x44362627, 0x090a1709, 0x3d460303, 0x0303463d,
-    0x09170a09, 0x0709030c, 0x1c080a13, 0x2a01110f, 0x06281d20, 0x1d280608,
-    0x11012a20, 0x0a081c0f, 0x03090713, 0x041d179f, 0x05050b19, 0x014d3b07,
-    0x073b4d01, 0x190b0505, 0x1d161e04, 0x0e03062d, 0x0617200e, 0x16100a10,
-    0x120e0e12, 0x27088216, 0x0e201706, 0x2d06030e, 0x28080f41, 0x00290096,
-    0x0033002d, 0x45b18547, 0x9482066c, 0x33011d29, 0x33363435, 0x82171632,
-    0x1507210c, 0x1523cd82, 0x4707010e, 0x252505d9, 0x15331523, 0x20ce8323,
-    0x05107405, 0x2c081d8c, 0x1a361a2b, 0x161b2401, 0x093d0720, 0x1c246b0c,
-    0x3c072015, 0x20010c09, 0x47232040, 0x23482324, 0x01234724, 0x6b6b6b00,
-    0xff1b351b, 0x88128800, 0x0c802d08, 0x1cae0615, 0x01131724, 0x1515090c,
-    0xd4270886, 0x2b022107, 0x82032503, 0x19012f02, 0x2b2ac011, 0x091a0415,
-    0x021a1059, 0x02820226, 0x19882a20, 0x000d0022, 0x01200082, 0x0b0b4f18,
-    0x5f05fb47, 0x3b20092b, 0x2405214e, 0x23353335, 0x20038225, 0x0a694215,
-    0x0b821720, 0x03821320, 0x575e0720, 0x83078306, 0x82252003, 0x27f282f6,
-    0x011d1632, 0x2b950133, 0xfe210082, 0x840482ab, 0x2b552202, 0x220b822b,
-    0x862a2a55, 0x2b2b2a08, 0x3c018001, 0x1c6a6a2e, 0x821f8224, 0x802a2514,
-    0x2a2b802b, 0xfe200b82, 0x2e09795e, 0x013c2eea, 0x6a1c242b, 0x00030000,
-    0x82c0ff00, 0x00ab22af, 0x28bb8204, 0x37000029, 0x33371707, 0x051f4513,
-    0x13263436, 0x27352707, 0x32352306, 0x3e013f36, 0x32013b01, 0x06151716,
-    0x06291382, 0xb5331707, 0x2b4b2060, 0x05d15255, 0x40406e3d, 0x1c0a0a97,
-    0x061e1236, 0x14010b12, 0x1301011b, 0x861c154c, 0x20608b20, 0x4d56014a,
-    0xfe36062f, 0x20404056, 0x182f0297, 0x08082113, 0x1c7b141c, 0x11314c12,
-    0x5b51860d, 0x01c03606, 0x00310096, 0x06221300, 0x1e331614, 0x1e011d01,
-    0x013e1701, 0x207a8237, 0x076a4a34, 0x010e1525, 0x823d2622, 0x26342588,
-    0x013e3523, 0x2e2f0583, 0x09552301, 0x1c090c0c, 0x3b4e0224, 0x83024e3b,
-    0x8380200b, 0x0c012304, 0x07830c12, 0x2a230b84, 0x82950120, 0x24012a0f,
-    0x4e3bb61b, 0x3b4e0101, 0x05674c36, 0x1d832b20, 0x2a835520, 0x04831520,
-    0x2b1f0b23, 0x08334600, 0x6b01ab2a, 0x12000a00, 0x1f001a00, 0x35209582,
-    0x17279282, 0x2e352315, 0x82350701, 0x8a232098, 0x380e8307, 0xbf910255,
-    0xa8032b04, 0x02916d80, 0x5b78032a, 0x2b026049, 0x25374801, 0x3dfc8230,
-    0xbf042b40, 0x7f020291, 0x022a52a7, 0x785b6d91, 0x60022b53, 0x29483749,
-    0x00253001, 0xff6c0400, 0x00032d08, 0x00110007, 0x3700001e, 0x25152135,
-    0x27200382, 0x22074a5f, 0x82210333, 0x822b20f9, 0x22232e79, 0x01552726,
-    0x01aafe56, 0x1f173756, 0x22078201, 0x8237171f, 0x171f2462, 0x82894b14,
-    0x41942e10, 0x40405741, 0x1d1820aa, 0xfe20181d, 0x230482eb, 0x18204040,
-    0x1b4cd282, 0x3bd38506, 0x07171300, 0x11333533, 0x27071723, 0xc44d1eeb,
-    0x1e4def2b, 0x1e000180, 0x00ffd64d, 0x474c0982, 0x000a350a, 0x27072500,
-    0x33112337, 0x37273315, 0x1e809501, 0xc42bef4d, 0x08822382, 0xd6000124,
-    0xdf531e4d, 0x00292b0a, 0x00350031, 0x15330100, 0x26451523, 0x0a1f5305,
-    0x34113523, 0x0e1f5326, 0x83051521, 0x35038229, 0x15233525, 0x6a6a6b01,
-    0x362b090c, 0x01011609, 0x2b350a15, 0x0d820c09, 0x150a3527, 0x09160101,
-    0x2b0d8236, 0xc0eac0fe, 0x8001eac0, 0xd62b0140, 0x530c2753, 0x2a260d35,
-    0x2b2b802b, 0xdf498080, 0x01802e08, 0x002e0096, 0x13000032, 0x15070622,
-    0x05715916, 0x3d262223, 0x052a5b01, 0x14821420, 0x17011e2b, 0x37013e33,
-    0x34012e35, 0x20058336, 0x3d098227, 0x07330323, 0x0c09eb23, 0x200a0101,
-    0x0d200a0a, 0x01231c13, 0x171e1e17, 0x2a2e3c01, 0x0a853c2e, 0x24302508,
-    0x30090c01, 0x01200b36, 0x80090c95, 0x1301010a, 0x520d1301, 0x201e2c08,
-    0x1e2d1e01, 0x3c2d2001, 0x2d3c0101, 0x24220c86, 0xc4830130, 0x414bcb21,
-    0x3a080a2f, 0x000c0002, 0x0100000f, 0x27051707, 0x37173735, 0x2f071117,
-    0x01273701, 0xfe66666b, 0x5b4039f9, 0xa46a55ba, 0x0127275c, 0x344e520b,
-    0x4715c025, 0xb5fe35ab, 0x250e9c2a, 0x82060026, 0x010021df, 0x22058363,
-    0x4b25001c, 0x1320079d, 0x1428d482, 0x37071716, 0x35263316, 0x3222d282,
-    0x205f2e33, 0x32332209, 0x05e07016, 0x25068348, 0x27173732, 0xeb82013e,
-    0x32117d5a, 0x015b44cb, 0x36111c1f, 0x0209221c, 0x06063f54, 0x4f755011,
-    0x732005c2, 0x692f0685, 0x02024836, 0x13163648, 0x1e1a0e2d, 0x85614801,
-    0x855e2015, 0x6b012106, 0x1f2d1a82, 0x20321233, 0x3716140a, 0x2f260148,
-    0x056a4335, 0x352f0585, 0x2d2e3c01, 0x1b05013c, 0x1b2e0f28, 0x18343c2e,
-    0x20100944, 0x21db8402, 0x675f01eb, 0x01002105, 0x0f979318, 0x33352322,
-    0x11959318, 0x52c0c021, 0xfe230db4, 0x820080ab, 0x430c2000, 0x053b085b,
-    0x24000e00, 0x31002d00, 0x39003500, 0x46004200, 0x4e004a00, 0x00005200,
-    0x82153301, 0x27172551, 0x23151737, 0x27200982, 0x8208f165, 0x280f820d,
-    0x013b013e, 0x0e130717, 0xa9591801, 0x35072109, 0x15243284, 0x27262223,
-    0x33220a82, 0x0f862715, 0x07822520, 0x01390383, 0x2a401615, 0x331b2e76,
-    0x152b402b, 0x152b2a15, 0x18012b2b, 0x1b32ab12, 0x20068269, 0x2a00842b,
-    0x40954080, 0x0118126b, 0x8340152b, 0x8201200f, 0xd5fe2104, 0x20082682,
-    0x2b562b00, 0x2a331b2d, 0x20752b16, 0x2a2b2b2a, 0x1216162a, 0xfe1b3218,
-    0x2a1812cd, 0x55405516, 0x2100822a, 0x18821218, 0x9640aa27, 0xab402a40,
-    0x09474b40, 0x0f006b24, 0xcf821300, 0x15011e23, 0x05155211, 0x3411352f,
-    0x35013736, 0x95011521, 0x12191813, 0x069c66fe, 0x01d6fe22, 0x240fff65,
-    0xd5d5fe01, 0x082f4ad5, 0x7f01bf26, 0x11000800, 0x072d4b82, 0x33152335,
-    0x05372335, 0x17073315, 0x360a8237, 0x2b60a001, 0xfe604d96, 0x1e604d97,
-    0x7e012b60, 0x2b964d60, 0x822bb560, 0x964d210c, 0xc0223f88, 0x3f858001,
-    0x27203a83, 0x3f204383, 0x2305bb70, 0x4cd50733, 0x2b262a82, 0x952b60f5,
-    0x3583604c, 0xd7954c28, 0x2b954c60, 0x6c820060, 0x00002808, 0xd601eaff,
-    0x0d006201, 0x0e250000, 0x2e230701, 0x21352701, 0x33071737, 0x5401d501,
-    0x54408040, 0x65210101, 0x84565624, 0x40542509, 0x8b16a140, 0x0b433782,
-    0x01eb3605, 0x0004002b, 0x0021001c, 0x002b0026, 0x37000030, 0x1d272635,
-    0x071b4d01, 0x32011e27, 0x33353736, 0x05985515, 0x82252121, 0x070629ca,
-    0x15070635, 0x27073523, 0x26260482, 0x17951527, 0x00822b13, 0x584c1d24,
-    0x07821d4c, 0xfe2b3508, 0x2a0001d6, 0x16142d13, 0x16151516, 0x42951416,
-    0x555c0f0b, 0x1f962a2b, 0x191d1d19, 0x2b2a961f, 0x5c426c2b, 0x083a4d0f,
-    0x012c2e04, 0x042e2c01, 0x03003a08, 0x2008c382, 0x01c301fc, 0x00110086,
-    0x0044002a, 0x1f160100, 0x0f141601, 0x012f0601, 0x3f362726, 0x03323601,
-    0x200a8222, 0x82098234, 0x23058518, 0x07061617, 0x27240182, 0x26022f22,
-    0x0221188a, 0x82368216, 0x0d013b18, 0x02055656, 0x0d0db102, 0x010106ac,
-    0x0f05ad06, 0xb1080508, 0x0e220202, 0x0284720e, 0x02021e3a, 0x55020704,
-    0x02070756, 0x03af0804, 0x0e0e2103, 0x740d0d73, 0x041e0e0d, 0x31080082,
-    0x04035657, 0x28288301, 0x02060103, 0x50060652, 0x01050601, 0x78fe0251,
-    0x07015204, 0x07061001, 0x36060635, 0x010e0606, 0x02050402, 0x6a042728,
-    0x188d0301, 0x28241784, 0x04000102, 0x67082b67, 0x212109f3, 0x06c14515,
-    0x21200788, 0x2109354b, 0x0b833335, 0xb9181720, 0x01220bb8, 0x00864000,
-    0x0988ff20, 0x15156b2b, 0x01151516, 0x2b2a166b, 0x2002832b, 0x20088716,
-    0x832a85d5, 0x00062176, 0x2505a348, 0x00030096, 0x2978000c, 0x00262705,
-    0x23350100, 0xd8621715, 0x17132107, 0x250af642, 0x15331333, 0x03822723,
-    0x03823720, 0xd5400123, 0x051e5f95, 0x43558621, 0x802d0706, 0x2b562a2a,
-    0x2b2bab2b, 0x56561501, 0x06075fd5, 0x55540122, 0x2407d760, 0x18122b01,
-    0x222182fe, 0x822b2b2b, 0x820a2080, 0x01d5287f, 0x00ab01ab, 0x82110008,
-    0x0023227f, 0x0673452c, 0x59005024, 0x7c180000, 0x03200825, 0x20073549,
-    0x20089007, 0x88a78737, 0x08246c1a, 0x91081d64, 0x00012108, 0x0c0fa819,
-    0x86060b7a, 0x85ee2006, 0x8c6e201b, 0x691b8606, 0x0d8606e9, 0x7f492b20,
-    0x81012106, 0x7f200886, 0xab20078e, 0x07870f86, 0x0f860120, 0x0f8f2f87,
-    0x3e0c1375, 0x00220014, 0x00300026, 0x010e1300, 0x011e1107, 0x36322133,
-    0x012e1137, 0x2715012b, 0x49173507, 0x23280637, 0x34352315, 0x33151736,
-    0x15221182, 0x0d823307, 0x7c23372c, 0x01011610, 0x00011119, 0x61821911,
-    0x35801231, 0x09156b36, 0x1516010c, 0x15090c15, 0x832b402b, 0x95012802,
-    0xfe101802, 0x821911aa, 0x065e6227, 0x0c01ea2a, 0x2b2b5509, 0x150c0955,
-    0x40260083, 0x00401616, 0x93820300, 0xeb010023, 0xdbbb1801, 0x33352209,
-    0x05de4335, 0x15331539, 0x11331737, 0x56950123, 0x56d55556, 0x2a2b5556,
-    0x2a406b2a, 0x83555540, 0x01ab2204, 0x203a8356, 0x08df4202, 0x0a000625,
-    0x84370000, 0x010f213d, 0xeb223682, 0x3282d5d5, 0x31842b20, 0x2b8e2c85,
-    0x23150122, 0x15206288, 0x2a212c82, 0x87fa822b, 0x232b855a, 0x008001ab,
-    0x252b5784, 0x15233523, 0x15071723, 0x87013521, 0x85ab207e, 0x20c38433,
-    0x056742ff, 0x0d000624, 0x85821100, 0x33153326, 0x37273335, 0xab203489,
-    0x2b20b78b, 0x0020cf89, 0x3720678e, 0x2f213984, 0x84678201, 0x20b88232,
-    0x60c785d5, 0x28080c0b, 0x000c0003, 0x11211300, 0x35333721, 0x27072337,
-    0x012b1723, 0xc556feaa, 0x35204520, 0x01452035, 0x6056fe95, 0x6464825e,
-    0x06a74a82, 0x9601d62a, 0x0f000300, 0x2e001b00, 0x35219d83, 0x0bbd7a23,
-    0x290b4765, 0x07010e03, 0x32013e33, 0x08851716, 0x012e3725, 0x652a2aeb,
-    0x9a5d0c58, 0x24482d0a, 0x012a0130, 0x01182418, 0x2a043804, 0x01250382,
-    0x012b4030, 0x178d5d2a, 0x01290134, 0x18122430, 0x1f1c1218, 0x25252130,
-    0x00003024, 0x03820500, 0x0002002e, 0x1e008001, 0x46003d00, 0x58004f00,
-    0x3326d982, 0x0e152315, 0x86822301, 0x0a821520, 0x27012e23, 0x05864a35,
-    0x3d013e29, 0x21363401, 0x4f1d1632, 0x0e2106d1, 0x2f098201, 0x35012b06,
-    0x013e3533, 0x27262233, 0x03352335, 0x20073249, 0x49088723, 0x6b210844,
-    0x25ae822a, 0x01181212, 0x04822a2a, 0x15121928, 0x19191215, 0x04823c01,
-    0x12200a85, 0x6b201f88, 0x0c44a118, 0x0d85b320, 0x2b800123, 0x252b836a,
-    0x15042b6a, 0x41825512, 0x55204d83, 0x0c8a1183, 0xff212287, 0x0b404900,
-    0x00230b85, 0x82000100, 0x80013000, 0x0f006b01, 0x13370000, 0x33352327,
-    0x82131716, 0x2f263ae4, 0x59800701, 0x0f2a1c12, 0x2b1d7a05, 0x454f060e,
-    0x29020115, 0xfe0d012b, 0x210482e3, 0x3682c8ba, 0x2b630820, 0x82072008,
-    0x001a2a3d, 0x002e0025, 0x00400037, 0x05314149, 0x45821120, 0x4f820120,
-    0x03821120, 0x15330322, 0x35250d82, 0x35073533, 0x180a8917, 0x20114a90,
-    0x085e4a37, 0x3107d85b, 0x2b2b552b, 0x2b800155, 0xeb2b5555, 0x15401615,
-    0x05849515, 0xae446b20, 0x41122005, 0x77200508, 0x013f0d8c, 0xaafe2a95,
-    0x2a80012a, 0x012a56fe, 0x16166a40, 0xa0160b55, 0x5515156b, 0x010b150a,
-    0x82243724, 0x18152702, 0x24191924, 0x0d86c018, 0x10820a82, 0x0021d282,
-    0x32d38207, 0x01c701fb, 0x00060080, 0x0014000d, 0x0022001b, 0x82300029,
-    0x140128d1, 0x27260616, 0x82320103, 0x25352906, 0x06011e01, 0x17033526,
-    0x31210d83, 0x28068425, 0x011f1335, 0x012f0616, 0x2f068505, 0x0468013c,
-    0xe6010d0d, 0x03011701, 0xb4fe0d0d, 0x5c270785, 0x090201c3, 0x84bffe09,
-    0x59352806, 0x02050101, 0x85f2fe02, 0x80012c07, 0x0b01affe, 0x0101040e,
-    0x83fffe44, 0xffcc2e07, 0x0d0b0100, 0x41010103, 0x030908b4, 0x2d048243,
-    0x17010102, 0x05020251, 0x52560101, 0x29820202, 0x674e0020, 0xeb200808,
-    0x10004b01, 0x44002100, 0x00005700, 0x37022e25, 0x26273436, 0x1716013e,
-    0x06071416, 0x012e2227, 0x3e29108d, 0x26343501, 0x07010e27, 0x22198327,
-    0x83012e35, 0x222c830b, 0x69272206, 0x372305e2, 0x4917011e, 0x50180640,
-    0x0129071b, 0x020a04c2, 0x03161603, 0x3c968202, 0x35051b1b, 0x04030904,
-    0x03040e0e, 0x13040c0b, 0x10600513, 0x020b0d16, 0x06050b07, 0x399b8205,
-    0x2d1b2834, 0x0510160c, 0x0f050d09, 0x161e1e2b, 0x011e18e4, 0xd51d2801,
-    0x06822f24, 0x0e1e5a08, 0x4432283f, 0x0c060135, 0x224f2106, 0x03080c05,
-    0x28632905, 0x0c071907, 0x15341605, 0x02070c06, 0x1e461e05, 0x16012107,
-    0x05130c10, 0x0101130a, 0x0e070b02, 0x0134270f, 0x06191c01, 0x0a0c0510,
-    0x2c1e0f05, 0x066b011d, 0x271e1925, 0x232f0101, 0x26052d20, 0x3f01012e,
-    0x08c34400, 0x0e006b27, 0x00001a00, 0x05ef5125, 0x3322c382, 0x44182315,
-    0x953a0ef4, 0x44445b01, 0x5a02025a, 0x194cb644, 0x4232a01d, 0x32420101,
-    0x02024232, 0xa85dc042, 0x182b2308, 0x32665941, 0x0b6b4f0a, 0x8308ef42,
-    0x06a35e63, 0x054e2720, 0x29068205, 0x14151632, 0x3e150706, 0x12823301,
-    0x35012e24, 0xc7443634, 0x428f8205, 0xea4707dd, 0x87172008, 0x15013111,
-    0x11042e34, 0x24372415, 0x13170101, 0x01011713, 0x17290a82, 0x1d2a0e13,
-    0x1104242a, 0x24178416, 0x2c031418, 0x05f942ba, 0x06850920, 0x0685cd20,
-    0x1f019531, 0x141f080f, 0x1c24241c, 0xb2072015, 0x86152007, 0x0b71320a,
-    0x101f010d, 0x1b151f07, 0x161b2424, 0x3c1a0621, 0x05014458, 0x4d2b0121,
-    0x2a20063a, 0x4f420f85, 0x01c02d09, 0x00290080, 0x003b0032, 0x13000044,
-    0x0720dc84, 0x2b054a51, 0x0614011e, 0x27262223, 0x1527012e, 0xc888f490,
-    0xd1870320, 0x7c683720, 0x241c2608, 0x660c1217, 0x83968226, 0x21152786,
-    0x15414207, 0xea8b1713, 0x86065565, 0x85e220d5, 0x800124d5, 0x821b2401,
-    0x344e24cf, 0x41161301, 0x0422060f, 0x47881d2c, 0x88072022, 0xc2865284,
-    0x6d07e844, 0x00210678, 0x05db4b00, 0x2d074b53, 0x0017000f, 0x0023001b,
-    0x33153700, 0x03820335, 0x3335112c, 0x23352335, 0x23150315, 0x0f823315,
-    0x0b820520, 0xc6693720, 0x80402f06, 0xababd580, 0x5555562a, 0xd500012b,
-    0x07822b55, 0x2a2a552e, 0x2a2a0001, 0x2a2babfe, 0x0001802b, 0x12820583,
-    0x07825520, 0x00820020, 0x0000032e, 0xd501fbff, 0x21008d01, 0x63004200,
-    0x21086582, 0x2e27010e, 0x013e3701, 0x010e1737, 0x011e0607, 0x37363736,
-    0x3e013f35, 0x0e011e01, 0x23272601, 0x08833706, 0x27252382, 0x16171637,
-    0x2512823e, 0x27010f26, 0x21842e23, 0x07061524, 0xc6433617, 0x07062306,
-    0x26823627, 0x17010e2b, 0x07011f16, 0x010e1617, 0x084c832e, 0x2637177f,
-    0x234c19df, 0x0e170d21, 0x0e011628, 0x0910091b, 0x0911342d, 0x09017802,
-    0x12081e1f, 0x57041c1f, 0x302a8e04, 0x18293e0a, 0x101b0c26, 0x072a1d21,
-    0x0f111d21, 0x12053712, 0x23180116, 0x29090116, 0x1c0fb414, 0x0912484c,
-    0x0e1a0b03, 0x33310c0c, 0x13090b13, 0x08024108, 0x111e1e0a, 0x0e0d0f09,
-    0x222b1031, 0x4d19170e, 0x01151423, 0x0e0e011f, 0x0a203418, 0x16100e18,
-    0x080f0201, 0x3a648211, 0x84150d10, 0x30523d06, 0x13190304, 0x03051a10,
-    0x04293720, 0x66090602, 0x82221701, 0x112e0862, 0x064b0a0e, 0x21482738,
-    0x2d17261e, 0x1f1b0f13, 0x3116151a, 0x040b161a, 0x1f0f046b, 0x1f1f0a10,
-    0x50030708, 0x0000000e, 0xff000005, 0x0b6701c0, 0x00152307, 0x13680019,
-    0x06705005, 0x72011e21, 0x07200511, 0x2006904b, 0x21078237, 0xc0570001,
-    0x60493006, 0x02aafe02, 0x2b2b2260, 0x552a2a56, 0x57012b2b, 0xd52907a0,
-    0x2b243001, 0xa930242b, 0x2100832b, 0x63840400, 0x6b01ff2c, 0x15000800,
-    0x56004d00, 0xa4540000, 0x22073008, 0x33150706, 0x36343526, 0x33012e37,
-    0x18010f22, 0x2c2260ca, 0x3436012f, 0x2f363727, 0x010f2601, 0x20058226,
-    0x08075123, 0x080aa872, 0x0f02ed22, 0xad32190f, 0x09040105, 0x03041a09,
-    0x17030215, 0x03170101, 0x04031502, 0x0409091a, 0x042b0501, 0x02211a90,
-    0x271a8405, 0x120e1604, 0x12121b12, 0x2208cf89, 0x0b2b2b2a, 0x132e180b,
-    0x1c040809, 0x010a0505, 0x03042503, 0x050b0512, 0x25040311, 0x060b0104,
-    0x82041d04, 0x0b062202, 0x300e8201, 0x0b051103, 0x04031205, 0x0a010325,
-    0x041c0406, 0x08995d4a, 0x23050741, 0x00c001d6, 0x2a05234a, 0x25000015,
-    0x07273335, 0x5c131533, 0x2708050c, 0x23153317, 0x33152337, 0x6e2e4001,
-    0xd5402e6e, 0x6a6ad66a, 0x80abd6d6, 0x6f809580, 0x2b01806f, 0xab8080d5,
-    0x002a5580, 0x220ceb7f, 0x4c310028, 0x002e08d1, 0x17011e13, 0x3e353315,
-    0x14163201, 0x4a820706, 0x14011e2d, 0x27262206, 0x0e152335, 0x58262201,
-    0x2e23059e, 0x82363401, 0x36322628, 0x23272634, 0x4c248227, 0x372b06d8,
-    0x012e013d, 0x16140622, 0x4c013b17, 0x072a05f3, 0x30248015, 0x30015601,
-    0xd1413048, 0x8c088205, 0x01f92d0e, 0x18182418, 0x562a2b12, 0x1812ab56,
-    0x6e4c0b82, 0x2b122205, 0x200d86d5, 0x060a4295, 0x4820388f, 0xfe215686,
-    0x222885ac, 0x862a5680, 0x8539874a, 0x21ea8258, 0x04840100, 0x6b01a639,
-    0x00000500, 0x07270725, 0xa6013727, 0x1e88881e, 0x871ec5a6, 0x83a61e87,
-    0x8402201e, 0x82c02023, 0x00072d23, 0x1300000b, 0x15331333, 0x37230323,
-    0x40320582, 0x83679782, 0x95eb6796, 0xfe6b0195, 0x2b012bd5, 0x9f622b2b,
-    0x006b2409, 0x410d0006, 0x7f410f87, 0x80402c0a, 0x01806e6e, 0x8080d62b,
-    0x860a0000, 0x18802063, 0x240e7f46, 0x0023001f, 0x23738227, 0x05211121,
-    0x64526f82, 0x20078707, 0x06d04e07, 0x07862720, 0x40014026, 0x5501c0fe,
-    0x02868682, 0x85052d4d, 0x80012605, 0x2b15c0fe, 0x2001866b, 0x202186d5,
-    0x08718200, 0xfaff0044, 0x9001e801, 0x1b000500, 0x00002100, 0x37152701,
-    0x17052636, 0x3217011e, 0x013e013f, 0x012f3437, 0x2223012e, 0x010e010f,
-    0x2b012e25, 0xca011701, 0x0d07341d, 0x056a4ffe, 0x08090c15, 0x010d0c9e,
-    0x0a846b03, 0x0d109d37, 0x18015f01, 0x014a1f12, 0x7dc00c63, 0xff482010,
-    0x04010e0c, 0x2a1c8441, 0x030e0dff, 0x401f0841, 0x46b21912, 0x77860697,
-    0x77841520, 0xe7822520, 0x1f256384, 0x33011e01, 0x22798916, 0x82351733,
-    0x8317207e, 0x012f2794, 0xef030713, 0x67820809, 0x7c8d0620, 0x824a3e21,
-    0x82552076, 0xdb112695, 0x016a9e6a, 0x20698390, 0x247c8d11, 0x191287b2,
-    0x25948321, 0x00ff0307, 0x83830142, 0x87000521, 0x208387fb, 0x34858229,
-    0x011f1632, 0x010e1516, 0x2706010f, 0x012f2622, 0x013f3626, 0x05e55836,
-    0x1e173722, 0x27331682, 0x27371307, 0xef270717, 0x6b05150c, 0x0c0d0103,
-    0x8209089e, 0x066a3d0a, 0x089d100d, 0x18121f53, 0x111d2a01, 0xbe34070d,
-    0xa09e6a9e, 0x01450944, 0xff0d0e90, 0x41352284, 0x0c0e0104, 0x081f11ff,
-    0x12190341, 0x070c9187, 0xb77d1020, 0x238e8242, 0x335534a4, 0x24093b42,
-    0x000b0096, 0x0d5d6f1e, 0x010e0534, 0x17011e15, 0x27263732, 0x3427012e,
-    0x34352637, 0xd5482b01, 0x61483605, 0xfe610101, 0x01201ef6, 0x13154861,
-    0x23202b39, 0x01020201, 0x870d8295, 0x1950231f, 0x0b822744, 0x270e052b,
-    0x09243c11, 0x2e0c0c0a, 0x08976600, 0x17226b83, 0x6d8d2a00, 0x2d4a0720,
-    0x22698205, 0x9e07013e, 0x55482079, 0x372505f9, 0x48010148, 0x21849a8b,
-    0x48180229, 0x25200980, 0xab4f9091, 0x058b6e05, 0x24001e22, 0xfd928f8d,
-    0xd0792520, 0x1b034106, 0x8b1e2d25, 0x41321f51, 0x25201e0a, 0x1e212482,
-    0x0a0f4132, 0x1d001724, 0x7f8b3000, 0x734a2320, 0x17322308, 0x77822637,
-    0x37170722, 0x8f419192, 0x882a200a, 0x0d0e2beb, 0x8c6c1d22, 0xaa511e33,
-    0x1c4194fe, 0x48372d18, 0x37480101, 0x03024836, 0x8d210b22, 0x11202c83,
-    0x20112041, 0x06b34100, 0x0100022f, 0x0012006b, 0x00330022, 0x011e0100,
-    0x05aa4117, 0x012e212b, 0x37013e27, 0x0607013e, 0x2d128216, 0x27371533,
-    0x2e272215, 0x1f013f01, 0x11833501, 0x36170723, 0x080f8226, 0x0135232d,
-    0x0c563b00, 0x0101382a, 0xebfe2e3c, 0x01014936, 0x4a153140, 0x1a041731,
-    0x3c14230d, 0x0e10163c, 0x1f060a03, 0x0d10161d, 0x821f0b04, 0x230e2d15,
-    0x016b0113, 0x3b043848, 0x013d2d2b, 0x2208d782, 0x27064633, 0x461e792f,
-    0x270f0d1c, 0x10263c3c, 0x2e11240e, 0x01271e1f, 0x10250e0f, 0x1b471e1f,
-    0x82280f0d, 0x064f41aa, 0x01c02a08, 0x00090080, 0x00170010, 0x06221300,
-    0x16141115, 0x3311013b, 0x34353315, 0x15072326, 0x3d363233, 0x18136b01,
-    0x2a801318, 0x280482ab, 0x01181380, 0xfe131880, 0x200783d6, 0x200d82ab,
-    0x561583d5, 0x49830dcf, 0x82371521, 0x2a3e82e2, 0x012e3435, 0x3337012f,
-    0x82161707, 0x372b0801, 0x0f404040, 0x04560107, 0x354b0b11, 0x0b155f8b,
-    0x6d020709, 0x40b66b01, 0x0119114a, 0x19019580, 0x37570c22, 0x110d1860,
-    0x436e0b0d, 0x3c08096b, 0x000e0080, 0x01000012, 0x06010f22, 0x33011f14,
-    0x2f343637, 0x07132601, 0x43013533, 0x0cee0d11, 0xbaa4340c, 0x0d680c0c,
-    0x01952b17, 0x0ded0d80, 0xbb340e22, 0x670d220d, 0x2bc0fe0d, 0x08f3522b,
-    0x9601d62c, 0x11000800, 0x2f001d00, 0x234b0000, 0x4b332008, 0x3c6a072c,
-    0x2e03230b, 0x805f2701, 0x32332e06, 0x0e151637, 0x0f0bc001, 0x0f0f160f,
-    0x20068575, 0x0eaa6e4b, 0x3a26012f, 0x375a1d10, 0x02071719, 0x170fc561,
-    0x2002880f, 0x0f0a51d0, 0x1109092b, 0x302a273b, 0x48191705, 0x0a535a61,
-    0x21000b22, 0x2110df43, 0x7a851716, 0x8c820720, 0x34353726, 0x1d163236,
-    0xb64cfa82, 0x11c31808, 0x4133210c, 0x48247b84, 0x25164e31, 0x3b217c82,
-    0x82a78255, 0x0c087286, 0x01218622, 0x02257684, 0x28282f01, 0x22208216,
-    0x8530160b, 0x0d834ca8, 0x2605e760, 0x13000015, 0x5b231533, 0x272207eb,
-    0xdd461523, 0x40332605, 0x00018080, 0x31008280, 0xaa80802b, 0x8001802a,
-    0x40564055, 0x2b6bab55, 0x53422beb, 0x01d62809, 0x00070096, 0x8316000a,
-    0x23132a45, 0x23072327, 0x25273337, 0x09f66415, 0x752bb53a, 0x17851733,
-    0x3367572f, 0x2a400a01, 0x012a4040, 0x40d5fe2b, 0x64866b40, 0x40210c83,
-    0x085b5840, 0x96015623, 0x218d8200, 0x44181501, 0x37230938, 0x60352335,
-    0x29080548, 0x12185501, 0x23181256, 0x2b802b1d, 0x0001231d, 0x181812eb,
-    0x2d1eeb12, 0x2a2a1808, 0x002d0818, 0x00000200, 0xd601f0ff, 0x836ba101,
-    0x85221905, 0x0f3e080a, 0x07061701, 0x32161406, 0x17373637, 0x118d0137,
-    0x8a5a8a0d, 0x0e1d0c0c, 0x110f8ccd, 0x221a0d10, 0x0f10110d, 0x0da0018c,
-    0x0d8a5a89, 0x0d1d0d22, 0x0f0f8cab, 0x1a220d11, 0x0e10110c, 0x8f53008c,
-    0x82602008, 0x0008259f, 0x01000014, 0x24074b51, 0x37233503, 0x230d823e,
-    0x1523011f, 0x3b070a56, 0x0537400e, 0x04161e15, 0x95014037, 0x19192418,
-    0x56fe1824, 0x100da280, 0x80a20d10, 0x41824b86, 0x6b01d62a, 0x18000f00,
-    0x15130000, 0x28057d4b, 0x012b012e, 0x3527012e, 0x07995633, 0x01202108,
-    0x4001353f, 0x06307505, 0xc0026a4e, 0x49303025, 0x6b013030, 0x216d4320,
-    0x2a2b2b65, 0x204b6803, 0x88062863, 0x05ff569f, 0x5d821a20, 0x07214387,
-    0x2cfb8222, 0x35331137, 0x11331533, 0x26273717, 0x33a58723, 0x7206083d,
-    0x2a2b4c1f, 0x711f4c2b, 0xab010807, 0x18241801, 0x6a2e0282, 0x4c1e7106,
-    0x9595f4fe, 0x1e4c0c01, 0xfb890671, 0xab019622, 0x1d20f982, 0x1422af82,
-    0x50861716, 0x35013e22, 0x88068d45, 0x2e6b22b4, 0x22538227, 0x662a2e27,
-    0x4b5205e8, 0xab012606, 0xfe13482c, 0x295582c7, 0x2c481339, 0x01013c2e,
-    0x70862e3c, 0x0200002e, 0xeaff0000, 0x96014b01, 0x16000800, 0x200a5b41,
-    0x05975607, 0x35231525, 0x6d3e3523, 0x0e2908e5, 0x01181240, 0x01205620,
-    0x075d4118, 0x18016a27, 0xa0a07512, 0x4b4c1875, 0x01402209, 0x204b826b,
-    0x0b074127, 0x15020e2c, 0x3f011e17, 0x07063601, 0x06823606, 0x26012f28,
-    0x010e0723, 0x0b822627, 0x20012622, 0x3f056e69, 0x06451616, 0x03020203,
-    0x12191f17, 0x320d2e03, 0x02040103, 0x1b0c0102, 0x190d0204, 0x6b010103,
-    0x3c06e24b, 0x06310565, 0x01050501, 0x55140f02, 0x090b2756, 0x07020223,
-    0x10080102, 0x5e2f0c08, 0x056f5f0b, 0xcc01f02a, 0x0a008601, 0x17001100,
-    0x22238582, 0x4417010f, 0x240805c9, 0x031f010f, 0x37070537, 0x6701022f,
-    0x712d0a0d, 0x430a0a2d, 0x37ad600a, 0xac073004, 0x8f26d6fe, 0x01043105,
-    0x30178486, 0x0a44091a, 0x3106ad46, 0x50ad3703, 0x032e278f, 0x06434432,
-    0x9601eb22, 0x1427db82, 0x00001800, 0x7c363237, 0x4e520532, 0x012e2906,
-    0x13013e27, 0xc0231533, 0x26057365, 0x01553f17, 0x82098309, 0x54012402,
-    0x19ababc0, 0x21124b6c, 0x5418c1fe, 0x57870833, 0x57982020, 0x94089d5b,
-    0x2b40225f, 0x94028240, 0x05b66863, 0x00020022, 0x01230082, 0x44a801f2,
-    0x0121052d, 0x0a154126, 0x14062208, 0x37330717, 0x013f3216, 0x0d128b01,
-    0x0c7c797c, 0xbf0d3d0c, 0x4f0d0d7f, 0x220d1279, 0xa7017f0d, 0x2e158301,
-    0x3c0e220d, 0x0e7f9d0d, 0x124f0d22, 0x427f0d0c, 0xd637073b, 0x0d009601,
-    0x00001900, 0x15163201, 0x23061411, 0x34110721, 0x50173336, 0x332f0675,
-    0x01352335, 0x181812ab, 0x55d5fe12, 0x18961218, 0x240d3c94, 0x18128001,
-    0x87bd8555, 0x01cb294f, 0x001b0094, 0x13000023, 0x22078a5f, 0x82233736,
-    0x062321fe, 0x0805c56b, 0x35012e58, 0x1737013e, 0x27071737, 0x22ca2737,
-    0x0101362a, 0x33222d3c, 0x30ab370d, 0xfe3a270e, 0x1f1a39ab, 0x107f4501,
-    0x4b4a4b12, 0x3a011013, 0x2b3b053a, 0x23013c2d, 0x332a2a1d, 0x182a2a23,
-    0x593c2642, 0x820b1c6a, 0x1c0b812a, 0x05000000, 0xd5ff0000, 0xab01eb01,
-    0x75820b00, 0x2b002724, 0x79824700, 0x2005b05b, 0x21768235, 0xac180735,
-    0x27230d90, 0x82331505, 0x20d5828c, 0x231d8215, 0x37211121, 0x35212b83,
-    0x83158423, 0x82158205, 0x8323200b, 0xc035241d, 0x82401515, 0x18122602,
-    0x12180101, 0x056f6a01, 0x55fe1223, 0x2f148316, 0xff000195, 0x55156b00,
-    0x15551616, 0x16401640, 0x01210282, 0x211984ab, 0x2d828016, 0x8308695b,
-    0x832b2035, 0x15152630, 0x16eb00ff, 0x2351826a, 0x2a16162a, 0x6a210682,
-    0x06734716, 0xb720bf83, 0x23087b5b, 0x17071300, 0x15218884, 0x239a8217,
-    0x012e3533, 0x1e22b382, 0xb2821701, 0x87173521, 0x1e28281a, 0x2b954c6d,
-    0x822bd556, 0xd5fe216a, 0x80320482, 0x6e1f9380, 0x012b8037, 0x2b6d1eb6,
-    0x2b1e4c95, 0xb6828080, 0x82d55621, 0xd52b3604, 0x2b6d1f49, 0x05003780,
-    0xe0ff0000, 0x8301da01, 0x1c001500, 0x05155700, 0x24056d77, 0x26060706,
-    0x08105227, 0x37013e33, 0x011e3627, 0x37362707, 0x010e011e, 0x013e012e,
-    0x830f8207, 0x25362109, 0x68081187, 0x85011b2b, 0x04052b1b, 0x2120411d,
-    0x13101d40, 0x122a0402, 0x1a0b160c, 0x080c2114, 0x13ac0955, 0x27220c12,
-    0xf7210c11, 0x081a2a13, 0x071a2925, 0x07129201, 0x0825291a, 0x65012a1a,
-    0x1b7bfe1b, 0x0a03032b, 0x1b03031a, 0x1223090b, 0x0c112017, 0x02bc0e1f,
-    0x55153923, 0x2a040416, 0x2a06223b, 0x0764233a, 0x102d3417, 0x512b1918,
-    0x0c835f0a, 0x21001d32, 0x22130000, 0x011e1506, 0x3d363217, 0x23263401,
-    0x0e882219, 0x15172339, 0x09553533, 0x9acd040c, 0x090c0c09, 0x0a0c2428,
-    0x18472e2f, 0x8204092f, 0xab75260d, 0x090c8001, 0x4628199a, 0x182f2d09,
-    0x092f2e47, 0x0928240d, 0x2b2b400c, 0x00216a82, 0x08cb4e02, 0x29001d22,
-    0x2a5e6b9f, 0x059e5305, 0xb5257397, 0x402b4040, 0x83779b40, 0x07002120,
-    0x0d237788, 0x52001100, 0x2125056f, 0x00002500, 0x07da4725, 0x21352325,
-    0x52252315, 0x37200a6f, 0x2006374f, 0x33078227, 0x12189501, 0x2b1812d6,
-    0xfe2b8001, 0x6b2b2beb, 0x2b6a2a2a, 0x6b240083, 0x2a6a2b2b, 0x23052a77,
-    0x95404080, 0x07821387, 0x25054348, 0xc0010000, 0x71827f01, 0x3323678b,
-    0x8a071737, 0x55eb3053, 0x2b644925, 0x1919122b, 0x94408012, 0x82407e16,
-    0x04002a3a, 0xeaff0000, 0x80019601, 0x6f561800, 0x13002307, 0x35821533,
-    0x35231526, 0x17333523, 0x43830982, 0x07820320, 0x2ad6952a, 0x2a40aa40,
-    0x802a2ad6, 0x012d0284, 0x80402b80, 0x6b554080, 0x15019515, 0x08df416b,
-    0x9601d62d, 0x1f001300, 0x3e370000, 0x4c333701, 0x152008b3, 0x1e210982,
-    0x495b8201, 0xeb24081f, 0x2a024836, 0x28081e4e, 0x01014837, 0x4040e148,
-    0x2302822a, 0x3748012b, 0x4c08504d, 0x292006c4, 0x40201883, 0x4e085f71,
-    0x0027052f, 0x15333525, 0x82372707, 0x1707229d, 0x0a7a4913, 0x2a6b012a,
-    0x565595c0, 0xf76b3e3a, 0x712a5184, 0x9555563a, 0x6b8d2ac0, 0x7a492201,
-    0x204b8808, 0x23fb8280, 0x01000015, 0x3527f588, 0x33350333, 0x83112115,
-    0x95012110, 0x2a269385, 0xababfe2a, 0x2f450180, 0xd5fe2705, 0x15016a40,
-    0xbf4bc02b, 0x9a962009, 0x8e112043, 0x84552043, 0x96fe2882, 0x5501ab80,
-    0x4b00ff2a, 0x054c0c23, 0x0aa77c05, 0x07170723, 0x7c878237, 0xb0250ca8,
-    0x2a806a6a, 0x0cf94a2a, 0x55557e24, 0x074caaaa, 0x000b240c, 0x4f1a0017,
-    0x514f0fbf, 0x3f15250c, 0x35331501, 0x5b20598c, 0x220af95c, 0x8d166a0d,
-    0x7a282063, 0x54210a75, 0x707085aa, 0x2f4f0517, 0x000f2205, 0x0d2f4f12,
-    0xb8820720, 0x27153722, 0xb024618c, 0x6aaa2a2a, 0xaa23ba8d, 0x5155aaaa,
-    0xea21078b, 0x874b8501, 0x16cd7fbb, 0x2f151725, 0xbe231501, 0x000828bb,
-    0x01eaff00, 0x529601ab, 0x2d240cef, 0x00003100, 0x2307a461, 0x2b153315,
-    0x37206883, 0x03836c82, 0x26221328, 0x3634013d, 0x01823533, 0x322f1b82,
-    0x0e151716, 0x15032301, 0x2bd53533, 0x822b402b, 0x82152000, 0x2b2b2803,
-    0x181812c0, 0x70401612, 0x6b2306ee, 0x826b016b, 0x2b15241d, 0x84402a2a,
-    0x56fe2a02, 0x12d61218, 0x40401618, 0x23088416, 0xd6d60001, 0x220bd347,
-    0x410f000b, 0x46411149, 0x809b220c, 0x0c444180, 0x42809321, 0x17220d47,
-    0x418e1b00, 0x410b4941, 0x08201bf6, 0xf441588d, 0x8069210b, 0x002f6582,
-    0x00000400, 0x6b01eaff, 0x0b009601, 0x45001400, 0x152b05cb, 0x011e1133,
-    0x11373632, 0x18033533, 0x880802b0, 0x35233308, 0x01169533, 0x01304830,
-    0x0c0a8016, 0x0c0c130c, 0x06840921, 0x56560c33, 0xfe2a9501, 0x303024d5,
-    0x2a2b0124, 0x140bd6fe, 0x2002820b, 0x26228355, 0x406b0c13, 0x82000800,
-    0xab012500, 0x07008001, 0x2b08a144, 0x001f001b, 0x13000023, 0x11231521,
-    0x17200182, 0x200a4b45, 0x0ef56307, 0x15014027, 0xc06b406a, 0x06b1612b,
-    0x862b8021, 0x80012600, 0x0100ff40, 0x05ac4100, 0x852b1521, 0x0d2f5001,
-    0x17000b22, 0x4b496584, 0x465c850a, 0x0b8b0527, 0x2b2b6b26, 0x562b2b2a,
-    0x012d058a, 0x952bc080, 0x6bc02b95, 0x2aebeb2a, 0x8202826b, 0x003b0808,
-    0xff000004, 0x01e501c0, 0x001400a5, 0x0026001b, 0x0500002f, 0x011f0701,
-    0x14150607, 0x17331716, 0x16140706, 0x17373233, 0x3f352225, 0x37173301,
-    0x013f3632, 0x26343536, 0x4f132127, 0x4d080812, 0x1b36fee5, 0x051d2f5e,
-    0x1e9f1218, 0x12190111, 0xfe3d0c16, 0x130105d4, 0x0c422b32, 0x034c0613,
-    0xe1fe090c, 0x18181209, 0x25191924, 0x5e1bca01, 0x0b093563, 0x1d011812,
-    0x1812170c, 0x05c03d12, 0x2b2b2303, 0x058a0a0c, 0x010c0905, 0xa35ed5fe,
-    0x05d34109, 0x9601d622, 0x08434818, 0x82130021, 0x231125e8, 0x33352335,
-    0x25200385, 0x3b0a5b41, 0x2b2baa2b, 0x80805555, 0x400001aa, 0xaa6a6a40,
-    0x405501aa, 0x405556fe, 0x402a402b, 0x2b200282, 0x830a5b46, 0x00052753,
-    0x0011000b, 0x53820017, 0x1521112a, 0x23072521, 0x37333727, 0x17200584,
-    0x2b330584, 0xfe80012a, 0x2b000156, 0x572b2b57, 0x2b562b2c, 0x84c4562b,
-    0x95012c05, 0xa02a80fe, 0x604a4b4b, 0x824b4a4a, 0x444b2007, 0x05260ce3,
-    0x0d000900, 0x57871500, 0xa1821320, 0x03821720, 0x15210324, 0x03823523,
-    0x6a2c5585, 0xd556d6d6, 0x55016bd5, 0x2b00ff2a, 0xb4824f84, 0x01402b22,
-    0x93415f83, 0x01d63406, 0x000e00ab, 0x0045003c, 0x0500004e, 0x2e211727,
-    0x7a113501, 0x152a05c8, 0x15010e07, 0x2733013e, 0x0982010e, 0x011e1727,
-    0x012e013f, 0x05b45c27, 0x17261282, 0x36373616, 0x12822726, 0x16320725,
-    0x82263417, 0x055a5a05, 0x294f3320, 0x014d0807, 0xfe0e70d5, 0x1e1e17ed,
-    0x17400117, 0x352cd51e, 0x04022812, 0x1a01281b, 0x3019010a, 0x17140f02,
-    0x2c350101, 0x0101352c, 0x020f1417, 0x0a011930, 0x1b28011a, 0x12280204,
-    0x0e0b5835, 0x0e0e160e, 0x0f0f0a64, 0x400e0e15, 0x1e012b6b, 0x08438316,
-    0x1e010133, 0x15024617, 0x04100f02, 0x3b021602, 0x0a1c0152, 0x16061302,
-    0x02180101, 0x01011802, 0x02130616, 0x52011c0a, 0x0216023b, 0x020f1004,
-    0x16104f15, 0x21028810, 0x46180000, 0x0d270a73, 0x00002900, 0x18222301,
-    0x2b0a5fbe, 0x27262207, 0x33011e33, 0x2634013e, 0x17231883, 0x82173523,
-    0x24f082fe, 0x2b01010e, 0x0a4f4bab, 0x21ab3a08, 0x0a250d34, 0x2a201320,
-    0x2216202a, 0x1b55220a, 0x2d1d2e0f, 0x3d01013d, 0x12189501, 0x1812aafe,
-    0x00011218, 0x0f1d23d5, 0x3f2a0111, 0x2212162b, 0x1a171c55, 0x2e2d3c01,
-    0x2074823c, 0x2e008200, 0x56015701, 0x00001900, 0x010e1725, 0x71012e23,
-    0x07210660, 0x08788427, 0x33161431, 0x4a013637, 0x19240909, 0x54014846,
-    0x0823183f, 0x110d160d, 0x2e013025, 0x6b0e1c29, 0x01080434, 0x50493f51,
-    0x07350408, 0x2b302f03, 0x43030232, 0x022108bf, 0x25578400, 0x00310025,
-    0x5b983700, 0xc3453720, 0x15232405, 0x8b233523, 0x85e0200b, 0x53022172,
-    0x0c257283, 0x25110c17, 0x24728231, 0x2a150d1d, 0x2200822b, 0x822b952a,
-    0x2b2a2107, 0x6e218093, 0x831b852b, 0x848c8205, 0xfc012190, 0xff428b82,
-    0x42002005, 0x173a05f7, 0x27372707, 0x17370537, 0x01071707, 0x4a944a94,
-    0x56b1944a, 0x254a4a25, 0x068460fe, 0x5679c020, 0x80802505, 0x15959515,
-    0x00210582, 0x354b8201, 0x01d60100, 0x00030040, 0x21030100, 0x8ad50113,
-    0x018ae0fe, 0x1a85ff40, 0xff2e1582, 0x010002d5, 0x000b006b, 0x0022000f,
-    0xc9482500, 0x3527250a, 0x21051521, 0x2e066264, 0x37013e11, 0x1d011e21,
-    0xc0012301, 0x822b4040, 0xfe2b2802, 0xfe5501ab, 0x41ebebab, 0x552306d8,
-    0x842b1912, 0x95402618, 0x80552b2b, 0x0a3c4d2b, 0x86849520, 0x00002008,
-    0xac01dfff, 0x23009b01, 0x0e370000, 0x36161701, 0x36263537, 0x1636013f,
-    0x06141517, 0x83062207, 0x34112711, 0x26010f26, 0x11820706, 0x11a72c08,
-    0x65100544, 0x0b030106, 0x010c01a5, 0x44110b04, 0x07690c01, 0x01c81206,
-    0x54050110, 0x30281b01, 0x01d13a11, 0x0122030d, 0x82930a02, 0x28183107,
-    0x013a0b31, 0x03110234, 0x0d090129, 0x001001f2, 0x2008c355, 0x06a7472b,
-    0x1725002e, 0x35020f35, 0x15013b17, 0x80400123, 0x15270083, 0x40955656,
-    0x835640d6, 0x05002103, 0xc022a884, 0x2f86ab01, 0x27002328, 0x23370000,
-    0x03893315, 0x15233523, 0x56038323, 0x3320050c, 0x23073978, 0xc0213521,
-    0x2a2af682, 0x2b2b562a, 0xaa2b152a, 0x5318152b, 0x12260835, 0x2a01d6fe,
-    0x00832beb, 0x2b222282, 0x1082192b, 0x2405cb77, 0xabfe1912, 0x207283ea,
-    0x08fb4b02, 0x71831920, 0x01371326, 0x07062707, 0x2e2a6882, 0x1e332701,
-    0x36321701, 0x0a822737, 0x013f3425, 0x71153335, 0x273c05a8, 0x40270722,
-    0x1b65011b, 0x4022154e, 0x2b012921, 0x121b2401, 0x2340091e, 0x4902023f,
-    0x0c221087, 0x2182210a, 0x1b9bfe36, 0x2f09164e, 0x1d2c082f, 0x0d011812,
-    0x2207400a, 0x4307072b, 0x03241087, 0x00040021, 0x2b05eb7d, 0x00080096,
-    0x001c0013, 0x01000028, 0x2408fa55, 0x1e070622, 0x96461801, 0x2731080d,
-    0x13153311, 0x27263723, 0x0137013e, 0x0c0c0955, 0x0a0b0b13, 0x1010442c,
-    0x0f445944, 0x172d440f, 0x1e2d1e1e, 0x9540ff1e, 0x0d161855, 0x011a270c,
-    0x05cf6155, 0x262f4024, 0x03832f26, 0x2e1e2023, 0x2c02821e, 0xc000ff20,
-    0x17360001, 0x0e2b1c1e, 0x20008200, 0x08878201, 0xc601f829, 0x0d008001,
-    0x2e250000, 0x07270701, 0x011e0617, 0x013e3736, 0x601ab001, 0xb120b026,
-    0x2a37470c, 0x7c0a1915, 0x820c451b, 0x5c26270d, 0x17180e34, 0x7764002f,
-    0x01d62a08, 0x000f0080, 0x001d0015, 0x4f421823, 0x35332413, 0x61133523,
-    0x23270560, 0x23113317, 0x18552315, 0x2c095b40, 0x1b561218, 0x4a1b8030,
-    0x3b56951b, 0x0d7b6f1b, 0xd6fe2b24, 0x0383aa80, 0x0180aa24, 0x5752aa2a,
-    0x0031270a, 0x00430038, 0x35613700, 0x013e2107, 0x3323ab82, 0x8217011e,
-    0x06142803, 0x34262207, 0x183e3336, 0x300fd373, 0x17161407, 0x33073337,
-    0x17233707, 0x26220614, 0x23358227, 0x0860011e, 0x12447018, 0x09253026,
-    0x12090c0c, 0x0dcb7318, 0x0f110135, 0x2b2b406b, 0xe0361050, 0x011b291b,
-    0x03032a03, 0x18059e2a, 0x22102c70, 0x18013048, 0x32101073, 0x081d121c,
-    0x6a955537, 0x1c1c1523, 0x033b1b15, 0x82003b03, 0x00033600, 0x01fdff00,
-    0x009601eb, 0x0035000a, 0x25000064, 0x2622010e, 0x25968435, 0x3f362625,
-    0xc7822701, 0x20416f18, 0x7618c784, 0xfd950b50, 0x16171422, 0x2725f482,
-    0x8b01012e, 0x84be8201, 0xcdfe37bd, 0x30090902, 0x120d0723, 0x020d2307,
-    0x02081210, 0x1009300d, 0x13820804, 0x120d0629, 0x030d2306, 0x8309120f,
-    0x430f2213, 0x8c761801, 0x121d410c, 0x0d061227, 0x110f0611, 0x35e18832,
-    0x020f0901, 0x1207230d, 0x3023070d, 0x0f050909, 0x030c3009, 0x13861209,
-    0x30240624, 0x1383080a, 0x09020d2d, 0x013c2e90, 0x48012f26, 0x41300137,
-    0x3827133b, 0x0c110612, 0x18260f06, 0x2809bf48, 0x000b0096, 0x0023001a,
-    0x2d4a182c, 0x012e2414, 0x47023e34, 0x17200ad8, 0x4b076256, 0x5b200c8f,
-    0x6205af4e, 0x55550639, 0x850e2005, 0x0ca74b06, 0x60022823, 0x242a8249,
-    0x30493001, 0x23038202, 0x121b1235, 0xaa200282, 0x2c0c4361, 0x01c001d5,
-    0x001400ab, 0x001c0017, 0x2993821f, 0x23153315, 0x012f2313, 0x0682010f,
-    0x33354808, 0x25352335, 0x3f010f15, 0x17072301, 0x07271737, 0x08156b01,
-    0x880c2c48, 0x482c0c88, 0x01151508, 0x4e14e500, 0x5a0e9877, 0x3a141f5a,
-    0x2a566b01, 0x4e2feafe, 0x16012f4e, 0x2b15562a, 0x2e4fdf40, 0x34343480,
-    0x85214f7a, 0x266b85ff, 0x00180015, 0x9420001d, 0x1737216b, 0x80216c9a,
-    0x216c9a80, 0x6d8b152b, 0x200d9f4c, 0x9b4b1813, 0x27233010, 0x15230723,
-    0x32330733, 0x23013d36, 0x41161415, 0xc62c0c5f, 0x15401536, 0x80abd636,
-    0x0caa0c09, 0x2a0c5141, 0x2b151568, 0x96090cc0, 0x180c0996, 0x34080f8e,
-    0x009601ab, 0x0025000d, 0x00390033, 0x00490041, 0x1300004f, 0x08528233,
-    0x17161732, 0x2e272607, 0x33252701, 0x1d070e15, 0x3e352301, 0x16073507,
-    0x17011e17, 0x34352315, 0x2f262726, 0x07153301, 0x33172723, 0x23010f06,
-    0x33172627, 0x23243282, 0x33073736, 0x55362083, 0x1d13152b, 0x1a212728,
-    0x01011d18, 0x1d012b2b, 0x3339362f, 0x08881527, 0x19844620, 0x7e2d2484,
-    0x02d202d6, 0x0c07b80f, 0x0c0a7d0b, 0x20038217, 0x3c0b8207, 0xd602d220,
-    0x172a9501, 0x1a1a1327, 0x161a1519, 0x2a2a2237, 0x262c3722, 0x27262324,
-    0x200a8a17, 0x841b86b8, 0x15e63328, 0x0b2b0b0b, 0x0c09090c, 0x0b0c09d5,
-    0x0b370c0b, 0x375f1515, 0x006b2b09, 0x00130009, 0x37000022, 0x5b731521,
-    0x21132106, 0x2123ce83, 0x82013e35, 0x33372eb5, 0x06141632, 0x26222123,
-    0x012b3634, 0x059749aa, 0x00015530, 0xfe013024, 0x07300156, 0x162a2beb,
-    0x16851812, 0x2b6b1822, 0x2d060548, 0x2530012b, 0x30252a2a, 0x182a2a95,
-    0x02821825, 0x00040022, 0x01230082, 0x747601d8, 0x003208a9, 0x37352325,
-    0x35360727, 0x06222634, 0x35071714, 0x0c891523, 0x15371727, 0x07010e23,
-    0x08898215, 0x013e2120, 0x012e3537, 0x23153305, 0x15333533, 0x33352333,
-    0xc36b8001, 0x12027505, 0x1207121c, 0x07840d2a, 0xbe057f23, 0x0cab556b,
-    0x30eefe3a, 0x50605030, 0x33eb3030, 0x05131f21, 0x12120e05, 0x16020919,
-    0x0605021e, 0x1a290a82, 0x20201508, 0x1218012c, 0x82348580, 0x552a2106,
-    0xf7530082, 0x0009230a, 0xa3820019, 0x22010e28, 0x35232726, 0x5b183521,
-    0x95290f1f, 0x36240155, 0x01550124, 0x077e742a, 0x19191228, 0x24241b80,
-    0xdc47d51b, 0x8600200c, 0x01c021fb, 0x21071f7d, 0x5918000f, 0x80281f03,
-    0x802a802b, 0x2a2a552b, 0x96213b86, 0x09536301, 0x11130025, 0x82231133,
-    0x83332003, 0x20088203, 0x202c87c0, 0x47591801, 0x80fe210c, 0x20065348,
-    0x05a343ff, 0x14000a22, 0x2608756f, 0x33153307, 0x53151713, 0x3539055c,
-    0x2b402aeb, 0x402b8080, 0x6a02c015, 0x026a5454, 0x6b6a40ab, 0x40016a6b,
-    0xcefa1856, 0x0a635209, 0x1a001127, 0x00002800, 0xd4c21825, 0x22252a10,
-    0x32363426, 0x17061416, 0x07284607, 0x01210e83, 0xe4c218c9, 0xa0fe330c,
-    0x1b12120d, 0x5bed1212, 0x2e1e0f5b, 0x0f100f0f, 0x21821e2d, 0x9612182b,
-    0x0cc00c12, 0x240c960c, 0x05d3446e, 0x2082b120, 0x0f1e2e24, 0x26821010,
-    0x0400002e, 0xeaff0000, 0x9601c001, 0x1f001600, 0x2b237f82, 0x82010000,
-    0x161421be, 0x220b8573, 0x7835013e, 0x07331316, 0x00012317, 0x2d026c52,
-    0x2a2b2b28, 0x2d282b2b, 0x4ea76c02, 0xbc3305e2, 0x24191912, 0x20431818,
-    0x02950140, 0x5331526c, 0x82404b1b, 0x1b4b2600, 0x6c523054, 0x05835cbe,
-    0x40210585, 0x82708240, 0x02c02f83, 0x00c00100, 0x11000003, 0x02211121,
-    0x0d82fe00, 0x8200fe21, 0x82052000, 0x01ea241b, 0x829901d6, 0x0007221b,
-    0x27a38213, 0x13000029, 0x25170727, 0x375f0382, 0x013e210f, 0x3305785a,
-    0x15073327, 0x37233533, 0x1ba82335, 0x8f011b62, 0xba621b62, 0x8982a782,
-    0x70180585, 0x80220a38, 0x02834d4d, 0x20780124, 0x02822052, 0x02465324,
-    0x2485516d, 0xfe6d5134, 0x405402ac, 0x0202543f, 0x54403f54, 0x2b2759be,
-    0x2f41265a, 0x0423080a, 0x2a002100, 0x00003300, 0x2e331501, 0x013e1301,
-    0x23272135, 0x16173315, 0x15010e17, 0x3233011e, 0x84333736, 0x26352406,
-    0x41012e05, 0x088706c1, 0x15012708, 0x3e6002ab, 0xc9fe1311, 0x152f4a14,
-    0x15120612, 0x1c202a01, 0x042d0429, 0x2b1f1d29, 0x0ef7fe01, 0x121b1212,
-    0x0685b312, 0xaa95013b, 0xd9fe6148, 0x2b1d3516, 0x0b272c2b, 0x1f16220a,
-    0x1c1c242b, 0x231f2b24, 0x06a14643, 0xa9460120, 0x43002008, 0x112b0a6b,
-    0x00002900, 0x22152113, 0x56110706, 0x352405e7, 0x23012e11, 0x51054856,
-    0x152b0e92, 0x01401133, 0x01181280, 0x84d61218, 0x6b552305, 0x0082406b,
-    0xd6330583, 0x182b8001, 0x1200ff12, 0x01121919, 0x2a181200, 0x85151516,
-    0x01402102, 0x2b064b43, 0x96010002, 0x2a002600, 0x32002e00, 0x3e387382,
-    0x17163201, 0x36321614, 0x1533013d, 0x2622010e, 0x22012e35, 0x15331506,
-    0x220aee52, 0x82213537, 0x27480883, 0x17153335, 0xf0071737, 0x273b2701,
-    0x090e0901, 0x291b0120, 0x2015011b, 0x3a2f1b15, 0x40540101, 0x01015440,
-    0x00012f3a, 0x16402b2b, 0x1f101e13, 0x281d4001, 0x09071d28, 0x10100709,
-    0x141b1b14, 0x10151510, 0x344d0e1c, 0x2c05a941, 0x1c0e4d34, 0x2a2a4015,
-    0x1f0f1e08, 0x09234400, 0x1700ab28, 0x34001b00, 0x9b823800, 0x4c231521,
-    0x2b300d5e, 0x15233501, 0x21073523, 0x22372115, 0x33151706, 0x2205ac41,
-    0x83010e07, 0x3e372a0a, 0x26343501, 0x35331507, 0x0a754c80, 0xaa2b1522,
-    0xfe37fa82, 0x221c99d6, 0x120c2901, 0x11080a0c, 0x08062a0c, 0x3722130e,
-    0x44ab012a, 0x2b3a0ca8, 0xea962b2b, 0x011919d5, 0x140d0a0a, 0x120b050e,
-    0x050c0a10, 0x18101907, 0x1359951d, 0x82042005, 0x010022a7, 0x06c744eb,
-    0x1c001722, 0x3323a382, 0x82132311, 0x45012003, 0x37320a1d, 0x03012e11,
-    0x17371737, 0x562b2b15, 0x6a012a2a, 0x911800ff, 0x012c08a1, 0x2635f30c,
-    0x55014436, 0x2a01d6fe, 0x0c210383, 0x251d8909, 0x2e4400ff, 0xdd185a44,
-    0x78210927, 0x06f74e00, 0x17071328, 0x013f2737, 0x07821707, 0x2605b764,
-    0x1e62628d, 0x825e4444, 0x621e2903, 0x1e4ead62, 0x7701cb6c, 0x1e201284,
-    0x4c251284, 0x6d1e4fad, 0x20ae83cb, 0x82048303, 0x006b26b3, 0x0017000b,
-    0x0da14924, 0x013e1322, 0x08cc8918, 0x011e272e, 0x012e1517, 0x15373634,
-    0x4001010e, 0x2108696f, 0x55186002, 0xca2b0bce, 0x38262e01, 0x26384747,
-    0x496b012e, 0x05840589, 0x6fd7fe21, 0x7f2c0a8c, 0x2c0e412a, 0x597a590f,
-    0x410e2c0f, 0x04377e83, 0xbfff0000, 0xc1010002, 0x15000a00, 0x2f001e00,
-    0x2e170000, 0x82232701, 0x37322471, 0x82221327, 0x360a82d5, 0x03012e33,
-    0x26343533, 0x3315012b, 0x15231107, 0x15331523, 0x823b1614, 0x33352e0d,
-    0x44359f35, 0x8e0a2006, 0x51070767, 0x20038245, 0x280e851d, 0x12192b13,
-    0x2baa8080, 0x8207822b, 0x1a0b2d05, 0x84653d5f, 0x01510102, 0x1d5101ae,
-    0xfe2d0c84, 0x181380d7, 0x0001aa2b, 0x12aa2b2b, 0x83288219, 0x8306208f,
-    0xd6012404, 0x55008001, 0x27220509, 0x93832b00, 0x23350126, 0x23012e35,
-    0x820bc941, 0x05be5379, 0x69210721, 0x6b5a05bb, 0x31078307, 0x012ad501,
-    0xd5fe1218, 0x12181812, 0x18122b01, 0x00822a01, 0xd5fe2b2c, 0x00ff2b01,
-    0x55806b6b, 0x05848055, 0x2a227b82, 0xee4e1912, 0x2b2a2e07, 0xd52b2a2b,
-    0x56aa2a01, 0x6b4040d6, 0x08a34615, 0x2007b757, 0x0d75560f, 0x7e821720,
-    0x220cc749, 0x49d6d610, 0xe8240cbd, 0x0300002a, 0x2008b74e, 0x26d1840d,
-    0x23152500, 0x82013e17, 0x222726cc, 0x27170706, 0x05e94407, 0x36321739,
-    0x25371737, 0x01173335, 0x12631f6b, 0x5b780214, 0x9a1a3d22, 0x873c1bf1,
-    0x1c3b340b, 0x2b1fc5fe, 0x1a642ad5, 0x785b223d, 0x9a121402, 0x873b1cbb,
-    0x1b3c220b, 0x088f47bb, 0x6b01ab22, 0x0f247582, 0x17001300, 0x3c08af82,
-    0x11213521, 0x33352115, 0x21352327, 0x27072315, 0x17233533, 0x01233733,
-    0x01aafeab, 0x47aafe56, 0x2a011b16, 0xd6cf161b, 0x176e34d6, 0x2b40019c,
-    0x2b2bd5fe, 0x55808055, 0x55ab2b80, 0x0a3b4600, 0x2405935a, 0x002f0023,
-    0x0d054136, 0x210b7d76, 0xcf820713, 0x82170721, 0x372722c9, 0x20058407,
-    0x82118527, 0x2e3322ea, 0x0b2c4101, 0x425a7921, 0x10220ac5, 0x00841716,
-    0xc9200683, 0x70260b8a, 0xda0d3a26, 0x54413a0d, 0x18fe200c, 0x250bfc5b,
-    0x16160301, 0x31841716, 0x44171622, 0x0c824382, 0x42241184, 0x29212129,
-    0x1d23bf91, 0x69002300, 0xbf8b0e87, 0xba842720, 0x2728c082, 0x32011f07,
-    0x1e233736, 0x3421b399, 0x27778217, 0x1717862d, 0x59172d2e, 0xd520a79f,
-    0x17239a82, 0x83172d2d, 0x848a2003, 0x0002219a, 0x2b080082, 0x6b01d601,
-    0x1b001100, 0x23010000, 0x010e2327, 0x16141115, 0x013e2117, 0x2634013d,
-    0x37072707, 0x1f013f27, 0xab010701, 0x12802bab, 0x07686418, 0x3f3f3e2f,
-    0x1d483711, 0x0137481d, 0x18012b40, 0x07d05f12, 0x1912d52c, 0x472525eb,
-    0x43430630, 0xbf463006, 0x8b280807, 0x02008001, 0x00000a00, 0x2717013f,
-    0x33373303, 0xcd033317, 0x76483333, 0x18861830, 0x87c07630, 0xd5fec087,
-    0x2b014040, 0x002a2582, 0x7401e9ff, 0x2b009601, 0x8f823900, 0x22232624,
-    0xfa680706, 0x15162a08, 0x0623010e, 0x33163727, 0x07125632, 0x013e8308,
-    0x3e272637, 0x17323301, 0x36171607, 0x27263435, 0x010e2726, 0x4e011614,
-    0x211a251f, 0x20260101, 0x01013429, 0x02151114, 0x292f2a41, 0x1c29220e,
-    0x20010123, 0x01352d27, 0x14121701, 0x2d3b0101, 0x2268252a, 0x1c18161f,
-    0x0e0c2323, 0x1262011c, 0x18151417, 0x26280c0a, 0x150c2415, 0x01292d1d,
-    0x18172019, 0x0d1b1317, 0x1524280f, 0x1d130a24, 0xe0132b26, 0x1b11110b,
-    0x0c0a1c10, 0x1e180711, 0x0082001b, 0xad82db82, 0x4a01c021, 0x13230983,
-    0x44002300, 0x472b0535, 0x33130000, 0x33012b15, 0x86372315, 0x82272003,
-    0x44252007, 0x35280a45, 0x03263411, 0x17333523, 0x37200386, 0x53052767,
-    0x35200641, 0x28056e61, 0xeb213523, 0x2b2b2a2a, 0x05f76d2b, 0x2b2bab25,
-    0x18fe0001, 0x2108ff6c, 0x5553e719, 0x832a2008, 0x82288225, 0x2a012407,
-    0x822b0001, 0x20328307, 0x0c4f53ab, 0x4882c020, 0x6a2b2b22, 0x08842682,
-    0x442a2b21, 0xc7820767, 0x9401d430, 0x13000800, 0x35370000, 0x35331533,
-    0x5d700727, 0x23153307, 0x80c02335, 0x80808040, 0x2a9628d3, 0x802b2896,
-    0x0282ac80, 0xd3680126, 0xc08080c0, 0x63081b4e, 0x9b5f0533, 0x05fd460c,
-    0x05543720, 0x58012006, 0xf38508f1, 0x0f863720, 0xfeab012d, 0x551812aa,
-    0x18122b01, 0x85eefe18, 0x6b952498, 0x82ab406b, 0x95012600, 0x80fe1218,
-    0x05b54855, 0x2b00ff23, 0x20018215, 0x480584ab, 0xff38051b, 0x01d601c5,
-    0x0007009c, 0x000e000b, 0x13000020, 0x37111707, 0x25371733, 0x27255b82,
-    0x21251735, 0x22cc8217, 0x44331723, 0x112b05f8, 0x1b1b2634, 0x7ac0552b,
-    0x83d6fe1b, 0x00013767, 0xab7eacfe, 0x699415a9, 0x18171295, 0x2b1b9b01,
-    0x7a5596fe, 0x6082b41b, 0x7ec02b23, 0x21068229, 0xe4620195, 0x66002005,
-    0xe3830553, 0x00172708, 0x2500002d, 0x2e233523, 0x37363401, 0x013e1716,
-    0x36171632, 0x14011e37, 0x07230706, 0x21352335, 0x17152315, 0x4c18011e,
-    0x248207c9, 0x572c0130, 0x2b2b1f60, 0x0716221f, 0x072d3e2d, 0x0c832216,
-    0x6a575f3f, 0x7f692a01, 0x0e120c09, 0x120ec0fe, 0x15c0090c, 0x2a402a01,
-    0x1e180101, 0x181e2525, 0x320c8401, 0x2a2a197e, 0x10042e19, 0x12120e0a,
-    0x04100a0e, 0x82000100, 0x80012700, 0x13008001, 0xf7480000, 0x15233d05,
-    0x1507010e, 0x35331517, 0x012e3537, 0x562a5501, 0x0119112a, 0x014b6a4b,
-    0x552b0119, 0x012a0082, 0x4b751119, 0x754b4040, 0xc7841911, 0xab01e922,
-    0x0f263f82, 0x00002000, 0xc0831513, 0x27293783, 0x23152335, 0x07060735,
-    0x084a8417, 0x1f163634, 0x26373601, 0x6262ab27, 0x01030b03, 0x562a0d1d,
-    0x550d0e8f, 0x07046a4b, 0x0c104a04, 0x8001b0b4, 0x04606244, 0x12770609,
-    0x55520513, 0x0d0e1555, 0x64826f56, 0x020a0328, 0xb20e0e4d, 0x008200b2,
-    0x82000221, 0x96012700, 0x03006b01, 0x6b830a00, 0x05352123, 0x32a68233,
-    0x016b2733, 0x55d6fe2a, 0x01955580, 0xd62b2b6b, 0x60968080, 0x1d220a33,
-    0xe5452300, 0x1f232405, 0x4c233701, 0x07250712, 0x07272622, 0x069d771e,
-    0x2d08ed82, 0x01352737, 0x026d5115, 0x56025340, 0x3f540240, 0x02025440,
-    0x361f4054, 0x451a1e14, 0x026c5228, 0x5b676c02, 0x80014b10, 0x53526c02,
-    0x304c5603, 0x15172408, 0x821e1a1f, 0x6c522713, 0x1a376a69, 0x99825a2d,
-    0xeaff002c, 0x9601eb01, 0x39003000, 0x79824200, 0x1716322b, 0x15070614,
-    0x17011e33, 0x230b8233, 0x2b010e15, 0x2207cb41, 0x8223013d, 0x3e352486,
-    0x82013b01, 0x35332397, 0x0b82012e, 0x21060473, 0xdd7f2634, 0x00013208,
-    0x0c011812, 0x543f160a, 0x0c091502, 0x090c0101, 0x05854315, 0xaf820d87,
-    0x0c0a1625, 0x674e1801, 0xa9200556, 0x01270685, 0x0c121895, 0x821b0514,
-    0x090c2ac7, 0x160c0940, 0x12181812, 0x820a8416, 0x051b27dd, 0x18120c14,
-    0x501801ea, 0x27600ed5, 0x82b02007, 0x000734c9, 0x13000022, 0x23371707,
-    0x25071737, 0x3523012e, 0x82351707, 0x141621c2, 0x2323a382, 0x45072722,
-    0x25080542, 0x8b8b9d34, 0x4e4ed88a, 0x1c00014e, 0x5a5a2646, 0x2c16371d,
-    0x1d37162c, 0x2b201d1f, 0x1c462631, 0x8a370138, 0x1f828a8a, 0x1c1dd335,
-    0x455a5b45, 0x772e1616, 0x0d16162e, 0x1c1c181f, 0x5800993b, 0x562c0937,
-    0x16001200, 0x00001a00, 0x05172537, 0x1805587d, 0x23085fd3, 0x23353305,
-    0x5a270383, 0xfe0f4c01, 0x480c01d4, 0x0e2f07e9, 0x2a2a1d01, 0xd5d500ff,
-    0x6d2879dc, 0x50551219, 0x75230566, 0x4983150e, 0x05230584, 0x48ff0000,
-    0x082805f3, 0x15000c00, 0x3a002c00, 0x32215f82, 0x05fc5b16, 0x15332724,
-    0x0c871723, 0x35172f08, 0x2607012e, 0x1e150706, 0x15071701, 0x17333733,
-    0x3e273533, 0x011e0301, 0x11211115, 0x3e373634, 0xb5163201, 0x120c0c09,
-    0xd6170c0c, 0x0985b6d6, 0x49013e3e, 0x024c3236, 0x18181f01, 0x203c2024,
-    0x1f181820, 0xfe2e2b03, 0x1d2b2e56, 0x80413c41, 0x22058957, 0x85156b80,
-    0x13230808, 0x01182993, 0x93291801, 0x18011f18, 0x08202008, 0x011f0118,
-    0x2d43112f, 0x1801e8fe, 0x0b11432d, 0x42000707, 0x802c0643, 0x09009601,
-    0x13000e00, 0x15130000, 0x213c9082, 0x35372735, 0x35231503, 0x35273537,
-    0x55801533, 0x55000155, 0x55aa2b55, 0x9501aa55, 0x80200d82, 0xfe280383,
-    0x554b4bcb, 0x4b4b5516, 0x2d070f4b, 0x01d601d5, 0x000600a0, 0x0016000d,
-    0x715a0030, 0x37272705, 0x07173517, 0x01602335, 0x010f2109, 0x36245783,
-    0x011f1633, 0x1525fc82, 0x07272622, 0x2d118217, 0x01230727, 0x35757560,
-    0x35354035, 0xc34f6075, 0x26623a05, 0x0808702a, 0x0f140d17, 0x3c231e30,
-    0x2b2c0d15, 0x752d252e, 0x36352520, 0x08038280, 0x01202621, 0x19241830,
-    0x49182419, 0x2e644710, 0x22130103, 0x2a011c18, 0x2c401a1d, 0xab2b80a1,
-    0x83040000, 0x98012198, 0x080bc764, 0x27233743, 0x013f3337, 0x07170717,
-    0x2717012f, 0x27371723, 0x33072707, 0x6937c237, 0x911c3769, 0x281c1c28,
-    0x3f6e1991, 0x1d1de37f, 0x7f50543f, 0x6b6b553f, 0x30902530, 0x36259030,
-    0x6d586e1e, 0x50656d6d, 0x0ae34e6e, 0x21001b22, 0x232ee782, 0x07012e37,
-    0x16171406, 0x35363732, 0x8a181433, 0x32310863, 0x15073717, 0x35270717,
-    0x3b91c001, 0x2c2e772e, 0x0804822c, 0x1c2b2b30, 0x3b9a3b1c, 0x983b3838,
-    0x4ab53a3b, 0x3ce85b0f, 0x2d2b012c, 0x2b2b2e76, 0x49213e2b, 0x3a38381c,
-    0x38383a98, 0x2d5a6b3c, 0x006a371a, 0x00820006, 0x47000221, 0x20290aa7,
-    0x00002900, 0x15333537, 0x23038221, 0x23153337, 0x25330783, 0x010f0614,
-    0x012e2723, 0x013f3634, 0x011e1733, 0x6b011e07, 0x40330510, 0x2b2a012b,
-    0xfe2b2b15, 0x54012b2b, 0x7f10161a, 0x861a1610, 0x01df2406, 0x82365136,
-    0xd6552102, 0xab2c0082, 0x41808080, 0x5b12341f, 0x3d34125b, 0x1e210685,
-    0x391d8329, 0x00030036, 0x01f5ff00, 0x008b01bd, 0x000c0005, 0x0100000f,
-    0x2f010f17, 0x18493701, 0x27220805, 0x00013723, 0xa0a01dbd, 0x2c76bd1d,
-    0x2b186418, 0x01224552, 0x59f9448b, 0xfe17f959, 0x603c3cf7, 0x77430053,
-    0x01d63708, 0x00030056, 0x0013000b, 0x21111300, 0x35230111, 0x14011e33,
-    0x8f461706, 0x2b332b05, 0xabfeaa01, 0x3c2f2b2b, 0x0483fc3c, 0x4e2b2f21,
-    0xff270553, 0x3c03d600, 0x84033c58, 0x464b8204, 0x0b2209cf, 0x49820e00,
-    0x2e05434e, 0x27372737, 0x0717010f, 0x6a156beb, 0x846a166a, 0x21d38205,
-    0x0c879501, 0x20221282, 0x3f884b4b, 0x7705e363, 0x213c0537, 0x33153317,
-    0x33352115, 0xfe56aaab, 0x6b2a96aa, 0x016b00ff, 0x1500ff95, 0x002a2a6b,
-    0x3106ef41, 0x00000180, 0x00070004, 0x07150100, 0x37173527, 0x5d820123,
-    0x7239802a, 0x80200001, 0x39642080, 0x0b202789, 0x25262785, 0x15072735,
-    0x27871737, 0x26836b20, 0x26826320, 0x00030029, 0x01c0ff00, 0x829601eb,
-    0x00102259, 0x27518219, 0x33012f33, 0x010e1517, 0x07acdc18, 0x2111072f,
-    0x26222115, 0x55011127, 0xd6c07676, 0x07934d80, 0x8001432d, 0x181280fe,
-    0x75000101, 0x44d58020, 0x012b057f, 0x5518122b, 0x192babfe, 0x83550112,
-    0x225b87a1, 0x820b0008, 0x001f235b, 0x4c871300, 0x668f0520, 0x21111726,
-    0x40352335, 0x40205487, 0x12256b8c, 0x01952b01, 0x20588640, 0x236f8d40,
-    0x95d5fe2a, 0xef44bd83, 0x000f2207, 0x50678215, 0x23260dd9, 0x07173307,
-    0x1f193723, 0xf4210a87, 0x2000824a, 0x0a086049, 0xb9825620, 0x3f648020,
-    0x00022205, 0x06d35400, 0x82000921, 0x052656b3, 0x37013e2c, 0x16320735,
-    0x1517011d, 0x03821527, 0x82350721, 0x2303820f, 0x00013634, 0x2c06d754,
-    0x6c0c08c0, 0x2f2f1b6c, 0x0c6c6c1b, 0xd9a21801, 0x0c0e3509, 0x1b434b08,
-    0x14154a22, 0x15140e0e, 0x431b224a, 0x000c084b, 0x26089351, 0x006b01d6,
-    0x820c0007, 0x001e23b5, 0xdb182500, 0x35210bf7, 0x227a820e, 0x4b373533,
-    0x32240594, 0x01263436, 0x0cecdb18, 0x02604926, 0x15165680, 0x3805d359,
-    0x152c15a3, 0x091b0707, 0x812c817f, 0x24300195, 0x0255292b, 0x493001d6,
-    0x82028230, 0x8203206b, 0x01e02ad3, 0x00a001eb, 0x00170013, 0x3369821b,
-    0x012f3727, 0x010f2707, 0x07170717, 0x1737011f, 0x0727013f, 0x2a07494a,
-    0x4d0734eb, 0x28494928, 0x8834074d, 0x2aa22109, 0xc02e0082, 0x44114f3b,
-    0x11441f1f, 0x4f3b3c4e, 0x09834312, 0x2b304f26, 0x0100802b, 0x00336382,
-    0x33010002, 0x00002b00, 0x0f062201, 0x012e0601, 0x82013e34, 0x83272059,
-    0x1e072dbf, 0x36321701, 0x1e36013f, 0x010e1401, 0x173e7982, 0x013e1716,
-    0x01012e37, 0x102a178d, 0x293d1596, 0x18163d29, 0x30221b21, 0x01014131,
-    0x14893141, 0x87201921, 0x33012f14, 0x15851011, 0x283e2801, 0x1c151601,
-    0x27832118, 0x148e2d82, 0x31400226, 0x04004131, 0x240a2744, 0x0012000b,
-    0x08294415, 0xea82ec82, 0x27231728, 0x37230723, 0x2f440727, 0x17952e07,
-    0x95177e7e, 0x53142562, 0x1d7f2513, 0x0635441d, 0xc535192c, 0x1bc54646,
-    0x4f3030db, 0xe2854545, 0x012e0582, 0x008001c0, 0x0018000f, 0x36341300,
-    0xdb6e2133, 0x26222707, 0x27151335, 0x55821707, 0x19403524, 0x96500112,
-    0x18132a06, 0x7e1e4bab, 0x014b1e7e, 0x09a75055, 0xb5150123, 0x2114834a,
-    0xa754b54a, 0x2053840b, 0x204f8a01, 0x205f8211, 0x82a68305, 0x01332254,
-    0x5e3f9395, 0x6a880b42, 0x840a1746, 0x18332053, 0x220dce67, 0x84332523,
-    0x231722a6, 0x8652836b, 0x87eb20a9, 0x92bb9292, 0x592520fb, 0x352005b7,
-    0x2120a383, 0x0321b382, 0x82a48235, 0x01152256, 0x05a649c0, 0x91884683,
-    0x68932b20, 0x00002a08, 0xff000001, 0x01cf01ea, 0x00110096, 0x07331300,
-    0x17071737, 0x23172707, 0x37270737, 0xd5173727, 0x2b891156, 0x892b9a9a,
-    0x29088711, 0x63a89501, 0x4a46464a, 0x0786a863, 0xeb830020, 0x01c0ff29,
-    0x008601bb, 0x822f0023, 0x06223052, 0x06152307, 0x35361707, 0x3527012e,
-    0x55363423, 0x857d0882, 0x22168205, 0x6d170705, 0x3b0805dc, 0x01371737,
-    0x01271d35, 0xd013161b, 0x2f3a0119, 0x1520151b, 0x1b291b01, 0x0d09011f,
-    0xfe270109, 0x0b4b1ef6, 0x1e405401, 0x011e4c1b, 0x1c1e2785, 0x26cf0d06,
-    0x0e4d342d, 0x1515101c, 0x31057555, 0x09090710, 0x4d271e07, 0x1f1b4b1e,
-    0x0c02543f, 0xcb751e4c, 0x000f260d, 0x0025001d, 0x122b422d, 0x32331129,
-    0x012e3736, 0x82363223, 0x35072fa7, 0x14163233, 0x33010f06, 0x0614011e,
-    0x4042012b, 0x6b60340c, 0x01012f25, 0x2119192b, 0x3b1a2a01, 0x12120e20,
-    0x832b200e, 0x422b2005, 0xff310d53, 0x20242700, 0x21322120, 0x12406b01,
-    0x2a01121b, 0x20058201, 0x27531800, 0x000f2209, 0x208d8213, 0x05b36027,
-    0x3207e445, 0x013e3527, 0x35211517, 0x23010e13, 0x27262221, 0x88152135,
-    0x016b2209, 0x05794b2a, 0x84d6fe21, 0x011e2607, 0x0c012b00, 0x200d8509,
-    0x23098a56, 0xd5090c95, 0x06832184, 0xabab2a2a, 0x0c09eafe, 0x6b16090c,
-    0x15200583, 0x2f0c7f56, 0x001e0015, 0x002c0025, 0x2e230100, 0x07062201,
-    0x200e8456, 0x07964a23, 0x33271336, 0x33153335, 0x23352307, 0x01231737,
-    0x20075995, 0x5907202a, 0x20084642, 0x05874aa7, 0x40554930, 0x2ac0402a,
-    0x40555540, 0x17138001, 0x7b421317, 0x19122109, 0x28057c4a, 0x9555abfe,
-    0x55951595, 0x084b4d55, 0x8001c02d, 0x17000b00, 0x013f0000, 0x42173727,
-    0xec520573, 0x6640260c, 0x65655b66, 0x2205845b, 0x881e6565, 0x82148802,
-    0x8aa2201a, 0x04002217, 0x050b5200, 0x3905c350, 0x00230019, 0x21353300,
-    0x23351115, 0x16323715, 0x0614011d, 0x0e15012b, 0xf3820701, 0x35272508,
-    0x14152305, 0x32013b16, 0x012b3536, 0x122b2b80, 0x2b121818, 0x80243001,
-    0x01013025, 0x1219d500, 0x2b181280, 0x40282e82, 0x12196b40, 0x40181240,
-    0x30241783, 0xaa2bd525, 0x002efc83, 0x00000500, 0xd601c0ff, 0x0300c001,
-    0xc5820700, 0x2800202b, 0x21010000, 0x21012115, 0x52038235, 0x35230983,
-    0x18263411, 0x27089b41, 0x3e352317, 0x17163201, 0x21073654, 0x2b195601,
-    0x14300f3e, 0x1b281b1b, 0x04d67f1b, 0x04493c49, 0xfe2bc001, 0x6f728482,
-    0x013a210f, 0x28242383, 0x1b20da1b, 0x00230082, 0x82000200, 0xb3012300,
-    0x89829801, 0x0000122e, 0x37250701, 0x011f3717, 0x17331107, 0x2e062c78,
-    0xfe16b301, 0x1d4116fd, 0x6cf2085c, 0x82121994, 0x02012cc3, 0x25259525,
-    0xfc1d3608, 0x82560001, 0x8219200f, 0x82032042, 0x45002003, 0x24220657,
-    0xc1472c00, 0x2e112713, 0x35012b01, 0x04822634, 0x36323330, 0x3e33013d,
-    0x15170701, 0x1517011e, 0x06656b23, 0x44443809, 0x150f1c04, 0x2a80090c,
-    0x112a0d09, 0x0166e418, 0x01911218, 0x51131880, 0x133507ed, 0xfcfe2b18,
-    0x0940100e, 0x090c2b0c, 0x6115012b, 0x18121560, 0x21838301, 0xef730004,
-    0x00802905, 0x001f0009, 0x002d0024, 0xb574cf82, 0x01272605, 0x23070129,
-    0x4e03820e, 0x4e0805c7, 0x15270733, 0x36341107, 0x27263513, 0x33153707,
-    0x35171632, 0xeb011607, 0xfe12192b, 0x011b2bf1, 0x019cfe8f, 0x021e2a2e,
-    0x012a1118, 0x212a090c, 0x182b4b27, 0x2a0d15a4, 0x1c0f15a1, 0x010a4e04,
-    0xf1fe2b65, 0x1c2b1912, 0x102b8f01, 0x822b0115, 0x4727358b, 0x2e012a93,
-    0xabfe1813, 0x290f0119, 0x0e104084, 0x00064fbf, 0x22085742, 0x71050056,
-    0x002206ad, 0x7c823501, 0x55421720, 0x21232106, 0x2406f16d, 0x15333505,
-    0x22038207, 0x82805501, 0x19122500, 0x00ff1219, 0x2d057054, 0x012a2a2a,
-    0x56562b00, 0x18aa552b, 0x1983c012, 0x1812c027, 0x556b6b95, 0x05db562a,
-    0x0100002b, 0x006001eb, 0x00140008, 0x210b821e, 0x234e011e, 0x1e372205,
-    0xd4cb1801, 0x1e072108, 0x30059a65, 0x00010622, 0x3624241b, 0x511b2424,
-    0x7d1d1d7d, 0x25058451, 0x7a641b6b, 0x04831b64, 0x01000122, 0x36281c83,
-    0x58016124, 0x01584747, 0x9f240584, 0x363f3f36, 0xcb830382, 0x59eaff21,
-    0x1320062b, 0x6605ab45, 0x23260583, 0x3627012e, 0x70821737, 0x18741420,
-    0x06172105, 0x2e230783, 0x82222301, 0x307c8207, 0x27373233, 0x012f012e,
-    0x011b2b06, 0x25421b65, 0x29778229, 0x1ba72d17, 0x51040124, 0x0c820b0a,
-    0x1e3b1b2c, 0x641b192c, 0x2120233d, 0x0782862e, 0x3115162f, 0x49032017,
-    0x1b500120, 0x411b9bfe, 0x2a88820c, 0x01212839, 0x0a0b1b24, 0x82600451,
-    0x2b44340d, 0x36321e1f, 0x15200a3f, 0x043f36a0, 0x17200331, 0x44001c49,
-    0x2f0808a7, 0x004001cb, 0x00050002, 0x000b0008, 0x07172500, 0x37071727,
-    0x11253711, 0x40400137, 0x4040c040, 0x8afeb695, 0x2d2dedb6, 0xad2d2d5a,
-    0x808000ff, 0x3b820382, 0x2205cb46, 0x829c01d6, 0x010032db, 0x0e070626,
-    0x3e371701, 0x36163701, 0x07222637, 0x870c823e, 0x82062006, 0x0819820d,
-    0x06d50147, 0x3f4966b7, 0x21162901, 0x25512916, 0x29253b1f, 0x1c162744,
-    0x371e1b2f, 0x28181a26, 0x22341a1c, 0x95011901, 0x697e3006, 0x27150396,
-    0x0e0d172d, 0x1d050929, 0x052b0711, 0x02171606, 0x0705012a, 0x02021717,
-    0x3d7b8226, 0xff000002, 0x01cb01f5, 0x0010006b, 0x13000025, 0x07171632,
-    0x2e073533, 0x010e2701, 0x7b823307, 0x37362608, 0x23010e23, 0x37272622,
-    0x1e371523, 0x37363301, 0x16eb3717, 0x80360f26, 0x1f36142c, 0x2b09513a,
-    0x16a03908, 0x21058205, 0x15841727, 0x1f36152a, 0x20682632, 0x0e114001,
-    0x172c2383, 0x37470201, 0x1dc22f25, 0x10302526, 0x15263583, 0x681c0117,
-    0xc34c0020, 0x016b2608, 0x00060096, 0x087b820d, 0x33073324, 0x37233503,
-    0x37153315, 0xd6953723, 0x40964b4b, 0x512b402b, 0x9595014c, 0xd6aaebfe,
-    0x964e39ab, 0x37820400, 0x3107ef43, 0x00200012, 0x01000024, 0x15331133,
-    0x35333523, 0x07840723, 0x3307372b, 0x16323301, 0x3523011d, 0x08178223,
-    0x17363438, 0x01353315, 0x5515406b, 0x20205515, 0x4b951656, 0x6aebfe4b,
-    0x40401813, 0x40281840, 0x00ff1501, 0x40401515, 0x95eb1515, 0x13181501,
-    0xea6a6aea, 0x552b1813, 0x95820055, 0xdb5f0020, 0x05bf5906, 0x22055b56,
-    0x82212500, 0x011e2d57, 0x36322133, 0x03233537, 0x07062223, 0x33206082,
-    0x3322b682, 0x4b560735, 0x82212006, 0x82212089, 0x8001230b, 0x6b6a00ff,
-    0x552b3508, 0x011812ab, 0x2b55ab2b, 0x6a4040c0, 0xebfe4040, 0x80014040,
-    0xca457a82, 0x18552907, 0x56abab12, 0x2aaa5555, 0x1b4b0083, 0x80012d05,
-    0x0e008001, 0x2e370000, 0x37363401, 0x11215682, 0x2f018323, 0x303024d5,
-    0x2a2bab24, 0x01d52b2b, 0x01304930, 0x6106ef6a, 0x562b0897, 0x0c000800,
-    0x14001000, 0x41250000, 0x34750507, 0x2da58205, 0x23151723, 0x2a950135,
-    0x95952ad6, 0x0084aaea, 0xc0c01528, 0x405555eb, 0x0182152b, 0x02002b23,
-    0x22008200, 0x85019601, 0x893f8d43, 0x44338737, 0x6532096b, 0x29001900,
-    0x3b003200, 0x3e010000, 0x06342701, 0x01822607, 0x15012e28, 0x06171606,
-    0xd0421e07, 0x06072f05, 0x37342726, 0x3e171636, 0x17161701, 0x6a18010e,
-    0xcd7f0895, 0x01670808, 0x0d0603b3, 0x2b28302c, 0x2c30282b, 0x2103060d,
-    0x5f750101, 0x0101765e, 0x015a44d4, 0x2a44161b, 0x1b16442a, 0x875a0201,
-    0x1b13130d, 0x0e781212, 0x131b1212, 0x070a0112, 0x0602222f, 0x0101091e,
-    0x02051f09, 0x23072f22, 0x02466536, 0x36654602, 0x3e1e03c4, 0x0412181f,
-    0x12040202, 0x1f3d1f18, 0x1c281b88, 0x851b291b, 0x20ea8202, 0x08f35206,
-    0x10000d23, 0x05e54100, 0xeb483a20, 0x11152305, 0x024b2107, 0x15012705,
-    0x35330737, 0x9a5d3533, 0x1517240a, 0x5c233733, 0x2724058a, 0x1417011e,
-    0x8206136b, 0x01553322, 0x63181256, 0x1812e3fe, 0x45280118, 0x141556db,
-    0x3f7d0116, 0x16012405, 0x83561514, 0x242b3300, 0x13170130, 0x01171356,
-    0x18950130, 0x63e3fe12, 0x35831218, 0x45c0fe2b, 0x6b152a45, 0x2d1a2d0e,
-    0x2e33833d, 0x6b0e2d1a, 0x15151615, 0x243001c0, 0x820b2718, 0x18272500,
-    0x04003024, 0xe42eb382, 0x9c01dc01, 0x15000a00, 0x2b002000, 0xd9450000,
-    0x232f0805, 0x35012f22, 0x23151737, 0x013d2622, 0x17323334, 0x0f141532,
-    0x34352301, 0x33273336, 0x2b061415, 0x34352201, 0x1912d537, 0x60030206,
-    0x83406076, 0x06cd2708, 0x19645f03, 0x0382b912, 0x03069525, 0x821219ab,
-    0x645f2205, 0x221383ed, 0x83db0695, 0x20268228, 0x242a846b, 0x00000003,
-    0x2c7b8202, 0x01d601f8, 0x00090081, 0x0100001d, 0x41f88222, 0x1e2a0516,
-    0x010e1701, 0x2e27010f, 0x10822701, 0x16322d08, 0x01013e17, 0x0a281960,
-    0x01015045, 0x42322129, 0x53620101, 0x62531f1f, 0x32420101, 0x1212321c,
-    0x1a550132, 0x5d3de015, 0x2b2a202b, 0x3b271282, 0x1c1c4972, 0x823b7249,
-    0x14182428, 0x82001814, 0x84012000, 0x0116296b, 0x000b0080, 0x07110100,
-    0x1e245a86, 0x15150101, 0x2a264886, 0xfe260149, 0x388613e6, 0x86340121,
-    0x2533839f, 0x00150009, 0x95821300, 0x012e3526, 0x17062223, 0x55293f8a,
-    0x0a455001, 0x29211928, 0x28478abf, 0x3d5d2b0b, 0x2a1a15e0, 0x204f8c05,
-    0x2a838203, 0x01db01ea, 0x00110096, 0x82350023, 0x1f323051, 0x06010f02,
-    0x2f262307, 0x36013f02, 0x84161733, 0x012b220f, 0x210f8422, 0x1f852537,
-    0x332b0f87, 0x2f0306db, 0x032f0202, 0x85076006, 0x60072108, 0x01271190,
-    0x30030625, 0x82300202, 0x30088724, 0x55059501, 0x05540606, 0x54050101,
-    0x05550606, 0x860786ea, 0x06752115, 0x02871582, 0x4f450020, 0x82802008,
-    0x821a20a7, 0x010024a7, 0x65070614, 0x2f08074a, 0x011e2317, 0x013d3632,
-    0x3e27012e, 0x07163201, 0x2634013e, 0x16140622, 0x1d238001, 0x2d2e3c01,
-    0x406a013c, 0x24372401, 0x0101231c, 0x54304831, 0x25058664, 0x2d1e4001,
-    0x1c829907, 0x2d3c0130, 0x241b6b6b, 0x08991b24, 0x2f241e2d, 0xeb7f4f30,
-    0x00033508, 0x01e5ff00, 0x009c01ab, 0x0015000c, 0x25000029, 0x3e351715,
-    0x0e236782, 0x181e1701, 0x2809bff2, 0x010e2713, 0x3d012e27, 0x2f888701,
-    0x01013727, 0x23232b15, 0x22473a13, 0x2c210608, 0x77267085, 0x2c490c53,
-    0x8b852d24, 0x011bea31, 0x2a1dee65, 0x463a0a47, 0x233b1223, 0x86772017,
-    0x81fe2875, 0x0a2d2b52, 0x85253809, 0xeb102493, 0x829bfe1b, 0x820020fe,
-    0x5000208b, 0x1924054b, 0x2b002200, 0x26085361, 0x07012f26, 0x8423010e,
-    0x16372dfb, 0x3e37011f, 0x27370701, 0x14010e26, 0x0736a182, 0x013e1617,
-    0x01012e34, 0x0141318d, 0x30314101, 0x103c3b22, 0x0c8b172a, 0x393ad028,
-    0x29293d16, 0x0786c93d, 0x82330121, 0x40312827, 0x34210102, 0x83111035,
-    0x8439820b, 0x33a6290b, 0x28011632, 0x7b01283e, 0x97830887, 0x00000130,
-    0xd601fbff, 0x26008001, 0x0e250000, 0x89822701, 0x16171624, 0x07823736,
-    0x1e272623, 0x24028201, 0x3736011f, 0x220b8336, 0x82150607, 0x264e0810,
-    0x276d0106, 0x442b3462, 0x361c1516, 0x5a362765, 0x830b0d23, 0x75515a0b,
-    0x02030803, 0x4a20180c, 0x22011149, 0x3a150702, 0x1602161b, 0x12253b12,
-    0x1801190c, 0x0f2d632a, 0x850b6511, 0x0401554f, 0x622e0808, 0x47902e2c,
-    0x46300503, 0x80822406, 0x0809274b, 0x23000323, 0x00002b00, 0x21112113,
-    0x32011e37, 0x26343536, 0x012e012f, 0x17013e35, 0x0e072637, 0x1f161401,
-    0x05cb4901, 0x012f2d08, 0x15331523, 0x40333533, 0x80fe8001, 0x342108e4,
-    0x09171921, 0x1f010b0b, 0x22111b09, 0x14171c18, 0x0d0e0c09, 0x2d061019,
-    0x2525206a, 0x20082383, 0x1a151043, 0x091a1618, 0x08090504, 0x1210020e,
-    0x1a01011e, 0x0408182b, 0x0a110a05, 0x207c0a0c, 0x07a7419b, 0x02eaff2b,
-    0x00800100, 0x0010000d, 0x088b8220, 0x0701375a, 0x33352127, 0x013d2622,
-    0x33173734, 0x21350527, 0x011e2127, 0x0614011d, 0x23153323, 0x011c1527,
-    0xfe2b1b7a, 0x1812559b, 0xbbbb2802, 0xfcfe5601, 0x122f012b, 0x55121818,
-    0x6501552f, 0x1b86fe1b, 0x12192b2a, 0xe20607d5, 0x2bd5baba, 0xd5121801,
-    0x562b1912, 0x07000000, 0x26069b4b, 0x001400ab, 0x6522001e, 0xe3820961,
-    0x06141724, 0x03821507, 0x012e2323, 0x0501413d, 0x6a4d1320, 0x18372008,
-    0x0808595e, 0x07352331, 0x05270717, 0x01071737, 0x01493600, 0x090c1d23,
-    0x1d0c0956, 0x61490123, 0x2a090c01, 0xd6010c09, 0x6afe4040, 0x00014040,
-    0x1e2d822a, 0x831f012d, 0x01402704, 0x3a243649, 0xdb4e2611, 0x11262805,
-    0x4936243a, 0x8515c1fe, 0xd515290e, 0x012a2a2a, 0x36404000, 0x0f202a82,
-    0x00220382, 0xa7880800, 0xb3820320, 0x0f000b2d, 0x28001300, 0x40003200,
-    0x92250000, 0x4627208a, 0xbd98066f, 0x013e352d, 0x22012e35, 0x16140706,
-    0x91ab0117, 0x958820a0, 0x2a1621ca, 0x3022d882, 0xe6823048, 0x1620a38f,
-    0x402ad19c, 0x1e2d082d, 0x24303024, 0xca822d1e, 0x8b430020, 0xc0012c05,
-    0x26008001, 0x38002f00, 0x82130000, 0x010e2cb1, 0x17161507, 0x3e272637,
-    0x82163201, 0x272626ba, 0x0e171607, 0x05627001, 0x1782ae82, 0x7a421720,
-    0x36343905, 0x14062217, 0x34363216, 0x30259526, 0x1c230101, 0x0b600a0c,
-    0x49300101, 0x18226282, 0x0a856113, 0x1c211783, 0x20158223, 0x827982fa,
-    0x12253419, 0x18241919, 0x01800118, 0x2c1f2430, 0x06033008, 0x84181460,
-    0x0101241a, 0x8313610b, 0x2517840a, 0x241f2c08, 0x4c84d430, 0x2a304922,
-    0x21082c78, 0x0b560001, 0x00802c05, 0x37000020, 0x33352315, 0x5d35012e,
-    0x0e820800, 0x0808fb47, 0x17161425, 0x4c95c035, 0x73021d1a, 0x02725656,
-    0x0b567202, 0x025a440b, 0x44445a02, 0x1416015b, 0x1b2b9595, 0x83572847,
-    0x56572418, 0x852a0272, 0x5b012617, 0x15381f44, 0x071b414c, 0x8001b62c,
-    0x1e001500, 0x00002200, 0xf9822325, 0x1f7dff83, 0x36322905, 0x17151737,
-    0x012e2737, 0x08054867, 0x15332727, 0x114b0123, 0x01111006, 0x4f3b3b4e,
-    0x3b4f0101, 0x06122e1a, 0x29ea206a, 0x36523636, 0x6b6b5f36, 0x2e120695,
-    0x2a1a851a, 0x11014e3b, 0x6a110610, 0x83016a20, 0x3652231c, 0x274f156a,
-    0x20738708, 0x2473822a, 0x35270717, 0x08164527, 0x21054f42, 0x18462317,
-    0x23372107, 0xf282ff82, 0x15333525, 0x824b0133, 0x20608f4c, 0x237b856f,
-    0x2b152b5e, 0x95200282, 0xa0902182, 0x55207f86, 0x2b202083, 0x250ae74c,
-    0x001700c0, 0x5f610100, 0x51152006, 0x01260ec7, 0x802ad6ab, 0xf3622bab,
-    0x40012508, 0x8055ab80, 0x2208954e, 0x42191200, 0xd832065b, 0x15008001,
-    0x25001900, 0x07130000, 0x010e2315, 0xb118010f, 0x272809ab, 0x07273523,
-    0x17231533, 0x2c0af37f, 0x13402ad5, 0x02150216, 0x56011715, 0x2b068217,
-    0x40121702, 0x5656562a, 0x40402a16, 0x012a0282, 0x012a2b80, 0x11d51119,
-    0x06860119, 0x2b2b2a22, 0x2b221782, 0xbc824040, 0x51000421, 0x9624053b,
-    0x11000d00, 0xac197784, 0xb8180e41, 0x17230709, 0x61233533, 0xd2280b51,
-    0x2b562a2a, 0x2b2bab2b, 0x200c4a61, 0x056661fe, 0xcb830020, 0x25086f5d,
-    0x004d0016, 0x454f2500, 0x16322205, 0xf7441837, 0x32212f09, 0x34270716,
-    0x36372736, 0x0f26012f, 0x05822601, 0x22012b22, 0x0721ef82, 0x250e8227,
-    0x06011f06, 0x05820717, 0x013f162e, 0x16011f16, 0x3f32013b, 0x17373601,
-    0x36250e82, 0x1c122001, 0x25028212, 0xfe1218b5, 0x614a55d5, 0x6f200805,
-    0x17010117, 0x02160203, 0x0a081b04, 0x2a040104, 0x09040105, 0x02041b09,
-    0x16030215, 0x03160101, 0x1a850882, 0x1a850520, 0x82051a21, 0x6beb2011,
-    0x733a054a, 0x191200ff, 0x12800155, 0x11ae1818, 0x12050b05, 0x04250403,
-    0x04060a02, 0x0282041c, 0x020a0622, 0x03240e82, 0x110b0a12, 0x01221783,
-    0x1482070b, 0x08615318, 0x87420020, 0x05b36308, 0x17001322, 0x1122ef82,
-    0xb9561121, 0x23152610, 0xfe950135, 0x899018d6, 0x0112260a, 0x012bd600,
-    0x2013822a, 0x0c245655, 0x002a2a25, 0x76000100, 0x8022051f, 0x0c822700,
-    0x29053553, 0x33152307, 0x3315011e, 0x22452315, 0x23353205, 0x36343335,
-    0x23353337, 0x013d012e, 0x01333634, 0x21c2826b, 0xad185612, 0x56200efc,
-    0x01281483, 0xd5121980, 0x2a011812, 0x0dc9ad18, 0x56462a20, 0x00002105,
-    0x2105e759, 0x6f8301d6, 0x71a92e20, 0x23371726, 0x23152335, 0x6b24789a,
-    0x4b2a4b60, 0xf5237d9d, 0x41555560, 0xff220647, 0x838501d5, 0x44004022,
-    0xa16b85aa, 0x209b9a1b, 0x13a86b6f, 0x321c2841, 0x0119192b, 0x140c0a0a,
-    0x110b050f, 0x050c0a11, 0x6b101808, 0x3f4105b2, 0x33072437, 0x41353315,
-    0x3f411bb8, 0x60352422, 0x82005656, 0x82052000, 0x01003103, 0x000001c0,
-    0x000d0007, 0x001d0011, 0x37000025, 0x03875f83, 0x15073524, 0x118b3523,
-    0x15212523, 0x08128223, 0x2b552322, 0x2b151615, 0x4015152a, 0x1515162a,
-    0x0195fe16, 0x6b55c080, 0x404056eb, 0x56156b56, 0x162a2a16, 0x0c820a82,
-    0x15801525, 0x70020015, 0x132a081f, 0x00001f00, 0x010f0625, 0x7b182206,
-    0xf5450e85, 0x013e2405, 0x82012e37, 0x527b1891, 0x87012007, 0x4ec02008,
-    0x05840508, 0x180d6021, 0x200f417b, 0x899f180b, 0x0000230a, 0x6f820100,
-    0xd201ee3e, 0x0f009201, 0x013f0000, 0x17013f27, 0x07011f37, 0x27010f17,
-    0x242f2707, 0x57235724, 0x07860282, 0x0b8a6920, 0x13825720, 0x280c575e,
-    0x0013000f, 0x32211300, 0x0d981816, 0x1517290b, 0x01803521, 0x01181200,
-    0x210a7e68, 0x0f5d0001, 0xaa80220d, 0x21f786aa, 0x777f01ab, 0x20479005,
-    0x2147a313, 0xab41d6fe, 0x05434105, 0x93a44b98, 0x4a822a20, 0x332047a0,
-    0x5520db91, 0xdb9fda91, 0x91151721, 0x93bd2047, 0x50032047, 0x0b270877,
-    0x1a001500, 0x42010000, 0x072c0a09, 0x16011f32, 0x3727010f, 0x07170736,
-    0x0e114418, 0x0405192d, 0x1607071b, 0x2503152b, 0x6b2c812c, 0x6a270c22,
-    0x08091b03, 0x84162b15, 0x82002019, 0x39638252, 0x01d601f5, 0x0004008b,
-    0x17070100, 0x00013721, 0x080151d5, 0x9c8b0151, 0xcb44fafa, 0x201f8705,
-    0x82218209, 0x3727216b, 0xa2242685, 0xa23ec83e, 0x06272b82, 0x75550153,
-    0x84abbebe, 0x4205202f, 0x9d1808cf, 0x13210ac7, 0x098c7521, 0x21152528,
-    0x11330535, 0x816f0323, 0x01802406, 0x6f0c0900, 0x0122064d, 0x0e82fe49,
-    0xab2b2b27, 0x2a562b2b, 0x08767b2a, 0x802a2a22, 0x2207766f, 0x8400d6fe,
-    0x39898293, 0x006b01eb, 0x0033001d, 0x15211300, 0x0e231523, 0x14011d01,
-    0x22230706, 0x0582010f, 0x3726062e, 0x3527013e, 0x17333733, 0x27012e35,
-    0x17231d82, 0x84272622, 0x3b163723, 0x95363201, 0x80165601, 0x12190c09,
-    0x34060d48, 0x07480d06, 0x0282391d, 0x400b152d, 0x090c01a0, 0x0e0c0215,
-    0x83011812, 0x09402696, 0x5555010c, 0x82148315, 0x680c2d11, 0x2804010b,
-    0x064a065c, 0x15ab166a, 0x01241a82, 0x12191119, 0x2b821c83, 0xd34a0020,
-    0x0003210a, 0x4605cd43, 0x714812bb, 0x0fc3460b, 0x562a8023, 0x46028256,
-    0x552012c7, 0x2a201783, 0xab20fb88, 0x0b22fb82, 0xfb821700, 0x48353321,
-    0x372108c1, 0x2a0c8215, 0x23352335, 0x55152315, 0x826b806b, 0x2a962702,
-    0x6b2a6b6b, 0x0b830001, 0x832b6b21, 0x616b200b, 0xa72008eb, 0x15224382,
-    0x43821d00, 0x22083783, 0x37170717, 0x37273717, 0x33270727, 0x26343632,
-    0x32330727, 0x07061416, 0x2b2b5523, 0x4c1e4c73, 0x824d1e4d, 0x04552702,
-    0x1b24241b, 0xee826b6b, 0x016b0926, 0x7456d66b, 0x1d851a82, 0x3724562b,
-    0x0c2b0124, 0x00010c12, 0x080b4907, 0x0c000324, 0x574d1000, 0x01002508,
-    0x05352115, 0x2007414a, 0x25a88207, 0x1d011e37, 0x15822301, 0x34352325,
-    0x82133736, 0x862320cb, 0x80012203, 0x5b2e82ff, 0x3736058a, 0x241ceaaa,
-    0x5500ff55, 0x2bd51c24, 0x2b802a80, 0x55559501, 0x845b01c0, 0x6b962f05,
-    0x2401eb6b, 0x5656801b, 0x01241b80, 0x384995fe, 0x0f290806, 0xecff0000,
-    0x9401e601, 0x12000800, 0x29001700, 0x33002e00, 0x42003d00, 0x6a006100,
-    0x78007300, 0x86008100, 0x00008f00, 0x34e68325, 0x36342622, 0x37361607,
-    0x27262726, 0x27371606, 0x3f170706, 0x3a0b8201, 0x06072226, 0x1617010f,
-    0x37321617, 0x07062736, 0x36072633, 0x13162337, 0x82070626, 0x36172713,
-    0x36170726, 0xc5822737, 0x011e0723, 0x27138214, 0x2726010e, 0x012e010e,
-    0x22058c55, 0x54013e26, 0xf38306c6, 0x70613e82, 0x36172305, 0x69820717,
-    0x3e213282, 0x22148201, 0x82372706, 0x2131824c, 0x4c82010e, 0x0001363e,
-    0x22161611, 0x0b521616, 0x0f111a28, 0x0408181b, 0x02040619, 0x11118513,
-    0x26110a0a, 0x08860483, 0x07062e25, 0x8306071a, 0x8d692004, 0x17262f2a,
-    0x34290a08, 0x080a2934, 0x1f1f3c2f, 0x0d8c2f3c, 0x080b1128, 0x22242422,
-    0x0786e308, 0x1307cb2e, 0x1a440402, 0x08041528, 0x7b0f1b18, 0xe8230d8c,
-    0x82172117, 0x06d33702, 0x15131813, 0x2c230503, 0x090a0b75, 0x20201b03,
-    0x01010e11, 0x0786110e, 0x0807a024, 0x0382d708, 0x8d130121, 0x0e8c3027,
-    0x270d2941, 0x290d2736, 0x1e181a41, 0x8d1a181e, 0x18d3280e, 0x181a0a18,
-    0x82180a1a, 0x2d088600, 0x0a09030b, 0x0c131861, 0x0305232c, 0x0d8ca315,
-    0x00020022, 0x012a0082, 0x00b20196, 0x00220016, 0x36691300, 0x275c0807,
-    0x37361637, 0x2e273436, 0x27152301, 0x012e0337, 0x16061737, 0x07171617,
-    0x3e21eb26, 0x1e323219, 0x1b0c274b, 0x26261536, 0x6a182f13, 0x0d2a796a,
-    0x0d111f1d, 0x0a14111d, 0x196b0120, 0x34883519, 0x2a05181e, 0x27151303,
-    0x12132866, 0xfe696a62, 0x33712c96, 0x1e4f2420, 0x0d2a0911, 0x2008b759,
-    0x0bb759c0, 0x17073722, 0x27300282, 0x11252711, 0x4040d527, 0x954040c0,
-    0xb57501b5, 0x2010b659, 0x052f4e00, 0x9601d53f, 0x00000f00, 0x22262725,
-    0x1406010f, 0x3216011f, 0x3436013f, 0x0cb1cb01, 0x0bb10c1c, 0x2106840b,
-    0x0987da09, 0x00201084, 0x85064346, 0x9113203b, 0x010f233d, 0x418e3727,
-    0xb1b12323, 0x20458db1, 0x2011820e, 0x4cc38500, 0x23080643, 0x0022000c,
-    0x003c0033, 0x16320100, 0x012e0717, 0x27070622, 0x1707013e, 0x011e0706,
-    0x37013e17, 0x16372726, 0x21061254, 0xf24d3734, 0x06272305, 0x29822722,
-    0x013e3522, 0x3208714f, 0x4d2b0001, 0x3e191e1f, 0x1e193e44, 0x1f874d1f,
-    0x7d020117, 0x173805dc, 0x7802231f, 0x02785b5b, 0x014936d5, 0x191e1313,
-    0x131e1946, 0x36490113, 0x3205c743, 0x1e209501, 0x1a1a181e, 0x201e1e18,
-    0x2f281e60, 0x82026049, 0x282f2438, 0x8240351e, 0x21398233, 0x2b824040,
-    0x122e1a2b, 0x1e19191e, 0x361a2e12, 0x48631849, 0x00022c09, 0x01d5ff00,
-    0x00a00196, 0x83250008, 0x543620bf, 0x3e1905a0, 0x32080b7d, 0x012f012e,
-    0x06222726, 0x33150723, 0x27073735, 0x12200107, 0x18241818, 0x2d153b18,
-    0x150d2d2b, 0x2f1f233d, 0x170d150e, 0x6f050705, 0x6922262b, 0x4f4b0108,
-    0xfe3c05db, 0x802b5dd8, 0x18402ba0, 0x1c012a1d, 0x01142217, 0x49642f02,
-    0x2b16ae0f, 0x000a0000, 0x01200082, 0x3005174f, 0x0024001f, 0x00310029,
-    0x00400039, 0x004f004a, 0x17254f54, 0x07272208, 0x3307010e, 0x2627012e,
-    0x16272617, 0x36332317, 0x14070637, 0x37273317, 0x36170623, 0x16232734,
-    0x219d8214, 0x0a823317, 0x33320729, 0x2337013e, 0x8217011e, 0x3607211b,
-    0x26212d82, 0x154f4f27, 0x040c2808, 0x043d050a, 0x5605040b, 0x09082514,
-    0x08082991, 0x2e052225, 0x052e0303, 0x2d0505d0, 0x035b0202, 0x03034503,
-    0x82060522, 0x053d2923, 0x2868040a, 0xa5250809, 0x08202b82, 0x08147c4f,
-    0x0801cb20, 0x1b11111b, 0x22350108, 0x1e1e110d, 0x10580d11, 0x0f202010,
-    0x0f211031, 0x40102010, 0x05822020, 0x83098a21, 0x35092122, 0x22201d82,
-    0x00372583, 0x00020000, 0x01e2ff00, 0x009a01da, 0x001b0016, 0x06070100,
-    0x82011f14, 0x063108cc, 0x011e1716, 0x3727013f, 0x3f321617, 0x012f0701,
-    0x42011737, 0x1e0d0d3c, 0x471f3c61, 0x63010822, 0x613c1e51, 0x0d220d1e,
-    0x3d1e5b3d, 0x99015a1f, 0x370b823c, 0x1e3d621e, 0x08016351, 0x3c1e4721,
-    0x0d0d1d60, 0x3d1d1d3c, 0x03005a1e, 0xdb206384, 0x0d246382, 0x22001100,
-    0x17206588, 0x27215c86, 0x25728437, 0x26060717, 0x74822e27, 0x27371723,
-    0x316c8537, 0x1d101f0f, 0x3c0d230d, 0x5b1e5b5b, 0x15a71e1d, 0x5e831c3c,
-    0x1f472226, 0x1ea6153c, 0x1f207385, 0x1e222382, 0x67820d0d, 0xf35a1e29,
-    0x3c15a61e, 0x8421471e, 0x163d239e, 0xdf841ea5, 0xd62b6f82, 0x14006001,
-    0x00002900, 0x4e352337, 0x352c0515, 0x17011e33, 0x07010e15, 0x37331523,
-    0x22050872, 0x7d233533, 0x333506ea, 0xeb35013e, 0x401c24c0, 0x241b8080,
-    0x1b240101, 0x60ea8040, 0x220d8920, 0x8320241c, 0x40402118, 0x21821a83,
-    0x40804024, 0x0c83c040, 0x2e85c020, 0x8308d747, 0x00182277, 0x2377822d,
-    0x23012e35, 0x2005407e, 0x226d8427, 0x82153315, 0x92118307, 0x01eb257c,
-    0x1b14141b, 0x80207883, 0x84835982, 0x7e8deb20, 0x15306023, 0x2023821b,
-    0x206e8230, 0x82008340, 0x45828d87, 0xf785065f, 0x00001e24, 0x66923525,
-    0x11330525, 0x83231523, 0xd5012119, 0xfe215f8d, 0x215583d6, 0x548d6080,
-    0x40012528, 0x00c08080, 0xdf820100, 0x60010026, 0x0b006001, 0x3321d982,
-    0x82468235, 0x11232344, 0x8c84e033, 0x80e04028, 0x8080c0fe, 0x26834001,
-    0x2b840220, 0x0b258783, 0x00001700, 0x82f78401, 0x33352373, 0x398a0735,
-    0x84950121, 0x84ea203a, 0x01402205, 0x20078515, 0x2c488935, 0xff000002,
-    0x01c701ea, 0x00350096, 0x22cf823b, 0x48352707, 0x0f2105df, 0x2d098201,
-    0x07270727, 0x2f071517, 0x07170701, 0x09823717, 0x07230e82, 0x82013f17,
-    0x200e8209, 0x23218237, 0x2737011f, 0x10820182, 0x01272008, 0x2b2b32bc,
-    0x0a260b32, 0x352a0d2a, 0x1c1c1e25, 0x2a36251e, 0x250a290d, 0x2b2b310b,
-    0x8c250b31, 0x280e2517, 0x35fb250a, 0x96240082, 0x183e180d, 0x262e2582,
-    0x1f18320b, 0x1b1e2430, 0x30241e1b, 0x4783181f, 0x1a952920, 0x260a3129,
-    0x1f1f720a, 0x421f1f3e, 0x6b3a080f, 0x10008001, 0x00001900, 0x07010e25,
-    0x2e352315, 0x37363401, 0x1e153335, 0x43182701, 0x6b26088d, 0x2a262f01,
-    0x04842f26, 0x241b6a2f, 0x24243624, 0x093927c0, 0x39095757, 0x2006854e,
-    0x063c6119, 0x83095f41, 0x000e2257, 0x58578517, 0x559005f7, 0x2d2d3d24,
-    0x5b85013d, 0x10835687, 0x862d3d21, 0x2055895c, 0x20588303, 0x24538301,
-    0x0014000b, 0x0dab7a18, 0x08364418, 0x61822720, 0x4e000121, 0x2d200aab,
-    0x3023ac85, 0x4e2b012a, 0x2a200aa3, 0x5622ac86, 0x56832b2b, 0x04830420,
-    0x1c205b8a, 0x03205d9a, 0x2a206198, 0xfe216398, 0x896785ab, 0x6a0e20c3,
-    0x0e2206c7, 0x19410701, 0x83072013, 0x866b2064, 0x0b7441b0, 0x4f2a3021,
-    0x1f410688, 0x84ff200e, 0x00022160, 0xc7820082, 0x83002b21, 0x0100245f,
-    0x4117011e, 0x272007d2, 0x0c198418, 0x20087441, 0x41638201, 0x01210521,
-    0x860a822b, 0x2d272255, 0x0721413d, 0xb3870020, 0x41002b21, 0xb0841b77,
-    0x85297741, 0x060021ae, 0x0024ae82, 0x8001eb01, 0x152b5b82, 0x2e002500,
-    0x40003700, 0x18250000, 0x300aec9c, 0x3436012f, 0x011e3727, 0x33010614,
-    0x11171632, 0x5fa7820e, 0x2948050b, 0x42072008, 0x2d6607a5, 0xac012108,
-    0x2d050148, 0x5921211d, 0x1e18181e, 0xfe141411, 0x2f50abd4, 0x21068205,
-    0xa2576818, 0x25122705, 0x30493030, 0xf65b2430, 0x1e292f05, 0x3d483d18,
-    0x4e1d1e18, 0x1e204e58, 0x36824818, 0x2e362e24, 0xe9530901, 0x19122d09,
-    0x1924182b, 0x80182419, 0x30483001, 0x29200282, 0x4d08815c, 0xd6200797,
-    0x172fcb82, 0x33002000, 0x33130000, 0x36150717, 0x83351732, 0x011e2c07,
-    0x22010e15, 0x36342726, 0x58261737, 0x07390653, 0x0737013e, 0x26343523,
-    0x0622012b, 0x2723011d, 0x2a6b011e, 0x76304040, 0x08058230, 0x02221e38,
-    0x0279b479, 0x35951e22, 0x366a3636, 0x683d3536, 0x196b1e24, 0x19122a12,
-    0x68241e6b, 0x2a2b8001, 0x7207071d, 0x07252a2b, 0x1e170b14, 0x140b171e,
-    0x09011107, 0x0282091a, 0x13017125, 0x822baa11, 0x2b1224d5, 0x561311aa,
-    0x96300af3, 0x00004700, 0x22273337, 0x32363426, 0x35171516, 0x14230784,
-    0x59371507, 0x2322050b, 0x17823307, 0x22061424, 0x02592327, 0x012f2306,
-    0x0f821615, 0x37342624, 0x07840735, 0x013f3624, 0x3f840623, 0x38506d3c,
-    0x21161611, 0x170b3817, 0x380b1720, 0x16211601, 0x50381116, 0x17171f0c,
-    0x1b850c1f, 0x86011621, 0x8a17201c, 0x38dc211b, 0x29860d8b, 0xc78245a2,
-    0x2609ab50, 0x00220019, 0x1800002e, 0x270b6743, 0x011e3336, 0x17071417,
-    0x1805f94a, 0x21086f43, 0x43582313, 0xc920080a, 0x96110dc0, 0x090c1812,
-    0x4936231d, 0x0d081101, 0x0c960c23, 0x120da0fe, 0x12121b12, 0x402a4052,
-    0xc9300282, 0x12180cc0, 0x080d1196, 0x36490111, 0x0c091e22, 0x23212282,
-    0x2320836f, 0x00ff121b, 0x40202183, 0x33578a82, 0x208baa0a, 0x05186c27,
-    0x07173724, 0x8b9c0117, 0x2d2d2a2b, 0x1f2e2e1f, 0x2d1e2d2d, 0x21909b2d,
-    0x2587c9fe, 0x6f672882, 0x006b3408, 0x001f001b, 0x00310028, 0x010e1300,
-    0x011e011d, 0x18070614, 0x280abdf9, 0x35373634, 0x07272634, 0x5a8e8217,
-    0x088708ea, 0x18125524, 0x02821812, 0x56011222, 0x602b0987, 0x2720b620,
-    0x20151510, 0x85981515, 0x6b012a06, 0x55121801, 0x18241801, 0xd9f81801,
-    0x82402010, 0x01b5212d, 0x20222c83, 0x07868715, 0x01000023, 0x21008200,
-    0x0682da01, 0x00132108, 0x36263700, 0x17011e37, 0x3327013e, 0x2e070616,
-    0x010e2701, 0x28042b17, 0x2c383c5c, 0x35031b3d, 0x3e220982, 0x09821e44,
-    0x70088026, 0x05410508, 0x08880282, 0x29067b41, 0xd6010000, 0x0d006b01,
-    0xeb821100, 0x21130023, 0x65e6821e, 0x2008086a, 0x27231533, 0x33171533,
-    0x15333537, 0x2a016b21, 0x8095241c, 0x2a9c2495, 0x2b95c02a, 0xfe952b2a,
-    0x2fbe8256, 0x16561b24, 0x241b5616, 0x15152a95, 0xab152b2b, 0x7d09b746,
-    0x1a2f0513, 0x15250000, 0x22061421, 0x35232726, 0x84373634, 0x47052061,
-    0xd52f0810, 0x372400ff, 0x182a0124, 0x12160112, 0x4c00ff18, 0x8026057c,
-    0x24241b2b, 0x6944eb1b, 0x15c02105, 0x45063d50, 0xab200643, 0x22087b74,
-    0x89113300, 0x56552201, 0x2001822a, 0x9e461801, 0x202f860a, 0x9b9118c0,
-    0xbbc61908, 0x846b201a, 0x054b563d, 0x01eaff2f, 0x009601ab, 0x00150005,
-    0x0027001e, 0x20c18233, 0x21c08216, 0x3f550327, 0x20c5870f, 0x20088737,
-    0x0af35317, 0x193c0126, 0x441a4433, 0x200e5f55, 0x20e08527, 0x26068537,
-    0x01493622, 0x84364901, 0x1bd22705, 0x01193344, 0x5218183c, 0x56230794,
-    0x862a1812, 0x860120f8, 0x01552b07, 0x48363748, 0x36480202, 0xf7564837,
-    0x06d36606, 0x19001328, 0x21001d00, 0x95562500, 0x15072716, 0x27353717,
-    0x02820717, 0x07373525, 0x56173527, 0x9520149b, 0x69280082, 0x56d46969,
-    0x56568056, 0x31119d56, 0x54a65447, 0x3c28a654, 0x317d3d3d, 0x317e324c,
-    0xfb48324d, 0x01dc2408, 0x6f0d009c, 0x152005bd, 0x39059b66, 0x15273335,
-    0x15331523, 0x78ab4023, 0xab5d7979, 0xabab784e, 0x5d8001ab, 0x08827979,
-    0x2a4e7823, 0x0c474bab, 0x00154908, 0x3700001b, 0x21331614, 0x013d3632,
-    0x23272634, 0x27220615, 0x06222335, 0x36161715, 0x2b233537, 0x1001252c,
-    0x11172a1f, 0x0dbe0e3f, 0x9c221830, 0x72076407, 0x2528246c, 0x1f13c71f,
-    0x5b5ea401, 0x5e171ba9, 0x9f340346, 0x23435682, 0x01a83806, 0x0006006b,
-    0x15331300, 0x33270733, 0xa76780c0, 0x6b0167a7, 0x71a7a7ab, 0x16200c17,
-    0x11bb4f18, 0xdb591320, 0x5a6b2005, 0xa7240ab1, 0x4056406b, 0x0da74f18,
-    0x6bd5fe25, 0x42005555, 0x80200863, 0x16286b82, 0x00001a00, 0x35332725,
-    0x25217282, 0x0dc17121, 0x21111725, 0x83000111, 0x00ff2146, 0x1223588a,
-    0x82552a01, 0x0a2c7147, 0x2b191226, 0x2a01d6fe, 0xab22c789, 0x5b826801,
-    0x15010029, 0x37271523, 0x82ab0115, 0x000121c1, 0x8f71cd84, 0x24cb820f,
-    0x06141101, 0x06e56623, 0x82823320, 0x35170526, 0x35233533, 0x210b8d71,
-    0xba841912, 0x7e550121, 0xdf840afa, 0x3f23cb91, 0x82331501, 0x8e132076,
-    0x21072454, 0x94952111, 0x83c020b5, 0x0c547fe0, 0xd6fe1222, 0x84088f41,
-    0x823720c7, 0x07172390, 0xc6825535, 0xc5868020, 0xec840220, 0x8001c025,
-    0x82000f00, 0x113721c3, 0x200d5073, 0x05494225, 0x230a0c71, 0x2b011912,
-    0x2b207f82, 0x5c0fa141, 0x06200c93, 0x1a244b82, 0x07250000, 0x3322ff82,
-    0x548e0335, 0xc3823720, 0x856b0121, 0x824689c4, 0xd6fe2151, 0xa541c484,
-    0x098f410f, 0x8f41a820, 0x70252005, 0x40200693, 0x1520c484, 0x21125742,
-    0x70730129, 0x0703210d, 0x2005f35a, 0x0f784195, 0x86096a73, 0x23c793d8,
-    0x15231701, 0x05207282, 0x240adc41, 0x06141115, 0x08574227, 0x210f7641,
-    0xdd942b01, 0x240cff47, 0x0015000b, 0x10a54b1f, 0x16140730, 0x012e3717,
-    0x37013e03, 0x07272634, 0x4518011e, 0x5b290c1d, 0x13026049, 0x3516f011,
-    0x5808871e, 0x282b0cb4, 0x1e496002, 0x11f01635, 0x88aafe13, 0x7200200a,
-    0x022d0a7f, 0x18001000, 0x00002100, 0x012f3301, 0x0b905a33, 0xe5621320,
-    0x18152005, 0x2508146a, 0x76761501, 0x7e70ab95, 0x03bd260a, 0x033a303b,
-    0x05694a55, 0x75000124, 0xe06e8020, 0x18122507, 0x151680fe, 0x16210082,
-    0x080362ab, 0x52000321, 0x80310587, 0x2e001700, 0x00004800, 0x32013e13,
-    0x1f011d16, 0x2f048201, 0x23070614, 0x37012f22, 0x17013b36, 0x17011e13,
-    0x352a0f82, 0x012e3736, 0x16150622, 0x4d4c1517, 0x22168205, 0x6107010e,
-    0x142009cf, 0x35381984, 0x01d5013e, 0x1a0c120c, 0x0e121269, 0x68090d8a,
-    0x05090610, 0x30241644, 0x58084482, 0x24010115, 0x14012437, 0x01011713,
-    0x48362530, 0x13140102, 0x01151215, 0x3c2e2d3c, 0x261d2301, 0x0148012f,
-    0x0c0c0900, 0x2f035f09, 0x0d5d1409, 0x590a0112, 0x01240611, 0x2430012a,
-    0x1a0b2718, 0x241b1d13, 0x131d1b24, 0x18270b1a, 0x012c3024, 0x301b3649,
-    0x2b0f0911, 0x058b4d19, 0x0d342129, 0x2a410e17, 0x53004936, 0x80200763,
-    0x1e20db82, 0x2726d999, 0x35233717, 0xaf921523, 0x4040c024, 0x8b932b2a,
-    0x4040d524, 0x5f888080, 0x5f9dab20, 0x5f440320, 0x205f9205, 0x93458295,
-    0x8301205e, 0xa72b2077, 0x4313205f, 0x5f9205fb, 0x5f992b20, 0x2a2b2b22,
-    0x26271f41, 0x33072703, 0x92353315, 0x4040235f, 0x1f412b40, 0x15012214,
-    0x457a8240, 0xff29067b, 0x019601d5, 0x00170056, 0x1983412e, 0x92165d42,
-    0x12434273, 0x42144241, 0x0020152d, 0x2a07ef42, 0x001d00ab, 0x005a003a,
-    0x42152500, 0x35300be5, 0x1632013e, 0x36343515, 0x15171632, 0x27011e17,
-    0x2a05de42, 0x34373635, 0x010e2726, 0x42010e07, 0x342205f9, 0x28653736,
-    0x423c8205, 0x222106fb, 0x421d8306, 0x1f8406fe, 0x42950121, 0x9f480afb,
-    0x01360806, 0x800a0858, 0x01013025, 0x01141317, 0x21161c24, 0x01191406,
-    0x1b171314, 0x1a290b16, 0x1e014837, 0x201a171a, 0x1e2e3c01, 0x1e1a0e31,
-    0x2f261d23, 0x39111c21, 0x0443887d, 0x09d52507, 0x2b090c0c, 0x33080483,
-    0x0f04276b, 0x243001fa, 0x1a0b2619, 0x241b1e12, 0x14190101, 0x1d162106,
-    0x270b1a13, 0x160b2932, 0x48022b1c, 0x11372236, 0x20320d0b, 0x1e013c2d,
-    0x1f310e19, 0x26061a43, 0x1c113923, 0x41000021, 0x1d220aff, 0x09414100,
-    0x36352b20, 0x34353637, 0x010f2226, 0x0383010e, 0x16171426, 0x012e1517,
-    0x3320e984, 0x97052641, 0x075530f0, 0x35240905, 0x06050312, 0x19140202,
-    0x8604040d, 0x050741ef, 0x5b33dd97, 0x0e08071a, 0x11241b13, 0x060a0403,
-    0x2d210605, 0x87040510, 0x2df885dc, 0x01000000, 0xebff0000, 0x9501d601,
-    0xc1822700, 0x3712262c, 0x07010e23, 0x2e273623, 0x08820701, 0x9d823320,
-    0x02163008, 0x013e3307, 0x17063337, 0x3e37011e, 0x16233501, 0x26690106,
-    0x013e073f, 0x02350e1b, 0x21570601, 0x1c01261d, 0x3e252d23, 0x21023e08,
-    0x8304330d, 0x1e280812, 0x24011d25, 0x2a01163d, 0x45620316, 0x0c691b1c,
-    0x244e191f, 0x16064d05, 0x0316d6fe, 0x2a294f70, 0x1b1f0868, 0x4b071b54,
-    0x83848282, 0xa401ff33, 0x23008101, 0x013f0000, 0x16323336, 0x010f1415,
-    0x27058217, 0x2f222306, 0x07141501, 0x26270782, 0x3634013d, 0x82161732,
-    0xda360816, 0x1a201446, 0x4d3f0a25, 0x1c1a250c, 0x120a5f0f, 0x21211e22,
-    0x030a133a, 0x1d66fd02, 0x0e131925, 0x130f625d, 0x7613251b, 0x1c101c41,
-    0x1ef31f28, 0x0c0c1428, 0x6b871307, 0x01ea2b08, 0x00960176, 0x1300000b,
-    0x33371733, 0x012f2611, 0x8b070607, 0x55013f55, 0x013e2f28, 0x9501262e,
-    0x56febcbc, 0xb8b70207, 0x33830602, 0x01250484, 0x007f01d6, 0x08034b0f,
-    0x3d822920, 0x82152521, 0x05655ea9, 0x1523152c, 0x07353725, 0x15072715,
-    0x54823517, 0xe76f3520, 0x23353906, 0x3533011d, 0x9501012a, 0x090c0c09,
-    0xfffe8015, 0x2a2b2bc1, 0x556b3520, 0x01390085, 0x0c29245a, 0x0c095509,
-    0x262baa01, 0x5b05b535, 0x06950555, 0x16357b76, 0x2301822a, 0x001616c0,
-    0x2a098360, 0x00240014, 0x06140100, 0x59352622, 0x2e2c079e, 0x07222701,
-    0x1e35011e, 0x07141701, 0x29059f52, 0x013e3526, 0x24190001, 0x40701518,
-    0x2d3d3d07, 0x0e0c0c0e, 0x0c026049, 0x1e1e641d, 0x020c1d64, 0x122b0160,
-    0x1c121919, 0x013c2e24, 0x3205cc6d, 0x5d150503, 0x22486101, 0x03744a1d,
-    0x1d4a7403, 0x50614822, 0x1a200c8b, 0x2f0bbf47, 0x17161533, 0x35373633,
-    0x06232726, 0x3e231507, 0x2808ba47, 0x95067758, 0x0a6a0a01, 0x22048401,
-    0x47770695, 0x722208b4, 0x15862a56, 0x2a0a0124, 0x1f487256, 0x00172b0c,
-    0x001f001b, 0x35331300, 0xc8821533, 0x08b25d18, 0x1528dc82, 0x05233523,
-    0x01353315, 0x20080382, 0x5b802a2b, 0x2a2a0378, 0x022b2b2b, 0x2a804960,
-    0xfe2b5501, 0x6b012bd5, 0x78032a2a, 0x2a2a805b, 0x2be18280, 0x2bd52b2b,
-    0x2b00012b, 0x0500002b, 0xaf526382, 0x00032f05, 0x002e0025, 0x00360032,
-    0x23112500, 0x9a521311, 0x35273309, 0x07010e23, 0x33372606, 0x17013e37,
-    0x013e3533, 0x8482013b, 0x496a0720, 0x83172007, 0x2a03828b, 0x8e80c001,
-    0x0101100c, 0x829c0c10, 0x1e702c06, 0x0f231e29, 0x0309053d, 0x8263183e,
-    0x56232a13, 0x0c0c09c0, 0x770c0c12, 0x8200822a, 0x00ff3c7e, 0x0c102a01,
-    0x100ce3fe, 0x033f0c10, 0x70011330, 0x17031187, 0x100c1310, 0x5e402b2b,
-    0x152205a4, 0xa382156b, 0xa38e0320, 0x97a69faf, 0x2b4d92a5, 0x01eb2908,
-    0x00210080, 0x0100002a, 0x21292941, 0x1f41ce01, 0x55012122, 0x201e1541,
-    0x05174200, 0x83837982, 0x2105b741, 0xd97a2500, 0x54172005, 0xb341064e,
-    0x2613411f, 0xc0c06b23, 0x418da0ea, 0x8bd4119f, 0x6b6bc023, 0x208ba095,
-    0x082b4204, 0x2a002126, 0x47004300, 0x202c9f41, 0x1cc46733, 0x2023bc41,
-    0x13ce6790, 0x201fd041, 0x16d06719, 0x2608e741, 0x00ab01c0, 0x821e0015,
-    0x1fa57dd1, 0x17441720, 0x33352208, 0x17a37d01, 0x40401e23, 0x7d02822a,
-    0xc02a179f, 0x2b40402b, 0x03000040, 0x7f510000, 0x00022406, 0x4c1c0010,
-    0x23221425, 0xcb702315, 0x4c352005, 0x7d201020, 0x194c4684, 0x83eb200f,
-    0x2b40215b, 0x220db36a, 0x820c0008, 0x01002d61, 0x27071737, 0x33351737,
-    0x21152103, 0x23335682, 0x1e361501, 0x361e6969, 0x8001d52a, 0xd5d580fe,
-    0x83350001, 0x8035230f, 0x801800ff, 0xea250aeb, 0x9601c001, 0x20438300,
-    0x87a38215, 0x82072043, 0x15172343, 0x51833523, 0x15010728, 0x5e5e1e2b,
-    0x48862b1e, 0x0d842a20, 0x2b40012d, 0x1f5e5e1f, 0x2ac0552b, 0x8455556b,
-    0x0a774f0b, 0x102a4f83, 0x17250000, 0x17072737, 0x93981537, 0x92868020,
-    0x83800121, 0x054f4592, 0x5601c022, 0x07254982, 0x0f000b00, 0x23938200,
-    0x23153313, 0x35244182, 0x2315013b, 0x9283d683, 0x40173723, 0x21318280,
-    0x0082d556, 0x1e4b8033, 0x011e622d, 0x2b568055, 0x2b802b2b, 0x2c1e4b40,
-    0x08535d61, 0x2b019623, 0x05c77900, 0x46820720, 0x33373522, 0xd52f0685,
-    0x2a80402a, 0x80402beb, 0x562b012b, 0x83568080, 0x08335303, 0x9601d622,
-    0x13217982, 0x07334600, 0x2b0f0051, 0x03353315, 0x05233533, 0x13152335,
-    0x61189182, 0x1124080d, 0x96121819, 0x01210082, 0x18058456, 0x27099665,
-    0x2a181256, 0xaafe9696, 0x56211684, 0x05d34996, 0xd601ea24, 0xe3828001,
-    0x00001a35, 0x07013713, 0x2e270727, 0x3f342701, 0x17163201, 0x4d33013e,
-    0x013c05c7, 0x011c1536, 0x444c1b7a, 0x0162531f, 0x321c680d, 0x1c321212,
-    0x2f014232, 0x16f4fe2a, 0x35056172, 0x491c3e4c, 0x191e3b72, 0x1414183e,
-    0x32420118, 0x012a4d29, 0x57470a0b, 0x00002505, 0x8001c001, 0x002ec782,
-    0x010e1101, 0x36342622, 0x35173237, 0x0b851507, 0x0b823320, 0x2a281f82,
-    0x1f2b2b3f, 0x01d50e12, 0x012f0886, 0x1ff5fe80, 0x2a3f2b2b, 0x2d7d0701,
-    0x822a20be, 0xb2072116, 0x2105b745, 0x4f84eaff, 0x1b000f22, 0x498ab386,
-    0x06112524, 0x5f852707, 0x1b2b2722, 0xd0209b82, 0x2b315088, 0x15691701,
-    0xbc0e1221, 0x1b500136, 0xcf1b9bfe, 0x2755856f, 0xf5fe9b57, 0x17691521,
-    0x28216882, 0x063b4235, 0x8001eb28, 0x15000f00, 0x61822100, 0x0b286718,
-    0x23012e29, 0x33153305, 0x43372115, 0x23220832, 0x57554035, 0x80012105,
-    0xfe2a0785, 0xfeabd580, 0x40409580, 0xe252402b, 0x552b230e, 0x7318c0d5,
-    0x00270a7b, 0x01d60100, 0x5305006b, 0x372505e7, 0x37232711, 0x09d16633,
-    0x6b554028, 0x40eb556b, 0x0282402a, 0x6b000126, 0x556baafe, 0x40200a83,
-    0x8508bb46, 0x8209203b, 0x853320a1, 0x2315213b, 0xaa213385, 0x672f86aa,
-    0x678e0933, 0x18272521, 0x2008a041, 0x22338427, 0x18372201, 0x850969ac,
-    0x8a40203d, 0x22738811, 0x822201ab, 0x820b20af, 0x07172573, 0x05273727,
-    0x07294782, 0x62627317, 0x0144441e, 0x20068538, 0x20068422, 0x880584a6,
-    0x87c02037, 0x22798337, 0x83012f07, 0x0117243d, 0x821e4484, 0x84c42026,
-    0x84c02005, 0x84442005, 0x09574405, 0x4001eb35, 0x1c001000, 0x00002800,
-    0x012e2125, 0x37013e27, 0x4c361732, 0x25250541, 0x36321614, 0x23118235,
-    0x05010e27, 0x1e820982, 0x010e2608, 0x01071407, 0x25d6fe95, 0x60020130,
-    0x1e1e2249, 0x02604922, 0x86fe3001, 0x01182419, 0x360e1a1e, 0x12540149,
-    0x05225619, 0x01400c24, 0x1e822430, 0x820c0c21, 0x3024312a, 0x18181254,
-    0x17412712, 0x61480101, 0x48371218, 0x37220782, 0xdb541317, 0x0003220a,
-    0x2ef78207, 0x13211121, 0x40112111, 0x80fe8001, 0x832a012b, 0x55012106,
-    0x20066054, 0x25b88301, 0x8001c001, 0x29820300, 0x20842585, 0x00008024,
-    0x3f730001, 0x00962205, 0x0dcb6a0b, 0x510c0b52, 0x51180cf9, 0x0b210ad7,
-    0x83761900, 0x070b6d53, 0x5d831320, 0x230f0f6d, 0x15233537, 0x176d0383,
-    0x2a8f230f, 0x1b6d2a2a, 0x2b0f280f, 0x8080562b, 0x82000700, 0xbd012700,
-    0x08007d01, 0xdb741d00, 0x00452206, 0x0a67684e, 0x16362735, 0x16013e17,
-    0x011e0706, 0x0e272606, 0x37362601, 0x8305012e, 0x06262413, 0x83071607,
-    0x36162512, 0x06272637, 0x1a821283, 0x07d04818, 0x07232a82, 0x83361716,
-    0x203a821f, 0x06d65801, 0x59189d2b, 0x2e593535, 0x10232310, 0x2609882e,
-    0x11130801, 0x82180d16, 0x878420bd, 0x0b503008, 0x2711160d, 0x4e352315,
-    0x2d171716, 0x842d1212, 0x87cc2005, 0x4ad52015, 0x912105a7, 0x84488d16,
-    0x14422152, 0x18203682, 0xab203e82, 0xe7210887, 0x205a820d, 0x21628227,
-    0x498717c0, 0x71204f82, 0x00201587, 0x200ca76a, 0x05bb7f07, 0x15333525,
-    0x75211733, 0xab3605cd, 0x56402a40, 0x01d6aafe, 0x01182418, 0x6b6b0001,
-    0x181215ab, 0x36821218, 0x83060021, 0xd6012304, 0x26198001, 0x00260c2f,
-    0x33110129, 0x24193311, 0x2720099d, 0x2505475a, 0x35231723, 0x0b822333,
-    0x01260783, 0x2a56fed5, 0x0183552b, 0x55555523, 0x22038280, 0x84d55555,
-    0x80012605, 0x2a2aabfe, 0x27758240, 0x8040d52a, 0x40552b6b, 0x2a08ef62,
-    0x00080080, 0x2500000e, 0x83211137, 0x013f2961, 0x07270715, 0x61740135,
-    0x37294b82, 0x966aeb5e, 0xfeb37c55, 0x344083d1, 0xa10ab4a1, 0x00c0806b,
-    0x00010000, 0x01e0ff00, 0x00a001eb, 0x18398213, 0x2112ef4a, 0x4a18eb01,
-    0x4a1812e7, 0x002013e2, 0x4b888783, 0x4d822720, 0x0f17072a, 0x2f072701,
-    0x37273701, 0x82069b6f, 0x514b180f, 0x2a619411, 0x3b052705, 0x1e37371e,
-    0x8827053b, 0x37758609, 0x3b4f1243, 0x44114e3c, 0x11441f1f, 0x3c2d3b4f,
-    0x1818340c, 0x2d3c0c34, 0x0d220986, 0x0082003b, 0x82000821, 0x01270800,
-    0x008001c0, 0x0017000e, 0x00290020, 0x00420039, 0x0055004b, 0x22230100,
-    0x33150706, 0x013e3315, 0x2634013d, 0x76262207, 0x1720057a, 0x3e240882,
-    0x06141601, 0x2206b85e, 0x65050614, 0x2b230628, 0x82262201, 0x09a7772a,
-    0x6008b162, 0x232c081d, 0x0bb7a601, 0x5180010e, 0xa80f0f0b, 0x172a0382,
-    0x0b770e0e, 0x0f170e0f, 0x06850b0f, 0x83c3fe21, 0x0e01231f, 0x1d82b70b,
-    0x0e0b6627, 0x0f0f160e, 0x820a824c, 0x84772006, 0x0b0e270d, 0x0b0f8001,
-    0x22858051, 0x820f4e21, 0x0f162618, 0x0e170f83, 0x20038201, 0x200e8582,
-    0x201c8547, 0x2344820f, 0x160f5b0e, 0x42214483, 0x21498301, 0x21820e16,
-    0x00200e83, 0x05260082, 0xeaff0000, 0x6f48d501, 0x1a270806, 0x34002700,
-    0x16250000, 0x06010f14, 0x26012f22, 0x36013f34, 0x27011f32, 0x23271707,
-    0x37350735, 0x16323733, 0x820e1517, 0x352724e3, 0x6617013e, 0x675a0507,
-    0xcb012305, 0xda690909, 0xb1972f0a, 0x2023b1b1, 0x4c034326, 0x01011f17,
-    0x04832e1f, 0x0c0a1729, 0x140c0101, 0x6ada0d0d, 0x0b220a02, 0x2a82cb0b,
-    0x0c7c6026, 0x1f04181a, 0x09eeac18, 0x0a0c0125, 0x840c0a3b, 0x21a68204,
-    0x04840100, 0x6b01f024, 0x9f821500, 0x2e213a08, 0x34113501, 0x17333736,
-    0x15163233, 0x21371521, 0x01010e07, 0x12c0fe95, 0x80121818, 0x1912952b,
-    0x012e95fe, 0x1704306c, 0x12180115, 0x18120001, 0x12192b01, 0x0eb6abd5,
-    0x08db6a11, 0x8001d628, 0x1a000600, 0xf3822300, 0x33010028, 0x26072315,
-    0xf4480727, 0x060a6a05, 0x37013e23, 0x0afe6933, 0x17010f30, 0x33a20137,
-    0x120c5a22, 0x0130243b, 0x89561d23, 0x3c013e05, 0x2d08022e, 0x12120e1e,
-    0x7a12121c, 0x010f3c0f, 0x125a2b80, 0x3001040c, 0x082d1e24, 0x087b5002,
-    0x35231d22, 0x20057376, 0x86238250, 0x01002bcf, 0x00070096, 0x0e350100,
-    0x6a820701, 0x5b00012f, 0x022a0278, 0x2a6b0160, 0x495b7802, 0x083f5060,
-    0x2782e320, 0x32001c24, 0x9f503b00, 0x26222208, 0x05ae5e27, 0xfb463720,
-    0x07332205, 0x24408227, 0x1d011e17, 0x53801801, 0x3e31080b, 0x17163201,
-    0x1d062227, 0x2e353301, 0x5b0d0101, 0x79020279, 0x1d5d385b, 0x2f4b1722,
-    0x02026048, 0x5d434860, 0x504f3b0a, 0x94760a39, 0x090b0b08, 0x38048276,
-    0x32210108, 0x0c3c0122, 0x10013b11, 0x79029501, 0x02795a5a, 0x251b2c35,
-    0x06ef6a2c, 0x4153022c, 0x6b534f4f, 0x080b01ad, 0x33820962, 0x0b08622f,
-    0x22191501, 0x101d1922, 0x0d15150d, 0x0d7b6b10, 0x10000836, 0x29001d00,
-    0x34370000, 0x0e171637, 0x36372602, 0x010e1637, 0x262bc082, 0x1714010f,
-    0x36173236, 0x55262735, 0xcc820640, 0xa5013e2d, 0x01151809, 0x7f0f160f,
-    0x83091815, 0x5a262b07, 0x4c12024f, 0x02124c9a, 0x306b5a4f, 0x3c058405,
-    0x05080bab, 0x010e0c0e, 0x050e0c0f, 0x0f0f1708, 0x152c0161, 0x0c0c2428,
-    0x2c152824, 0x058f6b94, 0x00210584, 0x0afb7302, 0x00001f22, 0x210eed46,
-    0x4f18012f, 0x372508af, 0x2707012f, 0x0ff54607, 0x1a1a1f26, 0x40401a3f,
-    0x07850482, 0x200f0147, 0x201b8aba, 0x592b823f, 0xd622069f, 0x09829601,
-    0x18001024, 0x73832400, 0x23071724, 0x60183e17, 0x372709be, 0x36372707,
-    0x8b16011f, 0x829525f7, 0x6b2c822c, 0x84051d6c, 0x15ad2805, 0x0808162c,
-    0x8a6b071b, 0x828120f5, 0x6c402024, 0x05840577, 0x2c16e227, 0x1b070715,
-    0x22f18c08, 0x82090000, 0x01ca21f3, 0x09268383, 0x17000e00, 0x85821b00,
-    0x2c002826, 0x34003000, 0x2a06394b, 0x23013523, 0x15333735, 0x62052723,
-    0x3226058e, 0x15330316, 0x5d190527, 0x0b39174a, 0x1ba5011b, 0xe5fe2520,
-    0x19402a25, 0x2a83012a, 0x18124040, 0xfe2a2a2a, 0x21098480, 0x008256aa,
-    0x0e84d620, 0x70012a25, 0x825bfe1b, 0x1b01232b, 0x21824525, 0x2a404028,
-    0x43d8fe18, 0x0883272a, 0x2a920127, 0x012aaafe, 0x202d8200, 0x081f4f00,
-    0x5601d628, 0x20001300, 0x9b822d00, 0x3708e449, 0x06272207, 0x27012e23,
-    0x1e17013e, 0x2e371701, 0x37363401, 0x17010e27, 0x07331282, 0x0614011e,
-    0x013e1707, 0x1e1e22c0, 0x01544022, 0x88405401, 0x01352c09, 0x15161417,
-    0x16151717, 0x8a951714, 0x5501230b, 0x27820e0e, 0x07862d82, 0x341e942d,
-    0x2f110913, 0x09112f38, 0x8b1e3413, 0x1800200c, 0x83089787, 0x00222297,
-    0x60978231, 0x3223058f, 0x41331637, 0x222a05c6, 0x32072607, 0x14010e17,
-    0xa6861716, 0xdd563720, 0x66222005, 0x3621052b, 0x84978ec0, 0x0a0b2da1,
-    0x14161614, 0x3d2d0b0a, 0xad3d0101, 0x2d200584, 0x01211386, 0x2a9d8c55,
-    0x2a0e0e01, 0x3c351602, 0x68031535, 0x01200a26, 0x3b411286, 0x41252014,
-    0x2a4b0831, 0x41272009, 0x07220838, 0x0b82011e, 0x3b412720, 0x41012008,
-    0x09890932, 0x8315c021, 0x8415209f, 0x41b82098, 0x2b200a3c, 0x220e3b41,
-    0x82150329, 0x0216219a, 0x6a209a84, 0x201b3b41, 0x153b412c, 0x2c411720,
-    0x2295850d, 0x4134012e, 0x5e201436, 0x240c2841, 0x17171435, 0x41038214,
-    0x8e841230, 0x25072341, 0x322d0f16, 0x04830f2d, 0x420dcf41, 0x1b411967,
-    0x2e372208, 0x420b8201, 0x67420974, 0x172a4113, 0x41106742, 0x02211b2b,
-    0x20008200, 0x05ff4201, 0xfd421e20, 0x16142816, 0x34013e17, 0x420e2726,
-    0x402414ee, 0x231d1d23, 0x77900383, 0x3a249426, 0x483a1111, 0x87650483,
-    0x07cf4208, 0x95413b20, 0x1dd14215, 0x201da441, 0x1adb4222, 0x421ab241,
-    0xbf4119e3, 0x002a2219, 0x21eb4200, 0x21063341, 0xe8421614, 0x426d2020,
-    0xe4420650, 0x4215201c, 0x00210a4d, 0xd3561800, 0x6c0f200b, 0x3529084f,
-    0x3e031737, 0x27353701, 0xc2561801, 0xc0580807, 0x01563ec0, 0x8e5bd595,
-    0x5b8e1717, 0xfe565680, 0x487712ab, 0x01004269, 0xeaff0000, 0x9601b601,
-    0x00001400, 0x27372337, 0x17373533, 0x07173315, 0x16321523, 0x36342315,
-    0x35a0eb33, 0x1515a035, 0x6b35356b, 0x19801912, 0x3635c012, 0x55151555,
-    0x18ab3536, 0x00181212, 0x20081b48, 0x274382c0, 0x0022001e, 0x13000026,
-    0x32204283, 0x8706905f, 0x07d97d47, 0x07013b32, 0x05352115, 0xeb353315,
-    0x09961515, 0x96090c0c, 0x0a855784, 0x00016b31, 0x019500ff, 0x2b151580,
-    0x09d5090c, 0x8340010c, 0x01402165, 0x40270c84, 0x2b552a2a, 0x8204002b,
-    0x01d521b3, 0x2005e34e, 0x82b78210, 0x11012784, 0x07051117, 0x55822317,
-    0x3525bd82, 0x15033717, 0x08638417, 0x40800129, 0xa51b9bfe, 0x402a403a,
-    0x40ab1b50, 0x0140ebfe, 0x40e7fe80, 0x1b2b5901, 0x2b9095a5, 0x1c502565,
-    0x402f0f01, 0x4c40c06f, 0x40240993, 0x16000b00, 0x0d435218, 0x17332732,
-    0x23152137, 0x23272307, 0x1e3c3cfb, 0x3d1e3d3c, 0x3c2c0282, 0x393140ee,
-    0x3ddf0001, 0x59243634, 0x1e291387, 0x739a3c3c, 0x80ea2bde, 0xab5d1800,
-    0x000d2a09, 0x002c001f, 0x003f0039, 0x078c1800, 0x37240808, 0x23263435,
-    0x011e2105, 0x0e231517, 0x23150701, 0x1127012e, 0x2217013e, 0x17010e07,
-    0x34371716, 0x07012e27, 0x173a0c8b, 0x3e011e07, 0x2b1f7501, 0x80e01f2b,
-    0xf0fe1f2b, 0x15100a01, 0x2a202001, 0x0782c501, 0xc915012e, 0x0f0f0505,
-    0x45030104, 0x93130401, 0x042c0b85, 0x14030144, 0x3c16c3aa, 0x95012b40,
-    0xea2f3282, 0xe0802b1f, 0x012a2b1f, 0x01c51015, 0x8220202a, 0x3d448307,
-    0x1a04023a, 0x12040510, 0x0f0c0506, 0x1a050124, 0x1305050f, 0x0f0d0505,
-    0x1318363b, 0x78182f11, 0x2c080807, 0x00090080, 0x17330100, 0x21171507,
-    0x01371737, 0x6a6a2b40, 0x8056fe6a, 0x80014b4a, 0xe7442a2b, 0x00a165ab,
-    0xff000003, 0x01e301f1, 0x06f5778c, 0x17130026, 0x17071737, 0x3007c84b,
-    0x27372707, 0x35370535, 0x27010f23, 0x17072707, 0x07907507, 0x2737173b,
-    0x1e2dfe84, 0x06064434, 0x07110610, 0x2d1e3444, 0x650b01fe, 0x3c2e653c,
-    0x21168d2f, 0x27848c01, 0x82110721, 0x44062728, 0xfe2e1e35, 0x2782a13c,
-    0x833da721, 0x82452027, 0x060f213b, 0x00231684, 0x82000400, 0x00023200,
-    0x20006b01, 0x2d002900, 0x00003600, 0x27332737, 0x30038523, 0x2137013e,
-    0x15173315, 0x22061423, 0x0e232726, 0x79058301, 0x3723091e, 0x79331523,
-    0x2a08082b, 0x0d701040, 0x0da61068, 0x0150139c, 0x00011218, 0x242b4040,
-    0x55012437, 0x24362401, 0x40012b01, 0x1b12120e, 0x352d1212, 0x4be1fe5f,
-    0xa021057f, 0x29008320, 0x56011812, 0x241b6b55, 0x03831b24, 0x016b4b22,
-    0x1b242583, 0x8b35bf12, 0xa3860986, 0x01ca0130, 0x00190061, 0x00310025,
-    0x0100003d, 0x75181407, 0x353308fa, 0x3e262737, 0x011f1601, 0x1e013e37,
-    0x0e221701, 0x5e160701, 0x172305d7, 0x8207022e, 0x82162011, 0x26372118,
-    0x3c081682, 0x1633011e, 0x01263637, 0x2f255d21, 0x090d0d09, 0x53081418,
-    0x10110703, 0x043e4203, 0x6707110f, 0x024d0b06, 0x0b065809, 0x0c03080a,
-    0x4d020859, 0x070b0906, 0x0e052004, 0x6007075f, 0x080a8207, 0x4101046c,
-    0x032e05ee, 0x020c120c, 0xca150316, 0x06061009, 0x09a0a009, 0x12100606,
-    0x02093a08, 0x0d040327, 0x05df0b07, 0x09022606, 0x0608033a, 0x047a0e04,
-    0x06070c02, 0x060b020a, 0x0000000e, 0xff000005, 0x01f901db, 0x000d00a5,
-    0x001e0016, 0x002b0026, 0x17071300, 0x33150706, 0x15230135, 0x01371733,
-    0x17152117, 0x23012e11, 0xb8821505, 0x012e3323, 0x08078807, 0x26343351,
-    0x08191d22, 0x44012b01, 0x1d298859, 0x012f92fe, 0x18012b06, 0x5255fe12,
-    0x032b026c, 0x3c2e6484, 0x54022b01, 0x01244040, 0x0b1620a5, 0xfe3b400f,
-    0x20252bdb, 0xed2b8501, 0x13140127, 0x022b9518, 0x8464526c, 0x3d012a53,
-    0x5454402d, 0x58241b40, 0x03200d17, 0x26279382, 0x33370000, 0x4c372335,
-    0x322105e2, 0x859f1816, 0x56272009, 0xeb260ed6, 0x24152a2a, 0x9f180130,
-    0xb9200e7d, 0x28095266, 0xd52b4019, 0x12243001, 0x6e9f1818, 0x19412109,
-    0x0c76d318, 0x25065745, 0x00960180, 0x60180009, 0x80240aef, 0x00015555,
-    0x95200382, 0x80200882, 0xa7890383, 0x6b01d628, 0x27001300, 0xa7823b00,
-    0x37013e22, 0x0f7b3e19, 0x13a63520, 0x18232b21, 0xac07d0ad, 0x11402608,
-    0x25030119, 0x20028203, 0x23068540, 0xc0111901, 0xf36d13a6, 0x00053a0d,
-    0x002c0020, 0x23152500, 0x13321635, 0x22232634, 0x16060706, 0x013b1617,
-    0x22088216, 0x82331507, 0x343523c9, 0x405f3627, 0x08d68406, 0xd5400145,
-    0x18c77132, 0x06130a12, 0x0b0f050a, 0x251b050e, 0x160b0b3b, 0x11113832,
-    0x49600255, 0x01016148, 0x60494861, 0x1d474732, 0x18125601, 0x210f0909,
-    0x8f49080b, 0x26070833, 0x3f6c251b, 0x6a0d2d30, 0x87026049, 0x288f8329,
-    0xff000007, 0x01e001ea, 0x083f59ab, 0x1b00132b, 0x00002400, 0x17372713,
-    0x249b8237, 0x37270717, 0x31078205, 0x23153321, 0x16322105, 0x013e2117,
-    0x17011e13, 0x9f822115, 0x1e2d8026, 0xc22a772d, 0xfe3b0582, 0x800140d1,
-    0xe0fe4040, 0x18120001, 0x01aafe01, 0x49369218, 0x0100ff01, 0x822d0149,
-    0x4060231e, 0x06825140, 0x2b2b9826, 0x1218a02b, 0x40252182, 0xaa374801,
-    0x05cb6baa, 0x88830320, 0x01d6012c, 0x0008004c, 0x002a0011, 0x5d6c3700,
-    0x27210810, 0x36371716, 0x0f141632, 0x15011e01, 0x37363421, 0x36342627,
-    0x36011f32, 0x0f0f0cab, 0x9f0f0f17, 0x3a06840b, 0x2e293061, 0x070d1107,
-    0xfe2e2826, 0x26282e56, 0x07110d07, 0x01cb292e, 0x820f160f, 0x86012002,
-    0x01612307, 0x19832e13, 0x591e2627, 0x1e593535, 0x21318326, 0xe352132e,
-    0x5319200d, 0x07251531, 0x37173727, 0x14d55217, 0x1e55e225, 0x531e8d37,
-    0x3025133d, 0x8c371e56, 0x09c3591e, 0xe7829620, 0x5f820d20, 0x11354c83,
-    0x07371133, 0x35211523, 0xa9a9a901, 0x762a761e, 0xaa01d58b, 0x280a82be,
-    0xfe2e0175, 0x2ac876d2, 0x2037902a, 0x2a838237, 0x21152107, 0x23352717,
-    0x8bfe3311, 0x8717202b, 0x56fe2143, 0x21087f59, 0x6f8601d6, 0x82170121,
-    0x35212a70, 0x15172721, 0x01231133, 0x2a2b8202, 0x01d2fe75, 0x2ac7752e,
-    0x8969012a, 0x0acb567d, 0x0d000825, 0x833f0000, 0x23112938, 0x33370711,
-    0x57152135, 0xc2206289, 0x6f82418b, 0x23093757, 0x0100000c, 0x332f2b82,
-    0x17072711, 0x11072737, 0x56fed501, 0x821e76c0, 0x0176262f, 0xfe2a2a6b,
-    0x200b86d1, 0x06ff432f, 0x3382a383, 0x97820520, 0x82211521, 0x22348230,
-    0x8bab0121, 0x01152228, 0x824086aa, 0x5700205a, 0x3382079f, 0x11231322,
-    0x66849682, 0x55211722, 0x2f20c982, 0xfe235b85, 0x889501d1, 0x25338e74,
-    0x35211537, 0x685c1123, 0x2b112105, 0x15205988, 0xaf493d8b, 0x01ab2808,
-    0x00140096, 0x82280020, 0x15232544, 0x23350727, 0x230d655a, 0x33352303,
-    0x2e065866, 0x23152733, 0x32013e35, 0x80800116, 0x18153635, 0x320c2f77,
-    0x2416ab12, 0x15012437, 0x0c012b40, 0x95010c12, 0x5b202095, 0xfe280cee,
-    0x1b155680, 0x151b2424, 0x09210082, 0x41d8820c, 0x7f8507f7, 0x7da02620,
-    0x26342322, 0x15219882, 0x207b9933, 0x2078832b, 0x247a946b, 0x24241c2a,
-    0x2376821c, 0x00002a09, 0x2206a362, 0x184001cb, 0x8308218b, 0x1707217d,
-    0x23250183, 0x2622010e, 0x25e58335, 0x15230533, 0x03862733, 0x22082b55,
-    0x8420cb01, 0x01c02100, 0x562eed82, 0x01121801, 0x6b4b4b2b, 0x56755555,
-    0xfd472056, 0x40012105, 0x20202084, 0x9524ec83, 0x35201813, 0x4b230083,
-    0x82121c12, 0x58002002, 0xeb200697, 0x172f7b82, 0x1f001b00, 0x27002300,
-    0x39003000, 0x84130000, 0x3307267e, 0x3632011e, 0x20058637, 0x05e35b35,
-    0x08196d18, 0x15333724, 0x41180527, 0x21200727, 0x15200887, 0x2b266f85,
-    0x24362401, 0x05848001, 0x98822b20, 0x3695fe24, 0x98825636, 0x36230282,
-    0x48ebfe36, 0x0120058f, 0x07137c18, 0xa88ca48a, 0x2a753522, 0x87061654,
-    0x7d0020b1, 0xeb26067b, 0x1c006b01, 0xb7512000, 0x0038240a, 0x824a0041,
-    0x010e23b9, 0xb78f1507, 0x35012b23, 0x21be8233, 0x6d180527, 0xbe820ad8,
-    0x58072321, 0x0b840630, 0x4023ca90, 0x8f011812, 0x562b21c7, 0x7523cc83,
-    0x87765656, 0x557523cc, 0x0e84eb55, 0xd48e2b20, 0x29826b20, 0x6649eb20,
-    0x13402407, 0x824b3518, 0x3620214f, 0x88410085, 0x121b2107, 0x82057d49,
-    0x00002105, 0x26085f77, 0x001a0040, 0x5a22001e, 0x00230629, 0x91062213,
-    0x232724d3, 0xb3263435, 0x121822c1, 0x23b2974b, 0x95131840, 0xad82b188,
-    0x31422a20, 0x1137420e, 0x0b671520, 0x002e2308, 0xa9950037, 0x76412320,
-    0x1235420e, 0x20136a41, 0x0b6541fe, 0x8a113242, 0x08d842aa, 0x60132f42,
-    0xd62d05b3, 0x0f005601, 0x21001800, 0x34003000, 0x06b95800, 0x17011e22,
-    0x1807ba58, 0x8708354f, 0x35072308, 0x07192223, 0x3d28089e, 0x35232501,
-    0x6bab0133, 0x82056444, 0x18200806, 0x24241b48, 0x1c242437, 0x1b12120d,
-    0xab831212, 0x12181812, 0x18125601, 0x808000ff, 0x12185501, 0xa0212a89,
-    0x22288301, 0x4b1f2437, 0x5624065e, 0xd61218d5, 0x2b232e83, 0x43006b40,
-    0xd62207ff, 0x9f826b01, 0x1c001330, 0x36002900, 0x21130000, 0x1115011e,
-    0x67180614, 0x17230716, 0x18112111, 0x20084c87, 0x2cb78237, 0x22012e23,
-    0x3e230706, 0x012e1701, 0x06ee4227, 0x60010e21, 0x8d8508ea, 0x9142ab20,
-    0x230e2d05, 0x07220833, 0x07202a20, 0x23330822, 0x01210c8b, 0x9049186b,
-    0x1812270c, 0x0100ff2a, 0xe6416000, 0x01402a05, 0x18132129, 0x29211318,
-    0x820988bf, 0x05cb5caf, 0x1a28af87, 0x28002100, 0x38002f00, 0x0528b395,
-    0x010e1533, 0x15252307, 0x2729af82, 0x35231735, 0x3337013e, 0x05367f05,
-    0x70433720, 0x2db58e07, 0x0e76cafe, 0x014f0514, 0x14054f16, 0x0b84760e,
-    0x83eafe21, 0x8515200b, 0x21b495ce, 0x2d822420, 0x824b4b21, 0xc0242139,
-    0x80200a89, 0x20093744, 0x21bb8204, 0xb7870100, 0x2d002022, 0x0720b195,
-    0x41285c41, 0x20202e55, 0x55154e41, 0xff41084b, 0x1dfb4107, 0x410e2b41,
-    0x124106e1, 0x06c74115, 0x2b48f782, 0x01ab3105, 0x002c0096, 0x0e351700,
-    0x36340701, 0x27260637, 0x28053e42, 0x26171636, 0x011e3736, 0x05b35a07,
-    0x5f080e82, 0x1e27010e, 0x012e1501, 0x07f51527, 0x16132023, 0x022b3f15,
-    0x3a1a2e41, 0x29630419, 0x25062c1b, 0x63280e01, 0x1a3a1904, 0x2b02412e,
-    0x1316153f, 0x15072320, 0x0c1c0d63, 0x05142702, 0x18021307, 0x3f450e04,
-    0x533c3001, 0x76570595, 0x01303b1f, 0x040e453f, 0x07130218, 0x02271405,
-    0x630d1c0c, 0x2c0dc760, 0x0026001d, 0x0100002f, 0x35231707, 0x05765023,
-    0x210fc045, 0x69462327, 0x55012611, 0x20553515, 0x13a445c0, 0x27112d44,
-    0x20204510, 0x40121801, 0x470bdd44, 0x22420606, 0x83052006, 0x47012094,
-    0x2827090b, 0x00003100, 0x82172113, 0x8317208a, 0x0a8e4f94, 0x17013e29,
-    0x33353315, 0x18273315, 0x2411ffcf, 0x40150140, 0x2593912b, 0x6e20ab07,
-    0xc042c529, 0x85f22005, 0x40012206, 0x44918b55, 0xb24207c4, 0x08b84206,
-    0x6b459789, 0x052b4105, 0x10462320, 0x33252713, 0x33372315, 0x29442317,
-    0x08954708, 0xd5550123, 0x10ca466b, 0x55f6fe28, 0x294ba080, 0xb8468074,
-    0x8040210e, 0x480c2641, 0x94870a31, 0x2b410420, 0x00162c08, 0x0023001a,
-    0x0100002c, 0x47231523, 0x27221077, 0x8e962723, 0x90cb7521, 0x9395208e,
-    0x09a8508a, 0x18124025, 0x41353501, 0x182817b3, 0x20001c00, 0x32002900,
-    0xb2418982, 0x013f2615, 0x33072317, 0x14b44137, 0x41550121, 0x122513b3,
-    0x28506040, 0x1fb74178, 0x55229783, 0x00823520, 0x410db941, 0x0b210723,
-    0x279b8300, 0x002e0025, 0x07230100, 0x4905315f, 0x27240e56, 0x17333725,
-    0x2312b441, 0x15406b00, 0x2f26f582, 0x202a2007, 0x05848807, 0x1a012f29,
-    0x30b0fe10, 0x41cb5655, 0x0b240eb4, 0x40121836, 0x2806a955, 0x12111514,
-    0x2b2b1508, 0x05af4120, 0x240f0345, 0x002b01c0, 0x7c958614, 0x1423056f,
-    0x83331716, 0x33352693, 0x34352335, 0x08274926, 0x011e0722, 0x3505447e,
-    0x1919126b, 0x24012a12, 0x2bab2437, 0x00ff1218, 0x56aa6a6a, 0xf16c4056,
-    0x2b012505, 0x80121801, 0x1b24a782, 0x2b1b2424, 0x2b240883, 0x55404040,
-    0x6106aa71, 0x58350853, 0x23001f00, 0x26010000, 0x010e010f, 0x011e011f,
-    0x1716013f, 0x82798315, 0x3e250873, 0x3e372702, 0x26012f01, 0x37170705,
-    0x0c0c8301, 0x09090fb9, 0x10210920, 0x18100926, 0x0e6e6e13, 0x36080111,
-    0x2a128210, 0x5aecfe0c, 0x57013a4a, 0x826b0701, 0x8237201d, 0x0f162c12,
-    0x17122607, 0x07262a01, 0x830c1e1a, 0x14372532, 0x46810fae, 0x2208574d,
-    0x820b0095, 0x01003679, 0x17011e15, 0x36170714, 0x03012e35, 0x3e27012e,
-    0x0e353701, 0x08e08201, 0x36321748, 0x010e2737, 0x47381501, 0x12380a01,
-    0x40686b02, 0x47010154, 0x026b5338, 0x355b7802, 0x14381e59, 0x4094013c,
-    0x1d3a5109, 0x2f282119, 0xa1fe7555, 0x3a405401, 0x0a400951, 0x785b5575,
-    0x21282f02, 0x00001d1b, 0x274d0400, 0x256f8506, 0x003d0030, 0x72840100,
-    0x72832720, 0x82032721, 0x0e172366, 0x7a852301, 0x7a841520, 0xe5591320,
-    0x3e352205, 0x2f948201, 0x36270727, 0x37363407, 0x14150617, 0x2e151716,
-    0x82829182, 0x0a381222, 0x15278b82, 0x38143c24, 0x8235591e, 0x6b02226e,
-    0x82a88253, 0x49363881, 0x2f3b0101, 0x24011813, 0x15210c1b, 0x20161968,
-    0x2f13180f, 0x8294013b, 0x21938296, 0xa2821d19, 0x1dd7fe23, 0x25b3821b,
-    0x555a7902, 0xc2830a75, 0x143dda82, 0x31364901, 0x07420845, 0x241b1520,
-    0x08390101, 0x13321e80, 0x15181239, 0x08420720, 0x82b48245, 0x01002ccb,
-    0x004b01d6, 0x3f000007, 0x82371701, 0x4b073098, 0x1eb55580, 0x35a05597,
-    0x1fcc5580, 0x82a055ab, 0x82062023, 0x01ec3cef, 0x009601ab, 0x001d000e,
-    0x0038002a, 0x00530045, 0x1e370100, 0x06011d01, 0x83352726, 0x273724cb,
-    0x82171632, 0x820720e5, 0x37362144, 0x87054260, 0x3706221b, 0x28128327,
-    0x15173235, 0x010e1716, 0x96268207, 0x0135081a, 0x0d0a197b, 0x0b0b950b,
-    0x2a211f0a, 0x10042319, 0x261f0718, 0x210e2421, 0x04560e06, 0x960a2953,
-    0x1d090b0a, 0x0e240a07, 0x1a0f0520, 0x10050f11, 0x54036a1a, 0x08308229,
-    0x1c090c31, 0x0d230906, 0x190f0521, 0x10060e12, 0x1000011a, 0xfb0c1405,
-    0x168c5d04, 0x0f05140b, 0x18208015, 0x130f1605, 0x1f121515, 0x80010d0c,
-    0x861a657c, 0x0a0e221a, 0x20128429, 0x2333822a, 0x511c050d, 0xf7411998,
-    0x01ec2205, 0x0a074180, 0x24390341, 0x0a1a5001, 0x22b7840c, 0x832b221f,
-    0x061924e8, 0x8422251f, 0x035523c0, 0x19822a53, 0x820a0b21, 0x20f984d1,
-    0x21e88219, 0xd1b71b0f, 0x02000028, 0xecff0000, 0xb7865601, 0x0121b39e,
-    0x35988225, 0x0b0a960a, 0x2b212009, 0x10032419, 0x25200719, 0x200e2421,
-    0x819d0f05, 0xdf480020, 0x00022c05, 0x12006b01, 0x50003100, 0x43370000,
-    0x3e220502, 0x7c183701, 0x273e082d, 0x3d262223, 0x2b012e01, 0x15331501,
-    0x0e331614, 0x23011d01, 0x36323315, 0x36343537, 0x6273013b, 0x011e2306,
-    0x9f44013b, 0x36323705, 0x3533013d, 0x07062223, 0x23061415, 0x01493680,
-    0x15314001, 0xa5182f4a, 0xa8820844, 0x18010c35, 0x19202012, 0x20191212,
-    0x01181220, 0xfe0b090c, 0x90090bea, 0x02153915, 0x46333648, 0x012f2706,
-    0x04384701, 0x3d2d2b3c, 0x090cab01, 0x2a181216, 0x42820382, 0x192b152f,
-    0x0c091512, 0x090c2b2b, 0x2b191215, 0x234a8215, 0x2a161218, 0x09210382,
-    0x22db8c0c, 0x951e0018, 0x180720db, 0x9209ee81, 0x62d321a9, 0x09fb8118,
-    0xf8208b92, 0x1e261e84, 0x1e44441e, 0x73690062, 0x822b2008, 0x0c280879,
-    0x35250000, 0x27251533, 0x14161733, 0x0123010f, 0xf5feab15, 0x096a5a80,
-    0x2b5b6909, 0x80804040, 0x091a0a6a, 0x06000069, 0x20069744, 0x28338296,
-    0x00170013, 0x0020001c, 0x23a98239, 0x27171623, 0x30058341, 0x010e3736,
-    0x27012e07, 0x23351716, 0x23353707, 0x82048206, 0x33152303, 0x038b2315,
-    0x011e2908, 0x35013e17, 0x2feb012e, 0x0656151a, 0x3b2b2b3a, 0x513a3005,
-    0x2c55592b, 0x3b863a54, 0x082a4005, 0x0e123705, 0x2b151535, 0x2b3b7e82,
-    0x02171326, 0x30021311, 0x391410c0, 0x01016b54, 0x0117546d, 0x0b0bc134,
-    0x830134c1, 0x132b2920, 0x0b254018, 0x152b2b1a, 0x17290185, 0x521b142f,
-    0x006b4e32, 0x2b7b1800, 0x00112309, 0x838b1300, 0x23352334, 0xeb953335,
-    0x2bababc0, 0x2a2a2b2b, 0x802b8001, 0x6b83402a, 0x85273386, 0x18008001,
-    0x83330000, 0x27352126, 0x27222b82, 0x506e1733, 0x84072005, 0x6beb3dc7,
-    0x4459126b, 0x55553049, 0x59444930, 0x6b6b6b12, 0x2b24072a, 0x95afaf95,
-    0x2a07242b, 0xcf417a82, 0x8b012305, 0x9f555601, 0x13002506, 0x17211521,
-    0x07208382, 0x80300782, 0x00ff0001, 0x20d6d615, 0xeafe1601, 0x562a5501,
-    0x00200182, 0x7bc1af87, 0x3507574d, 0x001f0080, 0x00260023, 0x002d002a,
-    0x00340031, 0x17331300, 0x03843733, 0x89830720, 0x23230383, 0x82072327,
-    0x33352103, 0x1729e583, 0x07330723, 0x23372337, 0x84ee8217, 0x07272806,
-    0x1d2a2b33, 0x82381d55, 0x1c2a2a03, 0x2f09261c, 0x1c391c39, 0x31038256,
-    0x26092f39, 0x0930d11c, 0x1d0f8542, 0x2f0a4330, 0x06840eb0, 0x1c0e7b24,
-    0x00848001, 0x2b2a2b22, 0x06820783, 0x6b2a2b24, 0x03845540, 0x82409521,
-    0x02002be6, 0xe9ff0000, 0x9701d801, 0x9d821a00, 0x3425003c, 0x27372726,
-    0x07222607, 0x06170727, 0x17071714, 0x37321637, 0x3e273717, 0xd37c0701,
-    0xd5013a0a, 0x2c2a1416, 0x3b883b2a, 0x292b2e2a, 0x2b2d2a2a, 0x2b3a893a,
-    0x14142a2c, 0x050062d5, 0xc0230584, 0x851c4122, 0x292a851f, 0x29292a2d,
-    0x1c2a2d2a, 0xf4617341, 0x20058405, 0x09ff4200, 0x10008028, 0x00001400,
-    0xa1422137, 0x26222805, 0x07233527, 0x82233727, 0x40212110, 0x1238c984,
-    0x63380118, 0x2b6c5725, 0xd6fe2a01, 0x2b802ad5, 0xab801219, 0x2bd59615,
-    0x220a0f43, 0x1813000f, 0x5008f97f, 0x1e2f05b9, 0x3e211701, 0x2e353701,
-    0x21052301, 0x50072115, 0x34210b01, 0x20138426, 0x05f94b37, 0x54803521,
-    0xff260d6f, 0xff000100, 0x5e182b00, 0x12200880, 0x15271085, 0x01552b55,
-    0x18121895, 0x2509cb48, 0x1840ab2a, 0x27834013, 0x18134026, 0x2030402b,
-    0xdf6a0082, 0x006b3008, 0x001f000f, 0x0033002f, 0x003b0037, 0x82331300,
-    0x0e112590, 0x2e230701, 0x5006d167, 0x0f920615, 0x3e112728, 0x35330101,
-    0x03823723, 0x03821320, 0x09554027, 0x0c01010c, 0x26068209, 0x09569e0c,
-    0x83090c0c, 0x839f2004, 0x8213830e, 0xf3fe2b1a, 0x2a962b2b, 0x2b2b952a,
-    0x28826b01, 0x85d6fe21, 0x2a012130, 0x0f9b0785, 0x6bd6fe28, 0x00ff6b2a,
-    0xff42006b, 0x01cd3908, 0x0022004b, 0x012f2500, 0x22272635, 0x0623010f,
-    0x1606010f, 0x013f1617, 0x08062f41, 0x013f3643, 0x3e331617, 0xc7013401,
-    0x0a014601, 0x8a4e0404, 0x05390d17, 0x0c0c0802, 0x406a4016, 0x2b1e0c01,
-    0x0d0a0505, 0x154602e3, 0x4704010a, 0x07391301, 0x08080611, 0x55557e14,
-    0x1e0c126e, 0x0d010315, 0x08634912, 0x0b009628, 0x1d001400, 0xf1672600,
-    0x012e2208, 0x0a8c6827, 0xbc772320, 0x1e6a1807, 0x66002009, 0x5b200a25,
-    0x20053b4b, 0x05225583, 0xc251dd20, 0x0c616e05, 0x394bb320, 0x0c3f4b0b,
-    0x01eaff24, 0x7f8a01d6, 0x2e06c17c, 0x2e07010e, 0x16143701, 0x26343632,
-    0x87150622, 0x87352008, 0x022b2308, 0x81875b78, 0xc0205c92, 0x00389d9f,
-    0x00000300, 0xc001eaff, 0x2a00a601, 0x3f003600, 0x22250000, 0x27032e27,
-    0x2627f882, 0x32013e35, 0x68331716, 0x162505eb, 0x17031e17, 0x056c411e,
-    0x1423372f, 0x0e270306, 0x17161401, 0x34012e37, 0x85178236, 0x013808a0,
-    0x0b070a6b, 0x0f1b1111, 0x110c190d, 0x3b5c3c01, 0x54012b01, 0x02534140,
-    0x200f1601, 0x0a05121b, 0x1310161b, 0x2b013024, 0x201eda18, 0x1e202525,
-    0x6c1e1d1b, 0x1e2d1e01, 0x15320282, 0x30160504, 0x180a0b1c, 0x2e1f2014,
-    0x402e3c3c, 0x3b820154, 0x292a2608, 0x13141f1a, 0x0b241d0f, 0x24300107,
-    0x72011812, 0x6255201e, 0x1a1e2055, 0x6e465046, 0x2e1e1e17, 0x01001e1e,
-    0x25008200, 0x5601d601, 0xbf821d00, 0x27220624, 0x78822e35, 0x07010e22,
-    0x32072442, 0x1e151732, 0x3d363201, 0xa0012301, 0x02011301, 0x82b52133,
-    0x6b552285, 0x2a0c8255, 0x24372401, 0x09097535, 0x822b1f96, 0x55d52b61,
-    0x09096055, 0x24241c20, 0xeb4b2a1c, 0x00963208, 0x00440015, 0x26340100,
-    0x27242627, 0x15060706, 0x26fa8211, 0x013f3616, 0x8335013e, 0x23272d0f,
-    0x07222722, 0x32330706, 0x0e011e33, 0x26277b82, 0x3315010f, 0x82161736,
-    0x010f272b, 0x37262706, 0x0282013e, 0x021f7d08, 0x19d50116, 0xfafe2114,
-    0x0f121c19, 0x2e120e0e, 0x281b9477, 0x0502025d, 0x0e263c0e, 0x05040105,
-    0x09030452, 0x0b0b0207, 0x0a010457, 0x03050d72, 0x06050a0a, 0x0a090b8c,
-    0x06200402, 0x480d1401, 0x3b011944, 0x06082216, 0x16030113, 0xe0fe1813,
-    0x0e0a1e11, 0x020c0a01, 0x04dd1b25, 0x01010d05, 0x02171605, 0x01121308,
-    0x01033005, 0x06140b0d, 0x01020101, 0x130d0906, 0x100d1c9b, 0x17540b83,
-    0x82402009, 0x063b08dd, 0x0d000900, 0x00001300, 0x23372725, 0x05071737,
-    0x07333507, 0x17013f27, 0x37272307, 0x4040d501, 0x55405595, 0x9540ebfe,
-    0xc0405540, 0x6b2a6b55, 0x2b2a2b55, 0x16405580, 0x8215552a, 0x952b2412,
-    0x50002b95, 0xcf5d0547, 0x00192105, 0x21067351, 0xe5541513, 0x07e65706,
-    0x27013d29, 0x35331117, 0x4f071123, 0x33200bb8, 0x2907aa53, 0x18122b80,
-    0x01243724, 0x0582012a, 0x6a6b5528, 0x464feb4a, 0x40433595, 0x43b82005,
-    0x0125054e, 0x1218966b, 0x07675156, 0x16c0562a, 0x0120d6fe, 0x36a00a0a,
-    0x5608e856, 0x042105eb, 0x36008200, 0x9601ab01, 0x1f001b00, 0x37003300,
-    0x33130000, 0x37011f32, 0x82013b36, 0x15162406, 0x6e010e11, 0x3c08062e,
-    0x2327013f, 0x35331517, 0x15232707, 0x15071517, 0x17333733, 0x35273533,
-    0x0f233537, 0x23153301, 0x06094040, 0x110d112d, 0x150e1080, 0x1218010d,
-    0x0d1912d5, 0xab372610, 0x1e2a7880, 0x2302822a, 0x2b1e2b44, 0x37330282,
-    0x95012b2b, 0x0d102c06, 0x100e150d, 0x1912ebfe, 0x82ea1219, 0x16272435,
-    0x82802a2a, 0x8944201e, 0x2b2a302c, 0x00020000, 0x01feff00, 0x008101c0,
-    0x8244003b, 0x013e279b, 0x020e1617, 0x007f1407, 0x05f64305, 0x010e1529,
-    0x3736021e, 0x43233533, 0x0628057b, 0x010e010f, 0x013e2622, 0x35201e82,
-    0x08053c7f, 0x1307068e, 0x34272622, 0x010e3736, 0x05140b62, 0x330d0808,
-    0x1d0c1d03, 0x111f110f, 0x19142f14, 0x01373b0c, 0x093f3a26, 0x26013534,
-    0x0d38242f, 0x0416110a, 0x0c060e0d, 0x0f0d0819, 0x15102402, 0x070b0520,
-    0x010a05eb, 0x1c05211c, 0x100c2d01, 0x12140402, 0x162a2954, 0x05050509,
-    0x2e19171f, 0x0d180102, 0x253a480d, 0x354b3902, 0x01023a1d, 0x140d112a,
-    0x170d0519, 0x120c2c25, 0x1c22151f, 0x06140101, 0xe3fe090b, 0x250b0808,
-    0x00202b0b, 0x310b4347, 0x001b000c, 0x16320100, 0x06141115, 0x3411012b,
-    0x9d6f3336, 0x013b3206, 0x3b363435, 0x95011101, 0x12191912, 0xff121955,
-    0x20088600, 0x9a48184a, 0x55012a07, 0x80fe1912, 0x122a1219, 0x20098219,
-    0x0aff4eff, 0x9b458020, 0x06df4e09, 0x27012e25, 0x4205013e, 0x53500742,
-    0x50172008, 0xab2d075c, 0x02024836, 0x48373648, 0x01480101, 0x0554504c,
-    0x1e174235, 0x1e1e2d1e, 0x24241c16, 0x01242437, 0x36490180, 0x84014936,
-    0x0c6a2305, 0x02820c12, 0x8e442a20, 0x577f2006, 0x8282065e, 0x03002e08,
-    0xe0ff0000, 0xab01e001, 0x23001300, 0x00002800, 0x07010e01, 0x37171415,
-    0x3e352335, 0x16323701, 0x012e3717, 0x37170117, 0x15373533, 0x08118233,
-    0x2734353d, 0x1d160737, 0x00012301, 0x0b026c52, 0x54015575, 0x15372040,
-    0x9c461b1e, 0x351b86fe, 0x1b408025, 0x2c0c0124, 0x014f034e, 0x516d02ab,
-    0x750f1496, 0x543f2b19, 0x1f161802, 0x85351e1b, 0x01a52b22, 0x23961b24,
-    0x104e2c20, 0x84822b11, 0x77828382, 0x01962d08, 0x000b002b, 0x001f0015,
-    0x15331300, 0x15333533, 0x15233523, 0x1e333723, 0x14011d01, 0x37230706,
-    0x35373632, 0x012b012e, 0x2b2a6b15, 0x2a220082, 0xeb8240aa, 0x40401c22,
-    0x25057d47, 0x562b0115, 0x0282d656, 0x56205c82, 0x2b268382, 0x0956090c,
-    0x6741800c, 0x2d5f8205, 0x008f01e3, 0x0048003f, 0x005a0051, 0x59822500,
-    0x17373522, 0x2205da45, 0x18071707, 0x2b0bc669, 0x2e372715, 0x14062201,
-    0x17373316, 0x222b8383, 0x3f363426, 0x32013e01, 0x82011f16, 0x011f2595,
-    0x25061416, 0x43079b41, 0x272008e7, 0x01301187, 0x3c9626d1, 0x1919130f,
-    0x02011926, 0x010d0b20, 0x0d230883, 0x8302200b, 0x13193d08, 0x25963c0f,
-    0x080a0a07, 0x0a0b05ba, 0x2a56050b, 0x0a050c3c, 0x0b08c8fe, 0x0b0b100b,
-    0x58200686, 0xab270d85, 0x033c47ab, 0x8219261a, 0x75212433, 0x820d1506,
-    0x0d132552, 0x21750615, 0x1a365c84, 0xab473c03, 0x070c0701, 0x080806ba,
-    0x40155506, 0x06060d3b, 0x46831501, 0x02844982, 0x110b6d26, 0x0b110a0a,
-    0x2808ab69, 0x00060080, 0x001e0013, 0x55d71827, 0xbe5a180c, 0x1e172b08,
-    0x26071701, 0x3e270722, 0xcc881701, 0xd5004308, 0x402a0140, 0x194126d5,
-    0x3c35131a, 0x191a1335, 0x27172641, 0x3e141a0f, 0x270f1a14, 0x15150f17,
-    0x0115151e, 0xababc080, 0x181b014b, 0x1616141a, 0x1b181a14, 0x0f100146,
-    0x19141419, 0x1447100f, 0x0282141e, 0x4d020021, 0x10220853, 0x7f821b00,
-    0x22012e2d, 0x1e14020e, 0x023e3202, 0x41072634, 0x352d05ea, 0x01173723,
-    0x564e1e97, 0x20203d4e, 0x2906853d, 0x4b404b4b, 0x01a0952a, 0x12881f57,
-    0x79261983, 0x806b6b80, 0xf3459595, 0x01f13707, 0x0007001e, 0x0017000f,
-    0x005e0051, 0x3f353700, 0x0f173301, 0x06852702, 0x15260d84, 0x06073707,
-    0x01822726, 0x15060731, 0x16171614, 0x2623013f, 0x3736013f, 0x82373633,
-    0x82172001, 0x06072411, 0x8222010f, 0x07062121, 0x07820182, 0x18872620,
-    0x2e271723, 0x82138301, 0x375f0823, 0x02053836, 0x02040152, 0x03050176,
-    0x02020168, 0x2e020335, 0x26bc0201, 0x04020302, 0x17141507, 0x10180d11,
-    0x02072c06, 0x4905010c, 0x28180b05, 0x051b1f23, 0x20172005, 0x11182012,
-    0x18050505, 0x191c2229, 0x18180404, 0x121c2028, 0x017f0109, 0x21111a04,
-    0x0c0c0307, 0xe41b1313, 0x82010601, 0x82152002, 0x05022203, 0x82068301,
-    0x2e430809, 0x0201010a, 0x0e0a0405, 0x140e1c0f, 0x08120203, 0x03190601,
-    0x200f0f01, 0x12130706, 0x17202e21, 0x0f140206, 0x21070814, 0x14140605,
-    0x211d261f, 0x0c120707, 0x07230314, 0x07031111, 0x06170e21, 0x430e0908,
-    0xd63e0803, 0x13006501, 0x35002c00, 0x00003c00, 0x07010e01, 0x1517011e,
-    0x37363533, 0x3e273317, 0xe5823501, 0x1716322d, 0x26070614, 0x012f2627,
-    0x82373616, 0x15232810, 0x3e35012e, 0x82331701, 0x010e2419, 0x83072327,
-    0x062e0808, 0x5a000123, 0x62010279, 0x181b494c, 0x1f32521e, 0x39790222,
-    0x1b015644, 0x06020318, 0x37040707, 0x043a0404, 0x01322993, 0x012c485c,
-    0x02820112, 0x012c3b08, 0x04080514, 0x64011411, 0x353d5101, 0x2d2d0a4d,
-    0x53370703, 0x3d1e3414, 0x32303651, 0x010c261c, 0x02020302, 0x2e2e1701,
-    0x0c990215, 0x38291e2e, 0x0f0f0554, 0x08350107, 0xbe820306, 0x32068b47,
-    0x00800156, 0x000c0003, 0x001e0015, 0x13000024, 0x56033303, 0x1c450804,
-    0x31118808, 0x33071707, 0x2ad53727, 0x07362aaa, 0x090d0909, 0x29451c09,
-    0x470d2005, 0x3d210576, 0x2719822a, 0xfe80012a, 0x3b1501eb, 0x0d221e83,
-    0x82553a09, 0x4a4a2006, 0x6b2f05c0, 0x2a2b2b2a, 0x00060000, 0x01fbff00,
-    0x188501c5, 0x260c41a6, 0x37011300, 0x84273717, 0x07012503, 0x27071737,
-    0x1f230d82, 0x87273701, 0x013c2403, 0x851e1000, 0xfe0f2a00, 0xc53c3cff,
-    0x1f1ea63d, 0x2012831f, 0x8315820f, 0x0c012303, 0x0783fffe, 0x1e2c0e82,
-    0x78000110, 0xc53dc43c, 0x4c1e1f1f, 0x4b200f82, 0xfb860386, 0x01eaff23,
-    0x0ec37d80, 0x86463320, 0x26222e07, 0x36341135, 0x11331117, 0x23153307,
-    0x20038235, 0x25038215, 0x1912aaab, 0x04851219, 0x2b2b8023, 0x20008256,
-    0x0cd06101, 0xaafe2a2a, 0x56c05601, 0x202020eb, 0x09206482, 0xea22e382,
-    0x638ceb01, 0x27002327, 0x2f002b00, 0x55661800, 0x206b8310, 0x206f8e21,
-    0x207b8a17, 0x09bf7c40, 0x0118122d, 0xabe71801, 0x80ab80fe, 0x82552a2a,
-    0x2bd52200, 0x2005822b, 0x898b9255, 0x8535208f, 0x84032095, 0x82962093,
-    0x00082393, 0xa5820014, 0x96440120, 0x56372007, 0x2e220506, 0x805b2701,
-    0x16062905, 0x27013e17, 0x0001012e, 0x2605364b, 0x01544017, 0x82098309,
-    0x54013202, 0x013d2d40, 0x4d4d2103, 0x3d010321, 0x2e1e3501, 0x2002821e,
-    0x35168260, 0x0707b35b, 0x54405bb3, 0x2d3d0129, 0x6969580e, 0x3d2d0e58,
-    0x73850000, 0x01c52308, 0x001a009b, 0x0026001e, 0x03070100, 0x011e1506,
-    0x36322133, 0x012f3437, 0x37231707, 0x13230727, 0x06821733, 0x35371526,
-    0x07270717, 0x37260a82, 0x60490001, 0x1b760102, 0x02270806, 0x5104211d,
-    0x515b1e3d, 0x2220484b, 0x9620591d, 0x3c1e0f3c, 0x013c0f1e, 0x98fe149b,
-    0x18120604, 0x04061218, 0x8216216d, 0x16012a22, 0x326d2374, 0x3bb020d0,
-    0x1823843d, 0x20099bf7, 0x208382ab, 0x20f7820c, 0x2083841c, 0x31828607,
-    0x33070327, 0x23352313, 0x15132315, 0x35331523, 0x79823523, 0x87016121,
-    0x61012b79, 0x5a4b486d, 0x165a5a2a, 0x6d831656, 0x83079521, 0x01072e6c,
-    0xeafe1c6b, 0x00016b6b, 0x552b2b55, 0x6f801800, 0x00112e09, 0x00190015,
-    0x1300001d, 0x011d0622, 0x24e78707, 0x23012e11, 0x0af86107, 0x1912ab23,
-    0x2561882b, 0x2bc01218, 0x0284402b, 0x18950126, 0x962a9612, 0x2107c24f,
-    0x0083562a, 0x02000023, 0x27008200, 0x8001d701, 0x23001100, 0x3b085b82,
-    0x010f1617, 0x012e010e, 0x2627013f, 0x36013f36, 0x013e0516, 0x011e011f,
-    0x1617010f, 0x2f26010e, 0x79372601, 0x7e05057a, 0x021a230c, 0x0a58580a,
-    0x0f030d02, 0x0b190123, 0x0d030f23, 0x2d081085, 0x7e0c231a, 0x6c010505,
-    0xa90706a5, 0x2118010d, 0x0e75760f, 0x0b020c22, 0x050e0e05, 0x220c020b,
-    0x0f76750e, 0x0d011821, 0x000607a9, 0x33680000, 0x0b734e05, 0x38002f24,
-    0xf94e4100, 0x010e210e, 0x2405694e, 0x011e0607, 0x229d823e, 0x822e0506,
-    0x210b83a5, 0x0f831605, 0x16010e23, 0x21078517, 0x7918011e, 0x617d083c,
-    0x425b200c, 0xb925056c, 0x262b1407, 0x2603820e, 0x26073d01, 0x820e142b,
-    0xf3fe3303, 0x061a2a13, 0x071b2a25, 0x1b0712da, 0x1a07242a, 0x414f522b,
-    0x0c334f05, 0x90492820, 0x16752c06, 0x2c130e26, 0x15130e25, 0x840d1315,
-    0x0da92342, 0x41842507, 0x2a0e0e29, 0x2a1a0625, 0x4fb70725, 0x05200953,
-    0x45084b47, 0x27220509, 0xdb853300, 0x2106fd60, 0xb882013e, 0x22263425,
-    0x48161406, 0x142206e1, 0xea482316, 0x16142305, 0x244c021f, 0x3f272205,
-    0x2fcc8401, 0xaafe1218, 0x78021812, 0x1818125b, 0x7d181824, 0x19250683,
-    0x1912c419, 0x2b0d8219, 0x01021bbd, 0x12641218, 0x1b020118, 0x0982b984,
-    0x5b231082, 0x83017e78, 0x1824222c, 0x20258356, 0x242b8424, 0x5f401924,
-    0x233d820c, 0x005f0c12, 0x4f053345, 0x182407f7, 0x29001c00, 0x28056d78,
-    0x012e2137, 0x22010e27, 0x23048226, 0x17011e37, 0x1324b188, 0x37330723,
-    0x27269b85, 0x023f012e, 0x465b011e, 0x18272005, 0x2f08b357, 0x47015601,
-    0x20180338, 0x47380318, 0x02785baa, 0x7b26b887, 0x0e641240, 0xa8840615,
-    0x11120a25, 0x85951b04, 0x859820bb, 0x3dc02ac9, 0x15100f59, 0x590f1015,
-    0x20e48498, 0x25bf8401, 0x6b40c2fe, 0xae82144b, 0x1d050125, 0x86ab6012,
-    0x821b82cd, 0x182421f4, 0x2608c77a, 0x009601d6, 0x82130009, 0x002526bf,
-    0x3700002f, 0x24bd8223, 0x37013e35, 0x21be8233, 0xbf821507, 0x07113322,
-    0x21054542, 0xae4b0622, 0x53172008, 0x2737050f, 0x3ed61123, 0x01012b1f,
-    0x3e3e1f2b, 0x01013d2f, 0x8c612f3d, 0x82172217, 0x0b012102, 0x25239b82,
-    0x85031818, 0x0d452116, 0xd0202382, 0x22202a82, 0xd0202382, 0xaa241383,
-    0x16161180, 0x51212a82, 0x22258218, 0x86ea1825, 0xfe260817, 0x00030056,
-    0x01e9ff00, 0x009701af, 0x001f0017, 0x01000027, 0x37171632, 0x011e0717,
-    0x07010e15, 0x07272622, 0xb0473727, 0x820e8205, 0x03262119, 0x15828d82,
-    0x0001162d, 0x2416351e, 0x15122b22, 0x8a496002, 0x4936270a, 0xb6170101,
-    0x07862d21, 0x1795012c, 0x361a2e15, 0x5a27441c, 0x0a890279, 0x34822820,
-    0xea2b3825, 0x86abfe23, 0x82002008, 0x820c2000, 0x01ea3c8b, 0x009601ab,
-    0x001b000f, 0x00250020, 0x0032002a, 0x0042003a, 0x004c0047, 0x18550051,
-    0x1811f142, 0x250b3fb0, 0x33070617, 0x04822726, 0x16373628, 0x07263317,
-    0x05821406, 0x33373422, 0x36270783, 0x16332734, 0x82330714, 0x16072307,
-    0x0c822617, 0x82361721, 0x36072619, 0x15330737, 0x0e495423, 0x5f188020,
-    0x0d370b0c, 0x2a062807, 0x061f101e, 0x1f060941, 0x02028d10, 0x16010124,
-    0x82320202, 0x01013605, 0x9d020224, 0x06091e10, 0x0e0d0717, 0x09061706,
-    0xd6b5101e, 0x0d8a46d6, 0x857b4020, 0x3c2d3408, 0x17171414, 0x141c0a0f,
-    0x1b141212, 0x0b160a30, 0x830b150b, 0x0a162105, 0x0b280882, 0x1b400a16,
-    0x1714120b, 0x14252482, 0x6b1b0b12, 0x06674b2a, 0x2b01b62a, 0x1d000d00,
-    0x36002100, 0x0e26ff82, 0x14011d01, 0x61571716, 0x87332005, 0x013e260d,
-    0x2634013d, 0x21cb8327, 0xd0821537, 0x07062223, 0x7c228415, 0x232605fa,
-    0x1919126b, 0x00824012, 0x2a200783, 0x2a2f0484, 0x20406a2a, 0x6001120d,
-    0x120e2040, 0x5e010e12, 0x2b210742, 0x20098780, 0x05535e01, 0x60802b27,
-    0x0e122020, 0x82048340, 0x0000212a, 0x210ac36a, 0xf94c001d, 0x256b8305,
-    0x2327012e, 0x684d2335, 0x2b838205, 0x3317011e, 0xd5013315, 0x2a2a802a,
-    0xab214982, 0x2908882a, 0x2a402a95, 0x0118126b, 0x0887aa2a, 0x200cbb6b,
-    0x24e98210, 0x23150100, 0x83548235, 0x33152105, 0x15204a82, 0x82051d43,
-    0x8623205d, 0x55012219, 0x205183aa, 0x204882ab, 0x255f8756, 0x2b0001aa,
-    0x5782152b, 0x40221082, 0x63854080, 0x2b2b1522, 0x04215f82, 0x07436b00,
-    0x11000822, 0x2d206182, 0x0a1d9118, 0x6f09734d, 0x59180ef0, 0xa0200be3,
-    0x20056f45, 0x280685ce, 0x144c01f8, 0xfe141b1b, 0x200582b4, 0x0a117bba,
-    0x5545e020, 0x20058505, 0x202086b5, 0x232c8314, 0x4960022a, 0x0f442887,
-    0x00032b0c, 0x000b0007, 0x0027001b, 0x0c692500, 0x1827200a, 0x480fd18c,
-    0x012a0aa2, 0xb54b4b35, 0x2a6b4b4b, 0x7f82912a, 0x1b225e84, 0x868aa614,
-    0x30309b26, 0xaa55d530, 0x13297fa6, 0x23001f00, 0x00002b00, 0x417f8313,
-    0x07201a03, 0x072b1f82, 0x16323634, 0xab23011d, 0x41512a2a, 0x1e2b1604,
-    0x124b2a2a, 0x0140121c, 0x97d56b2b, 0x55492882, 0x12120e66, 0x4100100e,
-    0xa02e0afb, 0x22001b00, 0x23250000, 0x3727012e, 0x05850727, 0x0e232625,
-    0x4c230701, 0x3e220557, 0x08822701, 0x3e234208, 0x31d50101, 0x490b1005,
-    0x0c064524, 0x11291307, 0x593c1212, 0x4601310f, 0x4639aa39, 0x0d402ad4,
-    0xd5400dee, 0x740d2112, 0x07056d17, 0x490b4d03, 0x38470104, 0x261b6742,
-    0x98671b26, 0x26262f01, 0x0b6b6c2f, 0x1e000422, 0x27257382, 0x0f173337,
-    0x0a634101, 0xea183720, 0x55270dd9, 0x0a226622, 0x512a241a, 0x01270500,
-    0x1a242a01, 0x4101342b, 0x012a05d3, 0x3377eb34, 0x0f243333, 0x4751293e,
-    0x3e292605, 0x5115240f, 0x059e7034, 0x00513422, 0x48085b6d, 0x19220543,
-    0x3b485b00, 0x16132c0d, 0x0706020f, 0x3e26010e, 0x52373302, 0x0e2505b4,
-    0x1f161701, 0x3dfa8201, 0x16171606, 0x3627023e, 0x0e011e17, 0x013e1602,
-    0x27263637, 0x2e270706, 0x36262701, 0x1c823637, 0x0607062b, 0x07262726,
-    0x36021e06, 0x03501837, 0x5b540809, 0x78020278, 0x01050530, 0x0a060401,
-    0x18050b16, 0x09b20118, 0x351b2e4d, 0x020e1815, 0x072f1c08, 0x0b080b2f,
-    0x17271607, 0x140d0602, 0x0803121b, 0x10060106, 0x1d1f0101, 0x15010a18,
-    0x1d02012d, 0x0845333a, 0x13343609, 0x01040315, 0x140d0403, 0x26201d2a,
-    0x080c6c48, 0x11e6fe32, 0x0802040f, 0x07070a07, 0xc20f1817, 0x0910101d,
-    0x2517141d, 0x23151d08, 0x13141d03, 0x1105021a, 0x040c2423, 0x10180502,
-    0x01030408, 0x1d120e0c, 0x3c088c82, 0x19231202, 0x171f2d0a, 0x3a171004,
-    0x03090108, 0x09030105, 0x0a01070b, 0x0000380d, 0xff000003, 0x010002c0,
-    0x00150080, 0x0023001d, 0x2e352500, 0x07062201, 0x1d062215, 0x3b161401,
-    0x05cd4401, 0x35012b39, 0x1632013e, 0x35053715, 0x0135012d, 0x2d1e01eb,
-    0x0c09011e, 0x826b090c, 0x401f3504, 0x121b1201, 0x0140fe16, 0x40c0fe40,
-    0x1e1e160b, 0x090c0b16, 0x2b077d59, 0x12120d0b, 0x95c0750d, 0x00952b2b,
-    0x60050342, 0x1a200537, 0x01336d83, 0x33013f34, 0x23353337, 0x33173315,
-    0x010e1516, 0x821e1507, 0x82372072, 0x22073f84, 0x32363426, 0x01061416,
-    0x0d040229, 0x11c01113, 0x05060d13, 0x4901054d, 0x0501496c, 0xeb482e4d,
-    0x20013605, 0x350d080b, 0x0a352020, 0x417e1816, 0x1a1a172b, 0x7e412b17,
-    0xa3581888, 0x0697520b, 0x13000924, 0x0b822b00, 0x22128b52, 0x82153327,
-    0x16322280, 0x21808317, 0x8e823523, 0x3d262227, 0x01363401, 0x0d9d5215,
-    0x5656ab23, 0x053d492b, 0x82555521, 0x01182208, 0x0da7522b, 0x2b2bab24,
-    0x18821218, 0x07860120, 0x2408b34f, 0x002b01c0, 0x227f820f, 0x8b2a0021,
-    0x012e2181, 0x17276583, 0x07353315, 0x82373523, 0x011e2878, 0x010f1415,
-    0x822e1733, 0x20fa847c, 0x0538466b, 0x1919122e, 0x80d52a12, 0x12555555,
-    0x4d460719, 0x460f8264, 0x2a230535, 0x46ab8080, 0x0e230549, 0x4f2b680a,
-    0x82820605, 0x83030021, 0xab012104, 0x08278382, 0x24001200, 0x87250000,
-    0x1537215f, 0xef83f982, 0x41213721, 0x0e830816, 0x01210383, 0x05694f15,
-    0x56167731, 0xfe161616, 0x181256ea, 0x56561218, 0x64564040, 0xd52007e4,
-    0xb946ef82, 0x2b2b2208, 0x0907542a, 0x27206b87, 0x07236b94, 0x4e272622,
-    0x977a05e2, 0x8d6f8207, 0x12eb266e, 0x55800118, 0x8d72852b, 0x8280206f,
-    0x09674185, 0x9620df89, 0x1820df86, 0x23257394, 0x23372307, 0x29481835,
-    0x15772a07, 0x15151555, 0x332b406a, 0x215c8d48, 0xc482abd6, 0x54830420,
-    0x01d60124, 0xe7670080, 0x07132308, 0xf8472317, 0x18332005, 0x2608425f,
-    0x010f2737, 0x54211521, 0x70530846, 0x1eae2308, 0x125d7237, 0x37722a09,
-    0x01ab521e, 0x01eafe16, 0x0550414b, 0x06850920, 0x1e80012c, 0x12180137,
-    0x181813d5, 0xee82d513, 0x2e222682, 0xe555d5d5, 0x85402005, 0x0cb34606,
-    0x3100292a, 0x3e003500, 0x00004600, 0x35c3e018, 0x4e4c2720, 0x36322c05,
-    0x010e2637, 0x3732011e, 0x186a6b01, 0x2325d4e0, 0x121b12b6, 0x60300282,
-    0x0213190a, 0x01091813, 0x092ad62b, 0x0c2a010c, 0x2a24c982, 0x01090c01,
-    0x2a270d8c, 0x2b2b802b, 0x47408080, 0x262805b4, 0x19140209, 0x03000812,
-    0x29060b48, 0x00080080, 0x00360011, 0x144c3700, 0x08088907, 0x27262225,
-    0x2e23010e, 0x012e2701, 0x37013e35, 0x37361732, 0x3e171632, 0x011e3301,
-    0x15011e17, 0x2707010e, 0x830d4b06, 0x78123a89, 0x2d1e1e17, 0x13961e1e,
-    0x200c0c21, 0x072d2014, 0x30011e18, 0x18080824, 0x22118d23, 0x6e2b1810,
-    0x4120067f, 0x3006a74d, 0x0e0e0f16, 0x1f26010f, 0x251b2b09, 0x16020130,
-    0x410f8e01, 0xab850a73, 0x61003524, 0xafa36a00, 0x272fae93, 0x16140622,
-    0x06373233, 0x32161415, 0x8217013f, 0x3736210b, 0x3105d14d, 0x36072223,
-    0x22263435, 0x2627010f, 0x07062223, 0xcd4e1726, 0x20e39c07, 0x33e29110,
-    0x181812d8, 0x09090b12, 0x200c2618, 0x11130d20, 0x140c0317, 0x21231289,
-    0x83140c1f, 0x42212012, 0x0f410576, 0x19bf302f, 0x0b041824, 0x0e18120f,
-    0x140e2424, 0x8e010e10, 0x44f4200f, 0x37430968, 0x000f2909, 0x00170013,
-    0x1300001b, 0x2a0fd948, 0x01352115, 0x05233533, 0x6d152335, 0xfe260ed4,
-    0x019696aa, 0x6a599656, 0x12192b07, 0x19122a01, 0xfeaaaa2b, 0x008255d6,
-    0x4b450020, 0x58eb2008, 0x05190863, 0x65580ad7, 0x05c14507, 0xb4463720,
-    0x25152307, 0x6c440614, 0x16142a05, 0x35373632, 0x2a2bc033, 0x3002822b,
-    0x241b40ab, 0x1b240101, 0x0c094040, 0xff16090c, 0xb0751800, 0x582a2008,
-    0x15261581, 0x1b24241b, 0x2d839696, 0x06009622, 0x00218b82, 0x2a878301,
-    0x001a0016, 0x0022001e, 0x7334002b, 0x23201683, 0x6c08556a, 0x027215a2,
-    0xfe402513, 0x805555c0, 0x35230282, 0x6ac05f2a, 0x2b240ef0, 0xab121801,
-    0x2408665c, 0x20561812, 0x20008336, 0x05a14360, 0x2b410585, 0x09c3440d,
-    0x21132374, 0xf25c2723, 0x083a6d0c, 0x40209794, 0x8c8f90a5, 0x82000821,
-    0xc0012100, 0x08576618, 0x2f071d42, 0x2500001f, 0x27153335, 0x010f1737,
-    0x11231533, 0x07240382, 0x03071737, 0x17300382, 0x17333523, 0x01372707,
-    0x3d846b55, 0x2a6f3d1e, 0x82200082, 0x1e270882, 0x051e3d1e, 0x82ec6b6b,
-    0x2aab2306, 0x11826f2a, 0x016b9125, 0x82ce6b80, 0x10012108, 0x51221482,
-    0x05828e2a, 0x250c8f5a, 0x001b0011, 0x55620025, 0x08df4705, 0x35333522,
-    0x2015955a, 0x07df4755, 0x55404022, 0x47109b5a, 0x01240567, 0x2b2a2b2b,
-    0x200ef947, 0x07c76400, 0xe37a6b20, 0x8217200a, 0x37002179, 0x830a5f4c,
-    0x8207200b, 0x8203200f, 0x260b8303, 0x15c0c040, 0x84958080, 0xab402c02,
-    0xababd5ab, 0x6bc0c0c0, 0x836beb6b, 0x6b152200, 0x82068301, 0x051b66cb,
-    0x01d65008, 0x0019006b, 0x012e2500, 0x011e012f, 0x15070617, 0x1e373632,
-    0x26353301, 0x37013e27, 0x01061407, 0x012f2500, 0x466d0380, 0x37142626,
-    0x14372020, 0x6d462626, 0x77308003, 0x2b396a26, 0x1c298a5b, 0x11101501,
-    0x01151011, 0x5b8a291c, 0x856a392b, 0x000234b3, 0x11005601, 0x26001a00,
-    0x3f003200, 0x50004800, 0x52010000, 0x372a0576, 0x013e3316, 0x22232634,
-    0x8f572607, 0x32333908, 0x23061416, 0x34362722, 0x15053627, 0x15331523,
-    0x35333533, 0x22173523, 0x21239082, 0x84012e35, 0x259f822d, 0x3e352315,
-    0x08851701, 0x2001262a, 0x202a2a20, 0x18121318, 0x12220784, 0xbd491912,
-    0x12672605, 0x0b121919, 0x2f00820a, 0x4040d6fe, 0xb540402b, 0x01055f27,
-    0x2760046b, 0x133c1f82, 0xd6024029, 0x1fa04002, 0x01350129, 0x3f2b5501,
-    0x0e0e012a, 0x2b3f2a01, 0x18200e0e, 0x2807af52, 0x11291006, 0x2a402005,
-    0x2d028240, 0x3a23236a, 0x0523233a, 0x1a022005, 0x02821a0a, 0x14060226,
-    0x141a1a08, 0x24097b58, 0x006b01eb, 0x20ed8208, 0x20ed821d, 0x54e7822f,
-    0xa65d083f, 0x20d29308, 0x20c58307, 0x2fce8221, 0x30244001, 0x30304830,
-    0x19191324, 0xd8191926, 0xc035b284, 0x01067530, 0x30750656, 0xfe024e32,
-    0x014e02fc, 0x4930016b, 0x21028230, 0x23821a28, 0x171a2622, 0x2b23d783,
-    0x822b8040, 0x2b2b29de, 0x0c200129, 0x200c1717, 0x01349383, 0xe6ff0000,
-    0x9601d601, 0x00000d00, 0x06141525, 0x2306012f, 0x3205f54a, 0x091dd501,
-    0x58523c21, 0x7db07d7d, 0x0910c0c0, 0x82362d0d, 0x187d2009, 0x3509b346,
-    0x000a006b, 0x00210018, 0x17323700, 0x17141506, 0x36343523, 0xbd823337,
-    0x22057253, 0x18173233, 0x0808854e, 0x251feb25, 0x75e6111a, 0x202a4ad6,
-    0x161f1f2c, 0x23a00c0a, 0x32463333, 0x1c099532, 0x2b191d25, 0x2b562f26,
-    0x82201675, 0x4505231b, 0x19834632, 0x230b1f4e, 0x000e0097, 0x373dac82,
-    0x0f06012e, 0x16170601, 0x37323337, 0x0e372636, 0x16011f01, 0x3736013b,
-    0x26012f36, 0x081c8227, 0x0a03a941, 0x04680206, 0x92030309, 0x18170407,
-    0x20082823, 0x92070446, 0x0201010b, 0x02105663, 0x04d00809, 0xd1030502,
-    0x0102060b, 0xed7d3406, 0x8d438f3f, 0x030b0106, 0x20adc503, 0x00040304,
-    0x63000200, 0x26080523, 0x00030066, 0x01000008, 0x013f2703, 0x27372113,
-    0x618a1601, 0xfeb08e6c, 0x0168c6bb, 0x01d9fe66, 0xccfe53bb, 0x83007b24,
-    0xe2ff3923, 0x9e01d601, 0x0f000600, 0x1d001400, 0x2d002700, 0x3c003400,
-    0x36370000, 0x0733fd82, 0x37162526, 0x06141516, 0x16072707, 0x37272607,
-    0x18270617, 0x2107be89, 0xa56d2607, 0x37262205, 0x08c6821e, 0x2223062c,
-    0x07163727, 0x06173627, 0x32171614, 0x202b1513, 0x0c012243, 0x1e01493f,
-    0x225f8716, 0x8b222e14, 0x075d4687, 0x1e150c12, 0x1382244e, 0x2b5f8e2f,
-    0x10331417, 0x2315133f, 0xbd1c4220, 0x081b828f, 0x880f1521, 0x27431b07,
-    0x07182f97, 0x19512111, 0x3a315f87, 0x878b1c0d, 0x19150a3d, 0x17113514,
-    0x840c0f1a, 0x5f8f2d17, 0x1d053e35, 0x1507660e, 0x8e512341, 0x30221d82,
-    0xf582113a, 0x0021f182, 0x05b759ff, 0x1b001324, 0xfd822300, 0x11742320,
-    0x11152105, 0x2b05814d, 0x012e1137, 0x14160717, 0x34361707, 0x0784ce82,
-    0x15012308, 0x092b802a, 0xd5090c0c, 0x01010c09, 0x321e8e0c, 0x7b3f1e32,
-    0x1e19191e, 0x2a6b0125, 0x090c012a, 0x1e83abfe, 0x09550133, 0x351e130c,
-    0x421e3588, 0x1a1e05aa, 0x271e1a44, 0x089b5166, 0x9601eb26, 0x0f000700,
-    0x27207382, 0x618e7582, 0x85922720, 0x11230325, 0x8aac0133, 0x8c80206b,
-    0xab1e2485, 0x8e5701ab, 0x8e78206c, 0xcbfe248c, 0x58000b01, 0x7fb206bf,
-    0x7fc03520, 0xb9ebeb21, 0x230721ff, 0xff217fc0, 0xb77e82d5, 0x217fc2ff,
-    0x7ffdb5df, 0xfd95bf21, 0x77a1217f, 0x7f217ffd, 0x217ffd55, 0x7ffd406a,
-    0x47204a21, 0xf344068f, 0x00172208, 0x050b551b, 0x71440120, 0x33352614,
-    0x33352335, 0x0e9d4437, 0x210eff44, 0x00822b5e, 0x0445ec20, 0xd6fe241b,
-    0x446b2a2b, 0x87430f9c, 0x43074537, 0x2b01ab23, 0x06fb4500, 0x9601992f,
-    0x27002000, 0x00002e00, 0x33353313, 0x24038315, 0x1607011e, 0x09556306,
-    0x6f583320, 0x33232206, 0x05d46115, 0x60390685, 0x2b202a4b, 0x44321156,
-    0x202b7405, 0x150b4b2a, 0x090c0c09, 0x54067520, 0x27028206, 0x08086608,
-    0x40550166, 0x07250082, 0x93070c72, 0x3508820b, 0x0c012a40, 0x0c09aa09,
-    0x0a015601, 0x780b2222, 0x220f0160, 0x23520f23, 0x82d62006, 0x00192787,
-    0x0021001d, 0x9b510100, 0xfb9a1805, 0x673b2007, 0x1483051c, 0x2115052b,
-    0x23352735, 0x12ab0115, 0x05c05b18, 0x56121822, 0x122e0282, 0x0100ff18,
-    0x01568056, 0xea121940, 0x04841912, 0x22832b20, 0xea2b2b24, 0x4c182bea,
-    0xeb2a082b, 0x0b00ab01, 0x1e001500, 0x65823600, 0x14011e2b, 0x3e270706,
-    0x27263401, 0x210b8507, 0x09853436, 0x34262224, 0x3f4a2736, 0x11232305,
-    0x527d3533, 0x012e3a05, 0x013e1127, 0x1dac0137, 0x1e1d2121, 0x181a1a18,
-    0x1414111e, 0x18181e11, 0x2e71823d, 0x0e181824, 0x2b011e17, 0x012bc0c0,
-    0x82aa171e, 0x2506820a, 0x4e1d5701, 0x2c824e58, 0x3d483d28, 0x2e111f18,
-    0x2e822e36, 0x11184822, 0x20062f5c, 0x252282c1, 0xc0fe5660, 0x2e866040,
-    0x07826a20, 0x2109d776, 0x9b6e0096, 0x003f2505, 0x013e2500, 0x2d06df4a,
-    0x07062223, 0x2e171614, 0x010e2301, 0xba761415, 0x058c4b05, 0x34232282,
-    0x82353627, 0x822282cd, 0x011e261c, 0x16373233, 0x331c8233, 0x00012634,
-    0x21013635, 0x13131d19, 0x0120191e, 0x3e2f2436, 0x15270782, 0x1d182215,
-    0x892e523e, 0x8c40200b, 0x8ad12025, 0x20198d25, 0x20278c35, 0x56278a46,
-    0x18240dfb, 0x34003000, 0x2309894f, 0x0607012b, 0x2005606a, 0x06746223,
-    0x17062223, 0x05695533, 0xb1820720, 0xb6180a82, 0xa24f0985, 0x4f823006,
-    0x090b0807, 0x1812560c, 0x241cc118, 0x180c2a02, 0x080883b6, 0x23130f31,
-    0x95012a37, 0x00ff1218, 0x064f1912, 0x1940090c, 0x12000112, 0x17184a18,
-    0x120b0909, 0x0f0a050e, 0x050b0910, 0x160e1707, 0x2b2b8b1b, 0x83040000,
-    0xc001339c, 0x12008001, 0x24001600, 0x00002d00, 0x15231501, 0x60562e33,
-    0x14172605, 0x35330706, 0x22038227, 0x18172523, 0x200b1671, 0xfdc81817,
-    0xd5403c08, 0x010f0d5c, 0x01304830, 0x3c5c0d0f, 0x01aaaaee, 0x12195500,
-    0x1813d6fe, 0x4c951219, 0x01330556, 0x0cd55555, 0x30241420, 0x20142430,
-    0x2a3cee0c, 0x83552b2a, 0x055350a0, 0x2418eb2f, 0x18241919, 0x00030000,
-    0x01ffff00, 0x238b8296, 0x00100006, 0x25211082, 0x23798233, 0x21273315,
-    0x34087982, 0x2622012b, 0x21150135, 0x33373335, 0x2a2b0117, 0x562a5555,
-    0x1a0001ab, 0x1a11aa11, 0xd6fe1501, 0x166a164a, 0x55565695, 0x1100ffeb,
-    0x01111a1a, 0x152b2b40, 0x82538415, 0x828020d1, 0x09340853, 0x11000d00,
-    0x22130000, 0x21111506, 0x23263411, 0x23113307, 0x35331537, 0x011813ab,
-    0xaa131800, 0x2b6aaaaa, 0x13188001, 0x5501abfe, 0xfe2b1813, 0x2a2aaad6,
-    0x20088743, 0x21098280, 0x50820011, 0x24059f5a, 0x11151632, 0x398c8333,
-    0x17013e11, 0x01113311, 0x552b2b55, 0x15181395, 0x01aa56fe, 0xd5951218,
-    0x4882d52a, 0x2b2bd624, 0x4a842a01, 0x002a0122, 0x26092b4c, 0x000e0080,
-    0x82160012, 0x06222597, 0x23112307, 0x23204782, 0x27309087, 0x01231533,
-    0x01181200, 0xaa011595, 0x95131815, 0x2a210082, 0x8996842a, 0x6eaa204d,
-    0x14210b6b, 0x275b8200, 0x1f010e01, 0x17011e01, 0x29058a44, 0x013e2726,
-    0x05263637, 0xec821707, 0x011e2c08, 0x0e171637, 0x16060701, 0x35363217,
-    0x0b013717, 0x7a0b222e, 0x16081b0e, 0x6303044b, 0x03100a3e, 0x11271010,
-    0x341bf5fe, 0x85022014, 0x270f300f, 0x25254610, 0x95011b51, 0x7a304301,
-    0x820e1003, 0x193a3f0f, 0x10060d20, 0x4a17081d, 0x27351b26, 0x201a3929,
-    0x1c0f070d, 0x044a1709, 0x1b51242d, 0xb75e0500, 0x000d2208, 0x08157111,
-    0x0e111733, 0x22212301, 0x3e112726, 0x37133301, 0x33370727, 0x08ac7e27,
-    0x25094242, 0x1801802b, 0xf583ff12, 0x1d270782, 0x95a31da3, 0x51757676,
-    0x72200568, 0x01220685, 0x1f838095, 0x0112182d, 0xfe181256, 0xa31ca480,
-    0x51a075ce, 0x8020055d, 0x20086451, 0x22838204, 0x18c001d5, 0x2608d74a,
-    0x37000018, 0x83231533, 0x33132403, 0x82112311, 0x352e080b, 0x27072707,
-    0x23371737, 0x95555540, 0x55965656, 0xac155555, 0x79176254, 0xab299554,
-    0x01c0c0d6, 0x01d5fe2b, 0xac2a56d6, 0x78176255, 0x49189454, 0x052a0b87,
-    0x00000e00, 0x3523013f, 0x42183307, 0xf5300833, 0x4a6a4868, 0x7d7d580b,
-    0x157d7db0, 0xfad086d0, 0xb0210883, 0x0823507d, 0x8001c028, 0x00002100,
-    0x155e1513, 0x061d5e08, 0x33353327, 0x21112115, 0x25178311, 0x35333523,
-    0x888215d5, 0x9555153b, 0xfe2b8015, 0x2b800180, 0x01951580, 0xaa6a6a55,
-    0x6a406b15, 0x552a2a2a, 0x23fe8201, 0x55806b6b, 0x2208b755, 0x580d0096,
-    0x132e053b, 0x11150622, 0x36323337, 0x012e3537, 0xe3820723, 0x15250725,
-    0x83271533, 0x16142d59, 0x1117013b, 0x55232634, 0xc0551812, 0x3f054951,
-    0x2bc0ebeb, 0x2b164001, 0x12192bd5, 0x121855d5, 0x12189501, 0x1856eafe,
-    0x18129612, 0x952a962a, 0x15281882, 0x55191215, 0x19122a01, 0x2808975c,
-    0x009601c0, 0x00190008, 0x085c5700, 0x15070332, 0x0e17011e, 0x27262201,
-    0x1537013e, 0xa0011133, 0x3105a941, 0x3b2e8027, 0x6d480101, 0x22010248,
-    0x12402b1d, 0x0282121c, 0x42020130, 0x111603c1, 0x12181812, 0x2505140c,
-    0xc7848001, 0x01de3308, 0x00a6018e, 0x001a000c, 0x1300002d, 0x1e072722,
-    0x27373601, 0x07060706, 0x37160627, 0x023e3736, 0x07222326, 0x15163706,
-    0x22061413, 0x34373526, 0x21823f36, 0x013e5908, 0x0312ac16, 0x66361109,
-    0x371c1137, 0x16102331, 0x2c231c07, 0x04102c1e, 0x2e362412, 0x4c1902b0,
-    0x0e0f4d81, 0x2c1f0706, 0x012d391e, 0x0a82031a, 0xc913060d, 0x0315181c,
-    0x030e1334, 0x1e0d1303, 0x14170914, 0xfe05042e, 0x413f37cd, 0x1408df37,
-    0x131a0606, 0x00050d0d, 0x83086b56, 0x000c28ef, 0x0028001b, 0x8234002e,
-    0x010e2cf5, 0x27012e07, 0x32013e37, 0x82031716, 0x263521ef, 0x172ca682,
-    0x3517011e, 0x27232733, 0x33373317, 0x07290382, 0x36012f23, 0x22061732,
-    0x08058437, 0x02c00123, 0x6c52526c, 0x612a0102, 0xab2a6169, 0x44014738,
-    0x02465250, 0x2a384701, 0x402b402a, 0x162a1615, 0x25078315, 0x16401580,
-    0x05854016, 0x2f82ab20, 0xb6343582, 0x181a1b19, 0x5109b4fe, 0x01219e3a,
-    0x3a9c2301, 0x2b290951, 0x27822582, 0x157f1525, 0x82141415, 0x0c4f4403,
-    0x0f00062b, 0x00001800, 0x15330701, 0x51928221, 0x1720073d, 0x1525ae82,
-    0x013e3523, 0x06726c01, 0x1b1b1435, 0x141b1b28, 0xc003421b, 0x80014203,
-    0x45ababc0, 0x821b291b, 0x18852502, 0x18101018, 0x02214282, 0x05f74f00,
-    0x0600802a, 0x00001a00, 0x2317013f, 0x17215282, 0x28f48237, 0x2227012e,
-    0x012e0706, 0x05e36a23, 0xd5d52b31, 0x95d6fe40, 0x01312a0f, 0x0e192101,
-    0x82090919, 0x23ae8204, 0xc0c02a31, 0x802b5882, 0x1d39250e, 0x0c012119,
-    0x820c0b0b, 0x391d2c1f, 0x00080025, 0x01eaff00, 0x828001d6, 0x001e2f09,
-    0x00260022, 0x002e002a, 0x00520040, 0x7d581300, 0x33172407, 0x48061415,
-    0x332f05e4, 0x33363435, 0x1f163231, 0x35071601, 0x8a331523, 0x312e8203,
-    0x3723010f, 0x2e012f36, 0x33013f01, 0x07170607, 0x118e011e, 0x80489520,
-    0xe76b2105, 0x2b051349, 0x0b151b40, 0x081d0712, 0x2b802a4f, 0x2a2a0182,
-    0x030f1023, 0x04022802, 0x08870212, 0x0f105324, 0x11820104, 0x1101132b,
-    0x2901030e, 0x01130502, 0x0694486b, 0x12abaa2f, 0xab121818, 0x081b1510,
-    0xb2082108, 0x2a008680, 0x29102e01, 0x1a0c0916, 0x82110115, 0x820d2007,
-    0x220f8e07, 0x84010000, 0xa03a08f3, 0x14009601, 0x15250000, 0x012e3523,
-    0x0622012b, 0x11231507, 0x3b361533, 0x01011e01, 0x100166a0, 0x0f0c3e0b,
-    0x0a666401, 0x3629660a, 0x0cacc4af, 0xac0c1010, 0x0488aa01, 0x83433801,
-    0x82802008, 0x05354643, 0x08087e59, 0x012e232b, 0x37363427, 0x3307013e,
-    0x00012307, 0x13013024, 0x161e0118, 0x011e1696, 0x30011318, 0x2a2b801c,
-    0x30019501, 0x131d0425, 0x28688217, 0x1d13171e, 0xd4302405, 0x053b42d5,
-    0x01d5ff29, 0x008001c0, 0x830f0009, 0x132c089b, 0x14111707, 0x17213316,
-    0x11010937, 0x07232634, 0x23173717, 0x192b1c31, 0x2b0f0112, 0x01a7fe1b,
-    0xe0121959, 0xcf3a1536, 0x2b1b8001, 0x07c8a518, 0x2e261682, 0x40e01813,
-    0xa3523b1b, 0x01c62609, 0x000800ae, 0x21fa821d, 0xde820e26, 0x26013e27,
-    0x37270717, 0x24f18227, 0x17372735, 0x08038237, 0x011f1626, 0x95011716,
-    0x09132010, 0x0913211f, 0x25253721, 0xcb2b4321, 0x8934a615, 0x0c0c9510,
-    0x010a0b12, 0x200909a5, 0x20351e82, 0x155fa220, 0xac741c40, 0x602576b7,
-    0x36283258, 0x060b0605, 0x206b8309, 0x25048303, 0x9801ab01, 0x6b821600,
-    0x00002427, 0x37173201, 0x206f823e, 0x265b820f, 0x27373621, 0x82013e26,
-    0x36550867, 0x07010e17, 0x05163335, 0x15333734, 0x0001012e, 0x04231618,
-    0x05041011, 0xfe172820, 0x202817d8, 0x11100405, 0xc3162304, 0x92435602,
-    0x09aafe09, 0x01564392, 0x073d0655, 0x08110905, 0x27271837, 0x11083718,
-    0x3d070509, 0x5e45aa06, 0x1c19df07, 0x07df191c, 0x08af505e, 0x9601c03b,
-    0x24002000, 0x2c002800, 0x35130000, 0x36343533, 0x3715013b, 0x32333517,
-    0x07fb4616, 0x23013d22, 0x2405314d, 0x15231735, 0x2c0d8233, 0x23351315,
-    0x182b4015, 0x35368012, 0x05944515, 0x1100ff24, 0x00822b19, 0x00842a20,
-    0x2a2b013f, 0x95181216, 0x19952020, 0x11aafe11, 0x16111919, 0x562a562a,
-    0x2a802a56, 0x2a00ff2a, 0x066b412a, 0xc024f382, 0x0a008b01, 0x00387d82,
-    0x35231501, 0x27071723, 0x010f1737, 0x35262736, 0x012b2634, 0x1e150622,
-    0x10cad918, 0x20c00136, 0x5a173478, 0x6c34175a, 0x0c0c0409, 0x0c094b09,
-    0x099acd04, 0x27360982, 0x2f090d25, 0x0117482d, 0x344b6b40, 0x175b5b17,
-    0x0c093734, 0x1a832726, 0x04cd9a22, 0x0c262984, 0x182f0904, 0x7f832e47,
-    0x00000822, 0x0827dc18, 0x26052553, 0x0033002b, 0x453f003b, 0x3e25082d,
-    0x011e3701, 0x25818227, 0x27012e37, 0x0e821707, 0x010e352b, 0x34263707,
-    0x14062737, 0x83138317, 0x8227201b, 0x82152013, 0x0648531b, 0x07012f2b,
-    0x03eb0117, 0x84646484, 0x35058403, 0x153b23d3, 0x2f4e1b25, 0x3b1525c2,
-    0x304e2f23, 0x250e0e25, 0x148bc013, 0x304f2e24, 0x16821313, 0x40405d24,
-    0x3687c040, 0x45383c82, 0x161c2204, 0x58052e25, 0x04221c16, 0xf92e052c,
-    0x20442015, 0x7c5a2a15, 0x2b26178b, 0x2a4b2d05, 0x1a832a5a, 0x6b6b4224,
-    0x5f47006b, 0x00032c0a, 0x000f0006, 0x23153700, 0x18173735, 0x3407d882,
-    0xabeb3634, 0xeaea75c0, 0x52363629, 0xaba03636, 0x2ac0f5ab, 0x210a8301,
-    0xe37e3652, 0x0007280d, 0x000d000a, 0x851f0016, 0x23172941, 0x17133315,
-    0x33073723, 0x5c08526f, 0xeb2b085e, 0x555580ab, 0x75ea7540, 0x854c5229,
-    0x16292657, 0x1e2d1e1e, 0x275e821e, 0x7501552b, 0x55436ec0, 0x2a206386,
-    0x3806345d, 0x00070000, 0x01f0ff00, 0x009001eb, 0x0042003b, 0x0052004b,
-    0x00620059, 0x226d8269, 0x42013e17, 0x134308fd, 0x011e2c08, 0x16323717,
-    0x27230614, 0x6c07010e, 0x06280621, 0x0e072722, 0x3f012e01, 0x27280382,
-    0x34262207, 0x37361736, 0x37321f83, 0x26371732, 0x36170722, 0x012e3717,
-    0x17160727, 0x54830706, 0x2f820720, 0x37321626, 0x07270627, 0x26304e83,
-    0x23052b2b, 0x0505181d, 0x14051010, 0x141f4a1f, 0x05290883, 0x05231d18,
-    0x0c0c092b, 0x371c9b09, 0x230f059f, 0x7f041914, 0x171e090a, 0x091e1734,
-    0x19044049, 0x050f2314, 0xd53b1695, 0x153c2502, 0x09110825, 0x0d260805,
-    0x0508260d, 0x25081109, 0x02253c15, 0x9a0c120c, 0x1407351a, 0x2b0f360d,
-    0x39032f1a, 0x03390a0a, 0x2b1a0332, 0x300d360f, 0x00201493, 0x0e4f4c18,
-    0x2b001d2d, 0x33002f00, 0x3f003900, 0x18130000, 0x280d5aac, 0x15330527,
-    0x1614010e, 0x05826717, 0x15333724, 0x03821523, 0x314f3520, 0x20098205,
-    0x20038225, 0x05394f27, 0x012e1524, 0xb3183634, 0xfe2a0a7f, 0x231d96aa,
-    0x40961d23, 0x0382c040, 0xc02c0b84, 0x40011616, 0x0a801616, 0x2a0a0c0c,
-    0x01200482, 0x0f0a4d18, 0x2d2b0125, 0x823c2d08, 0xaa2b2203, 0x8502822b,
-    0x56282b0c, 0x06505656, 0x06131813, 0x06834a4a, 0x23088f44, 0x00960180,
-    0x7009eb5d, 0x15230fcd, 0x82073533, 0x82032003, 0x0bc97003, 0x0082aa20,
-    0x2a0daf69, 0x805656aa, 0x00015656, 0x5d005656, 0xc022055b, 0x475b2b01,
-    0x1300250c, 0x15213521, 0x05240386, 0x35233533, 0x07205382, 0x40240782,
-    0xd5fe2b01, 0x55210388, 0x2500842b, 0x802b0001, 0x0a82802a, 0x822bab21,
-    0x07734e08, 0x1601d622, 0x2520ab89, 0x2707f447, 0x21333634, 0x05151632,
-    0x17204b82, 0x8e190386, 0xfc4b074f, 0x829c8407, 0x1295249f, 0x63121818,
-    0x56200605, 0x00270082, 0xff000008, 0x18c001c0, 0x2b08ff82, 0x001f001b,
-    0x00270023, 0x1700002b, 0x210a796f, 0xbf7e2103, 0x7e212006, 0x172105cf,
-    0x05e25115, 0x07860520, 0x2b2b9525, 0x822a2a56, 0x18d520bb, 0x200ad558,
-    0x21c18212, 0x0482d6fe, 0xd2851520, 0xb14cab20, 0x0001240a, 0x83551812,
-    0x5f802000, 0x02210519, 0x075f5d00, 0x1c000f22, 0x2109e94f, 0xe04f2123,
-    0x37132405, 0x5b270723, 0x172106a9, 0x29638a6b, 0x203540fc, 0x2a40b520,
-    0x745f3026, 0xebfe280d, 0x2a6060aa, 0x82808080, 0x18052056, 0x20082f9c,
-    0x0ae95e0c, 0x07013723, 0x395d8227, 0x3634013d, 0x3717013f, 0x1e330717,
-    0x14011d01, 0x23352707, 0x07273327, 0x1d823315, 0x546d0620, 0x087e4d05,
-    0x011b2b3e, 0xfe2b1b7a, 0x151812db, 0x52525e10, 0x1272371e, 0x84650518,
-    0x3b370b2b, 0x2601d6fb, 0x2c0d1b63, 0x86fe1b50, 0x13182b1c, 0x031810d5,
-    0x822c8355, 0x0bd522fe, 0x212e8209, 0x24636237, 0x82032010, 0x01ea25a3,
-    0x00a001eb, 0x1f23ff83, 0x83130000, 0x7723209f, 0x272805f7, 0x01373611,
-    0x21272111, 0x82052147, 0x273336b7, 0x9a011b0b, 0xaa10401b, 0x0118126b,
-    0xa1010901, 0x012be7fe, 0x080b8344, 0x280c0f23, 0xfafa99fe, 0xfe1b8501,
-    0x2b401b66, 0x0112182b, 0xfe0b1000, 0x2b0001e5, 0x00ff1219, 0x2805160d,
-    0x074f42fb, 0x6b01eb31, 0x0c000300, 0x2e001500, 0x33250000, 0x6f132327,
-    0xa76f079e, 0x17012808, 0x06142315, 0x86352622, 0x33352205, 0x2f948227,
-    0x01351733, 0x2c477340, 0x13130d35, 0xe813131a, 0x2705c74c, 0x366b0e01,
-    0x75263426, 0x2b290382, 0x162b84af, 0xfe55ebea, 0x821f83f5, 0x27028422,
-    0x96803601, 0x1a26261a, 0x56260383, 0x81803e68, 0x00820097, 0x2e08fb85,
-    0x00ab0196, 0x000a0006, 0x3700000e, 0x17372335, 0x35071523, 0x21011d21,
-    0x55c02115, 0xd5559595, 0xd6fe2a01, 0x80952a01, 0x55809696, 0x182b2b2b,
-    0x280893ae, 0x008001c0, 0x001a000f, 0x11354228, 0x37270123, 0x05064b23,
-    0x35271725, 0x82233523, 0x054342b8, 0x2f0b4142, 0x2b2b2901, 0x20202a25,
-    0x2015602a, 0x20402020, 0x220d4742, 0x824000ff, 0x40802200, 0x241a8240,
-    0x20604040, 0x22af8620, 0x82eb01e1, 0x0d2808af, 0x2e002000, 0x0e010000,
-    0x3e330701, 0x011e3701, 0x012e3317, 0x35013e07, 0x06222634, 0x17161415,
-    0x37170715, 0x03273717, 0x012a208c, 0x01544000, 0x2d3d012a, 0x06823d2d,
-    0x0f2b543e, 0x1e2e1e11, 0x1e490f11, 0x491e4040, 0x03846415, 0x526c022b,
-    0x2b026c52, 0x55018403, 0x82053874, 0x54402d2c, 0x111907c5, 0x171e1e17,
-    0x46071a10, 0x01242c85, 0x64840362, 0x2305ff4c, 0x06008464, 0x310a5f48,
-    0x00230017, 0x003b002f, 0x13000047, 0x0622012e, 0xf982011d, 0x17233522,
-    0x33279383, 0x3d013e35, 0x82072301, 0x861520ae, 0x8425200b, 0x150721b1,
-    0x27202483, 0x2f8fbc83, 0x2335373b, 0x120c016b, 0x2a802b0c, 0x2a131855,
-    0xab801813, 0x2b131701, 0x01801713, 0x231682ab, 0xd6802a01, 0x2b211d84,
-    0x35158456, 0x95018001, 0x090c0c09, 0xd5808055, 0x5a072015, 0x1620065a,
-    0x09842a2a, 0x15200725, 0x8655ab2a, 0x8907871c, 0x08bb4b24, 0x96019629,
-    0x1d001100, 0x49010000, 0x92830699, 0xb0821720, 0x27353722, 0x3206937b,
-    0x23152335, 0x12198001, 0x151912aa, 0xea40aa40, 0x82162aaa, 0x2b012a01,
-    0x18181240, 0x80804012, 0x20038440, 0x2100822a, 0x1b410700, 0x00083108,
-    0x001e0015, 0x0036002a, 0x0048003f, 0x012e3700, 0x20059653, 0x05ff4937,
-    0x17161425, 0x43013e33, 0x132008f1, 0x2105b84d, 0x2782013e, 0x0b3ec618,
-    0x765f3720, 0x223d8508, 0x65ab2634, 0x962506a4, 0x0e400e12, 0x20048412,
-    0x05e8658b, 0x61493d20, 0x5164260a, 0x6d02026d, 0x20058451, 0x201e8524,
-    0x05067838, 0x0d85cb20, 0x0d847820, 0x12010124, 0x065012a8, 0x492b2005,
-    0xfe210ad9, 0x823b8758, 0x86e92041, 0x856a2070, 0x00002128, 0x092f5518,
-    0x0953a618, 0x11130024, 0x8c571133, 0x35332605, 0x35331505, 0x22038217,
-    0x8215802b, 0xebfe2101, 0x01300482, 0x01d6fe55, 0xc06a6a2a, 0xaaaa80c0,
-    0x00555555, 0x25057f41, 0xd6010000, 0x51828001, 0x000b2708, 0x1b331300,
-    0x010b3301, 0x33371733, 0x8b4a2b07, 0x75d54a8b, 0x40353540, 0xff800175,
-    0xfe000100, 0x62800180, 0xcb4cd762, 0xeb280809, 0x17009601, 0x00003300,
-    0x0f141625, 0x2b010e01, 0x2f262201, 0x3f342601, 0x3b013e01, 0x17163201,
-    0x012f3507, 0x17150723, 0x33290282, 0x1f35013f, 0x35373302, 0x2d028227,
-    0x01010f23, 0x630606e5, 0xba0b1406, 0x0782140b, 0x822c0a88, 0x03220437,
-    0x22033535, 0x36013704, 0x362a0a87, 0x091609d4, 0x0b0b0aac, 0x0887ac0a,
-    0x6702c029, 0x64050202, 0x83020564, 0x440b8908, 0x9b830863, 0x9b821b20,
-    0x9d824720, 0x33023f25, 0x82071517, 0x2f232902, 0x010f1502, 0x37352723,
-    0x33230282, 0x9537011f, 0x011f36b7, 0x23272627, 0x06010f06, 0x16011f14,
-    0x3f363317, 0x01343601, 0x20908a00, 0x95a68901, 0x523a29c7, 0x1498140a,
-    0x0404520a, 0xb1970887, 0xdb901220, 0x108ab029, 0x8a100101, 0x87081008,
-    0x06cb7c08, 0x9601d322, 0x3a250982, 0x013f0000, 0x82988227, 0x012f219f,
-    0x2b28a583, 0x012f2201, 0x06072726, 0x3f260582, 0x37342601, 0xb1822627,
-    0x83011f21, 0x013b22b7, 0x222a8232, 0x84363717, 0x14163230, 0xca6b6bd5,
-    0x2b05072d, 0x15350904, 0x0802080f, 0x2a038256, 0x09351113, 0x07052b04,
-    0x9901012d, 0x40803c1a, 0x05235540, 0x03074a09, 0x38060f15, 0x08380909,
-    0x0703150d, 0x2305094a, 0x97071c07, 0x08634218, 0x0100022b, 0x001b0075,
-    0x1300001e, 0x22b78222, 0x8214011d, 0x8232208f, 0x013d22a5, 0x83b58234,
-    0x30068213, 0x8007011f, 0x0c680606, 0x0c06e80c, 0x0c0ce806, 0x82068268,
-    0x0668310d, 0x017171fd, 0x073c0374, 0x070d850d, 0x84040484, 0x3c2a0884,
-    0x063c0303, 0x0b033c06, 0x67834340, 0x04830620, 0x01eb0126, 0x00080040,
-    0x2505ab57, 0x003d0035, 0xbe430100, 0x08088308, 0x3632172a, 0x34272637,
-    0x22332637, 0x06151607, 0x33011e07, 0x2634013e, 0x07062207, 0x2e352115,
-    0x010e0701, 0x35331507, 0x17162536, 0x2e3a0682, 0x1b000101, 0x24362424,
-    0x1e179b24, 0x170e171e, 0x01011708, 0x0a0cf40a, 0x0a820101, 0x13820e20,
-    0x58249737, 0x04000104, 0x301dc058, 0x01014002, 0x40010e46, 0x40013002,
-    0x35338301, 0x012d2436, 0x011e2d1e, 0x251c0b0d, 0x05050706, 0x1c250607,
-    0x12830d0b, 0x20207c34, 0x20202a2a, 0x15190514, 0x121a2a23, 0x232a1a12,
-    0xbe831915, 0x04830320, 0x01ea0123, 0x3ec18261, 0x003f002e, 0x2f262500,
-    0x36342601, 0x36323337, 0x1f163316, 0x0f011e01, 0x22230601, 0x42011f37,
-    0x6e4305ba, 0x36670805, 0x16021f33, 0x27373217, 0x0f15011f, 0x011d0602,
-    0x3f260607, 0x01373601, 0x584b0c75, 0x37030204, 0x01071522, 0x02980603,
-    0x04560407, 0x064c0407, 0x5c020316, 0xf1090e02, 0x07740203, 0x2a260a04,
-    0x0405080a, 0x42012499, 0x5b020344, 0xb3020205, 0x11730508, 0x0405715f,
-    0x02010102, 0x03b60602, 0x0224030b, 0x8204010d, 0x02392401, 0x82350202,
-    0x022b3807, 0x0c360601, 0x2fab0201, 0x193d0101, 0x15040101, 0x0303021d,
-    0x4e0207b0, 0x952a0823, 0x18000e00, 0x00002000, 0xb4822e01, 0x7a072721,
-    0x3e3005b7, 0x23071701, 0x35333727, 0x17331533, 0x21352115, 0x01210882,
-    0x088b823f, 0x1a5f482a, 0x141a4438, 0x0808e323, 0x156b157f, 0x2b152b15,
-    0x0156fe2a, 0x42016b15, 0x13020808, 0x12620758, 0x3c3d0615, 0x2b4e0e03,
-    0x2b281a82, 0x962a2aeb, 0x00040096, 0x01200082, 0x2005db48, 0x276f8207,
-    0x25000015, 0x23113311, 0x03390382, 0x23350717, 0x27053335, 0x15331537,
-    0x2c150123, 0x56962c6c, 0x01404056, 0x24058340, 0xfe560115, 0x250384aa,
-    0x40555500, 0x04836a2a, 0x2208274c, 0x82ab01ab, 0x204f86c5, 0x06c94b37,
-    0x27072522, 0x0327b483, 0x15231737, 0x92553523, 0x2bc0233f, 0x62842b6b,
-    0x82c0fe21, 0x8240204e, 0x081f594e, 0x59006b21, 0xf882065f, 0x15239783,
-    0x82033727, 0x822120a3, 0x80c02303, 0x02825555, 0x012a9526, 0x40d52a56,
-    0x55233883, 0x8700ff55, 0x08cf445e, 0x9601ab22, 0x01224387, 0x8b833315,
-    0x17372323, 0x209b8225, 0x21038211, 0x38901501, 0x87000121, 0xaafe2257,
-    0x062f462a, 0x24053f49, 0x00260017, 0x0553562a, 0x11150636, 0x21331614,
-    0x11353632, 0x07232634, 0x27231733, 0x37230723, 0x072b8318, 0x152b0e83,
-    0x33153723, 0x33010f35, 0x5a18136b, 0x19390590, 0x2620f012, 0x061e0720,
-    0x0e4b9520, 0x13080b12, 0x20191220, 0x05ab2b20, 0x0d4f490b, 0x15808032,
-    0x0e128015, 0x04100a15, 0x602b2b2d, 0x14171515, 0xff238783, 0x82d801e8,
-    0x002c36cb, 0x00410034, 0x00530049, 0x010e0100, 0x011f1615, 0x012f0616,
-    0x850b822e, 0x07262309, 0x14860622, 0x22272625, 0x82140706, 0x27372c0c,
-    0x3217012e, 0x012f011f, 0x82073626, 0x011e2307, 0x0b822206, 0x0c833420,
-    0x27022e08, 0x07053626, 0x3e011e17, 0x01272602, 0x01150f06, 0x08010603,
-    0x220b0902, 0x09090116, 0x0c030703, 0x15100d0b, 0x040c0e01, 0x070d0307,
-    0x080a8208, 0xf30a0c39, 0x13056c62, 0x41060f06, 0x0b051355, 0x6706093a,
-    0x110d0106, 0x0c066707, 0x2d030531, 0x07109254, 0x125b2b01, 0x1822200d,
-    0x010c0808, 0x10150195, 0x040e0708, 0x820c0203, 0x0b1d31af, 0x0205050b,
-    0x16010909, 0x04090b22, 0x03060106, 0x0b2f1e82, 0x626c0513, 0x580c0bf3,
-    0x2d54920d, 0x823a120b, 0x0d112150, 0x47300484, 0x41541402, 0x5b511f09,
-    0x08080c12, 0x0d202218, 0x2b08d741, 0x009601d6, 0x0042002c, 0x01000058,
-    0x1639e682, 0x07173717, 0x15331716, 0x17070623, 0x07062707, 0x3632011e,
-    0x07272637, 0x30048227, 0x36333523, 0x17372737, 0x012e3736, 0x14010e07,
-    0x84098216, 0x8518820e, 0x86252022, 0x863f8235, 0x013e3d49, 0x00012634,
-    0x101d4628, 0x1616170c, 0x16160413, 0x16161304, 0x1c100c17, 0x1c475047,
-    0xd0351491, 0x16171716, 0x150d090b, 0x14040d0f, 0x0f0d0414, 0x01090d15,
-    0x20108e45, 0x3424820b, 0x181b9501, 0x260e100d, 0x2a29230c, 0x260c2329,
-    0x180d100e, 0x3412921b, 0x4a431b52, 0x0b091b43, 0x19092507, 0x191e2a1e,
-    0x0b072509, 0x830e8e09, 0x06e34622, 0x9601d630, 0x25001c00, 0x22010000,
-    0x0f36010f, 0x4a192702, 0x362507ae, 0x3f012f34, 0x20058302, 0x21fb8426,
-    0xd8823632, 0x09ab3c08, 0x0901cb06, 0x0706452f, 0x2b060c11, 0x060d1106,
-    0xcb4c4507, 0x07150606, 0x1e1e1728, 0x011e1e2d, 0x02cb0695, 0x0746410c,
-    0x06120c06, 0x110d072b, 0x37450607, 0x071106cb, 0x52ea0615, 0x6c82082d,
-    0xff000025, 0x824001ea, 0x1538087b, 0x22170000, 0x3e013d26, 0x36353701,
-    0x17163337, 0x17011e15, 0x23061415, 0x010c09d5, 0x09011119, 0x11010916,
-    0x090c0119, 0xd5090c15, 0x60053021, 0x09010109, 0x21300560, 0x00201f82,
-    0x0223c385, 0x49920100, 0x013c054f, 0x37270117, 0x27073717, 0x01011707,
-    0xb4fe5aa6, 0xf25a5ab4, 0x781e5af2, 0x91011001, 0xb6230e85, 0x821d59f2,
-    0x050f420e, 0x01000022, 0x2205a343, 0x82170013, 0xd1ce180b, 0x11212c0f,
-    0x35230321, 0xfe950133, 0x431912d6, 0xfe26078c, 0x2a2a01d6, 0x7b43d6d6,
-    0xabfe260d, 0x00ff2a01, 0x828f85d6, 0x00962e53, 0x00210003, 0x35210500,
-    0x010e2721, 0x4d448207, 0x152b0524, 0x2e231533, 0x17010e01, 0x823b011e,
-    0x263421f2, 0x4f825b83, 0x0c27173c, 0x2a40400c, 0x130c4040, 0x11113f42,
-    0xd617270c, 0x15303024, 0x1601d62a, 0x16826b14, 0x1f6b2a2c, 0x1f422512,
-    0x30011714, 0xc74b3049, 0x0003230c, 0x6784001b, 0x0622032c, 0x3717010f,
-    0x14171636, 0x0a821617, 0x62830620, 0x012e1122, 0x80346185, 0x3e0b2314,
-    0x11072c2b, 0x03040106, 0x01096707, 0x01b70d11, 0x01356082, 0x5d111280,
-    0x03051d2a, 0x0a010108, 0x0a660814, 0x00011218, 0x86628324, 0x019622cb,
-    0x20cb829b, 0x2063850f, 0x84b3822f, 0x171622be, 0x39578507, 0x13183b40,
-    0x13313016, 0x3b160b0a, 0xdb2b2a15, 0x1232300b, 0x17193015, 0x3f86db0a,
-    0x9601ab38, 0x28002400, 0x32010000, 0x010e1716, 0x2315010f, 0x012e2735,
-    0x0f823e27, 0x17071424, 0x09842637, 0x83061721, 0x3634250a, 0x21152101,
-    0x18329282, 0x0b0d0101, 0x0b27d627, 0x1801010d, 0x3c0a1824, 0x0884110b,
-    0x01013108, 0x093b0b11, 0x01fdfe18, 0x01d6fe2a, 0x0d121980, 0x67880514,
-    0x14058867, 0x1919120d, 0x4f410b22, 0x1812170c, 0x0c171218, 0x220b414f,
-    0x2a95fe19, 0x230e2b41, 0x37000017, 0x84826283, 0x03882320, 0x33153326,
-    0x6b353335, 0x00235384, 0x822a2b2b, 0xd62a2702, 0x012a152a, 0x008440aa,
-    0xd5d58023, 0x20478e80, 0x050f411c, 0xd2832720, 0xcd840720, 0x35263722,
-    0x1726d283, 0x17160714, 0x1c411707, 0x22272c05, 0x40540105, 0x01015440,
-    0x830a3340, 0x0a0135c8, 0x1e61151c, 0x2dfb2a15, 0x013c2e38, 0x292e3c01,
-    0x0f0c1666, 0x0f22b183, 0x19820b0c, 0x2706bf46, 0x00ab01c0, 0x001e0015,
-    0x21a1c118, 0x3733072d, 0x33173717, 0x07272315, 0x18230727, 0x2e18fd83,
-    0x14472e8c, 0x42343835, 0x20104f27, 0x18800142, 0x2c15a3c1, 0x449588df,
-    0x64262137, 0x00003d7b, 0x21ef8204, 0x87870100, 0x3400272c, 0x23010000,
-    0x0622012e, 0x047b2307, 0x07dc5b0e, 0x89860320, 0x85252121, 0x05a6648b,
-    0x42329199, 0x274f1020, 0x01d6fe42, 0x3538342a, 0x2a2e4714, 0x98972ad6,
-    0x3d00ff2e, 0x5526647b, 0x95443776, 0x1515b488, 0x02219a83, 0x07ef5700,
-    0x2100182e, 0x2e050000, 0x23013d01, 0x013d2622, 0x3305b053, 0x010e1517,
-    0x0607012b, 0x11232707, 0x2137013e, 0x00012115, 0x2105a062, 0xa2770112,
-    0x4f573606, 0x2bcb0807, 0x01121801, 0x2babfe55, 0x40090c01, 0x12d61218,
-    0x2a048418, 0xab01064f, 0x18120001, 0x82002b01, 0x88042000, 0x8208206b,
-    0x0025256b, 0x37000029, 0x13205687, 0x03247897, 0x07353315, 0x40200382,
-    0xc0206287, 0x4b247f92, 0x80abd5d5, 0xfe216885, 0x27829055, 0x2b2b2b01,
-    0x002b2b55, 0x2c056353, 0x00ab01eb, 0x001f0018, 0x002c0028, 0x26f19a30,
-    0x33371537, 0x88152135, 0x561720f8, 0x00410612, 0x420a2514, 0x55d5fe69,
-    0x8020a287, 0x0a418e82, 0x41802512, 0x2bd6d641, 0x8020a685, 0x4205c677,
-    0xab2f061f, 0x41008001, 0x49004500, 0x00004d00, 0x7e2e3501, 0x8156056e,
-    0x15232105, 0x43050f52, 0x2152055c, 0x15332c05, 0x17160706, 0x16323315,
-    0x44220614, 0xfb640547, 0x35273c05, 0x35273436, 0x3735010f, 0x37350735,
-    0x15373527, 0x0c01ab01, 0x1540d509, 0x822b1515, 0x836a2002, 0xab153a04,
-    0x0c010210, 0x0808050e, 0x090a070d, 0x170c0203, 0x0e011610, 0xd50d0c0c,
-    0x25008416, 0x09154001, 0x2d82010c, 0x2b2bc024, 0x0082552b, 0x25080682,
-    0x120663c0, 0x071a070f, 0x030b080b, 0x13050a06, 0x140d1116, 0x1e070204,
-    0x16a36408, 0x1621151f, 0x1e0c161e, 0x57611e16, 0x00812309, 0x0e82000e,
-    0x36151333, 0x17161716, 0x27211523, 0x0e07032e, 0x1e150701, 0x04551801,
-    0xd5273707, 0x110d3028, 0x3801f010, 0x2d211010, 0x30247d38, 0x24300101,
-    0x07860001, 0x012b802d, 0x19090504, 0x29211f2b, 0x82ab0314, 0x85402019,
-    0x23068318, 0x00010000, 0x012b0082, 0x00800182, 0x2500002c, 0x51352335,
-    0xa3410522, 0x08638205, 0x35013e5c, 0x2e272634, 0x0e222301, 0x16141501,
-    0x16373233, 0x22061415, 0x01013d26, 0x1201b582, 0x0e12121b, 0x33014040,
-    0x16322726, 0x080f0715, 0x180c130b, 0x070d1413, 0xe0213220, 0x120e6020,
-    0x40121c12, 0x34278420, 0x27330201, 0x06102e19, 0x0c140b07, 0x0f111812,
-    0x22221911, 0x7f508419, 0x01962b08, 0x00030080, 0x1300000b, 0x01831521,
-    0x82112321, 0x05ff4401, 0x2a802a35, 0x2b800180, 0xebfe2b15, 0x00001501,
-    0xff000005, 0x82de01e2, 0x000d282f, 0x00210016, 0x823c002b, 0x22262db7,
-    0x1e171406, 0x37173701, 0x07263627, 0x34259e82, 0x14163236, 0x21b88307,
-    0xc5821527, 0x05842620, 0x37343525, 0x5137012e, 0x332605e4, 0x1732013e,
-    0x1082013e, 0x8f013e08, 0x1c394d1e, 0x421e4019, 0x0812421e, 0x202b1036,
-    0x97202b20, 0x40330a16, 0x49600201, 0x3a019e0d, 0x42340c30, 0x026049aa,
-    0x023f5102, 0x1b393313, 0x02031411, 0x3a1cb960, 0x08171e4c, 0x23358212,
-    0x1051411e, 0x27083382, 0x164d2b20, 0x1c2b091c, 0x01302440, 0x1b40f808,
-    0x1e040a2a, 0x9d2c081c, 0x21243001, 0x1615062f, 0x121d080c, 0x00003024,
-    0x2206c369, 0x829601e0, 0x00093409, 0x00270020, 0x13070100, 0x23071321,
-    0x07173727, 0x84352315, 0x82072097, 0x3e2325a8, 0x011e3301, 0x51080982,
-    0x3523010f, 0x33373507, 0x55e00001, 0x75551601, 0xaeae43d6, 0x42057243,
-    0x01140105, 0x21010d0c, 0x26192102, 0x3c040111, 0x29224204, 0x95010447,
-    0x01f9fea3, 0x7fcddd07, 0x181b727f, 0x13154704, 0x0f010106, 0x021e180b,
-    0x3e1f0926, 0x0d831b02, 0x8782191c, 0x03820c20, 0xeb010024, 0xbb586801,
-    0x0515580c, 0x4c002c27, 0x00005500, 0x06175837, 0x07823520, 0x03821720,
-    0x2720078f, 0x07221382, 0xc4711632, 0x17252105, 0x2731a982, 0x2223010e,
-    0x26012f26, 0x3621013f, 0x2726013f, 0x26058226, 0x17011e17, 0x56051636,
-    0x2f240770, 0x303b3030, 0x3a200082, 0x09850382, 0x02820e82, 0x056d3708,
-    0x070b0808, 0x07780107, 0x16260a04, 0x2c537e20, 0x0e051748, 0x3b010103,
-    0x0a111011, 0x07060102, 0x100c0605, 0xfe1e0e02, 0x0d0d0b9a, 0xf00e0e16,
-    0x6b2f2f2f, 0x03880d2f, 0xbb2ea624, 0x43830b07, 0x045a2008, 0x010e1307,
-    0x2421494b, 0x0724200a, 0x0d070501, 0x09190b11, 0x18090506, 0x8503040e,
-    0x820e150e, 0x04002d02, 0xecff0000, 0x96017f01, 0x18000f00, 0x2005734a,
-    0x054c4613, 0x32013b27, 0x2e113736, 0xc5081901, 0x82072009, 0x080754e8,
-    0x1812aa24, 0x04821218, 0x1801012e, 0x120e5512, 0x12121c12, 0x56aaaa47,
-    0x24281582, 0x95011818, 0xacfe1218, 0x12360b82, 0x18125401, 0x1b11014a,
-    0x111b1212, 0x0194d55e, 0x19192417, 0xdb431724, 0x01e53905, 0x009b0186,
-    0x00070003, 0x17070100, 0x37170537, 0x85000107, 0xf6fe8585, 0x01290482,
-    0x5050e09b, 0x50bbbb1b, 0x2b218200, 0x01e0ff00, 0x006001eb, 0x002a0021,
-    0x09a3db18, 0x26373227, 0x06373435, 0x05ea4723, 0x17011e27, 0x33360714,
-    0x09184c32, 0x34363224, 0x1c741726, 0x0001300a, 0x1d1d7d51, 0x0b0c517d,
-    0x0d0d0502, 0x56013d2d, 0x02260592, 0x21261715, 0x18820708, 0x3305e550,
-    0x2b404065, 0x60014040, 0x47475801, 0x0a010158, 0x0412120a, 0x05822985,
-    0x080a0929, 0x47101015, 0x50015f58, 0x742005dc, 0x2b212b83, 0x24a38a40,
-    0x0025001c, 0x22d18231, 0x8207010e, 0x83a38292, 0x492220a2, 0x07210651,
-    0x2d9ea416, 0x3d0c0b02, 0x641b1b64, 0x081b647a, 0x9b9a1315, 0x010b162b,
-    0x3f36363f, 0x050f363f, 0x3596930c, 0x00000600, 0xeb01c0ff, 0x08006001,
-    0x20001400, 0x28002400, 0x0f522c00, 0x083c410b, 0x03010e22, 0x3726b284,
-    0x2e37013e, 0x0c5b0301, 0x07fe510a, 0x32411b20, 0x3d012e08, 0x1e7e4f2d,
-    0x3264b92a, 0x7e1e1449, 0x070c5bba, 0x41000121, 0xaa200615, 0x82082f41,
-    0x010a2e32, 0x50634956, 0x314a1325, 0x8cfe5649, 0x2000832b, 0x20979800,
-    0x65c7181e, 0x05934a0c, 0x011e0722, 0x07279485, 0x2317010e, 0x86373315,
-    0x8a978803, 0x296d268b, 0x3120519e, 0x2805840f, 0x552b2b6d, 0x2b562a2a,
-    0x2097882b, 0x268a8a61, 0x25364f9f, 0x84203010, 0x86f52005, 0x07974495,
-    0x9601ab2a, 0x10000d00, 0x27002300, 0x0e4b4718, 0x17072727, 0x16320723,
-    0x05984417, 0x2634372a, 0x23150622, 0x3317013e, 0x0d1d4718, 0x7616802b,
-    0x241b1576, 0x032a0301, 0x28038220, 0x20121c12, 0x200b2401, 0x0a435d20,
-    0x20800034, 0x1c242b75, 0x24191b1c, 0x120e1517, 0x241c0e12, 0x461820a0,
-    0x29270a33, 0x35370000, 0x823b3634, 0x011e2c5b, 0x0614011d, 0x3315012b,
-    0x82151632, 0x250b8369, 0x23352622, 0x1f833335, 0x2223352b, 0x12194026,
-    0x12802a80, 0x27068219, 0x950c0916, 0x56090c95, 0x16200685, 0x952d1482,
-    0x2a1812d6, 0xab121801, 0x0c2b1812, 0x05795f09, 0x2b0c0924, 0x7b460018,
-    0x01d62208, 0x27eb827d, 0x0100002f, 0x010f0626, 0x072e6182, 0x2e27010e,
-    0x1e372701, 0x013e3701, 0x6982013f, 0x172c0782, 0x0717011e, 0x2717012e,
-    0x17072707, 0x0805e859, 0x12090146, 0x3c06021a, 0x34040940, 0x0a221524,
-    0x111e0620, 0x0901100d, 0x04054440, 0x22142534, 0x1404200b, 0x3c3c1ebf,
-    0x1f3d3d1f, 0x3c1e3c3c, 0x16014f01, 0x6c2b3d12, 0x02022c24, 0x11201115,
-    0x14040610, 0x412b680d, 0x0c220f86, 0x2c82b110, 0x823d1e21, 0x21028229,
-    0x9f820500, 0xc001002d, 0x08005601, 0x10000c00, 0x82001400, 0xedc518b2,
-    0x35252410, 0x82071533, 0x6b012803, 0x952bd52b, 0x82abeb96, 0x15012c00,
-    0x152b2b2b, 0x55ebc0c0, 0x822b4055, 0x6b6b240b, 0x182a2a55, 0x2a0a4f5d,
-    0x001c000b, 0x002e0025, 0x184a0041, 0x230d6144, 0x07010e17, 0x3e23e582,
-    0x47163301, 0xd8450519, 0x78232008, 0x3231086e, 0x013e011f, 0x0e011e17,
-    0x2f262701, 0x37012e01, 0x45401836, 0x00012708, 0x0202785b, 0x05855b78,
-    0x02604930, 0x171b1e01, 0x3041203a, 0x02011e1b, 0x2f5d1e60, 0x854d2005,
-    0x04393306, 0x16094a05, 0x0e0d110b, 0x0516111f, 0x0307084a, 0x1985e606,
-    0x0c3e4418, 0x60022833, 0x18412749, 0x2a011615, 0x49274118, 0x120c2960,
-    0x3102880c, 0x071f013f, 0x1f070504, 0x09070d22, 0x0f041e18, 0xd97d0d09,
-    0x4b611807, 0x87eb8d09, 0x2e3721df, 0x0e82e884, 0x23012e23, 0x052d4d06,
-    0xda591720, 0x87332007, 0x22172208, 0x23e0820f, 0x1e010e07, 0x3f20e582,
-    0x2722f682, 0xd46d0726, 0x96eb4008, 0x38002f22, 0x2c23d741, 0x16011f16,
-    0x010e1617, 0x36262726, 0x41038337, 0xce4109c5, 0x08f34108, 0x331dd741,
-    0x1d070d74, 0x0d060a18, 0x04072022, 0x031e0704, 0x5a040906, 0x2005c941,
-    0x20068549, 0x22d741cd, 0x0d012733, 0x11160549, 0x110d0d20, 0x4b09160b,
-    0x01040f09, 0x05e74102, 0xee414020, 0x43088208, 0xff3106b3, 0x016b01ea,
-    0x001f0096, 0x05000023, 0x27012e27, 0x05214526, 0x78692720, 0x07163e06,
-    0x010f010e, 0x33150630, 0x37032634, 0x4b011733, 0x05120d12, 0x2f261111,
-    0x03250301, 0x08038280, 0x262f0130, 0x13041111, 0xaa0a130c, 0x4216820a,
-    0x01020616, 0x40400c0f, 0x25273908, 0x6b05056b, 0x09392725, 0x0f0b4040,
-    0x0b040201, 0x3001050b, 0x68824040, 0xff000025, 0x82c201ea, 0x08200877,
-    0x3f000e00, 0x4d004600, 0x27010000, 0x33171607, 0x07273736, 0x17323617,
-    0x26220737, 0x06273727, 0x3e2b0582, 0x2e353701, 0x33363401, 0x50371716,
-    0x2182054e, 0x16323725, 0x6c070614, 0x32820616, 0x03010e24, 0x11821707,
-    0x37172f08, 0x012e3717, 0x00013735, 0x02087709, 0x770802ec, 0x1c0a5b7c,
-    0x0f735b0a, 0x5c020114, 0x0114200a, 0x0d0c0e01, 0x120f1512, 0x01015e0a,
-    0x0f821e14, 0x120a5e28, 0x0d12150f, 0x0f820e0c, 0x0a205a08, 0x1401025c,
-    0x0d016029, 0x75a9010a, 0x010d0a01, 0xcd024d01, 0x070a0a07, 0x0936f0cd,
-    0x14743609, 0x0c370b10, 0x130d0f14, 0x14026d03, 0x0d01151d, 0x14100936,
-    0x36091014, 0x1d15010d, 0x036d0214, 0x140f0d13, 0x100b370c, 0x376d0114,
-    0x04120b05, 0x70cdcd70, 0x050b1204, 0x20008200, 0x52038204, 0x1b240793,
-    0x29002500, 0x4d129552, 0x3325074b, 0x32023b35, 0x05ae4516, 0x35333725,
-    0x70950123, 0x012805e5, 0x1919122a, 0x202b20bc, 0x2a290282, 0x0c0c0956,
-    0x2b205609, 0x0daf522b, 0x2b00ff26, 0x3535802b, 0x09271a82, 0x0040200c,
-    0x82000200, 0xd6012b00, 0x0a005601, 0x00001a00, 0x08552201, 0x012e3906,
-    0x011e1505, 0x35373632, 0x010e0706, 0x26272622, 0x795a0001, 0xb4790202,
-    0xfe210483, 0x330884d1, 0x54221b15, 0x1b22545e, 0x1f2b5501, 0x202a2a20,
-    0x65902b1f, 0x65270783, 0x0d0c090e, 0x82090c0d, 0x8203205a, 0x05f75c03,
-    0x09000333, 0x00000f00, 0x3f170713, 0x15230301, 0x010f1333, 0x3bbc8217,
-    0x265536a2, 0x8a75bf78, 0x322655df, 0x8001758a, 0x6c3c8622, 0x0155d5fe,
-    0x4d3cd55e, 0x08e7a318, 0x8001d622, 0x2607c760, 0x15330701, 0x53333521,
-    0x33210659, 0x05516c01, 0x822ac021, 0x80012900, 0x80ababc0, 0x006b2a2b,
-    0xff29d784, 0x010002c0, 0x00190080, 0xd17f1825, 0x3526310a, 0x37233734,
-    0x36173717, 0x35173233, 0x11232634, 0x320abc49, 0x1919126b, 0x0702c212,
-    0x4a364ac7, 0x0a262030, 0x4912190b, 0x803505a7, 0xd6fe1219, 0x0a0b1912,
-    0x40601516, 0x02143f60, 0xfe1813c2, 0x069649eb, 0xe3820020, 0x01e7ff27,
-    0x008e01f2, 0x0533610c, 0x2606252d, 0x3f362627, 0x1e010e01, 0x88073701,
-    0x9017200c, 0x012a080d, 0x1e5523e8, 0x0b22071c, 0x4d36031b, 0x7f353023,
-    0x320c2b2d, 0x27022714, 0x29337228, 0x3b3fb34a, 0x39184710, 0xa23a3604,
-    0x2582e248, 0x55242408, 0x4e1e081d, 0x60150b40, 0x35330b2b, 0x2e0e2d80,
-    0x122e3073, 0x103c781e, 0x3fb24b47, 0x44a34011, 0x182d1842, 0x2d0c9f51,
-    0x000f0007, 0x001f0017, 0x0034002b, 0xdb682500, 0x26273d06, 0x36170722,
-    0x06071732, 0x26371714, 0x16173734, 0x06273732, 0x1e132722, 0x010e1701,
-    0x5b06a645, 0x012f07cb, 0x3a0f0fa6, 0x23230909, 0x161b234c, 0x88d51730,
-    0x171a240d, 0x462e1630, 0x027f0b89, 0x85772005, 0xd4162128, 0x01213692,
-    0x08b64641, 0x7e785b26, 0x30483001, 0xfb420282, 0x821c200e, 0x622f20ab,
-    0x13291175, 0x33153733, 0x27072335, 0x83068223, 0x1733230a, 0xfd432733,
-    0x07232405, 0x62231533, 0x1338087c, 0x20571918, 0x15302015, 0x85203015,
-    0x20121920, 0x010a0914, 0x2b0e1101, 0x22110843, 0x83804949, 0x80372e02,
-    0x042d2b2b, 0x0e150a10, 0x00152012, 0x0a874302, 0x87823320, 0x011e332d,
-    0x010e1517, 0x012e2307, 0x823e3527, 0x16142f0b, 0x1735013b, 0x3d363233,
-    0x33363401, 0x06822622, 0x012b2636, 0x22232715, 0x14011d06, 0x16322306,
-    0x3629c0a0, 0x29360101, 0x09290685, 0x80200e12, 0x12120e20, 0x8803830e,
-    0x8001210a, 0x28832188, 0x0e40df25, 0x60a0a012, 0x0b8709e5, 0x62030021,
-    0x27200c7f, 0x4b08f34b, 0x584b0540, 0x1427250a, 0x23151716, 0x2623a282,
-    0x82333527, 0x000121b1, 0x250b2161, 0x02026049, 0x05844960, 0x0a0c342c,
-    0x090b0d56, 0x0c0a560f, 0x0761ab01, 0x876d200b, 0x2f278221, 0x03110a89,
-    0x16058242, 0x8242051c, 0x00001103, 0x26061741, 0x008001cb, 0x480f000b,
-    0x032b0dcf, 0x01113311, 0x02513d3a, 0x843d5102, 0x46c32305, 0x0b878001,
-    0xfe241182, 0xfe800182, 0x08094755, 0x9601be31, 0x45002500, 0x26170000,
-    0x013f0627, 0x013e3336, 0x37363733, 0x17013f36, 0x07060716, 0x0e23010e,
-    0x06010f03, 0x010f0615, 0x26272223, 0x83123635, 0x3233251b, 0x011e1716,
-    0x22211f85, 0x08078206, 0x020f144e, 0x04b12223, 0x17020101, 0x0b010102,
-    0x08091e16, 0x03021768, 0x3d0f0d22, 0x0c121b0c, 0x05040508, 0x05030207,
-    0x61083d02, 0x05310306, 0x4b030704, 0x2a0b1d3b, 0x50100725, 0x141a1c0d,
-    0x0408040c, 0x46011104, 0x04031507, 0x0c930c01, 0x012a4382, 0x086a0f01,
-    0x4a3e1a02, 0x56820515, 0x11032408, 0x010c2525, 0x30010305, 0x011a0703,
-    0x03061933, 0x09030101, 0x145d2a36, 0x02010303, 0x13020b05, 0x4600016e,
-    0xd62007af, 0x0b28d382, 0x13000f00, 0x21001a00, 0x340ea341, 0x37272615,
-    0x27070617, 0x1537013e, 0x27052607, 0x17011e35, 0x0cec4706, 0x252f7033,
-    0x2f25547e, 0x425202c0, 0x31012372, 0x02524272, 0x0c9f4901, 0x76fafe36,
-    0x54541c06, 0x42a9061c, 0x72a0095e, 0xa0722f2f, 0x3a425e09, 0x6c063746,
-    0x7d8306ff, 0x2f00262c, 0x23130000, 0x1107010e, 0x5c4f011e, 0x23032e07,
-    0x23053311, 0x21153315, 0x14152335, 0x07ce5216, 0x37273724, 0x8d83012e,
-    0x6d80c021, 0x068705fc, 0x0001802a, 0x00ffabab, 0x01121940, 0x3005166e,
-    0x14295619, 0x6d51314e, 0x1801ab01, 0x12ebfe12, 0x27198519, 0x0001d6fe,
-    0x15802bd5, 0x12202485, 0x412b3e82, 0x342d142a, 0x6d022001, 0x42040000,
-    0x122308b7, 0x8e002200, 0x82352097, 0x05f45f91, 0x82823520, 0x010e2124,
-    0x9785011d, 0x21352525, 0x82233715, 0x27072313, 0x9787011e, 0x80151527,
-    0x0118012b, 0x267c9019, 0x3401202b, 0x8a2a142d, 0x83402098, 0x181223ba,
-    0xd28f56fe, 0x4e31eb25, 0x82562914, 0x05df4398, 0x2408b982, 0x35001500,
-    0x22250000, 0x22062726, 0x2b010e27, 0x36331501, 0x37321637, 0x35331716,
-    0x26152327, 0x15233527, 0x26048322, 0x35012b06, 0x56333523, 0x9a6905d6,
-    0x012e0805, 0x142b17ab, 0x14275c27, 0x2a2a172b, 0x5a28292d, 0x2a2d2928,
-    0x1317162a, 0x6a16156b, 0x15150b0b, 0x2b6a2b15, 0x40162a6b, 0x1b1b0d0f,
-    0x5b820f0d, 0x012e1282, 0x03546b2b, 0x0756450c, 0x5602544f, 0x00842b2a,
-    0x2a093f42, 0x001300ab, 0x005c0058, 0x82640060, 0x24948495, 0x15230706,
-    0x82908233, 0x013b2502, 0x2e350335, 0x9482a482, 0x210c6555, 0x97823732,
-    0x9c821620, 0x8205655a, 0x1068550c, 0x013e1724, 0xce823437, 0x21116855,
-    0xb982282e, 0x8a2e2821, 0x0a7a55c2, 0x0b0b1525, 0x8216156a, 0x1f7d55c9,
-    0x1c011522, 0x01210082, 0x08e2822a, 0x012a1520, 0x0c091556, 0xc02a1616,
-    0x552b2a2a, 0x064e5401, 0x2a2a2b54, 0x120663c0, 0x0819080f, 0x8b55070b,
-    0x01013805, 0x140c1116, 0x1e080105, 0x15a46507, 0x1520161e, 0x1e0d151e,
-    0x82001e15, 0x82032000, 0x01002e03, 0x005601d6, 0x00110008, 0x1300001c,
-    0x29dd8215, 0x35232737, 0x17231521, 0x0d823307, 0x0e072708, 0x011e0701,
-    0x2e373632, 0x802a2b01, 0x01802b2b, 0x2b2bab56, 0x03d52aab, 0x18010325,
-    0x03011824, 0xaa550125, 0x79822b2a, 0xaa230382, 0x5a3202aa, 0x3220051a,
-    0x04285a83, 0xe8ff0000, 0x96016b01, 0x1a205d82, 0x20059742, 0x06055e25,
-    0x82260621, 0x36332465, 0x18333537, 0x2008dacf, 0x056c4113, 0x23353322,
-    0x55531482, 0x15012b07, 0x11100b10, 0x2512100a, 0x0982110d, 0xf1822a20,
-    0x0c120c27, 0x2b2b740c, 0x200282d6, 0x05874b6b, 0x0c06672d, 0x07060b55,
-    0x0c550e0a, 0x4dab5906, 0x01270631, 0x80801655, 0x83952a16, 0x0c12232e,
-    0x436b0200, 0x00272608, 0x2500002a, 0x7d808434, 0x2b2605cf, 0x1d062201,
-    0x9a841401, 0x15010e22, 0x0b838782, 0x35013e30, 0x35253533, 0x0c400117,
-    0x12561609, 0xb9581818, 0x4f562005, 0xff220a8f, 0x90826b00, 0x012a0128,
-    0x12d51218, 0xc7181919, 0x80221084, 0x674155ab, 0xd5ff3e06, 0xab01b701,
-    0x36002c00, 0x00004000, 0x35173213, 0x16323634, 0x3336011d, 0x0614011e,
-    0x28728207, 0x1516011f, 0x0e071507, 0x318d8201, 0x3637012f, 0x3517013b,
-    0x34012e23, 0x26341736, 0x90820622, 0x013b3125, 0x83013e31, 0x072e080c,
-    0x10159b15, 0x11182419, 0x21241b15, 0x0a1b2b19, 0x15011a62, 0xa20f1802,
-    0x168c0d11, 0x61070e09, 0x2421192b, 0x15201541, 0x802b0e11, 0x0882120e,
-    0x80010124, 0xc2830c0c, 0x0c0c2808, 0x23352401, 0x31031503, 0x03031d0a,
-    0x0d160f90, 0x1509178c, 0x35230387, 0x15103f24, 0x02151e15, 0x151f1402,
-    0x83251015, 0x000221b7, 0x013c0082, 0x005601d6, 0x00130003, 0x15213700,
-    0x35363721, 0x0622012e, 0x0e171407, 0x2e210701, 0xaa36ac82, 0x04fc56fe,
-    0x18241801, 0x53410401, 0x05800105, 0xef2a5553, 0x6c830908, 0x0f080928,
-    0x5f41415f, 0x47840100, 0x6601ec2c, 0x00002800, 0x2e070601, 0x54762301,
-    0x4f162008, 0x162806a1, 0x32011e37, 0x17163736, 0x2d080483, 0x26023e37,
-    0x13168801, 0x1117270b, 0x260c0c1f, 0x01352716, 0x16120702, 0x212c0101,
-    0x2a07070a, 0x1008293a, 0x0a231610, 0x392b090a, 0x01823801, 0x14082108,
-    0x100b0e17, 0x26330114, 0x230a1413, 0x012d2117, 0x1f190301, 0x0108171d,
-    0x01021115, 0x3a583901, 0x28098741, 0x00ab01c0, 0x00120009, 0x288b8221,
-    0x011e1507, 0x37013e17, 0x08194e35, 0x95491320, 0x06de5305, 0x0001062a,
-    0x546a02c0, 0xc0026a54, 0x3c054b54, 0x22381388, 0x0b133822, 0x6c490108,
-    0x01080149, 0x5b8056ab, 0x8e17178e, 0x3724805b, 0x29028224, 0x2b1d00ff,
-    0x1d2b0b0b, 0x2f821110, 0x72111b21, 0x0e270b5b, 0x26001d00, 0x42250000,
-    0x162d0773, 0x23153315, 0x23153715, 0x23352311, 0x08038215, 0x36343523,
-    0x010e013f, 0x36342622, 0xab011632, 0x12181812, 0xc0d60be1, 0x2a2b8055,
-    0x1219202b, 0x24180160, 0x36028218, 0x12180155, 0x141812eb, 0xd62beb16,
-    0x80ebfe2b, 0x126baa80, 0x76400118, 0x002005f9, 0x2a05d343, 0x008001c0,
-    0x001f000f, 0x5500002a, 0x0f6306fd, 0x17323a09, 0x0e232607, 0x07171401,
-    0x3e35012e, 0x15161701, 0x27070614, 0x27343736, 0x2243826b, 0x832a0112,
-    0x33953505, 0x18132e26, 0x2e183024, 0x54011714, 0x14171eb7, 0x0c01182e,
-    0x360bde4c, 0x1e2b1813, 0x30010c2e, 0x152e1848, 0x54401f36, 0x1f33263b,
-    0x822e1536, 0x431320a0, 0x002d06fb, 0x01d60100, 0x001b006b, 0x002c0023,
-    0x22898235, 0x41010e15, 0x3321066f, 0x05f04c06, 0x3327342e, 0x2b263435,
-    0x33072701, 0x2e231517, 0x95510782, 0x055c1807, 0x6b250808, 0x3601221e,
-    0x05352529, 0x2401045a, 0x04012436, 0x6a121819, 0x156b8e1e, 0x1c2a0a30,
-    0x1b1b140a, 0x011b1b29, 0x05b0560a, 0x9b6b013e, 0x291f310b, 0x2f010136,
-    0x1b0b0b26, 0x0b1b2424, 0x1812400b, 0x406b2b96, 0x3004211b, 0x29222a83,
-    0x3b7c301b, 0x01ea220c, 0x21a382eb, 0x99780011, 0x01002905, 0x010e2315,
-    0x35231507, 0x2408ed49, 0x2e333507, 0x2c148301, 0x35171614, 0x3f361533,
-    0x23353301, 0x36038207, 0x1039eb01, 0x3980273b, 0x6c020146, 0x165f3d52,
-    0x43141647, 0x8254402a, 0x802a087a, 0x2b14172a, 0x2a2aaa2b, 0x22800001,
-    0x34340d32, 0x49395612, 0x3a010260, 0x1d808030, 0x36490123, 0x1f103d27,
-    0x2b22121f, 0xfb5cc02a, 0x08236107, 0x8f4e1620, 0x0fb54105, 0x17330524,
-    0xc4643337, 0x0ac16414, 0x20ebfe29, 0x26201615, 0x644b7020, 0xb3410ac1,
-    0x1912250b, 0x80494980, 0x430cbe64, 0x460806e7, 0xe801c0ff, 0x0800c001,
-    0x00002200, 0x37273325, 0x37270717, 0x17330323, 0x07173233, 0x17331523,
-    0x07012b06, 0x22232723, 0x34013d26, 0x01013b36, 0x1e356a2b, 0x351e6969,
-    0x12aa806a, 0x27070904, 0x0727bfbf, 0x82120409, 0x1812260c, 0xd5041218,
-    0x2f1d8336, 0x6b150136, 0x27d62703, 0x186b6b03, 0x1812d612, 0x96206b89,
-    0x37206b87, 0x13206b87, 0x674f6b83, 0x25698406, 0x35333727, 0x6b822723,
-    0x856b1521, 0x966b216a, 0x66835d87, 0x1f0c1127, 0x0c1fd4d4, 0x846a8a11,
-    0x6b6b2d63, 0x1ed61e0c, 0x0002000c, 0x01c0ff00, 0x17266783, 0x00001b00,
-    0x334c0713, 0x3b162505, 0x37331701, 0x4205514c, 0x15240577, 0x0412ab23,
-    0xbd88b484, 0xd6c01225, 0x85c001d6, 0x23ba86b3, 0x00d6956b, 0xe4375384,
-    0x9c018001, 0x20001700, 0x1e010000, 0x010e1501, 0x013f3627, 0x43272636,
-    0x0624054b, 0x1606010f, 0x2c08d146, 0x221e4001, 0x2810e010, 0x0504021f,
-    0x200a8908, 0x06535938, 0x3b112f2c, 0x07439923, 0x0803281e, 0x0b8a0411,
-    0xe8439e20, 0x06cb4306, 0x6b01eb2b, 0x11000800, 0x00002500, 0x07d06925,
-    0x08462720, 0x16142205, 0x05515707, 0x16323736, 0x33013e17, 0x0e17011e,
-    0x40010701, 0x01067530, 0x30750656, 0x3605264e, 0x27210db1, 0x131b0101,
-    0x0607140c, 0x1a140b15, 0x21270101, 0x822b2a95, 0x2b2a2500, 0x30493001,
-    0x41240282, 0x182d1d0b, 0x09291982, 0x01090808, 0x2d181519, 0x09c3431d,
-    0x8001c02a, 0x14000b00, 0x29001d00, 0x200d8b4c, 0xe7611817, 0x18372007,
-    0x2407f961, 0x37012e07, 0x08898306, 0x06162728, 0x6c520001, 0x36840602,
-    0x02068436, 0x31112e6c, 0x31220528, 0x10380428, 0x22312804, 0x35312805,
-    0x0101171f, 0x05841f17, 0x80012a08, 0x4b496002, 0x86040486, 0xa760494b,
-    0x3519141a, 0x35191336, 0x19351b1b, 0x19353613, 0x0e01ac14, 0x02250301,
-    0x01022602, 0x0a43510e, 0x000b3008, 0x1300000f, 0x07061615, 0x26352115,
-    0x05353736, 0xc0351716, 0x012e4b39, 0x4d296140, 0x511956fe, 0x296a5501,
-    0x40401146, 0x4013682f, 0x47104515, 0xea28088b, 0x9601ec01, 0x09000500,
-    0x002cd382, 0x07352325, 0x23271533, 0x23373313, 0x11f14b18, 0xec012508,
-    0x81406b40, 0x0eab01ab, 0x0c248023, 0xc70c1010, 0x0101100c, 0xd696d510,
-    0x000155aa, 0x012a2a2b, 0xb9fe0c10, 0x01231883, 0x66100c47, 0xeb2008ff,
-    0x35205f91, 0xeb205f95, 0x80215f82, 0x215e92ab, 0x5d9095c0, 0x18000321,
-    0x2207a34c, 0x86170003, 0x205594bb, 0x21d38417, 0x578f0001, 0x6c82d120,
-    0x8f55eb21, 0x82952057, 0x850020cc, 0x4317415b, 0x2b012a22, 0x0023618f,
-    0x82010000, 0x01003203, 0x005601eb, 0x0100000e, 0x35231521, 0x35331123,
-    0x05994c21, 0xd6fe9535, 0x012b2b2b, 0x30012b80, 0xc0962b01, 0x4040c0fe,
-    0x503025c0, 0x03290a1f, 0x00000700, 0x11211133, 0x26038201, 0xfe800140,
-    0x822a01ab, 0x01802605, 0x01d6fe55, 0x205a832a, 0x084b500c, 0x1f4e2b83,
-    0x18172005, 0x2c085988, 0x002f002b, 0x15233700, 0x35210733, 0x24078321,
-    0x23353325, 0x20038235, 0x20138205, 0x200b8605, 0x870b8227, 0x20238303,
-    0x2193846b, 0x068380fe, 0x04822a20, 0xa5832b20, 0x09840120, 0x56290482,
-    0x2baa2a2a, 0x2b2b552b, 0x24048280, 0x2b552aaa, 0x2007822a, 0x82fa82ab,
-    0x222c8303, 0xa200002b, 0x82012093, 0x8613207b, 0x208f837f, 0x065c4611,
-    0x07823720, 0x11330124, 0x07821723, 0x13201383, 0x01210786, 0x84738440,
-    0x836f8260, 0x82fe2002, 0x21868270, 0x91822b2b, 0x012a2a24, 0xb1822b55,
-    0x802a8025, 0x82d5fe2b, 0x82d5209a, 0x82012006, 0x821382c1, 0x200582b9,
-    0x20008200, 0x202b4110, 0x37003329, 0x3f003b00, 0x86010000, 0x77032077,
-    0x15200697, 0x35200f86, 0x0b830782, 0x07862520, 0x03870b83, 0xc3861720,
-    0x07821120, 0xb182af83, 0xaa2a2a22, 0x0583b285, 0x0d87b083, 0x2a2aab23,
-    0x850b8356, 0x20a282b6, 0x83b4822b, 0x83c082b9, 0x82c883bf, 0x058241be,
-    0x5341b683, 0x86132022, 0x841120ab, 0x23112207, 0x83a38605, 0x209b87b3,
-    0x83a38613, 0x2aeb2307, 0x6082552a, 0x83074b41, 0x4196820a, 0x18820555,
-    0x9d820282, 0xfe2b2b22, 0x01288782, 0xd62b8080, 0xd52a2b2b, 0x14849085,
-    0x2024e741, 0x0ad74121, 0x35212523, 0x07734221, 0x15209b87, 0x87060342,
-    0x9501229f, 0x08de412b, 0x4105e842, 0x37410d39, 0x2a2b2607, 0xd52bd52b,
-    0x221c832a, 0x82d52a80, 0x21a4820d, 0x0082002b, 0x03820320, 0xd601002e,
-    0x1a00ab01, 0x27002200, 0x23010000, 0x1805654a, 0x0807bfd6, 0x35013b36,
-    0x15213523, 0x26343533, 0x37270717, 0x16011f36, 0x07173707, 0x15950123,
-    0x152baa2b, 0x12191912, 0x2a016a6a, 0x1528192b, 0x0908152c, 0x81d5061b,
-    0x012c812c, 0x2b205f83, 0x3105a155, 0x5515ea2b, 0x15dd1912, 0x0707152b,
-    0x817f081b, 0x5f54832a, 0x00ab260a, 0x001e0015, 0x245d6726, 0x11333527,
-    0x17331121, 0x20018237, 0x18cb6607, 0x2ad6622c, 0x0b2ad6fe, 0x20602b20,
-    0x5c670180, 0x82552016, 0x2a012222, 0x6c2384b5, 0x27250c8b, 0x34003000,
-    0x4f4b1800, 0x1b785d07, 0x34013d31, 0x17153336, 0x36373307, 0x17012f34,
-    0x18331523, 0x2e1a63d4, 0x463d5656, 0x99460606, 0x95014040, 0x5dd61218,
-    0x10830e8e, 0x56555529, 0x07110746, 0x822b8046, 0x05df768f, 0xab01ab2d,
-    0x07000300, 0x23001500, 0x82002700, 0x23372217, 0x05fd4135, 0x22231523,
-    0x054c5206, 0x11331528, 0x010e1117, 0x1985012b, 0x13352722, 0x15202382,
-    0xd5210382, 0x52008355, 0x55250543, 0x1801ab2b, 0x220f8212, 0x832a6060,
-    0x2b403b00, 0x16eb2b2a, 0xaafe1218, 0x01161812, 0x00ff96d6, 0xc02a1812,
-    0xff35602b, 0x7f842b00, 0x3f460820, 0x00092208, 0x397b8422, 0x0033002f,
-    0x0045003c, 0x0f220100, 0x3e373301, 0x07262701, 0x010e2115, 0x85183307,
-    0xa24b1052, 0x60252005, 0x07200a46, 0x2007db5f, 0x2d088725, 0x05076c01,
-    0x08a955e9, 0x22060404, 0xa582ebfe, 0x2b161623, 0x8d8d1801, 0x204b290a,
-    0xfe4b3615, 0x6b4040d5, 0x2a220282, 0x5918ab2a, 0x95290e57, 0x04638703,
-    0x800a0811, 0x25d7822a, 0x241c5540, 0x03831c24, 0x20608a26, 0x40201540,
-    0x35210083, 0x05bc4b01, 0x07860120, 0x23490020, 0x01d62806, 0x0011006b,
-    0x7d2c0023, 0x2e560cbb, 0x17272405, 0x8217011e, 0x231529b6, 0x010e2335,
-    0x34262223, 0x0903a418, 0x2c0aa87d, 0x15162bab, 0x156e0720, 0x20072e2b,
-    0x50768315, 0x9c7d055b, 0x12d5330c, 0x01802b19, 0x2a2b1317, 0x2417132a,
-    0x0c2a2437, 0xc35b0b13, 0x053f4706, 0x29248783, 0x44003b00, 0x29088784,
-    0x011e1507, 0x2315013b, 0x23150622, 0x16143315, 0x3632013b, 0x23353335,
-    0x012b2634, 0x36323335, 0x012e3537, 0x0727012b, 0x9f891632, 0x012e0722,
-    0x0e219f82, 0x05b87b01, 0x20065a53, 0x0e03606b, 0x00426b20, 0x2b802205,
-    0x23b28215, 0x2f2a166f, 0x1b23b282, 0x8a1b2424, 0x0f1b60b2, 0x82801221,
-    0x825620bb, 0x2b2b25ba, 0x01011713, 0x2851bc83, 0x09434106, 0x05002b26,
-    0x16000d00, 0x1521bb82, 0x057c5333, 0x35200583, 0x2708e741, 0x2020152b,
-    0x60aa9615, 0x2806846e, 0xd6b6202b, 0xc01616c0, 0x07726e2b, 0x82000221,
-    0x5a012000, 0x363e053f, 0x17010000, 0x35211523, 0x15063723, 0x1e17011e,
-    0x010e1501, 0x2e272623, 0x1e233501, 0x58821702, 0x37013e29, 0x3435032e,
-    0x83373637, 0x2e5808ff, 0x23352701, 0x00010615, 0xd6fe40d5, 0x02109a40,
-    0x0e17162e, 0x14041a02, 0x2b050304, 0x0e151201, 0x011c192a, 0x0f322901,
-    0x0c150803, 0x012b0113, 0x182a1a1b, 0xabc08001, 0x170f41ab, 0x0806191b,
-    0x050b0108, 0x08010401, 0x0b1a1607, 0x05171703, 0x1919161e, 0x0701090f,
-    0x09260183, 0x18041e16, 0x9d820517, 0x240a1f4f, 0x00190009, 0x29a58229,
-    0x33152135, 0x3632011e, 0xe75b013f, 0x21072905, 0x013d012e, 0x03333634,
-    0x37361684, 0x06141533, 0x26222123, 0xfe950135, 0x240155d6, 0x55012436,
-    0x02451912, 0x12192305, 0x1184802b, 0x2b06b45a, 0x40401501, 0x1b24241b,
-    0x9512196b, 0x2405a341, 0xff191295, 0x84128300, 0x0b0f5033, 0x14000b24,
-    0x27421d00, 0x011e2105, 0x28069c60, 0x36342622, 0x06141632, 0x07945f37,
-    0x664de026, 0x4d660202, 0x0d270584, 0x2e1e1e17, 0x85691e1e, 0x55012106,
-    0x1d821787, 0x1883a820, 0xea1e2e22, 0xe7830685, 0x00000b2a, 0x8001eaff,
-    0x0d009601, 0x08dd9118, 0x25002122, 0x2d27f182, 0x3a003100, 0x69010000,
-    0xd8590670, 0x43072005, 0x0b970bd7, 0x2008e643, 0x10771800, 0x01012607,
-    0x2a2a8b49, 0x20028440, 0x20089080, 0x06e84c2b, 0x48019527, 0x4837aa37,
-    0x21068501, 0x00832b54, 0x058a1520, 0xf04c2a20, 0x08b74607, 0xb782eb20,
-    0x1d000c34, 0x00002100, 0x17163213, 0x22010e15, 0x3e352726, 0x9c4f1701,
-    0x1e332708, 0x013e1701, 0xab82013f, 0x241bc026, 0x36240101, 0xb0260483,
-    0x2a384701, 0x9c7c4738, 0xab153e07, 0x249501ab, 0x241b801c, 0x1c801b24,
-    0x5139c024, 0x0a41410a, 0x3c2d3951, 0x2d3c0101, 0x9f4d1880, 0x206f8709,
-    0x226fa129, 0x44153335, 0x779a064c, 0x9b05ad5c, 0x4040247b, 0x4740402a,
-    0xff2c052f, 0x01dd01f0, 0x00050086, 0x0024001b, 0x373b9382, 0x06073517,
-    0x2e272516, 0x0f222301, 0x07010e01, 0x1e011f14, 0x3f323301, 0x18013e01,
-    0x38083564, 0x3b011e07, 0x1d362701, 0x010d0734, 0x15056ab1, 0x9e08090c,
-    0x03010d0c, 0x240a846b, 0xfe0d109d, 0x050d44cc, 0x18013431, 0x1d4a1f12,
-    0x107dc00c, 0x0cff4820, 0x8441030e, 0x0dff2121, 0x08220982, 0x0444aa1f,
-    0x12eb2506, 0x1a00b219, 0xb3518f82, 0x17434b05, 0x3607174a, 0x00470043,
-    0x004f004b, 0x00570053, 0x005f005b, 0x00670063, 0x4b151300, 0x052005d0,
-    0x57053b44, 0x35200bc4, 0x63441393, 0x2a1bb006, 0x56012a2b, 0x2a56fe2a,
-    0x82962a16, 0x85162003, 0x8416200a, 0x8405830a, 0x850e8a19, 0x22108324,
-    0x822b6b01, 0x82402000, 0x8a028603, 0x83198e0a, 0x2a56210e, 0x31080088,
-    0x00020000, 0x01ecff00, 0x00a301e3, 0x00170003, 0x27072500, 0x3727023f,
-    0x07270727, 0x16072726, 0x37170717, 0x26371716, 0x1ef13c01, 0x110d7ef0,
-    0x03821e0d, 0x11443830, 0x400a3037, 0x261e2a0a, 0x1ef0dd1a, 0x17861ff1,
-    0x261a2e24, 0x17822a1e, 0x11373025, 0x820b0044, 0x01d52257, 0xbf4e18ec,
-    0x000f2208, 0x2f5f8213, 0x002f002b, 0x003d0035, 0x13000042, 0x27231533,
-    0x37240382, 0x03353315, 0x37200b8a, 0x58053e41, 0x352908a1, 0x17233533,
-    0x35152335, 0x21048223, 0xd2491333, 0x2a6b280b, 0xd6d6562a, 0x8755802b,
-    0x2a562207, 0x20008256, 0x3be48255, 0x2b2a2bab, 0x2c154f55, 0x1b090716,
-    0x2c82d607, 0x55012c82, 0xabd6802a, 0xd5fe8080, 0x2b200785, 0x80200083,
-    0x2b2e0584, 0x552b552b, 0x2b164e01, 0x1a070715, 0x2d828008, 0x04000022,
-    0x24085348, 0x001b0017, 0x0a5f6721, 0x15013b22, 0x8e829c82, 0x6a323321,
-    0x052c0577, 0x25211121, 0x27371707, 0x17010f37, 0x40200782, 0x22062145,
-    0x452aaa2a, 0xfe23062c, 0x82800180, 0x4b002603, 0x2d2d1e4b, 0x3803829e,
-    0x95014b1e, 0x00ff1218, 0x2a2b1813, 0x12192b2a, 0x18120001, 0xea00ff2a,
-    0x2620824a, 0x2c1e222c, 0x4e4b1e2d, 0x3508085b, 0x008001c0, 0x13000017,
-    0x011e0733, 0x17011e15, 0x37171632, 0x010e2715, 0x27012e23, 0x4b373634,
-    0x18132180, 0x17324202, 0x31310a23, 0x7217230a, 0x14180396, 0x0a838001,
-    0x0242322c, 0x80211318, 0x03181421, 0x1f827296, 0x00820020, 0xd22fd785,
-    0x35009601, 0x5f005600, 0x00006800, 0x7c161725, 0x2720169c, 0x22199b7c,
-    0x83142117, 0x1f1626eb, 0x36373301, 0x21fc8237, 0x2d823436, 0x2f26072c,
-    0x06072301, 0x17072707, 0x56453706, 0x08ae6507, 0x2d9f012b, 0x042b0406,
-    0x14103509, 0x05cb7c08, 0x35101423, 0x23118209, 0x01012d06, 0xfe301a99,
-    0x102c05eb, 0x0a241836, 0x18250920, 0x052c1036, 0x35230e82, 0x82092519,
-    0x3519210e, 0x75270e82, 0x402a2a20, 0x49202a2a, 0xab290575, 0x4a080623,
-    0x0d150307, 0x09f67c08, 0x23060824, 0x17961515, 0x25101332, 0x091b141b,
-    0x1a093838, 0x11241c14, 0x1c241125, 0x1b200e85, 0x39210e83, 0x06054601,
-    0x200dcb7f, 0x974518c0, 0x000f3108, 0x01000013, 0x07112311, 0x37352315,
-    0x27331123, 0x08066d4f, 0x2ba00120, 0x6be02b6a, 0x6b6b956b, 0x016a6a96,
-    0x01eafe4b, 0xabab6b16, 0xebaafe8b, 0x008080eb, 0x00820004, 0x478b0120,
-    0x418e4584, 0x3f8d4b20, 0x3c862020, 0x7b7c3a82, 0x213f8905, 0x7b8b0100,
-    0x3788c020, 0x32866b20, 0x33820620, 0x6f8c0020, 0x17001322, 0xbd83b989,
-    0xbd8f2520, 0x012a6b23, 0x82808d75, 0x406b23c0, 0x5386f640, 0xb6228385,
-    0x49820001, 0x3b002f2b, 0x22130000, 0x14011d06, 0x05214316, 0x4a363221,
-    0x352305a7, 0x97333533, 0x06514517, 0x2315232b, 0x0b0a6035, 0x4a350a0b,
-    0x20068555, 0x2e0d8c2b, 0x202a2016, 0x00012a20, 0x0826080d, 0x9420100d,
-    0x35802606, 0x2b2b8035, 0x97931800, 0x82212009, 0x3517218f, 0x2006875a,
-    0x05065b0e, 0x1527373e, 0x34012e23, 0x3e333736, 0x27263401, 0x56553523,
-    0x191912aa, 0x3025aa12, 0x56aa2530, 0x012c0c8b, 0x01405540, 0x01182418,
-    0x30483001, 0x0d8c0c82, 0x67830020, 0xd6220482, 0x6f596b01, 0x47332005,
-    0x2e2f06ca, 0x07062201, 0x37172315, 0x013e3523, 0x58171632, 0x3523050e,
-    0x8c800133, 0x8c55203f, 0x6b01210d, 0xcf868598, 0x9601d622, 0x32065349,
-    0x17161415, 0x3617011e, 0x06163726, 0x37013e17, 0x8235013e, 0x0e2108c8,
-    0x012e0701, 0x1a3a3095, 0x20261010, 0x18180441, 0x26204104, 0x3a1a1010,
-    0x1d212d30, 0x9501211d, 0xbfbc1902, 0x4200201b, 0xab2e084f, 0x0300ad01,
-    0x1f000c00, 0x21250000, 0xba192135, 0x272808ec, 0x0733011e, 0x27352115,
-    0x2605dc4b, 0x07062607, 0x82ff8001, 0x4980209c, 0xbd32050a, 0x20202a01,
-    0x20200001, 0x6002012a, 0x02604949, 0x1d826aeb, 0x3205d759, 0x202b1f1f,
-    0x2b200b0b, 0x2037e01f, 0x37200101, 0x82050000, 0x0100246f, 0x825601fb,
-    0x000e2e09, 0x0023001a, 0x0100002b, 0x37270717, 0x93531817, 0x32332f08,
-    0x07061416, 0x34362722, 0x32073627, 0x7c821716, 0x63183e20, 0xe22709f2,
-    0x183a6619, 0x5aebfe22, 0x862005bc, 0x1b330682, 0x1313090b, 0x58246009,
-    0x0400ff04, 0x3a22b158, 0x82024002, 0x4065272f, 0x248a2118, 0x02852437,
-    0x1a040133, 0xaa031a45, 0x2b2b2020, 0x05042020, 0x2b2b181f, 0x258b8225,
-    0xff000002, 0x7f6101ea, 0x611b2005, 0x35220e79, 0x8a56012e, 0x011e2406,
-    0x61010e17, 0x7c2e0c73, 0x270b0c01, 0x52020131, 0x02523e3e, 0x6e616102,
-    0x2a5a310d, 0x1105120c, 0x533d2e47, 0x3d530202, 0x00007449, 0x200acb41,
-    0x31658823, 0x010e2726, 0x37013e07, 0x3e013d26, 0x15011e01, 0x67820714,
-    0x16227183, 0x6d822e17, 0x160e4308, 0x131a0a10, 0x48141429, 0x2552323f,
-    0x291c0204, 0x5223021a, 0x220c2431, 0x5115261c, 0x22950138, 0x180a2137,
-    0x2912110e, 0x241d7288, 0x020f0e07, 0x2f032a21, 0x070b0c21, 0x0b421d24,
-    0x0d0a0e1a, 0x5b567798, 0x00962408, 0x820a0006, 0x17220879, 0x2f070614,
-    0x37270301, 0xd5000117, 0x55404040, 0x27972b68, 0x3f809501, 0x556b0f47,
-    0xc720d9fe, 0x37550027, 0x01d62806, 0x001b0096, 0x8840002e, 0x24aa82af,
-    0x16072734, 0x22b58215, 0x8227012e, 0x1732260d, 0x07332637, 0x057b5b15,
-    0x36321629, 0x37273437, 0x5f233733, 0x17200560, 0x23202082, 0x2005fa5b,
-    0x0a3a4137, 0x05220d22, 0x82052642, 0x13133405, 0x55702423, 0x12050536,
-    0x18241818, 0x20360101, 0x4b954055, 0x2b260887, 0x30483001, 0x5a412430,
-    0x2325250a, 0x49131322, 0x27078a64, 0x550c2305, 0x01013620, 0x18293a82,
-    0x36050512, 0x49011555, 0x213d8536, 0x3a823024, 0x50000121, 0xeb2e089f,
-    0x0500ab01, 0x17000e00, 0x25001c00, 0xd1824b00, 0x07171524, 0x79183527,
-    0x07200801, 0x24079b5f, 0x35263327, 0x28168823, 0x15163201, 0x15070614,
-    0x27028214, 0x22012b06, 0x23013d26, 0x09851082, 0x2e06365a, 0x60013617,
-    0x154d103d, 0x583f3f2c, 0x46093e3e, 0xd2230588, 0x46802dad, 0x012d0693,
-    0x4a583e03, 0x090c1636, 0xaa0d0915, 0x3005820d, 0x5358160c, 0x012d0d0d,
-    0x1a245b6b, 0x3ec06b2e, 0x23388358, 0x131a1380, 0x80230282, 0x85ea3f2b,
-    0x80012c09, 0x53383e58, 0x141b4208, 0x820d0926, 0x293d8236, 0x1426090d,
-    0x2333d51b, 0xb3434101, 0x01d63008, 0x00130080, 0x0024001b, 0x37331300,
-    0x82331733, 0xdd5a18b0, 0x5e01200a, 0xc91805d8, 0x55250998, 0x2b802b40,
-    0x5e5d1840, 0x12012708, 0x3b303b02, 0x10825502, 0x1818242c, 0x2b2b5501,
-    0x00ff1218, 0x94481912, 0x00ff2305, 0x00821516, 0xc9181620, 0x0b4f0898,
-    0x00132209, 0x2671951a, 0x07170717, 0x8e210727, 0x2bd42767, 0x46341321,
-    0x618f0001, 0x2c3a5f25, 0x185d460e, 0x20081b42, 0x24cb8240, 0x001c0018,
-    0x835b8225, 0x07172848, 0x32011e21, 0x82333736, 0x232727c6, 0x15330727,
-    0xe4822723, 0x32172323, 0x05c87416, 0x84201521, 0x51012000, 0x2b2b0590,
-    0x2b121801, 0x887df240, 0x184bbd15, 0x20098697, 0x24228440, 0x24241b20,
-    0x27f8821b, 0x35205501, 0x4b352015, 0x08307b18, 0x24053346, 0x009601c0,
-    0x08095a28, 0x84013e21, 0x07340861, 0x22272606, 0x3e231716, 0x010e2301,
-    0x34012e27, 0x16363336, 0x27012e17, 0x0001013e, 0x04013526, 0x22110725,
-    0x36362901, 0x21290129, 0x80230a02, 0x21020a23, 0x10830b82, 0x11222b08,
-    0x01042507, 0x01950135, 0x26292434, 0x01040702, 0x01305133, 0x3a0f0701,
-    0x0f3a3030, 0x30010107, 0x04013351, 0x29260207, 0x1b443424, 0x82962006,
-    0x00032883, 0x27072500, 0x82950137, 0xd5c02300, 0x9282d5d5, 0xff000024,
-    0xe74101f8, 0x05456d05, 0x5b013e21, 0x00210d19, 0xcbf3181f, 0x321c2b0a,
-    0x62010142, 0x491c0753, 0x0a823b72, 0x1414182a, 0x32420118, 0x0049723b,
-    0x20088344, 0x206782ab, 0x08d34318, 0x3736162c, 0x33070632, 0x1e33012e,
-    0x5a823701, 0xdb822e20, 0x05713528, 0x10223202, 0xd4831020, 0x010d1f22,
-    0x222b0982, 0x71050232, 0x684c9501, 0x8b33214c, 0x213325c6, 0x0400684c,
-    0xd52ca382, 0xab019601, 0x13000300, 0x1b001700, 0x1132c582, 0x1e131123,
-    0x14111501, 0x2e230706, 0x34113501, 0x507a3736, 0xd66b2208, 0x087a62d6,
-    0x80802b28, 0x012b5555, 0xe282fe2a, 0x12180123, 0x061d52fe, 0x07830120,
-    0x2b2b8023, 0x099f462a, 0x8001eb22, 0x21275f84, 0x35370000, 0x42131523,
-    0x2b2305ea, 0x83262201, 0x2133225d, 0x05544f33, 0x07012b28, 0xeb363435,
-    0x62839696, 0x01300484, 0x120d6b0b, 0x0d120101, 0x5512404b, 0x2b01d6d6,
-    0x2d07e750, 0x19122a01, 0x0e400e12, 0x0ea04012, 0xd7470012, 0x83562009,
-    0x270121c1, 0x0806d361, 0x013e173f, 0x17011e37, 0x17072707, 0x16371737,
-    0x27263317, 0x3d1ed501, 0x2e345821, 0x1b1e2153, 0x492c2643, 0xa0553d1b,
-    0x56558020, 0x082b0619, 0x1f2c0124, 0x222a2545, 0x1b181e1e, 0x20240101,
-    0x241a8446, 0x4b362b61, 0x45628238, 0x13230a5b, 0x46001e00, 0x2c45090b,
-    0x053c6b05, 0x22013f2f, 0x3717010f, 0x012f3436, 0x15010f26, 0x0b3e4533,
-    0x3c452a20, 0x06912d08, 0x1a361a05, 0x05210404, 0x9e359d39, 0x450a2545,
-    0x152e0820, 0x19351a04, 0x21050b05, 0x359e2d04, 0xa741009d, 0x01e72d06,
-    0x00080096, 0x0047003e, 0x25000079, 0x2007745d, 0x0a084c37, 0x26230722,
-    0x27227982, 0x05820607, 0x4c013f21, 0x37220c08, 0x48181633, 0x17210aa4,
-    0x07374525, 0x0f223e87, 0x3d820601, 0x012f3522, 0x3d323c86, 0x3f262701,
-    0x011f3601, 0x3b34013f, 0x021f3201, 0x3f823637, 0x0135dd82, 0x1e1e1653,
-    0x851e1e2c, 0x1d030420, 0x0b250604, 0x0601060e, 0x2c03823c, 0x06250c0d,
-    0x05031e03, 0x1f01011f, 0x23088205, 0x0d0c2506, 0x23081a86, 0x06250b0e,
-    0x04031d04, 0xccfe0120, 0x1d13130e, 0x15561313, 0x02130202, 0x040f1804,
-    0x05260401, 0x04181004, 0x03230e82, 0x84031414, 0x04102315, 0x18822605,
-    0x15840f20, 0x01150238, 0x2c1e0136, 0x1e2c1d1d, 0x05041925, 0x0f020534,
-    0x06270609, 0x04820101, 0x020f0922, 0x04301082, 0x190e0f19, 0x05330604,
-    0x050a1001, 0x01010528, 0x0a290482, 0x33050110, 0x0e190406, 0x326e83a9,
-    0x1018131d, 0x04210402, 0x1a090902, 0x03010103, 0x8409091a, 0x0910220e,
-    0x3017830a, 0x09090103, 0x19040419, 0x03010909, 0x10020421, 0x067f460a,
-    0xd601c022, 0x5b06334c, 0x002707bd, 0x21352101, 0x82352111, 0x96531801,
-    0x5201200d, 0x01230aa7, 0x18aafeab, 0x18075d46, 0x2108f673, 0xc876d8fe,
-    0x2b152408, 0x188000ff, 0x220fbf51, 0x832b81fe, 0x06674200, 0x9601d53b,
-    0x0d000600, 0x00001600, 0x010e2137, 0x25012e07, 0x37013e21, 0x2e27011e,
-    0x058e5301, 0xa8012c2b, 0x5555750a, 0xfe9e0175, 0x20088458, 0x06f954ca,
-    0x6b53ab26, 0x7d6b0202, 0x08250584, 0x2e1e1e17, 0x075f671e, 0x01eaff22,
-    0x0e205783, 0x2405a945, 0x07062137, 0x053e5223, 0x86231521, 0x1732215f,
-    0x33231082, 0x8b163315, 0x06022666, 0x352b40a1, 0x266a880b, 0x202b2c34,
-    0x87d20621, 0x1516256e, 0x152b2a2b, 0x17217185, 0x200a8229, 0x31748845,
-    0xff000001, 0x01b401df, 0x00db009d, 0x36072500, 0x57823726, 0x07230282,
-    0x8227013e, 0x360628d4, 0x0706010f, 0x82073616, 0x8217200b, 0x010e3903,
-    0x23170717, 0x22173616, 0x17161427, 0x011f1607, 0x37011f26, 0x1e331706,
-    0x03821882, 0x03822720, 0x22210282, 0x3c428226, 0x27362637, 0x16263736,
-    0x33373637, 0x1537013e, 0x06013f36, 0x36073736, 0x06073716, 0x2c428215,
-    0x17161727, 0x011f3632, 0x2f361716, 0x2e348201, 0x16071626, 0x27012e17,
-    0x16172606, 0x82141734, 0x240f820a, 0x16072606, 0x20308233, 0x296f8217,
-    0x07343607, 0x27150614, 0xa7831606, 0x27228d84, 0x69833631, 0x3e225e82,
-    0x31821602, 0x37239f82, 0x821e3730, 0x2212826d, 0x82170607, 0x36530873,
-    0x36023f26, 0x04058b01, 0x02020101, 0x31151828, 0x0108030f, 0x030e0b14,
-    0x0710070f, 0x0507020d, 0x0407270f, 0x02010a05, 0x05010704, 0x0b0a0903,
-    0x05060503, 0x04030202, 0x020e0908, 0x02070c01, 0x0904050b, 0x07040c04,
-    0x0d0d0909, 0x0a180c0d, 0x82025c42, 0x05230849, 0x05040110, 0x03030604,
-    0x140f081c, 0x0a0f0323, 0x0a08090b, 0x0b0b0307, 0x0817010a, 0x0807050f,
-    0x82090202, 0x27153653, 0x01030608, 0x09020306, 0x04090108, 0x01030503,
-    0x03040104, 0x24008201, 0x03050402, 0x260c8302, 0x08050c03, 0x82010505,
-    0x0c370853, 0x1d381906, 0x19180401, 0x08060404, 0x1a221b06, 0x25260e08,
-    0x01020114, 0x0c223f01, 0x02040707, 0x11090502, 0x06040302, 0x08df0305,
-    0x010c1a0c, 0x090b361e, 0x82020703, 0x092a088f, 0x05050305, 0x010d0102,
-    0x27010605, 0x110c010c, 0x0c331308, 0x08180a0b, 0x0d040719, 0x02050306,
-    0x120e0404, 0x040e0804, 0x2982010a, 0x06060426, 0x0204050a, 0x13378c82,
-    0x1f104f7e, 0x01221804, 0x0c0c0602, 0x0308180b, 0x040f090d, 0x82060104,
-    0x27a3821b, 0x04030401, 0x03080207, 0x063a3f82, 0x0c050201, 0x100a1b2b,
-    0x07101001, 0x05050b1b, 0x0807040e, 0x06010b09, 0x28820f01, 0x010b0534,
-    0x0c0a070d, 0x0a090a08, 0x150d030b, 0x030c0709, 0xea820308, 0x050c2008,
-    0x020a0614, 0x232a1102, 0x0c061504, 0x0a0f0111, 0x2312060c, 0x29030115,
-    0x03010d2c, 0x82040607, 0x0e0828ba, 0x03060306, 0x4c00060e, 0x0d22092f,
-    0x45474100, 0x152b0805, 0x013b1614, 0x2e37013e, 0x1e320701, 0x23061401,
-    0x22232227, 0x16011d06, 0x16323317, 0x012b0614, 0x07010e15, 0x3634022e,
-    0x63321733, 0x272905a5, 0x34262223, 0x35333736, 0x05544c3e, 0xa5151b2a,
-    0x0202785b, 0x130b1c78, 0x093ae082, 0x1e170703, 0x0a230601, 0x2a0a0d0d,
-    0x0c2a3901, 0x0b0d0c13, 0x16070408, 0x1383071e, 0x290b2408, 0x95013802,
-    0xa55b7802, 0x79021b15, 0x30785b5a, 0x0d120c06, 0x2e161e01, 0x140d0107,
-    0x382b350d, 0x84050102, 0x2d172111, 0x01231184, 0x18392a35, 0x200e9fc7,
-    0x18b98220, 0x2710c5d3, 0x27070622, 0x36273315, 0x1720b582, 0x0120cc82,
-    0x0fc4d318, 0x2c19952e, 0x2e712d11, 0x3322251b, 0x420e1e0a, 0x0facc718,
-    0x0f12fa2c, 0x172d702d, 0x28091e26, 0x27410032, 0x016b2206, 0x20798296,
-    0x3c6d820b, 0x17372317, 0x15331533, 0x01333523, 0x2bd62b40, 0xaa402a2b,
-    0x95950140, 0x2ad6aa95, 0x08cf4a2a, 0x6b01ec3c, 0x1a001000, 0x00001f00,
-    0x07010e13, 0x17011e11, 0x35373533, 0x012b2634, 0x14470527, 0x07134705,
-    0x34066953, 0x1219d5ab, 0x01012baa, 0x2c160305, 0x1b070715, 0x2c822e04,
-    0x09e05a82, 0x02d52927, 0x982b1813, 0x05ef5d04, 0x81260427, 0x0000812c,
-    0x246f820a, 0x01c00100, 0x124f7f80, 0x79822720, 0x16b35a1a, 0x87074f58,
-    0xab402307, 0x0299d5ab, 0x2b800122, 0x0382e482, 0x2a2a2b23, 0x8206842a,
-    0x82002004, 0xff002c71, 0x01de01eb, 0x00090096, 0x822f0015, 0x1632356d,
-    0x2e070617, 0x05363701, 0x06161736, 0x022e0607, 0x3207013e, 0x06261382,
-    0x011e1716, 0x19823e33, 0x734d3720, 0x39590809, 0x2a043511, 0x0a0f0e1b,
-    0x0d8d0105, 0x0d330c07, 0x0d232308, 0x2a9e4b11, 0x0f051024, 0x2210190c,
-    0x040e0b10, 0x02110a06, 0x75585875, 0x01750202, 0x1a021795, 0x0c321a2a,
-    0x06010205, 0x080e6316, 0x1223230d, 0x0b0f052a, 0x1a341004, 0x07011210,
-    0x26100604, 0x0375582c, 0x20308203, 0x09cf7574, 0x08006b29, 0x00001100,
-    0x82211113, 0x012e2380, 0x88650727, 0x2b233606, 0x61480001, 0x48610101,
-    0x4836d6d6, 0x36480202, 0xfe6b01d6, 0x059548aa, 0x49012b26, 0x01493636,
-    0x0d4f4d18, 0x1a001124, 0x49832300, 0x1627ca83, 0x34013e17, 0x82222726,
-    0x4f5289f0, 0x2b3108f8, 0x125838aa, 0x241c100e, 0x0e101c24, 0x80385812,
-    0x05615980, 0x40018028, 0x120c0c09, 0x6a830d0c, 0x353e0123, 0x051b5908,
-    0x3e350923, 0x26728601, 0x0d100d95, 0x5b0d110c, 0x6b2609f7, 0x1d001500,
-    0x77822600, 0x07141622, 0x1e217983, 0x83058201, 0x8306207a, 0x3215287b,
-    0x010e1716, 0x4c373623, 0x2b29074a, 0x46403030, 0x1b093978, 0x2d7d830f,
-    0x39091b0f, 0x6b3c4678, 0x3c6b3434, 0x7b87fa30, 0x5e9a5e38, 0x0d414501,
-    0x3624010f, 0x0d0f0124, 0x2b014541, 0x413f3f41, 0x7c861580, 0xf8830320,
-    0x01d60129, 0x000d006b, 0x82190010, 0x2511217b, 0x2522768a, 0xe9890717,
-    0x072f0124, 0x6a831420, 0x07201426, 0xcfcffbfe, 0x9622e18b, 0x62841714,
-    0x4f141725, 0x86796464, 0x205b825c, 0x205f8802, 0x21dd820a, 0xd9861300,
-    0x210b9d41, 0xc8823436, 0xa6528032, 0x52a63232, 0x853a4040, 0x3a853232,
-    0x6b011640, 0x032eba82, 0x65434365, 0x4c022b03, 0x024c3232, 0xd7607e41,
-    0x23af8308, 0x001b0007, 0x8505695e, 0x33272153, 0x37210785, 0x06344116,
-    0x64820720, 0x20051179, 0x0c334107, 0x01302a2c, 0x3030292f, 0x1e533340,
-    0xce831d14, 0x20141d2c, 0x43303351, 0x30431818, 0x3841a233, 0x8280820a,
-    0x4e032302, 0xda84152f, 0x4e2f152a, 0x58042b03, 0x04582424, 0x5e083e41,
-    0x07240af7, 0x1a001200, 0x8808bb41, 0x4184838d, 0x2b2206b8, 0x7b873030,
-    0x3f874f2c, 0x3c4f873f, 0x6a36356b, 0xea84303c, 0x01246c85, 0x59515159,
-    0x8306a241, 0xe9ff2b5b, 0x9601cd01, 0x34002600, 0x5b823f00, 0x0e07222a,
-    0x16060701, 0x011f1617, 0x02820882, 0x17161424, 0x0282011e, 0x013e3726,
-    0x27033e37, 0x26226c82, 0x0f823207, 0x0a692782, 0x83222006, 0x363b082f,
-    0x26361716, 0x3b0b0bdb, 0x0b010449, 0x27160d06, 0x100b1b18, 0x06010114,
-    0x0c120f02, 0x7834101f, 0x0c2a1f31, 0x6d0b0301, 0x08071b3d, 0x012b1406,
-    0x121b2804, 0x1122032a, 0x82070408, 0x20410801, 0x011f1403, 0x4c0d0295,
-    0x06171024, 0x14150b0e, 0x23110b19, 0x0c16050e, 0x070a1704, 0x45090204,
-    0x172c1a29, 0x62220c1d, 0x023e0b1d, 0x1b152405, 0x22020416, 0x2613181f,
-    0x06100b05, 0x12060806, 0x08cb451b, 0x1a008822, 0x2f23cd82, 0x18010000,
-    0x820ae287, 0x06a358c2, 0x1e54c682, 0x82128205, 0x832e200b, 0x05374f25,
-    0x72014108, 0x0217151e, 0x361e3f54, 0x3b171e16, 0x55d55520, 0x1d025f4a,
-    0x024232a3, 0x32324202, 0x42010142, 0x2b2b1f32, 0x012a2a3f, 0x36151f88,
-    0x0154401e, 0x171e1516, 0x2a2c041c, 0x6a0a2c2a, 0x0946264b, 0x27852182,
-    0x29423223, 0x05265701, 0x1b470020, 0x4e822008, 0x01210503, 0x28968217,
-    0x010e1737, 0x26362707, 0x20048327, 0x08868207, 0x01163623, 0x01273717,
-    0x0f0a4055, 0x01200714, 0x08201123, 0x4016100d, 0x10402d18, 0x2d081020,
-    0xd62af6fe, 0x291d832b, 0x20070c11, 0x20012311, 0x1d821308, 0x0e2c222c,
-    0x01011911, 0x2aa1fe0d, 0x27422bd5, 0x00802608, 0x00130006, 0xb192181c,
-    0x0562460c, 0x013e352f, 0x1d062217, 0x34353301, 0xd5000126, 0x33a28240,
-    0x01241bd5, 0x0115aa15, 0x0c091b24, 0x80010b2a, 0x40ababc0, 0x152c0c82,
-    0x1b155656, 0x090c2a24, 0x0d081515, 0x830a6343, 0x8919205b, 0x16322559,
-    0x26342317, 0x15225284, 0xb8473523, 0x24568805, 0x0c120c2b, 0x845a836a,
-    0x24552c55, 0x0c0c091c, 0x56562a09, 0x53241c2a, 0x7c3d087f, 0x3e001100,
-    0x15130000, 0x1d163233, 0x17011e01, 0x3d363233, 0x27012e01, 0x14153307,
-    0x850d8516, 0x82232060, 0x826883b3, 0x32362307, 0x2e833617, 0x07065008,
-    0x26012b06, 0x2b272627, 0x010a1120, 0x12ba3a4e, 0x3a4d011a, 0x101626c0,
-    0x0d1a157f, 0x0d280d14, 0x24270e13, 0x33121233, 0x18140325, 0x131b8e20,
-    0x7b010116, 0x8710154c, 0x14014736, 0x4835d112, 0x14c02e01, 0x11170119,
-    0x0e0e0966, 0x85585809, 0x251a2d05, 0x1a251212, 0x18141c6d, 0x20161403,
-    0x3d051f4e, 0x01ab01ea, 0x001800ab, 0x00250021, 0x01000029, 0x1507010e,
-    0x07062223, 0x33011e15, 0xde613221, 0x2e352306, 0xc2820701, 0x35231523,
-    0x0586623e, 0x23153328, 0x3d2d0001, 0x9d181501, 0x152b0dc6, 0x1c2d3d01,
-    0x01840125, 0x822a0725, 0x215a8200, 0x69192d3d, 0x2d2e0b80, 0x2501283d,
-    0x1c2b2b1c, 0x2b55ac25, 0x9f5a002a, 0x227f8705, 0xa43d0039, 0x05a3537f,
-    0x15010e26, 0x37363423, 0x2405ce4e, 0x36262315, 0x3493a017, 0x13231e20,
-    0x2a06080f, 0x0a08110c, 0x2a0c120c, 0x2a032402, 0x08a39a2a, 0x161ba132,
-    0x0407170e, 0x0f0f090b, 0x120e040b, 0x1709090b, 0x002a8b18, 0x00060000,
-    0x01e5ff00, 0x009601d6, 0x00140008, 0x0029001d, 0x0048003f, 0x26221300,
-    0x1805f960, 0x200b7d86, 0x20149317, 0x05207a03, 0x1e010e2e, 0x37363701,
-    0x3e011e33, 0x012e2701, 0x08a88418, 0x130f8b2d, 0x14141d13, 0x0136290e,
-    0x82065406, 0x36012902, 0x14140ec1, 0x0f13131d, 0x292d128a, 0x72072114,
-    0x16332e0a, 0x1c1a2e12, 0x2c09830b, 0x21070917, 0x12120d15, 0x0112121b,
-    0x2e2e8313, 0x0182141d, 0x743a2936, 0x3a740404, 0x91813629, 0xd7fe2512,
-    0x19131701, 0x33244182, 0x1c0b0816, 0x1a230883, 0x835f1713, 0x121b2340,
-    0xbb570000, 0x01eb2b05, 0x0003002b, 0x00170013, 0xfd820026, 0x15331323,
-    0x21b28323, 0xdb651517, 0x33152205, 0x220f8235, 0x82252315, 0x671d20c6,
-    0x153c09a0, 0xd5211521, 0x80402b2b, 0x01010c09, 0x2b80090c, 0x2bab6b40,
-    0x9655fe2b, 0x152b0c09, 0x01270182, 0x012afed6, 0x83abab2b, 0x0c09241b,
-    0x8555406b, 0x8095210b, 0x15250082, 0x07000040, 0x09a75700, 0x23001a2f,
-    0x35002c00, 0x47003e00, 0x1e010000, 0x08757c01, 0x012e0529, 0x35231527,
-    0x8207010e, 0x013e2114, 0x230d5058, 0x36342622, 0x2008f663, 0x07a05c37,
-    0x00480720, 0x0aa25607, 0x01780239, 0x3a48020a, 0x02483a56, 0x4a4a6302,
-    0x0de8fe63, 0x10191010, 0x840ce210, 0x85ac2006, 0x85a8200d, 0x0c41260d,
-    0x11181111, 0x0a7f5111, 0xd3785b2c, 0x290f5c3e, 0x3e5c0f29, 0x4182634a,
-    0x1f836720, 0x02842282, 0x83014d21, 0x10192249, 0x20078601, 0x220e851d,
-    0x82000900, 0xd6013100, 0x0f005601, 0x1c001800, 0x24002000, 0x2c002800,
-    0x5b05e367, 0x3321065b, 0x05575b21, 0x18052321, 0x23088146, 0x37211521,
-    0x4a0a9a60, 0x3724079a, 0x55231533, 0x22083350, 0x61b5fe12, 0x3e270537,
-    0xeafe1601, 0x82154016, 0x15d52a01, 0x16165515, 0x01151556, 0xbe4e1855,
-    0x612a2009, 0x01230639, 0x84aac0d6, 0x84152000, 0x21998200, 0x9f840200,
-    0xab01c022, 0x06340982, 0x21330000, 0x23110711, 0xab011535, 0xab01aa2b,
-    0x6ee7fe67, 0x8308c34b, 0x00082c23, 0x0010000c, 0x21010900, 0x82352335,
-    0x820720a0, 0x260383a3, 0x55fec001, 0x6b805601, 0x012d0538, 0x2b55feab,
-    0x2b19ab6e, 0x2bd5abab, 0x087b452b, 0x80206393, 0x99206384, 0x562063aa,
-    0x8405de5f, 0x80992163, 0x402063a3, 0xd9206384, 0x162063aa, 0x84056b61,
-    0x40d92163, 0x01206389, 0x280a2b41, 0x11213300, 0x01ab0115, 0x27578cab,
-    0x00070003, 0x2500000c, 0x2706796c, 0x33112105, 0x2b950135, 0xfe2e0082,
-    0x55560180, 0x00ffab55, 0x2b012b2b, 0xe3770080, 0x82ab2008, 0x00092509,
-    0x17070100, 0x073b0282, 0x01371721, 0xfeb7b7c0, 0xbd871ba6, 0x1b2a7b01,
-    0xb7b8ab01, 0x881b2401, 0x851b2bbd, 0xd5ff2b67, 0xab01d601, 0x0c000500,
-    0x35840f00, 0x87153721, 0x17272238, 0x223b8223, 0x882b6e1e, 0x73e3223d,
-    0x234082e5, 0x2bdd701f, 0xae214386, 0x0cef4173, 0xef410520, 0x82212006,
-    0xfe2b27c8, 0x67ab01eb, 0x6682e7fe, 0x06008608, 0xeaff0000, 0x9501dc01,
-    0x14000e00, 0x20001a00, 0x29002600, 0x15010000, 0x0e07011e, 0x3e150701,
-    0x012e2701, 0x17160327, 0x11272635, 0x06353736, 0x06271507, 0x07363307,
-    0x37171623, 0x27371726, 0x54481501, 0x3c500907, 0x09076c5a, 0x329c4e68,
-    0x25252f40, 0x1e32402f, 0x072a0629, 0x28072b06, 0x80781c1e, 0x2a940180,
-    0x3b496b0b, 0x0b2b0851, 0x694e5a84, 0x2986fe09, 0x1c072a07, 0x061d0e01,
-    0x3c29062b, 0x2035821e, 0x23338259, 0x60601c25, 0xa3449482, 0x01d62a05,
-    0x00030040, 0x00110007, 0x25978216, 0x21151300, 0x03820535, 0x424e1720,
-    0x15052e0d, 0x012b3533, 0x0100ff00, 0x04058100, 0x053f4e15, 0x2c812f26,
-    0xaa7efe81, 0x2006946e, 0x2b168203, 0x1b080816, 0x2c822504, 0x2a2a0282,
-    0x64825582, 0x01c00129, 0x000b0080, 0x5c1b0017, 0xee820e31, 0x37013e33,
-    0x0e17011e, 0x35232701, 0x52000133, 0x6c02026c, 0x25058552, 0x01015440,
-    0x05844054, 0x2a2a2b24, 0x18888001, 0xfe6c5223, 0x821987ad, 0xd629211f,
-    0x850a0b43, 0x01002167, 0x0a134718, 0x0bf26018, 0x5e996198, 0x5f82b282,
-    0x16010024, 0xcd838001, 0x11331324, 0x8e83eb23, 0x8480fe21, 0x00003216,
-    0x9001fcff, 0x0f008001, 0x0e250000, 0x012e2701, 0x4ed28237, 0x013f058b,
-    0x3e993990, 0x1836083b, 0x08342441, 0x24421a3c, 0x35083b40, 0x1c3d9939,
-    0x993e0320, 0x7e191838, 0x0f260ccf, 0x1f001b00, 0x3d632300, 0xbf5a1806,
-    0x0ab3450d, 0x17010f2c, 0x1707013f, 0x33150737, 0x8f185a35, 0x072b1501,
-    0x7b2a252a, 0x8f252a25, 0x1895012a, 0x2417838e, 0x4a154a4a, 0x24028215,
-    0x00555540, 0x21c38202, 0xdf4f01f9, 0x001c2705, 0x15230100, 0x214b3733,
-    0x012e2706, 0x37363427, 0xe74b0e27, 0x34260806, 0x2a150126, 0x1a1e672a,
-    0x4054011d, 0x1c01553f, 0x0d3d1e1b, 0x3f993634, 0x01232321, 0x1fa7d580,
-    0x40223c15, 0x1c820154, 0x163c222e, 0x4098371e, 0x1c330c3d, 0x004b564c,
-    0xff2c6384, 0x8101c201, 0x55004c00, 0x27210000, 0x22325982, 0x33360706,
-    0x06141632, 0x23153307, 0x3f342622, 0xab632601, 0x36342b05, 0x3e351733,
-    0x1e333701, 0x7e823501, 0x1c822620, 0x85823520, 0x36352282, 0x1632013b,
-    0x1f323317, 0x07011e01, 0x2723010e, 0x17070615, 0xbe481803, 0x81850808,
-    0x161c013a, 0x0b06180e, 0x1d1d150d, 0x08b54615, 0x0a0a060c, 0x0a0e0409,
-    0x0d11110d, 0x2b39010a, 0x062d2301, 0x091c1806, 0x0e0d010b, 0x090b0b09,
-    0x10372214, 0x09121706, 0x01020a21, 0x010b151c, 0x082d4719, 0x0b110c0c,
-    0x201c650b, 0x060c0f01, 0x011d2a1d, 0x07100c28, 0x0808050a, 0x1a11010a,
-    0x2b2a0211, 0x06030239, 0x07110e13, 0x0f080c0c, 0x110b0105, 0x0d1c210c,
-    0x01261f08, 0x02011c15, 0x017a1824, 0x253f831b, 0x00000c11, 0xfb420004,
-    0x6c0d2007, 0x22230899, 0x67011d06, 0x34270522, 0x15072326, 0x79053533,
-    0x3529060e, 0x010e1523, 0x27012e07, 0x206c1835, 0x126b2c08, 0x2a012b19,
-    0xea12192b, 0x42ebfeaa, 0x2b2005fd, 0x2005f742, 0x05eb5595, 0x19800124,
-    0x00822a12, 0x55191226, 0x402b2b2b, 0x43063643, 0x40220532, 0x2a564040,
-    0x06274a06, 0x9601d636, 0x0f000700, 0x24001c00, 0x07130000, 0x3717011e,
-    0x010f012e, 0x07250785, 0x16141506, 0x248e8217, 0x37323316, 0x081c8627,
-    0x480bfd44, 0x12290f63, 0x310b6973, 0x0c2a0844, 0x160fd454, 0x221e4015,
-    0x0b602125, 0x2a01241b, 0x95013405, 0x48630f29, 0x4073530b, 0x3144082a,
-    0x47543d0b, 0x39202521, 0x0d224f18, 0x012ae10f, 0x260b1b24, 0xe3420034,
-    0x4fc02008, 0x142406e7, 0x23001800, 0x37318182, 0x23270701, 0x013d012e,
-    0x013f3634, 0x07273307, 0x05077815, 0x32174908, 0x14011d16, 0x23352707,
-    0x011b2b27, 0xfa2b1b65, 0x0c0e1912, 0x0d310332, 0xac2bba42, 0xb921b80f,
-    0x26051912, 0x5001402e, 0x1b9bfe1b, 0x1218012a, 0x04150e75, 0x4d0d2e12,
-    0x28d52b2b, 0x194b2143, 0x090b5512, 0x00402f25, 0x20057b54, 0x2af782eb,
-    0x003c0036, 0x010e3700, 0x822f0627, 0x3233216e, 0x2a072952, 0x2e012f26,
-    0x37013e01, 0x82261732, 0x15860876, 0x2e070617, 0x06222303, 0x011f1407,
-    0x010e1516, 0x27262207, 0x15211533, 0x0c019f21, 0x05011c0e, 0x0a14100b,
-    0x26330b08, 0x0101352e, 0x44443243, 0x29435301, 0x1216012f, 0x1901050a,
-    0x2a150913, 0x01322b1b, 0x0178374f, 0x311a4954, 0xc00116a4, 0x0c512afe,
-    0x1d01010a, 0x190b0c45, 0x01161210, 0x082b1a21, 0x532b0706, 0x0f100137,
-    0x3b0b0a01, 0x17010114, 0x1b200f1b, 0x0d060829, 0x01372e4d, 0x156b230a,
-    0x33450000, 0x0012240a, 0x7b22001d, 0x3d270cbf, 0x21152301, 0x45353311,
-    0xf25a069a, 0x6b340808, 0x12191813, 0x19122a01, 0x95d6fe2b, 0x1a05057b,
-    0x05051a35, 0x9d390421, 0x80019d35, 0xd6fe1318, 0x12191912, 0x2a019595,
-    0x1905152b, 0x0c041a36, 0x2e052104, 0x6e821c82, 0x200aa742, 0x08254a27,
-    0x2e052d5c, 0x26222123, 0x1e17013d, 0x36323301, 0x82373537, 0x26343d05,
-    0x15070622, 0x07222307, 0x36343527, 0x3e161333, 0x012f2601, 0x0e011e36,
-    0x37272601, 0x2205be60, 0x6e071632, 0x222305ba, 0x6d950106, 0x25080726,
-    0x16200544, 0x4801221a, 0x2e2e2202, 0x32012e44, 0x5d0f1304, 0x0d461219,
-    0x0c0a0a19, 0x0e22111c, 0x0722220e, 0xbc6c01e5, 0x175d2305, 0x02821722,
-    0x5c800121, 0x55270779, 0x221b151c, 0x8234031a, 0x222e3839, 0x270a4a01,
-    0xfe19128c, 0x1a0a05d2, 0x070b0618, 0x0e23230e, 0x439b0f0e, 0x17210512,
-    0x21398311, 0x99180017, 0x0b2809d7, 0x16001100, 0x36002e00, 0x2e067342,
-    0x26222306, 0x13373435, 0x06273736, 0x82332707, 0x23052105, 0x37250882,
-    0x2e331733, 0x21d78301, 0xfc823336, 0x07143f08, 0x35073627, 0x2327012e,
-    0x1b2b011e, 0x201b6501, 0x7d583e32, 0x1c20ca20, 0xbe060531, 0x0f33083e,
-    0x04404e01, 0x56028909, 0x61083e40, 0x1f2b3840, 0x7d584a38, 0xb9191e2c,
-    0x40072d20, 0x9d425307, 0x20470805, 0x3e587d20, 0x04e7fe32, 0x0102300f,
-    0x1b33087e, 0x880e124a, 0x573f4002, 0x7d2c1e20, 0x1e384a58, 0x07406823,
-    0x5339202d, 0x00000300, 0xde01e2ff, 0x0d006b01, 0x37001700, 0x36250000,
-    0x0706012e, 0x16171606, 0x82173732, 0x4d2220a4, 0x0722051c, 0x015b2113,
-    0x26332706, 0x33352327, 0x04823736, 0x36152308, 0x15333537, 0x3517011e,
-    0x9c012634, 0x4b451115, 0x22111517, 0x42183718, 0x2b106d1e, 0x1f2b2020,
-    0x01422510, 0x7c3c0805, 0x59600913, 0x806a0c05, 0x0d801812, 0x42190816,
-    0x112c4b23, 0x174b2322, 0x1e420e0e, 0x2b201050, 0x102a2120, 0x18011b01,
-    0x1200ff12, 0x18130118, 0x55141755, 0x2009133c, 0x0d16082a, 0x8f5d3482,
-    0x0019240a, 0x82260022, 0x26272ca7, 0x0622012b, 0x1f14011d, 0x82333601,
-    0x07142183, 0x3f24b282, 0x25343601, 0x0621b286, 0x18a28213, 0x281dbff2,
-    0xc9aaaa52, 0x12180cc0, 0x47f31896, 0x002a2117, 0x2d080082, 0xff000002,
-    0x016b01ea, 0x000b0096, 0x13000013, 0x11231533, 0x2622010e, 0x33231127,
-    0x011e1123, 0x95373632, 0x300116d6, 0x16013048, 0x90665696, 0x2a953005,
-    0x3024d5fe, 0x2b012430, 0x1812d5fe, 0x69001218, 0xab2008d7, 0x19244784,
-    0x25002100, 0x27061942, 0x2e23010e, 0x27352701, 0x153f5782, 0x26013e27,
-    0x35270706, 0x37321323, 0x14070627, 0x23353716, 0x011b2b15, 0x083e1b65,
-    0x82241e2c, 0x16d63261, 0x0c010732, 0x16590615, 0x1a051056, 0x4a0c0110,
-    0x05f44156, 0x221b3d3c, 0x90243001, 0x33da2ac5, 0x010c1506, 0xff2f5907,
-    0x041a1000, 0xc00b0a11, 0x7e824040, 0x2408e350, 0x001b006b, 0x207b822b,
-    0x73f3180e, 0x21052619, 0x14010e15, 0x05d26516, 0x27263424, 0xf3181255,
-    0xfe29106d, 0x145601aa, 0xfe141717, 0x250583aa, 0x18016b01, 0xfb845512,
-    0x01202b82, 0x2b270c8c, 0x2e270c36, 0x85360c27, 0x46002006, 0xe2260617,
-    0x0e00ab01, 0xf9491200, 0x15333107, 0x021f0727, 0x35012f37, 0x07173533,
-    0x010f3717, 0x31080385, 0x39684080, 0x52276a76, 0xa6406528, 0x3b311031,
-    0x88103c11, 0x01281427, 0x2c492bab, 0x104f318a, 0x530f10c5, 0x2715712b,
-    0x18287314, 0x31105a27, 0x83430010, 0x0015330a, 0x0029001f, 0x00410033,
-    0x011e0100, 0x07061417, 0x6d410706, 0x36342c05, 0x3e373637, 0x012e0301,
-    0x82070627, 0x3736211a, 0x13200988, 0x18831088, 0x36373223, 0x2e1a8235,
-    0x01060722, 0x01544040, 0x2917242c, 0x882c4514, 0x82142009, 0x01152609,
-    0x252d3d01, 0x2209885b, 0x861b251b, 0x8298200b, 0x11132218, 0x2a058607,
-    0x40540195, 0x2914452c, 0x892c2417, 0x96fe2109, 0x1b260b82, 0x013d2d25,
-    0x09885501, 0x82150121, 0x40542101, 0x6a201683, 0x07221982, 0x05841311,
-    0x240c5776, 0x001b000f, 0x51d78227, 0x7c590557, 0x3e072205, 0x47b38301,
-    0x3e2105d0, 0x81521801, 0x2e373008, 0x3e400101, 0x012f3c57, 0x07084665,
-    0x4a4e4f0e, 0x40200ae3, 0xa0825a82, 0x012e0584, 0x323e5795, 0x08070e4f,
-    0x2f016546, 0xec4a803c, 0x2222870b, 0x4c3d2d2d, 0xab3e0953, 0x0f009601,
-    0x21001800, 0x39002d00, 0x00004500, 0x16322113, 0x010e1117, 0x26222123,
-    0x81841127, 0x18059245, 0x8b08eb57, 0x33072c93, 0x16171606, 0x26362307,
-    0x8a372627, 0x0180220b, 0x05a05200, 0x0785ff20, 0x164f2720, 0x18372005,
-    0x2c11d5f3, 0x06032889, 0x2908240a, 0x24090704, 0x2005845d, 0x20118308,
-    0x1b551823, 0x1256220a, 0x082f4f18, 0x2306374f, 0x37480155, 0x2c051459,
-    0x16344837, 0x38210a1c, 0x22091d15, 0x43098838, 0xd62008f3, 0x163fdf82,
-    0x00002600, 0x14152325, 0x15013b16, 0x22230607, 0x23013d26, 0x37013e35,
-    0x37331533, 0x4b062221, 0x01330b31, 0x0f094055, 0x110d0e28, 0x252a292b,
-    0x402f0115, 0x4faafe56, 0xd53108de, 0x400b0c53, 0x1e2a0101, 0x2b053c64,
-    0x18804014, 0x471c8912, 0x4026087b, 0x1b001300, 0x71822400, 0x27153723,
-    0x05484115, 0x34013d29, 0x32213336, 0x66071716, 0x01250f27, 0x0155556b,
-    0x7e37190c, 0x4001270a, 0x3a303b03, 0x74825503, 0x1919242c, 0x55ea55e0,
-    0x0c0c094b, 0x0483d609, 0x1515c028, 0x15151616, 0x198218aa, 0x4c182421,
-    0x73830abb, 0x71951a20, 0x17010f26, 0x33072707, 0x82266791, 0x2b101c25,
-    0x618dd53a, 0x25303725, 0x864e3b0c, 0x01d623cb, 0x5170006b, 0xdbbf1805,
-    0x82052014, 0x01552258, 0x08e36656, 0x56011227, 0x2cf8effe, 0x09135cf8,
-    0x6f180121, 0x01250773, 0xa5430c00, 0x06574943, 0x57829620, 0x00032808,
-    0x1300000d, 0x07272107, 0x33353315, 0x23152335, 0x0156eb35, 0x2beb5500,
-    0x01802bab, 0xd6c0c06b, 0x406a40aa, 0x48000040, 0xb6220663, 0x95825601,
-    0x0b000722, 0x2605b77f, 0x07053521, 0x4c253717, 0x6b3706cd, 0xdbfe2a01,
-    0x01261e25, 0x1e261f01, 0x55012aca, 0x26b18080, 0x821e261e, 0x8c132002,
-    0x86602043, 0x82132043, 0x2177827b, 0x4385010f, 0x021e053f, 0x37013e32,
-    0x1eac2aeb, 0x08011f25, 0xfe251f26, 0x512c01a0, 0x012c515a, 0x40406001,
-    0x20478235, 0x264f8226, 0x2e4e2f42, 0x822f4e2e, 0x024a0893, 0xf5ff0000,
-    0x8001f901, 0x12000700, 0x22010000, 0x011b0706, 0x3207012e, 0x26071716,
-    0x3e270706, 0x44000101, 0xf9f8367e, 0x31447f36, 0x246d2a5f, 0x2a6d2452,
-    0x2c80015f, 0x01cafe29, 0x2b2c2936, 0x12881a1a, 0x1a871001, 0x1747001a,
-    0x244b8306, 0x00190015, 0x224d851d, 0x86353713, 0x24528348, 0x012e3733,
-    0x07d85117, 0x95215884, 0x2b528548, 0x0a2a5f62, 0x7f361237, 0x2b2b2b7c,
-    0xba225e85, 0x59855a44, 0x0c1a1a2c, 0x952c2916, 0x2ad6abab, 0x0082002a,
-    0x00000331, 0x0002eaff, 0x17008001, 0x35002d00, 0x83010000, 0x2227225a,
-    0x825c8207, 0x361727bf, 0x15071732, 0xba820307, 0x07605818, 0x3d262226,
-    0x37363401, 0x2105636d, 0xc0493507, 0x28d88205, 0x172d367f, 0x2a281112,
-    0x2f7d825f, 0x2451246d, 0x36f84b01, 0x082f017e, 0x6b080d0d, 0x01290483,
-    0x011e2e1d, 0x121b1216, 0x24928301, 0x32060238, 0x2500821a, 0x0f101087,
-    0xfd835d39, 0x01ebfe25, 0x8355090c, 0x09553029, 0x1720010c, 0x20171d1d,
-    0x12120d20, 0x4100200d, 0x14200e5b, 0x210e5b41, 0xa982012e, 0x260f5d41,
-    0x4c3b1445, 0x4145143b, 0x55270e5f, 0x0c12120c, 0x411a1a55, 0x13640a5f,
-    0x83002005, 0x37132243, 0x71ab1835, 0x16614108, 0x56872020, 0x20136341,
-    0x415d8627, 0x63410e64, 0x001d2409, 0x413d0034, 0x342808cb, 0x012e3736,
-    0x07010e27, 0x6e83bb82, 0x32333623, 0x26118217, 0x07010e17, 0x6f010e15,
-    0x715405cd, 0x35272505, 0x1e07012e, 0x23211282, 0x07444235, 0x0d0f4b26,
-    0x26203413, 0x8b82e284, 0x1211282b, 0x362d0b0c, 0x1d17717f, 0x09724101,
-    0x0e171e26, 0x12014012, 0x2c050342, 0x2614395d, 0x010d0a0e, 0x550c1201,
-    0x2a00821a, 0x38020632, 0x01c02c29, 0x4120171d, 0x14270e79, 0x200d1201,
-    0x41120d20, 0x15200e77, 0x20107741, 0x12784123, 0x4a182a27, 0x1849302e,
-    0x0e794129, 0x190f3427, 0x1a330e19, 0x08eb461a, 0x8001f923, 0x05695500,
-    0x860a7b41, 0x167c4150, 0x5a880520, 0x20137d41, 0x41618606, 0x7b410c7d,
-    0x416d8a1c, 0x25232d7b, 0x8648191f, 0x277b41e4, 0x0d352127, 0x0e19180f,
-    0x26794133, 0x4b440120, 0x0849440a, 0x44083e44, 0xc3430933, 0xf9012708,
-    0x0a008001, 0x79440e00, 0x37132207, 0x12204435, 0x15445220, 0x4466200d,
-    0x0e24160b, 0x2e002500, 0x2208a742, 0x4237013e, 0x01222b98, 0x8a422d3c,
-    0x3c2d2221, 0x207d4201, 0x00000324, 0xd784eaff, 0x2406d56a, 0x07062201,
-    0x43d88231, 0xe0920730, 0x2aba9524, 0xfe44635e, 0xe7b92212, 0x4400821a,
-    0x2e2219fb, 0xef883700, 0x43372621, 0x01253591, 0x2aba4c02, 0x2710425f,
-    0x5e070622, 0x86439384, 0x02002124, 0x08060f42, 0x0800a238, 0x00000f00,
-    0x06170713, 0x17371307, 0x07220337, 0x012e3717, 0x2a2b1b46, 0x4753f824,
-    0x2b2db51b, 0x7f3675dc, 0x2c1ba101, 0xcafe1c13, 0x011b4768, 0x92dc0b4f,
-    0x77432c29, 0x01f52306, 0x438301f9, 0x1d001822, 0x3624458e, 0x17163233,
-    0x36204c82, 0x07244e82, 0x36270717, 0x2431538b, 0x5f311a1a, 0x3c1e542a,
-    0x7f361b1e, 0xba35becd, 0x2f618d17, 0x1a1a0424, 0x254b1e69, 0x462c2921,
-    0x0ee742be, 0x8020af88, 0x1020af82, 0x20055941, 0x080c4731, 0x230fab45,
-    0x5e2ababa, 0x210c0647, 0x0347e7e7, 0x01ab2609, 0x000e0096, 0x32af841a,
-    0x33352335, 0x17152315, 0x35272315, 0x07131523, 0x82231527, 0x37320812,
-    0x17372735, 0x16ab2733, 0x042b16d6, 0x1cd65651, 0x2b6f227e, 0x26761b80,
-    0x2f3c0113, 0x2bab2a2a, 0x5aaf512a, 0x7e1bf5fe, 0x2b2a807e, 0xd61c800f,
-    0x9f840014, 0x2705cb7c, 0x0015000f, 0x33352500, 0x33245082, 0x33150715,
-    0x20057948, 0x23688237, 0x16550117, 0x6f285282, 0x19c46f22, 0xabc01956,
-    0x80274a84, 0xbc1a2a80, 0x82001abc, 0x00022100, 0x23058f53, 0x0009006b,
-    0x012f5282, 0x07010e15, 0x1517013e, 0x07172737, 0x82062335, 0x3f28080b,
-    0x6f2b0101, 0x73280f6d, 0x2f6b9550, 0x37422a2f, 0x242c3d16, 0x12566b01,
-    0x36375286, 0x2f955701, 0x011b2e2f, 0x07201613, 0x08338618, 0xeb01d524,
-    0x4d82ab01, 0x1c001826, 0x3c003300, 0x2405f37f, 0x3b011e11, 0x2ce88201,
-    0x32333633, 0x26343517, 0x15210527, 0x25a98221, 0x06222523, 0x1d5e011d,
-    0x33172805, 0x3537013e, 0x8223012e, 0x3207231f, 0x08831d16, 0xa4653620,
-    0x2beb3b06, 0x10211b64, 0xfe131810, 0xfe5501ab, 0x019595ab, 0x091e1760,
-    0x0c01010c, 0x06856a09, 0x171e2008, 0x1240120e, 0x1801ab01, 0x12d5fe12,
-    0x15562a18, 0x1812c606, 0x2aab2b01, 0x171e4056, 0x18090c0b, 0x28097fbb,
-    0x151e170b, 0x0b0b0e12, 0x0afb4e0e, 0x9601d62a, 0x18000800, 0x29002100,
-    0x2328b182, 0x33161411, 0x01213521, 0x2509f451, 0x36341135, 0xf46a1733,
-    0x15072207, 0x29a98221, 0x2a550622, 0x2b011218, 0x2e4ad5fe, 0x00ff2705,
-    0x12191912, 0x2f7401c0, 0x01bf2805, 0x48580400, 0x84400158, 0x8001218f,
-    0x220b1971, 0x83241b6a, 0x158f2c24, 0x22222015, 0x00050000, 0x50cdff00,
-    0x230806eb, 0x0023001a, 0x003b0032, 0x07063700, 0x1507010e, 0x23171633,
-    0x37013e35, 0x0617011e, 0x010f0607, 0x3634012e, 0x20081479, 0x24158417,
-    0x06270717, 0x08178c23, 0x060bd549, 0x7102422d, 0x05aa0b06, 0x30253075,
-    0x1c110101, 0x30241414, 0x19132430, 0x1a1a2619, 0x01362963, 0x1e420e01,
-    0x291c1643, 0x17293636, 0x1e2d1e1e, 0x1713ab1e, 0x170b1d04, 0x2b401316,
-    0x3001c02b, 0x0a171d25, 0x18010215, 0x2e092e98, 0x29360182, 0x1e42161d,
-    0x36010f42, 0x522a3652, 0x2f650598, 0x00802209, 0x08c78202, 0x00000a24,
-    0x01113301, 0x17371123, 0x01232723, 0xf4fe9e37, 0x4464d59e, 0x8001491c,
-    0x64019cfe, 0xe0e09cfe, 0xef4f0048, 0x01ab2d06, 0x000a0062, 0x25000011,
-    0x07171321, 0x2408c982, 0x21330714, 0x34353633, 0xab012726, 0x22d8acfe,
-    0x011f1a60, 0xfefe8101, 0x12160156, 0x1836012b, 0x1f320d8c, 0x22008205,
-    0x87071f15, 0x01c02243, 0x2543865e, 0x17370323, 0x45823336, 0x23332708,
-    0x27012e33, 0xc0010722, 0x402870f9, 0x3b2c1312, 0x3edc7401, 0x0b1b2201,
-    0x23012b0b, 0x0107a80f, 0x221a2c3a, 0xff420401, 0x01ab2b08, 0x0007006b,
-    0x1300000b, 0x01831533, 0x33372134, 0x2a6b2335, 0xc0fe9680, 0x0156562a,
-    0x2a80966b, 0x3356562a, 0x8208200a, 0x002123b3, 0x2f830024, 0x23152328,
-    0x17363435, 0x08871533, 0x3609644a, 0x013e3527, 0x55371517, 0x182ad6d6,
-    0x2bd5d568, 0x12ab6818, 0x82121818, 0x01013304, 0x01803d18, 0xd6d62a95,
-    0x2b551812, 0x1813d5d5, 0x18840155, 0x2a220484, 0x9a8256ab, 0x20080b63,
-    0x23df8296, 0x37000015, 0x35219382, 0x23668221, 0x07110733, 0x212d6e83,
-    0x33352335, 0x01c040ab, 0x5540c0aa, 0x28078555, 0x2b2b4040, 0xaa015540,
-    0x82078355, 0x5e022044, 0x0a2008f3, 0x23052344, 0x11231523, 0x3524e282,
-    0x35172117, 0x11200782, 0x35220f82, 0x35848001, 0x8456fe21, 0x8d6b2035,
-    0x00002351, 0x575e0006, 0x002b3005, 0x00270023, 0x00340030, 0x003c0038,
-    0x49210100, 0xfa8205e0, 0x3b161429, 0x3d363201, 0x88153301, 0x013e2609,
-    0x2634013d, 0x60a18207, 0x052008ae, 0x03860c83, 0x4eab0121, 0x16330560,
-    0x092b0a0b, 0x090c800c, 0x160b0a2b, 0x92181812, 0x8255d6d6, 0x18242506,
-    0x2beefe18, 0x07d66418, 0x18012b2d, 0x18128012, 0x0b0a1501, 0x85150a0b,
-    0x29128505, 0x18402b6a, 0x24191924, 0x655e2b18, 0x05e35406, 0x9601dd31,
-    0x17001300, 0x28002500, 0x00002b00, 0x54231513, 0xa5830520, 0x2e11373f,
-    0x35232701, 0x23113307, 0x07271525, 0x37170717, 0x27373315, 0x011f2737,
-    0x07171507, 0xce4c186b, 0x230c330a, 0x01abab96, 0x3c0f3140, 0x0b310f3c,
-    0x3d2e2e3d, 0x0082140b, 0x2a950123, 0xde4c1801, 0x2a01290b, 0xd500ff55,
-    0x3b0f3151, 0x51202682, 0x3c272682, 0x33151428, 0x82001414, 0x208faa00,
-    0x218fca15, 0x8e92c0eb, 0xc0218bf6, 0x898b4095, 0x4080ab21, 0x9521898b,
-    0x898b406a, 0x40558021, 0x5521898b, 0x898b402a, 0xbf154021, 0x4421208b,
-    0x2b204863, 0x00268a92, 0xff000006, 0xef4401ea, 0x44212005, 0x2f2006ef,
-    0x2015f144, 0x2a898c17, 0x23153305, 0x15071725, 0x82250717, 0x0df54409,
-    0xf144aa20, 0xf5fe260a, 0x16012b2b, 0x21008214, 0x0982eafe, 0x4310fa44,
-    0x152a0c50, 0x1514586b, 0x02141433, 0x5358002b, 0x229b8708, 0xa3270024,
-    0x13854597, 0x81458f8b, 0x45868c16, 0x0423067e, 0x4bff0000, 0x1323051f,
-    0x91002100, 0x11352c7f, 0x23272634, 0x17330735, 0x82071707, 0x37273107,
-    0x37173727, 0x15073715, 0x0c24c037, 0xc80c1010, 0x24210483, 0x05f94544,
-    0x3c103026, 0x1630103c, 0x3114ff45, 0x2e2e3c80, 0x0f31513d, 0x310f3b3c,
-    0x48152929, 0xfe821428, 0x280c9b41, 0x0038002a, 0x003e003b, 0x15034142,
-    0x011e0737, 0x010f0617, 0x2307010e, 0x36013f36, 0x06222634, 0x013e2315,
-    0x0cb24105, 0x20051a41, 0x10ae4105, 0x30244036, 0x13130101, 0x2c030b09,
-    0x0c1b1404, 0x2b192418, 0x0f013001, 0x410fb646, 0x553315bf, 0x1d243001,
-    0x12081413, 0x1b151d0d, 0x1818240c, 0x43302412, 0x14241280, 0x0a00002a,
-    0x24084b48, 0x002c0027, 0x2ad18231, 0x0047003e, 0x0051004c, 0x835c0056,
-    0x062808d7, 0x17072707, 0x15230706, 0x07171633, 0x17163717, 0x36353315,
-    0x27371737, 0x35333736, 0x37272623, 0x27260727, 0x07150735, 0x21821082,
-    0x17012f23, 0x26e48207, 0x17161737, 0x67372723, 0x07260857, 0x26071733,
-    0x4c843337, 0x34821520, 0x010e1738, 0x38eb3507, 0x111e112a, 0x15150724,
-    0x1e112407, 0x2a382b10, 0x108b2b37, 0x2a372c38, 0x511d2e16, 0x162f1f26,
-    0x400a2c8c, 0xef0b1002, 0x0a400618, 0x4c48782d, 0x40833b05, 0xe4172f0c,
-    0x2d170640, 0x1f261676, 0x230e2e85, 0x15950113, 0x1e102207, 0x4a832c10,
-    0x23250782, 0x08151508, 0x23088223, 0x382a372b, 0x103d5b82, 0x40150722,
-    0x162e0a40, 0x2e160606, 0x162f050a, 0x01102313, 0x2f16271e, 0x2418012f,
-    0x36028218, 0x1e2e163f, 0x2e1e2626, 0x06400a20, 0x0b2c2c18, 0x00400310,
-    0x4b000300, 0xab2905c7, 0x17000e00, 0x00003400, 0x169f4b25, 0x15213723,
-    0x7af78233, 0x3b230579, 0x67333501, 0x32270582, 0x26011d16, 0x4b4b0127,
-    0x3434139e, 0x0a60d6fe, 0x18137c12, 0x2b151318, 0x12152baa, 0xc01a1119,
-    0x2a13924b, 0x1318ea80, 0x2a011219, 0x822b1813, 0x12192500, 0x00111aab,
-    0x7b060b4a, 0x0b270563, 0x00002300, 0x48072713, 0x210805fe, 0x37273717,
-    0x1d010e23, 0x33353301, 0x23352311, 0x17161415, 0x35013e33, 0xeb263411,
-    0x16555516, 0x05845656, 0x12d6d627, 0xd6d62a18, 0x05eb672a, 0x15110127,
-    0x55155555, 0x29058356, 0x1801ef56, 0xfe2b4012, 0xac4d2baa, 0x80012306,
-    0x0b411812, 0x246f8505, 0x00290017, 0x95718232, 0x07272364, 0x7282010e,
-    0x37363224, 0x82821533, 0x2e233524, 0x52690701, 0x8b952007, 0xeb122f73,
-    0x1b24241b, 0x2f072015, 0x076f162a, 0x73591520, 0xab012105, 0x55257d82,
-    0x40aafe40, 0x05995955, 0x14827d83, 0x2436242b, 0x2b131801, 0x18132a2b,
-    0xb3ac182b, 0x7c032008, 0x2b560867, 0x58f99607, 0x222207cf, 0x9c831d06,
-    0xcf4a3320, 0x012b2905, 0x32363435, 0x6b011516, 0x320c0c41, 0x2e2401c1,
-    0x0f0a0124, 0x0b760a0f, 0x40260f10, 0x84131a13, 0x0f134195, 0x1720d52d,
-    0x20171e1e, 0x0b4b0a0f, 0x84010110, 0x0d202406, 0x410d0f0f, 0xd827072b,
-    0x0d00ab01, 0x50001100, 0x112005d7, 0x38058741, 0x3717013d, 0x17352327,
-    0x11171511, 0x23272634, 0x17070622, 0x18531b33, 0x22828212, 0x416d1b28,
-    0x0b290591, 0x01400614, 0xfe531b9b, 0x050341d3, 0x1b27022b, 0x01d5d735,
-    0x012bbb28, 0x21118211, 0x9b420a0c, 0x058f4106, 0x4000373d, 0x00005800,
-    0x27343637, 0x012f3637, 0x26010f26, 0x2734012f, 0x010f0623, 0x82270706,
-    0x1f06260e, 0x17140601, 0x2f068207, 0x16373316, 0x1716011f, 0x013f3633,
-    0x16173736, 0x27200582, 0x2008556c, 0x163c4113, 0x0101d13a, 0x16010218,
-    0x091b0403, 0x2b05040a, 0x09050105, 0x02051b09, 0x18030216, 0x0120198b,
-    0x04301a83, 0x041c080a, 0x03011702, 0x16161069, 0xdb161620, 0x300c5941,
-    0x060a06b5, 0x25050211, 0x070b0103, 0x01041c04, 0x27048201, 0x04010b06,
-    0x11030425, 0x03251a83, 0x0b032504, 0x23198e06, 0x15201509, 0x01210282,
-    0x14964210, 0x0004003c, 0x01d5ff00, 0x00ab01d5, 0x000f0007, 0x0023001f,
-    0x14160100, 0x34361707, 0x08870f27, 0x4306304c, 0x03310707, 0x01331123,
-    0x161d1d97, 0x152d2828, 0x13150808, 0x21a58268, 0x04851218, 0x0601d632,
-    0x161f4d1e, 0x2d296627, 0x0b1a0c15, 0xd2321416, 0xfe207882, 0x230a867e,
-    0x56016bfe, 0x77826482, 0x9601ea24, 0x694e9601, 0x15232a08, 0x35233523,
-    0x7540e033, 0x26028275, 0x40809501, 0x4d40eaea, 0x0b220af7, 0x36821100,
-    0x240bb767, 0x15333527, 0x0d676c17, 0x60206f22, 0x250c396c, 0x8045d3fe,
-    0x7f473a6f, 0x01d62508, 0x000d0096, 0x24077d54, 0x2317011e, 0x05665e15,
-    0x13013e28, 0x23352737, 0x79183715, 0x493108a4, 0x1b4c166d, 0x785b2441,
-    0xb5780202, 0xc0206011, 0x3600822a, 0x52019501, 0x1614eb42, 0x5b5b7802,
-    0x1cd3fe78, 0x2a806f3a, 0x822a2b95, 0x8203205f, 0x02cd22cf, 0x245f8200,
-    0x0017000e, 0x1aeb4433, 0x2005df5e, 0x05295835, 0x23171422, 0x3e270882,
-    0x013e3701, 0x44011e33, 0x3c2d15ea, 0x1701382a, 0x3b4e0114, 0x04014f3b,
-    0x4dd21844, 0x15ef440a, 0x2b3b0438, 0x0b0f2c1b, 0x02024e3b, 0x10103b4e,
-    0x33364901, 0x2f270646, 0x8f454701, 0x20a38805, 0x23a39a44, 0x23272634,
-    0x2327a186, 0x1614010e, 0x8d153317, 0x861720a9, 0x273422c5, 0x2fb49536,
-    0x201c2474, 0x29324201, 0x240f0b3d, 0x40243030, 0x0c20b88c, 0x0721d184,
-    0x30c09407, 0x01241b16, 0x0242320a, 0x01262f01, 0x01304830, 0x21c38b0b,
-    0xdd850339, 0x15182508, 0x0400000d, 0xf4ff0000, 0x8c01d601, 0x17000d00,
-    0x29002000, 0x23050000, 0x23072337, 0x23172327, 0x17333727, 0x0f820783,
-    0x37331722, 0x8808a543, 0xaf012608, 0x05220546, 0x3e03828e, 0xe8612646,
-    0x043e7461, 0x273e044e, 0x4914e814, 0x08060604, 0x057e0606, 0x05090505,
-    0x823b0c05, 0x9cfc2c00, 0x1d1d4e9c, 0x679b9b4e, 0x82151e15, 0x15032702,
-    0x1e14141e, 0x00820015, 0x03820320, 0xec01003e, 0x1b002901, 0x32002400,
-    0x0e250000, 0x26060701, 0x32013e27, 0x06141716, 0x37361607, 0x35270182,
-    0x1e272634, 0x18271701, 0x08089187, 0x16061559, 0x27012e17, 0x37013e35,
-    0xeb01010e, 0x42323c01, 0x3101068a, 0x0d013049, 0x25410c0c, 0x54010208,
-    0x01726957, 0x1b1b15eb, 0xce1b1b2a, 0x64554001, 0x71010160, 0xb5554d61,
-    0x1612330a, 0x31244a20, 0x20112531, 0x1d10010c, 0x01020408, 0x0a15500c,
-    0x01341651, 0x821c291c, 0x02312d02, 0x0b193c0a, 0x12021143, 0x4e150b51,
-    0x26096761, 0x000800a0, 0x631e001a, 0x01220597, 0xbc74011e, 0x82172005,
-    0x14162698, 0x34262107, 0x2a8d8237, 0x3632011e, 0x23173307, 0x84073337,
-    0x00012103, 0x3e053765, 0x0233236a, 0xaafe2b2b, 0x33022b2b, 0x3c2d0823,
-    0x1540e02d, 0x1656402b, 0x2a406a2a, 0x68a0012b, 0x4a26064a, 0x05213301,
-    0x0282054b, 0x01332127, 0xb923231c, 0x20008395, 0x20008200, 0x2a048401,
-    0x008001da, 0x21000019, 0x8227012e, 0x010e2602, 0x36262317, 0x827f8237,
-    0x3e2c0802, 0x16332701, 0x2f600106, 0x250f1332, 0x02193418, 0x5326042a,
-    0x0d13332f, 0x18351826, 0x26042b02, 0x374a6d03, 0x82090361, 0x0ba4110a,
-    0x35210b82, 0x200b8563, 0x37921800, 0x5e002009, 0x45480e3b, 0x33352105,
-    0x2b260782, 0x56feaa01, 0x02825555, 0x2b000125, 0x842b552b, 0x623a8200,
-    0x80240883, 0x11000600, 0x242d9b82, 0x00002f00, 0x15371725, 0x07273723,
-    0x20a48223, 0x2a9b8215, 0x17013f33, 0x0e353736, 0x84250701, 0x0637210e,
-    0x37201982, 0x20080e82, 0x3632011e, 0x01012e37, 0x962d3c6c, 0x07283d2d,
-    0x02026049, 0x17184960, 0x010e2647, 0xfe191b01, 0x260d82df, 0x2b2a4b0a,
-    0x84a96049, 0x8392201a, 0x3d91211f, 0x3c322c82, 0x24300114, 0x01302440,
-    0x0e25ab17, 0x20124015, 0x0d833d0b, 0x010b4b24, 0x1982a430, 0x30302525,
-    0x82302425, 0x000527a0, 0x01eeff00, 0x9f8301d6, 0x17001226, 0x2c002100,
-    0x37279f82, 0x27153327, 0x87372707, 0x3f3226a0, 0x0e353301, 0x249d8401,
-    0x2e273732, 0x209c8b01, 0x226f842f, 0x84081579, 0x0f492882, 0x013a540e,
-    0x82c9fe1e, 0x1615249a, 0x8a54413f, 0x3c2b2799, 0x3d2c962e, 0x9a86153d,
-    0x40bf0125, 0x83342113, 0x3e022496, 0x8ba22e05, 0x06974596, 0x01982508,
-    0x001d0096, 0x13000023, 0x23071707, 0x1415010e, 0x23011f16, 0x23353315,
-    0x34353627, 0x16063727, 0x012e3717, 0x27081b82, 0x26013e16, 0x441823e7,
-    0x12181203, 0xd64e570f, 0x040a5f56, 0x1b1c0344, 0x183c1c5f, 0x190b2364,
-    0x9501050f, 0x01651035, 0x17381d82, 0x2a2a8104, 0x0a0f0c90, 0x351b6509,
-    0x06128e13, 0x0736420e, 0x00191705, 0x2a06434c, 0x00ab01d6, 0x00150008,
-    0x49250021, 0x43180549, 0x94440934, 0x05514505, 0x23150328, 0x21352335,
-    0x07822315, 0x6e182520, 0x086c07a4, 0x11353f08, 0x16221717, 0x5b441116,
-    0xd9181b01, 0x02011b18, 0x2a2b715a, 0x2b2aaa01, 0x2bc0d5fe, 0x4d492a2b,
-    0x83e32005, 0x17223b23, 0x445a02c8, 0x17173c23, 0x5a44233c, 0x151557fe,
-    0x15158080, 0x15151540, 0x4a492a2a, 0x00240808, 0xff000003, 0x01f301e2,
-    0x0019006b, 0x00310028, 0x1e211300, 0x26011d01, 0x07353727, 0x06171527,
-    0x17161415, 0x11239883, 0x8305013e, 0x170724a6, 0x18062707, 0x3d0dc857,
-    0x12550140, 0x242e2119, 0x0ea3abaa, 0x12bc1314, 0x18010118, 0x36293201,
-    0x1e420f01, 0x9a561742, 0x1e2e3507, 0x016b011e, 0x20671218, 0x6b2b1606,
-    0x1c652b6b, 0x14311b1f, 0x25068361, 0x29360195, 0x2e82171c, 0x01010e26,
-    0x29365236, 0x09e88518, 0x9f880420, 0x1d001a26, 0x35002c00, 0x3525a189,
-    0x0e232607, 0x20a58201, 0x22a28833, 0x5637011f, 0xa5960581, 0x1a18132b,
-    0x442b0e0d, 0x0aa0a011, 0x23a88512, 0x35aaab12, 0x122baa98, 0x0310180a,
-    0x63272e01, 0x861318cd, 0x6b2a23a9, 0xac976b6b, 0x55000221, 0x80220563,
-    0xab821000, 0x01003408, 0x0e070617, 0x32152301, 0x013e3736, 0x27072337,
-    0x07170705, 0x37173717, 0x07273727, 0x33480127, 0x08060907, 0x08170d04,
-    0x2201331c, 0xdefe2424, 0x8866661e, 0x80013102, 0x080c1d7b, 0x0c0d2004,
-    0x56068130, 0x671e7756, 0x67201b85, 0x57182182, 0x0f240deb, 0x2b001f00,
-    0x2b0c4b6b, 0x26341135, 0x17330723, 0x010e3337, 0x35258183, 0x37363736,
-    0x82798227, 0x2179827f, 0x546b2737, 0x12193908, 0x1718226f, 0x12280123,
-    0x0e0e1606, 0xc7020308, 0x3b1e3c3b, 0x3b3c1e3b, 0x5f6b0582, 0x2a013109,
-    0x37401912, 0x21610537, 0x01200b09, 0x1606040d, 0x29822382, 0x823c3c21,
-    0x7a002029, 0x962f0887, 0x14000d00, 0x00001700, 0x06222301, 0x781e1107,
-    0x112c0529, 0x35332707, 0x27331533, 0x2b011735, 0x2c053657, 0x12000112,
-    0x53ab0118, 0x3e324232, 0x0a4a6576, 0x53ea0027, 0x75824242, 0x051b4575,
-    0x01eaff2d, 0x009601ab, 0x00100002, 0x181d0016, 0x2d12a940, 0x21112317,
-    0x37172335, 0x15233523, 0x40180123, 0x7d250fa6, 0x9500016b, 0x18638315,
-    0x240ea140, 0xc0aafe2a, 0x846882aa, 0x82d220b7, 0x00ad2263, 0x08638408,
-    0x07250044, 0x01012f06, 0x27173237, 0x33363707, 0x07021f32, 0x17323613,
-    0x109cab01, 0x17019a10, 0xb7010a07, 0x0a012961, 0x572e0206, 0x0c049acb,
-    0x08563103, 0x19015608, 0xa2030902, 0x550509ff, 0x0601cd27, 0xbb820707,
-    0x00000331, 0xf301cdff, 0x0e006b01, 0x2e001700, 0x43250000, 0xdf590839,
-    0x17272c0d, 0x1d163233, 0x27012e01, 0x4207010e, 0x372208c4, 0x91426001,
-    0x2bb72c12, 0x131912aa, 0x4e3b1c31, 0x41150102, 0x87480646, 0x2bd62c14,
-    0x12511219, 0x4e020114, 0x42212a3b, 0x012106b5, 0x2093a800, 0x05d34e37,
-    0x11249382, 0x3337013e, 0x2621a185, 0x25939427, 0x99abfe1e, 0x8c860c06,
-    0xa0848020, 0x93941820, 0x17d58022, 0x2007ea43, 0x219e8401, 0x0082000a,
-    0x03820920, 0xc0010024, 0xff466b01, 0x001f2e08, 0x00330023, 0x00470037,
-    0x21352500, 0x2c038315, 0x21352135, 0x35331523, 0x37363423, 0x05965933,
-    0x2e230725, 0xa6173501, 0xc0012513, 0x1501ebfe, 0x56230385, 0x180c402b,
-    0x2008537c, 0x230c9815, 0x802a2a2b, 0x2a200284, 0x8605945c, 0x2a562106,
-    0xf34b0f9d, 0x0038280a, 0x1300004e, 0x8207010e, 0x013e30a4, 0x17011e37,
-    0x06222326, 0x013e1707, 0x83163233, 0x250885b9, 0x23012e37, 0x20850722,
-    0x2e222982, 0x24822701, 0x35832e20, 0x15273182, 0x33161723, 0x683f3221,
-    0x3536060c, 0x014232a0, 0x202a012a, 0x0d092518, 0x0a23170e, 0x0b100425,
-    0x1282120d, 0x0b0d122e, 0x0a250410, 0x0d0e1723, 0x20182509, 0x013c2382,
-    0x321e3242, 0x3e321010, 0x121d081e, 0x160d1eaa, 0x0d162801, 0x1d12aa1e,
-    0x95011e08, 0x0b211c82, 0x3725820b, 0x05151a01, 0x09151417, 0x200e120c,
-    0x0c120e20, 0x17141509, 0x011a1505, 0x0b216282, 0x346b820b, 0x1b17171b,
-    0x1c122bd5, 0x132d3408, 0x08342d13, 0x002b121c, 0x2de38400, 0x01d601f8,
-    0x00080080, 0x0100001c, 0xbf830616, 0xb182b982, 0x0f010e23, 0xb3671801,
-    0x60012a0b, 0x45412117, 0x29010150, 0x234f8221, 0x1f536201, 0x0ba24c18,
-    0x3755012a, 0x5d3d6870, 0x2b2a202b, 0x3b229282, 0x40194972, 0x01210c6e,
-    0x3b008200, 0x68019601, 0x00000500, 0x07170713, 0x15752517, 0x0115e0e0,
-    0x25680120, 0xa8258383, 0x2208175b, 0x829001ab, 0x82092023, 0x010d3825,
-    0x01273727, 0x8b352115, 0xe0fe2001, 0x01e1e116, 0x01c0fe36, 0x82a8a890,
-    0xaafe2130, 0x20056766, 0x37578402, 0x004101d6, 0x0025000b, 0x36273700,
-    0x0e071732, 0x22012b01, 0x26340526, 0x0728bd83, 0x26230706, 0x010e012f,
-    0x3c081682, 0x3b161715, 0xd3373201, 0x1f421f13, 0x080c0113, 0x010c0830,
-    0x080c0d01, 0x05261f2a, 0x050f620f, 0x082a1f26, 0x0c890d0c, 0x0b0c680c,
-    0x0a0a79bd, 0x0a0a0879, 0x06140d4a, 0x68163e25, 0x2929820d, 0x253e1668,
-    0x280d1406, 0x76830303, 0x04830420, 0x01dd012b, 0x001a0040, 0x002b0028,
-    0x82b3822e, 0x14152166, 0x35216482, 0x05c86623, 0x15231529, 0x37363233,
-    0x55012e35, 0x37540dea, 0x37ab3405, 0x0b0e0148, 0x30012b3c, 0x2b013049,
-    0x010e0b3c, 0x54b44802, 0x01350f23, 0x36490140, 0x550f0b66, 0x3030242b,
-    0x0f552b24, 0x4936660b, 0x22a51914, 0x09575c12, 0x1f000b22, 0x220da34e,
-    0x42163207, 0xd44106ac, 0x0cb14e09, 0x190e8b22, 0x0920a518, 0x0f0f2408,
-    0x0101312a, 0x02950121, 0x785b5a79, 0x5b780202, 0x0c7a785b, 0x210c0a0a,
-    0x25391e19, 0x39250e0e, 0x4621191e, 0xd6260727, 0x0b009601, 0xff821700,
-    0xcd760020, 0x0c576c0b, 0x82062221, 0x011f280e, 0x37013e37, 0x8223012e,
-    0x182e200d, 0x200d7553, 0x05124a5b, 0x19260584, 0x01012119, 0x83862a31,
-    0x97841920, 0x230c4b4f, 0x49600228, 0x05822984, 0x918b5020, 0x9741a183,
-    0xe7ff2306, 0x9782d301, 0x0a000334, 0x34002e00, 0x07010000, 0x06273717,
-    0x0e273716, 0x02820701, 0x013e172c, 0x27061617, 0x07163615, 0x17822606,
-    0x36163324, 0x1e823327, 0x82263621, 0x36272220, 0x081c8326, 0x01013e38,
-    0x20202040, 0x38900875, 0x4e5f132b, 0x20023c22, 0x1c113311, 0x32322438,
-    0x0571350e, 0x3236641a, 0x1220162f, 0x1b133671, 0x321f3a4d, 0x25a22235,
-    0x33010b6f, 0x34829501, 0x600b2e08, 0x1d204020, 0x1c020a0e, 0x0c113602,
-    0x0d251307, 0x1a26164b, 0x6039663f, 0x4f470160, 0x27594a4f, 0x5d080787,
-    0x694f3a10, 0x23565c3a, 0x05fb4232, 0x5f4ba582, 0x820a2005, 0x33073b09,
-    0x33352115, 0x35231507, 0x40d50001, 0x80402a01, 0xc08001aa, 0x2b15abab,
-    0x9748002b, 0x00062209, 0x222b8812, 0x5e153327, 0x232205ef, 0x33863335,
-    0x402aea23, 0x84028240, 0x402b2838, 0x2b40402b, 0x82000300, 0x77012000,
-    0x13290543, 0x00001800, 0x21112125, 0x0e966c35, 0x27010f23, 0x2bc88207,
-    0x2a01d6fe, 0x1912d6fe, 0x2a011219, 0x7d270582, 0xea3a2a3b, 0x182a012b,
-    0x230c674f, 0x4c334cc6, 0x00275182, 0xff000004, 0x50de01ea, 0x1c290677,
-    0x00003100, 0x17011e01, 0x125f4a06, 0x21010f25, 0x6c170727, 0x352705aa,
-    0x37363411, 0x82150633, 0x3732222a, 0x15c24f17, 0x014bc126, 0xd64b602b,
-    0x2a064262, 0x0b761218, 0x163b4f01, 0x4a013713, 0xdf341665, 0x36608060,
-    0x12181812, 0x18122b01, 0x3b1d1901, 0x3606014e, 0xdf20a389, 0x0826a382,
-    0x1b001600, 0xa3822f00, 0x09e84e18, 0x06270737, 0x34262223, 0x15163236,
-    0x37230714, 0x17013f17, 0x23061415, 0x070d5621, 0x07062e08, 0x01211123,
-    0x1f1f164b, 0x6720202c, 0x19431e42, 0x3837281a, 0xeb4b3850, 0x6c3a2a3b,
-    0xfe111a2b, 0x191911d5, 0x010a7611, 0x012b016b, 0x26258300, 0x42021f2c,
-    0x820f421e, 0x28382924, 0x324bdb1a, 0x6b2b074b, 0x01272383, 0x151a112b,
-    0x60d5fe16, 0x12220c0b, 0x8f821c00, 0xe7182320, 0x0634086d, 0x013e2726,
-    0x17012e17, 0x0717010f, 0x37271737, 0x06060127, 0x34058d43, 0x5b1c402f,
-    0x82030382, 0x3a441b5b, 0x133e4f20, 0x40164544, 0x0723434f, 0x181d4308,
-    0x53536215, 0x1c1a1562, 0x36064b5a, 0x4a2a2a4a, 0x00000636, 0xff000008,
-    0x01ba01ea, 0x000b0096, 0x0011000e, 0x001a0017, 0x0020001d, 0x01000023,
-    0x07172307, 0x33371733, 0x27233727, 0x010f2317, 0x71823b27, 0x37272328,
-    0x17072707, 0x11843723, 0x3e000127, 0x7c40407c, 0x3c05853e, 0x1837341a,
-    0x2a565719, 0xd52a562a, 0x18b8171a, 0x3119e92f, 0x011a1c35, 0x6b6b6a95,
-    0x2503826a, 0x2b202a2a, 0x00824b2b, 0x6b2b2b2a, 0x202b2b2b, 0x0d002a2a,
-    0x0026eb82, 0x5601d601, 0xf7520f00, 0x821f2006, 0x00272e7b, 0x002f002b,
-    0x00370033, 0x003f003b, 0x100f7f00, 0x7f152121, 0x5f180c06, 0x07231b85,
-    0x7f353315, 0xaa250b1a, 0xaafe5601, 0x695f1816, 0x88d62009, 0xaaea210a,
-    0x220c1b7f, 0x882ac0d6, 0x8c402000, 0x84b2840a, 0x46a02004, 0x012d05b7,
-    0x07170717, 0x158b0125, 0xfe15e1e1, 0x08b846e0, 0x46057745, 0x012b08b7,
-    0x2737010d, 0x21150137, 0x828b0135, 0x82202025, 0xcbfe232d, 0xb8464001,
-    0x5605200d, 0x0f4108f3, 0x13002509, 0x1115010e, 0x2709e857, 0x11330727,
-    0x33111323, 0x25055962, 0x95231533, 0xdf541812, 0x2bd62408, 0x82566b80,
-    0xab012100, 0x2d0ed754, 0x80fe2b01, 0x00ff4001, 0x56150001, 0xf742562a,
-    0x01d62609, 0x00190096, 0x050f4522, 0x0b6c6982, 0x33172c07, 0x3e33011e,
-    0x012e3701, 0x18072227, 0x200b0044, 0x8041181e, 0x15172909, 0x35273717,
-    0x013629b5, 0x65358183, 0x48203918, 0x61010161, 0x040b0b48, 0x1e172636,
-    0x1e016b01, 0x0720718c, 0x4801012c, 0x3f114e21, 0x36019501, 0x9b820a29,
-    0x1812c025, 0x82161401, 0x60492d2c, 0x31260202, 0x171e012a, 0x1e170a0a,
-    0x250b5371, 0x1c2f6b29, 0x6f495925, 0x0015250a, 0x13000021, 0x2905464f,
-    0x07173317, 0x0e273527, 0xa1822301, 0x82013e21, 0x08764d0c, 0x5440c02e,
-    0x110e0f01, 0x802a800c, 0x182e1312, 0x01280d82, 0x2d2d6d54, 0x1f2e2e1f,
-    0x83820584, 0x18405425, 0x8212132e, 0x110c2920, 0x54010f0e, 0x48544040,
-    0x23821d87, 0x73840020, 0xeb01ff28, 0x15008001, 0x73821900, 0x06074608,
-    0x17161107, 0x17013f32, 0x17352735, 0x26113315, 0x11072327, 0xc0353315,
-    0x01010778, 0x7202010a, 0x80805555, 0x72030a01, 0x298001ab, 0xbefe0802,
-    0x2c01010a, 0xfe1d2b1e, 0x0a01be2c, 0xfe2d010a, 0x002b2bed, 0x0aab7800,
-    0x59841120, 0x00001d29, 0x27010f01, 0x82150607, 0x375d825e, 0x11353637,
-    0x15170726, 0x1537012f, 0x35072507, 0x03b50137, 0x08788072, 0x06835983,
-    0x5656ea27, 0x0140406a, 0x2303822a, 0x2d2c0180, 0x09836988, 0x0a42012e,
-    0x1ef81e34, 0x19fa16e3, 0x18fa1611, 0xd520c384, 0x1b22c384, 0xc38c2700,
-    0x34352623, 0x24c68337, 0x1732013e, 0x18c98335, 0x880b928a, 0x045928d1,
-    0x11805601, 0x83142f2c, 0x4040237c, 0x74832b40, 0x1f247188, 0x08070f0e,
-    0xa024de82, 0xd2081210, 0xd320e082, 0x2b211f83, 0x08174d40, 0x2007f345,
-    0x19c75532, 0x15012f2d, 0x17141517, 0x26010f27, 0x83341127, 0x163328fd,
-    0x012e1517, 0x45072227, 0x363415f2, 0x1b061580, 0x01090472, 0x72807907,
-    0x13010a03, 0x10101c31, 0x3d14894c, 0x07fe2da9, 0x09121506, 0x0a01012c,
-    0x03074301, 0x012c2c28, 0x1412c709, 0x00000401, 0xf75b0004, 0x00962805,
-    0x0017000e, 0x99360032, 0x821320a1, 0x2726298f, 0x06150735, 0x11273507,
-    0x0523aa8c, 0x95353715, 0x823f20a5, 0x40182498, 0x89551417, 0xb8fe22ab,
-    0x21a68340, 0x9067171c, 0x0001210e, 0x0a299583, 0x0358197c, 0xfe1e6308,
-    0x27b18dff, 0xfa18fd49, 0x08000000, 0xd524af82, 0xab01eb01, 0x0a25b982,
-    0x10000d00, 0x05215800, 0xb7822420, 0x1527343b, 0x1e230736, 0x2f363201,
-    0x07371501, 0x23372733, 0x07222637, 0x14063503, 0x053f5525, 0x0116323e,
-    0x482b2bc0, 0x384616f0, 0xd6567746, 0x506b5656, 0x8635c8a0, 0x012b1d35,
-    0x8ac28aab, 0xc02a0282, 0x35f03741, 0x19191252, 0x0082ab3c, 0x2aa1352b,
-    0xf3fe2b2b, 0x438437f0, 0x221d8361, 0x8202008a, 0x01df247f, 0x829601ab,
-    0x1a280879, 0x21010000, 0x010e1715, 0x37011e17, 0x2e27013e, 0x03372701,
-    0x27370727, 0x011f013f, 0xfeab0107, 0x363b7caa, 0x3d6b1512, 0x0c360582,
-    0x6c7c2231, 0x37113f3f, 0x481d1d48, 0x2a950137, 0x3d6a165d, 0x1d83353c,
-    0x0c31222f, 0x25b5fe5d, 0x06304725, 0x30064343, 0x5f638400, 0x260805ff,
-    0x00090003, 0x07171300, 0x07171527, 0x80051501, 0x4ba050f0, 0xff00014b,
-    0x8a950100, 0x30154a40, 0x801501e5, 0x82030095, 0x02ea2293, 0x27938200,
-    0x0013000f, 0x2500002e, 0x081c7518, 0x2405c270, 0x33352307, 0x06bf4827,
-    0x09c66318, 0x1121352a, 0x35331521, 0xeb012634, 0x080aec19, 0x6b6b092c,
-    0x1380fe40, 0x95121918, 0xfa82ab2b, 0x8001eb2a, 0x0cd5182a, 0x0c09c009,
-    0xc0350484, 0x1218ea96, 0x191200ff, 0x2b2a2a2b, 0x6b00012b, 0x0018126b,
-    0x207f8e04, 0x2381b038, 0x23072707, 0x9f05c047, 0x14be298b, 0x14354115,
-    0x35143435, 0x9529959e, 0x3e264040, 0x263e2727, 0x068b5400, 0x9401f322,
-    0x27062f42, 0x001f0019, 0x01000028, 0x2d123f61, 0x35231527, 0x3505011e,
-    0x1537013e, 0xc37f0e17, 0x21260805, 0x3d0aab01, 0x0a3d2e2e, 0x3b3b0f31,
-    0x1415310f, 0x80941414, 0xd6fe4837, 0xab374702, 0x403f5402, 0x2b010254,
-    0x22832b01, 0x3806704c, 0x48142828, 0x156e1428, 0x4f5109a9, 0x09513a15,
-    0x54406ba9, 0x40540101, 0x056f4340, 0xd601ea34, 0x12009601, 0x1a001600,
-    0x00001e00, 0x27263601, 0x6d83010e, 0x14062e08, 0x34362117, 0x05012e27,
-    0x33273317, 0x33373317, 0x01373307, 0x2f270155, 0x2201272f, 0x2b2b0232,
-    0x2b2b5601, 0xf4fe3202, 0x2a152b2a, 0x27018216, 0x012a2b15, 0x04380455,
-    0xce570282, 0x95d4210a, 0x2108cb57, 0xcb4a0004, 0x50562005, 0x0025086f,
-    0x21352125, 0x24038215, 0x23153325, 0x25ef8217, 0x00ffc001, 0x03830001,
-    0x2b95fe22, 0xeb250082, 0xc02aaa2a, 0x470882ea, 0x962909db, 0x13005e01,
-    0x17010000, 0x84338207, 0x37272403, 0x83333523, 0x2c012903, 0x6b591828,
-    0x1fa29025, 0x6c2b0782, 0x01a29024, 0x2a38115e, 0x84492a56, 0x82588205,
-    0xab012545, 0x07006b01, 0x21223f82, 0x01833311, 0xfeab012a, 0x5655abaa,
-    0xaafe6b01, 0x21827883, 0x4b06af4b, 0x0b380573, 0x11130000, 0x21051121,
-    0x23352311, 0x01402315, 0x01c0fe80, 0x80404000, 0x03820882, 0x00ff4024,
-    0x3383c0c0, 0x04830c20, 0x01960123, 0x185b8280, 0x20132174, 0x26478333,
-    0x15333533, 0x82051133, 0x183720b7, 0x830edb52, 0x276b180f, 0x806b2e13,
-    0x00ff802a, 0x2a562b2b, 0x2b2b552a, 0x820893ab, 0x258b8314, 0x80014b4b,
-    0x00832a2b, 0x00842b20, 0x05842a20, 0xcf861183, 0xf7828020, 0x00249983,
-    0x15231513, 0x353e8782, 0x35233533, 0x35211503, 0x2a6b6beb, 0x01956b6b,
-    0x6b6b0100, 0x2b6a6a2b, 0x2bd5fe6b, 0x0082002b, 0xd3840320, 0x8001c028,
-    0x1b000f00, 0xe3541f00, 0x09c24c13, 0xd754bd83, 0x4caa200a, 0x402205ca,
-    0xc654aaaa, 0x2b40250e, 0x952b4040, 0x3008db64, 0x01e001f5, 0x000700a0,
-    0x0034001c, 0x2500003d, 0x05874f15, 0x011e2732, 0x27070617, 0x012e3536,
-    0x14070622, 0x27260717, 0x2005a651, 0x20158314, 0x07b15337, 0x012e0726,
-    0x17013e35, 0x083b4a18, 0xd66b2f08, 0x3d5a3d01, 0x024e3b6a, 0x0b211401,
-    0x36523601, 0x14210b01, 0x3b4e0201, 0x16027f5f, 0x011e2014, 0x4d4d6602,
-    0x1e010266, 0x02161420, 0xa35a5f7f, 0x463b2605, 0x1e1e1646, 0x302582fa,
-    0x141d2029, 0x36362918, 0x1d141829, 0x4e3b2920, 0x25238257, 0x1c1b4225,
-    0x3482392d, 0x392b3a82, 0x421b1c2d, 0xa97f5f25, 0x821e2e1e, 0x43002002,
-    0xdc2d07cf, 0x0d009501, 0x19001300, 0x25001f00, 0x18dc8200, 0x3c0e7b47,
-    0x36170706, 0x07060737, 0x17373633, 0x17072707, 0x17160537, 0x17272637,
-    0x35171607, 0x7d471826, 0x7820080c, 0x251e3240, 0x0629902f, 0xd21c072a,
-    0x44162e68, 0x07cbfe7e, 0x061c1e28, 0x40321e40, 0x2b95012f, 0x0b834718,
-    0x29060826, 0x22061d1f, 0x25271882, 0x172d681e, 0x84497f44, 0x1d73253d,
-    0x072a0729, 0x8e829bb2, 0x13219588, 0x20a98215, 0x209b9835, 0x2394894d,
-    0x7010604f, 0x7e209899, 0x0126928a, 0x1b39700f, 0xd7658044, 0x0d374109,
-    0x002c6f08, 0x011e0100, 0x07061617, 0x37013e35, 0x012f2636, 0x27070615,
-    0x06170736, 0x07362307, 0x07171633, 0x17161726, 0x37272615, 0x33353327,
-    0x15013315, 0x0709684e, 0x503c5a6c, 0x48540709, 0x1e252f2a, 0x1c1e5032,
-    0x06062a07, 0x1e1c062b, 0x2f256428, 0x60873240, 0x014b2a4b, 0x4e690995,
-    0x2b0b845a, 0x493b5108, 0x2b2a0b6b, 0x291f1d06, 0x1f821e47, 0x34836a20,
-    0x33823320, 0x45290725, 0x41555560, 0x97a81533, 0x82071321, 0xce352095,
-    0x05012197, 0x6f619883, 0x019a2605, 0x000900ab, 0x05bf5a1c, 0x5a150121,
-    0x33350508, 0x14151732, 0x37361716, 0x26272611, 0x16060706, 0x16331617,
-    0x23128213, 0x27013e37, 0x15231283, 0x43363427, 0x26080522, 0x02010201,
-    0x26333326, 0x161d0102, 0x06010106, 0x16196d3b, 0x1a1a3a30, 0x04025805,
-    0x09270a30, 0x1d02040a, 0x82111911, 0x34013302, 0x010103ac, 0xf4334c33,
-    0x03201734, 0x86010501, 0x2a820305, 0x196d3c34, 0x0301010a, 0x030405da,
-    0x0b31772a, 0x05040308, 0x2f830d42, 0xcd181120, 0x313e0cbf, 0x39003500,
-    0x00004200, 0x23070637, 0x23352726, 0x3527012e, 0x2133013e, 0x35072135,
-    0x07823634, 0x32153330, 0x23011d16, 0x16323315, 0x010e1517, 0xcc822307,
-    0x21212983, 0x067d5d27, 0x735b2520, 0x016b2607, 0x010a150a, 0x050a5615,
-    0xff6a012c, 0x090c1500, 0x092b0001, 0x1386150c, 0x20841520, 0x2bd6fe27,
-    0x012b152b, 0x05815b0a, 0xa5824b20, 0x010a0a29, 0x0940090c, 0x82162b0c,
-    0x1616252c, 0x2b15090c, 0x01200f84, 0x03821882, 0x82154021, 0x0c0b2300,
-    0x02820c12, 0x09736018, 0x1d008022, 0x90830c82, 0x37011f23, 0x05734423,
-    0x22230d82, 0x4d072726, 0x01290776, 0x026d5115, 0x56025340, 0x05704740,
-    0x19540221, 0x240ceb6b, 0x6c028001, 0xe76b1952, 0x00002f15, 0x00000200,
-    0xc001d5ff, 0x0900ab01, 0x69821500, 0x08258218, 0x27010f2c, 0x27372707,
-    0x17371737, 0x82180107, 0x55230719, 0x874d4d1e, 0x18012002, 0x20090f82,
-    0x18168ae2, 0x8508674c, 0x00202253, 0x82558b29, 0x151733b4, 0x011d1632,
-    0x23070614, 0x013d012e, 0x35333634, 0x5318013e, 0xc03a0a94, 0x54546a02,
-    0x17c0026a, 0x0f0a0124, 0x0a760b10, 0x010a0f0f, 0x130d1724, 0x718a1340,
-    0x1e012a2b, 0x0b102017, 0x010f0a4b, 0x29068401, 0x191e1720, 0x20200d0f,
-    0xd38b0f0d, 0x11000a32, 0x37130000, 0x06270701, 0x27012e07, 0x15173735,
-    0x01287882, 0x84011c15, 0x3c2f2f1b, 0xc03c6783, 0xdffe1214, 0xfe1b6501,
-    0x2b301b7b, 0x5b8e1710, 0x80567165, 0x011e4624, 0x00040022, 0x01240082,
-    0x00eb00eb, 0x20056b50, 0x093f4230, 0x27262222, 0x3729b682, 0x17011e21,
-    0x2b010e15, 0x102d4201, 0x14010e27, 0x34363216, 0x0d2d4226, 0x3542aa20,
-    0x13214205, 0x01097525, 0x420b0901, 0x27420510, 0x840b2005, 0x05164211,
-    0x17420120, 0x09a35507, 0x82002621, 0x8325208f, 0x23172ecf, 0x23072327,
-    0x3d012e37, 0x21352301, 0x31e88235, 0x15160706, 0x37013e23, 0x33013e33,
-    0x011d1632, 0xff672123, 0xc0012f07, 0x2a0e1a1f, 0x2a0bc00b, 0x151f1a0e,
-    0x6a828001, 0x05102308, 0x24018015, 0x2007041b, 0x40241c15, 0x1c24d6fe,
-    0x95241caa, 0x0e311f15, 0x372a2a37, 0x151f310e, 0xb782952b, 0x120f022c,
-    0x01241b1d, 0x1c241713, 0x088215c0, 0x00313282, 0x000e0000, 0x01eaff00,
-    0x009601c0, 0x00110008, 0x8151181a, 0x00502c0a, 0x00620059, 0x006f006b,
-    0x18000079, 0x20087251, 0x05f84323, 0x9a363421, 0x7c591808, 0x4cbb8208,
-    0x0891059b, 0xe9182720, 0x2388104c, 0x35213724, 0xfd832721, 0x15333526,
-    0xab01011e, 0x20058143, 0x2006854d, 0x86068c4c, 0x85342014, 0x855e2014,
-    0x8c5f2006, 0x8ccc200d, 0x2d22860d, 0x01d6fe49, 0x07fc172a, 0x292a2939,
-    0x92181539, 0x0b910be3, 0x0c029318, 0x18921e8b, 0x152b2b2a, 0x2c073929,
-    0x0039072c, 0x07200082, 0x00320382, 0x8001dd01, 0x18000f00, 0x29002600,
-    0x3b003200, 0xf7483e00, 0x07f97208, 0x59692320, 0x10235808, 0x08115218,
-    0x90421720, 0x011f2307, 0xb0745507, 0x83122009, 0x1924230b, 0x3458fc19,
-    0x00ff310d, 0x49303024, 0x12253030, 0x18241919, 0x1414ee18, 0x09a34818,
-    0x122a0124, 0xa0732b19, 0x582a2005, 0x05240e44, 0x30483001, 0x29210282,
-    0x054d6b01, 0x14140423, 0x0eb74900, 0xc7821a20, 0x11a78518, 0x2315332a,
-    0x23272307, 0x37173335, 0x2c15965e, 0x3b85a5a5, 0x3a1a262a, 0x26266b1b,
-    0x4902871e, 0x2b250ec9, 0x5c2b80d5, 0x221c834f, 0x82271e27, 0x18262002,
-    0x280d5765, 0x00150009, 0x3f000021, 0x05824e01, 0x11271722, 0x550ba052,
-    0x3e2e0536, 0x012e3701, 0x544014b7, 0x40542121, 0x2d554914, 0x58058505,
-    0x022f0731, 0x53506002, 0x4e4d0837, 0x2c533707, 0x18021901, 0x580970f2,
-    0x002f0b57, 0xff000004, 0x01d601f5, 0x0009008b, 0x831b0012, 0x55012079,
-    0xaf410888, 0x08b34208, 0x0e330738, 0x01262201, 0x59894c00, 0x08848408,
-    0x0a848959, 0x0e140e0e, 0x06857a0e, 0x08806e31, 0x01232a23, 0x6d24778b,
-    0x8e34348e, 0x8334246d, 0x841f821c, 0x14602302, 0xeb831616, 0x04830620,
-    0x01c00123, 0x088b436b, 0x31002a38, 0x23370000, 0x37363435, 0x01231533,
-    0x3e331523, 0x23013d01, 0x0f6c3505, 0x13352105, 0x3e05794b, 0x15072634,
-    0x23152737, 0x07352515, 0x35333517, 0x12192b6b, 0x2a018080, 0x19128080,
-    0x83d6fe2b, 0x80aa2a0d, 0xfc192b80, 0x016b4040, 0x2c048215, 0x181255eb,
-    0x00ff2b01, 0x1218012b, 0x83008255, 0x2b01230d, 0x1682552b, 0x402bbf26,
-    0x2a2a2b40, 0x41180584, 0x6b270ac7, 0x22001200, 0x62002600, 0x2323064f,
-    0x82112135, 0x012e2791, 0x013e1127, 0x5e773305, 0x35332b0f, 0x126b0140,
-    0xebfe5518, 0x5b82ebc0, 0x01180128, 0x0c09803d, 0x0482090c, 0x0c010126,
-    0x6b01551e, 0x2b207882, 0x01288086, 0x7f181200, 0xd5090c01, 0x04822183,
-    0x95952a23, 0x08a75800, 0xdb4d4020, 0x01002706, 0x11352115, 0x78823533,
-    0x0121352d, 0xc080fec0, 0xfe8001c0, 0x84400180, 0x2a402145, 0x2109674d,
-    0x3d8301ab, 0x82000721, 0x211522a9, 0x2ba48215, 0xfe560155, 0x01d6d6aa,
-    0x2b2a2b00, 0x20061346, 0xdf4318ab, 0x8221200c, 0x87038727, 0x8633832f,
-    0x2a552237, 0x1839822b, 0x0808c758, 0x9601c023, 0x1c001200, 0x24002000,
-    0x33170000, 0x37013e35, 0x2b263435, 0x07062201, 0x16142315, 0x0e212717,
-    0x23098201, 0x37012e35, 0x24084c82, 0x35331537, 0x2d27abc0, 0x55121901,
-    0xd5011812, 0x014f4040, 0x1d29091e, 0xc44c2355, 0x2b155555, 0x531b3515,
-    0x05817832, 0x1955322f, 0x0e2f1f75, 0x35072424, 0x4095abf6, 0x06034140,
-    0x8001d622, 0x15250982, 0x00002f00, 0x204c8213, 0x05935813, 0x33013d22,
-    0x03840c82, 0x3b362522, 0x096cc918, 0x1f323327, 0x23352301, 0x3c038415,
-    0x199580c0, 0x11aafe11, 0x802b6a19, 0x8bfe6a2b, 0x190e1c0b, 0x19128012,
-    0x2c0b1c0e, 0x2a128261, 0x15550161, 0x11ebfe15, 0x82111a1a, 0x15152c08,
-    0x12151a91, 0x15121919, 0x8215661a, 0x062b4100, 0x0b297f83, 0x1b001700,
-    0x00003900, 0x825a8725, 0x07372307, 0x80843533, 0x2f331523, 0x238c8201,
-    0x011d1617, 0x34229c87, 0x958d013f, 0xab011723, 0x23718240, 0x33253240,
-    0x33250682, 0x9280b925, 0x219b8503, 0x968a3203, 0x87844020, 0x85d55521,
-    0x15402606, 0x0a07a215, 0x239f8362, 0x73070a62, 0x00209d87, 0x01230082,
-    0x50ff0000, 0x2d25056b, 0x15130000, 0x05675d33, 0x82013d21, 0x34352308,
-    0x8f822b26, 0x32211188, 0x20168236, 0x66a41a35, 0x2b232a08, 0x136a6a6a,
-    0x186b6b18, 0x83088213, 0x18122509, 0x12188080, 0x012b0f82, 0x2a562a95,
-    0xd6161218, 0x85181216, 0x12182609, 0x12562a56, 0x4a0f8218, 0xd62a088f,
-    0x14002b01, 0x2c001e00, 0x79863000, 0x1d062224, 0x60823301, 0x2106e85d,
-    0x316f3327, 0x33352305, 0x32603335, 0x23108305, 0x07272634, 0x2b229c82,
-    0x6e822b55, 0x04825620, 0x1801012e, 0x402b4012, 0x12405540, 0x2b2b0118,
-    0x2b227782, 0x08822b2b, 0x73822b20, 0x04822b20, 0xd6222283, 0x13822a56,
-    0xab121825, 0x83ab4040, 0x00402125, 0x3708f785, 0x00a00176, 0x01000012,
-    0x14152313, 0x27262206, 0x14153335, 0x37363216, 0x00012335, 0x37246075,
-    0x0c2b0124, 0x60010c12, 0xe1fe9f01, 0x24241c55, 0x0915151c, 0x55090c0c,
-    0x2a0db35d, 0x005a001c, 0x011e3700, 0x4f013e17, 0x172b0501, 0x3e34012e,
-    0x021e3202, 0x82020e14, 0x010e2655, 0x37363417, 0x05d64136, 0x1e272626,
-    0x33013f01, 0x35332b82, 0x2f26010e, 0x36373402, 0x010e013f, 0x23272615,
-    0x821d011e, 0x26072409, 0x8235012f, 0x3e35228c, 0x18f68201, 0x280bc9f7,
-    0x1f1f1d43, 0x4a524a3a, 0x2406853a, 0x02061e06, 0x08af8213, 0x0904082b,
-    0x03471901, 0x261c011f, 0x0c171126, 0x01010203, 0x280f0e08, 0x09090829,
-    0x14010a06, 0x03040b0b, 0x02060803, 0x35190118, 0x0ac945c0, 0x891deb21,
-    0x0851824a, 0x3325e239, 0x17210101, 0x63090213, 0x01010507, 0x2001121f,
-    0x023b1918, 0x02010d11, 0x07364002, 0x0a13110e, 0x01050221, 0x6a081004,
-    0x01010d01, 0x03830407, 0x16120a0b, 0x51002206, 0x402c0897, 0x17001300,
-    0x35250000, 0x2123012e, 0x2d055b70, 0x36322133, 0x35173537, 0x33352307,
-    0x49186b01, 0x55240d32, 0xe0abab95, 0x09264918, 0xea554b24, 0x4b8c2a8a,
-    0x4b971f20, 0x35231522, 0x35224f82, 0x53921533, 0x402b4022, 0x578e0282,
-    0x2a404026, 0x0a004040, 0x3208eb42, 0x0016000b, 0x00270020, 0x00390030,
-    0x004f0043, 0x1863005b, 0x2b0d295b, 0x37013e13, 0x010e2726, 0x27321607,
-    0x06210a82, 0x320a8307, 0x06272625, 0x25013e07, 0x16141706, 0x26373617,
-    0x83070637, 0x012e2107, 0x1e210882, 0x24118201, 0x2617012e, 0x24148423,
-    0x26173233, 0x200b8d27, 0x602c8322, 0x58080c2b, 0x0d36267d, 0x420f1615,
-    0x4d22102f, 0x18104530, 0x2e431217, 0x0b080115, 0x2d3c170b, 0x029afe39,
-    0x131c1f01, 0x14053c10, 0x1146200a, 0x2f35270e, 0x32091216, 0x220a0c27,
-    0x2c29fa2a, 0x0f0b363d, 0x2d332f2a, 0x11103c03, 0x0906424a, 0x2326423b,
-    0x2e273910, 0x03011e22, 0x0ce65f44, 0x7bfe5108, 0x04355d25, 0x23613a02,
-    0x5e200902, 0x32050239, 0x9b0e194e, 0x475e0305, 0x0a515315, 0x1945280a,
-    0xa8390c09, 0x425c1e18, 0x5d24100e, 0x37110b65, 0x1412245e, 0x0c2e5923,
-    0x11131501, 0x601a110f, 0x141a0102, 0x1c081814, 0x130b152c, 0x00001a12,
-    0x2e055f47, 0x008001d7, 0x0027001e, 0x003c002d, 0x41440040, 0x1428053f,
-    0x16323307, 0x2716011f, 0x2805c044, 0x013f0635, 0x013b013e, 0x05db4c26,
-    0x2e050a4c, 0x35331507, 0x15333523, 0x3d363233, 0x83273401, 0x23262604,
-    0x23153307, 0x08038215, 0x2400012f, 0x360b0130, 0x26041610, 0x12180207,
-    0x1812aafe, 0x04260702, 0x0b361016, 0x12243001, 0x18241818, 0x406b9218,
-    0x1813406a, 0x13180f0f, 0x21008315, 0x1a828001, 0x13131834, 0x021d990e,
-    0x12191912, 0x0e991d02, 0x24181313, 0x9e492a30, 0xaa803405, 0x18aa802a,
-    0x0d130b12, 0x120b130d, 0x2a162a18, 0x42040016, 0x1029080b, 0x19001400,
-    0x00001d00, 0x08fb4813, 0x35373527, 0x35231523, 0x2c038237, 0x27070607,
-    0x23070537, 0x4e3bb537, 0x05b36f01, 0x2bea9533, 0x15392b2b, 0x01223113,
-    0x3335212d, 0x4f010001, 0x301c853b, 0x2b402922, 0x6a6a952b, 0x430b0570,
-    0x462d1919, 0x24008300, 0x00c60010, 0x82088301, 0x82152005, 0x240b8507,
-    0x00070002, 0x20178615, 0x20098203, 0x200b861c, 0x200b8204, 0x240b8631,
-    0x000b0005, 0x200b8646, 0x20178206, 0x240b8651, 0x002b000a, 0x2a0b8666,
-    0x0013000b, 0x00030091, 0x82090401, 0x002a2211, 0x240b86a4, 0x000e0002,
-    0x240b86ce, 0x002a0003, 0x240b86dc, 0x012a0004, 0x240b8606, 0x01160005,
-    0x200b8630, 0x20178206, 0x240b8646, 0x0156000a, 0x080b8670, 0x26000b20,
-    0x614dc601, 0x69726574, 0x44206c61, 0x67697365, 0x6349206e, 0x52736e6f,
-    0x6c756765, 0x1b947261, 0x562a1494, 0x69737265, 0x31206e6f, 0x1f94302e,
-    0x6e654724, 0x69827265, 0x20642a08, 0x73207962, 0x74326776, 0x66206674,
-    0x206d6f72, 0x746e6f46, 0x6f6c6c65, 0x6f727020, 0x7463656a, 0x7474682e,
-    0x2f2f3a70, 0x2f178666, 0x6d6f632e, 0x61004d00, 0x65007400, 0x69007200,
-    0x6c240982, 0x44002000, 0x73200d82, 0x67220d82, 0x0d826e00, 0x63004924,
-    0x09826f00, 0x52007322, 0x67261782, 0x6c007500, 0x2d826100, 0x29a937a9,
-    0x87845620, 0x6f207b83, 0x31247b84, 0x30002e00, 0x4720a1aa, 0x6e203f82,
-    0xd3854384, 0xbf826420, 0x79006222, 0x73260582, 0x67007600, 0xe9823200,
-    0x66007422, 0x66200f82, 0x6f22c182, 0x09826d00, 0xdd844620, 0x35827420,
-    0xd9826c20, 0x11826f20, 0x1b847020, 0x11826a20, 0x2f826320, 0x68002e22,
-    0x70243584, 0x2f003a00, 0x66200182, 0x2e222f8e, 0x11826300, 0x00006d25,
-    0x85000200, 0x85052000, 0x07058f06, 0xb6098913, 0x02010000, 0x04010301,
-    0x06010501, 0x08010701, 0x0a010901, 0x0c010b01, 0x0e010d01, 0x10010f01,
-    0x12011101, 0x14011301, 0x16011501, 0x18011701, 0x1a011901, 0x1c011b01,
-    0x1e011d01, 0x20011f01, 0x22012101, 0x24012301, 0x26012501, 0x28012701,
-    0x2a012901, 0x2c012b01, 0x2e012d01, 0x30012f01, 0x32013101, 0x34013301,
-    0x36013501, 0x38013701, 0x3a013901, 0x3c013b01, 0x3e013d01, 0x40013f01,
-    0x42014101, 0x44014301, 0x46014501, 0x48014701, 0x4a014901, 0x4c014b01,
-    0x4e014d01, 0x50014f01, 0x52015101, 0x54015301, 0x56015501, 0x58015701,
-    0x5a015901, 0x5c015b01, 0x5e015d01, 0x60015f01, 0x62016101, 0x64016301,
-    0x66016501, 0x68016701, 0x6a016901, 0x6c016b01, 0x6e016d01, 0x70016f01,
-    0x72017101, 0x74017301, 0x76017501, 0x78017701, 0x7a017901, 0x7c017b01,
-    0x7e017d01, 0x80017f01, 0x82018101, 0x84018301, 0x86018501, 0x88018701,
-    0x8a018901, 0x8c018b01, 0x8e018d01, 0x90018f01, 0x92019101, 0x94019301,
-    0x96019501, 0x98019701, 0x9a019901, 0x9c019b01, 0x9e019d01, 0xa0019f01,
-    0xa201a101, 0xa401a301, 0xa601a501, 0xa801a701, 0xaa01a901, 0xac01ab01,
-    0xae01ad01, 0xb001af01, 0xb201b101, 0xb401b301, 0xb601b501, 0xb801b701,
-    0xba01b901, 0xbc01bb01, 0xbe01bd01, 0xc001bf01, 0xc201c101, 0xc401c301,
-    0xc601c501, 0xc801c701, 0xca01c901, 0xcc01cb01, 0xce01cd01, 0xd001cf01,
-    0xd201d101, 0xd401d301, 0xd601d501, 0xd801d701, 0xda01d901, 0xdc01db01,
-    0xde01dd01, 0xe001df01, 0xe201e101, 0xe401e301, 0xe601e501, 0xe801e701,
-    0xea01e901, 0xec01eb01, 0xee01ed01, 0xf001ef01, 0xf201f101, 0xf401f301,
-    0xf601f501, 0xf801f701, 0xfa01f901, 0xfc01fb01, 0xfe01fd01, 0x0002ff01,
-    0x02020102, 0x04020302, 0x06020502, 0x08020702, 0x0a020902, 0x0c020b02,
-    0x0e020d02, 0x10020f02, 0x12021102, 0x14021302, 0x16021502, 0x18021702,
-    0x1a021902, 0x1c021b02, 0x1e021d02, 0x20021f02, 0x22022102, 0x24022302,
-    0x26022502, 0x28022702, 0x2a022902, 0x2c022b02, 0x2e022d02, 0x30022f02,
-    0x32023102, 0x34023302, 0x36023502, 0x38023702, 0x3a023902, 0x3c023b02,
-    0x3e023d02, 0x40023f02, 0x42024102, 0x44024302, 0x46024502, 0x48024702,
-    0x4a024902, 0x4c024b02, 0x4e024d02, 0x50024f02, 0x52025102, 0x54025302,
-    0x56025502, 0x58025702, 0x5a025902, 0x5c025b02, 0x5e025d02, 0x60025f02,
-    0x62026102, 0x64026302, 0x66026502, 0x68026702, 0x6a026902, 0x6c026b02,
-    0x6e026d02, 0x70026f02, 0x72027102, 0x74027302, 0x76027502, 0x78027702,
-    0x7a027902, 0x7c027b02, 0x7e027d02, 0x80027f02, 0x82028102, 0x84028302,
-    0x86028502, 0x88028702, 0x8a028902, 0x8c028b02, 0x8e028d02, 0x90028f02,
-    0x92029102, 0x94029302, 0x96029502, 0x98029702, 0x9a029902, 0x9c029b02,
-    0x9e029d02, 0xa0029f02, 0xa202a102, 0xa402a302, 0xa602a502, 0xa802a702,
-    0xaa02a902, 0xac02ab02, 0xae02ad02, 0xb002af02, 0xb202b102, 0xb402b302,
-    0xb602b502, 0xb802b702, 0xba02b902, 0xbc02bb02, 0xbe02bd02, 0xc002bf02,
-    0xc202c102, 0xc402c302, 0xc602c502, 0xc802c702, 0xca02c902, 0xcc02cb02,
-    0xce02cd02, 0xd002cf02, 0xd202d102, 0xd402d302, 0xd602d502, 0xd802d702,
-    0xda02d902, 0xdc02db02, 0xde02dd02, 0xe002df02, 0xe202e102, 0xe402e302,
-    0xe602e502, 0xe802e702, 0xea02e902, 0xec02eb02, 0xee02ed02, 0xf002ef02,
-    0xf202f102, 0xf402f302, 0xf602f502, 0xf802f702, 0xfa02f902, 0xfc02fb02,
-    0xfe02fd02, 0x0003ff02, 0x02030103, 0x04030303, 0x06030503, 0x08030703,
-    0x0a030903, 0x0c030b03, 0x0e030d03, 0x10030f03, 0x12031103, 0x14031303,
-    0x16031503, 0x18031703, 0x1a031903, 0x1c031b03, 0x1e031d03, 0x20031f03,
-    0x22032103, 0x24032303, 0x26032503, 0x28032703, 0x2a032903, 0x2c032b03,
-    0x2e032d03, 0x30032f03, 0x32033103, 0x34033303, 0x36033503, 0x38033703,
-    0x3a033903, 0x3c033b03, 0x3e033d03, 0x40033f03, 0x42034103, 0x44034303,
-    0x46034503, 0x48034703, 0x4a034903, 0x4c034b03, 0x4e034d03, 0x50034f03,
-    0x52035103, 0x54035303, 0x56035503, 0x58035703, 0x5a035903, 0x5c035b03,
-    0x5e035d03, 0x60035f03, 0x62036103, 0x64036303, 0x66036503, 0x68036703,
-    0x6a036903, 0x6c036b03, 0x6e036d03, 0x70036f03, 0x72037103, 0x74037303,
-    0x76037503, 0x78037703, 0x7a037903, 0x7c037b03, 0x7e037d03, 0x80037f03,
-    0x82038103, 0x84038303, 0x86038503, 0x88038703, 0x8a038903, 0x8c038b03,
-    0x8e038d03, 0x90038f03, 0x92039103, 0x94039303, 0x96039503, 0x98039703,
-    0x9a039903, 0x9c039b03, 0x9e039d03, 0xa0039f03, 0xa203a103, 0xa403a303,
-    0xa603a503, 0xa803a703, 0xaa03a903, 0xac03ab03, 0xae03ad03, 0xb003af03,
-    0xb203b103, 0xb403b303, 0xb603b503, 0xb803b703, 0xba03b903, 0xbc03bb03,
-    0xbe03bd03, 0xc003bf03, 0xc203c103, 0xc403c303, 0xc603c503, 0xc803c703,
-    0xca03c903, 0xcc03cb03, 0xce03cd03, 0xd003cf03, 0xd203d103, 0xd403d303,
-    0xd603d503, 0xd803d703, 0xda03d903, 0xdc03db03, 0xde03dd03, 0xe003df03,
-    0xe203e103, 0xe403e303, 0xe603e503, 0xe803e703, 0xea03e903, 0xec03eb03,
-    0xee03ed03, 0xf003ef03, 0xf203f103, 0xf403f303, 0xf603f503, 0xf803f703,
-    0xfa03f903, 0xfc03fb03, 0xfe03fd03, 0x0004ff03, 0x02040104, 0x04040304,
-    0x06040504, 0x08040704, 0x0a040904, 0x0c040b04, 0x0e040d04, 0x10040f04,
-    0x12041104, 0x14041304, 0x16041504, 0x18041704, 0x1a041904, 0x1c041b04,
-    0x1e041d04, 0x20041f04, 0x22042104, 0x24042304, 0x26042504, 0x28042704,
-    0x2a042904, 0x2c042b04, 0x2e042d04, 0x30042f04, 0x32043104, 0x34043304,
-    0x36043504, 0x38043704, 0x3a043904, 0x3c043b04, 0x3e043d04, 0x40043f04,
-    0x42044104, 0x44044304, 0x46044504, 0x48044704, 0x4a044904, 0x4c044b04,
-    0x4e044d04, 0x50044f04, 0x52045104, 0x54045304, 0x56045504, 0x58045704,
-    0x5a045904, 0x5c045b04, 0x5e045d04, 0x60045f04, 0x62046104, 0x64046304,
-    0x66046504, 0x68046704, 0x6a046904, 0x6c046b04, 0x6e046d04, 0x70046f04,
-    0x72047104, 0x74047304, 0x76047504, 0x78047704, 0x7a047904, 0x7c047b04,
-    0x7e047d04, 0x80047f04, 0x82048104, 0x84048304, 0x86048504, 0x88048704,
-    0x8a048904, 0x8c048b04, 0x8e048d04, 0x90048f04, 0x92049104, 0x94049304,
-    0x96049504, 0x98049704, 0x9a049904, 0x9c049b04, 0x9e049d04, 0xa0049f04,
-    0xa204a104, 0xa404a304, 0xa604a504, 0xa804a704, 0xaa04a904, 0xac04ab04,
-    0xae04ad04, 0xb004af04, 0xb204b104, 0xb404b304, 0xb604b504, 0xb804b704,
-    0xba04b904, 0xbc04bb04, 0xbe04bd04, 0xc004bf04, 0xc204c104, 0xc404c304,
-    0xc604c504, 0xc804c704, 0xca04c904, 0xcc04cb04, 0xce04cd04, 0xd004cf04,
-    0xd204d104, 0xd404d304, 0xd604d504, 0xd804d704, 0xda04d904, 0xdc04db04,
-    0xde04dd04, 0xe004df04, 0xe204e104, 0xe404e304, 0xe604e504, 0xe804e704,
-    0xea04e904, 0xec04eb04, 0xee04ed04, 0xf004ef04, 0xf204f104, 0xf404f304,
-    0xf604f504, 0xf804f704, 0xfa04f904, 0xfc04fb04, 0xfe04fd04, 0x0005ff04,
-    0x02050105, 0x04050305, 0x06050505, 0x08050705, 0x0a050905, 0x0c050b05,
-    0x0e050d05, 0x10050f05, 0x12051105, 0x14051305, 0x16051505, 0x18051705,
-    0x1a051905, 0x1c051b05, 0x1e051d05, 0x20051f05, 0x22052105, 0x24052305,
-    0x26052505, 0x28052705, 0x2a052905, 0x2c052b05, 0x2e052d05, 0x30052f05,
-    0x32053105, 0x34053305, 0x36053505, 0x38053705, 0x3a053905, 0x3c053b05,
-    0x3e053d05, 0x40053f05, 0x42054105, 0x44054305, 0x46054505, 0x48054705,
-    0x4a054905, 0x4c054b05, 0x4e054d05, 0x50054f05, 0x52055105, 0x54055305,
-    0x56055505, 0x58055705, 0x5a055905, 0x5c055b05, 0x5e055d05, 0x60055f05,
-    0x62056105, 0x64056305, 0x66056505, 0x68056705, 0x6a056905, 0x6c056b05,
-    0x6e056d05, 0x70056f05, 0x72057105, 0x74057305, 0x76057505, 0x78057705,
-    0x7a057905, 0x7c057b05, 0x7e057d05, 0x80057f05, 0x82058105, 0x84058305,
-    0x86058505, 0x88058705, 0x8a058905, 0x8c058b05, 0x8e058d05, 0x90058f05,
-    0x92059105, 0x94059305, 0x96059505, 0x98059705, 0x9a059905, 0x9c059b05,
-    0x9e059d05, 0xa0059f05, 0xa205a105, 0xa405a305, 0xa605a505, 0xa805a705,
-    0xaa05a905, 0xac05ab05, 0xae05ad05, 0xb005af05, 0xb205b105, 0xb405b305,
-    0xb605b505, 0xb805b705, 0xba05b905, 0xbc05bb05, 0xbe05bd05, 0xc005bf05,
-    0xc205c105, 0xc405c305, 0xc605c505, 0xc805c705, 0xca05c905, 0xcc05cb05,
-    0xce05cd05, 0xd005cf05, 0xd205d105, 0xd405d305, 0xd605d505, 0xd805d705,
-    0xda05d905, 0xdc05db05, 0xde05dd05, 0xe005df05, 0xe205e105, 0xe405e305,
-    0xe605e505, 0xe805e705, 0xea05e905, 0xec05eb05, 0xee05ed05, 0xf005ef05,
-    0xf205f105, 0xf405f305, 0xf605f505, 0xf805f705, 0xfa05f905, 0xfc05fb05,
-    0xfe05fd05, 0x0006ff05, 0x02060106, 0x04060306, 0x06060506, 0x08060706,
-    0x0a060906, 0x0c060b06, 0x0e060d06, 0x10060f06, 0x12061106, 0x14061306,
-    0x16061506, 0x18061706, 0x1a061906, 0x1c061b06, 0x1e061d06, 0x20061f06,
-    0x22062106, 0x24062306, 0x26062506, 0x28062706, 0x2a062906, 0x2c062b06,
-    0x2e062d06, 0x30062f06, 0x32063106, 0x34063306, 0x36063506, 0x38063706,
-    0x3a063906, 0x3c063b06, 0x3e063d06, 0x40063f06, 0x42064106, 0x44064306,
-    0x46064506, 0x48064706, 0x4a064906, 0x4c064b06, 0x4e064d06, 0x50064f06,
-    0x52065106, 0x54065306, 0x56065506, 0x58065706, 0x5a065906, 0x5c065b06,
-    0x5e065d06, 0x60065f06, 0x62066106, 0x64066306, 0x66066506, 0x68066706,
-    0x6a066906, 0x6c066b06, 0x6e066d06, 0x70066f06, 0x72067106, 0x74067306,
-    0x76067506, 0x78067706, 0x7a067906, 0x7c067b06, 0x7e067d06, 0x80067f06,
-    0x82068106, 0x84068306, 0x86068506, 0x88068706, 0x8a068906, 0x8c068b06,
-    0x8e068d06, 0x90068f06, 0x92069106, 0x94069306, 0x96069506, 0x98069706,
-    0x9a069906, 0x9c069b06, 0x9e069d06, 0xa0069f06, 0xa206a106, 0xa406a306,
-    0xa606a506, 0xa806a706, 0xaa06a906, 0xac06ab06, 0xae06ad06, 0xb006af06,
-    0xb206b106, 0xb406b306, 0xb606b506, 0xb806b706, 0xba06b906, 0xbc06bb06,
-    0xbe06bd06, 0xc006bf06, 0xc206c106, 0xc406c306, 0xc606c506, 0xc806c706,
-    0xca06c906, 0xcc06cb06, 0xce06cd06, 0xd006cf06, 0xd206d106, 0xd406d306,
-    0xd606d506, 0xd806d706, 0xda06d906, 0xdc06db06, 0xde06dd06, 0xe006df06,
-    0xe206e106, 0xe406e306, 0xe606e506, 0xe806e706, 0xea06e906, 0xec06eb06,
-    0xee06ed06, 0xf006ef06, 0xf206f106, 0xf406f306, 0xf606f506, 0xf806f706,
-    0xfa06f906, 0xfc06fb06, 0xfe06fd06, 0x0007ff06, 0x02070107, 0x04070307,
-    0x06070507, 0x08070707, 0x0a070907, 0x0c070b07, 0x0e070d07, 0x10070f07,
-    0x12071107, 0x14071307, 0x16071507, 0x18071707, 0x1a071907, 0x1c071b07,
-    0x1e071d07, 0x20071f07, 0x22072107, 0x24072307, 0x26072507, 0x28072707,
-    0x2a072907, 0x2c072b07, 0x2e072d07, 0x30072f07, 0x32073107, 0x34073307,
-    0x36073507, 0x38073707, 0x3a073907, 0x3c073b07, 0x3e073d07, 0x40073f07,
-    0x42074107, 0x44074307, 0x46074507, 0x48074707, 0x4a074907, 0x4c074b07,
-    0x4e074d07, 0x50074f07, 0x52075107, 0x54075307, 0x56075507, 0x58075707,
-    0x5a075907, 0x5c075b07, 0x5e075d07, 0x60075f07, 0x62076107, 0x64076307,
-    0x66076507, 0x68076707, 0x6a076907, 0x6c076b07, 0x6e076d07, 0x70076f07,
-    0x72077107, 0x74077307, 0x76077507, 0x78077707, 0x7a077907, 0x7c077b07,
-    0x7e077d07, 0x80077f07, 0x82078107, 0x84078307, 0x86078507, 0x88078707,
-    0x8a078907, 0x8c078b07, 0x8e078d07, 0x90078f07, 0x92079107, 0x94079307,
-    0x96079507, 0x98079707, 0x9a079907, 0x9c079b07, 0x9e079d07, 0xa0079f07,
-    0xa207a107, 0xa407a307, 0xa607a507, 0xa807a707, 0xaa07a907, 0xac07ab07,
-    0xae07ad07, 0xb007af07, 0xb207b107, 0xb407b307, 0xb607b507, 0xb807b707,
-    0xba07b907, 0xbc07bb07, 0xbe07bd07, 0xc007bf07, 0xc207c107, 0xc407c307,
-    0xc607c507, 0xc807c707, 0xca07c907, 0xcc07cb07, 0xce07cd07, 0xd007cf07,
-    0xd207d107, 0xd407d307, 0xd607d507, 0xd807d707, 0xda07d907, 0xdc07db07,
-    0xde07dd07, 0xe007df07, 0xe207e107, 0xe407e307, 0xe607e507, 0xe807e707,
-    0xea07e907, 0xec07eb07, 0xee07ed07, 0xf007ef07, 0xf207f107, 0xf407f307,
-    0xf607f507, 0xf807f707, 0xfa07f907, 0xfc07fb07, 0xfe07fd07, 0x0008ff07,
-    0x02080108, 0x04080308, 0x06080508, 0x08080708, 0x0a080908, 0x0c080b08,
-    0x0e080d08, 0x10080f08, 0x12081108, 0x14081308, 0x16081508, 0x18081708,
-    0x1a081908, 0x1c081b08, 0x1e081d08, 0x20081f08, 0x22082108, 0x24082308,
-    0x26082508, 0x28082708, 0x2a082908, 0x2c082b08, 0x2e082d08, 0x30082f08,
-    0x32083108, 0x34083308, 0x36083508, 0x38083708, 0x3a083908, 0x3c083b08,
-    0x3e083d08, 0x40083f08, 0x42084108, 0x44084308, 0x46084508, 0x48084708,
-    0x4a084908, 0x4c084b08, 0x4e084d08, 0x50084f08, 0x52085108, 0x54085308,
-    0x56085508, 0x58085708, 0x5a085908, 0x5c085b08, 0x5e085d08, 0x60085f08,
-    0x62086108, 0x64086308, 0x66086508, 0x68086708, 0x6a086908, 0x6c086b08,
-    0x6e086d08, 0x70086f08, 0x72087108, 0x74087308, 0x76087508, 0x78087708,
-    0x7a087908, 0x7c087b08, 0x7e087d08, 0x80087f08, 0x82088108, 0x84088308,
-    0x86088508, 0x88088708, 0x8a088908, 0x8c088b08, 0x8e088d08, 0x90088f08,
-    0x92089108, 0x94089308, 0x96089508, 0x98089708, 0x9a089908, 0x9c089b08,
-    0x9e089d08, 0xa0089f08, 0xa208a108, 0xa408a308, 0xa608a508, 0xa808a708,
-    0xaa08a908, 0xac08ab08, 0xae08ad08, 0xb008af08, 0xb208b108, 0xb408b308,
-    0xb608b508, 0xb808b708, 0xba08b908, 0xbc08bb08, 0xbe08bd08, 0xc008bf08,
-    0xc208c108, 0xc408c308, 0xc608c508, 0xc808c708, 0xca08c908, 0xcc08cb08,
-    0xce08cd08, 0xd008cf08, 0xd208d108, 0xd408d308, 0xd608d508, 0xd808d708,
-    0xda08d908, 0xdc08db08, 0xde08dd08, 0xe008df08, 0xe208e108, 0xe408e308,
-    0xe608e508, 0xe808e708, 0xea08e908, 0xec08eb08, 0xee08ed08, 0xf008ef08,
-    0xf208f108, 0xf408f308, 0xf608f508, 0xf808f708, 0xfa08f908, 0xfc08fb08,
-    0xfe08fd08, 0x0009ff08, 0x02090109, 0x04090309, 0x06090509, 0x08090709,
-    0x0a090909, 0x0c090b09, 0x0e090d09, 0x10090f09, 0x12091109, 0x14091309,
-    0x16091509, 0x18091709, 0x1a091909, 0x1c091b09, 0x1e091d09, 0x20091f09,
-    0x22092109, 0x24092309, 0x26092509, 0x28092709, 0x2a092909, 0x2c092b09,
-    0x2e092d09, 0x30092f09, 0x32093109, 0x34093309, 0x36093509, 0x38093709,
-    0x3a093909, 0x3c093b09, 0x3e093d09, 0x40093f09, 0x42094109, 0x44094309,
-    0x46094509, 0x48094709, 0x4a094909, 0x4c094b09, 0x4e094d09, 0x50094f09,
-    0x52095109, 0x54095309, 0x56095509, 0x58095709, 0x5a095909, 0x5c095b09,
-    0x5e095d09, 0x60095f09, 0x62096109, 0x64096309, 0x66096509, 0x68096709,
-    0x6a096909, 0x6c096b09, 0x6e096d09, 0x70096f09, 0x72097109, 0x74097309,
-    0x76097509, 0x78097709, 0x7a097909, 0x7c097b09, 0x7e097d09, 0x80097f09,
-    0x82098109, 0x84098309, 0x86098509, 0x88098709, 0x8a098909, 0x8c098b09,
-    0x8e098d09, 0x90098f09, 0x92099109, 0x94099309, 0x96099509, 0x98099709,
-    0x9a099909, 0x9c099b09, 0x9e099d09, 0xa0099f09, 0xa209a109, 0xa409a309,
-    0xa609a509, 0xa809a709, 0xaa09a909, 0xac09ab09, 0xae09ad09, 0xb009af09,
-    0xb209b109, 0xb409b309, 0xb609b509, 0xb809b709, 0xba09b909, 0xbc09bb09,
-    0xbe09bd09, 0xc009bf09, 0xc209c109, 0xc409c309, 0xc609c509, 0xc809c709,
-    0xca09c909, 0xcc09cb09, 0xce09cd09, 0xd009cf09, 0xd209d109, 0xd409d309,
-    0xd609d509, 0xd809d709, 0xda09d909, 0xdc09db09, 0xde09dd09, 0xe009df09,
-    0xe209e109, 0xe409e309, 0xe609e509, 0xe809e709, 0xea09e909, 0xec09eb09,
-    0xee09ed09, 0xf009ef09, 0xf209f109, 0xf409f309, 0xf609f509, 0xf809f709,
-    0xfa09f909, 0xfc09fb09, 0xfe09fd09, 0x000aff09, 0x020a010a, 0x040a030a,
-    0x060a050a, 0x080a070a, 0x0a0a090a, 0x0c0a0b0a, 0x0e0a0d0a, 0x100a0f0a,
-    0x120a110a, 0x140a130a, 0x160a150a, 0x180a170a, 0x1a0a190a, 0x1c0a1b0a,
-    0x1e0a1d0a, 0x200a1f0a, 0x220a210a, 0x240a230a, 0x260a250a, 0x280a270a,
-    0x2a0a290a, 0x2c0a2b0a, 0x2e0a2d0a, 0x300a2f0a, 0x320a310a, 0x340a330a,
-    0x360a350a, 0x380a370a, 0x3a0a390a, 0x3c0a3b0a, 0x3e0a3d0a, 0x400a3f0a,
-    0x420a410a, 0x440a430a, 0x460a450a, 0x480a470a, 0x4a0a490a, 0x4c0a4b0a,
-    0x4e0a4d0a, 0x500a4f0a, 0x520a510a, 0x540a530a, 0x560a550a, 0x580a570a,
-    0x5a0a590a, 0x5c0a5b0a, 0x5e0a5d0a, 0x600a5f0a, 0x620a610a, 0x640a630a,
-    0x660a650a, 0x680a670a, 0x6a0a690a, 0x6c0a6b0a, 0x6e0a6d0a, 0x700a6f0a,
-    0x720a710a, 0x740a730a, 0x760a750a, 0x780a770a, 0x7a0a790a, 0x7c0a7b0a,
-    0x7e0a7d0a, 0x800a7f0a, 0x820a810a, 0x840a830a, 0x860a850a, 0x880a870a,
-    0x8a0a890a, 0x8c0a8b0a, 0x8e0a8d0a, 0x900a8f0a, 0x920a910a, 0x940a930a,
-    0x960a950a, 0x980a970a, 0x9a0a990a, 0x9c0a9b0a, 0x9e0a9d0a, 0xa00a9f0a,
-    0xa20aa10a, 0xa40aa30a, 0xa60aa50a, 0xa80aa70a, 0xaa0aa90a, 0xac0aab0a,
-    0xae0aad0a, 0xb00aaf0a, 0xb20ab10a, 0xb40ab30a, 0xb60ab50a, 0x6365760d,
-    0x2d726f74, 0x61757173, 0x610c6572, 0x73656363, 0x6f702d73, 0x14746e69,
-    0x2d280c8b, 0x7774656e, 0x076b726f, 0x6f241482, 0x0d746e75, 0x2d260786,
-    0x72656c61, 0x0d870b74, 0x786f6223, 0x270b8a13, 0x74756f2d, 0x656e696c,
-    0x63252d88, 0x6b636568, 0x2621870e, 0x63726963, 0x880f656c, 0x6e6f220e,
-    0x234c8b76, 0x1079656b, 0x6c271b87, 0x7461636f, 0x886e6f69, 0x696d2449,
-    0x8873756e, 0x756d281e, 0x7069746c, 0x8718656c, 0x8710872f, 0x90152081,
-    0x6c702318, 0x7a887375, 0xc788dd86, 0x66666f22, 0xc3861b88, 0x41870c20,
-    0xc2883883, 0x6d657225, 0x8865766f, 0x6573250e, 0x68637261, 0x73292a88,
-    0x05726174, 0x6962726f, 0x36218974, 0x63746977, 0x64610668, 0x7473756a,
-    0x7269610f, 0x6e6f632d, 0x82746964, 0x726522db, 0x270f820a, 0x6c6c6162,
-    0x086e6f6f, 0x70250a82, 0x656e616c, 0x2408870c, 0x66666f2d, 0x270c8507,
-    0x6c610579, 0x0b6d7261, 0x2d200584, 0x83065441, 0x872d2011, 0x850920f7,
-    0x2032821a, 0x8309850a, 0x223582b5, 0x826d7562, 0x72652205, 0x82208274,
-    0x622d2605, 0x610c786f, 0x4109836c, 0x0d20058c, 0x6f260c85, 0x67617463,
-    0x0d876e6f, 0x8205c541, 0x68702238, 0x822e8261, 0x65622e05, 0x61636974,
-    0x6d61066c, 0x6e6f7a61, 0x2a06850c, 0x6972642d, 0x61096576, 0x8275626d,
-    0x836320b9, 0x6c703609, 0x65696669, 0x6e610672, 0x726f6863, 0x646e6107,
-    0x64696f72, 0x2d078614, 0x6265642d, 0x622d6775, 0x67646972, 0x14870e65,
-    0x7574732a, 0x056f6964, 0x6c707061, 0x0583fd82, 0x69662d27, 0x7265646e,
-    0x24128409, 0x736f692d, 0x2409860c, 0x756f6c63, 0x330c8664, 0x61666173,
-    0x660c6972, 0x2d746e6f, 0x73657761, 0x04656d6f, 0x73252682, 0x63726107,
-    0x27978268, 0x72726115, 0x65676e61, 0x6e2a6e83, 0x6f662d67, 0x72617772,
-    0x158d1664, 0x2d6f7424, 0x41827266, 0x73282c88, 0x2d646e65, 0x6b636162,
-    0x14202c83, 0x15842c87, 0x18832b82, 0x14820920, 0x2d776f26, 0x116c6c61,
-    0x622b0985, 0x6f74746f, 0x656c2d6d, 0x8c127466, 0x69722311, 0x12876867,
-    0x6c6f6327, 0x7370616c, 0x20378365, 0x2425850a, 0x6e776f64, 0x260a8910,
-    0x6968742d, 0x8a166b63, 0x6f622410, 0x412d646c, 0x1e2005a7, 0xee421695,
-    0x8f1f2007, 0x6568261e, 0x6f676178, 0x8b1f876e, 0x72642355, 0x5592706f,
-    0x3587168a, 0x65259c86, 0x6e617078, 0x83b88a64, 0x831b86e9, 0x84b88c0a,
-    0x8fb89110, 0x89b88e16, 0x84b8951e, 0x8fb8911f, 0x20558716, 0x050e410b,
-    0x67697224, 0xa4417468, 0x850b8406, 0x8a1720a9, 0x8a2d201d, 0x064441aa,
-    0x178a2985, 0x20205587, 0xac8e3790, 0xad8a588c, 0x6741588c, 0x850e2012,
-    0x6f742358, 0xd1832d70, 0x0e890f20, 0x08208b84, 0x75210f85, 0x21278670,
-    0xc7857075, 0x17871420, 0x1c20c48b, 0xc1871493, 0x1c8d1d20, 0x4f89be8e,
-    0x4f89a38a, 0x2b08b892, 0x73736109, 0x61747369, 0x6102746e, 0x74610a74,
-    0x68636174, 0x746e656d, 0x64756109, 0x6f626f69, 0x61086b6f, 0x2d6f7475,
-    0x0b786966, 0x75260884, 0x616f6c70, 0x0b830964, 0x6e65723e, 0x61087765,
-    0x69742d76, 0x0472656d, 0x79626162, 0x6361620a, 0x7275626b, 0x09726567,
-    0x73250a83, 0x65636170, 0x8209830e, 0x657226f2, 0x726f7473, 0x2a288265,
-    0x62076b6e, 0x6f637261, 0x860c6564, 0x732d2507, 0x066e6163, 0x6c220c82,
-    0x06837965, 0x6c65722b, 0x73616208, 0x6d616365, 0x240f8270, 0x74656b73,
-    0x820f820b, 0x228a8206, 0x860d6c6c, 0x6e75250b, 0x6c6c6966, 0x74234c82,
-    0x83726574, 0x2507847d, 0x0a30312d, 0x0a856162, 0x0a893220, 0x0a893320,
-    0x0a893420, 0x0a893520, 0x0a893620, 0x0a893720, 0x0a893820, 0x82303921,
-    0x25578578, 0x72656c61, 0x65871074, 0x61686328, 0x6e696772, 0x108f1467,
-    0x30218a82, 0x20149013, 0x20139232, 0x20139233, 0x20139234, 0x20139236,
-    0x8a139238, 0x057947ab, 0x6e288587, 0x74616765, 0x0f657669, 0x2e471087,
-    0x230f8707, 0x73756c70, 0x7023d988, 0x8c69736f, 0x6e75332d, 0x776f6e6b,
-    0x6562056e, 0x05686361, 0x73616c66, 0x05840b6b, 0x6d652d26, 0x13797470,
-    0x4c480b8a, 0x86138508, 0x2e398367, 0x62047374, 0x07726565, 0x61686562,
-    0x8265636e, 0x6c6c2b0c, 0x6c656208, 0x666f2d6c, 0x08850c66, 0x2005c246,
-    0x830c8409, 0x24098592, 0x676e6972, 0x83138411, 0x20618709, 0x2411840a,
-    0x65656c73, 0x264b8270, 0x62056174, 0x826c6269, 0x6b692156, 0x6e310483,
-    0x69620a67, 0x75636f6e, 0x7372616c, 0x6f696203, 0x25038209, 0x617a6168,
-    0x09826472, 0x75627431, 0x74656b63, 0x616c620a, 0x6d2d6b63, 0x85617365,
-    0x6562250a, 0x07797272, 0x6e2e4682, 0x06726564, 0x6e696c62, 0x620c7364,
-    0x24826f6c, 0x6c656823, 0x30bd8370, 0x67676f6c, 0x62097265, 0x7465756c,
-    0x68746f6f, 0x2609880f, 0x6475612d, 0x89116f69, 0x6f63270f, 0x63656e6e,
-    0x11890d74, 0x1220e982, 0x73230d89, 0x82747465, 0x8a7320da, 0x72742812,
-    0x66736e61, 0x82047265, 0x0b722125, 0x2d200483, 0x65238482, 0x84087261,
-    0x666f220b, 0x29148566, 0x69646172, 0x62046c61, 0xec826e6f, 0x6b6f6f24,
-    0x0482620d, 0x20085748, 0x280d8c15, 0x7261762d, 0x746e6169, 0x24158409,
-    0x6e65706f, 0x87098811, 0x840c201b, 0x20288611, 0x240c8308, 0x6b72616d,
-    0x4808870e, 0x0e8806bd, 0x73756d25, 0x88106369, 0x06e5410e, 0x37837684,
-    0x6c702d24, 0x09427375, 0x83268808, 0x880f2015, 0x0594490d, 0x6f620a2b,
-    0x72656472, 0x6c6c612d, 0x470a860d, 0x0c200599, 0x63240d86, 0x726f6c6f,
-    0x2584b082, 0x726f6828, 0x6e6f7a69, 0x2c886174, 0x736e6926, 0x0b656469,
-    0x6c232c86, 0x87746665, 0x6f6e240b, 0x860e656e, 0x83a08217, 0x24538726,
-    0x68676972, 0x240c8774, 0x6c797473, 0x23868765, 0x0f706f74, 0x76333386,
-    0x69747265, 0x076c6163, 0x6c776f62, 0x03676e69, 0x82786f62, 0x2d783226,
-    0x74747563, 0x62097265, 0x66656972, 0x65736163, 0x4109880f, 0x12200526,
-    0x64280f89, 0x6c6e776f, 0x1064616f, 0x4c451289, 0x820c2005, 0x25838210,
-    0x7373656e, 0x0c8b312d, 0x0c8b3220, 0x0c8b3320, 0x0c8b3420, 0x0c8b3520,
-    0x0c8b3620, 0x8e833720, 0x61295a87, 0x056f7475, 0x6f6f7262, 0x3605826d,
-    0x03687375, 0x0e677562, 0x6c6c7562, 0x6e697465, 0x616f622d, 0x83086472,
-    0x6f68230e, 0x1b826e72, 0x6306732d, 0x65686361, 0x61630464, 0x830c656b,
-    0x6c2d2704, 0x72657961, 0x0c856465, 0x2b061f42, 0x6c61630a, 0x616c7563,
-    0x08726f74, 0x65250a82, 0x7261646e, 0x2508870e, 0x616c622d, 0x0e896b6e,
-    0x8805f74a, 0x6c63251d, 0x116b636f, 0x094b0e88, 0x90172007, 0x054b4111,
-    0x17880d20, 0x756c7024, 0x0d880f73, 0x89053c42, 0x6574231d, 0x73897478,
-    0x646f7425, 0x82097961, 0x2d6c262c, 0x6564616d, 0x2409850a, 0x65677265,
-    0x240a850b, 0x65737369, 0x293d8364, 0x65722d6c, 0x76696563, 0x24856465,
-    0x6c70732e, 0x63097469, 0x6f636d61, 0x72656472, 0x09862282, 0x6f622d23,
-    0x8ab68278, 0x6f2d230d, 0x1f8a6666, 0x06200d82, 0x65223782, 0x87826172,
-    0x06826d20, 0x6e652d28, 0x636e6168, 0x15850c65, 0x2005b14a, 0x430c8b14,
-    0x0b20077c, 0x69231486, 0x83736972, 0x283c8363, 0x74726170, 0x6f6d2d79,
-    0x84b28364, 0x6572244e, 0x86137261, 0x870b8329, 0x8383833d, 0x77732531,
-    0x68637469, 0x74216d87, 0x25348269, 0x6e616309, 0x04827964, 0x63036525,
-    0x820b7261, 0x452d2003, 0x348206f0, 0x442d7221, 0x6522069f, 0x19830864,
-    0x73617723, 0x24c18268, 0x746f7272, 0x200f8204, 0x21498274, 0xc4437472,
-    0x83092007, 0x702d2d11, 0x1273756c, 0x65736163, 0x6e65732d, 0x22052346,
-    0x836c612d, 0x6873212e, 0x73254382, 0x30312d68, 0x825a8230, 0x07d84108,
-    0x75221685, 0x53826473, 0x0e747322, 0x74203c82, 0x06207789, 0x6c200e83,
-    0x742b9c83, 0x6c656309, 0x6f68706c, 0x8811656e, 0x822d2009, 0x6f7224bd,
-    0x890f6469, 0x61622511, 0x0e636973, 0x64240f89, 0x106b636f, 0x69200e89,
-    0x1f8a4184, 0x6e696c24, 0x1f89126b, 0x2d230e83, 0x8a66666f, 0x07844512,
-    0x65630b39, 0x66697472, 0x74616369, 0x68630c65, 0x2d726961, 0x6f686373,
-    0x82096c6f, 0x7472260c, 0x6372612d, 0x23098710, 0x70736165, 0x65204a82,
-    0x62231a86, 0x850f7261, 0x6968291a, 0x676f7473, 0x0a6d6172, 0x248a0f85,
-    0x65697028, 0x65686305, 0x34826b63, 0x2d240582, 0x0e6c6c61, 0x62220f84,
-    0x3343786f, 0x8d152005, 0x06ed4b0e, 0x15941d20, 0x8e08224c, 0x0689451d,
-    0x63828e82, 0x6d265983, 0x656b7261, 0x26881664, 0x5b860f85, 0x16951e20,
-    0x17205c87, 0x5d861e8f, 0xd14f178a, 0x20c08506, 0x8c2f891f, 0x204f8717,
-    0x851f9118, 0x9720208e, 0x20398718, 0x2620840c, 0x6f627265, 0x83647261,
-    0x696d2cdc, 0x2d6c6163, 0x70616577, 0x82136e6f, 0x72762a1c, 0x642d6e6f,
-    0x6c62756f, 0x20068265, 0x24139077, 0x7466656c, 0x25278e14, 0x68676972,
-    0x148e1174, 0x83707521, 0x214e866b, 0x0c886e77, 0x0d204083, 0x39842b87,
-    0x0d870a20, 0x0670752e, 0x72756863, 0x630b6863, 0x6f637369, 0x622c9582,
-    0x63047865, 0x09797469, 0x70696c63, 0x1120b384, 0x2d200988, 0x2006a150,
-    0x22118a0f, 0x8272656c, 0x202b879d, 0x09164e2d, 0x248a1420, 0x6f727223,
-    0x05694c77, 0x82821489, 0x8a6b6321, 0x06a0415b, 0x21890e20, 0x78657424,
-    0x0e830674, 0x0d797027, 0x636f6c63, 0x09d1436b, 0x65230d84, 0x850a646e,
-    0x61662417, 0x85087473, 0x6e69210a, 0x2b86b982, 0x12850b20, 0x61747325,
-    0x82057472, 0x6573220b, 0x45058409, 0x6c230510, 0x8365736f, 0x09a84109,
-    0xfe4e1184, 0x83bd8205, 0x480c851e, 0x3d85080e, 0x74656e26, 0x6b726f77,
-    0x41829383, 0x2006c950, 0x861b8515, 0x8231870d, 0x284682cd, 0x61632d64,
-    0x6f697470, 0x2284836e, 0x820b6475, 0x8275202a, 0x65682413, 0x860c6b63,
-    0x7269250b, 0x0e656c63, 0x79470c85, 0x82608307, 0x06184127, 0x1c851120,
-    0x66666f22, 0x8508744e, 0x72702511, 0x13746e69, 0xd08b0b8a, 0xb5473f82,
-    0x630a2b05, 0x2d65646f, 0x61727261, 0x0a840b79, 0x61726226, 0x0d736563,
-    0x6b230b88, 0x85737465, 0x71652524, 0x116c6175, 0x672c1884, 0x74616572,
-    0x742d7265, 0x1a6e6168, 0x2d231190, 0x842d726f, 0x840e202c, 0x656c231a,
-    0x29847373, 0x0e8d1720, 0x6e22268e, 0x3585746f, 0x26841620, 0x14460e88,
-    0x84102007, 0x61702a16, 0x746e6572, 0x65736568, 0x21af8573, 0xe7827473,
-    0x84096721, 0x6174241c, 0x83077367, 0x65702a09, 0x6f63066e, 0x65656666,
-    0x2a06850c, 0x2d6f742d, 0x63046f67, 0x826e696f, 0x826c2011, 0x06fc4aa0,
-    0x6d6f6323, 0x2050826d, 0x4207860f, 0xaa8207ca, 0x0f871784, 0x8509ea41,
-    0x057e542f, 0x35881520, 0x46656c21, 0x0d200958, 0x63241587, 0x6b636568,
-    0x0d842388, 0x86093744, 0x0f2f5447, 0xde418888, 0x87142006, 0x0b7f4a4c,
-    0x14881220, 0x636f7229, 0x69737365, 0x911a676e, 0x256b9012, 0x73657571,
-    0x8c516974, 0x4833870a, 0x1f42057a, 0x239b8609, 0x74786574, 0x0c837f88,
-    0x07202187, 0x70233882, 0x85657261, 0x73732107, 0x7022b483, 0x1f4b7361,
-    0x31178208, 0x6c6f736e, 0x6f630c65, 0x6361746e, 0x616d2d74, 0x0c846c69,
-    0x746e6528, 0x706f632d, 0x19830b79, 0x75220c84, 0x0b871174, 0x70756429,
-    0x6163696c, 0x870d6574, 0x20548211, 0x83458574, 0x6173242b, 0x87106576,
-    0x240c831a, 0x6c6c612d, 0x23108308, 0x74736172, 0x08835f84, 0x6f622d24,
-    0x15870f78, 0x25061646, 0x6f6f6306, 0xb083696b, 0x746e752e, 0x63037265,
-    0x630b776f, 0x69646572, 0x61238e82, 0x8a146472, 0x08724c0b, 0x148b1020,
-    0x61637329, 0x7263046e, 0x8309706f, 0x662d2504, 0x0e656572, 0x6c230984,
-    0x82646e61, 0x8270201c, 0x291d82b4, 0x726f702d, 0x69617274, 0x1c840b74,
-    0x2005dd56, 0x260b820a, 0x61687373, 0x83737269, 0x240a8633, 0x7370672d,
-    0x20198205, 0x21578277, 0xe5826275, 0xc9440482, 0x250c8309, 0x646e6573,
-    0x0983630d, 0x666e752a, 0x65646c6f, 0x75630364, 0x75248082, 0x61772d70,
-    0x0c2cc582, 0x72727563, 0x79636e65, 0x6374622d, 0x65220c89, 0x0c897275,
-    0x70626722, 0x69210c89, 0x22198a6e, 0x896e676e, 0x75722219, 0x220c8962,
-    0x89797274, 0x7375230c, 0x67820e64, 0x726f732b, 0x6665642d, 0x746c7561,
-    0x440e8d16, 0x75210976, 0x23258372, 0x65766f6d, 0x70233187, 0x826e696f,
-    0x640829a8, 0x62617461, 0x0e657361, 0x2d260887, 0x756e696d, 0x0e880d73,
-    0x756c7024, 0x94550f73, 0x74732405, 0x822d7065, 0x0e6f2136, 0x6f220f8a,
-    0x1e8b7475, 0x72286282, 0x63656410, 0x6c616d69, 0x63229682, 0x5c826572,
-    0x69211088, 0x2510856e, 0x6c656406, 0x74827465, 0x47440684, 0x82052007,
-    0x61742c15, 0x73656409, 0x6f68706b, 0x830b656e, 0x6f742709, 0x616d2d70,
-    0x0b870d63, 0x6f742008, 0x07726577, 0x61746564, 0x0a736c69, 0x69766564,
-    0x61746e61, 0x64077472, 0x6f6d6169, 0x8308646e, 0x69742a61, 0x64066e6f,
-    0x2d656369, 0x20068531, 0x20068532, 0x20068533, 0x20068534, 0x26068535,
-    0x69640a36, 0x83636572, 0x22508233, 0x446b7369, 0x1c820542, 0x75717326,
-    0x69640e73, 0x4b410683, 0x64082507, 0x73697669, 0x0c205e82, 0x2d340887,
-    0x03786f62, 0x06736e64, 0x616d6f64, 0x640f6e69, 0x2d73746f, 0x840a3b4e,
-    0x07df4d0f, 0x2a460820, 0x64042507, 0x0f676172, 0x2b8c0483, 0x2d201482,
-    0x82080b4e, 0x6977241d, 0x860b676e, 0x29688307, 0x69726408, 0x6c626262,
-    0x08870c65, 0x05261583, 0x6e6f7264, 0x05820765, 0x6f62703f, 0x72640678,
-    0x6c617075, 0x63756404, 0x7564086b, 0x6562626d, 0x65056c6c, 0x68747261,
-    0x35058409, 0x66666f2d, 0x67646504, 0x6a650565, 0x11746365, 0x76656c65,
-    0xd3827461, 0x65642d28, 0x6e696c63, 0x11890e65, 0x73697224, 0x0e850865,
-    0x05726f23, 0x21e18265, 0x05840a6c, 0x706f2d25, 0x860d6e65, 0x054a510a,
-    0x0d850c20, 0x63657324, 0x34827275, 0x746f6d25, 0x836f6369, 0x26088523,
-    0x6f6f632d, 0x86650e6c, 0x216b8216, 0x0e8a6976, 0x70616825, 0x88107970,
-    0x656e261d, 0x61727475, 0x8660826c, 0x6f70243c, 0x880c706f, 0x6173231e,
-    0x0c880f64, 0x6e6f7429, 0x06657567, 0x84676e65, 0x410684bb, 0x052607af,
-    0x61757165, 0x0584096c, 0x6f622d3e, 0x72650678, 0x72657361, 0x63736509,
-    0x74616c61, 0x6508726f, 0x72656874, 0x0e74656e, 0x2d260887, 0x6c626163,
-    0x0e8d1265, 0x25053341, 0x08797374, 0x2e827665, 0x65746f2e, 0x6378650b,
-    0x616d616c, 0x6e6f6974, 0x69250b82, 0x6f742d74, 0x2bc4822d, 0x70786506,
-    0x0374726f, 0x07657965, 0x38830382, 0x07820a20, 0x6f726427, 0x72657070,
-    0x420a8912, 0x082907f6, 0x65636166, 0x6b6f6f62, 0x8308870c, 0x881220a8,
-    0x656d230c, 0xdb827373, 0x07726522, 0xb1821282, 0x66037924, 0x2b826e61,
-    0x58747321, 0x108207b1, 0x6605782c, 0x79727265, 0x6c696604, 0x04830a65,
-    0x68632d25, 0x87747261, 0x6365220a, 0x240a866b, 0x64756f6c, 0x2920840e,
-    0x696c6564, 0x6574696d, 0x0e850d64, 0x75636f27, 0x746e656d, 0x830d8c11,
-    0x8239858a, 0x6c6521ee, 0x0a843985, 0x0b201983, 0xf0852b84, 0x0b840920,
-    0x6e696623, 0x242f8564, 0x67616d69, 0x25208565, 0x6f706d69, 0x20857472,
-    0x636f6c23, 0x4770856b, 0x2e850760, 0x73756d25, 0x840c6369, 0x06604743,
-    0x0c840820, 0x66647022, 0x08821585, 0x0f207283, 0x6f291585, 0x70726577,
-    0x746e696f, 0x830f8e13, 0x85152023, 0x65722213, 0x24cf8273, 0x6f697461,
-    0x8515836e, 0x8612827f, 0x697624a0, 0x856f6564, 0x6f772214, 0x06054172,
-    0x2c830983, 0x78237c85, 0x82046c6d, 0x836d204b, 0x736d2625, 0x70697274,
-    0x840e830d, 0x6f2d2409, 0x82066666, 0x6574230d, 0x06850e72, 0x83077342,
-    0x20158223, 0x05bc472d, 0x0d898c83, 0x8608674a, 0x06e55032, 0x69660b24,
-    0xd182676e, 0xd1827220, 0x69660425, 0x83076572, 0x6f662204, 0x270c8278,
-    0x66046873, 0x0e67616c, 0xa8500483, 0x72652405, 0x840c6465, 0x062a410e,
-    0x0c841420, 0x86894b86, 0x2d203582, 0x6124b482, 0x656c676e, 0x22862f85,
-    0x2f820520, 0x0a687322, 0x2d250584, 0x6f747561, 0x820a8509, 0x251485d2,
-    0x6867696c, 0x14840e74, 0xec850a84, 0x74616c2a, 0x660c7274, 0x2d70696c,
-    0x2006e95a, 0x2b0c870d, 0x6e6f7266, 0x6c660674, 0x7970706f, 0x772a0683,
-    0x66067265, 0x65646c6f, 0x06850e72, 0x2007af49, 0x450e860f, 0x13200708,
-    0x67220f86, 0xa5826f6f, 0x20052f5c, 0x4213860c, 0x46840642, 0x6f6c2d25,
-    0x86106b63, 0x250b8318, 0x65706f2d, 0x10860b6e, 0x766f6d23, 0x42598765,
-    0x15200757, 0x1f4e1b87, 0x204e8407, 0x41158f17, 0xa6870642, 0x58870e86,
-    0x756c7024, 0x32860d73, 0x8705cf41, 0x05a54b0d, 0x6f660425, 0x830a646f,
-    0x612d2604, 0x656c7070, 0x410a840c, 0x08200666, 0x74240c82, 0x6c6c6162,
-    0x6f20e482, 0x2d2b0884, 0x74737561, 0x696c6172, 0x870f6e61, 0x682d261c,
-    0x656d6c65, 0x24238274, 0x74616d72, 0x2b1c822d, 0x632d6e67, 0x65746e65,
-    0x6f661472, 0x6a20138a, 0x69233b82, 0x8c117966, 0x656c2414, 0x8c127466,
-    0x69722411, 0x82746867, 0x233984bf, 0x646c6f62, 0x0b849382, 0x656c6324,
-    0x3d877261, 0x6c6f6327, 0x662d726f, 0x849c8469, 0x6c66221e, 0x857e826f,
-    0x85258778, 0x8d638313, 0x6f6e2311, 0x7587656e, 0x75842385, 0x4a84d382,
-    0x61656827, 0x2d726564, 0x200f8e31, 0x200f8e32, 0x200f8e33, 0x200f8e34,
-    0x210f8e35, 0xe8861636, 0x64215f86, 0x054e4865, 0x86073a41, 0x71652416,
-    0x8e6c6175, 0x0779482a, 0x70242a8e, 0x646e756f, 0x69252a87, 0x6e65646e,
-    0x08b54874, 0x4187168e, 0x83860d20, 0x61746925, 0x8763696c, 0x696c2b4f,
-    0x732d656e, 0x69636170, 0xb541676e, 0x696c2407, 0x552d7473, 0x65220500,
-    0x36861964, 0x2d24148c, 0x65707974, 0x2e824289, 0x6d756e26, 0x73726562,
-    0x2507b241, 0x6e696170, 0x3a861074, 0x72617029, 0x61726761, 0x86126870,
-    0x75712a10, 0x2d65746f, 0x736f6c63, 0x07ef4165, 0x7a697323, 0x2d7f8765,
-    0x69727473, 0x6874656b, 0x67756f72, 0x33861c68, 0xc14d148c, 0x261c8708,
-    0x63736275, 0x42706972, 0x73220851, 0x8d827075, 0x61871284, 0x78657424,
-    0x2f861b74, 0x3c490b83, 0x6c2d2608, 0x2d6f742d, 0x201b9572, 0x201b8372,
-    0x26c9876c, 0x65646e75, 0x42696c72, 0x77200943, 0x2d22d682, 0x12906e69,
-    0x75717326, 0x11657261, 0x25846e86, 0x67697424, 0x9b417468, 0x29118507,
-    0x622d706f, 0x6f74746f, 0x2882056d, 0x076d7522, 0x2406c85f, 0x756f660a,
-    0x27418572, 0x69726606, 0x0d656764, 0x2d270685, 0x6c6c6966, 0x8c146465,
-    0x2042860d, 0x2e148d11, 0x0a706f74, 0x6c6c7566, 0x65726373, 0x890f6e65,
-    0x652d360a, 0x08746978, 0x636e7566, 0x6e6f6974, 0x6d616707, 0x64617065,
-    0x5507860f, 0x6726086d, 0x732d7361, 0x23836174, 0x61670429, 0x67056574,
-    0x83677561, 0x65763105, 0x65670d6c, 0x7265646e, 0x6d65662d, 0x0b656c61,
-    0x0b830d86, 0x0b8a1220, 0x12871e86, 0x61727424, 0x1e85736e, 0x6867052f,
-    0x0474736f, 0x74666967, 0x74696703, 0x2203820a, 0x82627568, 0x0d7821c7,
-    0x0d510a86, 0x670b2c05, 0x7373616c, 0x756c662d, 0x85096574, 0x756d230b,
-    0x09850c67, 0x61747324, 0x7c82676e, 0x74242284, 0x70696c75, 0x64242285,
-    0x07726f6f, 0x652e2284, 0x6d670573, 0x056c6961, 0x6d6f6e67, 0xa8450665,
-    0x85102005, 0x632d2606, 0x62647261, 0x2004826f, 0x2110870d, 0x25827268,
-    0x0d870e20, 0x63726926, 0x1a73656c, 0x2d2c0e8d, 0x6d6d6f63, 0x74696e75,
-    0x17736569, 0x65281a8e, 0x6e657478, 0x14646564, 0x6725178e, 0x70756f72,
-    0x29148711, 0x72746e6f, 0x656c6c6f, 0x11901572, 0x666f2d24, 0x4d460c66,
-    0x240c860c, 0x74726165, 0x84198768, 0x20b387d9, 0x211a826e, 0x1a877962,
-    0x67617025, 0x86137365, 0x68702334, 0xfe537379, 0x0b622106, 0x6c221387,
-    0x0b897961, 0x0f737522, 0x75251788, 0x6f622d73, 0x071b4178, 0x61727428,
-    0x616c736e, 0x67876574, 0x82617721, 0x047426b2, 0x64697267, 0x83048308,
-    0x840520aa, 0x670f30d8, 0x61746975, 0x6c652d72, 0x72746365, 0x860b6369,
-    0x6970240f, 0x8a136b63, 0x07db470b, 0x61681324, 0x9465646e, 0x6e692905,
-    0x69722d67, 0x06746867, 0x67221382, 0x8d877265, 0x6f380d83, 0x08737475,
-    0x64726168, 0x6b736964, 0x6165680a, 0x6f687064, 0x0e73656e, 0xb0830a89,
-    0x0e8a1320, 0x275c7320, 0x83072006, 0x200c8213, 0x2507860c, 0x636f642d,
-    0x0c870b6b, 0x66666f23, 0x220b8205, 0x84097472, 0x20448305, 0x50098811,
-    0x118608ae, 0x6b6f7225, 0x850d6e65, 0x065e470c, 0x65680425, 0x830b706c,
-    0x06065004, 0x62680721, 0x0f20058e, 0x360e7160, 0x73696807, 0x79726f74,
-    0x6c6f6808, 0x6e656c6f, 0x6f680473, 0x830b656d, 0x6d2d2704, 0x7265646f,
-    0x0b840c6e, 0x82067147, 0x8270201d, 0x736f28f1, 0x61746970, 0x8668116c,
-    0x622d2908, 0x646c6975, 0x0f676e69, 0x6d2b1188, 0x656b7261, 0x6f680572,
-    0x826c6574, 0x7a752505, 0x6f68097a, 0xca830582, 0x75680526, 0x0b6e616d,
-    0x2d220584, 0x3a826863, 0x0b851120, 0x6c616d23, 0x068f4365, 0x6d690526,
-    0x0b656761, 0x2d260584, 0x75626c61, 0x0b860a6d, 0x61657223, 0x450a8910,
-    0x0c20059e, 0x62261085, 0x656b6f72, 0x0c8b146e, 0x8508145d, 0x05164a14,
-    0x0c8b1820, 0x385e2d20, 0x68772505, 0x19657469, 0xab47188c, 0x662d2605,
-    0x7375636f, 0x2519981e, 0x6165772d, 0x1e8c126b, 0x61726425, 0x8c13616d,
-    0x82662012, 0x73652212, 0x23138c10, 0x11726468, 0x6e24108c, 0x17656e6f,
-    0x7429118c, 0x2d746c69, 0x66696873, 0x85d58674, 0x762d28c0, 0x61746e69,
-    0x850e6567, 0x0792492c, 0x094c0620, 0x69102505, 0x786f626e, 0x250a7a56,
-    0x666e690b, 0x4b4d726f, 0x8a132005, 0x0875510b, 0x736e6922, 0xa2824e82,
-    0x09840a20, 0x70617023, 0x399a8265, 0x7265746e, 0x2d74656e, 0x6c707865,
-    0x7265726f, 0x766e690d, 0x2d747265, 0x0e826f63, 0x6a07733a, 0x6e706565,
-    0x6a047965, 0x08617269, 0x6966736a, 0x656c6464, 0x67656b03, 0x792c0382,
-    0x79656b0a, 0x6168632d, 0x0965676e, 0x6d250a83, 0x73756e69, 0x23098308,
-    0x73756c70, 0xef491d84, 0x830b2005, 0x065e4213, 0x0b820820, 0x616f6225,
-    0x87126472, 0x622d2008, 0x0d200885, 0x63241288, 0x0e737061, 0x6c240d89,
-    0x0c65736f, 0x6f230e88, 0x880f6666, 0x6572250c, 0x6e727574, 0x74231c89,
-    0x88106261, 0x2b73861c, 0x646f6b04, 0x616c0569, 0x0d6c6562, 0x14410584,
-    0x6c032407, 0x820b6e61, 0x07e25a03, 0x0b830e20, 0x73696423, 0x05096063,
-    0x70271a84, 0x69646e65, 0x820f676e, 0x75672c1a, 0x2d656761, 0x61687363,
-    0x8a0d7072, 0x3373210f, 0x1d853883, 0x6d746825, 0x8813356c, 0x616a231c,
-    0x0f486176, 0x880c2005, 0x68702213, 0x264d8970, 0x68747970, 0x89146e6f,
-    0x2c0f841c, 0x7865742d, 0x616c0674, 0x706f7470, 0x2b068511, 0x7268632d,
-    0x62656d6f, 0x0a6b6f6f, 0x6d231186, 0x860e6361, 0x6977260a, 0x776f646e,
-    0x23328273, 0x6d667473, 0x75230682, 0x8268636e, 0x65792306, 0x2e827372,
-    0x2d2c0683, 0x0466666f, 0x6661656c, 0x64656c07, 0x06200c83, 0x6e210784,
-    0x5006840b, 0x0f20057f, 0x044d0b83, 0x66662208, 0x210f8c0e, 0x0e8c136e,
-    0x07283285, 0x7262696c, 0x0d797261, 0x2d200786, 0x7320a183, 0x944e0d88,
-    0x2e1b8705, 0x73756c70, 0x67696c09, 0x75627468, 0x8811626c, 0x07904109,
-    0x696c0425, 0x5b086b6e, 0x0c2007f6, 0x8e860884, 0x0c8b1020, 0x2684be83,
-    0x69646523, 0x8326846e, 0x217a8208, 0x26820578, 0x04787527, 0x6b636f6c,
-    0x08e34c09, 0x09881120, 0x59085845, 0x05260b5b, 0x69676f6c, 0x0582066e,
-    0x74756f22, 0x6f220c82, 0x0582736b, 0x6570752f, 0x6d756c04, 0x616d0678,
-    0x74656e67, 0x23068509, 0x076e6f2d, 0x69230983, 0x860d7966, 0x05ef5307,
-    0x0d870c20, 0x2282e383, 0x2d6c6929, 0x6d037572, 0x820a7061, 0x452d2003,
-    0x1120052b, 0xb4450a89, 0x8a132006, 0x07e24311, 0x138a0e20, 0x66666f22,
-    0x7225348b, 0x75696461, 0x20918273, 0x20b08272, 0x24548308, 0x6e776f64,
-    0x4e5d850c, 0x0e3a05d9, 0x73616c67, 0x6f632d73, 0x61746b63, 0x6d0b6c69,
-    0x72657461, 0x2d6c6169, 0x27826975, 0x82687421, 0x706d2119, 0x44822182,
-    0x64637826, 0x656d066e, 0x6d205282, 0x6d290682, 0x0479726f, 0x756e656d,
-    0x20048309, 0x8558832d, 0x656c2409, 0x840a7466, 0x69722513, 0x07746867,
-    0x75210a84, 0x27078270, 0x67617373, 0x656d0d65, 0xf3530784, 0x870c2005,
-    0x7264230d, 0x1a887761, 0x826d6921, 0x870f2028, 0x06c1461a, 0x0f871220,
-    0xe9577020, 0x24308808, 0x6c706572, 0x84208879, 0x742d240d, 0x88747865,
-    0x200c835e, 0x57408714, 0x42880bbf, 0x64697630, 0x6d0a6f65, 0x6f726369,
-    0x6e6f6870, 0x0a890e65, 0x666f2d24, 0x0e8b1266, 0x2005ca42, 0x63128a13,
-    0x138a08ec, 0x20068942, 0x83129116, 0x84092050, 0x6f732316, 0x09827466,
-    0x63656e2c, 0x74666172, 0x6e696d05, 0x0f837375, 0x2005d748, 0x410f840c,
-    0x142006fb, 0x72500c8b, 0x5b148508, 0x0728066f, 0x696e6f6d, 0x10726f74,
-    0xbf570786, 0x6d042708, 0x0965726f, 0x1b826f6d, 0x6b696228, 0x6f6d0565,
-    0x0f837375, 0x8b830582, 0x0f840d20, 0x20071847, 0x830d8c11, 0x232f821f,
-    0x0e656976, 0x20067142, 0x05066e69, 0x0e8d1220, 0x6f622d29, 0x756d0978,
-    0x83636973, 0x88112009, 0x08424309, 0x204b1185, 0x850a2005, 0x6f6e230c,
-    0x29866574, 0x2d270a83, 0x68676965, 0x890f6874, 0x682d241c, 0x82666c61,
-    0x84558377, 0x666f2221, 0x88778266, 0x7571270e, 0x65747261, 0x318a1472,
-    0x78697329, 0x6e656574, 0x8a106874, 0x68772c14, 0x06656c6f, 0x7574616e,
-    0x850d6572, 0x2d360806, 0x706f6570, 0x6e0a656c, 0x67697661, 0x6f697461,
-    0x656e066e, 0x656c6465, 0x6f6d730e, 0x642d656b, 0x63657465, 0x0a726f74,
-    0x72656874, 0x74736f6d, 0x6e077461, 0xe6847765, 0x732a0782, 0x65706170,
-    0x666e0372, 0x03820763, 0x61742d24, 0x07830b70, 0x2806f341, 0x646f6e06,
-    0x04736a65, 0x20e0826e, 0x42b8850c, 0x09200533, 0x70240c84, 0x1173756c,
-    0x73470988, 0x24118408, 0x74786574, 0x60098216, 0x968205ac, 0x6c632d32,
-    0x2d726165, 0x076c6c61, 0x656d756e, 0x0d636972, 0x2d210786, 0x208d8330,
-    0x410d8c1e, 0x756f08f2, 0x431e8d08, 0x4288064c, 0x428c3120, 0x42990d84,
-    0x428f1e85, 0x428c3220, 0x42990d84, 0x428f1e85, 0x428c3320, 0x42990d84,
-    0x428f1e85, 0x428c3420, 0x42990d84, 0x428f1e85, 0x428c3520, 0x42990d84,
-    0x428f1e85, 0x428c3620, 0x42990d84, 0x428f1e85, 0x428c3720, 0x42990d84,
-    0x428f1e85, 0x428c3820, 0x42990d84, 0x428f1e85, 0x428c3920, 0x42990d84,
-    0x42861e85, 0x70421220, 0x2d392307, 0xc7446c70, 0x91232005, 0x204c9012,
-    0x8623921a, 0x6e092a51, 0x69727475, 0x6e6f6974, 0x063c6007, 0x44600f20,
-    0x6f0d390e, 0x6b6f6e64, 0x7373616c, 0x696b696e, 0x66666f06, 0x03656369,
-    0x0f6c696f, 0x26080382, 0x6d65742d, 0x61726570, 0x65727574, 0x656d6f05,
-    0x6f086167, 0x7264656e, 0x0b657669, 0x6e65706f, 0x2d6e692d, 0x88707061,
-    0x656e230b, 0x17830677, 0x05646922, 0x72200682, 0x72282d82, 0x656d616e,
-    0x6f10746e, 0x29450886, 0x4b0e2007, 0x752e0b56, 0x776f0370, 0x6170076c,
-    0x67616b63, 0x07860c65, 0x6f642d25, 0x870a6e77, 0x7075220c, 0x440a870f,
-    0x16200629, 0xbd4c0f8e, 0x82642005, 0x656c2746, 0x10657474, 0x07846170,
-    0x64612d2f, 0x636e6176, 0x70056465, 0x61646e61, 0x20058307, 0x829a826f,
-    0x21068207, 0x2782616d, 0x08846e20, 0x69662d28, 0x79656873, 0x19871365,
-    0x200aed5a, 0x5a138811, 0x258907f1, 0x64697733, 0x6e612d65, 0x12656c67,
-    0x65706170, 0x75632d72, 0x08185b74, 0x12840920, 0x696c6323, 0x29788270,
-    0x6e696b72, 0x61700567, 0xe4837375, 0x9f460582, 0x86128407, 0x089f460c,
-    0xae411485, 0x8c152006, 0x08564b0d, 0x77617027, 0x6e657003, 0x23038206,
-    0x0a6c6963, 0x2d240685, 0x12786f62, 0x5a5d0a89, 0x23128608, 0x6b636f6c,
-    0x6f232987, 0x82076666, 0x656333b2, 0x7008746e, 0x6d726168, 0x05796361,
-    0x6e6f6870, 0x05840f65, 0x946b2d20, 0x850d2008, 0x06ae520f, 0x0d850c20,
-    0xf6826820, 0x86707521, 0x6e69271a, 0x6c61742d, 0x1a850e6b, 0x636e6924,
-    0xee826d6f, 0x74832986, 0x09646522, 0x6c221b85, 0x1686676f, 0x73696d25,
-    0x86646573, 0x756f2432, 0x896f6774, 0x87f18432, 0x0725481b, 0x41850a20,
-    0x696f7629, 0x69700270, 0x83697006, 0x700328ec, 0x70046769, 0x826c6c69,
-    0x076e2208, 0x82888270, 0x820920d7, 0x2d652607, 0x65657274, 0x8309880d,
-    0x2517832c, 0x65726574, 0x17837473, 0x17830985, 0x6970052b, 0x04617a7a,
-    0x79616c70, 0x63048310, 0x0b200bbd, 0x80471084, 0x8a132005, 0x08726d0b,
-    0xb0841384, 0x0a851620, 0x746f7230, 0x65746365, 0x6f632d64, 0x6e65746e,
-    0x16830e74, 0x73696c23, 0x05c34a74, 0x0e880d20, 0x0d8b0883, 0x0f737522,
-    0xd44d1b88, 0x530f8306, 0x70240797, 0x0873756c, 0x82071c44, 0x73752196,
-    0x20063642, 0x8514841c, 0x102144a2, 0x2888b382, 0x84085548, 0x646e2030,
-    0x5285056e, 0x656e6f32, 0x636f7006, 0x0874656b, 0x656b6f70, 0x6c6c6162,
-    0x6c280882, 0x696f7261, 0x6f700464, 0x6c250d85, 0x786f622d, 0x230d8207,
-    0x72656d79, 0x702b0782, 0x6e726f63, 0x756f7005, 0x8409646e, 0x054c4105,
-    0x65776f25, 0x83700e72, 0x412d2005, 0x0c2007bb, 0x61840e86, 0x5a700c21,
-    0x11200af2, 0x2d200c8b, 0x0728ef83, 0x6e697270, 0x0a726574, 0x2d230786,
-    0x870d6433, 0x6c61330a, 0x14747265, 0x666f7270, 0x69737365, 0x6c616e6f,
-    0x9151682d, 0x82092005, 0x656a2614, 0x726f7463, 0x20098810, 0x050e552d,
-    0x75700524, 0xde82736c, 0x7a7a752c, 0x7106656c, 0x646f6372, 0x06850b65,
-    0x61292182, 0x75710a6e, 0x6f636461, 0x20738270, 0x390a820c, 0x7974696c,
-    0x6769682d, 0x75710968, 0x746b6369, 0x05656d69, 0x61646172, 0x05820872,
-    0x82616921, 0x220e8361, 0x830e6f69, 0x2d6f2a0e, 0x646e6168, 0x646c6568,
-    0x200e850b, 0x85f78374, 0x6361250b, 0x65766974, 0x62202685, 0x2007d168,
-    0x6826840f, 0x2a820986, 0x62707331, 0x79727265, 0x72076970, 0x652d7961,
-    0x860d646e, 0x057a5007, 0x0d830920, 0x61747325, 0x880f7472, 0x84198509,
-    0x83198427, 0x830a2035, 0x7627081d, 0x65747265, 0x616c0878, 0x61707473,
-    0x72047373, 0x0a646165, 0x74756f79, 0x2d656275, 0x72077674, 0x69656365,
-    0x82067470, 0x726f2307, 0x06850a64, 0x06822d20, 0x79231983, 0x82656c63,
-    0x64642919, 0x72047469, 0x0c6f6465, 0xb6450483, 0x2f208207, 0x73657266,
-    0x65720568, 0x0e786567, 0x616c6572, 0x2d23de83, 0x84616373, 0x6f6c2a35,
-    0x72066461, 0x746f6d65, 0x24568265, 0x656d616e, 0x82e5822d, 0x65702311,
-    0x11827461, 0x2d260683, 0x0b66666f, 0x0a856572, 0x83636e21, 0x6c70236c,
-    0x52827961, 0x796c7023, 0x05814c09, 0x6c6c6123, 0x2909820c, 0x75646f72,
-    0x6f697463, 0x7482136e, 0x837a6921, 0x7474234c, 0x43546d6f, 0x264e8205,
-    0x6e6f7073, 0x83766973, 0x69772242, 0x2679826e, 0x6f626269, 0x8272046e,
-    0x830c2085, 0x31b68704, 0x636f7206, 0x0974656b, 0x61746f72, 0x332d6574,
-    0x09860b64, 0x66656c24, 0x0b8a1374, 0x8608e152, 0x69722513, 0x14746867,
-    0x21870c8b, 0x6f720f2f, 0x72657475, 0x7269772d, 0x73656c65, 0x82628273,
-    0x0373250f, 0x07737372, 0xf6830382, 0x75720535, 0x0872656c, 0x2d6e7572,
-    0x74736166, 0x6c617304, 0x82730965, 0x6c6c2580, 0x11657469, 0x53620988,
-    0x63732108, 0x0e202182, 0x2d300584, 0x68746162, 0x6d6f6f72, 0x68637306,
-    0x0f6c6f6f, 0x2005c542, 0x238a842d, 0x146e6f69, 0x2d210f8e, 0x20e1826c,
-    0x2614830b, 0x69726477, 0x82726576, 0x69722c37, 0x73027470, 0x65730464,
-    0x82096c61, 0x2d742604, 0x74616c66, 0x46098810, 0x642105b4, 0x2c108415,
-    0x69646e69, 0x75646976, 0x732d6c61, 0x209e8275, 0x22158412, 0x8367656c,
-    0x652d2684, 0x61727478, 0x26128c13, 0x6d726f6e, 0x8c146c61, 0x65722613,
-    0x65637564, 0x203b8564, 0x05a06172, 0x12873b8b, 0x08293b85, 0x75636573,
-    0x79746972, 0x7b088710, 0x062707a7, 0x656c6573, 0x850a7463, 0x612d2406,
-    0x860e6c6c, 0x6e69210a, 0x7321db82, 0x22198765, 0x8266666f, 0x2b2b83d9,
-    0x046e6f69, 0x646e6573, 0x72657306, 0x0c202282, 0x6d450685, 0x860e2005,
-    0x06ec440c, 0x0e8d1220, 0x44822d20, 0x35834f82, 0x0b200a83, 0x70241d86,
-    0x0d73756c, 0x88450b86, 0x860f2005, 0x20ad870d, 0x08d84408, 0x2d2a0887,
-    0x0a786f62, 0x70616873, 0x3e832d65, 0x0a820520, 0x0d657222, 0x8a420584,
-    0x68732608, 0x646c6569, 0x6306850e, 0x732708aa, 0x70706f68, 0x82676e69,
-    0x37088517, 0x73756d2d, 0x73086369, 0x64657268, 0x07726564, 0x66756873,
-    0x10656c66, 0x2d290786, 0x61736964, 0x64656c62, 0x4910870f, 0x05260615,
-    0x6d676973, 0x05820c61, 0x632d6e29, 0x69747561, 0x83066e6f, 0x6c612d0c,
-    0x6c69730a, 0x77726576, 0x0f657261, 0x2d250a89, 0x6b726f66, 0x250f8a10,
-    0x6f6f7073, 0x108a126e, 0x03245886, 0x096d6973, 0x2d260382, 0x72656c61,
-    0x09830774, 0x66666f22, 0x74290782, 0x70616d65, 0x696b730d, 0x08697a70,
-    0x0d840c20, 0x20062b48, 0x230c8409, 0x7478656e, 0x702e2485, 0x69766572,
-    0x0573756f, 0x70796b73, 0x05840e65, 0x82622d21, 0x656e22ed, 0x2a148273,
-    0x6b63616c, 0x656c7305, 0x84097065, 0x842d2005, 0x6f6d2765, 0x676e696b,
-    0x0785730b, 0x08271383, 0x70616e73, 0x82616863, 0x6f6e248a, 0x82616d77,
-    0x636f29e6, 0x04726563, 0x61666f73, 0x72260482, 0x6f731174, 0xae827472,
-    0x2009f07b, 0x2111850e, 0x6a546373, 0x210e8406, 0x0f876564, 0x0f840c20,
-    0x2a4e6e20, 0x860c8505, 0x730a2bfc, 0x646e756f, 0x756f6c63, 0x0a820b64,
-    0x65637223, 0x20dd822d, 0x2c0b876b, 0x6c6c7570, 0x65707307, 0x72656b61,
-    0x4207860b, 0x702a054b, 0x6f646565, 0x6574656d, 0x17820a72, 0x636c6c26,
-    0x6b636568, 0x6f2f2a82, 0x79666974, 0x6f707309, 0x67696c74, 0x880e7468,
-    0x622d3009, 0x0a6d6165, 0x61757173, 0x692d6572, 0x890f636e, 0x632d340a,
-    0x0e687361, 0x63617473, 0x766f2d6b, 0x6c667265, 0x8206776f, 0x7269230e,
-    0x06820473, 0x74227982, 0x0e487261, 0x83092006, 0x682d2510, 0x08666c61,
-    0x6f230984, 0x850c6666, 0x054d4f08, 0x74730522, 0x1b826782, 0x72656526,
-    0x0d676e69, 0xbe410e82, 0x8c0f2009, 0x322d210d, 0x65213982, 0x24f08370,
-    0x64726177, 0x411c840e, 0x2d2206db, 0x0e820b32, 0x6f687427, 0x706f6373,
-    0x224e8265, 0x826b636f, 0x218e824e, 0x6282706f, 0x65726f25, 0x8274730d,
-    0x322d2705, 0x6f682d34, 0x13837275, 0x0e657628, 0x77627573, 0x12437961,
-    0x730a2f07, 0x6c676e75, 0x65737361, 0x77730f73, 0x774b7061, 0x840d200a,
-    0x07734b0f, 0x77730425, 0x82066d69, 0x63742e04, 0x77730568, 0x0464726f,
-    0x636e7973, 0x4204830a, 0x08200596, 0xec820a84, 0x61740324, 0x03820e62,
-    0x6e752d22, 0x22053944, 0x82056465, 0x656c220e, 0x32058417, 0x6c6f632d,
-    0x2d6e6d75, 0x73756c70, 0x7466612d, 0x91187265, 0x65622117, 0x6521e582,
-    0x44188c13, 0x12200509, 0x7725138c, 0x68746469, 0x2412850a, 0x74696465,
-    0x250a850b, 0x6772616c, 0x0b851065, 0x776f722a, 0x6965682d, 0x14746867,
-    0x7c891089, 0x148e1520, 0x3b8a7985, 0x06207685, 0x74202684, 0x6c24d783,
-    0x612d7465, 0x85058e7e, 0x2d74256e, 0x64617069, 0x672bf682, 0x67617409,
-    0x6361662d, 0x830c7365, 0x066b5209, 0x830b6521, 0x06164e0c, 0x67215982,
-    0x0bcb532d, 0xac825982, 0x7404743a, 0x0a697861, 0x6d616574, 0x77656976,
-    0x74087265, 0x67656c65, 0x0a6d6172, 0x76260883, 0x6f697369, 0x0a89106e,
-    0x75672d26, 0x13656469, 0x280a244e, 0x6c65632d, 0x73756973, 0x25138b16,
-    0x72686166, 0xfe826e65, 0x8b127421, 0x656b2d16, 0x6e69766c, 0x6e657406,
-    0x0473696e, 0x74290682, 0x72657407, 0x6e696172, 0x289a840e, 0x732d6f74,
-    0x63656570, 0x22358268, 0x882d7478, 0x6f2d230e, 0x29826666, 0x75747829,
-    0x74076572, 0x82616568, 0x82102035, 0x656d2d07, 0x67696c2d, 0x642d7468,
-    0x0b6b7261, 0x72211082, 0x0579436d, 0x0b8a1120, 0x6e2e2282, 0x740a7365,
-    0x626d7568, 0x776f642d, 0x0a89126e, 0x85088c45, 0x70752212, 0x65088710,
-    0x10840809, 0x752d7323, 0x273b8470, 0x63697406, 0x0e74656b, 0x35640685,
-    0x86132007, 0x6f63250e, 0x7269666e, 0x2e05285a, 0x65697403, 0x6d697409,
-    0x70616c65, 0x83056573, 0x08722109, 0x2d230584, 0x85073031, 0x84332008,
-    0x83722020, 0x850a20de, 0x61732311, 0x1484646e, 0x6261742c, 0x740d656c,
-    0x6c67676f, 0xff422d65, 0x8c112005, 0x0513410d, 0x6c6f6f27, 0x0c706974,
-    0x24078574, 0x6964652d, 0x84348274, 0x562d2014, 0x1a870518, 0x20060742,
-    0x240f8e14, 0x756c702d, 0x223f8873, 0x84786574, 0x6874213f, 0x2a086f4e,
-    0x0d726f74, 0x66617274, 0x41636966, 0x0520056c, 0x69220d82, 0x0582046e,
-    0x820a6d21, 0x736e2704, 0x62697263, 0x0a891065, 0x2005954f, 0x08bf7908,
-    0x65727424, 0x04820665, 0x6f6c6c22, 0x87454982, 0x642d2405, 0x826e776f,
-    0x220d8633, 0x8275656e, 0x0b6c212e, 0x6e272582, 0x676e6964, 0x8270752d,
-    0x6169223f, 0x82fd826e, 0x87088525, 0x264b8292, 0x7968706f, 0x8372740c,
-    0x612d2606, 0x64726177, 0x860c860e, 0x450e87e5, 0x162006cb, 0x82661d86,
-    0x22c9820e, 0x826b6375, 0x3505822b, 0x6c65642d, 0x72657669, 0x73740b79,
-    0x74726968, 0x6572632d, 0x0b860877, 0x74067628, 0x6c626d75, 0x06850d72,
-    0x65722d2e, 0x676f6c62, 0x69777406, 0x07686374, 0x74230683, 0x860b7265,
-    0x622d2407, 0x870e786f, 0x059d4d0b, 0x0e870f20, 0x7465722e, 0x74656577,
-    0x75627506, 0x0775746e, 0x72245482, 0x086f6361, 0x65240783, 0x10616c6c,
-    0xb3590887, 0x6e752408, 0x830c6f64, 0x07394504, 0x6e75162b, 0x646c6f66,
-    0x73656c2d, 0x0a354573, 0x6d231687, 0x8a65726f, 0x75072716, 0x6f72676e,
-    0x07827075, 0x70617425, 0x66066470, 0x03380516, 0x14627375, 0x74636576,
-    0x612d726f, 0x6e617272, 0x612d6567, 0x65766f62, 0x6224148f, 0x776f6c65,
-    0x07724518, 0x1520cb85, 0x0d853786, 0x8708dc51, 0x6d6f2615, 0x656e6962,
-    0x240e870c, 0x65767275, 0x280c8611, 0x66666964, 0x6e657265, 0x89668863,
-    0x877e8211, 0x22148a7b, 0x86136162, 0x6e69253b, 0x73726574, 0x6923b182,
-    0x860b6e6f, 0x8a6c2013, 0x6f702168, 0x0e202182, 0x70271886, 0x67796c6f,
-    0x8a0f6e6f, 0x202b830e, 0x460f8610, 0x4882051d, 0x84682087, 0x21208608,
-    0x1c826e75, 0x65760837, 0x69666972, 0x76076465, 0x61726269, 0x76056574,
-    0x6f656469, 0x24058409, 0x66666f2d, 0x4309850c, 0x0b2c059b, 0x77656976,
-    0x6567612d, 0x0a61646e, 0x72240b85, 0x0d796172, 0x63240a84, 0x756f7261,
-    0x24857582, 0x20058746, 0x2919840e, 0x68736164, 0x72616f62, 0x0e860864,
-    0x84097921, 0x72672308, 0x3b856469, 0x61656823, 0x85bc8364, 0x696c2317,
-    0x45857473, 0x646f6d25, 0x85656c75, 0x7571236a, 0x16866c69, 0x72747325,
-    0x856d6165, 0x6577232c, 0xb4826b65, 0x6f656d33, 0x6e657605, 0x76026f6d,
-    0x6b76066b, 0x786f622d, 0x41068209, 0x033a05bf, 0x09636c76, 0x63696f76,
-    0x69616d65, 0x6f760b6c, 0x656d756c, 0x6769682d, 0x0b860a68, 0x776f6c23,
-    0x5a0a860d, 0x188705ce, 0x66666f2c, 0x6e707603, 0x6c617704, 0x0482066b,
-    0x74656c23, 0x2406850f, 0x6669672d, 0x21f48274, 0x0f861164, 0x6d656d2a,
-    0x73726562, 0x0d706968, 0x74301186, 0x65766172, 0x6177036c, 0x6177056e,
-    0x0c686374, 0x2d260584, 0x6f707865, 0x0c867472, 0x83058d5f, 0x7265221f,
-    0x221f8209, 0x822d7265, 0x20418273, 0x27098274, 0x63726570, 0x0a746e65,
-    0x70291785, 0x0e706d75, 0x74616577, 0x261a8268, 0x756f6c63, 0x870b7964,
-    0x6f66230e, 0x0b870c67, 0xe4826820, 0x0c871120, 0xe5826c20, 0x696e7425,
-    0x870d676e, 0x836e2011, 0x87142011, 0x6170250d, 0x796c7472, 0x0f204d85,
-    0x6f221488, 0x328b7275, 0x69617224, 0x4088796e, 0x6f6e7323, 0x230d8a77,
-    0x796e6e75, 0x73269688, 0x65736e75, 0x48871374, 0x2d240e85, 0x6e776f64,
-    0x13869188, 0x88707521, 0x69772550, 0x1579646e, 0x0d843387, 0x24077243,
-    0x62657703, 0x22038206, 0x826d6163, 0x22b98306, 0x8365770f, 0x6b2d3706,
-    0x676f6c69, 0x086d6172, 0x74616877, 0x70706173, 0x65687718, 0xc9796c65,
-    0x61200805, 0x73656363, 0x69626973, 0x7974696c, 0x69687712, 0x622d6574,
-    0x6e616c61, 0x612d6563, 0x1a6f7475, 0x6924128d, 0x6e61636e, 0x21052f4b,
-    0x1a8e1874, 0x86697221, 0x8d132018, 0x27c68218, 0x7704796e, 0x08696669,
-    0x2d320483, 0x0366666f, 0x09696977, 0x696b6977, 0x69646570, 0x525f0c61,
-    0x05284605, 0x0c8b0d20, 0x860f6421, 0x616d270d, 0x696d6978, 0x0f88657a,
-    0x846e6921, 0x860b200f, 0x706f241f, 0x860e6e65, 0x6572270b, 0x726f7473,
-    0x0e850765, 0x77097326, 0x7064726f, 0x73211482, 0x30098206, 0x0472656b,
-    0x70617277, 0x65727706, 0x0a68636e, 0x06dd6777, 0x04747327, 0x786f6278,
-    0x2204830f, 0x656f632d, 0x132007b1, 0xbc840f8e, 0x61647828, 0x6e697804,
-    0x04830867, 0x35822d20, 0x08840b20, 0x26064243, 0x056c6d78, 0x82616579,
-    0x65792450, 0x5107706c, 0x07230675, 0x8370697a, 0x730e2a2a, 0x6f727275,
-    0x2d646e75, 0x44058373, 0x72280784, 0x61746365, 0x656c676e, 0x24092654,
-    0x63656863, 0x074c686b, 0x6e696c28, 0x74732d65, 0xc86a6c79, 0x41118408,
-    0x092005e1, 0x3b08bb65, 0x696f7605, 0x6f076563, 0x69636170, 0x6e077974,
-    0x2d726165, 0x6313656d, 0x6b636f6c, 0x48051f4b, 0x683608c8, 0x6e616d75,
-    0x6572702d, 0x6e616e67, 0x74730774, 0x656b6369, 0x7b500d72, 0x616c2507,
-    0x1465636e, 0x08da4a18, 0x64726123, 0x06c6722d, 0x4a181620, 0x6d25108a,
-    0x73756e69, 0xe7491810, 0x233a8208, 0x676e6964, 0x74271089, 0x6f656b61,
-    0x18146666, 0x5b0ba849, 0x612c08b8, 0x6d69746c, 0x72657465, 0x696e6109,
-    0x24052b49, 0x6f6f620a, 0x05b84f6b, 0x0a841620, 0x65706f22, 0x6122aa82,
-    0x41186567, 0x70240db0, 0x0773756c, 0x6d2d2082, 0x08786f62, 0x6c6c7562,
-    0x65796573, 0x0d8d760e, 0x61630a27, 0x6172656d, 0x257f822d, 0x6568630c,
-    0x1e4d6b63, 0x8b142006, 0x084a480c, 0x6e616325, 0x82656c64, 0x72612a28,
-    0x75622d74, 0x656c6262, 0x0bbe750f, 0x07234582, 0x83707563, 0x63092b4d,
-    0x7279706f, 0x74686769, 0xb174630b, 0x65742405, 0x740e7478, 0x2d28052b,
-    0x65726f66, 0x0c726576, 0x732e0e86, 0x70656577, 0x63696408, 0x32642d65,
-    0x08850730, 0x07863420, 0x07863620, 0x6404382c, 0x126b7369, 0x69616d65,
-    0xf2842d6c, 0xaa4d6f20, 0x06b87205, 0x2206ae48, 0x6976650a, 0x0f2407a4,
-    0x646f6f66, 0x6b276b83, 0x6972642d, 0x84086b6e, 0x20a4820f, 0x287f820c,
-    0x2d74616d, 0x6c746974, 0x07fd6765, 0x70616d26, 0x65680b73, 0x7026da83,
-    0x65736c75, 0xbd826807, 0x79617728, 0x6d6f680f, 0x09612d65, 0x69092d09,
-    0x676f636e, 0x6f74696e, 0x74656b06, 0xdd614082, 0x6c702905, 0x6c0d7375,
-    0x6e69676f, 0x6108e547, 0x0e8705c6, 0x580b495e, 0x18200835, 0x880a495e,
-    0x822d2014, 0x700a2ba2, 0x2d656761, 0x73726966, 0x0a840974, 0x73616c23,
-    0x06485874, 0x0b826320, 0x63697328, 0x6972700d, 0x8755726f, 0x880c2007,
-    0x6c28080d, 0x7106776f, 0x61686371, 0x6f700474, 0x720e6c6f, 0x646e756f,
-    0x632d6465, 0x656e726f, 0x6f720672, 0x676e6977, 0x78617309, 0x25068d60,
-    0x6e676973, 0xb5886c61, 0x21053f4f, 0x4f657865, 0x73172305, 0x156c6275,
-    0x726f2405, 0x7c612d79, 0x1820084b, 0x23081792, 0x68676972, 0x65740774,
-    0x6f627478, 0x69760678, 0x6e696c6f, 0x7369760c, 0x736c6175, 0x69647574,
-    0x6577066f, 0x74205582, 0x32059e46, 0x6b72616d, 0x6c69660b, 0x69682d65,
-    0x6e656464, 0x7870610b, 0x69230598, 0x850e6e6f, 0x454b1868, 0x850c2007,
-    0x78653e0e, 0x646e6170, 0x776f6204, 0x7262066c, 0x65676469, 0x66756206,
-    0x04726566, 0x70696863, 0x0cb37815, 0xfa687320, 0x69642b07, 0x61706c61,
-    0x69640a64, 0x59827463, 0x79726123, 0x06fd411e, 0x6f09d775, 0x5c6d0ca7,
-    0x241e9007, 0x7466656c, 0x843b971d, 0x4f3a87fb, 0x5786078f, 0x9605cf6c,
-    0x6563261c, 0x7265746e, 0x8e578619, 0x6f742e39, 0x61680a70, 0x72656b63,
-    0x7377656e, 0x0a636913, 0x3d08f34a, 0x6e6f736a, 0x6d616c06, 0x06616462,
-    0x7274616d, 0x6d067869, 0x6f657465, 0x696d0872, 0x90516378, 0x67693805,
-    0x6c2d616d, 0x7265776f, 0x756f730d, 0x2d656372, 0x6e617262, 0x860c6863,
-    0x656d310d, 0x04656772, 0x656e7574, 0x62657707, 0x6b6f6f68, 0x087a4f18,
-    0x20074741, 0x07d64418, 0x4308ca53, 0x1326066f, 0x6c707061, 0x30672d65,
-    0x8f16200c, 0x6d6f2513, 0x646e616d, 0x6e251691, 0x6c6f7274, 0x262d8e15,
-    0x6974706f, 0x8e146e6f, 0x68733615, 0x0a746669, 0x2d786f62, 0x64616873,
-    0x6305776f, 0x73647261, 0x6005840d, 0x0d850890, 0x616c7026, 0x676e6979,
-    0x1e201587, 0x11244018, 0x616c6223, 0x07ea446e, 0x1e9d2620, 0x08ba4c18,
-    0x6d252691, 0x656b7261, 0x06314564, 0x1f9e2720, 0x32080a5b, 0x756f6c63,
-    0x79732d64, 0x6307636e, 0x616c6c6f, 0x430f6567, 0xf4820560, 0x662d732c,
-    0x0e6b726f, 0x73617265, 0x91437265, 0x66042507, 0x0c656361, 0x2d270483,
-    0x666f7270, 0x74656c69, 0x742405e8, 0x16656572, 0x26063742, 0x6f6e6e61,
-    0x82746174, 0x05a24e42, 0x7361672f, 0x6c79632d, 0x65646e69, 0x72670d72,
-    0x204f8265, 0x05de5c2d, 0xd9460c20, 0x05a76e05, 0x0c850e20, 0x65252082,
-    0x676e6974, 0x290e850f, 0x646e6168, 0x776f6473, 0x0f8a0d6e, 0x0a707522,
-    0x6d230d85, 0x69656c61, 0x08420cd7, 0x6c0b2406, 0x86646165, 0x45102064,
-    0xa846092e, 0x8a0f2005, 0x6c702110, 0x22053866, 0x6572656b, 0x13830844,
-    0x696d0a24, 0x28537263, 0x6d0b2c05, 0x2d65766f, 0x69736572, 0x8a13657a,
-    0x0866590b, 0x77617027, 0x66666f2d, 0x05ed5c0b, 0x6e696d25, 0x850a7375,
-    0x2449830b, 0x746f7003, 0x82038207, 0x0b78227b, 0x05746673, 0x726f7029,
-    0x68731174, 0x41657061, 0x2d2006b0, 0x12202983, 0x034d1185, 0x20128406,
-    0x48128514, 0x14840872, 0x6b543986, 0x20398306, 0x08b55510, 0x18204f86,
-    0xf141108f, 0x84142007, 0x72702118, 0x8605d555, 0x931c202d, 0x28318714,
-    0x72707305, 0x730b7961, 0xba4f1874, 0x8a132008, 0x081b480b, 0x7365742d,
-    0x75742d74, 0x740b6562, 0x43747865, 0x0d250617, 0x656e7574, 0x0747442d,
-    0x6163082b, 0x6f2d7472, 0x630b6666, 0x25098368, 0x746e6167, 0x0b851874,
-    0x61637332, 0x72657474, 0x746f6c70, 0x7865682d, 0x0e6e6962, 0x74351885,
-    0x6c656d69, 0x07656e69, 0x63736964, 0x0c64726f, 0x656c6966, 0x06374a2d,
-    0x616c0a23, 0x05606a6e, 0x890c6321, 0x70702f0a, 0x6d617804, 0x6162086c,
-    0x6163646e, 0xd57d706d, 0x6c70250c, 0x69067375, 0x73289783, 0x776f6207,
-    0x6569742d, 0x09724718, 0x4e827220, 0x63106522, 0x2207637d, 0x83647375,
-    0x660d25ae, 0x6873616c, 0x642f7382, 0x6579652d, 0x72616f03, 0x61697005,
-    0x4c176f6e, 0x2d25108e, 0x6e696172, 0x09284c79, 0x776f6e23, 0x25138579,
-    0x6e697908, 0x5e82792d, 0x6f740b2c, 0x2d726577, 0x63616562, 0x0b850a68,
-    0x72696624, 0x7d480d65, 0x06984a06, 0x616e643e, 0x6d616809, 0x67727562,
-    0x67077265, 0x6f646e6f, 0x6905616c, 0x786f626e, 0x6f657212, 0x0e464a18,
-    0x12871020, 0x20076941, 0x08a3590d, 0x6f683208, 0x7409656d, 0x682d6761,
-    0x74726165, 0x756b7305, 0x73056c6c, 0x64696c6f, 0x616c610c, 0x732d6d72,
-    0x7a6f6f6e, 0x61620a65, 0x622d7962, 0x79676775, 0x289a8206, 0x0472656b,
-    0x626d6f62, 0xaa481811, 0x48401808, 0x490c2007, 0x998206a3, 0x0f747322,
-    0x08824118, 0x2a056469, 0x696f6305, 0x630b736e, 0x5a706f72, 0x652805fb,
-    0x7665640f, 0x706f6c65, 0x6f33f183, 0x0e647261, 0x6e2d6f64, 0x642d746f,
-    0x75747369, 0x8d126272, 0x6f2d290e, 0x64066666, 0x6162756f, 0x230adc7b,
-    0x64616564, 0x2809be7b, 0x69637865, 0x0b646574, 0x05bb7766, 0x76747321,
-    0x74240f78, 0x0e747865, 0x50068844, 0x08280675, 0x64617267, 0x746e6569,
-    0x4905d16f, 0x102006a9, 0x75072669, 0x37690748, 0x83108708, 0x6e04258e,
-    0x0a656b75, 0x23050b5f, 0x67756c70, 0x8306255f, 0x281e830a, 0x62757007,
-    0x6873696c, 0x0690420d, 0x6c632d2a, 0x056b636f, 0x6f626f72, 0x20085d75,
-    0x05c75c72, 0x0730392a, 0x6e616373, 0x0672656e, 0x20055157, 0x09375410,
-    0x6d652d25, 0x53797470, 0x69380588, 0x72742d74, 0x66736e61, 0x75057265,
-    0x7974696e, 0x64707506, 0x0d657461, 0x5005674f, 0x073006d2, 0x75676e61,
-    0x0572616c, 0x626c6f64, 0x6d650479, 0x6c2d0482, 0x11706d61, 0x756e656d,
-    0x776f642d, 0x0799436e, 0x11840f20, 0x62707521, 0x6e2308aa, 0x6065746f,
-    0x15200874, 0xc8470d8c, 0x6c702a08, 0x700c7865, 0x656e616c, 0x05fb5a2d,
-    0x08675618, 0x69646524, 0x1d4c0e74, 0x65643605, 0x72676163, 0x610d6d61,
-    0x692d6c6c, 0x756c636e, 0x65766973, 0x22998609, 0x490e736a, 0x8c840529,
-    0x786f6222, 0x6c240e86, 0x2d746665, 0x0f200e82, 0x72231d85, 0x84686769,
-    0x0657490f, 0x1c82a882, 0x7361083b, 0x69726574, 0x62086b73, 0x2d626d6f,
-    0x0966666f, 0x746f6f62, 0x61727473, 0x06664770, 0x2006e945, 0x2546180e,
-    0x6c662309, 0x4518776f, 0x8d4b078a, 0x630e2105, 0x65213982, 0x082b5665,
-    0x6e6f6327, 0x74636174, 0x07eb4b73, 0x706d6524, 0xbb7e7974, 0x25758206,
-    0x7261650d, 0x4b626874, 0x66662205, 0x05dd4b0b, 0x0b22eb84, 0x45887965,
-    0x0b840f20, 0x097c4518, 0x82661421, 0x077059ac, 0x07216a87, 0x05d25066,
-    0x69660c2c, 0x722d646e, 0x616c7065, 0x48446563, 0x06804206, 0xa5420b20,
-    0x82662006, 0x77112094, 0x67270889, 0x72622d65, 0x426b6165, 0x702e07c3,
-    0x72636c69, 0x6706776f, 0x67617261, 0x06850b65, 0x706f2d25, 0x750b6e65,
-    0x6620068b, 0x374c5982, 0x656b2407, 0x740d7065, 0x68270735, 0x736f746f,
-    0x8265680f, 0x682d2ad4, 0x2d666c61, 0x6c6c7566, 0x200f890a, 0x180a8912,
-    0x61087655, 0x1f42069b, 0x68042508, 0x086b6f6f, 0x2d260483, 0x0866666f,
-    0xcf826e69, 0x79746922, 0x2409d96f, 0x66697773, 0x09d96f74, 0x70797423,
-    0x05d96f65, 0x82078e6f, 0x6c0c2136, 0x2307db6e, 0x146e6f2d, 0xdf620c8b,
-    0x6f6c3108, 0x702d6b63, 0x65747461, 0x6c046e72, 0x15706f6f, 0x460c466e,
-    0x4e6e08be, 0x086b410b, 0x69616d32, 0x786f626c, 0x64656d0b, 0x6c616369,
-    0x6761622d, 0x4a08dd43, 0xee430833, 0x0f334a07, 0x696d1123, 0x05be676e,
-    0x7a5e4f88, 0x64102906, 0x6c6e776f, 0x2d64616f, 0x0c241086, 0x706c6568,
-    0x0e200c87, 0x87059055, 0x6e03310e, 0x6e036d70, 0x6f087475, 0x67617463,
-    0x106d6172, 0x2906294d, 0x74756f79, 0x646f622d, 0x108b1279, 0x6f6f6625,
-    0x8c726574, 0x05647a12, 0x258b1820, 0x6469732c, 0x72616265, 0x66656c2d,
-    0x18931974, 0x67697225, 0x490d7468, 0x2d20054c, 0x20053b46, 0x820d8208,
-    0x6e6f2281, 0x4f088710, 0x702e0832, 0x616c6c69, 0x69700672, 0x6c6f7473,
-    0xb5687010, 0x0d636406, 0x22069c42, 0x4172700c, 0x692006c7, 0xdf634983,
-    0x412d2005, 0x0526073b, 0x63616572, 0x22820774, 0x7261742a, 0x65720e74,
-    0x646e6977, 0x27083e41, 0x6d6f6872, 0x0f737562, 0x5f880786, 0x6f722208,
-    0x2d746f62, 0x75636176, 0x72036d75, 0x730a6e75, 0x63726165, 0x65772d68,
-    0x68730662, 0x6c65766f, 0x2406850a, 0x66666f2d, 0x06094e09, 0x87673221,
-    0x88332009, 0x67342209, 0x241d860b, 0x61707368, 0x200b8a10, 0x29d4832d,
-    0x6f6e7309, 0x616c6677, 0x614c656b, 0x6f632607, 0x74696d6d, 0x06614c11,
-    0x2d240d85, 0x17646e65, 0x2d261190, 0x61636f6c, 0x178d136c, 0x18201384,
-    0x6e23138d, 0x94747865, 0x7473252c, 0x1e747261, 0x13842c8d, 0x32892d20,
-    0x765e1020, 0x62772007, 0x07200690, 0x642b2182, 0x036d7569, 0x08677673,
-    0x84676174, 0x830a20c7, 0x65722508, 0x65766f6d, 0x5507b55a, 0x0524063b,
-    0x646c6974, 0x29081482, 0x73616572, 0x2d657275, 0x73656863, 0x72740d74,
-    0x2d6b6375, 0x69617274, 0x0d72656c, 0x77656976, 0x7261702d, 0x656c6c61,
-    0x0d840f6c, 0x71657335, 0x746e6575, 0x0f6c6169, 0x68736177, 0x2d676e69,
-    0x8263616d, 0x07653507, 0x70626577, 0x076b6361, 0x67646977, 0x04737465,
-    0x75696977, 0x4506a145, 0x6c2206bf, 0xcf451364, 0x646c260c, 0x786f622d,
-    0x4613921b, 0xa14f0879, 0x882a8209, 0x0600463f, 0x138c3f8c, 0x46088c44,
-    0x6c220d21, 0x108f1464, 0x78215682, 0x4614931c, 0x1c8508ec, 0x84707521,
-    0x8c112080, 0x2112820d, 0x11901978, 0x25082c43, 0x636e6163, 0x6e4a6c65,
-    0x066f4e05, 0x65671227, 0x72757473, 0xa34d1865, 0x61742207, 0x23128870,
-    0x70697773, 0x77211883, 0x83128e6e, 0x871320da, 0x25258538, 0x68676972,
-    0x138d1074, 0x0b707522, 0x56821087, 0x0b881620, 0x8a6f7721, 0x8b0f206d,
-    0x08268216, 0x75680d38, 0x656c626d, 0x6e75622d, 0x0b656c64, 0x6b63696b,
-    0x72617473, 0x07726574, 0x6674656e, 0x0778696c, 0x6e656e6f, 0x0965746f,
-    0x69726570, 0x706f6373, 0x62750465, 0x185a7265, 0x61722607, 0x73756964,
-    0x0f39551d, 0x18616221, 0x980a2b58, 0x6d65251d, 0x1c797470, 0x66243b97,
-    0x1b6c6c75, 0x6c231c97, 0x971e776f, 0x05ab581b, 0x1e971f20, 0x6b6e7526,
-    0x6e776f6e, 0x230af747, 0x73756c70, 0x8305854e, 0x47132009, 0x6125064a,
-    0x6e67696c, 0x05ee502d, 0x6d25138d, 0x6c646469, 0x07327e65, 0x74232785,
-    0x8612706f, 0x696c2338, 0xcf4a7473, 0x47732005, 0x71340796, 0x65746f75,
-    0x65706f2d, 0x72670a6e, 0x6c2d6469, 0x65677261, 0x2806a17a, 0x0566666f,
-    0x6973756d, 0x06157263, 0x08240f82, 0x2d626174, 0x95598b83, 0x200b8307,
-    0x078a590c, 0x756e6923, 0x24188773, 0x6574756d, 0x0b175c14, 0x8707c14b,
-    0x6f6d2214, 0x09404d72, 0x61740425, 0x4d0e6f63, 0xa84506f7, 0x85062006,
-    0x4506200e, 0x0e2005fc, 0xc4420685, 0x06a84907, 0x33079246, 0x6f746104,
-    0x65630d6d, 0x6e696c69, 0x696c2d67, 0x11746867, 0x2405654d, 0x2d726162,
-    0x235d8273, 0x1264656b, 0x22821185, 0x12876520, 0xe9490820, 0x87102007,
-    0x23608708, 0x6369640d, 0x55094c4a, 0x31220635, 0x9e4b0b30, 0x706f2306,
-    0x817c6e65, 0x29ba8207, 0x69747375, 0x6f6c0763, 0x7f826461, 0x6f6c0a31,
-    0x722d6b63, 0x74657365, 0x6e696e05, 0x8710616a, 0x084151a6, 0x880cd746,
-    0x08045c72, 0x666f2d24, 0x3e820766, 0x6c612d24, 0x07830a6c, 0x2005be52,
-    0x210a8910, 0xe383722d, 0x10830820, 0x66656c24, 0x08870f74, 0x29852d20,
-    0x0f880e20, 0x6e242789, 0x09656e6f, 0x12841783, 0xfd4a1020, 0x093e4905,
-    0x69730e25, 0x512d6e67, 0x09200823, 0x74240e84, 0x0a747865, 0x82068546,
-    0x410b2093, 0x2d250592, 0x746f6f72, 0x3cf2830d, 0x2d72656b, 0x6a6f6d65,
-    0x75730669, 0x74696d6d, 0x6f77730b, 0x632d6472, 0x73736f72, 0x05b5450a,
-    0x7361662c, 0x61790674, 0x72656d6d, 0x0b826308, 0x0829db83, 0x706c6568,
-    0x786f622d, 0x0a294c0f, 0x6c75662a, 0x6177056c, 0x0a736576, 0x2405c04d,
-    0x6c6c6562, 0x3b0a850b, 0x6867696c, 0x6e610c74, 0x696f7264, 0x65682d64,
-    0x61086461, 0x6f727070, 0x136c6176, 0x240dc454, 0x776f642d, 0x23138f6e,
-    0x7466656c, 0x27066245, 0x6c6c6f63, 0x65737061, 0x20054041, 0x213c8e11,
-    0x11867075, 0x84050455, 0x18118d4c, 0x860a9060, 0x83722023, 0x0651469b,
-    0x752e1286, 0x6f620b70, 0x732d6b6f, 0x72756365, 0x0b840d65, 0x856e7521,
-    0x6213340d, 0x612d7375, 0x63697472, 0x74616c75, 0x652d6465, 0x8f15646e,
-    0x72662513, 0x11746e6f, 0x642d1583, 0x6c62756f, 0x65642d65, 0x72656b63,
-    0x2611830a, 0x6f686373, 0x84086c6f, 0x6469210a, 0x08bf5618, 0x706f6725,
-    0x4e166f72, 0x6d2706c4, 0x72657465, 0x42676e69, 0x1690060e, 0x2005c254,
-    0x202d8f17, 0x22978370, 0x8f146c61, 0x70733617, 0x6308746f, 0x616e6e61,
-    0x0f736962, 0x2d726163, 0x766e6f63, 0x82c48265, 0x830a209b, 0x7365260f,
-    0x65746174, 0x280a830d, 0x63746168, 0x63616268, 0x2618846b, 0x6b636970,
-    0x83087075, 0x82732018, 0x821384ad, 0x7472234e, 0x13820773, 0x61766128,
-    0x6363046e, 0x38517674, 0x6f642506, 0x1374756e, 0x8405a743, 0x4d2d200b,
-    0xbb43060c, 0x2a12860b, 0x69686309, 0x682d696c, 0x850c746f, 0x055e4509,
-    0x0c860a20, 0x646c6923, 0x0504540c, 0x61726226, 0x0a736563, 0x74240c85,
-    0x0c736761, 0x732cbd82, 0x2d656c6f, 0x656e696c, 0x726f6304, 0x0a3c4e18,
-    0x66686322, 0x092f4e18, 0x186e6321, 0x220a3c4e, 0x89687465, 0x706a2119,
-    0x6b23198a, 0x510d7772, 0x7321085a, 0x8b4e1869, 0x7774230b, 0x4d180f64,
-    0x632a0787, 0x7373616c, 0x640a6369, 0x3d637069, 0x82062006, 0x656b23e3,
-    0x4d181679, 0xef4a0e00, 0x84142006, 0x08ab5616, 0x25050045, 0x7261650b,
-    0x0482682d, 0x6e692208, 0x6c650867, 0x61687065, 0x650a746e, 0x746e6576,
-    0x74697262, 0x6f660e65, 0x632d646f, 0x73696f72, 0x2e198273, 0x726f6608,
-    0x66696c6b, 0x75660474, 0x47076c65, 0x10200665, 0x2806484d, 0x6c616e61,
-    0x63697479, 0x82108873, 0x747321a0, 0x40183782, 0x6f380bee, 0x680f6666,
-    0x2d686769, 0x69666564, 0x6974696e, 0x680e6e6f, 0x2d656d6f, 0x08a86018,
-    0x2305bc59, 0x6f747561, 0x20053b5b, 0x861e840b, 0x616c21b0, 0x2106c952,
-    0xd5526f67, 0x09723c09, 0x6176616c, 0x6d616c2d, 0x656c0970, 0x74732d64,
-    0x06706972, 0x6b636f6c, 0x850f7265, 0x08a94d06, 0x616d1223, 0x06507b70,
-    0x29089453, 0x7274656d, 0x6d6f6e6f, 0x09880e65, 0xc8822d20, 0x6d086b23,
-    0x3dfb8269, 0x0564732d, 0x6578696d, 0x6f6d0a72, 0x2d656976, 0x6c6c6f72,
-    0x73756d08, 0x6f6f7268, 0x0887106d, 0x2708cd49, 0x746e696e, 0x6f646e65,
-    0x22069541, 0x82756e04, 0x8270202e, 0x6f703cdd, 0x70127472, 0x6f697265,
-    0x2d636964, 0x6c626174, 0x6f632d65, 0x69700432, 0x83116570, 0x642d2304,
-    0x59187369, 0x0f2008a6, 0x20054c51, 0x23c48373, 0x75652d74, 0x75210f8d,
-    0x250f8e6b, 0x69720473, 0x04826563, 0x04676e23, 0x216c8273, 0x8382730b,
-    0x32063244, 0x796f7309, 0x7561732d, 0x73136563, 0x646e6174, 0x41647261,
-    0x12200a7d, 0x230dbe5d, 0x302d322d, 0x3322128f, 0x128f312d, 0x12913520,
-    0x12823720, 0x420a4767, 0x102106a0, 0x055b5a74, 0x82702d21, 0x6f772b95,
-    0x740e6472, 0x67756f68, 0x8c5c7468, 0x8d162006, 0x0883500e, 0x6172742a,
-    0x61706b63, 0x6c751564, 0x2d200a82, 0x230e3242, 0x6e61760d, 0x65255184,
-    0x7265676e, 0x270d830b, 0x6c697475, 0x06797469, 0x69360b82, 0x76086873,
-    0x6f656469, 0x0464332d, 0x6c6c6177, 0x706d7804, 0xe55d1d70, 0x6c702110,
-    0x09b95e18, 0x8b08185e, 0x072f5014, 0x6f2b4282, 0x74726106, 0x09747369,
-    0x826c7461, 0x616930c9, 0x7a61056e, 0x0a657275, 0x6b736162, 0x82627465,
-    0x18192022, 0x4c100762, 0x1c2007b7, 0x2d221998, 0x1c9a3031, 0x1c9b3220,
-    0x1c9b3320, 0x1c9b3420, 0x1c9b3520, 0x1c9b3620, 0x1c9b3720, 0x1c9b3820,
-    0x1f303922, 0x25190441, 0x72656c61, 0x1f992174, 0x2806c449, 0x74696207,
-    0x6e696f63, 0x615f1811, 0x20198609, 0xf65b1812, 0x08bc7009, 0x6f6c6326,
-    0x10726576, 0x55073c5f, 0x1420079a, 0x860c735c, 0x560e203f, 0x72200657,
-    0x25056861, 0x6f6f6404, 0x04830b72, 0x2105c161, 0x0b840964, 0x65706f2b,
-    0x6166076e, 0x666f2d6e, 0x05f14c66, 0x2806684e, 0x6e696607, 0x65636e61,
-    0x0502570c, 0x2205ab44, 0x826c660a, 0x702d2a45, 0x0d6e616c, 0x75726f66,
-    0x0836546d, 0x6c6f6723, 0x075a4266, 0x6d6f6834, 0x75670f65, 0x61662d79,
-    0x73656b77, 0x73616d2d, 0x14830c6b, 0x20077a69, 0x080c840a, 0x61656821,
-    0x68077472, 0x742d746f, 0x68046275, 0x09756c75, 0x2d656369, 0x61657263,
-    0x6d69096d, 0x83656761, 0x6b063794, 0x74617261, 0x616c0765, 0x75627964,
-    0x6f6e0867, 0x6f626574, 0x99766b6f, 0x65723706, 0x6e727574, 0x6b6f700a,
-    0x632d7265, 0x05706968, 0x70616873, 0x05840d65, 0x2008ec5a, 0x2a188273,
-    0x6568772d, 0x730c6c65, 0x8263636f, 0x6966252a, 0x0c646c65, 0x200b1f6c,
-    0x220c8511, 0x412d666f, 0x7321064d, 0x08ee6b09, 0x5105ca6b, 0x0e200804,
-    0x230a1344, 0x16786f62, 0x83112244, 0x2a258bb9, 0x0666666f, 0x69776f74,
-    0x520f676e, 0xef6b063c, 0x06916607, 0x2d6b3422, 0x13204982, 0x2d05e243,
-    0x75706e69, 0x6e612d74, 0x6e6e6574, 0x138b1561, 0x6d6f6329, 0x656e6f70,
-    0x8b10746e, 0x64682415, 0x8b12696d, 0x84732010, 0x7616250c, 0x2d776569,
-    0x4808ae66, 0x052e072a, 0x6a657576, 0x61780773, 0x6972616d, 0x07860f6e,
-    0x08915d18, 0x80747920, 0x72632e06, 0x6f746165, 0x74732d72, 0x6f696475,
-    0x2216870e, 0x826d6167, 0x216d18c5, 0x72673508, 0x0870756f, 0x75636361,
-    0x74666f73, 0x72696107, 0x74726f70, 0x4a065c4f, 0xc45e084b, 0x4a172009,
-    0xbd470e50, 0x4a178607, 0x2f89061f, 0x735f1520, 0x084f5a0b, 0x7561112a,
-    0x6e656d67, 0x2d646574, 0x6c27a582, 0x09797469, 0x82646162, 0x6f742c98,
-    0x6162086e, 0x61626573, 0x870c6c6c, 0x622d3508, 0x620b7461, 0x6c74746f,
-    0x69772d65, 0x630d656e, 0x6b636568, 0x1520f087, 0x62240d84, 0x692d786f,
-    0x72285082, 0x6964656d, 0x0a657461, 0x73231582, 0x826b2d73, 0x860c20eb,
-    0x696e240a, 0x86746867, 0x61702417, 0x850b6e77, 0x75712417, 0x866e6565,
-    0x6f722316, 0x2e866b6f, 0x73696225, 0x18706f68, 0x250a255d, 0x736c7570,
-    0xb3561765, 0x500f8409, 0xd24308f0, 0x07164207, 0x10871520, 0x78657423,
-    0x08e94774, 0x15941d20, 0x052a4487, 0x6e617263, 0x75630765, 0xb6846c72,
-    0x08305818, 0x49746421, 0x6b230998, 0x180f747a, 0x53088957, 0xbc4d0586,
-    0x32220807, 0x636f6406, 0x0e72656b, 0x726f6f64, 0x6c6c6562, 0x6469762d,
-    0x65086f65, 0x72656874, 0x086d7565, 0x30737965, 0x87102005, 0x08e05308,
-    0x73201083, 0x2006eb60, 0x4d0c8b14, 0x662408bb, 0x2d656c69, 0x2007b044,
-    0x06254e0e, 0xd6786e20, 0x66102705, 0x74636e75, 0xb3626f69, 0x670c2608,
-    0x67617261, 0x050c6565, 0x61670b23, 0x250b8275, 0x74706d65, 0x0b850a79,
-    0x6c756624, 0x0a85096c, 0x776f6c2b, 0x616c670a, 0x772d7373, 0x27fc8269,
-    0x70617267, 0x136c7168, 0x250e5c47, 0x786f622d, 0xdd83680b, 0x702d7926,
-    0x0d6b6375, 0x73250b86, 0x6b636974, 0x058f4473, 0x656c6125, 0x440a7472,
-    0x70250578, 0x0673756c, 0x2eae826a, 0x6c087972, 0x62656669, 0x0d796f75,
-    0x4278696d, 0x0c250970, 0x6974616e, 0x06295576, 0x6e6f0b23, 0x070c4865,
-    0x61700735, 0x6f657274, 0x6170066e, 0x6c617079, 0x61657005, 0x5e166563,
-    0x72200515, 0x1805105a, 0x2008465a, 0x18168c15, 0x25074e5a, 0x65697004,
-    0x04830a72, 0x72632d2f, 0x09656e61, 0x65706970, 0x61656c2d, 0x05c0556b,
-    0x700c6e25, 0x5679616c, 0x0837077e, 0x696d6572, 0x7265646e, 0x6f6f720c,
-    0x65732d6d, 0x63697672, 0x82730a65, 0x667325ce, 0x6563726f, 0x4809b675,
-    0x0521062d, 0x37928274, 0x68740e68, 0x6f6d7265, 0x74617473, 0x786f622d,
-    0x61727407, 0x726f7463, 0x2e078f6b, 0x696c6c65, 0x0f657370, 0x74726976,
-    0x436c6175, 0x14200767, 0x440bf369, 0x14860751, 0x1805fb69, 0x8508d763,
-    0x068c4c29, 0x65771122, 0x2505e869, 0x72727568, 0xd5826369, 0x30084244,
-    0x72616568, 0x6c610574, 0x056e6569, 0x69766e61, 0x7c6a186c, 0x18312011,
-    0x20122c6a, 0x22139235, 0x47183037, 0x0e471071, 0x62092306, 0x6c5b6465,
-    0x18122005, 0x8709b267, 0x861520ab, 0x05335212, 0x13201587, 0x0a956718,
-    0x6e22138f, 0xe7666e6f, 0x86142008, 0x69722427, 0x4d746867, 0x14860890,
-    0x706f7422, 0x5d081141, 0x65230853, 0x44746964, 0x8f440a0a, 0x630f270c,
-    0x6f736e6f, 0x7a58656c, 0x69662108, 0x63320c82, 0x61706d6f, 0x660a6572,
-    0x2d657269, 0x63757274, 0x43430a6b, 0x656b2306, 0x0a891279, 0x29089458,
-    0x11757067, 0x656d6f68, 0x0644632d, 0x73752207, 0x06ce7f64, 0x4c087b46,
-    0x6c22087a, 0x95516175, 0x6d732605, 0x10747261, 0x2446186d, 0x6d2d2608,
-    0x73756e69, 0x33108a0f, 0x73756c70, 0x6c61700e, 0x65747465, 0x6177732d,
-    0x0e686374, 0x260d024c, 0x63697007, 0x7b78616b, 0xed8308b7, 0x65720e24,
-    0x30826f6d, 0x2806eb4d, 0x75617307, 0x65676173, 0x08935910, 0x2006a641,
-    0x064c5111, 0x6c656329, 0x616c756c, 0x90312d72, 0x90322011, 0x17332111,
-    0x4d86358f, 0x73730324, 0xab741768, 0x08f3410e, 0x470cb374, 0x7428081c,
-    0x68746f6f, 0x6172740d, 0x20094167, 0x10654b16, 0x65686337, 0x610c6b63,
-    0x6f7a616d, 0x6c612d6e, 0x04617865, 0x68637261, 0x21f48203, 0xe268620e,
-    0x05a56606, 0x75620923, 0x051a5e73, 0x07566718, 0x4e5f4c86, 0x6d692307,
-    0x17506761, 0x696c2d05, 0x73756f6d, 0x0a656e69, 0x64726163, 0x75213583,
-    0x06f15c62, 0x61696427, 0x646e6f6d, 0x2418850b, 0x72616568, 0x240b8674,
-    0x64617073, 0x30661865, 0x6574240a, 0x4a117478, 0xfa5a0939, 0x500f2006,
-    0x6d290531, 0x69746c75, 0x656e696c, 0x05ce4913, 0x64652d24, 0xc2497469,
-    0x6f632308, 0x5f187367, 0x9b410c1b, 0x640a2b07, 0x68746165, 0x6174732d,
-    0x0a891272, 0x2c082979, 0x69626564, 0x66066e61, 0x726f6465, 0x058d5561,
-    0x646e7523, 0x062b4a6f, 0x6d616c23, 0x07145470, 0x0e266e83, 0x6d726f66,
-    0xd9757461, 0x07733206, 0x65657266, 0x08647362, 0x65746167, 0x646e612d,
-    0x20088409, 0x8509826e, 0x6f6e2212, 0x21088772, 0x1b840774, 0x85726f21,
-    0x88782023, 0x7826081a, 0x6706726f, 0x6f746e65, 0x6c670b6f, 0x2d65626f,
-    0x65646f6d, 0x6168066c, 0x72656d6d, 0x6d6f6809, 0x6f6c2d65, 0x944f6b63,
-    0x55098305, 0x6c2905d0, 0x78756e69, 0x6e696d2d, 0x05fb4274, 0x656c6125,
-    0x840d7472, 0x7571281f, 0x69747365, 0x4f136e6f, 0x642d0a5a, 0x61747369,
-    0x0465636e, 0x6964696d, 0x29048309, 0x726f702d, 0x616e0374, 0xc8461273,
-    0x732d2b06, 0x6e657274, 0x2d687467, 0x12911831, 0x9105ce46, 0x9132202b,
-    0x9732202b, 0x9133202b, 0x9733202b, 0x9134202b, 0x8534202b, 0x9014202b,
-    0x666f239c, 0x14931c66, 0x08576218, 0x685f1c91, 0x700a2a05, 0x2d79616c,
-    0x65657073, 0x1f411864, 0x64652409, 0x4f0b7469, 0x632505ed, 0x656c6379,
-    0x820b8509, 0x86082064, 0x866e2009, 0x6c73241e, 0x4f706565, 0x61220df8,
-    0x24850d75, 0x6174732e, 0x7962646e, 0x62617206, 0x14746962, 0x420b445c,
-    0x1021077c, 0x07a77d73, 0x70752d27, 0x6b6e696c, 0x0669610b, 0x6b822d20,
-    0x6c73092a, 0x776b6361, 0x13657261, 0x42069755, 0x092a0bef, 0x61657473,
-    0x6f622d6d, 0x09820c78, 0x82050d54, 0x06134c34, 0x61657329, 0x09686372,
-    0x45676174, 0xe5640601, 0x05444608, 0x0f890d20, 0xa45b3482, 0x06764407,
-    0x72740b22, 0x66577882, 0x056e7505, 0x69746925, 0x82116e6f, 0x736e2116,
-    0x2d280a84, 0x6b73616d, 0x740c6465, 0x2505c559, 0x65797264, 0x0c840a72,
-    0x91837220, 0x69760d25, 0x4d6f6564, 0x0b20072e, 0x69240d85, 0x6567616d,
-    0x2806214c, 0x62617473, 0x7a696c69, 0x2c578361, 0x6c61770b, 0x63732d6c,
-    0x65636e6f, 0x250b8a10, 0x616c662d, 0x108b1374, 0x24068c47, 0x6669770f,
-    0x0aab4269, 0x0f8e1520, 0x8f062442, 0x6f6c2315, 0x3a8e6b63, 0x3a8e3220,
-    0x2006b742, 0x213a8d14, 0x3a922d32, 0x3a8e3320, 0x8e06c642, 0x9333203a,
-    0x8e34203a, 0x07d5423a, 0x3420758d, 0x1b203a84, 0x6120148d, 0x0bbc6518,
-    0x1b8d1a20, 0xef42a483, 0x8d112007, 0x666f231a, 0x11901966, 0x8e08414c,
-    0x05184319, 0x69700f24, 0x37822d6e, 0x09d74518, 0x1b850f83, 0x68730d24,
-    0x56627261, 0x740d2108, 0x84061852, 0x08b551b0, 0x786f6222, 0x4608f84b,
-    0x97420882, 0x08f14b05, 0x6f646131, 0x610b6562, 0x656c676e, 0x7563612d,
-    0x850c6574, 0x626f240b, 0x87737574, 0x69722618, 0x0e746867, 0x07b86f61,
-    0x6c702d25, 0x4d167961, 0x73240557, 0x74696c70, 0x580a7b76, 0x16850604,
-    0x25079b4d, 0x6475610b, 0x0c4c6f69, 0x49142005, 0x3121075f, 0x74461830,
-    0x20148809, 0x20149332, 0x20149333, 0x20149334, 0x20149335, 0x20149336,
-    0x20149337, 0x20149338, 0x20148a39, 0x0cdd5c17, 0x1120bf89, 0xfb6e1787,
-    0x08f75208, 0x71441188, 0x5c198807, 0x4589068d, 0x75620828, 0x69686464,
-    0x6f186d73, 0xad4109e6, 0x470f2005, 0x6525098f, 0x65736172, 0x220f890d,
-    0x4779656b, 0x6c230abc, 0x8a6b636f, 0x666f231c, 0x2a891a66, 0x8a0fbd62,
-    0x6f733355, 0x0c646e75, 0x69726863, 0x61697473, 0x7969746e, 0x4b836305,
-    0x52720b20, 0x06eb570a, 0x14209185, 0x4205eb57, 0x073a0d4c, 0x64726f63,
-    0x0961766f, 0x65797263, 0x6e69676e, 0x75630765, 0x6b616370, 0x434a0a65,
-    0x2d742305, 0x0a886361, 0x4e636421, 0xf84b0946, 0x320f8905, 0x6f707865,
-    0x64097472, 0x2d6b7365, 0x706d616c, 0x8269640b, 0x6c702509, 0x72657961,
-    0x08d16318, 0x63726124, 0x68651468, 0x20878d05, 0x243e8308, 0x746e656e,
-    0x2908870c, 0x786f622d, 0x6c69660d, 0x97632d65, 0x8c152007, 0x0861550d,
-    0x72696628, 0x73616265, 0x104b0d65, 0x20588506, 0x640d8c15, 0xf45d0850,
-    0x6f623010, 0x6f660878, 0x61746e75, 0x670a6e69, 0x82676f6f, 0x69662370,
-    0x6b180c74, 0x15200b00, 0x2d3c0c8b, 0x652d726f, 0x6c617571, 0x72616808,
-    0x61682d64, 0x65681474, 0x68706461, 0x73656e6f, 0x20091842, 0x2114820c,
-    0xb4587472, 0x880c8b07, 0x696827b8, 0x6975646e, 0x894e6d73, 0x696d2405,
-    0x4873756e, 0x702505b7, 0x0d73756c, 0x050c5369, 0x20053b44, 0x850d850c,
-    0x8b1420da, 0x0815440c, 0x6c736929, 0x6a076d61, 0x82616475, 0xfd551852,
-    0x069d4609, 0x186c0921, 0x2007a36b, 0x88098812, 0x05b065c9, 0x4906e857,
-    0x63240516, 0x6b636f6c, 0x08db5318, 0x73250d82, 0x616d0965, 0x05174770,
-    0x09830b20, 0x08205886, 0xb0830b83, 0x08830a20, 0x1220a085, 0x4e580a89,
-    0x616d2208, 0x050c6d74, 0x7365642c, 0x056e6769, 0x6164656d, 0x5218126c,
-    0x2d24082d, 0x616e7964, 0x73290d82, 0x6e6f6d11, 0x726f7469, 0x0804432d,
-    0x11901620, 0x74732d2a, 0x6d0f7261, 0x6573756f, 0x2a097041, 0x66756d06,
-    0x096e6966, 0x41746f6e, 0x1120059f, 0xc6430988, 0x6e0b2307, 0xd34d6d70,
-    0x880b8a08, 0x826f20a4, 0x82632041, 0x69752753, 0x6e69646c, 0xd7830a67,
-    0x0e20f285, 0x2d3a0a89, 0x07786f62, 0x63646f70, 0x0e747361, 0x676f7270,
-    0x73736572, 0x6568632d, 0x0e8a6b63, 0x636f6c24, 0x1d88116b, 0x2007c242,
-    0x5411880f, 0x022a0511, 0x720d6971, 0x726f6365, 0x29432d64, 0x55072005,
-    0x0e2006b9, 0x2508d26b, 0x736f6c63, 0x0e880d65, 0x0c205783, 0xb0820d88,
-    0x65730b27, 0x6f742d74, 0x27968370, 0x6f687306, 0x0b726577, 0x2d250685,
-    0x64616568, 0x077b6411, 0x1808d444, 0x2307b542, 0x746f6f72, 0x13223483,
-    0x42187473, 0x0941089a, 0x84092007, 0x61662313, 0x21556563, 0x656d2f06,
-    0x2d656772, 0x6c6c6563, 0x61741073, 0x73826c62, 0x2508a041, 0x78657404,
-    0x04830a74, 0x78822d20, 0x0c747222, 0x75290a85, 0x63656a62, 0x6f740674,
-    0x282d8269, 0x6f6f7407, 0x786f626c, 0x5507860f, 0x742e08a5, 0x6e72756f,
-    0x6e656d61, 0x77741974, 0x72822d6f, 0x726f7427, 0x7475612d, 0x27128268,
-    0x74616369, 0x0f6e6f69, 0x2c086d7d, 0x736f6c63, 0x75066465, 0x6165726e,
-    0x0622496c, 0x6e696d25, 0x490a7375, 0x7021052e, 0x290a836c, 0x656c6c6f,
-    0x6c616279, 0x85770c6c, 0x702d3205, 0x646e756f, 0x69687707, 0x656c7473,
-    0x00000000, 0x02fa0500, 0x00a21397,
-};
-// clang-format on
-
-} // namespace asap::ui
@@ -0,0 +1,538 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/images/deep_zoom_view.h"
+#include "ui/fonts/material_design_icons.h"
+
+#include <contract/contract.h>
+#include <imgui/misc/cpp/imgui_stdlib.h>
+
+#include <algorithm> // for std::clamp, std::find, std::sort
+#include <cmath>     // for std::floor, std::log2, std::pow
+#include <cstdlib>   // for std::abs
+#include <cstring>   // for memcpy
+#include <utility>   // for std::move
+
+namespace asap::ui {
+
+const char *const DeepZoomView::LOGGER_NAME = "main";
+
+namespace {
+
+constexpr float PATH_INPUT_WIDTH = 300.0F;
+constexpr float PROGRESS_WIDTH = 160.0F;
+constexpr int TILE = TilePyramid::TILE_SIZE;
+/// Tile textures kept on the GPU, 64 MiB.
+constexpr std::size_t CACHE_TILES = 256;
+/// Tiles handed to the worker per frame, at most.
+constexpr std::size_t MAX_REQUESTS = 64;
+/// How far ahead of the panning tiles are loaded.
+constexpr int PREFETCH_TILES = 2;
+/// Slower panning, in tiles per frame, does not prefetch.
+constexpr float MIN_PREFETCH_VELOCITY = 1.0F / 64.0F;
+/// Weight of the previous frames in the panning speed.
+constexpr float VELOCITY_SMOOTHING = 0.75F;
+/// Zoom factor of a mouse wheel notch.
+constexpr float WHEEL_ZOOM_STEP = 1.25F;
+constexpr float MAX_SCALE = 32.0F;
+constexpr float PERCENT = 100.0F;
+
+constexpr unsigned LEVEL_SHIFT = 56;
+constexpr unsigned Y_SHIFT = 28;
+constexpr std::uint64_t COORDINATE_MASK = (std::uint64_t{1} << Y_SHIFT) - 1;
+
+auto MakeKey(int level, int x, int y) -> std::uint64_t {
+  return (static_cast<std::uint64_t>(level) << LEVEL_SHIFT) |
+         (static_cast<std::uint64_t>(y) << Y_SHIFT) |
+         static_cast<std::uint64_t>(x);
+}
+
+auto KeyLevel(std::uint64_t key) -> int {
+  return static_cast<int>(key >> LEVEL_SHIFT);
+}
+
+auto KeyX(std::uint64_t key) -> int {
+  return static_cast<int>(key & COORDINATE_MASK);
+}
+
+auto KeyY(std::uint64_t key) -> int {
+  return static_cast<int>((key >> Y_SHIFT) & COORDINATE_MASK);
+}
+
+/// The tiles of a level covering a rectangle of the full size image.
+struct TileRange {
+  int first_x;
+  int first_y;
+  int last_x;
+  int last_y;
+};
+
+auto CoveringTiles(const TilePyramid &pyramid, int level,
+    const ImVec2 &view_min, const ImVec2 &view_max) -> TileRange {
+  const auto ratio_x = static_cast<float>(pyramid.Width()) /
+                       static_cast<float>(pyramid.LevelWidth(level));
+  const auto ratio_y = static_cast<float>(pyramid.Height()) /
+                       static_cast<float>(pyramid.LevelHeight(level));
+  const auto tile = [](float position, float ratio) {
+    return static_cast<int>(std::floor(position / ratio / TILE));
+  };
+  return {std::max(0, tile(view_min.x, ratio_x)),
+      std::max(0, tile(view_min.y, ratio_y)),
+      std::min(pyramid.TilesX(level) - 1, tile(view_max.x, ratio_x)),
+      std::min(pyramid.TilesY(level) - 1, tile(view_max.y, ratio_y))};
+}
+
+} // namespace
+
+DeepZoomView::~DeepZoomView() {
+  Close();
+}
+
+void DeepZoomView::Open(const std::filesystem::path &path) {
+  path_input_ = path.string();
+  if (conversion_.joinable()) {
+    ASLOG(warn, "can't open {} while an image is being converted",
+        path.string());
+    return;
+  }
+  if (TilePyramid::IsTileFile(path)) {
+    OpenTiles(path);
+    return;
+  }
+
+  // Convert the image once, next to it, and use the tile file from then on
+  auto target = path;
+  target += ".tiles";
+  std::error_code error;
+  if (TilePyramid::IsTileFile(target) &&
+      std::filesystem::last_write_time(target, error) >=
+          std::filesystem::last_write_time(path, error)) {
+    OpenTiles(target);
+    return;
+  }
+  Close();
+  ASLOG(info, "converting {} to tile file {}", path.string(), target.string());
+  conversion_target_ = target;
+  conversion_progress_.store(0, std::memory_order_relaxed);
+  cancel_conversion_.store(false, std::memory_order_relaxed);
+  converted_.store(false, std::memory_order_relaxed);
+  converting_.store(true, std::memory_order_release);
+  conversion_ = std::thread([this, path, target]() {
+    converted_.store(TilePyramidWriter::ConvertImage(path, target,
+                         &conversion_progress_, &cancel_conversion_),
+        std::memory_order_relaxed);
+    converting_.store(false, std::memory_order_release);
+  });
+}
+
+void DeepZoomView::OpenTiles(const std::filesystem::path &path) {
+  Close();
+  if (!pyramid_.Open(path)) {
+    return;
+  }
+  path_ = path;
+  StartWorker();
+}
+
+void DeepZoomView::Close() {
+  if (conversion_.joinable()) {
+    // Stops after the band or the row of tiles being written; decoding the
+    // image can't be interrupted
+    cancel_conversion_.store(true, std::memory_order_relaxed);
+    conversion_.join();
+  }
+  StopWorker();
+  auto &textures = TextureManager::Default();
+  for (auto &slot : slots_) {
+    textures.Release(slot.texture);
+  }
+  slots_.clear();
+  resident_.clear();
+  pyramid_.Close();
+  path_.clear();
+  scale_ = 0;
+  velocity_ = {0, 0};
+}
+
+void DeepZoomView::PollConversion() {
+  if (!conversion_.joinable() ||
+      converting_.load(std::memory_order_acquire)) {
+    return;
+  }
+  conversion_.join();
+  if (converted_.load(std::memory_order_relaxed)) {
+    OpenTiles(conversion_target_);
+  }
+}
+
+void DeepZoomView::StartWorker() {
+  ASAP_ASSERT(!worker_.joinable());
+  stop_ = false;
+  requests_.clear();
+  loaded_.clear();
+  worker_ = std::thread([this]() { Run(); });
+}
+
+void DeepZoomView::StopWorker() {
+  if (!worker_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  worker_.join();
+  requests_.clear();
+  loaded_.clear();
+}
+
+void DeepZoomView::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this]() { return stop_ || !requests_.empty(); });
+    if (stop_) {
+      break;
+    }
+    const auto key = requests_.front();
+    requests_.erase(requests_.begin());
+    lock.unlock();
+
+    // Reading the mapping faults the pages in, here rather than on the UI
+    // thread
+    LoadedTile tile{key, std::vector<std::uint32_t>(TilePyramid::TILE_PIXELS)};
+    std::memcpy(tile.pixels.data(),
+        pyramid_.Tile(KeyLevel(key), KeyX(key), KeyY(key)),
+        TilePyramid::TILE_BYTES);
+
+    lock.lock();
+    loaded_.push_back(std::move(tile));
+  }
+}
+
+void DeepZoomView::CollectTiles() {
+  std::vector<LoadedTile> loaded;
+  {
+    // Never wait for the worker
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return;
+    }
+    loaded.swap(loaded_);
+  }
+
+  auto &textures = TextureManager::Default();
+  const auto frame = ImGui::GetFrameCount();
+  for (auto &tile : loaded) {
+    // Loaded twice, when requested again while it was loading
+    if (resident_.count(tile.key) != 0) {
+      continue;
+    }
+    auto index = slots_.size();
+    if (slots_.size() < CACHE_TILES) {
+      slots_.emplace_back();
+      slots_.back().texture = textures.Create(TILE, TILE);
+    } else {
+      // The least recently used tile not drawn in this frame
+      for (std::size_t slot = 0; slot < slots_.size(); ++slot) {
+        if (slots_[slot].last_used_frame < frame &&
+            (index == slots_.size() || slots_[slot].last_used_frame <
+                                           slots_[index].last_used_frame)) {
+          index = slot;
+        }
+      }
+      if (index == slots_.size()) {
+        continue;
+      }
+    }
+    auto &slot = slots_[index];
+    if (slot.used) {
+      resident_.erase(slot.key);
+    }
+    slot.key = tile.key;
+    slot.used = true;
+    slot.last_used_frame = frame;
+    textures.Upload(slot.texture, 0, 0, 0, TILE, TILE, std::move(tile.pixels));
+    resident_[tile.key] = index;
+  }
+}
+
+auto DeepZoomView::UseTile(TileKey key) -> ImTextureID {
+  const auto found = resident_.find(key);
+  if (found == resident_.end()) {
+    return nullptr;
+  }
+  auto &slot = slots_[found->second];
+  auto &textures = TextureManager::Default();
+  // Evicted by the texture manager, over its budget
+  if (textures.GetState(slot.texture) == TextureManager::State::EVICTED) {
+    slot.used = false;
+    resident_.erase(found);
+    return nullptr;
+  }
+  slot.last_used_frame = ImGui::GetFrameCount();
+  return textures.Use(slot.texture);
+}
+
+void DeepZoomView::RequestTiles(
+    int level, const ImVec2 &view_min, const ImVec2 &view_max) {
+  std::vector<TileKey> requests;
+  const auto frame = ImGui::GetFrameCount();
+  const auto want = [this, &requests, frame](int tile_level, int x, int y) {
+    if (x < 0 || y < 0 || x >= pyramid_.TilesX(tile_level) ||
+        y >= pyramid_.TilesY(tile_level) || requests.size() >= MAX_REQUESTS) {
+      return;
+    }
+    const auto key = MakeKey(tile_level, x, y);
+    const auto found = resident_.find(key);
+    if (found != resident_.end()) {
+      // Keep it around, it is about to be drawn
+      slots_[found->second].last_used_frame = frame;
+      return;
+    }
+    if (std::find(requests.begin(), requests.end(), key) == requests.end()) {
+      requests.push_back(key);
+    }
+  };
+
+  // The whole image in a tile, drawn until better tiles are there
+  want(pyramid_.Levels() - 1, 0, 0);
+
+  // The visible tiles, from the center out
+  const auto range = CoveringTiles(pyramid_, level, view_min, view_max);
+  std::vector<std::pair<int, TileKey>> visible;
+  const auto center_x = range.first_x + range.last_x;
+  const auto center_y = range.first_y + range.last_y;
+  for (int y = range.first_y; y <= range.last_y; ++y) {
+    for (int x = range.first_x; x <= range.last_x; ++x) {
+      const auto distance = std::abs(2 * x - center_x) +
+                            std::abs(2 * y - center_y);
+      visible.emplace_back(distance, MakeKey(level, x, y));
+    }
+  }
+  std::sort(visible.begin(), visible.end());
+  for (const auto &tile : visible) {
+    want(level, KeyX(tile.second), KeyY(tile.second));
+  }
+
+  // The tiles coming into view next, in the direction of the panning
+  const auto tile_velocity_x =
+      velocity_.x / static_cast<float>(TILE << level);
+  const auto tile_velocity_y =
+      velocity_.y / static_cast<float>(TILE << level);
+  auto ahead = range;
+  if (tile_velocity_x > MIN_PREFETCH_VELOCITY) {
+    ahead.last_x += PREFETCH_TILES;
+  } else if (tile_velocity_x < -MIN_PREFETCH_VELOCITY) {
+    ahead.first_x -= PREFETCH_TILES;
+  }
+  if (tile_velocity_y > MIN_PREFETCH_VELOCITY) {
+    ahead.last_y += PREFETCH_TILES;
+  } else if (tile_velocity_y < -MIN_PREFETCH_VELOCITY) {
+    ahead.first_y -= PREFETCH_TILES;
+  }
+  for (int y = ahead.first_y; y <= ahead.last_y; ++y) {
+    for (int x = ahead.first_x; x <= ahead.last_x; ++x) {
+      want(level, x, y);
+    }
+  }
+
+  // The coarser level, to zoom out without holes
+  if (level + 1 < pyramid_.Levels()) {
+    const auto parent =
+        CoveringTiles(pyramid_, level + 1, view_min, view_max);
+    for (int y = parent.first_y; y <= parent.last_y; ++y) {
+      for (int x = parent.first_x; x <= parent.last_x; ++x) {
+        want(level + 1, x, y);
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_ = std::move(requests);
+  }
+  wake_.notify_one();
+}
+
+void DeepZoomView::Draw(const char *title, bool *open) {
+  ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
+
+  // This is the case when the view is supposed to open in its own ImGui
+  // window (not docked).
+  if (open != nullptr) {
+    ASAP_ASSERT(title != nullptr);
+    ImGui::Begin(title, open);
+  }
+
+  PollConversion();
+  DrawToolbar();
+  ImGui::Separator();
+
+  if (conversion_.joinable()) {
+    ImGui::TextDisabled("Converting to a tile file...");
+  } else if (!pyramid_.IsOpen()) {
+    ImGui::TextDisabled("No image opened");
+  } else {
+    CollectTiles();
+    DrawTiles();
+  }
+
+  // The case of the view in its own ImGui window (not docked)
+  if (open != nullptr) {
+    ImGui::End();
+  }
+}
+
+void DeepZoomView::DrawToolbar() {
+  ImGui::SetNextItemWidth(PATH_INPUT_WIDTH);
+  auto open_file = ImGui::InputText(
+      "##path", &path_input_, ImGuiInputTextFlags_EnterReturnsTrue);
+  ImGui::SameLine();
+  open_file |= ImGui::Button(ICON_MDI_FOLDER_OPEN " Open");
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("Open a tile file, or convert an image to one");
+  }
+  if (open_file && !path_input_.empty()) {
+    Open(path_input_);
+  }
+
+  if (conversion_.joinable()) {
+    ImGui::SameLine();
+    ImGui::ProgressBar(conversion_progress_.load(std::memory_order_relaxed),
+        ImVec2(PROGRESS_WIDTH, 0));
+    ImGui::SameLine();
+    if (ImGui::SmallButton(ICON_MDI_CANCEL " Cancel")) {
+      Close();
+    }
+    return;
+  }
+  if (!pyramid_.IsOpen()) {
+    return;
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton(ICON_MDI_ARROW_EXPAND_ALL)) {
+    scale_ = 0;
+  }
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("Fit the image in the panel");
+  }
+  ImGui::SameLine();
+  ImGui::Text(
+      "%dx%d, %.1f%%, level %d/%d, %zu tiles (%zu missing), %zu cached",
+      pyramid_.Width(), pyramid_.Height(),
+      static_cast<double>(scale_ * PERCENT), level_, pyramid_.Levels() - 1,
+      tiles_drawn_, tiles_missing_, resident_.size());
+}
+
+void DeepZoomView::DrawTiles() {
+  const auto region = ImGui::GetContentRegionAvail();
+  if (region.x < 1 || region.y < 1) {
+    return;
+  }
+  const auto origin = ImGui::GetCursorScreenPos();
+  ImGui::InvisibleButton("tiles", region);
+  const auto hovered = ImGui::IsItemHovered();
+  const auto dragged = ImGui::IsItemActive() && ImGui::IsMouseDragging(0);
+
+  const auto width = static_cast<float>(pyramid_.Width());
+  const auto height = static_cast<float>(pyramid_.Height());
+  const auto fit = std::min(region.x / width, region.y / height);
+  if (scale_ <= 0) {
+    scale_ = fit;
+    center_ = {width / 2, height / 2};
+  }
+  const ImVec2 middle{origin.x + region.x / 2, origin.y + region.y / 2};
+  const auto previous = center_;
+
+  // Drag to pan, and zoom around the cursor
+  const auto &io = ImGui::GetIO();
+  if (dragged) {
+    center_.x -= io.MouseDelta.x / scale_;
+    center_.y -= io.MouseDelta.y / scale_;
+  }
+  if (hovered && io.MouseWheel != 0) {
+    const ImVec2 offset{io.MousePos.x - middle.x, io.MousePos.y - middle.y};
+    const ImVec2 anchor{
+        center_.x + offset.x / scale_, center_.y + offset.y / scale_};
+    scale_ = std::clamp(scale_ * std::pow(WHEEL_ZOOM_STEP, io.MouseWheel),
+        std::min(fit / 2, 1.0F), MAX_SCALE);
+    center_ = {anchor.x - offset.x / scale_, anchor.y - offset.y / scale_};
+  }
+  center_ = {std::clamp(center_.x, 0.0F, width),
+      std::clamp(center_.y, 0.0F, height)};
+  velocity_ = {VELOCITY_SMOOTHING * velocity_.x +
+                   (1 - VELOCITY_SMOOTHING) * (center_.x - previous.x),
+      VELOCITY_SMOOTHING * velocity_.y +
+          (1 - VELOCITY_SMOOTHING) * (center_.y - previous.y)};
+
+  // The level with about one texel per screen pixel, or finer
+  level_ = std::clamp(static_cast<int>(std::floor(std::log2(1 / scale_))), 0,
+      pyramid_.Levels() - 1);
+  const ImVec2 view_min{center_.x - region.x / 2 / scale_,
+      center_.y - region.y / 2 / scale_};
+  const ImVec2 view_max{center_.x + region.x / 2 / scale_,
+      center_.y + region.y / 2 / scale_};
+  RequestTiles(level_, view_min, view_max);
+
+  const auto ratio_x =
+      width / static_cast<float>(pyramid_.LevelWidth(level_));
+  const auto ratio_y =
+      height / static_cast<float>(pyramid_.LevelHeight(level_));
+  const auto to_screen = [this, &middle, ratio_x, ratio_y](int x, int y) {
+    return ImVec2(middle.x + (static_cast<float>(x) * ratio_x - center_.x) *
+                                 scale_,
+        middle.y + (static_cast<float>(y) * ratio_y - center_.y) * scale_);
+  };
+
+  auto *draw_list = ImGui::GetWindowDrawList();
+  draw_list->PushClipRect(
+      origin, ImVec2(origin.x + region.x, origin.y + region.y), true);
+  tiles_drawn_ = 0;
+  tiles_missing_ = 0;
+  const auto range = CoveringTiles(pyramid_, level_, view_min, view_max);
+  for (int y = range.first_y; y <= range.last_y; ++y) {
+    for (int x = range.first_x; x <= range.last_x; ++x) {
+      // Only the part of the edge tiles inside the image
+      const auto tile_width =
+          std::min(TILE, pyramid_.LevelWidth(level_) - x * TILE);
+      const auto tile_height =
+          std::min(TILE, pyramid_.LevelHeight(level_) - y * TILE);
+      const auto screen_min = to_screen(x * TILE, y * TILE);
+      const auto screen_max =
+          to_screen(x * TILE + tile_width, y * TILE + tile_height);
+      const ImVec2 uv_size{static_cast<float>(tile_width) / TILE,
+          static_cast<float>(tile_height) / TILE};
+      ++tiles_drawn_;
+
+      auto texture = UseTile(MakeKey(level_, x, y));
+      if (texture != nullptr) {
+        draw_list->AddImage(texture, screen_min, screen_max, ImVec2(0, 0),
+            uv_size);
+        continue;
+      }
+      // Stretch the part of the nearest coarser tile on the GPU
+      ++tiles_missing_;
+      for (int up = 1; level_ + up < pyramid_.Levels(); ++up) {
+        texture = UseTile(MakeKey(level_ + up, x >> up, y >> up));
+        if (texture == nullptr) {
+          continue;
+        }
+        const auto span = 1.0F / static_cast<float>(1 << up);
+        const ImVec2 uv_min{
+            static_cast<float>(x - ((x >> up) << up)) * span,
+            static_cast<float>(y - ((y >> up) << up)) * span};
+        draw_list->AddImage(texture, screen_min, screen_max, uv_min,
+            ImVec2(uv_min.x + uv_size.x * span, uv_min.y + uv_size.y * span));
+        break;
+      }
+    }
+  }
+  draw_list->PopClipRect();
+}
+
+} // namespace asap::ui
@@ -0,0 +1,137 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "ui/images/tile_pyramid.h"
+#include "ui/textures/texture_manager.h"
+
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Panel for panning and zooming through images too large for a single
+ * texture, or for the memory, such as gigapixel scans and maps.
+ *
+ * The image is read from a TilePyramid. Only the tiles covering the panel, at
+ * the mip level matching the zoom, are streamed to the GPU, so that the cost
+ * of a frame depends on the size of the panel and not on the size of the
+ * image. The tiles are copied out of the file mapping by a worker thread,
+ * which takes the page faults, and uploaded through the TextureManager into a
+ * fixed set of tile textures reused in least recently used order. While a
+ * tile is on its way, the nearest coarser tile already on the GPU is drawn in
+ * its place.
+ *
+ * The worker is handed, every frame, the tiles to load in order: the visible
+ * ones from the center out, then the ones just ahead in the direction of the
+ * panning, then the coarser level for zooming out. Images which are not tile
+ * files yet are converted, next to the image, in the background.
+ *
+ * Drag to pan, and use the mouse wheel to zoom around the cursor. The tile
+ * textures must be released, by destroying the view, while the OpenGL context
+ * is still alive.
+ */
+class DeepZoomView : public asap::logging::Loggable<DeepZoomView> {
+public:
+  DeepZoomView() = default;
+
+  DeepZoomView(const DeepZoomView &) = delete;
+  DeepZoomView(DeepZoomView &&) = delete;
+  auto operator=(const DeepZoomView &) -> DeepZoomView & = delete;
+  auto operator=(DeepZoomView &&) -> DeepZoomView & = delete;
+
+  ~DeepZoomView();
+
+  /// Show a tile file, or convert an image file to a tile file and show it.
+  void Open(const std::filesystem::path &path);
+  /// Close the image, cancelling its conversion if it is running.
+  void Close();
+
+  void Draw(const char *title = nullptr, bool *open = nullptr);
+
+  static const char *const LOGGER_NAME;
+
+private:
+  /// A tile of a given level, packed in an integer.
+  using TileKey = std::uint64_t;
+
+  /// A tile texture, holding one tile at a time.
+  struct Slot {
+    TextureManager::Handle texture;
+    TileKey key{0};
+    bool used{false};
+    int last_used_frame{-1};
+  };
+
+  /// A tile copied out of the mapping by the worker.
+  struct LoadedTile {
+    TileKey key;
+    std::vector<std::uint32_t> pixels;
+  };
+
+  void OpenTiles(const std::filesystem::path &path);
+  void StartWorker();
+  void StopWorker();
+  void Run();
+  /// Check on a conversion running in the background.
+  void PollConversion();
+  void CollectTiles();
+  /// Hand the tiles to load for this frame to the worker.
+  void RequestTiles(int level, const ImVec2 &view_min, const ImVec2 &view_max);
+  /// The texture to draw a tile with, or nullptr when it is not on the GPU.
+  auto UseTile(TileKey key) -> ImTextureID;
+
+  void DrawToolbar();
+  void DrawTiles();
+
+  TilePyramid pyramid_;
+  std::filesystem::path path_;
+  std::string path_input_;
+
+  /// Center of the view, in pixels of the full size image.
+  ImVec2 center_{0, 0};
+  /// Screen pixels per image pixel, 0 to fit the image at the next frame.
+  float scale_{0};
+  /// Panning speed, in image pixels per frame.
+  ImVec2 velocity_{0, 0};
+
+  std::vector<Slot> slots_;
+  /// The slot of each tile on the GPU.
+  std::unordered_map<TileKey, std::size_t> resident_;
+  int level_{0};
+  std::size_t tiles_drawn_{0};
+  std::size_t tiles_missing_{0};
+
+  std::thread worker_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_{false};
+  /// Tiles to load, the first first; replaced every frame.
+  std::vector<TileKey> requests_;
+  std::vector<LoadedTile> loaded_;
+
+  std::thread conversion_;
+  std::atomic<bool> converting_{false};
+  std::atomic<bool> converted_{false};
+  std::atomic<float> conversion_progress_{0};
+  std::atomic<bool> cancel_conversion_{false};
+  std::filesystem::path conversion_target_;
+};
+
+} // namespace asap::ui
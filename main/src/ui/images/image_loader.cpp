@@ -0,0 +1,174 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/images/image_loader.h"
+#include "ui/images/mipmap.h"
+
+#include <algorithm> // for std::find_if
+#include <cstring>   // for memcpy
+#include <fstream>
+#include <limits>
+#include <utility> // for std::move
+
+// The decoders only, the image viewer has no use for HDR or PSD files
+#define STBI_NO_HDR
+#define STBI_NO_PSD
+#define STBI_NO_PIC
+#define STBI_NO_PNM
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+namespace asap::ui {
+
+const char *const ImageLoader::LOGGER_NAME = "main";
+
+namespace {
+
+constexpr int RGBA = 4;
+
+auto Seconds(ImageLoader::Clock::time_point start) -> double {
+  return std::chrono::duration<double>(ImageLoader::Clock::now() - start)
+      .count();
+}
+
+auto ReadFile(const std::filesystem::path &path,
+    std::vector<unsigned char> &contents) -> bool {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const auto size = static_cast<std::streamoff>(file.tellg());
+  if (size < 0 || size > std::numeric_limits<int>::max()) {
+    return false;
+  }
+  contents.resize(static_cast<std::size_t>(size));
+  file.seekg(0);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return static_cast<bool>(file.read(reinterpret_cast<char *>(contents.data()),
+      static_cast<std::streamsize>(size)));
+}
+
+} // namespace
+
+auto ImageLoader::DefaultWorkers() -> unsigned {
+  return std::max(1U, std::thread::hardware_concurrency() / 2);
+}
+
+ImageLoader::ImageLoader(unsigned workers) {
+  workers_.reserve(std::max(1U, workers));
+  for (unsigned worker = 0; worker < std::max(1U, workers); ++worker) {
+    workers_.emplace_back([this]() { Run(); });
+  }
+}
+
+ImageLoader::~ImageLoader() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+    queue_.clear();
+  }
+  wake_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+auto ImageLoader::Load(std::filesystem::path path) -> std::uint64_t {
+  std::uint64_t id = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    id = next_id_++;
+    queue_.push_back(Request{id, std::move(path), Clock::now()});
+  }
+  wake_.notify_one();
+  return id;
+}
+
+void ImageLoader::Cancel(std::uint64_t id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto queued = std::find_if(queue_.begin(), queue_.end(),
+      [id](const Request &request) { return request.id == id; });
+  if (queued != queue_.end()) {
+    queue_.erase(queued);
+  }
+}
+
+auto ImageLoader::Collect() -> std::vector<Image> {
+  std::vector<Image> images;
+  // Never wait for a worker, the UI thread calls this every frame
+  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+  if (lock.owns_lock()) {
+    images.swap(done_);
+  }
+  return images;
+}
+
+auto ImageLoader::Pending() const -> std::size_t {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size() + decoding_;
+}
+
+void ImageLoader::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+    if (stop_) {
+      break;
+    }
+    auto request = std::move(queue_.front());
+    queue_.pop_front();
+    ++decoding_;
+    lock.unlock();
+
+    Image image;
+    image.id = request.id;
+    image.path = std::move(request.path);
+    image.requested = request.requested;
+    Decode(image);
+
+    lock.lock();
+    --decoding_;
+    done_.push_back(std::move(image));
+  }
+}
+
+void ImageLoader::Decode(Image &image) {
+  const auto start = Clock::now();
+  std::vector<unsigned char> contents;
+  if (!ReadFile(image.path, contents)) {
+    image.error = "can't read the file";
+    ASLOG(error, "image '{}': {}", image.path.string(), image.error);
+    return;
+  }
+  int width = 0;
+  int height = 0;
+  int channels = 0;
+  auto *pixels = stbi_load_from_memory(contents.data(),
+      static_cast<int>(contents.size()), &width, &height, &channels, RGBA);
+  if (pixels == nullptr) {
+    image.error = stbi_failure_reason();
+    ASLOG(error, "image '{}': {}", image.path.string(), image.error);
+    return;
+  }
+  // The RGBA bytes, read as they are laid out in memory by GL
+  std::vector<std::uint32_t> level0(
+      static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+  std::memcpy(level0.data(), pixels, level0.size() * sizeof(std::uint32_t));
+  stbi_image_free(pixels);
+  image.decode_seconds = Seconds(start);
+
+  const auto mipmap_start = Clock::now();
+  image.width = width;
+  image.height = height;
+  image.levels = BuildMipChain(std::move(level0), width, height);
+  image.mipmap_seconds = Seconds(mipmap_start);
+  ASLOG(debug, "image '{}' decoded: {}x{} in {:.1f} ms, mipmaps in {:.1f} ms",
+      image.path.string(), width, height, image.decode_seconds * 1000.0,
+      image.mipmap_seconds * 1000.0);
+}
+
+} // namespace asap::ui
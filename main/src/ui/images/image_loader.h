@@ -0,0 +1,104 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <logging/logging.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Decodes image files on a pool of worker threads.
+ *
+ * The files are read and decoded to RGBA (PNG, JPEG, BMP, TGA, ... as
+ * supported by stb_image), and their mip levels built, on the workers. The UI
+ * thread queues files with Load() and picks the decoded images up with
+ * Collect(), once per frame, without ever waiting for a worker.
+ *
+ * No GL call is made by the loader, the images are uploaded by the caller.
+ */
+class ImageLoader : public asap::logging::Loggable<ImageLoader> {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Image {
+    /// As returned by Load().
+    std::uint64_t id{0};
+    std::filesystem::path path;
+    int width{0};
+    int height{0};
+    /// RGBA pixels of the mip levels, the full size first. Empty when the file
+    /// could not be decoded.
+    std::vector<std::vector<std::uint32_t>> levels;
+    /// Why the file could not be decoded.
+    std::string error;
+    /// When Load() was called, to measure the latency up to the display.
+    Clock::time_point requested;
+    double decode_seconds{0};
+    double mipmap_seconds{0};
+  };
+
+  /// Half the hardware threads, the other half is left to the UI and the GL
+  /// driver.
+  static auto DefaultWorkers() -> unsigned;
+
+  explicit ImageLoader(unsigned workers = DefaultWorkers());
+
+  ImageLoader(const ImageLoader &) = delete;
+  ImageLoader(ImageLoader &&) = delete;
+  auto operator=(const ImageLoader &) -> ImageLoader & = delete;
+  auto operator=(ImageLoader &&) -> ImageLoader & = delete;
+
+  /// Drop the queued files, and wait for the ones being decoded.
+  ~ImageLoader();
+
+  /// Queue the decoding of `path`. Return the id of the image.
+  auto Load(std::filesystem::path path) -> std::uint64_t;
+  /// Don't decode the image if it is still queued.
+  void Cancel(std::uint64_t id);
+
+  /// The images decoded since the last call, in no particular order.
+  auto Collect() -> std::vector<Image>;
+
+  /// Images queued or being decoded.
+  [[nodiscard]] auto Pending() const -> std::size_t;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  struct Request {
+    std::uint64_t id;
+    std::filesystem::path path;
+    Clock::time_point requested;
+  };
+
+  void Run();
+  static void Decode(Image &image);
+
+  mutable std::mutex mutex_;
+  std::condition_variable wake_;
+  std::deque<Request> queue_;
+  std::vector<Image> done_;
+  std::size_t decoding_{0};
+  std::uint64_t next_id_{1};
+  bool stop_{false};
+
+  /// Started last, once all the members are initialized.
+  std::vector<std::thread> workers_;
+};
+
+} // namespace asap::ui
@@ -0,0 +1,333 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/images/image_viewer.h"
+#include "ui/fonts/material_design_icons.h"
+
+#include <contract/contract.h>
+#include <glad/gl.h>
+#include <imgui/imgui.h>
+#include <imgui/misc/cpp/imgui_stdlib.h>
+
+#include <algorithm> // for std::clamp, std::find_if, std::remove_if
+#include <cmath>     // for std::pow
+
+namespace asap::ui {
+
+const char *const ImageViewer::LOGGER_NAME = "main";
+
+namespace {
+
+constexpr float PATH_INPUT_WIDTH = 300.0F;
+/// The preview is the first mip level fitting in this size.
+constexpr int PREVIEW_SIZE = 256;
+constexpr float MIN_ZOOM = 1.0F / 64.0F;
+constexpr float MAX_ZOOM = 32.0F;
+/// Zoom factor of a mouse wheel notch.
+constexpr float WHEEL_ZOOM_STEP = 1.25F;
+constexpr float PERCENT = 100.0F;
+
+auto LevelSize(int size, int level) -> int {
+  return std::max(1, size >> level);
+}
+
+auto Seconds(ImageLoader::Clock::time_point start) -> double {
+  return std::chrono::duration<double>(ImageLoader::Clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+ImageViewer::ImageViewer(unsigned decode_workers) : loader_(decode_workers) {
+}
+
+ImageViewer::~ImageViewer() {
+  CloseAll();
+}
+
+void ImageViewer::Open(const std::filesystem::path &path) {
+  Entry entry;
+  entry.id = loader_.Load(path);
+  entry.info.path = path;
+  entry.label = path.filename().string() + "##" + std::to_string(entry.id);
+  entry.opened = ImageLoader::Clock::now();
+  images_.push_back(std::move(entry));
+}
+
+void ImageViewer::Close(Entry &entry) {
+  loader_.Cancel(entry.id);
+  auto &textures = TextureManager::Default();
+  textures.Release(entry.preview);
+  textures.Release(entry.texture);
+  entry.preview = {};
+  entry.texture = {};
+}
+
+void ImageViewer::CloseAll() {
+  for (auto &entry : images_) {
+    Close(entry);
+  }
+  images_.clear();
+}
+
+auto ImageViewer::Images() const -> std::vector<ImageInfo> {
+  std::vector<ImageInfo> infos;
+  infos.reserve(images_.size());
+  for (const auto &entry : images_) {
+    infos.push_back(entry.info);
+  }
+  return infos;
+}
+
+void ImageViewer::CollectDecoded() {
+  auto decoded = loader_.Collect();
+  if (decoded.empty()) {
+    return;
+  }
+  if (max_texture_size_ == 0) {
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size_);
+  }
+
+  auto &textures = TextureManager::Default();
+  for (auto &image : decoded) {
+    const auto found = std::find_if(images_.begin(), images_.end(),
+        [&image](const Entry &entry) { return entry.id == image.id; });
+    // Closed while it was decoded
+    if (found == images_.end()) {
+      continue;
+    }
+    auto &entry = *found;
+    entry.decoded = true;
+    if (image.levels.empty()) {
+      entry.info.error = image.error;
+      continue;
+    }
+    entry.info.width = image.width;
+    entry.info.height = image.height;
+    if (std::max(image.width, image.height) > max_texture_size_) {
+      entry.info.error = fmt::format(
+          "{}x{} is larger than the maximum texture size ({}), open it in "
+          "the deep zoom view instead",
+          image.width, image.height, max_texture_size_);
+      ASLOG(error, "image '{}': {}", image.path.string(), entry.info.error);
+      continue;
+    }
+
+    // The preview is uploaded first, in a single band, and can be drawn
+    // after the next frame
+    const auto levels = static_cast<int>(image.levels.size());
+    int preview_level = 0;
+    while (preview_level + 1 < levels &&
+           std::max(LevelSize(image.width, preview_level),
+               LevelSize(image.height, preview_level)) > PREVIEW_SIZE) {
+      ++preview_level;
+    }
+    if (preview_level > 0) {
+      const auto width = LevelSize(image.width, preview_level);
+      const auto height = LevelSize(image.height, preview_level);
+      entry.preview = textures.Create(width, height);
+      textures.Upload(entry.preview, 0, 0, 0, width, height,
+          image.levels[static_cast<std::size_t>(preview_level)]);
+    }
+
+    // Then the full texture, the small levels first
+    TextureManager::Options options;
+    options.levels = levels;
+    entry.texture = textures.Create(image.width, image.height, options);
+    for (int level = levels - 1; level >= 0; --level) {
+      textures.Upload(entry.texture, level, 0, 0,
+          LevelSize(image.width, level), LevelSize(image.height, level),
+          std::move(image.levels[static_cast<std::size_t>(level)]));
+    }
+  }
+}
+
+void ImageViewer::UpdateProgress() {
+  auto &textures = TextureManager::Default();
+  for (auto &entry : images_) {
+    if (!entry.decoded) {
+      continue;
+    }
+    const auto ready =
+        textures.GetState(entry.texture) == TextureManager::State::READY;
+    if (entry.info.visible_seconds < 0 &&
+        (ready ||
+            textures.GetState(entry.preview) ==
+                TextureManager::State::READY)) {
+      entry.info.visible_seconds = Seconds(entry.opened);
+    }
+    if (!ready) {
+      continue;
+    }
+    // Only measured the first time, not after an image is decoded again
+    if (entry.info.complete_seconds < 0) {
+      entry.info.complete_seconds = Seconds(entry.opened);
+      ASLOG(debug, "image '{}' visible after {:.1f} ms, complete after {:.1f} "
+                   "ms",
+          entry.info.path.string(), entry.info.visible_seconds * 1000.0,
+          entry.info.complete_seconds * 1000.0);
+    }
+    if (entry.preview) {
+      textures.Release(entry.preview);
+      entry.preview = {};
+    }
+  }
+}
+
+void ImageViewer::Draw(const char *title, bool *open) {
+  ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
+
+  // This is the case when the viewer is supposed to open in its own ImGui
+  // window (not docked).
+  if (open != nullptr) {
+    ASAP_ASSERT(title != nullptr);
+    ImGui::Begin(title, open);
+  }
+
+  CollectDecoded();
+  UpdateProgress();
+
+  DrawToolbar();
+  ImGui::Separator();
+
+  if (images_.empty()) {
+    ImGui::TextDisabled("No image opened");
+  } else if (ImGui::BeginTabBar("images",
+                 ImGuiTabBarFlags_AutoSelectNewTabs |
+                     ImGuiTabBarFlags_FittingPolicyScroll)) {
+    for (auto &entry : images_) {
+      bool keep = true;
+      if (ImGui::BeginTabItem(entry.label.c_str(), &keep)) {
+        DrawImage(entry);
+        ImGui::EndTabItem();
+      }
+      if (!keep) {
+        Close(entry);
+        entry.closed = true;
+      }
+    }
+    ImGui::EndTabBar();
+    images_.erase(std::remove_if(images_.begin(), images_.end(),
+                      [](const Entry &entry) { return entry.closed; }),
+        images_.end());
+  }
+
+  // The case of the viewer in its own ImGui window (not docked)
+  if (open != nullptr) {
+    ImGui::End();
+  }
+}
+
+void ImageViewer::DrawToolbar() {
+  ImGui::SetNextItemWidth(PATH_INPUT_WIDTH);
+  auto open_file = ImGui::InputText(
+      "##path", &path_input_, ImGuiInputTextFlags_EnterReturnsTrue);
+  ImGui::SameLine();
+  open_file |= ImGui::Button(ICON_MDI_FOLDER_OPEN " Open");
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("Open the image file");
+  }
+  if (open_file && !path_input_.empty()) {
+    Open(path_input_);
+  }
+  if (!images_.empty()) {
+    ImGui::SameLine();
+    if (ImGui::Button("Close All")) {
+      CloseAll();
+    }
+  }
+  const auto pending = loader_.Pending();
+  if (pending != 0) {
+    ImGui::SameLine();
+    ImGui::Text("%zu decoding...", pending);
+  }
+}
+
+void ImageViewer::DrawImage(Entry &entry) {
+  if (!entry.info.error.empty()) {
+    ImGui::TextDisabled(
+        ICON_MDI_IMAGE_BROKEN " %s", entry.info.error.c_str());
+    return;
+  }
+  if (!entry.decoded) {
+    ImGui::TextDisabled("Decoding...");
+    return;
+  }
+
+  auto &textures = TextureManager::Default();
+  // Evicted while the tab was not shown, the pixels are not kept around. The
+  // texture manager only evicts textures whose upload is done, so this is
+  // the texture having been idle, not a lost upload.
+  if (textures.GetState(entry.texture) == TextureManager::State::EVICTED) {
+    Close(entry);
+    entry.id = loader_.Load(entry.info.path);
+    entry.decoded = false;
+    ImGui::TextDisabled("Decoding...");
+    return;
+  }
+
+  const auto width = static_cast<float>(entry.info.width);
+  const auto height = static_cast<float>(entry.info.height);
+  const auto line_height = ImGui::GetFrameHeightWithSpacing();
+  const auto region = ImGui::GetContentRegionAvail();
+  const auto fit = std::min(
+      region.x / width, std::max(region.y - line_height, 1.0F) / height);
+  const auto scale = entry.zoom > 0 ? entry.zoom : fit;
+
+  // Zoom controls, and what is shown
+  if (ImGui::SmallButton(ICON_MDI_MAGNIFY_MINUS)) {
+    entry.zoom = std::max(scale / 2, MIN_ZOOM);
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton(ICON_MDI_MAGNIFY_PLUS)) {
+    entry.zoom = std::min(scale * 2, MAX_ZOOM);
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton(ICON_MDI_NUMERIC_1_BOX_OUTLINE)) {
+    entry.zoom = 1;
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton(ICON_MDI_ARROW_EXPAND_ALL)) {
+    entry.zoom = 0;
+  }
+  ImGui::SameLine();
+  ImGui::Text("%dx%d, %.0f%%%s", entry.info.width, entry.info.height,
+      static_cast<double>(scale * PERCENT),
+      textures.GetState(entry.texture) == TextureManager::State::UPLOADING
+          ? ", uploading..."
+          : "");
+
+  ImGui::BeginChild("image", ImVec2(0, 0), false,
+      ImGuiWindowFlags_HorizontalScrollbar |
+          (entry.zoom > 0 ? ImGuiWindowFlags_None
+                          : ImGuiWindowFlags_NoScrollbar));
+  const ImVec2 size{width * scale, height * scale};
+  // Centered when smaller than the panel
+  const auto available = ImGui::GetContentRegionAvail();
+  const auto cursor = ImGui::GetCursorPos();
+  ImGui::SetCursorPos(
+      ImVec2(cursor.x + std::max(0.0F, (available.x - size.x) / 2),
+          cursor.y + std::max(0.0F, (available.y - size.y) / 2)));
+  auto texture = textures.Use(entry.texture);
+  if (texture == nullptr) {
+    texture = textures.Use(entry.preview);
+  }
+  if (texture != nullptr) {
+    ImGui::Image(texture, size);
+  } else {
+    ImGui::Dummy(size);
+  }
+
+  const auto &io = ImGui::GetIO();
+  if (ImGui::IsWindowHovered() && io.KeyCtrl && io.MouseWheel != 0) {
+    entry.zoom = std::clamp(scale * std::pow(WHEEL_ZOOM_STEP, io.MouseWheel),
+        MIN_ZOOM, MAX_ZOOM);
+  }
+  ImGui::EndChild();
+}
+
+} // namespace asap::ui
@@ -0,0 +1,103 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include "ui/images/image_loader.h"
+#include "ui/textures/texture_manager.h"
+
+#include <logging/logging.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Panel showing image files (screenshots, camera frames, ...), one tab
+ * per image.
+ *
+ * The files are decoded and their mipmaps built on the workers of an
+ * ImageLoader. The decoded images are uploaded through the TextureManager, a
+ * bounded amount per frame, so that opening large images never stalls the UI:
+ * a small preview level is uploaded first and shown after a frame, and
+ * replaced by the full texture once all its levels are uploaded.
+ *
+ * Images are fitted to the panel, or zoomed with CTRL + mouse wheel and the
+ * toolbar buttons. The textures must be released, by destroying the viewer,
+ * while the OpenGL context is still alive.
+ */
+class ImageViewer : public asap::logging::Loggable<ImageViewer> {
+public:
+  /// Progress of an image, from Open() to the display of its full texture.
+  struct ImageInfo {
+    std::filesystem::path path;
+    int width{0};
+    int height{0};
+    std::string error;
+    /// Seconds from Open() until a preview can be drawn, negative before.
+    double visible_seconds{-1};
+    /// Seconds from Open() until the full texture can be drawn, negative
+    /// before.
+    double complete_seconds{-1};
+  };
+
+  explicit ImageViewer(
+      unsigned decode_workers = ImageLoader::DefaultWorkers());
+
+  ImageViewer(const ImageViewer &) = delete;
+  ImageViewer(ImageViewer &&) = delete;
+  auto operator=(const ImageViewer &) -> ImageViewer & = delete;
+  auto operator=(ImageViewer &&) -> ImageViewer & = delete;
+
+  ~ImageViewer();
+
+  /// Start decoding the image file at `path`, and show it in a new tab.
+  void Open(const std::filesystem::path &path);
+  void CloseAll();
+
+  [[nodiscard]] auto Images() const -> std::vector<ImageInfo>;
+
+  void Draw(const char *title = nullptr, bool *p_open = nullptr);
+
+  static const char *const LOGGER_NAME;
+
+private:
+  struct Entry {
+    /// The id of the last decoding of the image.
+    std::uint64_t id{0};
+    ImageInfo info;
+    /// The tab label, made unique with the id of the first decoding.
+    std::string label;
+    bool decoded{false};
+    /// A small level of the image, drawn until the full texture is uploaded.
+    TextureManager::Handle preview;
+    TextureManager::Handle texture;
+    /// 0 to fit the image in the panel.
+    float zoom{0};
+    ImageLoader::Clock::time_point opened;
+    /// The tab was closed, removed after the tab bar is drawn.
+    bool closed{false};
+  };
+
+  /// Upload the images decoded since the last frame.
+  void CollectDecoded();
+  /// Note when the uploads complete.
+  void UpdateProgress();
+  void DrawToolbar();
+  void DrawImage(Entry &entry);
+  void Close(Entry &entry);
+
+  ImageLoader loader_;
+  std::vector<Entry> images_;
+  std::string path_input_;
+  int max_texture_size_{0};
+};
+
+} // namespace asap::ui
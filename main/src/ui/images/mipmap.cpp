@@ -0,0 +1,153 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/images/mipmap.h"
+
+#include <contract/contract.h>
+
+#include <algorithm> // for std::max
+#include <utility>   // for std::move
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace asap::ui {
+
+namespace {
+
+/// Average of 4 RGBA pixels, channel by channel, rounded to nearest.
+auto Average(std::uint32_t p00, std::uint32_t p01, std::uint32_t p10,
+    std::uint32_t p11) -> std::uint32_t {
+  constexpr std::uint32_t CHANNEL_MASK = 0xFFU;
+  std::uint32_t result = 0;
+  for (unsigned shift = 0; shift < 32U; shift += 8U) {
+    const auto sum = ((p00 >> shift) & CHANNEL_MASK) +
+                     ((p01 >> shift) & CHANNEL_MASK) +
+                     ((p10 >> shift) & CHANNEL_MASK) +
+                     ((p11 >> shift) & CHANNEL_MASK);
+    result |= ((sum + 2U) >> 2U) << shift;
+  }
+  return result;
+}
+
+/// Target pixels [from, to) of a row, from the source rows `row0` and `row1`.
+void DownsampleRowScalar(const std::uint32_t *row0, const std::uint32_t *row1,
+    int source_width, int from, int to, std::uint32_t *target) {
+  for (int x = from; x < to; ++x) {
+    const auto left = 2 * x;
+    // A 1 pixel wide source has no right column
+    const auto right = std::min(left + 1, source_width - 1);
+    target[x] = Average(row0[left], row0[right], row1[left], row1[right]);
+  }
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+/// Same as DownsampleRowScalar, 4 target pixels at a time: the channels are
+/// widened to 16 bits, the rows and then the column pairs added, and the sums
+/// divided by 4 and narrowed back.
+auto DownsampleRowVectorized(const std::uint32_t *row0,
+    const std::uint32_t *row1, int target_width, std::uint32_t *target) -> int {
+  const auto zero = _mm_setzero_si128();
+  const auto rounding = _mm_set1_epi16(2);
+  int x = 0;
+  for (; x + 4 <= target_width; x += 4) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto a0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + 2 * x));
+    const auto a1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + 2 * x + 4));
+    const auto b0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + 2 * x));
+    const auto b1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + 2 * x + 4));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    // Vertical sums of the source pixels 0-1, 2-3, 4-5 and 6-7
+    const auto s01 = _mm_add_epi16(
+        _mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+    const auto s23 = _mm_add_epi16(
+        _mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+    const auto s45 = _mm_add_epi16(
+        _mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+    const auto s67 = _mm_add_epi16(
+        _mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+    // Horizontal sums of the pairs, the target pixels 0-1 and 2-3
+    auto t01 = _mm_add_epi16(
+        _mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+    auto t23 = _mm_add_epi16(
+        _mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+    t01 = _mm_srli_epi16(_mm_add_epi16(t01, rounding), 2);
+    t23 = _mm_srli_epi16(_mm_add_epi16(t23, rounding), 2);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target + x),
+        _mm_packus_epi16(t01, t23));
+  }
+  return x;
+}
+#endif
+
+} // namespace
+
+auto MipLevelCount(int width, int height) -> int {
+  ASAP_EXPECT(width > 0 && height > 0);
+  auto size = std::max(width, height);
+  int levels = 1;
+  while (size > 1) {
+    size /= 2;
+    ++levels;
+  }
+  return levels;
+}
+
+void DownsampleBox(const std::uint32_t *source, int width, int height,
+    std::uint32_t *target) {
+  ASAP_EXPECT(width > 0 && height > 0);
+  const auto target_width = std::max(1, width / 2);
+  const auto target_height = std::max(1, height / 2);
+  const auto stride = static_cast<std::size_t>(width);
+  for (int y = 0; y < target_height; ++y) {
+    const auto *row0 = source + static_cast<std::size_t>(2 * y) * stride;
+    // A 1 pixel high source has no second row
+    const auto *row1 = height > 1 ? row0 + stride : row0;
+    auto *target_row = target + static_cast<std::size_t>(y) *
+                                    static_cast<std::size_t>(target_width);
+    int x = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    // Reads 2 source pixels per target pixel, the source must be 2x as wide
+    if (width > 1) {
+      x = DownsampleRowVectorized(row0, row1, target_width, target_row);
+    }
+#endif
+    DownsampleRowScalar(row0, row1, width, x, target_width, target_row);
+  }
+}
+
+auto BuildMipChain(std::vector<std::uint32_t> level0, int width, int height)
+    -> std::vector<std::vector<std::uint32_t>> {
+  ASAP_EXPECT(level0.size() == static_cast<std::size_t>(width) *
+                                   static_cast<std::size_t>(height));
+  const auto count = MipLevelCount(width, height);
+  std::vector<std::vector<std::uint32_t>> levels;
+  levels.reserve(static_cast<std::size_t>(count));
+  levels.push_back(std::move(level0));
+  for (int level = 1; level < count; ++level) {
+    const auto next_width = std::max(1, width / 2);
+    const auto next_height = std::max(1, height / 2);
+    std::vector<std::uint32_t> next(static_cast<std::size_t>(next_width) *
+                                    static_cast<std::size_t>(next_height));
+    DownsampleBox(levels.back().data(), width, height, next.data());
+    levels.push_back(std::move(next));
+    width = next_width;
+    height = next_height;
+  }
+  return levels;
+}
+
+} // namespace asap::ui
@@ -0,0 +1,32 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace asap::ui {
+
+/// Number of mip levels of a `width` x `height` image, down to 1x1.
+auto MipLevelCount(int width, int height) -> int;
+
+/*!
+ * \brief Halve an RGBA image with a 2x2 box filter.
+ *
+ * `target` receives max(1, width / 2) x max(1, height / 2) pixels, the sizes
+ * of the next level of a GL texture: with an odd size, the last column or row
+ * is dropped. Vectorized with SSE2 where available, 4 target pixels at a time.
+ */
+void DownsampleBox(const std::uint32_t *source, int width, int height,
+    std::uint32_t *target);
+
+/// All the levels of an RGBA image, `level0` first.
+auto BuildMipChain(std::vector<std::uint32_t> level0, int width, int height)
+    -> std::vector<std::vector<std::uint32_t>>;
+
+} // namespace asap::ui
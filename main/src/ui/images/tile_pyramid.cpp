@@ -0,0 +1,457 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/images/tile_pyramid.h"
+#include "ui/images/mipmap.h"
+
+#include <contract/contract.h>
+
+#include <algorithm> // for std::min
+#include <cerrno>
+#include <cstring> // for memcmp, memcpy
+#include <fstream>
+#include <vector>
+
+#include <stb_image.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace asap::ui {
+
+const char *const TilePyramid::LOGGER_NAME = "main";
+const char *const TilePyramidWriter::LOGGER_NAME = "main";
+
+namespace {
+
+constexpr char MAGIC[] = "ASAPTIL1";
+constexpr std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+/// The header takes a page, so that the tiles are page aligned.
+constexpr std::uint64_t HEADER_SIZE = 4096;
+
+/// The header, at the start of the file.
+struct Header {
+  char magic[MAGIC_SIZE]; // NOLINT
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint32_t tile_size;
+  std::uint32_t levels;
+};
+
+/// Rows of the full size image converted at a time by ConvertImage().
+constexpr int CONVERT_BAND = TilePyramid::TILE_SIZE;
+
+auto Cancelled(const std::atomic<bool> *cancel) -> bool {
+  return cancel != nullptr && cancel->load(std::memory_order_relaxed);
+}
+
+auto TileCount(int size) -> int {
+  return (size + TilePyramid::TILE_SIZE - 1) / TilePyramid::TILE_SIZE;
+}
+
+} // namespace
+
+TilePyramid::~TilePyramid() {
+  Close();
+}
+
+auto TilePyramid::IsTileFile(const std::filesystem::path &path) -> bool {
+  std::ifstream file(path, std::ios::binary);
+  char magic[MAGIC_SIZE]{}; // NOLINT
+  return file.read(magic, MAGIC_SIZE) &&
+         std::memcmp(magic, MAGIC, MAGIC_SIZE) == 0;
+}
+
+auto TilePyramid::LevelWidth(int level) const -> int {
+  return std::max(1, width_ >> level);
+}
+
+auto TilePyramid::LevelHeight(int level) const -> int {
+  return std::max(1, height_ >> level);
+}
+
+auto TilePyramid::TilesX(int level) const -> int {
+  return TileCount(LevelWidth(level));
+}
+
+auto TilePyramid::TilesY(int level) const -> int {
+  return TileCount(LevelHeight(level));
+}
+
+void TilePyramid::Layout(int width, int height) {
+  width_ = width;
+  height_ = height;
+  levels_ = 0;
+  std::uint64_t tiles = 0;
+  do {
+    level_first_tile_[levels_] = tiles;
+    tiles += static_cast<std::uint64_t>(TilesX(levels_)) *
+             static_cast<std::uint64_t>(TilesY(levels_));
+    ++levels_;
+  } while (levels_ < MAX_LEVELS &&
+           (LevelWidth(levels_ - 1) > TILE_SIZE ||
+               LevelHeight(levels_ - 1) > TILE_SIZE));
+  level_first_tile_[levels_] = tiles;
+}
+
+auto TilePyramid::FileSize() const -> std::uint64_t {
+  return HEADER_SIZE + level_first_tile_[levels_] * TILE_BYTES;
+}
+
+auto TilePyramid::TileOffset(int level, int x, int y) const -> std::uint64_t {
+  ASAP_ASSERT(level >= 0 && level < levels_);
+  ASAP_ASSERT(x >= 0 && x < TilesX(level) && y >= 0 && y < TilesY(level));
+  const auto index = level_first_tile_[level] +
+                     static_cast<std::uint64_t>(y) * TilesX(level) +
+                     static_cast<std::uint64_t>(x);
+  return HEADER_SIZE + index * TILE_BYTES;
+}
+
+auto TilePyramid::Tile(int level, int x, int y) const
+    -> const std::uint32_t * {
+  ASAP_ASSERT(IsOpen());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<const std::uint32_t *>(
+      data_ + TileOffset(level, x, y));
+}
+
+auto TilePyramidWriter::TileData(int level, int x, int y) -> std::uint32_t * {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<std::uint32_t *>(
+      data_ + layout_.TileOffset(level, x, y));
+}
+
+void TilePyramidWriter::AddRows(const std::uint32_t *rows, int count) {
+  ASAP_ASSERT(data_ != nullptr);
+  ASAP_ASSERT(rows_added_ + count <= layout_.Height());
+  const auto width = layout_.Width();
+  for (int row = 0; row < count; ++row, ++rows_added_) {
+    const auto tile_y = rows_added_ / TilePyramid::TILE_SIZE;
+    const auto tile_row = rows_added_ % TilePyramid::TILE_SIZE;
+    const auto *source = rows + static_cast<std::size_t>(row) * width;
+    for (int tile_x = 0; tile_x < layout_.TilesX(0); ++tile_x) {
+      const auto first = tile_x * TilePyramid::TILE_SIZE;
+      const auto pixels = std::min(TilePyramid::TILE_SIZE, width - first);
+      std::memcpy(TileData(0, tile_x, tile_y) +
+                      static_cast<std::size_t>(tile_row) *
+                          TilePyramid::TILE_SIZE,
+          source + first, static_cast<std::size_t>(pixels) * 4);
+    }
+  }
+}
+
+auto TilePyramidWriter::BuildLevel(int level, const std::atomic<bool> *cancel)
+    -> bool {
+  constexpr int TILE = TilePyramid::TILE_SIZE;
+  const auto source_width = layout_.LevelWidth(level - 1);
+  const auto source_height = layout_.LevelHeight(level - 1);
+  // The 2x2 source tiles of a target tile, and the target tile before it is
+  // laid out with the tile stride
+  std::vector<std::uint32_t> block(TilePyramid::TILE_PIXELS * 4);
+  std::vector<std::uint32_t> halved(TilePyramid::TILE_PIXELS);
+
+  for (int tile_y = 0; tile_y < layout_.TilesY(level); ++tile_y) {
+    if (Cancelled(cancel)) {
+      return false;
+    }
+    for (int tile_x = 0; tile_x < layout_.TilesX(level); ++tile_x) {
+      const auto block_width =
+          std::min(2 * TILE, source_width - 2 * TILE * tile_x);
+      const auto block_height =
+          std::min(2 * TILE, source_height - 2 * TILE * tile_y);
+      for (int row = 0; row < block_height; ++row) {
+        const auto source_y = 2 * tile_y + row / TILE;
+        for (int half = 0; half < 2 && half * TILE < block_width; ++half) {
+          const auto pixels = std::min(TILE, block_width - half * TILE);
+          std::memcpy(
+              block.data() + static_cast<std::size_t>(row) * block_width +
+                  static_cast<std::size_t>(half) * TILE,
+              TileData(level - 1, 2 * tile_x + half, source_y) +
+                  static_cast<std::size_t>(row % TILE) * TILE,
+              static_cast<std::size_t>(pixels) * 4);
+        }
+      }
+      DownsampleBox(block.data(), block_width, block_height, halved.data());
+
+      const auto width = std::max(1, block_width / 2);
+      const auto height = std::max(1, block_height / 2);
+      auto *target = TileData(level, tile_x, tile_y);
+      for (int row = 0; row < height; ++row) {
+        std::memcpy(target + static_cast<std::size_t>(row) * TILE,
+            halved.data() + static_cast<std::size_t>(row) * width,
+            static_cast<std::size_t>(width) * 4);
+      }
+    }
+  }
+  return true;
+}
+
+auto TilePyramidWriter::ConvertImage(const std::filesystem::path &image,
+    const std::filesystem::path &tiles, std::atomic<float> *progress,
+    const std::atomic<bool> *cancel) -> bool {
+  int width = 0;
+  int height = 0;
+  int channels = 0;
+  auto *pixels = stbi_load(image.string().c_str(), &width, &height, &channels,
+      static_cast<int>(sizeof(std::uint32_t)));
+  if (pixels == nullptr) {
+    ASLOG(error, "image '{}': {}", image.string(), stbi_failure_reason());
+    return false;
+  }
+  TilePyramidWriter writer;
+  auto done = writer.Create(tiles, width, height);
+  if (done) {
+    std::vector<std::uint32_t> band(
+        static_cast<std::size_t>(width) * CONVERT_BAND);
+    for (int row = 0; row < height && !Cancelled(cancel);
+         row += CONVERT_BAND) {
+      const auto rows = std::min(CONVERT_BAND, height - row);
+      // The RGBA bytes, read as they are laid out in memory by GL
+      std::memcpy(band.data(),
+          pixels + static_cast<std::size_t>(row) * width * 4,
+          static_cast<std::size_t>(rows) * width * 4);
+      writer.AddRows(band.data(), rows);
+    }
+    // Finish() gives up on an incomplete file
+    done = writer.Finish(progress, cancel);
+  }
+  stbi_image_free(pixels);
+  return done;
+}
+
+#if defined(__linux__)
+
+auto TilePyramid::Open(const std::filesystem::path &path) -> bool {
+  Close();
+
+  fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+  if (fd_ < 0) {
+    ASLOG(error, "could not open tile file {}: {}", path.string(),
+        std::strerror(errno));
+    return false;
+  }
+  struct stat status {};
+  if (::fstat(fd_, &status) != 0) {
+    ASLOG(error, "could not stat tile file {}: {}", path.string(),
+        std::strerror(errno));
+    Close();
+    return false;
+  }
+  const auto size = static_cast<std::uint64_t>(status.st_size);
+  Header header{};
+  if (size < HEADER_SIZE ||
+      ::pread(fd_, &header, sizeof(header), 0) !=
+          static_cast<ssize_t>(sizeof(header)) ||
+      std::memcmp(header.magic, MAGIC, MAGIC_SIZE) != 0 ||
+      header.tile_size != TILE_SIZE || header.width == 0 ||
+      header.height == 0 || header.width > (1U << 30U) ||
+      header.height > (1U << 30U)) {
+    ASLOG(error, "{} is not a tile file", path.string());
+    Close();
+    return false;
+  }
+  Layout(static_cast<int>(header.width), static_cast<int>(header.height));
+  if (static_cast<std::uint32_t>(levels_) != header.levels ||
+      size < FileSize()) {
+    ASLOG(error, "tile file {} is truncated or corrupted", path.string());
+    Close();
+    return false;
+  }
+
+  auto *mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd_, 0);
+  if (mapping == MAP_FAILED) {
+    ASLOG(error, "could not map tile file {}: {}", path.string(),
+        std::strerror(errno));
+    Close();
+    return false;
+  }
+  // Tiles are read here and there, not front to back
+  ::madvise(mapping, size, MADV_RANDOM);
+  data_ = static_cast<const unsigned char *>(mapping);
+  mapped_size_ = size;
+  ASLOG(info, "opened tile file {}: {}x{}, {} levels", path.string(), width_,
+      height_, levels_);
+  return true;
+}
+
+void TilePyramid::Close() {
+  if (data_ != nullptr) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    ::munmap(const_cast<unsigned char *>(data_), mapped_size_);
+    data_ = nullptr;
+  }
+  mapped_size_ = 0;
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  width_ = 0;
+  height_ = 0;
+  levels_ = 0;
+}
+
+TilePyramidWriter::~TilePyramidWriter() {
+  Abandon();
+}
+
+auto TilePyramidWriter::Create(const std::filesystem::path &path, int width,
+    int height) -> bool {
+  ASAP_ASSERT(width > 0 && height > 0);
+  Abandon();
+
+  auto temp_path = path;
+  temp_path += ".tmp";
+  constexpr mode_t MODE = 0644;
+  fd_ = ::open(temp_path.c_str(), // NOLINT
+      O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, MODE);
+  if (fd_ < 0) {
+    ASLOG(error, "could not create tile file {}: {}", temp_path.string(),
+        std::strerror(errno));
+    return false;
+  }
+  path_ = path;
+  temp_path_ = std::move(temp_path);
+  layout_.Layout(width, height);
+  const auto size = layout_.FileSize();
+  // The file is sparse, the padding of the edge tiles reads as zeros
+  if (::ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+    ASLOG(error, "could not size tile file {}: {}", path.string(),
+        std::strerror(errno));
+    Abandon();
+    return false;
+  }
+  auto *mapping =
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (mapping == MAP_FAILED) {
+    ASLOG(error, "could not map tile file {}: {}", path.string(),
+        std::strerror(errno));
+    Abandon();
+    return false;
+  }
+  data_ = static_cast<unsigned char *>(mapping);
+  mapped_size_ = size;
+  rows_added_ = 0;
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, MAGIC_SIZE);
+  header.width = static_cast<std::uint32_t>(width);
+  header.height = static_cast<std::uint32_t>(height);
+  header.tile_size = TilePyramid::TILE_SIZE;
+  header.levels = static_cast<std::uint32_t>(layout_.Levels());
+  std::memcpy(data_, &header, sizeof(header));
+  return true;
+}
+
+auto TilePyramidWriter::Finish(
+    std::atomic<float> *progress, const std::atomic<bool> *cancel) -> bool {
+  ASAP_ASSERT(data_ != nullptr);
+  if (Cancelled(cancel)) {
+    ASLOG(info, "tile file {} cancelled", path_.string());
+    Abandon();
+    return false;
+  }
+  if (rows_added_ != layout_.Height()) {
+    ASLOG(error, "tile file {}: {} rows added out of {}", path_.string(),
+        rows_added_, layout_.Height());
+    Abandon();
+    return false;
+  }
+  const auto levels = layout_.Levels();
+  for (int level = 1; level < levels; ++level) {
+    if (!BuildLevel(level, cancel)) {
+      ASLOG(info, "tile file {} cancelled", path_.string());
+      Abandon();
+      return false;
+    }
+    if (progress != nullptr) {
+      progress->store(static_cast<float>(level) / static_cast<float>(levels),
+          std::memory_order_relaxed);
+    }
+  }
+  if (::msync(data_, mapped_size_, MS_SYNC) != 0) {
+    ASLOG(error, "could not write tile file {}: {}", path_.string(),
+        std::strerror(errno));
+    Abandon();
+    return false;
+  }
+  ::munmap(data_, mapped_size_);
+  data_ = nullptr;
+  mapped_size_ = 0;
+  ::close(fd_);
+  fd_ = -1;
+  // Only a complete file gets the name it is opened with
+  std::error_code error;
+  std::filesystem::rename(temp_path_, path_, error);
+  if (error) {
+    ASLOG(error, "could not write tile file {}: {}", path_.string(),
+        error.message());
+    std::filesystem::remove(temp_path_, error);
+    temp_path_.clear();
+    path_.clear();
+    return false;
+  }
+  temp_path_.clear();
+  if (progress != nullptr) {
+    progress->store(1.0F, std::memory_order_relaxed);
+  }
+  ASLOG(info, "wrote tile file {}: {}x{}, {} levels", path_.string(),
+      layout_.Width(), layout_.Height(), levels);
+  path_.clear();
+  return true;
+}
+
+void TilePyramidWriter::Abandon() {
+  if (data_ != nullptr) {
+    ::munmap(data_, mapped_size_);
+    data_ = nullptr;
+  }
+  mapped_size_ = 0;
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+    std::error_code error;
+    std::filesystem::remove(temp_path_, error);
+  }
+  temp_path_.clear();
+  path_.clear();
+}
+
+#else // __linux__
+
+auto TilePyramid::Open(const std::filesystem::path &path) -> bool {
+  ASLOG(error, "can't open {}: tile files are only supported on Linux",
+      path.string());
+  return false;
+}
+
+void TilePyramid::Close() {
+}
+
+TilePyramidWriter::~TilePyramidWriter() = default;
+
+auto TilePyramidWriter::Create(const std::filesystem::path &path,
+    int /*width*/, int /*height*/) -> bool {
+  ASLOG(error, "can't create {}: tile files are only supported on Linux",
+      path.string());
+  return false;
+}
+
+auto TilePyramidWriter::Finish(std::atomic<float> * /*progress*/,
+    const std::atomic<bool> * /*cancel*/) -> bool {
+  return false;
+}
+
+void TilePyramidWriter::Abandon() {
+}
+
+#endif // __linux__
+
+} // namespace asap::ui
@@ -0,0 +1,175 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <logging/logging.h>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+
+namespace asap::ui {
+
+/*!
+ * \brief A very large RGBA image split in tiles of 256x256 pixels, for each of
+ * its mip levels, in a memory mapped tile file.
+ *
+ * The levels go from the full size down to the first one fitting in a single
+ * tile. The tiles of a level are stored row by row, uncompressed and in the
+ * native byte order, the levels one after the other. Tiles at the right and
+ * bottom edges are padded with transparent pixels. Each tile is 256 KiB and
+ * page aligned, so that reading one only faults its own pages in.
+ *
+ * The file is mapped, not read: only the tiles that are looked at are ever
+ * loaded from the disk, whatever the size of the image. Tile files are written
+ * with TilePyramidWriter. Memory mapping is only available on Linux, opening a
+ * file fails on other platforms.
+ */
+class TilePyramid : public asap::logging::Loggable<TilePyramid> {
+public:
+  static constexpr int TILE_SIZE = 256;
+  static constexpr std::size_t TILE_PIXELS =
+      static_cast<std::size_t>(TILE_SIZE) * TILE_SIZE;
+  static constexpr std::size_t TILE_BYTES = TILE_PIXELS * sizeof(std::uint32_t);
+
+  TilePyramid() = default;
+
+  TilePyramid(const TilePyramid &) = delete;
+  TilePyramid(TilePyramid &&) = delete;
+  auto operator=(const TilePyramid &) -> TilePyramid & = delete;
+  auto operator=(TilePyramid &&) -> TilePyramid & = delete;
+
+  ~TilePyramid();
+
+  /// Return true if `path` starts like a tile file.
+  static auto IsTileFile(const std::filesystem::path &path) -> bool;
+
+  auto Open(const std::filesystem::path &path) -> bool;
+  void Close();
+
+  [[nodiscard]] auto IsOpen() const -> bool {
+    return data_ != nullptr;
+  }
+
+  [[nodiscard]] auto Width() const -> int {
+    return width_;
+  }
+  [[nodiscard]] auto Height() const -> int {
+    return height_;
+  }
+  [[nodiscard]] auto Levels() const -> int {
+    return levels_;
+  }
+  [[nodiscard]] auto LevelWidth(int level) const -> int;
+  [[nodiscard]] auto LevelHeight(int level) const -> int;
+  [[nodiscard]] auto TilesX(int level) const -> int;
+  [[nodiscard]] auto TilesY(int level) const -> int;
+
+  /// The TILE_PIXELS pixels of a tile, in the mapping. Reading them may block
+  /// while the pages are loaded from the disk.
+  [[nodiscard]] auto Tile(int level, int x, int y) const
+      -> const std::uint32_t *;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  friend class TilePyramidWriter;
+
+  /// Where the tile is in the file.
+  [[nodiscard]] auto TileOffset(int level, int x, int y) const
+      -> std::uint64_t;
+  /// Compute the levels and the offset of their first tile.
+  void Layout(int width, int height);
+  [[nodiscard]] auto FileSize() const -> std::uint64_t;
+
+  static constexpr int MAX_LEVELS = 32;
+
+  int width_{0};
+  int height_{0};
+  int levels_{0};
+  /// Index of the first tile of each level.
+  std::uint64_t level_first_tile_[MAX_LEVELS + 1]{};
+
+  int fd_{-1};
+  const unsigned char *data_{nullptr};
+  std::uint64_t mapped_size_{0};
+};
+
+/*!
+ * \brief Writes a tile file, from the full size image given a band of rows at
+ * a time.
+ *
+ * The output file is mapped: the rows are copied in the tiles of the first
+ * level as they come, and Finish() builds each level from the tiles of the
+ * previous one with a 2x2 box filter. Only one band of rows needs to be in
+ * memory, the image itself can be larger than the memory.
+ *
+ * The file is written under a temporary name and only renamed to its final
+ * name by Finish(), once it is complete on the disk: an interrupted conversion
+ * never leaves a tile file that opens.
+ */
+class TilePyramidWriter : public asap::logging::Loggable<TilePyramidWriter> {
+public:
+  TilePyramidWriter() = default;
+
+  TilePyramidWriter(const TilePyramidWriter &) = delete;
+  TilePyramidWriter(TilePyramidWriter &&) = delete;
+  auto operator=(const TilePyramidWriter &) -> TilePyramidWriter & = delete;
+  auto operator=(TilePyramidWriter &&) -> TilePyramidWriter & = delete;
+
+  /// Abandon an unfinished file.
+  ~TilePyramidWriter();
+
+  /// Start the tile file of a `width` x `height` image, to be written to
+  /// `path` once finished.
+  auto Create(const std::filesystem::path &path, int width, int height)
+      -> bool;
+
+  /// Copy the next `count` rows of the full size image, RGBA and `width`
+  /// pixels each.
+  void AddRows(const std::uint32_t *rows, int count);
+
+  /// Build the levels, close the file and give it its final name, once all
+  /// the rows are added. `progress` goes from 0 to 1 along the way, if given.
+  /// The file is abandoned, and false returned, as soon as `cancel` is set.
+  auto Finish(std::atomic<float> *progress = nullptr,
+      const std::atomic<bool> *cancel = nullptr) -> bool;
+
+  /*!
+   * \brief Convert an image file, as decoded by stb_image, to a tile file.
+   *
+   * The decoded image must fit in memory; larger images must be given to a
+   * writer band by band. `progress` goes from 0 to 1 along the way, if given.
+   * Setting `cancel` stops the conversion after the band or the row of tiles
+   * being written, without leaving a tile file behind.
+   */
+  static auto ConvertImage(const std::filesystem::path &image,
+      const std::filesystem::path &tiles,
+      std::atomic<float> *progress = nullptr,
+      const std::atomic<bool> *cancel = nullptr) -> bool;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  [[nodiscard]] auto TileData(int level, int x, int y) -> std::uint32_t *;
+  /// Return false if `cancel` was set before the level was complete.
+  auto BuildLevel(int level, const std::atomic<bool> *cancel) -> bool;
+  void Abandon();
+
+  std::filesystem::path path_;
+  /// Where the file is written until it is finished.
+  std::filesystem::path temp_path_;
+  /// Only used for its layout.
+  TilePyramid layout_;
+  int rows_added_{0};
+  int fd_{-1};
+  unsigned char *data_{nullptr};
+  std::uint64_t mapped_size_{0};
+};
+
+} // namespace asap::ui
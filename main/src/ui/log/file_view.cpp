@@ -0,0 +1,578 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/log/file_view.h"
+#include "ui/fonts/material_design_icons.h"
+#include "ui/log/viewer.h"
+
+#include <contract/contract.h>
+#include <imgui/imgui.h>
+#include <imgui/misc/cpp/imgui_stdlib.h>
+
+#include <algorithm> // for std::min
+#include <cerrno>
+#include <cstring> // for memchr
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace asap::ui {
+
+const char *const LogFileView::LOGGER_NAME = "main";
+
+namespace {
+
+/// The file is indexed in blocks of that many bytes, shared among the indexing
+/// threads, and each block is shown as soon as it and the ones before it are
+/// indexed.
+constexpr std::uint64_t INDEX_BLOCK = 16U * 1024U * 1024U;
+
+/// Most line starts appended to the line index per frame, so that indexing a
+/// large file does not stall the frames.
+constexpr std::size_t MAX_COLLECTED_LINES = 1U << 20U;
+
+/// Progress is reported, and cancellation checked, every that many bytes.
+constexpr std::uint64_t INDEX_STEP = 4U * 1024U * 1024U;
+
+/// Used to estimate the size of the line index.
+constexpr std::uint64_t AVERAGE_LINE_LENGTH = 64;
+
+/// Longest part of a line that is displayed, the rest is cut.
+constexpr std::uint64_t MAX_DISPLAYED_LINE = 4096;
+
+constexpr float PATH_INPUT_WIDTH = 300.0F;
+constexpr float PROGRESS_WIDTH = 160.0F;
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+/// Append to `starts` the offset following each newline of the `size` bytes
+/// of `data`, which start at offset `base` of the file.
+void ScanNewlinesScalar(const char *data, std::uint64_t size,
+    std::uint64_t base, std::vector<std::uint64_t> &starts) {
+  const auto *cursor = data;
+  const auto *end = data + size;
+  while (cursor < end) {
+    const auto *newline = static_cast<const char *>(
+        std::memchr(cursor, '\n', static_cast<std::size_t>(end - cursor)));
+    if (newline == nullptr) {
+      break;
+    }
+    starts.push_back(base + static_cast<std::uint64_t>(newline - data) + 1);
+    cursor = newline + 1;
+  }
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+/// Index of the lowest bit set in `mask`, which must not be 0.
+auto CountTrailingZeros(unsigned mask) -> unsigned {
+#if defined(_MSC_VER)
+  unsigned long index = 0; // NOLINT(google-runtime-int)
+  _BitScanForward(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+/// Same as ScanNewlinesScalar, comparing 16 bytes at a time. Log lines are
+/// short, so this is noticeably faster than one memchr call per line.
+void ScanNewlinesVectorized(const char *data, std::uint64_t size,
+    std::uint64_t base, std::vector<std::uint64_t> &starts) {
+  constexpr std::uint64_t width = sizeof(__m128i);
+  const auto newline = _mm_set1_epi8('\n');
+  std::uint64_t position = 0;
+  for (; position + width <= size; position += width) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto bytes = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(data + position));
+    auto mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)));
+    while (mask != 0) {
+      starts.push_back(base + position + CountTrailingZeros(mask) + 1);
+      mask &= mask - 1;
+    }
+  }
+  ScanNewlinesScalar(
+      data + position, size - position, base + position, starts);
+}
+#endif
+
+/// Read `size` bytes of the file `fd` at `offset` into `buffer`. Return false
+/// if they could not all be read, such as when the file was truncated.
+auto ReadAt(int fd, std::uint64_t offset, std::uint64_t size, char *buffer)
+    -> bool {
+#if defined(__linux__)
+  while (size > 0) {
+    const auto count = ::pread(fd, buffer, static_cast<std::size_t>(size),
+        static_cast<off_t>(offset));
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count <= 0) {
+      return false;
+    }
+    const auto read = static_cast<std::uint64_t>(count);
+    buffer += read; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    offset += read;
+    size -= read;
+  }
+  return true;
+#else
+  (void)fd;
+  (void)offset;
+  (void)size;
+  (void)buffer;
+  return false;
+#endif // __linux__
+}
+
+/// Index the newlines of [from, to) of the file `fd` in steps, reporting
+/// progress in `done` and stopping early when `cancel` is set or the file is
+/// truncated.
+///
+/// The bytes are read with pread rather than through the mapping: reading the
+/// mapping past the end of a file truncated meanwhile raises SIGBUS, which
+/// can't be ruled out by checking the size first.
+void ScanNewlines(int fd, std::uint64_t from, std::uint64_t to,
+    std::vector<std::uint64_t> &starts, const std::atomic<bool> &cancel,
+    std::atomic<std::uint64_t> &done) {
+  // Good enough guess of the number of lines, to avoid most reallocations
+  starts.reserve(starts.size() + (to - from) / AVERAGE_LINE_LENGTH);
+  std::vector<char> buffer(
+      static_cast<std::size_t>(std::min(INDEX_STEP, to - from)));
+  for (auto position = from; position < to;) {
+    if (cancel.load(std::memory_order_relaxed)) {
+      return;
+    }
+    const auto step = std::min(INDEX_STEP, to - position);
+    if (!ReadAt(fd, position, step, buffer.data())) {
+      return;
+    }
+#if defined(__SSE2__) || defined(_M_X64)
+    ScanNewlinesVectorized(buffer.data(), step, position, starts);
+#else
+    ScanNewlinesScalar(buffer.data(), step, position, starts);
+#endif
+    done.fetch_add(step, std::memory_order_relaxed);
+    position += step;
+  }
+}
+
+} // namespace
+
+LogFileView::~LogFileView() {
+  Close();
+}
+
+#if defined(__linux__)
+
+auto LogFileView::Open(const std::filesystem::path &path) -> bool {
+  // `path` may be our own `path_`, which Close() does not touch
+  Close();
+
+  fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+  if (fd_ < 0) {
+    ASLOG(error, "could not open log file {}: {}", path.string(),
+        std::strerror(errno));
+    return false;
+  }
+  path_ = path;
+  path_input_ = path.string();
+
+  struct stat status {};
+  if (::fstat(fd_, &status) != 0) {
+    ASLOG(error, "could not stat log file {}: {}", path.string(),
+        std::strerror(errno));
+    Close();
+    return false;
+  }
+
+  inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ < 0 ||
+      ::inotify_add_watch(inotify_fd_, path.c_str(),
+          IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF) < 0) {
+    ASLOG(warn, "changes to log file {} will not be followed: {}",
+        path.string(), std::strerror(errno));
+  }
+
+  line_starts_.push_back(0);
+  mapped_size_ = 0;
+  indexed_size_ = 0;
+  ASLOG(info, "opened log file {} ({} bytes)", path.string(), status.st_size);
+  Refresh();
+  return true;
+}
+
+void LogFileView::Close() {
+  index_cancel_.store(true, std::memory_order_relaxed);
+  if (index_thread_.joinable()) {
+    index_thread_.join();
+  }
+  indexing_.store(false, std::memory_order_relaxed);
+  index_blocks_.clear();
+  index_ready_.clear();
+  index_block_ = 0;
+  index_block_offset_ = 0;
+
+  Unmap();
+  if (inotify_fd_ >= 0) {
+    ::close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  line_starts_.clear();
+  indexed_size_ = 0;
+  index_end_ = 0;
+  refresh_pending_ = false;
+  reopen_pending_ = false;
+}
+
+void LogFileView::Unmap() {
+  if (data_ != nullptr) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    ::munmap(const_cast<char *>(data_), mapped_size_);
+    data_ = nullptr;
+  }
+  mapped_size_ = 0;
+  file_size_ = 0;
+}
+
+void LogFileView::Refresh() {
+  ASAP_ASSERT(!IsIndexing());
+
+  struct stat status {};
+  if (::fstat(fd_, &status) != 0) {
+    ASLOG(error, "could not stat log file {}: {}", path_.string(),
+        std::strerror(errno));
+    return;
+  }
+  const auto size = static_cast<std::uint64_t>(status.st_size);
+  if (size < mapped_size_) {
+    ASLOG(info, "log file {} was truncated, re-opening it", path_.string());
+    const auto path = path_;
+    Open(path);
+    return;
+  }
+  if (size == mapped_size_) {
+    return;
+  }
+
+  void *mapping = MAP_FAILED;
+  if (data_ == nullptr) {
+    mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd_, 0);
+  } else {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    mapping = ::mremap(const_cast<char *>(data_), mapped_size_, size,
+        MREMAP_MAYMOVE);
+  }
+  if (mapping == MAP_FAILED) {
+    ASLOG(error, "could not map log file {}: {}", path_.string(),
+        std::strerror(errno));
+    return;
+  }
+  const auto previous_size = mapped_size_;
+  data_ = static_cast<const char *>(mapping);
+  mapped_size_ = size;
+  file_size_ = size;
+  StartIndexing(previous_size, size);
+}
+
+void LogFileView::PollChanges() {
+  if (inotify_fd_ >= 0) {
+    alignas(struct inotify_event) char buffer[4096]; // NOLINT
+    for (;;) {
+      const auto length = ::read(inotify_fd_, buffer, sizeof(buffer));
+      if (length <= 0) {
+        break;
+      }
+      for (auto offset = 0L; offset < length;) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto *event = reinterpret_cast<const inotify_event *>(
+            &buffer[offset]); // NOLINT
+        if ((event->mask & IN_MODIFY) != 0) {
+          refresh_pending_ = true;
+        }
+        if ((event->mask & (IN_MOVE_SELF | IN_DELETE_SELF | IN_IGNORED)) !=
+            0) {
+          reopen_pending_ = true;
+        }
+        offset += static_cast<long>(sizeof(inotify_event) + event->len);
+      }
+    }
+  }
+
+  // Reading the mapping past the end of a truncated file raises SIGBUS, so
+  // check for truncation every frame rather than waiting for the event, and
+  // stop reading the mapping at once: Open() cancels and joins the indexing,
+  // and unmaps the file before mapping it again.
+  struct stat status {};
+  if (data_ != nullptr && ::fstat(fd_, &status) == 0) {
+    file_size_ = static_cast<std::uint64_t>(status.st_size);
+    if (file_size_ < mapped_size_) {
+      ASLOG(info, "log file {} was truncated, re-opening it", path_.string());
+      const auto path = path_;
+      Open(path);
+      return;
+    }
+  }
+
+  if (IsIndexing()) {
+    // The mapping cannot change while it is being indexed
+    return;
+  }
+  if (refresh_pending_) {
+    refresh_pending_ = false;
+    Refresh();
+  }
+  if (reopen_pending_ && !IsIndexing()) {
+    // Log rotation: the lines written to the old file until now have been
+    // picked by the refresh above, continue with the new file when it's there.
+    std::error_code error;
+    if (std::filesystem::exists(path_, error)) {
+      ASLOG(info, "log file {} was replaced, re-opening it", path_.string());
+      const auto path = path_;
+      Open(path);
+    }
+  }
+}
+
+#else // __linux__
+
+auto LogFileView::Open(const std::filesystem::path &path) -> bool {
+  ASLOG(error, "can't open {}: the log file viewer is only supported on Linux",
+      path.string());
+  return false;
+}
+
+void LogFileView::Close() {
+}
+
+void LogFileView::Unmap() {
+}
+
+void LogFileView::Refresh() {
+}
+
+void LogFileView::PollChanges() {
+}
+
+#endif // __linux__
+
+void LogFileView::StartIndexing(std::uint64_t from, std::uint64_t to) {
+  ASAP_ASSERT(!IsIndexing());
+  if (index_thread_.joinable()) {
+    index_thread_.join();
+  }
+  indexing_.store(true, std::memory_order_release);
+  index_cancel_.store(false, std::memory_order_relaxed);
+  index_done_.store(0, std::memory_order_relaxed);
+  index_total_ = to - from;
+  index_from_ = from;
+  index_end_ = to;
+
+  const auto blocks = static_cast<std::size_t>(
+      (to - from + INDEX_BLOCK - 1) / INDEX_BLOCK);
+  index_blocks_.assign(blocks, {});
+  index_ready_.assign(blocks, false);
+  index_block_ = 0;
+  index_block_offset_ = 0;
+
+  index_thread_ = std::thread([this, from, to, blocks]() {
+    const auto threads = std::clamp<std::size_t>(
+        std::thread::hardware_concurrency(), 1, blocks);
+
+    // Blocks are taken in order, so that the first ones are ready first
+    std::atomic<std::size_t> next_block{0};
+    const auto scan_blocks = [this, from, to, blocks, &next_block]() {
+      for (auto block = next_block.fetch_add(1); block < blocks;
+           block = next_block.fetch_add(1)) {
+        const auto begin = from + block * INDEX_BLOCK;
+        const auto end = std::min(begin + INDEX_BLOCK, to);
+        ScanNewlines(
+            fd_, begin, end, index_blocks_[block], index_cancel_, index_done_);
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        index_ready_[block] = true;
+      }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t worker = 1; worker < threads; ++worker) {
+      workers.emplace_back(scan_blocks);
+    }
+    scan_blocks();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    indexing_.store(false, std::memory_order_release);
+  });
+}
+
+void LogFileView::CollectIndex() {
+  auto budget = MAX_COLLECTED_LINES;
+  while (budget > 0 && index_block_ < index_blocks_.size()) {
+    {
+      std::lock_guard<std::mutex> lock(index_mutex_);
+      if (!index_ready_[index_block_]) {
+        break;
+      }
+    }
+    const auto &block = index_blocks_[index_block_];
+    const auto count = std::min(budget, block.size() - index_block_offset_);
+    const auto first = block.begin() +
+                       static_cast<std::ptrdiff_t>(index_block_offset_);
+    line_starts_.insert(
+        line_starts_.end(), first, first + static_cast<std::ptrdiff_t>(count));
+    index_block_offset_ += count;
+    budget -= count;
+    scroll_to_bottom_ = true;
+
+    if (index_block_offset_ < block.size()) {
+      // The lines before the last start appended are complete
+      indexed_size_ = line_starts_.back();
+      break;
+    }
+    indexed_size_ = std::min(
+        index_from_ + (index_block_ + 1) * INDEX_BLOCK, index_end_);
+    // Release the memory of the block, it is in the line index now
+    index_blocks_[index_block_] = {};
+    index_block_offset_ = 0;
+    ++index_block_;
+  }
+}
+
+auto LogFileView::IsIndexing() const -> bool {
+  return indexing_.load(std::memory_order_acquire) ||
+         indexed_size_ < index_end_;
+}
+
+auto LogFileView::LineCount() const -> std::size_t {
+  if (line_starts_.empty()) {
+    return 0;
+  }
+  // No line after the last newline yet
+  if (line_starts_.back() >= indexed_size_) {
+    return line_starts_.size() - 1;
+  }
+  return line_starts_.size();
+}
+
+void LogFileView::Draw(const char *title, bool *open) {
+  ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
+
+  // This is the case when the viewer is supposed to open in its own ImGui
+  // window (not docked).
+  if (open != nullptr) {
+    ASAP_ASSERT(title != nullptr);
+    ImGui::Begin(title, open);
+  }
+
+  PollChanges();
+  CollectIndex();
+
+  DrawToolbar();
+
+  ImGui::Separator();
+  ImGui::BeginChild(
+      "lines", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+  DrawLines();
+  ImGui::EndChild();
+
+  // The case of the viewer in its own ImGui window (not docked)
+  if (open != nullptr) {
+    ImGui::End();
+  }
+}
+
+void LogFileView::DrawToolbar() {
+  // Make all buttons transparent in the toolbar
+  auto button_color = ImGui::GetStyleColorVec4(ImGuiCol_Button);
+  button_color.w = 0.0F;
+  ImGui::PushStyleColor(ImGuiCol_Button, button_color);
+
+  ImGui::SetNextItemWidth(PATH_INPUT_WIDTH);
+  auto open_file = ImGui::InputText(
+      "##path", &path_input_, ImGuiInputTextFlags_EnterReturnsTrue);
+  ImGui::SameLine();
+  open_file |= ImGui::Button(ICON_MDI_FOLDER_OPEN " Open");
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("Open the log file");
+  }
+  if (open_file && !path_input_.empty()) {
+    Open(path_input_);
+  }
+
+  ImGui::SameLine();
+  if (LogToolbarToggle(ICON_MDI_ARROW_COLLAPSE_DOWN,
+          "Follow the lines appended to the file", follow_)) {
+    follow_ = !follow_;
+    scroll_to_bottom_ = follow_;
+  }
+
+  if (IsOpen()) {
+    ImGui::SameLine();
+    if (IsIndexing() && index_total_ != 0) {
+      // The lines indexed so far are already shown
+      ImGui::ProgressBar(
+          static_cast<float>(index_done_.load(std::memory_order_relaxed)) /
+              static_cast<float>(index_total_),
+          ImVec2(PROGRESS_WIDTH, 0), "Indexing...");
+      ImGui::SameLine();
+      ImGui::Text("%zu lines", LineCount());
+    } else {
+      ImGui::Text("%zu lines, %.1f MB", LineCount(),
+          static_cast<double>(mapped_size_) / BYTES_PER_MB);
+    }
+  }
+
+  // Restore the button color
+  ImGui::PopStyleColor();
+}
+
+void LogFileView::DrawLines() {
+  if (!IsOpen()) {
+    ImGui::TextDisabled("No log file opened");
+    return;
+  }
+
+  ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 1));
+  DrawVisibleRows(LineCount(), [this](std::size_t row) {
+    // Nothing past the size of the file seen this frame is read, in case it
+    // was truncated since it was mapped
+    const auto begin = std::min(line_starts_[row], file_size_);
+    auto end =
+        (row + 1 < line_starts_.size()) ? line_starts_[row + 1] : indexed_size_;
+    end = std::min(end, file_size_);
+    // Strip the line terminator
+    while (end > begin && (data_[end - 1] == '\n' || data_[end - 1] == '\r')) {
+      --end;
+    }
+    end = std::min(end, begin + MAX_DISPLAYED_LINE);
+    ImGui::TextUnformatted(data_ + begin, data_ + end);
+  });
+  ImGui::PopStyleVar();
+
+  if (follow_ && scroll_to_bottom_) {
+    ImGui::SetScrollHereY(1.0F);
+  }
+  scroll_to_bottom_ = false;
+}
+
+} // namespace asap::ui
@@ -0,0 +1,124 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <atomic>     // for the indexing progress
+#include <cstdint>    // for file offsets
+#include <filesystem> // for the file path
+#include <mutex>      // for handing the index over to the UI thread
+#include <string>     // for the path input
+#include <thread>     // for the indexing thread
+#include <vector>     // for the line index
+
+#include <logging/logging.h>
+
+namespace asap::ui {
+
+/*!
+ * \brief Viewer for (potentially very large) external log files, following
+ * appends to the file like `tail -f`.
+ *
+ * The file is memory mapped for drawing and its newline index is built in
+ * parallel chunks on a background thread, so that the viewer stays interactive
+ * while a large file is being indexed. Changes to the file are watched with
+ * inotify: appended lines are indexed incrementally, and a truncated, moved or
+ * deleted file (e.g. log rotation) is re-opened. Only the visible rows are
+ * rendered, and nothing past the size of the file checked at the start of the
+ * frame is read from the mapping.
+ *
+ * Memory mapping and inotify are only available on Linux, opening a file fails
+ * on other platforms.
+ */
+class LogFileView : asap::logging::Loggable<LogFileView> {
+public:
+  LogFileView() = default;
+
+  LogFileView(const LogFileView &) = delete;
+  LogFileView(LogFileView &&) = delete;
+  auto operator=(const LogFileView &) -> LogFileView & = delete;
+  auto operator=(LogFileView &&) -> LogFileView & = delete;
+
+  ~LogFileView();
+
+  auto Open(const std::filesystem::path &path) -> bool;
+  void Close();
+
+  [[nodiscard]] auto IsOpen() const -> bool {
+    return fd_ >= 0;
+  }
+
+  /// Number of lines indexed so far.
+  [[nodiscard]] auto LineCount() const -> std::size_t;
+
+  void Draw(const char *title = nullptr, bool *p_open = nullptr);
+
+  static const char *const LOGGER_NAME;
+
+private:
+  /// Index the newlines of the mapped bytes in [from, to) on a background
+  /// thread.
+  void StartIndexing(std::uint64_t from, std::uint64_t to);
+  /// Append the blocks indexed so far to the line index, a bounded number of
+  /// lines per frame.
+  void CollectIndex();
+  /// The indexing is running, or its result is not all in the line index yet.
+  [[nodiscard]] auto IsIndexing() const -> bool;
+  /// Process the pending inotify events.
+  void PollChanges();
+  /// Map more of the file if it has grown, re-open it if it was truncated.
+  void Refresh();
+  void Unmap();
+
+  void DrawToolbar();
+  void DrawLines();
+
+  std::filesystem::path path_;
+  int fd_{-1};
+  const char *data_{nullptr};
+  std::uint64_t mapped_size_{0};
+  /// Size of the file when last checked, the mapping is not read past it.
+  std::uint64_t file_size_{0};
+  /// The line index covers the bytes before this offset.
+  std::uint64_t indexed_size_{0};
+
+  int inotify_fd_{-1};
+  /// The file was modified while indexing, check its size again afterwards.
+  bool refresh_pending_{false};
+  /// The file was moved or deleted, re-open the path when possible.
+  bool reopen_pending_{false};
+
+  /// Offsets of the first character of each line. The last line may be
+  /// incomplete (no newline yet).
+  std::vector<std::uint64_t> line_starts_;
+
+  std::thread index_thread_;
+  std::atomic<bool> indexing_{false};
+  std::atomic<bool> index_cancel_{false};
+  std::atomic<std::uint64_t> index_done_{0};
+  std::uint64_t index_total_{0};
+  std::uint64_t index_from_{0};
+  std::uint64_t index_end_{0};
+  std::mutex index_mutex_;
+  /// Line starts found by the indexing, per block of the file, in order. Each
+  /// block is only touched by the UI thread once it is flagged ready.
+  std::vector<std::vector<std::uint64_t>> index_blocks_;
+  /// Blocks completely indexed, guarded by `index_mutex_`.
+  std::vector<bool> index_ready_;
+  /// Next block to append to the line index, and how much of it is appended.
+  std::size_t index_block_{0};
+  std::size_t index_block_offset_{0};
+
+  /// @name Viewer state
+  //@{
+  std::string path_input_;
+  bool follow_{true};
+  bool scroll_to_bottom_{false};
+  //@}
+};
+
+} // namespace asap::ui
@@ -6,7 +6,10 @@
 //   https://opensource.org/licenses/BSD-3-Clause)
 
 #include "ui/log/sink.h"
+#include "ui/log/viewer.h"
 #include "config/config.h"
+#include "config/config_store.h"
+#include "config/settings_writer.h"
 #include "ui/fonts/material_design_icons.h"
 #include "ui/style/theme.h"
 
@@ -16,9 +19,12 @@
 #include <toml++/toml.h>
 
 #include <contract/contract.h>
+#include <imgui/misc/cpp/imgui_stdlib.h>
 #include <logging/logging.h>
 
+#include <algorithm> // for std::min
 #include <array>
+#include <cstdio> // for snprintf
 #include <fstream>
 #include <sstream> // for log record formatting
 
@@ -34,9 +40,246 @@ const char *const ImGuiLogSink::LOGGER_NAME = "main";
 const ImVec4 ImGuiLogSink::COLOR_WARN{0.9F, 0.7F, 0.0F, 1.0F};
 const ImVec4 ImGuiLogSink::COLOR_ERROR{1.0F, 0.0F, 0.0F, 1.0F};
 
+namespace {
+
+/// Maximum number of records copied by the export under a single lock. This
+/// bounds both the time the lock is held and the memory used by the export.
+constexpr std::size_t EXPORT_CHUNK_SIZE = 256;
+
+/// Magic bytes at the start of a binary log export file. The last character is
+/// the format version.
+constexpr std::array<char, 8> EXPORT_BINARY_MAGIC{
+    'A', 'S', 'A', 'P', 'L', 'O', 'G', '1'};
+
+auto PassFilter(const ImGuiTextFilter &filter, const std::string &properties,
+    const std::string &source, const std::string &message) -> bool {
+  return !filter.IsActive() ||
+         filter.PassFilter(
+             properties.c_str(), properties.c_str() + properties.size()) ||
+         filter.PassFilter(source.c_str(), source.c_str() + source.size()) ||
+         filter.PassFilter(message.c_str(), message.c_str() + message.size());
+}
+
+/// The exported fields of a log record, referring to the export's copy.
+struct ExportRecord {
+  spdlog::log_clock::time_point time;
+  spdlog::level::level_enum level;
+  const std::string &properties;
+  const std::string &source;
+  const std::string &message;
+};
+
+void WriteJsonString(std::ostream &out, const std::string &str) {
+  out.put('"');
+  for (const auto chr : str) {
+    switch (chr) {
+    case '"':
+      out << R"(\")";
+      break;
+    case '\\':
+      out << R"(\\)";
+      break;
+    case '\n':
+      out << R"(\n)";
+      break;
+    case '\r':
+      out << R"(\r)";
+      break;
+    case '\t':
+      out << R"(\t)";
+      break;
+    default:
+      if (static_cast<unsigned char>(chr) < 0x20) {
+        std::array<char, 7> escaped{};
+        std::snprintf(escaped.data(), escaped.size(), "\\u%04x",
+            static_cast<unsigned int>(chr));
+        out << escaped.data();
+      } else {
+        out.put(chr);
+      }
+    }
+  }
+  out.put('"');
+}
+
+template <typename T> void WriteBinaryValue(std::ostream &out, T value) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void WriteBinaryString(std::ostream &out, const std::string &str) {
+  WriteBinaryValue(out, static_cast<std::uint32_t>(str.size()));
+  out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+void WriteExportRecord(std::ostream &out, ImGuiLogSink::ExportFormat format,
+    const ExportRecord &record) {
+  switch (format) {
+  case ImGuiLogSink::ExportFormat::TEXT:
+    out << record.properties << record.message << '\n';
+    break;
+
+  case ImGuiLogSink::ExportFormat::JSONL:
+    out << R"({"time":")" << date::format("%FT%TZ", record.time)
+        << R"(","level":")"
+        << spdlog::level::to_string_view(record.level).data()
+        << R"(","properties":)";
+    WriteJsonString(out, record.properties);
+    out << R"(,"source":)";
+    WriteJsonString(out, record.source);
+    out << R"(,"message":)";
+    WriteJsonString(out, record.message);
+    out << "}\n";
+    break;
+
+  case ImGuiLogSink::ExportFormat::BINARY:
+    WriteBinaryValue(out,
+        static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                record.time.time_since_epoch())
+                .count()));
+    WriteBinaryValue(out, static_cast<std::uint8_t>(record.level));
+    WriteBinaryString(out, record.properties);
+    WriteBinaryString(out, record.source);
+    WriteBinaryString(out, record.message);
+    break;
+  }
+}
+
+} // namespace
+
+ImGuiLogSink::~ImGuiLogSink() {
+  CancelExport();
+  if (export_thread_.joinable()) {
+    export_thread_.join();
+  }
+}
+
 void ImGuiLogSink::Clear() {
   std::unique_lock<std::shared_timed_mutex> lock(records_mutex_);
   records_.clear();
+  ++records_generation_;
+}
+
+void ImGuiLogSink::SetDisplayFilter(const std::string &filter) {
+  std::snprintf(display_filter_.InputBuf, sizeof(display_filter_.InputBuf),
+      "%s", filter.c_str());
+  display_filter_.Build();
+}
+
+auto ImGuiLogSink::StartExport(std::filesystem::path path, ExportFormat format,
+    bool filtered_only) -> bool {
+  if (export_running_.exchange(true, std::memory_order_acq_rel)) {
+    ASLOG(warn, "a log export is already running");
+    return false;
+  }
+  // The previous export thread, if any, has already finished its work.
+  if (export_thread_.joinable()) {
+    export_thread_.join();
+  }
+
+  std::size_t total = 0;
+  std::uint64_t generation = 0;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(records_mutex_);
+    total = records_.size();
+    generation = records_generation_;
+  }
+  export_cancel_.store(false, std::memory_order_relaxed);
+  export_done_.store(0, std::memory_order_relaxed);
+  export_total_.store(total, std::memory_order_relaxed);
+
+  // The display filter is only used from the UI thread. Pass its text to the
+  // export thread, which builds its own filter from it.
+  auto filter = filtered_only ? std::string(display_filter_.InputBuf)
+                              : std::string();
+
+  ASLOG(info, "exporting {} log records to {}", total, path.string());
+  export_thread_ = std::thread(
+      [this, path = std::move(path), format, filter = std::move(filter), total,
+          generation]() { RunExport(path, format, filter, total, generation); });
+  return true;
+}
+
+void ImGuiLogSink::CancelExport() {
+  export_cancel_.store(true, std::memory_order_relaxed);
+}
+
+auto ImGuiLogSink::ExportProgress() const -> float {
+  auto total = export_total_.load(std::memory_order_relaxed);
+  if (total == 0) {
+    return 1.0F;
+  }
+  return static_cast<float>(export_done_.load(std::memory_order_relaxed)) /
+         static_cast<float>(total);
+}
+
+void ImGuiLogSink::RunExport(const std::filesystem::path &path,
+    ExportFormat format, const std::string &filter, std::size_t total,
+    std::uint64_t generation) {
+  auto ofs = std::ofstream(path, std::ios::out | std::ios::trunc |
+                                     (format == ExportFormat::BINARY
+                                             ? std::ios::binary
+                                             : std::ios::openmode{}));
+  if (!ofs) {
+    ASLOG(error, "could not open {} for the log export", path.string());
+    export_running_.store(false, std::memory_order_release);
+    return;
+  }
+  if (format == ExportFormat::BINARY) {
+    ofs.write(EXPORT_BINARY_MAGIC.data(), EXPORT_BINARY_MAGIC.size());
+  }
+
+  ImGuiTextFilter text_filter(filter.c_str());
+  // Copied into under the lock, reusing the capacity of the strings of the
+  // previous chunk, so that the copy is mostly a memcpy
+  std::vector<LogRecord> chunk;
+  chunk.reserve(EXPORT_CHUNK_SIZE);
+  std::size_t position = 0;
+  std::size_t exported = 0;
+  auto truncated = false;
+
+  while (position < total && !export_cancel_.load(std::memory_order_relaxed)) {
+    {
+      // Only copy the records, logging waits for the lock
+      std::shared_lock<std::shared_timed_mutex> lock(records_mutex_);
+      if (records_generation_ != generation) {
+        truncated = true;
+        break;
+      }
+      const auto end = std::min(position + EXPORT_CHUNK_SIZE, total);
+      chunk.assign(records_.begin() + static_cast<std::ptrdiff_t>(position),
+          records_.begin() + static_cast<std::ptrdiff_t>(end));
+      position = end;
+    }
+    // Filter and write without holding the records lock
+    for (const auto &record : chunk) {
+      if (PassFilter(text_filter, record.properties_, record.source_,
+              record.message_)) {
+        WriteExportRecord(ofs, format,
+            ExportRecord{record.time_, record.level_, record.properties_,
+                record.source_, record.message_});
+        ++exported;
+      }
+    }
+    export_done_.store(position, std::memory_order_relaxed);
+  }
+  ofs.close();
+
+  if (!ofs) {
+    ASLOG(error, "error while writing the log export to {}", path.string());
+  } else if (truncated) {
+    ASLOG(warn, "logs were cleared during the export, {} truncated after {} "
+                "records",
+        path.string(), exported);
+  } else if (export_cancel_.load(std::memory_order_relaxed)) {
+    ASLOG(info, "log export to {} cancelled after {} records", path.string(),
+        exported);
+  } else {
+    ASLOG(info, "exported {} log records to {}", exported, path.string());
+  }
+  export_done_.store(total, std::memory_order_relaxed);
+  export_running_.store(false, std::memory_order_release);
 }
 
 void ImGuiLogSink::ShowLogLevelsPopup() {
@@ -68,6 +311,103 @@ void ImGuiLogSink::ShowLogFormatPopup() {
   ImGui::Checkbox("Logger", &show_logger_);
 }
 
+void ImGuiLogSink::ShowLogExportPopup() {
+  ImGui::MenuItem("Export Logs", nullptr, false, false);
+
+  static const std::array<const char *, 3> format_items{
+      "Text", "JSON Lines", "Binary"};
+  ImGui::Combo("Format", &export_format_, format_items.data(),
+      static_cast<int>(format_items.size()));
+  ImGui::InputText("File", &export_path_);
+  ImGui::Checkbox("Filtered view only", &export_filtered_only_);
+
+  if (IsExporting()) {
+    ImGui::ProgressBar(ExportProgress());
+    if (ImGui::Button("Cancel")) {
+      CancelExport();
+    }
+  } else if (ImGui::Button("Export")) {
+    StartExport(export_path_, static_cast<ExportFormat>(export_format_),
+        export_filtered_only_);
+    ImGui::CloseCurrentPopup();
+  }
+}
+
+auto ImGuiLogSink::LevelColor(spdlog::level::level_enum level)
+    -> const ImVec4 & {
+  switch (level) {
+  case spdlog::level::trace:
+    return ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
+  case spdlog::level::info:
+    return ImGui::GetStyleColorVec4(ImGuiCol_NavHighlight);
+  case spdlog::level::warn:
+    return COLOR_WARN;
+  case spdlog::level::err:
+  case spdlog::level::critical:
+    return COLOR_ERROR;
+  default:
+    return ImGui::GetStyleColorVec4(ImGuiCol_Text);
+  }
+}
+
+void ImGuiLogSink::DrawRecord(const LogRecord &record) const {
+  const auto &color = LevelColor(record.level_);
+  ImGui::BeginGroup();
+
+  if (record.color_range_start_ > 0) {
+    auto props_len = record.properties_.size();
+
+    std::string part = record.properties_.substr(0, record.color_range_start_);
+    ImGui::TextUnformatted(part.c_str());
+    ImGui::SameLine();
+
+    part = record.properties_.substr(record.color_range_start_,
+        record.color_range_end_ - record.color_range_start_);
+    ImGui::TextColored(color, "%s", part.c_str());
+
+    part = record.properties_.substr(
+        record.color_range_end_, props_len - record.color_range_end_);
+    ImGui::SameLine();
+    ImGui::TextUnformatted(part.c_str());
+
+  } else {
+    if (record.color_range_end_ == 1) {
+      ImGui::TextColored(color, "%s", record.properties_.c_str());
+    } else {
+      ImGui::TextUnformatted(record.properties_.c_str());
+    }
+  }
+
+  if (record.color_range_end_ == 1) {
+    ImGui::SameLine();
+    if (wrap_) {
+      ImGui::PushTextWrapPos(0.0F);
+    }
+    ImGui::TextColored(color, "%s", record.message_.c_str());
+    if (wrap_) {
+      ImGui::PopTextWrapPos();
+    }
+  } else {
+    ImGui::SameLine();
+    if (wrap_) {
+      ImGui::PushTextWrapPos(0.0F);
+    }
+    ImGui::TextUnformatted(record.message_.c_str());
+    if (wrap_) {
+      ImGui::PopTextWrapPos();
+    }
+  }
+  ImGui::EndGroup();
+#ifndef NDEBUG
+  // We only show the tooltip with the source location if in debug build.
+  // The source location information is not produced in the logs in
+  // non-debug builds.
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("%s", record.source_.c_str());
+  }
+#endif // NDEBUG
+}
+
 void ImGuiLogSink::Draw(const char *title, bool *open) {
   ImGui::SetNextWindowSize(ImVec2(500, 400), ImGuiCond_FirstUseEver);
 
@@ -122,6 +462,18 @@ void ImGuiLogSink::Draw(const char *title, bool *open) {
       ImGui::EndPopup();
     }
 
+    ImGui::SameLine();
+    if (ImGui::Button(ICON_MDI_EXPORT " Export")) {
+      ImGui::OpenPopup("LogExportPopup");
+    }
+    if (ImGui::IsItemHovered()) {
+      ImGui::SetTooltip("Save the messages to a file");
+    }
+    if (ImGui::BeginPopup("LogExportPopup")) {
+      ShowLogExportPopup();
+      ImGui::EndPopup();
+    }
+
     ImGui::SameLine();
     if (ImGui::Button(ICON_MDI_NOTIFICATION_CLEAR_ALL " Clear")) {
       Clear();
@@ -131,44 +483,15 @@ void ImGuiLogSink::Draw(const char *title, bool *open) {
     }
 
     ImGui::SameLine();
-    bool need_pop_style_var = false;
-    if (wrap_) {
-      // Highlight the button
-      ImGui::PushStyleVar(ImGuiStyleVar_FrameBorderSize, 2.0F);
-      ImGui::PushStyleColor(
-          ImGuiCol_Border, ImGui::GetStyleColorVec4(ImGuiCol_TextSelectedBg));
-      need_pop_style_var = true;
-    }
-    if (ImGui::Button(ICON_MDI_WRAP)) {
+    if (LogToolbarToggle(ICON_MDI_WRAP, "Toggle soft wraps", wrap_)) {
       ToggleWrap();
     }
-    if (ImGui::IsItemHovered()) {
-      ImGui::SetTooltip("Toggle soft wraps");
-    }
-    if (need_pop_style_var) {
-      ImGui::PopStyleColor();
-      ImGui::PopStyleVar();
-    }
 
     ImGui::SameLine();
-    need_pop_style_var = false;
-    if (scroll_lock_) {
-      // Highlight the button
-      ImGui::PushStyleVar(ImGuiStyleVar_FrameBorderSize, 2.0F);
-      ImGui::PushStyleColor(
-          ImGuiCol_Border, ImGui::GetStyleColorVec4(ImGuiCol_TextSelectedBg));
-      need_pop_style_var = true;
-    }
-    if (ImGui::Button(ICON_MDI_LOCK)) {
+    if (LogToolbarToggle(ICON_MDI_LOCK,
+            "Toggle automatic scrolling to the bottom", scroll_lock_)) {
       ToggleScrollLock();
     }
-    if (ImGui::IsItemHovered()) {
-      ImGui::SetTooltip("Toggle automatic scrolling to the bottom");
-    }
-    if (need_pop_style_var) {
-      ImGui::PopStyleColor();
-      ImGui::PopStyleVar();
-    }
 
     ImGui::SameLine();
     display_filter_.Draw(ICON_MDI_FILTER " Filter", -100.0F);
@@ -188,70 +511,29 @@ void ImGuiLogSink::Draw(const char *title, bool *open) {
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 1));
 
     std::shared_lock<std::shared_timed_mutex> lock(records_mutex_);
-    for (auto const &record : records_) {
-      if (!display_filter_.IsActive() ||
-          display_filter_.PassFilter(record.properties_.c_str(),
-              record.properties_.c_str() + record.properties_.size()) ||
-          display_filter_.PassFilter(record.source_.c_str(),
-              record.source_.c_str() + record.source_.size()) ||
-          display_filter_.PassFilter(record.message_.c_str(),
-              record.message_.c_str() + record.message_.size())) {
-        ImGui::BeginGroup();
-
-        if (record.color_range_start_ > 0) {
-          auto props_len = record.properties_.size();
-
-          std::string part =
-              record.properties_.substr(0, record.color_range_start_);
-          ImGui::TextUnformatted(part.c_str());
-          ImGui::SameLine();
-
-          part = record.properties_.substr(record.color_range_start_,
-              record.color_range_end_ - record.color_range_start_);
-          ImGui::TextColored(record.color_, "%s", part.c_str());
-
-          part = record.properties_.substr(
-              record.color_range_end_, props_len - record.color_range_end_);
-          ImGui::SameLine();
-          ImGui::TextUnformatted(part.c_str());
-
-        } else {
-          if (record.color_range_end_ == 1) {
-            ImGui::TextColored(record.color_, "%s", record.properties_.c_str());
-          } else {
-            ImGui::TextUnformatted(record.properties_.c_str());
-          }
-        }
-
-        if (record.color_range_end_ == 1) {
-          ImGui::SameLine();
-          if (wrap_) {
-            ImGui::PushTextWrapPos(0.0F);
-          }
-          ImGui::TextColored(record.color_, "%s", record.message_.c_str());
-          if (wrap_) {
-            ImGui::PopTextWrapPos();
-          }
-        } else {
-          ImGui::SameLine();
-          if (wrap_) {
-            ImGui::PushTextWrapPos(0.0F);
-          }
-          ImGui::TextUnformatted(record.message_.c_str());
-          if (wrap_) {
-            ImGui::PopTextWrapPos();
-          }
+    if (wrap_) {
+      // Wrapped records have different heights, draw all of them
+      for (auto const &record : records_) {
+        if (PassFilter(display_filter_, record.properties_, record.source_,
+                record.message_)) {
+          DrawRecord(record);
         }
-        ImGui::EndGroup();
-#ifndef NDEBUG
-        // We only show the tooltip with the source location if in debug build.
-        // The source location information is not produced in the logs in
-        // non-debug builds.
-        if (ImGui::IsItemHovered()) {
-          ImGui::SetTooltip("%s", record.source_.c_str());
+      }
+    } else if (display_filter_.IsActive()) {
+      filtered_records_.clear();
+      for (std::size_t index = 0; index < records_.size(); ++index) {
+        auto const &record = records_[index];
+        if (PassFilter(display_filter_, record.properties_, record.source_,
+                record.message_)) {
+          filtered_records_.push_back(index);
         }
-#endif // NDEBUG
       }
+      DrawVisibleRows(filtered_records_.size(), [this](std::size_t row) {
+        DrawRecord(records_[filtered_records_[row]]);
+      });
+    } else {
+      DrawVisibleRows(records_.size(),
+          [this](std::size_t row) { DrawRecord(records_[row]); });
     }
   }
   ImGui::PopStyleVar();
@@ -272,7 +554,6 @@ void ImGuiLogSink::sink_it_(const spdlog::details::log_msg &msg) {
   auto ostr = std::ostringstream();
   std::size_t color_range_start = 0;
   std::size_t color_range_end = 0;
-  ImVec4 const *color = nullptr;
   auto emphasis = false;
 
   if (show_time_) {
@@ -326,41 +607,28 @@ void ImGuiLogSink::sink_it_(const spdlog::details::log_msg &msg) {
 #else
   auto source = std::string();
 #endif // NDEBUG
-  // Select display color and colored text range based on level
+  // Select the colored text range based on level, the color itself is taken
+  // from the style when drawing (see LevelColor())
   switch (msg.level) {
   case spdlog::level::trace:
-    color = &ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
     // the entire message
     color_range_start = 0;
     color_range_end = 1;
     break;
 
   case spdlog::level::debug:
-    color = &ImGui::GetStyleColorVec4(ImGuiCol_Text);
-    // The level part if show, otherwise no coloring
-    break;
-
   case spdlog::level::info:
-    color = &ImGui::GetStyleColorVec4(ImGuiCol_NavHighlight);
     // The level part if show, otherwise no coloring
     break;
 
   case spdlog::level::warn:
-    color = &COLOR_WARN;
-    // the entire message
-    color_range_start = 0;
-    color_range_end = 1;
-    break;
-
   case spdlog::level::err:
-    color = &COLOR_ERROR;
     // the entire message
     color_range_start = 0;
     color_range_end = 1;
     break;
 
   case spdlog::level::critical:
-    color = &COLOR_ERROR;
     emphasis = true;
     // the entire message
     color_range_start = 0;
@@ -374,7 +642,7 @@ void ImGuiLogSink::sink_it_(const spdlog::details::log_msg &msg) {
 
   auto record =
       LogRecord{properties, source, msg_str.substr(skip_to - msg_str.begin()),
-          color_range_start, color_range_end, *color, emphasis};
+          color_range_start, color_range_end, emphasis, msg.level, msg.time};
   {
     std::unique_lock<std::shared_timed_mutex> lock(records_mutex_);
     records_.push_back(std::move(record));
@@ -386,28 +654,57 @@ void ImGuiLogSink::flush_() {
   // Your code here
 }
 
+namespace {
+
+auto LogLevelsFrom(const toml::table &config) -> ImGuiLogSink::LogLevels {
+  ImGuiLogSink::LogLevels levels;
+  const toml::array *loggers;
+  if (config["loggers"] &&
+      (loggers = config["loggers"].as_array()) != nullptr) {
+
+    for (auto &item : *loggers) {
+      auto settings = *item.as_table();
+      auto name = settings["name"].value<std::string>().value();
+      auto level = settings["level"].value<int>().value();
+      levels.emplace_back(
+          std::move(name), static_cast<spdlog::level::level_enum>(level));
+    }
+  }
+  return levels;
+}
+
+} // namespace
+
+auto ImGuiLogSink::ReadLogLevels(const std::filesystem::path &file)
+    -> LogLevels {
+  return LogLevelsFrom(asap::config::ConfigStore::Parse(file));
+}
+
+void ImGuiLogSink::ApplyLogLevels(const LogLevels &levels) {
+  for (const auto &[name, level] : levels) {
+    auto &logger = asap::logging::Registry::GetLogger(name);
+    if (logger.level() != level) {
+      logger.set_level(level);
+      ASLOG(info, "logger '{}' level changed to {}", name,
+          spdlog::level::to_string_view(level));
+    }
+  }
+}
+
 void ImGuiLogSink::LoadSettings() {
-  auto log_settings =
-      asap::config::GetPathFor(asap::config::Location::F_LOG_SETTINGS);
-  if (!std::filesystem::exists(log_settings)) {
-    ASLOG(info, "file {} does not exist", log_settings.string());
+  // Usually parsed in the background during the startup
+  auto &store = asap::config::ConfigStore::Default();
+  if (!store.Contains(asap::config::Location::F_LOG_SETTINGS)) {
     return;
   }
+  const auto &log_settings =
+      asap::config::GetPathFor(asap::config::Location::F_LOG_SETTINGS);
   try {
-    auto config = toml::parse_file(log_settings.string());
+    const auto &config = store.Table(asap::config::Location::F_LOG_SETTINGS);
     ASLOG(info, "settings loaded from {}", log_settings.string());
 
-    toml::array *loggers;
-    if (config["loggers"] &&
-        (loggers = config["loggers"].as_array()) != nullptr) {
-
-      for (auto &item : *loggers) {
-        auto settings = *item.as_table();
-        auto name = settings["name"].value<std::string>().value();
-        auto level = settings["level"].value<int>().value();
-        auto &logger = asap::logging::Registry::GetLogger(name);
-        logger.set_level(static_cast<spdlog::level::level_enum>(level));
-      }
+    for (const auto &[name, level] : LogLevelsFrom(config)) {
+      asap::logging::Registry::GetLogger(name).set_level(level);
     }
 
     auto format = config["format"];
@@ -426,6 +723,46 @@ void ImGuiLogSink::LoadSettings() {
       }
     }
 
+    // Out of range values are brought back in range rather than rejected
+    const auto clamped = [](const char *name, std::int64_t value,
+                             std::size_t min, std::size_t max) {
+      const auto result = static_cast<std::size_t>(std::clamp<std::int64_t>(
+          value, static_cast<std::int64_t>(min),
+          static_cast<std::int64_t>(max)));
+      if (static_cast<std::int64_t>(result) != value) {
+        ASLOG(warn, "async logging {} {} is out of range [{}, {}], using {}",
+            name, value, min, max, result);
+      }
+      return result;
+    };
+    auto async = config["async"];
+    if (async) {
+      if (async["enabled"]) {
+        async_settings_.enabled = async["enabled"].value<bool>().value();
+      }
+      if (async["queue-size"]) {
+        async_settings_.queue_size = clamped("queue-size",
+            async["queue-size"].value<int64_t>().value(),
+            asap::logging::AsyncSettings::MIN_QUEUE_SIZE,
+            asap::logging::AsyncSettings::MAX_QUEUE_SIZE);
+      }
+      if (async["workers"]) {
+        async_settings_.workers = clamped("workers",
+            async["workers"].value<int64_t>().value(), 1,
+            std::max(std::thread::hardware_concurrency(), 1U));
+      }
+      if (async["overflow-policy"]) {
+        auto name = async["overflow-policy"].value<std::string>().value();
+        auto policy = asap::logging::OverflowPolicyFromString(name);
+        if (policy) {
+          async_settings_.overflow_policy = policy.value();
+        } else {
+          ASLOG(warn, "unknown log queue overflow policy '{}', using '{}'",
+              name, asap::logging::ToString(async_settings_.overflow_policy));
+        }
+      }
+    }
+
     if (format["scroll-lock"]) {
       scroll_lock_ = format["scroll-lock"].value<bool>().value();
     }
@@ -438,7 +775,8 @@ void ImGuiLogSink::LoadSettings() {
   }
 }
 
-void ImGuiLogSink::SaveSettings() {
+void ImGuiLogSink::SaveSettings(
+    asap::config::SettingsWriter::Capture capture) {
   toml::array loggers;
 
   for (auto &log : logging::Registry::Loggers()) {
@@ -460,15 +798,26 @@ void ImGuiLogSink::SaveSettings() {
           }},
       {"scroll-lock", scroll_lock_},
       {"soft-wrap", wrap_},
+      {"async",
+          toml::table{
+              {"enabled", async_settings_.enabled},
+              {"queue-size",
+                  static_cast<int64_t>(async_settings_.queue_size)},
+              {"workers", static_cast<int64_t>(async_settings_.workers)},
+              {"overflow-policy",
+                  asap::logging::ToString(async_settings_.overflow_policy)},
+          }},
   };
 
-  auto settings_path =
-      asap::config::GetPathFor(asap::config::Location::F_LOG_SETTINGS);
-  auto ofs = std::ofstream();
-  ofs.open(settings_path.string());
-  ofs << "# Logging configuration (toml 0.5.1)" << std::endl;
-  ofs << root << std::endl;
-  ofs.close();
+  // Serialized and written in the background
+  asap::config::SettingsWriter::Default().Write(
+      asap::config::Location::F_LOG_SETTINGS, [root = std::move(root)]() {
+        std::ostringstream contents;
+        contents << "# Logging configuration (toml 0.5.1)" << std::endl;
+        contents << root << std::endl;
+        return contents.str();
+      },
+      capture);
 }
 
 } // namespace asap::ui
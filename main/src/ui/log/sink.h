@@ -7,7 +7,14 @@
 
 #pragma once
 
+#include <atomic>       // for the export progress counters
+#include <chrono>       // for the record timestamps
+#include <cstdint>      // for the records generation counter
+#include <filesystem>   // for the export file path
 #include <shared_mutex> // for locking the records vector
+#include <string>       // for the record strings
+#include <thread>       // for the export worker thread
+#include <utility>      // for the logger levels
 #include <vector>       // for the records vector
 
 #include <spdlog/sinks/sink.h>
@@ -16,30 +23,102 @@
 #include <imgui/imgui.h>
 #include <logging/logging.h>
 
+#include "config/settings_writer.h"
+#include "logging/async_sink.h"
+
 namespace asap::ui {
 
 class ImGuiLogSink : public spdlog::sinks::base_sink<std::mutex>,
                      asap::logging::Loggable<ImGuiLogSink> {
 public:
+  /// Output formats supported by the log export.
+  enum class ExportFormat {
+    /// One line per record, exactly as displayed in the log view.
+    TEXT,
+    /// One JSON object per line with the record fields.
+    JSONL,
+    /// Length prefixed binary records, preceded by a small file header.
+    BINARY
+  };
+
+  ImGuiLogSink() = default;
+  ~ImGuiLogSink() override;
+
+  ImGuiLogSink(const ImGuiLogSink &) = delete;
+  ImGuiLogSink(ImGuiLogSink &&) = delete;
+  auto operator=(const ImGuiLogSink &) -> ImGuiLogSink & = delete;
+  auto operator=(ImGuiLogSink &&) -> ImGuiLogSink & = delete;
+
   void Clear();
 
+  /*!
+   * \brief Start exporting the log records to the file at `path` on a
+   * background thread.
+   *
+   * Records are copied out of the store in small chunks, each under a short
+   * shared lock, and written without holding any lock, so that ingestion and
+   * drawing continue unaffected while the export is running. When
+   * `filtered_only` is true, only the records passing the current display
+   * filter are exported.
+   *
+   * \return false if an export is already running.
+   */
+  auto StartExport(std::filesystem::path path, ExportFormat format,
+      bool filtered_only) -> bool;
+
+  /// Request the running export, if any, to stop as soon as possible.
+  void CancelExport();
+
+  [[nodiscard]] auto IsExporting() const -> bool {
+    return export_running_.load(std::memory_order_acquire);
+  }
+
+  /// Fraction, in [0, 1], of the records processed by the running export.
+  [[nodiscard]] auto ExportProgress() const -> float;
+
   static void ShowLogLevelsPopup();
 
   void ShowLogFormatPopup();
 
+  void ShowLogExportPopup();
+
   void ToggleWrap() {
     wrap_ = !wrap_;
   }
+  [[nodiscard]] auto IsWrapEnabled() const -> bool {
+    return wrap_;
+  }
 
   void ToggleScrollLock() {
     scroll_lock_ = !scroll_lock_;
   }
 
+  /// Set the display filter as if `filter` was typed in the filter box.
+  void SetDisplayFilter(const std::string &filter);
+
   // TODO(Abdessattar) refactor this ugly interface to not use pointer for open
   void Draw(const char *title = nullptr, bool *p_open = nullptr);
 
   void LoadSettings();
-  void SaveSettings();
+  void SaveSettings(asap::config::SettingsWriter::Capture capture =
+                        asap::config::SettingsWriter::Capture::SAVE);
+
+  /// Level of each logger, by logger name.
+  using LogLevels =
+      std::vector<std::pair<std::string, spdlog::level::level_enum>>;
+
+  /// Read the logger levels from the logging settings in `file`. Can be
+  /// called from any thread; throws if the settings can't be parsed.
+  static auto ReadLogLevels(const std::filesystem::path &file) -> LogLevels;
+
+  /// Set the level of the loggers whose level differs in `levels`.
+  static void ApplyLogLevels(const LogLevels &levels);
+
+  /// Asynchronous logging settings, as loaded by LoadSettings().
+  [[nodiscard]] auto AsyncLogging() const
+      -> const asap::logging::AsyncSettings & {
+    return async_settings_;
+  }
 
   static const char *const LOGGER_NAME;
 
@@ -58,13 +137,40 @@ private:
     std::string message_;
     std::size_t color_range_start_{0};
     std::size_t color_range_end_{0};
-    const ImVec4 &color_;
     bool emphasis_{false};
+    spdlog::level::level_enum level_{spdlog::level::off};
+    spdlog::log_clock::time_point time_;
   };
+  void DrawRecord(const LogRecord &record) const;
+  /// The color of the records of a level, from the style when drawing, as
+  /// records come from any thread.
+  static auto LevelColor(spdlog::level::level_enum level) -> const ImVec4 &;
+
   std::vector<LogRecord> records_;
+  /// Indices of the records passing the display filter, rebuilt every frame.
+  std::vector<std::size_t> filtered_records_;
   mutable std::shared_timed_mutex records_mutex_;
+  /// Incremented every time the records are cleared, so that a running export
+  /// can detect that its read position is no longer valid.
+  std::uint64_t records_generation_{0};
   ImGuiTextFilter display_filter_;
 
+  void RunExport(const std::filesystem::path &path, ExportFormat format,
+      const std::string &filter, std::size_t total, std::uint64_t generation);
+
+  std::thread export_thread_;
+  std::atomic<bool> export_running_{false};
+  std::atomic<bool> export_cancel_{false};
+  std::atomic<std::size_t> export_done_{0};
+  std::atomic<std::size_t> export_total_{0};
+
+  /// @name Export popup state
+  //@{
+  std::string export_path_{"logs.txt"};
+  int export_format_{0};
+  bool export_filtered_only_{false};
+  //@}
+
   bool scroll_to_bottom_;
   bool wrap_{false};
   bool scroll_lock_{false};
@@ -76,6 +182,8 @@ private:
   bool show_level_{true};
   bool show_logger_{true};
   //@}
+
+  asap::logging::AsyncSettings async_settings_;
 };
 
 } // namespace asap::ui
@@ -0,0 +1,31 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/log/viewer.h"
+
+namespace asap::ui {
+
+auto LogToolbarToggle(const char *label, const char *tooltip, bool active)
+    -> bool {
+  if (active) {
+    // Highlight the button
+    ImGui::PushStyleVar(ImGuiStyleVar_FrameBorderSize, 2.0F);
+    ImGui::PushStyleColor(
+        ImGuiCol_Border, ImGui::GetStyleColorVec4(ImGuiCol_TextSelectedBg));
+  }
+  const auto clicked = ImGui::Button(label);
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("%s", tooltip);
+  }
+  if (active) {
+    ImGui::PopStyleColor();
+    ImGui::PopStyleVar();
+  }
+  return clicked;
+}
+
+} // namespace asap::ui
@@ -0,0 +1,50 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+/*!
+ * \file
+ *
+ * \brief Building blocks shared by the log viewers (in-process log records and
+ * log files).
+ */
+
+#pragma once
+
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+namespace asap::ui {
+
+/*!
+ * \brief Toolbar button for a toggle, highlighted with a border when `active`.
+ *
+ * Must be called between the push and the pop of the transparent button color
+ * of the toolbar. Return true when the button was clicked.
+ */
+auto LogToolbarToggle(const char *label, const char *tooltip, bool active)
+    -> bool;
+
+/*!
+ * \brief Draw `count` rows of the same height, calling `draw_row(index)` only
+ * for the rows visible in the current window.
+ */
+template <typename DrawRow>
+void DrawVisibleRows(std::size_t count, DrawRow &&draw_row) {
+  ImGuiListClipper clipper;
+  clipper.Begin(static_cast<int>(std::min<std::size_t>(count, INT_MAX)));
+  while (clipper.Step()) {
+    for (auto row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+      draw_row(static_cast<std::size_t>(row));
+    }
+  }
+  clipper.End();
+}
+
+} // namespace asap::ui
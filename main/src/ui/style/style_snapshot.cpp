@@ -0,0 +1,193 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/style/style_snapshot.h"
+#include "config/config.h"
+
+#include <array>       // for the file magic
+#include <cstdint>     // for the fixed size fields
+#include <cstring>     // for memcpy
+#include <fstream>     // for reading and writing the files
+#include <iterator>    // for istreambuf_iterator
+#include <optional>    // for the source stamp
+#include <string>      // for the source contents
+#include <type_traits> // for is_trivially_copyable
+
+namespace asap::ui {
+
+const char *const StyleSnapshot::LOGGER_NAME = "main";
+
+namespace {
+
+/// Change when the layout of the snapshot file changes.
+constexpr std::uint32_t SNAPSHOT_FORMAT_VERSION = 1;
+
+constexpr std::array<char, 8> SNAPSHOT_MAGIC{
+    'A', 'S', 'A', 'P', 'T', 'H', 'M', '1'};
+
+static_assert(std::is_trivially_copyable_v<ImGuiStyle>,
+    "the style is saved as is in the snapshot");
+
+/// Identifies the contents of the TOML file the style was loaded from.
+struct SourceStamp {
+  std::int64_t mtime;
+  std::uint64_t size;
+  std::uint64_t hash;
+};
+
+struct SnapshotHeader {
+  std::array<char, 8> magic;
+  std::uint32_t format_version;
+  std::uint32_t imgui_version;
+  std::uint32_t style_size;
+  std::uint32_t reserved;
+  SourceStamp source;
+};
+
+/// A snapshot file: the header, directly followed by the style.
+struct SnapshotFile {
+  SnapshotHeader header;
+  ImGuiStyle style;
+};
+
+/// 64-bit FNV-1a, good enough to detect changes in the TOML file.
+auto Hash(const std::string &data) -> std::uint64_t {
+  constexpr std::uint64_t PRIME = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto byte : data) {
+    hash ^= static_cast<unsigned char>(byte);
+    hash *= PRIME;
+  }
+  return hash;
+}
+
+/// Modification time and size of the source, without reading it.
+auto StatSource(const std::filesystem::path &source)
+    -> std::optional<SourceStamp> {
+  std::error_code error;
+  const auto mtime = std::filesystem::last_write_time(source, error);
+  if (error) {
+    return std::nullopt;
+  }
+  const auto size = std::filesystem::file_size(source, error);
+  if (error) {
+    return std::nullopt;
+  }
+  return SourceStamp{
+      static_cast<std::int64_t>(mtime.time_since_epoch().count()), size, 0};
+}
+
+auto HashSource(const std::filesystem::path &source)
+    -> std::optional<std::uint64_t> {
+  std::ifstream in(source, std::ios::binary);
+  if (!in) {
+    return std::nullopt;
+  }
+  const std::string contents(
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>{});
+  return Hash(contents);
+}
+
+} // namespace
+
+auto StyleSnapshot::Load(const std::filesystem::path &source, ImGuiStyle &style)
+    -> bool {
+  const auto stamp = StatSource(source);
+  if (!stamp) {
+    return false;
+  }
+
+  const auto path =
+      asap::config::GetPathFor(asap::config::Location::F_THEME_SNAPSHOT);
+  SnapshotFile snapshot{};
+  {
+    std::ifstream in(path, std::ios::binary);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!in.read(reinterpret_cast<char *>(&snapshot), sizeof(snapshot))) {
+      return false;
+    }
+  }
+  const auto &header = snapshot.header;
+  if (header.magic != SNAPSHOT_MAGIC ||
+      header.format_version != SNAPSHOT_FORMAT_VERSION ||
+      header.imgui_version != IMGUI_VERSION_NUM ||
+      header.style_size != sizeof(ImGuiStyle) ||
+      header.source.mtime != stamp->mtime ||
+      header.source.size != stamp->size) {
+    ASLOG(debug, "theme snapshot {} is out of date", path.string());
+    return false;
+  }
+  // The modification time may have a coarse resolution, make sure the
+  // contents did not change
+  const auto hash = HashSource(source);
+  if (!hash || *hash != header.source.hash) {
+    ASLOG(debug, "theme snapshot {} is out of date", path.string());
+    return false;
+  }
+
+  std::memcpy(&style, &snapshot.style, sizeof(ImGuiStyle));
+  return true;
+}
+
+auto StyleSnapshot::Save(const std::filesystem::path &source,
+    std::filesystem::file_time_type modified, const ImGuiStyle &style)
+    -> bool {
+  // Hashed first: if the file is still unchanged afterwards, the hash is the
+  // one of the contents that were parsed
+  const auto hash = HashSource(source);
+  auto stamp = StatSource(source);
+  if (!stamp || !hash) {
+    return false;
+  }
+  if (stamp->mtime !=
+      static_cast<std::int64_t>(modified.time_since_epoch().count())) {
+    ASLOG(debug, "{} changed since it was parsed, theme snapshot not saved",
+        source.string());
+    return false;
+  }
+  stamp->hash = *hash;
+
+  SnapshotFile snapshot{};
+  auto &header = snapshot.header;
+  header.magic = SNAPSHOT_MAGIC;
+  header.format_version = SNAPSHOT_FORMAT_VERSION;
+  header.imgui_version = IMGUI_VERSION_NUM;
+  header.style_size = sizeof(ImGuiStyle);
+  header.source = *stamp;
+  std::memcpy(&snapshot.style, &style, sizeof(ImGuiStyle));
+
+  // Write to a temporary file and rename it, so that a crash while writing
+  // can't leave a truncated snapshot behind
+  const auto path =
+      asap::config::GetPathFor(asap::config::Location::F_THEME_SNAPSHOT);
+  auto temp_path = path;
+  temp_path += ".tmp";
+  std::error_code error;
+  std::filesystem::create_directories(path.parent_path(), error);
+  {
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    out.write(reinterpret_cast<const char *>(&snapshot), sizeof(snapshot));
+    if (!out) {
+      ASLOG(warn, "could not write theme snapshot {}", temp_path.string());
+      out.close();
+      std::filesystem::remove(temp_path, error);
+      return false;
+    }
+  }
+  std::filesystem::rename(temp_path, path, error);
+  if (error) {
+    ASLOG(warn, "could not write theme snapshot {}: {}", path.string(),
+        error.message());
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+  ASLOG(debug, "theme snapshot saved in {}", path.string());
+  return true;
+}
+
+} // namespace asap::ui
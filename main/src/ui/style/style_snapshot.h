@@ -0,0 +1,52 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <filesystem>
+
+namespace asap::ui {
+
+/*!
+ * \brief Binary snapshot of the style loaded from the theme settings.
+ *
+ * Parsing `theme.toml` and looking up each of its fields is by far the most
+ * expensive part of loading the theme. Once the file has been parsed, the
+ * whole resulting `ImGuiStyle` (all the style variables and colors) is saved
+ * in the cache directory, together with the modification time, size and hash
+ * of the TOML file it was loaded from.
+ *
+ * As long as the TOML file is not modified, the style is restored from the
+ * snapshot with a single read. A snapshot taken with a different ImGui version
+ * or layout of `ImGuiStyle`, a missing or truncated snapshot, or any change to
+ * the TOML file simply results in the TOML file being parsed again.
+ */
+class StyleSnapshot : public asap::logging::Loggable<StyleSnapshot> {
+public:
+  StyleSnapshot() = delete;
+
+  /// Restore the style saved for the current contents of the `source` TOML
+  /// file. Return false, leaving the style untouched, if there is no valid
+  /// snapshot for it.
+  static auto Load(const std::filesystem::path &source, ImGuiStyle &style)
+      -> bool;
+
+  /// Save the style loaded from the `source` TOML file, which had the
+  /// `modified` time when it was parsed. Nothing is saved if the file changed
+  /// since then, as the snapshot would be keyed on contents the style was not
+  /// loaded from.
+  static auto Save(const std::filesystem::path &source,
+      std::filesystem::file_time_type modified, const ImGuiStyle &style)
+      -> bool;
+
+  static const char *const LOGGER_NAME;
+};
+
+} // namespace asap::ui
@@ -6,19 +6,36 @@
 //   https://opensource.org/licenses/BSD-3-Clause)
 
 #include "ui/style/theme.h"
+#include "assets/asset_store.h"
 #include "config/config.h"
+#include "config/config_store.h"
+#include "config/settings_writer.h"
+#include "ui/fonts/font_atlas_builder.h"
+#include "ui/fonts/font_atlas_cache.h"
 #include "ui/fonts/fonts.h"
 #include "ui/fonts/material_design_icons.h"
+#include "ui/style/style_snapshot.h"
+#include "ui/style/theme_presets_data.h" // generated by the build
+#if defined(ASAP_MDI_SUBSET)
+#include "ui/fonts/material_design_icons_ranges.h" // generated by the build
+#endif
 
+#include <contract/contract.h>
 #include <imgui/imgui.h>
 #include <logging/logging.h>
 #include <toml++/toml.hpp>
 
+#include <algorithm> // for copy()
 #include <array>
+#include <chrono> // for timing the theme loading
 #include <cstring>
-#include <fstream>
+#include <iterator> // for size()
 #include <map>
-#include <mutex> // for call_once()
+#include <memory>
+#include <mutex>   // for call_once()
+#include <sstream> // for serializing the settings
+#include <string>
+#include <vector>
 
 namespace asap::ui {
 
@@ -26,29 +43,73 @@ const char *const Theme::LOGGER_NAME = "main";
 
 namespace {
 
-/// Merge in icons from Font Material Design Icons font.
-ImFont *MergeIcons(float size) {
-  ImGuiIO &io = ImGui::GetIO();
+/// Size in pixels of the fonts at a content scale of 1.
+constexpr float BASE_FONT_SIZE = 13.0F;
+
+/// ImGui embedded font, with the settings `AddFontDefault()` uses when it is
+/// not given a font config.
+auto DefaultFontSource(float size) -> FontSource {
+  FontSource source;
+  source.kind = FontSource::Kind::DEFAULT;
+  source.config.SizePixels = size;
+  source.config.OversampleH = 1;
+  source.config.OversampleV = 1;
+  source.config.PixelSnapH = true;
+  return source;
+}
+
+/// Icons from the Material Design Icons font, merged in the previous font.
+auto IconsFontSource(asap::assets::AssetStore::Bytes font, float size)
+    -> FontSource {
   // The ranges array is not copied by the AddFont* functions and is used lazily
   // so ensure it is available for duration of font usage
+#if defined(ASAP_MDI_SUBSET)
+  // Only the icons used in the sources, as found by the build
+  static const ImWchar icons_ranges[] = {ASAP_MDI_USED_RANGES, 0};
+#else
   static const ImWchar icons_ranges[] = {ICON_MIN_MDI, ICON_MAX_MDI, 0};
-
-  ImFontConfig fontConfig;
+#endif
+
+  FontSource source;
+  source.kind = FontSource::Kind::TTF;
+  source.data = font.data();
+  source.data_size = static_cast<int>(font.size());
+  source.ranges = icons_ranges;
+  auto &fontConfig = source.config;
+  fontConfig.SizePixels = size;
   // Set Oversampling parameters to 1 on both axis, the texture will be 6 times
   // smaller. See https://github.com/ocornut/imgui/issues/1527
   fontConfig.OversampleH = 1;
   fontConfig.OversampleV = 1;
   fontConfig.MergeMode = true;
   fontConfig.PixelSnapH = true;
-  auto font = io.Fonts->AddFontFromMemoryCompressedTTF(
-      asap::ui::Fonts::MATERIAL_DESIGN_ICONS_COMPRESSED_DATA,
-      asap::ui::Fonts::MATERIAL_DESIGN_ICONS_COMPRESSED_SIZE, size, &fontConfig,
-      icons_ranges);
   // use FONT_ICON_FILE_NAME_FAR if you want regular instead of solid
 
-  return font;
+  return source;
+}
+
+auto FontSources(float scale) -> std::vector<FontSource> {
+  const auto size = BASE_FONT_SIZE * scale;
+  std::vector<FontSource> sources{DefaultFontSource(size)};
+  // The font stays mapped (or decompressed) in the asset store, which outlives
+  // the atlas
+  const auto icons =
+      asap::assets::AssetStore::Default().Get(Fonts::MATERIAL_DESIGN_ICONS);
+  if (icons.empty()) {
+    auto &logger = asap::logging::Registry::GetLogger(Theme::LOGGER_NAME);
+    ASLOG_TO_LOGGER(logger, error,
+        "icons font '{}' not in the application assets, the icons are not "
+        "shown",
+        Fonts::MATERIAL_DESIGN_ICONS);
+  } else {
+    sources.push_back(IconsFontSource(icons, size));
+  }
+  return sources;
 }
 
+float content_scale = 1.0F;
+std::unique_ptr<FontAtlasBuilder> font_builder;
+
 } // namespace
 
 void Theme::Init() {
@@ -58,71 +119,146 @@ void Theme::Init() {
   // Fonts
   //
   static std::once_flag init_flag;
-  std::call_once(init_flag, []() {
-    ImGui::GetIO().Fonts->AddFontDefault();
-    MergeIcons(13.0F);
-  });
+  std::call_once(init_flag, []() { LoadDefaultFonts(); });
+}
+
+void Theme::LoadDefaultFonts() {
+  // Baking the atlas is the most expensive part of the startup, it is only done
+  // when the fonts change; otherwise the baked atlas is loaded from the cache.
+  font_builder = std::make_unique<FontAtlasBuilder>(FontSources);
+  font_builder->Build(content_scale);
+}
+
+void Theme::SetContentScale(float scale) {
+  if (scale <= 0.0F) {
+    return;
+  }
+  content_scale = scale;
+  if (font_builder) {
+    ASLOG(debug, "content scale changed to {:.2f}", scale);
+    font_builder->Request(scale);
+  }
+}
+
+auto Theme::SwapFonts() -> bool {
+  return font_builder && font_builder->SwapIfReady();
 }
 
-// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+void Theme::ShutDown() {
+  font_builder.reset();
+}
+
+// -------------------------------------------------------------------------
+// Built-in theme presets
+// -------------------------------------------------------------------------
+
+namespace {
+
+/// The presets as complete styles, so that switching to one of them is a
+/// single copy of the style.
+auto PresetStyles() -> const std::vector<ImGuiStyle> & {
+  static const std::vector<ImGuiStyle> styles = []() {
+    std::vector<ImGuiStyle> expanded;
+    for (const auto &preset : THEME_PRESETS) {
+      expanded.push_back(preset.Style());
+    }
+    return expanded;
+  }();
+  return styles;
+}
+
+/// A switch to a preset, and the fade of the colors to the preset colors.
+struct StyleTransition {
+  using Clock = std::chrono::steady_clock;
+
+  /// Preset to switch to before the next frame, or -1.
+  int requested{-1};
+  std::chrono::milliseconds requested_duration{};
+
+  /// The preset the colors fade to, nullptr when there is no fade running.
+  const ImGuiStyle *target{nullptr};
+  Clock::time_point start;
+  std::chrono::duration<float> duration{};
+  std::array<ImVec4, ImGuiCol_COUNT> from;
+};
+
+StyleTransition style_transition;
+
+/// Set `out` to `from + (to - from) * t` for all the colors. The loop is kept
+/// simple enough for the compiler to vectorize it.
+void LerpColors(const ImVec4 *from, const ImVec4 *to, float t, ImVec4 *out) {
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (int color = 0; color < ImGuiCol_COUNT; ++color) {
+    out[color].x = from[color].x + (to[color].x - from[color].x) * t;
+    out[color].y = from[color].y + (to[color].y - from[color].y) * t;
+    out[color].z = from[color].z + (to[color].z - from[color].z) * t;
+    out[color].w = from[color].w + (to[color].w - from[color].w) * t;
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+} // namespace
+
 void Theme::LoadDefaultStyle() {
-  auto &style = ImGui::GetStyle();
+  style_transition = {};
+  ImGui::GetStyle() = PresetStyles()[DEFAULT_PRESET];
+}
 
-  style.WindowPadding = ImVec2(5, 5);
-  style.WindowRounding = 0.0F;
-  style.FramePadding = ImVec2(5, 5);
-  style.FrameRounding = 3.0F;
-  style.ItemSpacing = ImVec2(12, 5);
-  style.ItemInnerSpacing = ImVec2(5, 5);
-  style.IndentSpacing = 25.0F;
-  style.ScrollbarSize = 15.0F;
-  style.ScrollbarRounding = 9.0F;
-  style.GrabMinSize = 5.0F;
-  style.GrabRounding = 3.0F;
+auto Theme::PresetCount() -> int {
+  return static_cast<int>(std::size(THEME_PRESETS));
+}
 
-  // clang-format off
-  style.Colors[ImGuiCol_Text] = ImVec4(0.91F, 0.91F, 0.91F, 1.00F);
-  style.Colors[ImGuiCol_TextDisabled] = ImVec4(0.40F, 0.40F, 0.40F, 1.00F);
-  style.Colors[ImGuiCol_WindowBg] = ImVec4(0.10F, 0.10F, 0.10F, 1.00F);
-  style.Colors[ImGuiCol_ChildBg] = ImVec4(0.00F, 0.00F, 0.00F, 0.00F);
-  style.Colors[ImGuiCol_Border] = ImVec4(0.00F, 0.00F, 0.00F, 0.39F);
-  style.Colors[ImGuiCol_BorderShadow] = ImVec4(1.00F, 1.00F, 1.00F, 0.10F);
-  style.Colors[ImGuiCol_FrameBg] = ImVec4(0.06F, 0.06F, 0.06F, 1.00F);
-  style.Colors[ImGuiCol_FrameBgHovered] = ImVec4(0.75F, 0.42F, 0.02F, 0.40F);
-  style.Colors[ImGuiCol_FrameBgActive] = ImVec4(0.75F, 0.42F, 0.02F, 0.67F);
-  style.Colors[ImGuiCol_TitleBg] = ImVec4(0.04F, 0.04F, 0.04F, 1.00F);
-  style.Colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.00F, 0.00F, 0.00F, 0.51F);
-  style.Colors[ImGuiCol_TitleBgActive] = ImVec4(0.18F, 0.18F, 0.18F, 1.00F);
-  style.Colors[ImGuiCol_MenuBarBg] = ImVec4(0.15F, 0.15F, 0.15F, 1.00F);
-  style.Colors[ImGuiCol_ScrollbarBg] = ImVec4(0.02F, 0.02F, 0.02F, 0.53F);
-  style.Colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.31F, 0.31F, 0.31F, 0.80F);
-  style.Colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.49F, 0.49F, 0.49F, 0.80F);
-  style.Colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.49F, 0.49F, 0.49F, 1.00F);
-  style.Colors[ImGuiCol_CheckMark] = ImVec4(0.75F, 0.42F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_SliderGrab] = ImVec4(0.75F, 0.42F, 0.02F, 0.78F);
-  style.Colors[ImGuiCol_SliderGrabActive] = ImVec4(0.75F, 0.42F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_Button] = ImVec4(0.75F, 0.42F, 0.02F, 0.40F);
-  style.Colors[ImGuiCol_ButtonHovered] = ImVec4(0.75F, 0.42F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_ButtonActive] = ImVec4(0.94F, 0.47F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_Header] = ImVec4(0.75F, 0.42F, 0.02F, 0.31F);
-  style.Colors[ImGuiCol_HeaderHovered] = ImVec4(0.75F, 0.42F, 0.02F, 0.80F);
-  style.Colors[ImGuiCol_HeaderActive] = ImVec4(0.75F, 0.42F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_Separator] = ImVec4(0.61F, 0.61F, 0.61F, 1.00F);
-  style.Colors[ImGuiCol_SeparatorHovered] = ImVec4(0.75F, 0.42F, 0.02F, 0.78F);
-  style.Colors[ImGuiCol_SeparatorActive] = ImVec4(0.75F, 0.42F, 0.02F, 1.00F);
-  style.Colors[ImGuiCol_ResizeGrip] = ImVec4(0.22F, 0.22F, 0.22F, 1.00F);
-  style.Colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.75F, 0.42F, 0.02F, 0.67F);
-  style.Colors[ImGuiCol_ResizeGripActive] = ImVec4(0.75F, 0.42F, 0.02F, 0.95F);
-  style.Colors[ImGuiCol_PlotLines] = ImVec4(0.61F, 0.61F, 0.61F, 1.00F);
-  style.Colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.00F, 0.57F, 0.65F, 1.00F);
-  style.Colors[ImGuiCol_PlotHistogram] = ImVec4(0.10F, 0.30F, 1.00F, 1.00F);
-  style.Colors[ImGuiCol_PlotHistogramHovered] = ImVec4(0.00F, 0.40F, 1.00F, 1.00F);
-  style.Colors[ImGuiCol_TextSelectedBg] = ImVec4(0.75F, 0.42F, 0.02F, 0.35F);
-  style.Colors[ImGuiCol_PopupBg] = ImVec4(0.00F, 0.00F, 0.00F, 0.94F);
-  style.Colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.06F, 0.06F, 0.06F, 0.35F);
-  // clang-format on
+auto Theme::PresetName(int index) -> const char * {
+  ASAP_ASSERT(index >= 0 && index < PresetCount());
+  return THEME_PRESETS[index].name; // NOLINT
+}
+
+void Theme::SelectPreset(int index, std::chrono::milliseconds transition) {
+  ASAP_ASSERT(index >= 0 && index < PresetCount());
+  style_transition.requested = index;
+  style_transition.requested_duration = transition;
+}
+
+void Theme::UpdateStyle() {
+  auto &style = ImGui::GetStyle();
+  if (style_transition.requested >= 0) {
+    const auto &target = PresetStyles()[style_transition.requested];
+    if (style_transition.requested_duration.count() <= 0) {
+      style = target;
+      style_transition.target = nullptr;
+    } else {
+      // The sizes switch at once, the colors fade from where they are, which
+      // may be in the middle of another fade
+      std::copy(std::begin(style.Colors), std::end(style.Colors),
+          style_transition.from.begin());
+      style = target;
+      std::copy(style_transition.from.begin(), style_transition.from.end(),
+          std::begin(style.Colors));
+      style_transition.target = &target;
+      style_transition.start = StyleTransition::Clock::now();
+      style_transition.duration = style_transition.requested_duration;
+    }
+    ASLOG(info, "theme preset '{}' selected",
+        PresetName(style_transition.requested));
+    style_transition.requested = -1;
+  }
+  if (style_transition.target == nullptr) {
+    return;
+  }
+
+  const auto elapsed = StyleTransition::Clock::now() - style_transition.start;
+  const auto progress = elapsed / style_transition.duration;
+  if (progress >= 1.0F) {
+    std::copy(std::begin(style_transition.target->Colors),
+        std::end(style_transition.target->Colors), std::begin(style.Colors));
+    style_transition.target = nullptr;
+    return;
+  }
+  // Ease in and out
+  const auto t = progress * progress * (3.0F - 2.0F * progress);
+  LerpColors(style_transition.from.data(), style_transition.target->Colors, t,
+      style.Colors);
 }
-// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 
 // -------------------------------------------------------------------------
 // Settings load/save
@@ -143,10 +279,10 @@ void Theme::LoadDefaultStyle() {
     }                                                                          \
   }
 
-void Theme::SaveStyle() {
+namespace {
 
-  auto &style = ImGui::GetStyle();
-  auto &colors = style.Colors;
+auto SerializeStyle(const ImGuiStyle &style) -> std::string {
+  const auto &colors = style.Colors;
 
   // clang-format off
   auto root = toml::table{
@@ -233,12 +369,21 @@ void Theme::SaveStyle() {
   };
   // clang-format on
 
-  auto settings_path =
-      asap::config::GetPathFor(asap::config::Location::F_THEME_SETTINGS);
-  auto ofs = std::ofstream();
-  ofs.open(settings_path.string());
-  ofs << root << std::endl;
-  ofs.close();
+  std::ostringstream contents;
+  contents << root << std::endl;
+  return contents.str();
+}
+
+} // namespace
+
+void Theme::SaveStyle(asap::config::SettingsWriter::Capture capture) {
+  // Only the style is copied here, it is serialized and written in the
+  // background. The file is not touched when the style did not change, so
+  // that its snapshot remains valid.
+  asap::config::SettingsWriter::Default().Write(
+      asap::config::Location::F_THEME_SETTINGS,
+      [style = ImGui::GetStyle()]() { return SerializeStyle(style); },
+      capture);
 }
 
 #define SET_COLOR_FROM_TOML(id)                                                \
@@ -250,227 +395,346 @@ void Theme::SaveStyle() {
         static_cast<float>(color[3].value<double>().value())};                 \
   }
 
+namespace {
+
+/// Apply the theme settings in `config` to `loaded`. Throws if a setting has
+/// an unexpected type.
+void StyleFromSettings(const toml::table &config, ImGuiStyle &loaded) {
+  if (config["theme"]) {
+    auto theme = config["theme"];
+    if (theme["style"]) {
+      auto style = theme["style"];
+
+      if (style["Alpha"]) {
+        loaded.Alpha =
+            static_cast<float>(style["Alpha"].value<double>().value());
+      }
+      if (style["WindowPadding"]) {
+        auto vec2 = style["WindowPadding"];
+        loaded.WindowPadding = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["WindowRounding"]) {
+        loaded.WindowRounding = static_cast<float>(
+            style["WindowRounding"].value<double>().value());
+      }
+      if (style["WindowBorderSize"]) {
+        loaded.WindowBorderSize = static_cast<float>(
+            style["WindowBorderSize"].value<double>().value());
+      }
+      if (style["WindowMinSize"]) {
+        auto vec2 = style["WindowMinSize"];
+        loaded.WindowMinSize = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+      if (style["WindowTitleAlign"]) {
+        auto vec2 = style["WindowTitleAlign"];
+        loaded.WindowTitleAlign = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["ChildRounding"]) {
+        loaded.ChildRounding = static_cast<float>(
+            style["ChildRounding"].value<double>().value());
+      }
+      if (style["ChildBorderSize"]) {
+        loaded.ChildBorderSize = static_cast<float>(
+            style["ChildBorderSize"].value<double>().value());
+      }
+      if (style["PopupRounding"]) {
+        loaded.PopupRounding = static_cast<float>(
+            style["PopupRounding"].value<double>().value());
+      }
+      if (style["PopupBorderSize"]) {
+        loaded.PopupBorderSize = static_cast<float>(
+            style["PopupBorderSize"].value<double>().value());
+      }
+      if (style["FramePadding"]) {
+        auto vec2 = style["FramePadding"];
+        loaded.FramePadding = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["FrameRounding"]) {
+        loaded.FrameRounding = static_cast<float>(
+            style["FrameRounding"].value<double>().value());
+      }
+      if (style["FrameBorderSize"]) {
+        loaded.FrameBorderSize = static_cast<float>(
+            style["FrameBorderSize"].value<double>().value());
+      }
+      if (style["ItemSpacing"]) {
+        auto vec2 = style["ItemSpacing"];
+        loaded.ItemSpacing = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["ItemInnerSpacing"]) {
+        auto vec2 = style["ItemInnerSpacing"];
+        loaded.ItemInnerSpacing = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["TouchExtraPadding"]) {
+        auto vec2 = style["TouchExtraPadding"];
+        loaded.TouchExtraPadding = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["IndentSpacing"]) {
+        loaded.IndentSpacing = static_cast<float>(
+            style["IndentSpacing"].value<double>().value());
+      }
+      if (style["ColumnsMinSpacing"]) {
+        loaded.ColumnsMinSpacing = static_cast<float>(
+            style["ColumnsMinSpacing"].value<double>().value());
+      }
+      if (style["ScrollbarSize"]) {
+        loaded.ScrollbarSize = static_cast<float>(
+            style["ScrollbarSize"].value<double>().value());
+      }
+      if (style["ScrollbarRounding"]) {
+        loaded.ScrollbarRounding = static_cast<float>(
+            style["ScrollbarRounding"].value<double>().value());
+      }
+      if (style["GrabMinSize"]) {
+        loaded.GrabMinSize =
+            static_cast<float>(style["GrabMinSize"].value<double>().value());
+      }
+      if (style["GrabRounding"]) {
+        loaded.GrabRounding =
+            static_cast<float>(style["GrabRounding"].value<double>().value());
+      }
+      if (style["ButtonTextAlign"]) {
+        auto vec2 = style["ButtonTextAlign"];
+        loaded.ButtonTextAlign = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["DisplayWindowPadding"]) {
+        auto vec2 = style["DisplayWindowPadding"];
+        loaded.DisplayWindowPadding = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["DisplaySafeAreaPadding"]) {
+        auto vec2 = style["DisplaySafeAreaPadding"];
+        loaded.DisplaySafeAreaPadding = {
+            static_cast<float>(vec2[0].value<double>().value()),
+            static_cast<float>(vec2[1].value<double>().value())};
+      }
+
+      if (style["MouseCursorScale"]) {
+        loaded.MouseCursorScale = static_cast<float>(
+            style["MouseCursorScale"].value<double>().value());
+      }
+      if (style["AntiAliasedLines"]) {
+        loaded.AntiAliasedLines =
+            style["AntiAliasedLines"].value_or(loaded.AntiAliasedLines);
+      }
+      if (style["AntiAliasedFill"]) {
+        loaded.AntiAliasedFill =
+            style["AntiAliasedFill"].value_or(loaded.AntiAliasedFill);
+      }
+      if (style["CurveTessellationTol"]) {
+        loaded.CurveTessellationTol = static_cast<float>(
+            style["CurveTessellationTol"].value<double>().value());
+      }
+    }
+    if (theme["colors"]) {
+      auto &colors = loaded.Colors;
+      auto colors_settings = theme["colors"];
+
+      SET_COLOR_FROM_TOML(ImGuiCol_Text);
+      SET_COLOR_FROM_TOML(ImGuiCol_TextDisabled);
+      SET_COLOR_FROM_TOML(ImGuiCol_WindowBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_ChildBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_PopupBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_Border);
+      SET_COLOR_FROM_TOML(ImGuiCol_BorderShadow);
+      SET_COLOR_FROM_TOML(ImGuiCol_FrameBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_FrameBgHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_FrameBgActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_TitleBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_TitleBgActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_TitleBgCollapsed);
+      SET_COLOR_FROM_TOML(ImGuiCol_MenuBarBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrab);
+      SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrabHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrabActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_CheckMark);
+      SET_COLOR_FROM_TOML(ImGuiCol_SliderGrab);
+      SET_COLOR_FROM_TOML(ImGuiCol_SliderGrabActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_Button);
+      SET_COLOR_FROM_TOML(ImGuiCol_ButtonHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_ButtonActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_Header);
+      SET_COLOR_FROM_TOML(ImGuiCol_HeaderHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_HeaderActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_Separator);
+      SET_COLOR_FROM_TOML(ImGuiCol_SeparatorHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_SeparatorActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_ResizeGrip);
+      SET_COLOR_FROM_TOML(ImGuiCol_ResizeGripHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_ResizeGripActive);
+      SET_COLOR_FROM_TOML(ImGuiCol_PlotLines);
+      SET_COLOR_FROM_TOML(ImGuiCol_PlotLinesHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogram);
+      SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogramHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogramHovered);
+      SET_COLOR_FROM_TOML(ImGuiCol_TextSelectedBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_DragDropTarget);
+      SET_COLOR_FROM_TOML(ImGuiCol_NavHighlight);
+      SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingHighlight);
+      SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingHighlight);
+      SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingDimBg);
+      SET_COLOR_FROM_TOML(ImGuiCol_ModalWindowDimBg);
+    }
+  }
+}
+
+} // namespace
+
 void Theme::LoadStyle() {
-  auto theme_settings =
+  const auto &theme_settings =
       asap::config::GetPathFor(asap::config::Location::F_THEME_SETTINGS);
-  auto has_config = false;
   if (!std::filesystem::exists(theme_settings)) {
     ASLOG(info, "file {} does not exist", theme_settings.string());
     LoadDefaultStyle();
     return;
   }
 
-  try {
-    auto config = toml::parse_file(theme_settings.string());
-    ASLOG(info, "theme settings loaded from {}", theme_settings.string());
-
-    if (config["theme"]) {
-      auto theme = config["theme"];
-      if (theme["style"]) {
-        auto style = theme["style"];
-
-        if (style["Alpha"]) {
-          ImGui::GetStyle().Alpha =
-              static_cast<float>(style["Alpha"].value<double>().value());
-        }
-        if (style["WindowPadding"]) {
-          auto vec2 = style["WindowPadding"];
-          ImGui::GetStyle().WindowPadding = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["WindowRounding"]) {
-          ImGui::GetStyle().WindowRounding = static_cast<float>(
-              style["WindowRounding"].value<double>().value());
-        }
-        if (style["WindowBorderSize"]) {
-          ImGui::GetStyle().WindowBorderSize = static_cast<float>(
-              style["WindowBorderSize"].value<double>().value());
-        }
-        if (style["WindowMinSize"]) {
-          auto vec2 = style["WindowMinSize"];
-          ImGui::GetStyle().WindowMinSize = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-        if (style["WindowTitleAlign"]) {
-          auto vec2 = style["WindowTitleAlign"];
-          ImGui::GetStyle().WindowTitleAlign = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["ChildRounding"]) {
-          ImGui::GetStyle().ChildRounding = static_cast<float>(
-              style["ChildRounding"].value<double>().value());
-        }
-        if (style["ChildBorderSize"]) {
-          ImGui::GetStyle().ChildBorderSize = static_cast<float>(
-              style["ChildBorderSize"].value<double>().value());
-        }
-        if (style["PopupRounding"]) {
-          ImGui::GetStyle().PopupRounding = static_cast<float>(
-              style["PopupRounding"].value<double>().value());
-        }
-        if (style["PopupBorderSize"]) {
-          ImGui::GetStyle().PopupBorderSize = static_cast<float>(
-              style["PopupBorderSize"].value<double>().value());
-        }
-        if (style["FramePadding"]) {
-          auto vec2 = style["FramePadding"];
-          ImGui::GetStyle().FramePadding = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["FrameRounding"]) {
-          ImGui::GetStyle().FrameRounding = static_cast<float>(
-              style["FrameRounding"].value<double>().value());
-        }
-        if (style["FrameBorderSize"]) {
-          ImGui::GetStyle().FrameBorderSize = static_cast<float>(
-              style["FrameBorderSize"].value<double>().value());
-        }
-        if (style["ItemSpacing"]) {
-          auto vec2 = style["ItemSpacing"];
-          ImGui::GetStyle().ItemSpacing = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["ItemInnerSpacing"]) {
-          auto vec2 = style["ItemInnerSpacing"];
-          ImGui::GetStyle().ItemInnerSpacing = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["TouchExtraPadding"]) {
-          auto vec2 = style["TouchExtraPadding"];
-          ImGui::GetStyle().TouchExtraPadding = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["IndentSpacing"]) {
-          ImGui::GetStyle().IndentSpacing = static_cast<float>(
-              style["IndentSpacing"].value<double>().value());
-        }
-        if (style["ColumnsMinSpacing"]) {
-          ImGui::GetStyle().ColumnsMinSpacing = static_cast<float>(
-              style["ColumnsMinSpacing"].value<double>().value());
-        }
-        if (style["ScrollbarSize"]) {
-          ImGui::GetStyle().ScrollbarSize = static_cast<float>(
-              style["ScrollbarSize"].value<double>().value());
-        }
-        if (style["ScrollbarRounding"]) {
-          ImGui::GetStyle().ScrollbarRounding = static_cast<float>(
-              style["ScrollbarRounding"].value<double>().value());
-        }
-        if (style["GrabMinSize"]) {
-          ImGui::GetStyle().GrabMinSize =
-              static_cast<float>(style["GrabMinSize"].value<double>().value());
-        }
-        if (style["GrabRounding"]) {
-          ImGui::GetStyle().GrabRounding =
-              static_cast<float>(style["GrabRounding"].value<double>().value());
-        }
-        if (style["ButtonTextAlign"]) {
-          auto vec2 = style["ButtonTextAlign"];
-          ImGui::GetStyle().ButtonTextAlign = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["DisplayWindowPadding"]) {
-          auto vec2 = style["DisplayWindowPadding"];
-          ImGui::GetStyle().DisplayWindowPadding = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["DisplaySafeAreaPadding"]) {
-          auto vec2 = style["DisplaySafeAreaPadding"];
-          ImGui::GetStyle().DisplaySafeAreaPadding = {
-              static_cast<float>(vec2[0].value<double>().value()),
-              static_cast<float>(vec2[1].value<double>().value())};
-        }
-
-        if (style["MouseCursorScale"]) {
-          ImGui::GetStyle().MouseCursorScale = static_cast<float>(
-              style["MouseCursorScale"].value<double>().value());
-        }
-        if (style["AntiAliasedLines"]) {
-          ImGui::GetStyle().AntiAliasedLines =
-              style["AntiAliasedLines"].as<bool>();
-        }
-        if (style["AntiAliasedFill"]) {
-          ImGui::GetStyle().AntiAliasedFill =
-              style["AntiAliasedFill"].as<bool>();
-        }
-        if (style["CurveTessellationTol"]) {
-          ImGui::GetStyle().CurveTessellationTol = static_cast<float>(
-              style["CurveTessellationTol"].value<double>().value());
-        }
-      }
-      if (theme["colors"]) {
-        auto &colors = ImGui::GetStyle().Colors;
-        auto colors_settings = theme["colors"];
-
-        SET_COLOR_FROM_TOML(ImGuiCol_Text);
-        SET_COLOR_FROM_TOML(ImGuiCol_TextDisabled);
-        SET_COLOR_FROM_TOML(ImGuiCol_WindowBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_ChildBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_PopupBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_Border);
-        SET_COLOR_FROM_TOML(ImGuiCol_BorderShadow);
-        SET_COLOR_FROM_TOML(ImGuiCol_FrameBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_FrameBgHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_FrameBgActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_TitleBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_TitleBgActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_TitleBgCollapsed);
-        SET_COLOR_FROM_TOML(ImGuiCol_MenuBarBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrab);
-        SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrabHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_ScrollbarGrabActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_CheckMark);
-        SET_COLOR_FROM_TOML(ImGuiCol_SliderGrab);
-        SET_COLOR_FROM_TOML(ImGuiCol_SliderGrabActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_Button);
-        SET_COLOR_FROM_TOML(ImGuiCol_ButtonHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_ButtonActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_Header);
-        SET_COLOR_FROM_TOML(ImGuiCol_HeaderHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_HeaderActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_Separator);
-        SET_COLOR_FROM_TOML(ImGuiCol_SeparatorHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_SeparatorActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_ResizeGrip);
-        SET_COLOR_FROM_TOML(ImGuiCol_ResizeGripHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_ResizeGripActive);
-        SET_COLOR_FROM_TOML(ImGuiCol_PlotLines);
-        SET_COLOR_FROM_TOML(ImGuiCol_PlotLinesHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogram);
-        SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogramHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_PlotHistogramHovered);
-        SET_COLOR_FROM_TOML(ImGuiCol_TextSelectedBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_DragDropTarget);
-        SET_COLOR_FROM_TOML(ImGuiCol_NavHighlight);
-        SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingHighlight);
-        SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingHighlight);
-        SET_COLOR_FROM_TOML(ImGuiCol_NavWindowingDimBg);
-        SET_COLOR_FROM_TOML(ImGuiCol_ModalWindowDimBg);
+  const auto start = std::chrono::steady_clock::now();
+  // The style is the ImGui default style with the theme settings applied
+  ImGuiStyle loaded;
+  // Only use the TOML file after it changed. It was usually parsed in the
+  // background during the startup.
+  if (StyleSnapshot::Load(theme_settings, loaded)) {
+    ASLOG(debug, "theme settings restored from snapshot");
+  } else {
+    auto &store = asap::config::ConfigStore::Default();
+    try {
+      if (!store.Contains(asap::config::Location::F_THEME_SETTINGS)) {
+        LoadDefaultStyle();
+        return;
       }
+      StyleFromSettings(
+          store.Table(asap::config::Location::F_THEME_SETTINGS), loaded);
+    } catch (std::exception const &ex) {
+      ASLOG(error, "error {} while loading theme settings from {}", ex.what(),
+          theme_settings.string());
+      LoadDefaultStyle();
+      return;
     }
-  } catch (std::exception const &ex) {
-    ASLOG(error, "error {} while loading theme settings from {}", ex.what(),
-        theme_settings.string());
-    LoadDefaultStyle();
+    StyleSnapshot::Save(theme_settings,
+        store.ModifiedTime(asap::config::Location::F_THEME_SETTINGS), loaded);
+  }
+  style_transition = {};
+  ImGui::GetStyle() = loaded;
+  ASLOG(info, "theme settings loaded from {} in {:.2f} ms",
+      theme_settings.string(),
+      std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+}
+
+auto Theme::ReadStyle(const std::filesystem::path &file, ImGuiStyle &style)
+    -> bool {
+  ImGuiStyle loaded;
+  if (!StyleSnapshot::Load(file, loaded)) {
+    std::error_code error;
+    const auto modified = std::filesystem::last_write_time(file, error);
+    try {
+      StyleFromSettings(asap::config::ConfigStore::Parse(file), loaded);
+    } catch (std::exception const &ex) {
+      ASLOG(error, "error {} while loading theme settings from {}", ex.what(),
+          file.string());
+      return false;
+    }
+    StyleSnapshot::Save(file, modified, loaded);
+  }
+  style = loaded;
+  return true;
+}
+
+namespace {
+
+/// Set `current` to `value` if they differ, compared bitwise as the values are
+/// only copied around (floats, bools and vectors of floats).
+template <typename T> auto Update(T &current, const T &value) -> bool {
+  if (std::memcmp(&current, &value, sizeof(T)) == 0) {
+    return false;
+  }
+  current = value;
+  return true;
+}
+
+} // namespace
+
+#define UPDATE_STYLE_VAR(FIELD)                                                \
+  if (Update(current.FIELD, style.FIELD)) {                                    \
+    ++changed_vars;                                                            \
+  }
+
+void Theme::ApplyStyle(const ImGuiStyle &style) {
+  // The reloaded settings win over a preset being faded in
+  style_transition = {};
+  auto &current = ImGui::GetStyle();
+  int changed_vars = 0;
+  // The style variables saved in the theme settings
+  UPDATE_STYLE_VAR(Alpha);
+  UPDATE_STYLE_VAR(WindowPadding);
+  UPDATE_STYLE_VAR(WindowRounding);
+  UPDATE_STYLE_VAR(WindowBorderSize);
+  UPDATE_STYLE_VAR(WindowMinSize);
+  UPDATE_STYLE_VAR(WindowTitleAlign);
+  UPDATE_STYLE_VAR(ChildRounding);
+  UPDATE_STYLE_VAR(ChildBorderSize);
+  UPDATE_STYLE_VAR(PopupRounding);
+  UPDATE_STYLE_VAR(PopupBorderSize);
+  UPDATE_STYLE_VAR(FramePadding);
+  UPDATE_STYLE_VAR(FrameRounding);
+  UPDATE_STYLE_VAR(FrameBorderSize);
+  UPDATE_STYLE_VAR(ItemSpacing);
+  UPDATE_STYLE_VAR(ItemInnerSpacing);
+  UPDATE_STYLE_VAR(TouchExtraPadding);
+  UPDATE_STYLE_VAR(IndentSpacing);
+  UPDATE_STYLE_VAR(ColumnsMinSpacing);
+  UPDATE_STYLE_VAR(ScrollbarSize);
+  UPDATE_STYLE_VAR(ScrollbarRounding);
+  UPDATE_STYLE_VAR(GrabMinSize);
+  UPDATE_STYLE_VAR(GrabRounding);
+  UPDATE_STYLE_VAR(ButtonTextAlign);
+  UPDATE_STYLE_VAR(DisplayWindowPadding);
+  UPDATE_STYLE_VAR(DisplaySafeAreaPadding);
+  UPDATE_STYLE_VAR(MouseCursorScale);
+  UPDATE_STYLE_VAR(AntiAliasedLines);
+  UPDATE_STYLE_VAR(AntiAliasedFill);
+  UPDATE_STYLE_VAR(CurveTessellationTol);
+
+  int changed_colors = 0;
+  for (int color = 0; color < ImGuiCol_COUNT; ++color) {
+    if (Update(current.Colors[color], style.Colors[color])) { // NOLINT
+      ++changed_colors;
+    }
+  }
+  if (changed_vars == 0 && changed_colors == 0) {
+    ASLOG(debug, "theme unchanged");
+    return;
   }
+  ASLOG(info, "theme updated ({} style variables and {} colors changed)",
+      changed_vars, changed_colors);
 }
 
 } // namespace asap::ui
@@ -7,12 +7,17 @@
 
 #pragma once
 
+#include "config/settings_writer.h"
+
 #include <logging/logging.h>
 
+#include <chrono>
+#include <filesystem>
 #include <map>
 #include <string>
 
 struct ImFont;
+struct ImGuiStyle;
 
 namespace asap::ui {
 
@@ -22,11 +27,68 @@ public:
 
   static void Init();
 
-  static void SaveStyle();
+  static void SaveStyle(asap::config::SettingsWriter::Capture capture =
+                            asap::config::SettingsWriter::Capture::SAVE);
   static void LoadStyle();
 
+  /// Switch to the default theme preset at once.
   static void LoadDefaultStyle();
 
+  /// Index of the default theme, in the built-in theme presets.
+  static constexpr int DEFAULT_PRESET = 0;
+  /// Duration of the color fade when switching presets from the settings.
+  static constexpr std::chrono::milliseconds PRESET_TRANSITION{250};
+
+  /// Number of built-in theme presets.
+  static auto PresetCount() -> int;
+  /// Name of the built-in theme preset `index`.
+  static auto PresetName(int index) -> const char *;
+
+  /*!
+   * \brief Switch to the built-in theme preset `index`.
+   *
+   * Can be called while drawing a frame: the style is switched by
+   * `UpdateStyle()` before the next one. With a `transition`, the sizes switch
+   * at once and the colors fade from the current ones over its duration.
+   */
+  static void SelectPreset(
+      int index, std::chrono::milliseconds transition = {});
+
+  /// Switch to the preset selected since the last frame and advance the color
+  /// fade. Must be called before starting a frame.
+  static void UpdateStyle();
+
+  /*!
+   * \brief Read the theme settings in `file` into `style`.
+   *
+   * Does not touch the ImGui context and can be called from any thread.
+   * Return false, leaving `style` untouched, if the settings can't be read.
+   */
+  static auto ReadStyle(const std::filesystem::path &file, ImGuiStyle &style)
+      -> bool;
+
+  /// Apply the style variables and colors of `style` that differ from the
+  /// current style. Must be called between two frames.
+  static void ApplyStyle(const ImGuiStyle &style);
+
+  /*!
+   * \brief Set the content scale (DPI scale) of the window.
+   *
+   * Before the fonts are loaded, the scale is only recorded and used for the
+   * initial atlas. After, a new atlas is built for the scale in the background
+   * and installed by `SwapFonts()`.
+   */
+  static void SetContentScale(float scale);
+
+  /// Install the font atlas rebuilt for a new content scale if it is ready.
+  /// Must be called before starting a frame; return true when the fonts
+  /// changed and the font texture needs to be re-created.
+  static auto SwapFonts() -> bool;
+
+  /// Stop the font atlas rebuilds. Must be called before destroying the ImGui
+  /// context.
+  static void ShutDown();
+
 private:
   Theme() = default;
 
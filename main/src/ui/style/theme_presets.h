@@ -0,0 +1,86 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <imgui/imgui.h>
+
+#include <cstddef>
+
+namespace asap::ui {
+
+/*!
+ * \brief A built-in theme, compiled from a TOML file in `main/themes/`.
+ *
+ * The presets are constexpr tables generated by the build (see
+ * cmake/GenerateThemePresets.cmake). They only list the values set by the
+ * preset; the others keep their value in the ImGui default style.
+ */
+struct ThemePreset {
+  /// A constexpr view of one of the generated tables.
+  template <typename T> struct Table {
+    const T *items{nullptr};
+    std::size_t size{0};
+
+    constexpr Table() = default;
+    template <std::size_t N>
+    constexpr Table(const T (&table)[N]) // NOLINT(google-explicit-constructor)
+        : items(table), size(N) {
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> const T * {
+      return items;
+    }
+    [[nodiscard]] constexpr auto end() const -> const T * {
+      return items + size; // NOLINT
+    }
+  };
+
+  struct Color {
+    ImGuiCol index;
+    float value[4];
+  };
+  struct Float {
+    float ImGuiStyle::*field;
+    float value;
+  };
+  struct Vec2 {
+    ImVec2 ImGuiStyle::*field;
+    float value[2];
+  };
+  struct Bool {
+    bool ImGuiStyle::*field;
+    bool value;
+  };
+
+  const char *name;
+  Table<Color> colors;
+  Table<Float> floats;
+  Table<Vec2> vec2s;
+  Table<Bool> bools;
+
+  /// The ImGui default style with the values of the preset.
+  [[nodiscard]] auto Style() const -> ImGuiStyle {
+    ImGuiStyle style;
+    for (const auto &color : colors) {
+      style.Colors[color.index] = {color.value[0], color.value[1], // NOLINT
+          color.value[2], color.value[3]};
+    }
+    for (const auto &var : floats) {
+      style.*var.field = var.value;
+    }
+    for (const auto &var : vec2s) {
+      style.*var.field = {var.value[0], var.value[1]};
+    }
+    for (const auto &var : bools) {
+      style.*var.field = var.value;
+    }
+    return style;
+  }
+};
+
+} // namespace asap::ui
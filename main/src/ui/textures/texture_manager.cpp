@@ -0,0 +1,401 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#include "ui/textures/texture_manager.h"
+
+#include <contract/contract.h>
+#include <glad/gl_state.h>
+
+#include <algorithm> // for max, min, remove_if
+#include <cstring>   // for memcpy
+
+namespace asap::ui {
+
+const char *const TextureManager::LOGGER_NAME = "main";
+
+namespace {
+
+/// Size of a pixel buffer. An upload is split in bands of rows fitting in it.
+constexpr std::size_t STAGING_BYTES = std::size_t{1} << 20U;
+/// Pixel buffers in flight, GL reading from some while others are written.
+constexpr std::size_t MAX_STAGING_BUFFERS = 8;
+/// Bytes copied to the pixel buffers per frame, to bound the time spent.
+constexpr std::size_t UPLOAD_BYTES_PER_FRAME = std::size_t{4} << 20U;
+
+constexpr std::size_t PIXEL_BYTES = sizeof(std::uint32_t);
+
+auto LevelSize(int size, int level) -> int {
+  return std::max(1, size >> level);
+}
+
+/// Estimated GPU memory of an RGBA texture with all its levels.
+auto TextureBytes(int width, int height, int levels) -> std::size_t {
+  std::size_t bytes = 0;
+  for (int level = 0; level < levels; ++level) {
+    bytes += static_cast<std::size_t>(LevelSize(width, level)) *
+             static_cast<std::size_t>(LevelSize(height, level)) * PIXEL_BYTES;
+  }
+  return bytes;
+}
+
+} // namespace
+
+auto TextureManager::Default() -> TextureManager & {
+  static TextureManager manager;
+  return manager;
+}
+
+TextureManager::~TextureManager() {
+  Clear();
+}
+
+auto TextureManager::Find(Handle texture) -> Texture * {
+  if (!texture || texture.index_ >= textures_.size()) {
+    return nullptr;
+  }
+  auto &found = textures_[texture.index_];
+  return found.generation == texture.generation_ &&
+                 found.state != State::INVALID
+             ? &found
+             : nullptr;
+}
+
+auto TextureManager::Find(Handle texture) const -> const Texture * {
+  return const_cast<TextureManager *>(this)->Find(texture); // NOLINT
+}
+
+auto TextureManager::Create(int width, int height, Options options)
+    -> Handle {
+  ASAP_EXPECT(width > 0 && height > 0);
+  ASAP_EXPECT(options.levels > 0);
+
+  std::uint32_t index = 0;
+  if (free_slots_.empty()) {
+    index = static_cast<std::uint32_t>(textures_.size());
+    textures_.emplace_back();
+  } else {
+    index = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  auto &texture = textures_[index];
+  texture.width = width;
+  texture.height = height;
+  texture.options = options;
+  texture.last_used_frame = ImGui::GetFrameCount();
+  Allocate(texture);
+  return {index, texture.generation};
+}
+
+void TextureManager::Allocate(Texture &texture) {
+  glGenTextures(1, &texture.name);
+  asap::gl::BindTexture(GL_TEXTURE_2D, texture.name);
+  const auto levels = texture.options.levels;
+  const GLint mag_filter = texture.options.linear ? GL_LINEAR : GL_NEAREST;
+  GLint min_filter = mag_filter;
+  if (levels > 1) {
+    min_filter = texture.options.linear ? GL_LINEAR_MIPMAP_LINEAR
+                                        : GL_NEAREST_MIPMAP_NEAREST;
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag_filter);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  for (int level = 0; level < levels; ++level) {
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8,
+        LevelSize(texture.width, level), LevelSize(texture.height, level), 0,
+        GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  }
+  texture.bytes = TextureBytes(texture.width, texture.height, levels);
+  texture.state = State::READY;
+  resident_bytes_ += texture.bytes;
+}
+
+void TextureManager::Evict(Texture &texture) {
+  if (texture.name != 0) {
+    asap::gl::DeleteTextures(1, &texture.name);
+    texture.name = 0;
+    resident_bytes_ -= texture.bytes;
+  }
+  texture.state = State::EVICTED;
+}
+
+void TextureManager::Forget(Handle texture) {
+  auto *found = Find(texture);
+  if (found == nullptr || found->pending_bands == 0) {
+    return;
+  }
+  bands_.erase(std::remove_if(bands_.begin(), bands_.end(),
+                   [this, texture](const Band &band) {
+                     if (band.texture != texture) {
+                       return false;
+                     }
+                     pending_bytes_ -= static_cast<std::size_t>(band.width) *
+                                       static_cast<std::size_t>(band.rows) *
+                                       PIXEL_BYTES;
+                     return true;
+                   }),
+      bands_.end());
+  found->pending_bands = 0;
+}
+
+void TextureManager::Release(Handle texture) {
+  auto *found = Find(texture);
+  if (found == nullptr) {
+    return;
+  }
+  Forget(texture);
+  Evict(*found);
+  found->state = State::INVALID;
+  // Never 0, which is the invalid handle
+  if (++found->generation == 0) {
+    found->generation = 1;
+  }
+  free_slots_.push_back(texture.index_);
+}
+
+void TextureManager::Resize(Handle texture, int width, int height) {
+  ASAP_EXPECT(width > 0 && height > 0);
+  auto *found = Find(texture);
+  if (found == nullptr ||
+      (found->width == width && found->height == height &&
+          found->state != State::EVICTED)) {
+    return;
+  }
+  Forget(texture);
+  Evict(*found);
+  found->width = width;
+  found->height = height;
+  Allocate(*found);
+}
+
+void TextureManager::Upload(Handle texture, int level, int x, int y,
+    int width, int height, std::vector<std::uint32_t> pixels) {
+  auto *found = Find(texture);
+  if (found == nullptr) {
+    return;
+  }
+  ASAP_EXPECT(level >= 0 && level < found->options.levels);
+  ASAP_EXPECT(x >= 0 && y >= 0 && width > 0 && height > 0);
+  ASAP_EXPECT(x + width <= LevelSize(found->width, level));
+  ASAP_EXPECT(y + height <= LevelSize(found->height, level));
+  ASAP_EXPECT(pixels.size() == static_cast<std::size_t>(width) *
+                                   static_cast<std::size_t>(height));
+  if (found->state == State::EVICTED) {
+    Allocate(*found);
+  }
+  // Not evicted before it is drawn
+  found->last_used_frame = ImGui::GetFrameCount();
+
+  // Split in bands of rows fitting in a pixel buffer
+  const auto row_bytes = static_cast<std::size_t>(width) * PIXEL_BYTES;
+  const auto band_rows =
+      static_cast<int>(std::max<std::size_t>(1, STAGING_BYTES / row_bytes));
+  ASAP_ASSERT(row_bytes <= STAGING_BYTES);
+  const auto shared =
+      std::make_shared<const std::vector<std::uint32_t>>(std::move(pixels));
+  for (int row = 0; row < height; row += band_rows) {
+    const auto rows = std::min(band_rows, height - row);
+    bands_.push_back(Band{texture, level, x, y + row, width, rows, shared,
+        static_cast<std::size_t>(row) * static_cast<std::size_t>(width)});
+    ++found->pending_bands;
+  }
+  pending_bytes_ += row_bytes * static_cast<std::size_t>(height);
+  found->state = State::UPLOADING;
+}
+
+auto TextureManager::GetState(Handle texture) const -> State {
+  const auto *found = Find(texture);
+  return found != nullptr ? found->state : State::INVALID;
+}
+
+auto TextureManager::GetSize(Handle texture) const -> ImVec2 {
+  const auto *found = Find(texture);
+  if (found == nullptr) {
+    return {0, 0};
+  }
+  return {static_cast<float>(found->width), static_cast<float>(found->height)};
+}
+
+auto TextureManager::Use(Handle texture) -> ImTextureID {
+  auto *found = Find(texture);
+  if (found == nullptr) {
+    return nullptr;
+  }
+  found->last_used_frame = ImGui::GetFrameCount();
+  if (found->state != State::READY) {
+    return nullptr;
+  }
+  return reinterpret_cast<ImTextureID>( // NOLINT
+      static_cast<std::uintptr_t>(found->name));
+}
+
+auto TextureManager::GlName(Handle texture) -> GLuint {
+  auto *found = Find(texture);
+  if (found == nullptr) {
+    return 0;
+  }
+  found->last_used_frame = ImGui::GetFrameCount();
+  return found->name;
+}
+
+void TextureManager::Image(Handle texture, const ImVec2 &size,
+    const ImVec2 &uv0, const ImVec2 &uv1) {
+  const auto id = Use(texture);
+  if (id != nullptr) {
+    ImGui::Image(id, size, uv0, uv1);
+  } else {
+    ImGui::Dummy(size);
+  }
+}
+
+void TextureManager::SetBudget(std::size_t bytes) {
+  if (bytes != budget_) {
+    budget_ = bytes;
+    ASLOG(debug, "texture budget set to {} MiB", budget_ >> 20U);
+  }
+}
+
+void TextureManager::EvictOverBudget() {
+  // The textures of the last frame are the working set, they stay. So do the
+  // ones with an upload on the way, which would otherwise be lost.
+  const auto last_frame = ImGui::GetFrameCount();
+  while (resident_bytes_ > budget_) {
+    Texture *victim = nullptr;
+    for (auto &texture : textures_) {
+      if (texture.name != 0 && !texture.options.pinned &&
+          texture.pending_bands == 0 && texture.last_used_frame < last_frame &&
+          (victim == nullptr ||
+              texture.last_used_frame < victim->last_used_frame)) {
+        victim = &texture;
+      }
+    }
+    if (victim == nullptr) {
+      return;
+    }
+    Evict(*victim);
+    ++evictions_;
+  }
+}
+
+auto TextureManager::FreeStagingBuffer() -> StagingBuffer * {
+  for (auto &buffer : staging_) {
+    if (buffer.fence != nullptr) {
+      // Only poll, never wait for GL
+      const auto status = glClientWaitSync(buffer.fence, 0, 0);
+      if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+        continue;
+      }
+      glDeleteSync(buffer.fence);
+      buffer.fence = nullptr;
+    }
+    return &buffer;
+  }
+  if (staging_.size() < MAX_STAGING_BUFFERS) {
+    StagingBuffer buffer;
+    glGenBuffers(1, &buffer.name);
+    asap::gl::BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.name);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER,
+        static_cast<GLsizeiptr>(STAGING_BYTES), nullptr, GL_STREAM_DRAW);
+    staging_.push_back(buffer);
+    return &staging_.back();
+  }
+  return nullptr;
+}
+
+void TextureManager::CopyBands() {
+  std::size_t copied = 0;
+  while (!bands_.empty() && copied < UPLOAD_BYTES_PER_FRAME) {
+    auto *buffer = FreeStagingBuffer();
+    if (buffer == nullptr) {
+      break;
+    }
+    auto band = std::move(bands_.front());
+    bands_.pop_front();
+    auto &texture = textures_[band.texture.index_];
+    const auto bytes = static_cast<std::size_t>(band.width) *
+                       static_cast<std::size_t>(band.rows) * PIXEL_BYTES;
+
+    // GL is done with the buffer, no need to synchronize the mapping
+    asap::gl::BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->name);
+    auto *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0,
+        static_cast<GLsizeiptr>(bytes),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped == nullptr) {
+      ASLOG(error, "failed to map a texture upload buffer");
+      bands_.push_front(band);
+      break;
+    }
+    std::memcpy(mapped, band.pixels->data() + band.first_pixel, bytes);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    asap::gl::BindTexture(GL_TEXTURE_2D, texture.name);
+    glTexSubImage2D(GL_TEXTURE_2D, band.level, band.x, band.y, band.width,
+        band.rows, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    buffer->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    // GL orders the draws after the upload, the texture can be used as soon
+    // as its last band is submitted
+    if (--texture.pending_bands == 0) {
+      texture.state = State::READY;
+    }
+    copied += bytes;
+    pending_bytes_ -= bytes;
+    uploaded_bytes_ += bytes;
+  }
+  // The other texture uploads read from client memory
+  asap::gl::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void TextureManager::Update() {
+  EvictOverBudget();
+  if (!bands_.empty()) {
+    CopyBands();
+  }
+}
+
+void TextureManager::Clear() {
+  for (auto &texture : textures_) {
+    if (texture.name != 0) {
+      asap::gl::DeleteTextures(1, &texture.name);
+    }
+  }
+  textures_.clear();
+  free_slots_.clear();
+  bands_.clear();
+  for (auto &buffer : staging_) {
+    if (buffer.fence != nullptr) {
+      glDeleteSync(buffer.fence);
+    }
+    asap::gl::DeleteBuffers(1, &buffer.name);
+  }
+  staging_.clear();
+  resident_bytes_ = 0;
+  pending_bytes_ = 0;
+}
+
+auto TextureManager::GetStats() const -> Stats {
+  Stats stats;
+  for (const auto &texture : textures_) {
+    if (texture.state != State::INVALID) {
+      ++stats.textures;
+    }
+    if (texture.name != 0) {
+      ++stats.resident;
+    }
+  }
+  stats.resident_bytes = resident_bytes_;
+  stats.budget_bytes = budget_;
+  stats.pending_bytes = pending_bytes_;
+  stats.uploaded_bytes = uploaded_bytes_;
+  stats.evictions = evictions_;
+  stats.staging_buffers = staging_.size();
+  return stats;
+}
+
+} // namespace asap::ui
@@ -0,0 +1,230 @@
+/*     SPDX-License-Identifier: BSD-3-Clause     */
+
+//        Copyright The Authors 2021.
+//    Distributed under the 3-Clause BSD License.
+//    (See accompanying file LICENSE or copy at
+//   https://opensource.org/licenses/BSD-3-Clause)
+
+#pragma once
+
+#include <glad/gl.h>
+#include <imgui/imgui.h>
+#include <logging/logging.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace asap::ui {
+
+/*!
+ * \brief Owner of the GL textures of the application, with asynchronous
+ * uploads and a memory budget.
+ *
+ * The application refers to the textures with handles, which stay valid until
+ * the texture is released, and gets the ImTextureID to draw with from Use()
+ * in each frame. The handles are never reused: a released handle reads as an
+ * invalid texture.
+ *
+ * Pixels are not sent to GL when Upload() is called. They are queued, and
+ * Update() copies a bounded amount of them per frame into a ring of pixel
+ * buffer objects, from which GL fills the textures without stalling the
+ * frame. A fence marks when a pixel buffer can be written again; a busy one
+ * is simply skipped until a later frame.
+ *
+ * The GPU memory of each texture is estimated from its size and levels. When
+ * the total exceeds the budget, the least recently used textures are evicted:
+ * their GL texture is deleted and they must be uploaded again before being
+ * drawn. Textures used in the last frame, pinned ones, and ones with an
+ * upload still queued are never evicted; the budget can be exceeded for them.
+ *
+ * The manager must be used from the UI thread, and cleared while the OpenGL
+ * context is still alive.
+ */
+class TextureManager : public asap::logging::Loggable<TextureManager> {
+public:
+  /// Identifies a texture until it is released. The default handle is no
+  /// texture.
+  class Handle {
+  public:
+    Handle() = default;
+
+    explicit operator bool() const {
+      return generation_ != 0;
+    }
+    friend auto operator==(Handle lhs, Handle rhs) -> bool {
+      return lhs.index_ == rhs.index_ && lhs.generation_ == rhs.generation_;
+    }
+    friend auto operator!=(Handle lhs, Handle rhs) -> bool {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class TextureManager;
+    Handle(std::uint32_t index, std::uint32_t generation)
+        : index_(index), generation_(generation) {
+    }
+
+    std::uint32_t index_{0};
+    std::uint32_t generation_{0};
+  };
+
+  struct Options {
+    /// Mipmap levels, the level 0 being the full size.
+    int levels{1};
+    /// Linear filtering, nearest otherwise.
+    bool linear{true};
+    /// Never evicted, for render targets and the like.
+    bool pinned{false};
+  };
+
+  enum class State {
+    /// Released, or never created.
+    INVALID,
+    /// Pixels are waiting to be uploaded, the texture can't be drawn yet.
+    UPLOADING,
+    /// Allocated and filled with all the pixels uploaded so far.
+    READY,
+    /// Deleted to stay within the budget, must be uploaded again.
+    EVICTED
+  };
+
+  struct Stats {
+    std::size_t textures{0};
+    std::size_t resident{0};
+    /// Estimated GPU memory of the resident textures.
+    std::size_t resident_bytes{0};
+    std::size_t budget_bytes{0};
+    /// Bytes queued and not yet copied to a pixel buffer.
+    std::size_t pending_bytes{0};
+    std::size_t uploaded_bytes{0};
+    std::size_t evictions{0};
+    std::size_t staging_buffers{0};
+  };
+
+  static constexpr std::size_t DEFAULT_BUDGET = std::size_t{256} << 20U;
+
+  /// The manager used for all the application textures.
+  static auto Default() -> TextureManager &;
+
+  TextureManager() = default;
+
+  TextureManager(const TextureManager &) = delete;
+  TextureManager(TextureManager &&) = delete;
+  auto operator=(const TextureManager &) -> TextureManager & = delete;
+  auto operator=(TextureManager &&) -> TextureManager & = delete;
+
+  ~TextureManager();
+
+  /// Allocate an RGBA texture of `width` x `height` pixels, with undefined
+  /// contents.
+  auto Create(int width, int height, Options options) -> Handle;
+  auto Create(int width, int height) -> Handle {
+    return Create(width, height, Options());
+  }
+  /// Delete the texture, the handle is invalid from now on.
+  void Release(Handle texture);
+  /// Re-allocate the texture at a new size, the contents are lost and the
+  /// pending uploads dropped. Nothing is done if the size is the same.
+  void Resize(Handle texture, int width, int height);
+
+  /*!
+   * \brief Queue the upload of a rectangle of `level` of the texture.
+   *
+   * `pixels` are RGBA, 4 bytes per pixel, in rows of `width` pixels without
+   * padding. An evicted texture is re-allocated, and must be uploaded in full
+   * before it is drawn.
+   */
+  void Upload(Handle texture, int level, int x, int y, int width, int height,
+      std::vector<std::uint32_t> pixels);
+
+  [[nodiscard]] auto GetState(Handle texture) const -> State;
+  /// Size of the level 0, or 0x0 for an invalid handle.
+  [[nodiscard]] auto GetSize(Handle texture) const -> ImVec2;
+
+  /// The texture to draw with in this frame, which keeps it from being
+  /// evicted. nullptr unless the texture is ready.
+  auto Use(Handle texture) -> ImTextureID;
+  /// The GL name of a resident texture, to attach it to a framebuffer and
+  /// the like, or 0. Also counts as a use.
+  auto GlName(Handle texture) -> GLuint;
+  /// Draw the texture as an item, or leave the space empty when it is not
+  /// ready.
+  void Image(Handle texture, const ImVec2 &size, const ImVec2 &uv0 = {0, 0},
+      const ImVec2 &uv1 = {1, 1});
+
+  /// Evict the textures over budget and copy the pending pixels to the pixel
+  /// buffers. Called once per frame, before the frame is built.
+  void Update();
+
+  void SetBudget(std::size_t bytes);
+  [[nodiscard]] auto GetBudget() const -> std::size_t {
+    return budget_;
+  }
+
+  /// Release all the textures and pixel buffers.
+  void Clear();
+
+  [[nodiscard]] auto GetStats() const -> Stats;
+
+  static const char *const LOGGER_NAME;
+
+private:
+  struct Texture {
+    GLuint name{0};
+    int width{0};
+    int height{0};
+    Options options;
+    State state{State::INVALID};
+    std::uint32_t generation{1};
+    std::size_t bytes{0};
+    int last_used_frame{-1};
+    /// Bands queued for the texture.
+    std::size_t pending_bands{0};
+  };
+
+  /// Rows of an upload, copied in one pixel buffer.
+  struct Band {
+    Handle texture;
+    int level;
+    int x;
+    int y;
+    int width;
+    int rows;
+    /// The pixels of the whole upload, shared by its bands.
+    std::shared_ptr<const std::vector<std::uint32_t>> pixels;
+    std::size_t first_pixel;
+  };
+
+  struct StagingBuffer {
+    GLuint name{0};
+    /// Set when GL may still read the buffer.
+    GLsync fence{nullptr};
+  };
+
+  auto Find(Handle texture) -> Texture *;
+  [[nodiscard]] auto Find(Handle texture) const -> const Texture *;
+  void Allocate(Texture &texture);
+  void Evict(Texture &texture);
+  /// Drop the bands queued for the texture.
+  void Forget(Handle texture);
+  void EvictOverBudget();
+  /// A pixel buffer which GL is done with, or nullptr.
+  auto FreeStagingBuffer() -> StagingBuffer *;
+  void CopyBands();
+
+  std::vector<Texture> textures_;
+  std::vector<std::uint32_t> free_slots_;
+  std::deque<Band> bands_;
+  std::vector<StagingBuffer> staging_;
+
+  std::size_t budget_{DEFAULT_BUDGET};
+  std::size_t resident_bytes_{0};
+  std::size_t pending_bytes_{0};
+  std::size_t uploaded_bytes_{0};
+  std::size_t evictions_{0};
+};
+
+} // namespace asap::ui
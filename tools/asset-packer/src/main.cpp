@@ -0,0 +1,205 @@
+//===----------------------------------------------------------------------===//
+// Distributed under the 3-Clause BSD License. See accompanying file LICENSE or
+// copy at https://opensource.org/licenses/BSD-3-Clause).
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+// Bundle files in an asset pack (see assets/pack_format.h).
+//
+// Usage: asset-packer <output> <root> <list>
+//
+//   output - the asset pack to write.
+//   root   - the directory the asset names are relative to.
+//   list   - a file with the paths of the files to pack, one per line.
+//
+// Each file is compressed, and stored compressed only when that saves enough
+// space to be worth the decompression at runtime. The pack is only re-written
+// when its contents change.
+
+#include "assets/compression.h"
+#include "assets/pack_format.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+namespace pack = asap::assets::pack;
+
+namespace {
+
+/// Entries are stored compressed only if that saves at least 1/8 of their
+/// size.
+constexpr std::size_t MIN_SAVING_DIVISOR = 8;
+
+struct Asset {
+  std::string name;
+  pack::Entry entry{};
+  std::vector<unsigned char> stored;
+};
+
+auto ReadFile(const fs::path &path, std::vector<unsigned char> &contents)
+    -> bool {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  contents.assign(
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return true;
+}
+
+auto PackAsset(const fs::path &root, const fs::path &path, Asset &asset)
+    -> bool {
+  std::vector<unsigned char> contents;
+  if (!ReadFile(path, contents)) {
+    std::cerr << "asset-packer: can't read " << path.string() << "\n";
+    return false;
+  }
+  asset.name = fs::relative(path, root).generic_string();
+  if (asset.name.empty() || asset.name.rfind("..", 0) == 0) {
+    std::cerr << "asset-packer: " << path.string() << " is not in "
+              << root.string() << "\n";
+    return false;
+  }
+
+  auto &entry = asset.entry;
+  entry.size = contents.size();
+  entry.hash = pack::Hash(contents.data(), contents.size());
+  auto compressed = asap::assets::Compress(contents.data(), contents.size());
+  if (compressed.size() <=
+      contents.size() - contents.size() / MIN_SAVING_DIVISOR) {
+    entry.compression = pack::Compression::LZ;
+    asset.stored = std::move(compressed);
+  } else {
+    entry.compression = pack::Compression::NONE;
+    asset.stored = std::move(contents);
+  }
+  entry.stored_size = asset.stored.size();
+  return true;
+}
+
+auto AlignUp(std::size_t value) -> std::size_t {
+  return (value + pack::ALIGNMENT - 1) / pack::ALIGNMENT * pack::ALIGNMENT;
+}
+
+auto Serialize(std::vector<Asset> &assets) -> std::vector<unsigned char> {
+  std::sort(assets.begin(), assets.end(),
+      [](const Asset &lhs, const Asset &rhs) { return lhs.name < rhs.name; });
+
+  std::string names;
+  for (auto &asset : assets) {
+    asset.entry.name_offset = static_cast<std::uint32_t>(names.size());
+    asset.entry.name_size = static_cast<std::uint32_t>(asset.name.size());
+    names += asset.name;
+  }
+
+  pack::Header header{};
+  header.magic = pack::MAGIC;
+  header.entry_count = static_cast<std::uint32_t>(assets.size());
+  header.names_size = static_cast<std::uint32_t>(names.size());
+
+  auto offset = AlignUp(
+      sizeof(header) + assets.size() * sizeof(pack::Entry) + names.size());
+  for (auto &asset : assets) {
+    asset.entry.offset = offset;
+    offset = AlignUp(offset + asset.stored.size());
+  }
+
+  std::vector<unsigned char> out;
+  out.reserve(offset);
+  const auto append = [&out](const void *data, std::size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    out.insert(out.end(), bytes, bytes + size); // NOLINT
+  };
+  append(&header, sizeof(header));
+  for (const auto &asset : assets) {
+    append(&asset.entry, sizeof(asset.entry));
+  }
+  append(names.data(), names.size());
+  for (const auto &asset : assets) {
+    out.resize(static_cast<std::size_t>(asset.entry.offset));
+    append(asset.stored.data(), asset.stored.size());
+  }
+  return out;
+}
+
+/// Write the pack, unless it is unchanged to not trigger the re-build of what
+/// depends on it.
+auto WritePack(const fs::path &output, const std::vector<unsigned char> &data)
+    -> bool {
+  std::vector<unsigned char> previous;
+  if (ReadFile(output, previous) && previous == data) {
+    return true;
+  }
+  auto temp = output;
+  temp += ".tmp";
+  {
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(data.data()), // NOLINT
+        static_cast<std::streamsize>(data.size()));
+    if (!out) {
+      std::cerr << "asset-packer: can't write " << temp.string() << "\n";
+      return false;
+    }
+  }
+  std::error_code error;
+  fs::rename(temp, output, error);
+  if (error) {
+    std::cerr << "asset-packer: can't write " << output.string() << ": "
+              << error.message() << "\n";
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  if (argc != 4) {
+    std::cerr << "usage: asset-packer <output> <root> <list>\n";
+    return EXIT_FAILURE;
+  }
+  const fs::path output = argv[1];         // NOLINT
+  const auto root = fs::absolute(argv[2]); // NOLINT
+
+  std::ifstream list(argv[3]); // NOLINT
+  if (!list) {
+    std::cerr << "asset-packer: can't read " << argv[3] << "\n"; // NOLINT
+    return EXIT_FAILURE;
+  }
+  std::vector<Asset> assets;
+  std::string line;
+  while (std::getline(list, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    auto path = fs::path(line);
+    if (path.is_relative()) {
+      path = root / path;
+    }
+    Asset asset;
+    if (!PackAsset(root, path.lexically_normal(), asset)) {
+      return EXIT_FAILURE;
+    }
+    assets.push_back(std::move(asset));
+  }
+
+  const auto data = Serialize(assets);
+  if (!WritePack(output, data)) {
+    return EXIT_FAILURE;
+  }
+
+  std::size_t total = 0;
+  for (const auto &asset : assets) {
+    total += static_cast<std::size_t>(asset.entry.size);
+  }
+  std::cout << "asset-packer: " << assets.size() << " assets, " << total
+            << " bytes packed in " << data.size() << " bytes\n";
+  return EXIT_SUCCESS;
+}